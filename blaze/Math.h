@@ -42,6 +42,8 @@
 
 #include <blaze/math/Accuracy.h>
 #include <blaze/math/BLAS.h>
+#include <blaze/math/BlockCompressedMatrix.h>
+#include <blaze/math/Cholesky.h>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/Constants.h>
@@ -51,12 +53,16 @@
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/Epsilon.h>
 #include <blaze/math/Functions.h>
+#include <blaze/math/Functors.h>
 #include <blaze/math/Infinity.h>
+#include <blaze/math/Inversion.h>
 #include <blaze/math/HybridMatrix.h>
 #include <blaze/math/HybridVector.h>
 #include <blaze/math/LowerMatrix.h>
+#include <blaze/math/MatrixBatch.h>
 #include <blaze/math/Quaternion.h>
 #include <blaze/math/RotationMatrix.h>
+#include <blaze/math/SellMatrix.h>
 #include <blaze/math/Serialization.h>
 #include <blaze/math/Shims.h>
 #include <blaze/math/SMP.h>
@@ -71,6 +77,7 @@
 #include <blaze/math/UniLowerMatrix.h>
 #include <blaze/math/UniUpperMatrix.h>
 #include <blaze/math/UpperMatrix.h>
+#include <blaze/math/VectorBatch.h>
 #include <blaze/math/Views.h>
 
 #endif
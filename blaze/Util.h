@@ -44,6 +44,8 @@
 #include <blaze/util/AlignedArray.h>
 #include <blaze/util/AlignedStorage.h>
 #include <blaze/util/AlignmentCheck.h>
+#include <blaze/util/Arena.h>
+#include <blaze/util/ArenaAllocator.h>
 #include <blaze/util/Algorithm.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Byte.h>
@@ -51,4 +51,20 @@ namespace blaze {
 #define BLAZE_USE_SHARED_MEMORY_PARALLELIZATION 1
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Number of tasks per thread for the C++11 and Boost thread-based parallelization.
+// \ingroup config
+//
+// This setting specifies into how many tasks per thread the C++11 and Boost thread-based
+// parallelization splits an operation. Splitting an operation into more tasks than threads
+// enables idle threads to steal the remaining work of delayed threads (for instance threads
+// sharing their core with another process). On the other hand, each additional task causes
+// some scheduling overhead. Note that this setting has no effect on the OpenMP parallelization.
+//
+// The default setting is 4. The value must be in the range \f$[1..\infty)\f$.
+*/
+const size_t SMP_TASKS_PER_THREAD = 4UL;
+//*************************************************************************************************
+
 } // namespace blaze
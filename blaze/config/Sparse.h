@@ -0,0 +1,65 @@
+//=================================================================================================
+/*!
+//  \file blaze/config/Sparse.h
+//  \brief Configuration of the storage of sparse vectors and matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+namespace blaze {
+
+//*************************************************************************************************
+/*!\brief Index type of the non-zero elements of sparse vectors and matrices.
+// \ingroup config
+//
+// This type definition specifies the data type used by the CompressedVector and CompressedMatrix
+// classes to store the index of each non-zero element. By default, the full \a size_t type is
+// used. Switching to a narrower type (e.g. \a uint32_t) reduces the memory footprint of every
+// non-zero element and therefore the memory traffic of bandwidth-bound sparse operations such
+// as the sparse matrix/dense vector multiplication. For instance, for single precision values
+// the size of a single element is halved from 16 to 8 bytes. Note however that in this case the
+// size of a sparse vector as well as the number of columns of a row-major sparse matrix (or the
+// number of rows of a column-major sparse matrix) is limited by the largest value of the chosen
+// index type. The constructors and the resize() functions of both compressed types throw a
+// \a std::invalid_argument exception in case a larger dimension is requested.\n
+// Alternatively, the index type can be specified via the \c BLAZE_SPARSE_INDEX_TYPE macro (for
+// instance on the command line). Note that the same index type has to be used in all translation
+// units of a program.
+//
+// Valid types for the \a sparse_index_t index type: <a>unsigned integral types</a>
+*/
+#ifndef BLAZE_SPARSE_INDEX_TYPE
+#define BLAZE_SPARSE_INDEX_TYPE size_t
+#endif
+
+typedef BLAZE_SPARSE_INDEX_TYPE  sparse_index_t;
+//*************************************************************************************************
+
+} // namespace blaze
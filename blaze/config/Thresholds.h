@@ -300,6 +300,75 @@ const size_t SMP_DVECSCALARMULT_THRESHOLD = 51000UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP sparse vector/sparse vector addition threshold.
+// \ingroup config
+//
+// This threshold specifies when a sparse vector/sparse vector addition can be executed in
+// parallel. In case the number of elements of the target vector is larger or equal to this
+// threshold, the operation is executed in parallel. If the number of elements is below this
+// threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default mirrors the
+// dense vector/dense vector addition threshold and requires individual adaption for both the OpenMP and the
+// C++11/Boost thread parallelization.
+//
+// The default setting for this threshold is 38000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+const size_t SMP_SVECSVECADD_THRESHOLD = 38000UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse vector/sparse vector subtraction threshold.
+// \ingroup config
+//
+// This threshold specifies when a sparse vector/sparse vector subtraction can be executed in
+// parallel. In case the number of elements of the target vector is larger or equal to this
+// threshold, the operation is executed in parallel. If the number of elements is below this
+// threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default mirrors the
+// dense vector/dense vector subtraction threshold and requires individual adaption for both the OpenMP and the
+// C++11/Boost thread parallelization.
+//
+// The default setting for this threshold is 38000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+const size_t SMP_SVECSVECSUB_THRESHOLD = 38000UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse vector/scalar multiplication threshold.
+// \ingroup config
+//
+// This threshold specifies when a sparse vector/scalar multiplication can be executed in
+// parallel. In case the number of elements of the target vector is larger or equal to this
+// threshold, the operation is executed in parallel. If the number of elements is below this
+// threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default mirrors the
+// dense vector/scalar multiplication threshold and requires individual adaption for both the OpenMP and the
+// C++11/Boost thread parallelization.
+//
+// The default setting for this threshold is 51000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+const size_t SMP_SVECSCALARMULT_THRESHOLD = 51000UL;
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief SMP row-major dense matrix/dense vector multiplication threshold.
 // \ingroup config
@@ -1180,6 +1249,72 @@ const size_t SMP_TSMATTSMATMULT_THRESHOLD = 150UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP sparse matrix/sparse matrix addition threshold.
+// \ingroup config
+//
+// This threshold specifies when a sparse matrix/sparse matrix addition can be executed in
+// parallel. In case the total number of non-zero elements of both operands is larger than this
+// threshold, the operation is executed in parallel. If the number of non-zero elements is below
+// this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default requires
+// individual adaption for both the OpenMP and the C++11/Boost thread parallelization.
+//
+// The default setting for this threshold is 25000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+const size_t SMP_SMATSMATADD_THRESHOLD = 25000UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix/sparse matrix subtraction threshold.
+// \ingroup config
+//
+// This threshold specifies when a sparse matrix/sparse matrix subtraction can be executed in
+// parallel. In case the total number of non-zero elements of both operands is larger than this
+// threshold, the operation is executed in parallel. If the number of non-zero elements is below
+// this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default requires
+// individual adaption for both the OpenMP and the C++11/Boost thread parallelization.
+//
+// The default setting for this threshold is 25000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+const size_t SMP_SMATSMATSUB_THRESHOLD = 25000UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix/scalar multiplication threshold.
+// \ingroup config
+//
+// This threshold specifies when a sparse matrix/scalar multiplication can be executed in
+// parallel. In case the number of non-zero elements of the sparse matrix operand is larger than
+// this threshold, the operation is executed in parallel. If the number of non-zero elements is
+// below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default requires
+// individual adaption for both the OpenMP and the C++11/Boost thread parallelization.
+//
+// The default setting for this threshold is 30000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+const size_t SMP_SMATSCALARMULT_THRESHOLD = 30000UL;
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief SMP dense vector/dense vector outer product threshold.
 // \ingroup config
@@ -1202,4 +1337,74 @@ const size_t SMP_TSMATTSMATMULT_THRESHOLD = 150UL;
 const size_t SMP_DVECTDVECMULT_THRESHOLD = 290UL;
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief SMP dense vector reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when a reduction of a dense vector (as for instance sum(), min(),
+// max(), the norms and the inner product of two dense vectors) can be executed in parallel. In
+// case the number of elements of the vector is larger or equal to this threshold, the reduction
+// is executed in parallel. If the number of elements is below this threshold the reduction is
+// executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization.
+//
+// The default setting for this threshold is 38000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+const size_t SMP_DVECREDUCE_THRESHOLD = 38000UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense matrix reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when a reduction of a dense matrix (as for instance sum(), min() and
+// max()) can be executed in parallel. In case the number of elements of the matrix is larger or
+// equal to this threshold, the reduction is executed in parallel. If the number of elements is
+// below this threshold the reduction is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization.
+//
+// The default setting for this threshold is 48400. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+const size_t SMP_DMATREDUCE_THRESHOLD = 48400UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP projected Gauss-Seidel sweep threshold.
+// \ingroup config
+//
+// This threshold specifies when a parallel sweep of the PGS solver (see PGS::setMode()) is
+// executed in parallel. In case the number of unknowns updated concurrently (i.e. the number
+// of unknowns of a single color or of the complete problem, respectively) is larger than this
+// threshold, the sweep is executed in parallel. Otherwise the sweep is executed single-threaded.
+// Note that the result of a sweep does not depend on this threshold.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture, the
+// shared memory parallelization technique and the number of non-zero elements per row of the
+// LCP matrix. Therefore the default value cannot guarantee maximum performance for all possible
+// situations and configurations. It merely provides a reasonable standard for the current
+// generation of CPUs.
+//
+// The default setting for this threshold is 2000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+*/
+const size_t SMP_PGS_THRESHOLD = 2000UL;
+//*************************************************************************************************
+
 } // namespace blaze
@@ -45,9 +45,11 @@
 #include <blaze/math/expressions/DVecAbsExpr.h>
 #include <blaze/math/expressions/DVecDVecAddExpr.h>
 #include <blaze/math/expressions/DVecDVecCrossExpr.h>
+#include <blaze/math/expressions/DVecDVecMapExpr.h>
 #include <blaze/math/expressions/DVecDVecMultExpr.h>
 #include <blaze/math/expressions/DVecDVecSubExpr.h>
 #include <blaze/math/expressions/DVecEvalExpr.h>
+#include <blaze/math/expressions/DVecMapExpr.h>
 #include <blaze/math/expressions/DVecScalarDivExpr.h>
 #include <blaze/math/expressions/DVecScalarMultExpr.h>
 #include <blaze/math/expressions/DVecSerialExpr.h>
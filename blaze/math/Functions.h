@@ -42,10 +42,13 @@
 
 #include <cmath>
 #include <blaze/math/traits/MathTrait.h>
+#include <blaze/math/typetraits/IsVector.h>
 #include <blaze/system/Inline.h>
 #include <blaze/util/constraints/Builtin.h>
 #include <blaze/util/constraints/FloatingPoint.h>
 #include <blaze/util/constraints/Integral.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/mpl/Or.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsFloatingPoint.h>
@@ -70,7 +73,7 @@ template< typename T >
 inline size_t digits( T a );
 
 template< typename T1, typename T2 >
-BLAZE_ALWAYS_INLINE const typename MathTrait<T1,T2>::HighType
+BLAZE_ALWAYS_INLINE const typename DisableIf< Or< IsVector<T1>, IsVector<T2> >, MathTrait<T1,T2> >::Type::HighType
    min( const T1& a, const T2& b );
 
 template< typename T1, typename T2, typename T3 >
@@ -78,7 +81,7 @@ BLAZE_ALWAYS_INLINE const typename MathTrait< typename MathTrait<T1,T2>::HighTyp
    min( const T1& a, const T2& b, const T3& c );
 
 template< typename T1, typename T2 >
-BLAZE_ALWAYS_INLINE const typename MathTrait<T1,T2>::HighType
+BLAZE_ALWAYS_INLINE const typename DisableIf< Or< IsVector<T1>, IsVector<T2> >, MathTrait<T1,T2> >::Type::HighType
    max( const T1& a, const T2& b );
 
 template< typename T1, typename T2, typename T3 >
@@ -165,7 +168,8 @@ inline size_t digits( T a )
 // the MathTrait class description).
 */
 template< typename T1, typename T2 >
-BLAZE_ALWAYS_INLINE const typename MathTrait<T1,T2>::HighType min( const T1& a, const T2& b )
+BLAZE_ALWAYS_INLINE const typename DisableIf< Or< IsVector<T1>, IsVector<T2> >, MathTrait<T1,T2> >::Type::HighType
+   min( const T1& a, const T2& b )
 {
    // The return type of the function is only a copy of the one of the arguments for two reasons:
    //  - in case the data types T1 and T2 are equal, a reference return type could result in a
@@ -221,7 +225,8 @@ BLAZE_ALWAYS_INLINE const typename MathTrait< typename MathTrait<T1,T2>::HighTyp
 // the MathTrait class description).
 */
 template< typename T1, typename T2 >
-BLAZE_ALWAYS_INLINE const typename MathTrait<T1,T2>::HighType max( const T1& a, const T2& b )
+BLAZE_ALWAYS_INLINE const typename DisableIf< Or< IsVector<T1>, IsVector<T2> >, MathTrait<T1,T2> >::Type::HighType
+   max( const T1& a, const T2& b )
 {
    // The return type of the function is only a copy of the one of the arguments for two reasons:
    //  - in case the data types T1 and T2 are equal, a reference return type could result in a
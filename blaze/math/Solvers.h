@@ -40,10 +40,19 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/solvers/BiCGSTAB.h>
+#include <blaze/math/solvers/BlockJacobiPreconditioner.h>
 #include <blaze/math/solvers/CG.h>
 #include <blaze/math/solvers/CPG.h>
 #include <blaze/math/solvers/GaussianElimination.h>
+#include <blaze/math/solvers/GMRES.h>
+#include <blaze/math/solvers/ICPreconditioner.h>
+#include <blaze/math/solvers/JacobiPreconditioner.h>
 #include <blaze/math/solvers/Lemke.h>
+#include <blaze/math/solvers/LUDecomposition.h>
+#include <blaze/math/solvers/MINRES.h>
+#include <blaze/math/solvers/MixedPrecisionRefinement.h>
 #include <blaze/math/solvers/PGS.h>
+#include <blaze/math/solvers/Preconditioner.h>
 
 #endif
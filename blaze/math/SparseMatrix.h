@@ -73,6 +73,7 @@
 #include <blaze/math/Matrix.h>
 #include <blaze/math/smp/DenseMatrix.h>
 #include <blaze/math/smp/SparseMatrix.h>
+#include <blaze/math/sparse/SMMM.h>
 #include <blaze/math/sparse/SparseMatrix.h>
 
 #endif
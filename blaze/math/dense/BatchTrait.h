@@ -0,0 +1,157 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BatchTrait.h
+//  \brief Header file for the BatchTrait class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BATCHTRAIT_H_
+#define _BLAZE_MATH_DENSE_BATCHTRAIT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Intrinsics.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/mpl/Or.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packed element access for the batched small matrix and vector operations.
+// \ingroup dense_matrix
+//
+// The BatchTrait class template determines the number of lanes of a block of a MatrixBatch or
+// VectorBatch and provides the load, store and broadcast operations of a single element of all
+// objects of a block. For single and double precision floating point values, a lane corresponds
+// to an element of an intrinsic vector, i.e. a block contains as many objects as fit into a
+// SIMD register. For all other data types, a block contains a single object and the operations
+// are performed on scalars. Thus all batch kernels can be formulated once in terms of the
+// \a PackType and are vectorized whenever possible.
+*/
+template< typename Type                                          // Data type of the elements
+        , bool = Or< IsFloat<Type>, IsDouble<Type> >::value >  // Vectorization flag
+struct BatchTrait
+{
+   //**Type definitions****************************************************************************
+   typedef Type  PackType;  //!< Type of one element of all objects of a block.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   enum { size = 1 };  //!< Number of objects per block.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static BLAZE_ALWAYS_INLINE PackType load( const Type* address ) {
+      return *address;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static BLAZE_ALWAYS_INLINE void store( Type* address, const PackType& value ) {
+      *address = value;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static BLAZE_ALWAYS_INLINE void storeu( Type* address, const PackType& value ) {
+      *address = value;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static BLAZE_ALWAYS_INLINE PackType set( Type value ) {
+      return value;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the BatchTrait class template for single and double precision values.
+// \ingroup dense_matrix
+*/
+template< typename Type >  // Data type of the elements
+struct BatchTrait<Type,true>
+{
+   //**Type definitions****************************************************************************
+   typedef typename IntrinsicTrait<Type>::Type  PackType;  //!< Type of one element of all objects of a block.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   enum { size = IntrinsicTrait<Type>::size };  //!< Number of objects per block.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static BLAZE_ALWAYS_INLINE PackType load( const Type* address ) {
+      return blaze::load( address );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static BLAZE_ALWAYS_INLINE void store( Type* address, const PackType& value ) {
+      blaze::store( address, value );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static BLAZE_ALWAYS_INLINE void storeu( Type* address, const PackType& value ) {
+      blaze::storeu( address, value );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static BLAZE_ALWAYS_INLINE PackType set( Type value ) {
+      return blaze::set( value );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,794 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Cholesky.h
+//  \brief Header file for the dense Cholesky and LDLT decompositions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_CHOLESKY_H_
+#define _BLAZE_MATH_DENSE_CHOLESKY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <stdexcept>
+#include <blaze/math/adaptors/LowerMatrix.h>
+#include <blaze/math/adaptors/SymmetricMatrix.h>
+#include <blaze/math/adaptors/UniLowerMatrix.h>
+#include <blaze/math/adaptors/UniUpperMatrix.h>
+#include <blaze/math/adaptors/UpperMatrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DMatTransExpr.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/views/DenseSubmatrix.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  DECOMPOSITION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked in-place Cholesky or LDLT decomposition of a symmetric row-major matrix.
+// \ingroup dense_matrix
+//
+// \param W The symmetric matrix to be decomposed; the lower part is replaced by the factor.
+// \param d The resulting diagonal matrix \f$ D \f$ (LDLT decomposition only).
+// \param ldlt \a true for the LDLT decomposition, \a false for the Cholesky decomposition.
+// \return void
+// \exception std::invalid_argument Matrix is not positive definite.
+// \exception std::invalid_argument Matrix is singular.
+//
+// The columns of the matrix are processed in panels of 64 columns. For each panel, the diagonal
+// block and the rows below are factorized via dot products with the previously computed columns
+// of the panel. Afterwards the lower part of the trailing submatrix is updated block column by
+// block column via \f$ A_{22} -= L_{21} L_{21}^T \f$ (Cholesky) or \f$ A_{22} -= L_{21} D_1
+// L_{21}^T \f$ (LDLT). Each update is a dense matrix multiplication on copies of the panel,
+// which is executed via the active shared-memory parallelization backend. Only the lower part
+// of \a W is accessed.
+*/
+template< typename ET >  // Element type of the matrix
+void decomposeSymmetric( DynamicMatrix<ET,rowMajor>& W, DynamicVector<ET,columnVector>& d, bool ldlt )
+{
+   const size_t n ( W.rows() );
+   const size_t nb( 64UL );
+
+   DynamicMatrix<ET,rowMajor> P, Q;
+
+   d.resize( n, false );
+
+   for( size_t k=0UL; k<n; k+=nb )
+   {
+      const size_t k2( min( k+nb, n ) );
+      const size_t kb( k2-k );
+      const size_t m ( n-k2 );
+
+      // Factorizing the panel
+      for( size_t j=k; j<k2; ++j )
+      {
+         const ET* const lj( W.data(j) );
+
+         ET pivot( lj[j] );
+         for( size_t l=k; l<j; ++l )
+            pivot -= ( ldlt )?( lj[l] * lj[l] * d[l] ):( lj[l] * lj[l] );
+
+         if( ldlt ) {
+            if( isDefault( pivot ) )
+               throw std::invalid_argument( "Matrix is singular" );
+            d[j] = pivot;
+            W(j,j) = ET(1);
+         }
+         else {
+            if( !( pivot > ET(0) ) )
+               throw std::invalid_argument( "Matrix is not positive definite" );
+            d[j] = std::sqrt( pivot );
+            W(j,j) = d[j];
+         }
+
+         const ET inv( ET(1) / d[j] );
+
+         for( size_t i=j+1UL; i<n; ++i )
+         {
+            ET* const li( W.data(i) );
+
+            ET tmp( li[j] );
+            for( size_t l=k; l<j; ++l )
+               tmp -= ( ldlt )?( li[l] * d[l] * lj[l] ):( li[l] * lj[l] );
+
+            li[j] = tmp * inv;
+         }
+      }
+
+      if( m == 0UL ) break;
+
+      // Updating the lower part of the trailing submatrix
+      P = submatrix( W, k2, k, m, kb );
+      Q = P;
+
+      if( ldlt ) {
+         for( size_t i=0UL; i<m; ++i )
+            for( size_t l=0UL; l<kb; ++l )
+               Q(i,l) *= d[k+l];
+      }
+
+      for( size_t j=0UL; j<m; j+=nb ) {
+         const size_t jb( min( nb, m-j ) );
+         submatrix( W, k2+j, k2+j, m-j, jb ) -= submatrix( P, j, 0UL, m-j, kb ) * trans( submatrix( Q, j, 0UL, jb, kb ) );
+      }
+   }
+
+   // Resetting the upper part of the matrix
+   for( size_t i=0UL; i<n; ++i )
+      for( size_t j=i+1UL; j<n; ++j )
+         reset( W(i,j) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Decomposition functions */
+//@{
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+void llt( const SymmetricMatrix<MT1,SO1,true,true>& A, LowerMatrix<MT2,SO2,true>& L );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2, typename VT >
+void ldlt( const SymmetricMatrix<MT1,SO1,true,true>& A, UniLowerMatrix<MT2,SO2,true>& L,
+           DenseVector<VT,false>& d );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Cholesky decomposition of a symmetric positive definite dense matrix (\f$ A = L L^T \f$).
+// \ingroup dense_matrix
+//
+// \param A The symmetric positive definite matrix to be decomposed.
+// \param L The resulting lower triangular Cholesky factor.
+// \return void
+// \exception std::invalid_argument Matrix is not positive definite.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes the lower triangular matrix \f$ L \f$ with positive diagonal elements
+// such that \f$ A = L L^T \f$. The decomposition requires half the operations of an LU
+// decomposition. In case \a A is not positive definite, a \a std::invalid_argument exception
+// is thrown. In case \a L cannot be resized to the size of \a A, a \a std::invalid_argument
+// exception is thrown.
+
+   \code
+   blaze::SymmetricMatrix< blaze::DynamicMatrix<double> > A;
+   blaze::LowerMatrix< blaze::DynamicMatrix<double> > L;
+   blaze::DynamicMatrix<double> B;
+   // ... Resizing and initialization
+
+   llt( A, L );       // Computing the decomposition A = L L^T
+   lltSolve( L, B );  // Solving A X = B in-place for all columns of B
+   \endcode
+*/
+template< typename MT1  // Type of the adapted symmetric matrix
+        , bool SO1      // Storage order of the adapted symmetric matrix
+        , typename MT2  // Type of the adapted lower matrix
+        , bool SO2 >    // Storage order of the adapted lower matrix
+void llt( const SymmetricMatrix<MT1,SO1,true,true>& A, LowerMatrix<MT2,SO2,true>& L )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef typename MT1::ElementType  ET;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+
+   DynamicMatrix<ET,rowMajor> W( A );
+   DynamicVector<ET,columnVector> d;
+
+   decomposeSymmetric( W, d, false );
+
+   L = W;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LDLT decomposition of a symmetric dense matrix (\f$ A = L D L^T \f$).
+// \ingroup dense_matrix
+//
+// \param A The symmetric matrix to be decomposed.
+// \param L The resulting unit lower triangular factor.
+// \param d The resulting diagonal of the diagonal factor \f$ D \f$.
+// \return void
+// \exception std::invalid_argument Matrix is singular.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes the unit lower triangular matrix \f$ L \f$ and the diagonal matrix
+// \f$ D \f$ such that \f$ A = L D L^T \f$. In contrast to the Cholesky decomposition, \a A is
+// not required to be positive definite and no square roots are computed. However, since no
+// pivoting is performed, the decomposition fails with a \a std::invalid_argument exception in
+// case a zero pivot is encountered. It is therefore recommended for symmetric quasi-definite
+// matrices only.
+*/
+template< typename MT1  // Type of the adapted symmetric matrix
+        , bool SO1      // Storage order of the adapted symmetric matrix
+        , typename MT2  // Type of the adapted unilower matrix
+        , bool SO2      // Storage order of the adapted unilower matrix
+        , typename VT > // Type of the diagonal vector
+void ldlt( const SymmetricMatrix<MT1,SO1,true,true>& A, UniLowerMatrix<MT2,SO2,true>& L,
+           DenseVector<VT,false>& d )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef typename MT1::ElementType  ET;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+
+   DynamicMatrix<ET,rowMajor> W( A );
+   DynamicVector<ET,columnVector> tmp;
+
+   decomposeSymmetric( W, tmp, true );
+
+   L = W;
+   ~d = tmp;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TRIANGULAR SUBSTITUTION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place forward substitution with a lower triangular matrix (\f$ L X = B \f$).
+// \ingroup dense_matrix
+//
+// \param L The lower triangular matrix.
+// \param B The right-hand sides (one per column), replaced by the solution.
+// \param unit \a true in case \a L has a unit diagonal, \a false if not.
+// \return void
+//
+// The rows of \a B are computed one after another. Each row is updated by a multiple of all
+// previously computed rows, i.e. all right-hand sides are processed at once.
+*/
+template< typename MT1  // Type of the lower triangular matrix
+        , bool SO1      // Storage order of the lower triangular matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void lowerSubstitution( const DenseMatrix<MT1,SO1>& L, DenseMatrix<MT2,SO2>& B, bool unit )
+{
+   const size_t n( (~B).rows() );
+   const size_t m( (~B).columns() );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      for( size_t j=0UL; j<i; ++j ) {
+         const typename MT1::ElementType l( (~L)(i,j) );
+         if( isDefault( l ) ) continue;
+         for( size_t k=0UL; k<m; ++k )
+            (~B)(i,k) -= l * (~B)(j,k);
+      }
+
+      if( !unit ) {
+         const typename MT1::ElementType inv( typename MT1::ElementType(1) / (~L)(i,i) );
+         for( size_t k=0UL; k<m; ++k )
+            (~B)(i,k) *= inv;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place backward substitution with an upper triangular matrix (\f$ U X = B \f$).
+// \ingroup dense_matrix
+//
+// \param U The upper triangular matrix.
+// \param B The right-hand sides (one per column), replaced by the solution.
+// \param unit \a true in case \a U has a unit diagonal, \a false if not.
+// \return void
+*/
+template< typename MT1  // Type of the upper triangular matrix
+        , bool SO1      // Storage order of the upper triangular matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void upperSubstitution( const DenseMatrix<MT1,SO1>& U, DenseMatrix<MT2,SO2>& B, bool unit )
+{
+   const size_t n( (~B).rows() );
+   const size_t m( (~B).columns() );
+
+   for( size_t i=n-1UL; i<n; --i )
+   {
+      for( size_t j=i+1UL; j<n; ++j ) {
+         const typename MT1::ElementType u( (~U)(i,j) );
+         if( isDefault( u ) ) continue;
+         for( size_t k=0UL; k<m; ++k )
+            (~B)(i,k) -= u * (~B)(j,k);
+      }
+
+      if( !unit ) {
+         const typename MT1::ElementType inv( typename MT1::ElementType(1) / (~U)(i,i) );
+         for( size_t k=0UL; k<m; ++k )
+            (~B)(i,k) *= inv;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place backward substitution with a transposed lower triangular matrix (\f$ L^T X = B \f$).
+// \ingroup dense_matrix
+//
+// \param L The lower triangular matrix.
+// \param B The right-hand sides (one per column), replaced by the solution.
+// \param unit \a true in case \a L has a unit diagonal, \a false if not.
+// \return void
+//
+// The rows of \a B are finalized in reverse order. Each finalized row is subtracted from all
+// previous rows according to the according row of \a L, i.e. the transpose of \a L is never
+// formed explicitly.
+*/
+template< typename MT1  // Type of the lower triangular matrix
+        , bool SO1      // Storage order of the lower triangular matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void lowerTransSubstitution( const DenseMatrix<MT1,SO1>& L, DenseMatrix<MT2,SO2>& B, bool unit )
+{
+   const size_t n( (~B).rows() );
+   const size_t m( (~B).columns() );
+
+   for( size_t i=n-1UL; i<n; --i )
+   {
+      if( !unit ) {
+         const typename MT1::ElementType inv( typename MT1::ElementType(1) / (~L)(i,i) );
+         for( size_t k=0UL; k<m; ++k )
+            (~B)(i,k) *= inv;
+      }
+
+      for( size_t j=0UL; j<i; ++j ) {
+         const typename MT1::ElementType l( (~L)(i,j) );
+         if( isDefault( l ) ) continue;
+         for( size_t k=0UL; k<m; ++k )
+            (~B)(j,k) -= l * (~B)(i,k);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary wrapper for the substitution of a single right-hand side vector.
+// \ingroup dense_matrix
+//
+// The wrapper presents a dense column vector as a single column matrix to the substitution
+// kernels.
+*/
+template< typename VT >  // Type of the dense vector
+struct SubstitutionVector : public DenseMatrix< SubstitutionVector<VT>, false >
+{
+   typedef typename VT::ElementType  ElementType;
+
+   explicit inline SubstitutionVector( VT& v ) : v_( v ) {}
+
+   inline size_t rows()    const { return v_.size(); }
+   inline size_t columns() const { return 1UL; }
+
+   inline ElementType& operator()( size_t i, size_t /*j*/ ) { return v_[i]; }
+   inline const ElementType& operator()( size_t i, size_t /*j*/ ) const { return v_[i]; }
+
+   VT& v_;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TRIANGULAR SOLVE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Triangular solve functions */
+//@{
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+inline void solve( const LowerMatrix<MT1,SO1,true>& L, DenseMatrix<MT2,SO2>& B );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+inline void solve( const UniLowerMatrix<MT1,SO1,true>& L, DenseMatrix<MT2,SO2>& B );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+inline void solve( const UpperMatrix<MT1,SO1,true>& U, DenseMatrix<MT2,SO2>& B );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+inline void solve( const UniUpperMatrix<MT1,SO1,true>& U, DenseMatrix<MT2,SO2>& B );
+
+template< typename MT, bool SO, typename VT >
+inline void solve( const LowerMatrix<MT,SO,true>& L, DenseVector<VT,false>& b );
+
+template< typename MT, bool SO, typename VT >
+inline void solve( const UniLowerMatrix<MT,SO,true>& L, DenseVector<VT,false>& b );
+
+template< typename MT, bool SO, typename VT >
+inline void solve( const UpperMatrix<MT,SO,true>& U, DenseVector<VT,false>& b );
+
+template< typename MT, bool SO, typename VT >
+inline void solve( const UniUpperMatrix<MT,SO,true>& U, DenseVector<VT,false>& b );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+inline void lltSolve( const LowerMatrix<MT1,SO1,true>& L, DenseMatrix<MT2,SO2>& B );
+
+template< typename MT, bool SO, typename VT >
+inline void lltSolve( const LowerMatrix<MT,SO,true>& L, DenseVector<VT,false>& b );
+
+template< typename MT1, bool SO1, typename VT1, typename MT2, bool SO2 >
+inline void ldltSolve( const UniLowerMatrix<MT1,SO1,true>& L, const DenseVector<VT1,false>& d,
+                       DenseMatrix<MT2,SO2>& B );
+
+template< typename MT, bool SO, typename VT1, typename VT2 >
+inline void ldltSolve( const UniLowerMatrix<MT,SO,true>& L, const DenseVector<VT1,false>& d,
+                       DenseVector<VT2,false>& b );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place solution of a lower triangular system (\f$ L X = B \f$).
+// \ingroup dense_matrix
+//
+// \param L The lower triangular system matrix.
+// \param B The right-hand sides (one per column), replaced by the solution.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename MT1  // Type of the adapted lower matrix
+        , bool SO1      // Storage order of the adapted lower matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline void solve( const LowerMatrix<MT1,SO1,true>& L, DenseMatrix<MT2,SO2>& B )
+{
+   if( L.rows() != (~B).rows() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   lowerSubstitution( L, ~B, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place solution of a unit lower triangular system (\f$ L X = B \f$).
+// \ingroup dense_matrix
+//
+// \param L The unit lower triangular system matrix.
+// \param B The right-hand sides (one per column), replaced by the solution.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename MT1  // Type of the adapted unilower matrix
+        , bool SO1      // Storage order of the adapted unilower matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline void solve( const UniLowerMatrix<MT1,SO1,true>& L, DenseMatrix<MT2,SO2>& B )
+{
+   if( L.rows() != (~B).rows() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   lowerSubstitution( L, ~B, true );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place solution of an upper triangular system (\f$ U X = B \f$).
+// \ingroup dense_matrix
+//
+// \param U The upper triangular system matrix.
+// \param B The right-hand sides (one per column), replaced by the solution.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename MT1  // Type of the adapted upper matrix
+        , bool SO1      // Storage order of the adapted upper matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline void solve( const UpperMatrix<MT1,SO1,true>& U, DenseMatrix<MT2,SO2>& B )
+{
+   if( U.rows() != (~B).rows() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   upperSubstitution( U, ~B, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place solution of a unit upper triangular system (\f$ U X = B \f$).
+// \ingroup dense_matrix
+//
+// \param U The unit upper triangular system matrix.
+// \param B The right-hand sides (one per column), replaced by the solution.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename MT1  // Type of the adapted uniupper matrix
+        , bool SO1      // Storage order of the adapted uniupper matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline void solve( const UniUpperMatrix<MT1,SO1,true>& U, DenseMatrix<MT2,SO2>& B )
+{
+   if( U.rows() != (~B).rows() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   upperSubstitution( U, ~B, true );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place solution of a lower triangular system (\f$ L x = b \f$).
+// \ingroup dense_matrix
+//
+// \param L The lower triangular system matrix.
+// \param b The right-hand side vector, replaced by the solution.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+*/
+template< typename MT  // Type of the adapted lower matrix
+        , bool SO      // Storage order of the adapted lower matrix
+        , typename VT >  // Type of the right-hand side vector
+inline void solve( const LowerMatrix<MT,SO,true>& L, DenseVector<VT,false>& b )
+{
+   if( L.rows() != (~b).size() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   SubstitutionVector<VT> B( ~b );
+   lowerSubstitution( L, B, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place solution of a unit lower triangular system (\f$ L x = b \f$).
+// \ingroup dense_matrix
+//
+// \param L The unit lower triangular system matrix.
+// \param b The right-hand side vector, replaced by the solution.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+*/
+template< typename MT  // Type of the adapted unilower matrix
+        , bool SO      // Storage order of the adapted unilower matrix
+        , typename VT >  // Type of the right-hand side vector
+inline void solve( const UniLowerMatrix<MT,SO,true>& L, DenseVector<VT,false>& b )
+{
+   if( L.rows() != (~b).size() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   SubstitutionVector<VT> B( ~b );
+   lowerSubstitution( L, B, true );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place solution of an upper triangular system (\f$ U x = b \f$).
+// \ingroup dense_matrix
+//
+// \param U The upper triangular system matrix.
+// \param b The right-hand side vector, replaced by the solution.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+*/
+template< typename MT  // Type of the adapted upper matrix
+        , bool SO      // Storage order of the adapted upper matrix
+        , typename VT >  // Type of the right-hand side vector
+inline void solve( const UpperMatrix<MT,SO,true>& U, DenseVector<VT,false>& b )
+{
+   if( U.rows() != (~b).size() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   SubstitutionVector<VT> B( ~b );
+   upperSubstitution( U, B, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place solution of a unit upper triangular system (\f$ U x = b \f$).
+// \ingroup dense_matrix
+//
+// \param U The unit upper triangular system matrix.
+// \param b The right-hand side vector, replaced by the solution.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+*/
+template< typename MT  // Type of the adapted uniupper matrix
+        , bool SO      // Storage order of the adapted uniupper matrix
+        , typename VT >  // Type of the right-hand side vector
+inline void solve( const UniUpperMatrix<MT,SO,true>& U, DenseVector<VT,false>& b )
+{
+   if( U.rows() != (~b).size() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   SubstitutionVector<VT> B( ~b );
+   upperSubstitution( U, B, true );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place solution of a system with a given Cholesky decomposition (\f$ L L^T X = B \f$).
+// \ingroup dense_matrix
+//
+// \param L The Cholesky factor of the system matrix (see llt()).
+// \param B The right-hand sides (one per column), replaced by the solution.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The system is solved by a forward substitution with \a L and a backward substitution with
+// the transpose of \a L. The transpose is not formed explicitly.
+*/
+template< typename MT1  // Type of the adapted lower matrix
+        , bool SO1      // Storage order of the adapted lower matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline void lltSolve( const LowerMatrix<MT1,SO1,true>& L, DenseMatrix<MT2,SO2>& B )
+{
+   if( L.rows() != (~B).rows() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   lowerSubstitution     ( L, ~B, false );
+   lowerTransSubstitution( L, ~B, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place solution of a system with a given Cholesky decomposition (\f$ L L^T x = b \f$).
+// \ingroup dense_matrix
+//
+// \param L The Cholesky factor of the system matrix (see llt()).
+// \param b The right-hand side vector, replaced by the solution.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+*/
+template< typename MT  // Type of the adapted lower matrix
+        , bool SO      // Storage order of the adapted lower matrix
+        , typename VT >  // Type of the right-hand side vector
+inline void lltSolve( const LowerMatrix<MT,SO,true>& L, DenseVector<VT,false>& b )
+{
+   if( L.rows() != (~b).size() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   SubstitutionVector<VT> B( ~b );
+   lowerSubstitution     ( L, B, false );
+   lowerTransSubstitution( L, B, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place solution of a system with a given LDLT decomposition (\f$ L D L^T X = B \f$).
+// \ingroup dense_matrix
+//
+// \param L The unit lower triangular factor of the system matrix (see ldlt()).
+// \param d The diagonal of the diagonal factor of the system matrix.
+// \param B The right-hand sides (one per column), replaced by the solution.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename MT1  // Type of the adapted unilower matrix
+        , bool SO1      // Storage order of the adapted unilower matrix
+        , typename VT1  // Type of the diagonal vector
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline void ldltSolve( const UniLowerMatrix<MT1,SO1,true>& L, const DenseVector<VT1,false>& d,
+                       DenseMatrix<MT2,SO2>& B )
+{
+   if( L.rows() != (~B).rows() || L.rows() != (~d).size() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   const size_t n( (~B).rows() );
+   const size_t m( (~B).columns() );
+
+   lowerSubstitution( L, ~B, true );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const typename VT1::ElementType inv( typename VT1::ElementType(1) / (~d)[i] );
+      for( size_t k=0UL; k<m; ++k )
+         (~B)(i,k) *= inv;
+   }
+
+   lowerTransSubstitution( L, ~B, true );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place solution of a system with a given LDLT decomposition (\f$ L D L^T x = b \f$).
+// \ingroup dense_matrix
+//
+// \param L The unit lower triangular factor of the system matrix (see ldlt()).
+// \param d The diagonal of the diagonal factor of the system matrix.
+// \param b The right-hand side vector, replaced by the solution.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+*/
+template< typename MT   // Type of the adapted unilower matrix
+        , bool SO       // Storage order of the adapted unilower matrix
+        , typename VT1  // Type of the diagonal vector
+        , typename VT2 > // Type of the right-hand side vector
+inline void ldltSolve( const UniLowerMatrix<MT,SO,true>& L, const DenseVector<VT1,false>& d,
+                       DenseVector<VT2,false>& b )
+{
+   if( L.rows() != (~b).size() || L.rows() != (~d).size() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   SubstitutionVector<VT2> B( ~b );
+   ldltSolve( L, d, B );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
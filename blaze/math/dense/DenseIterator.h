@@ -33,6 +33,7 @@
 
 #include <iterator>
 #include <blaze/math/Intrinsics.h>
+#include <blaze/math/typetraits/IsDenseIterator.h>
 #include <blaze/util/AlignmentCheck.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Null.h>
@@ -603,6 +604,26 @@ inline ptrdiff_t operator-( const DenseIterator<Type>& lhs, const DenseIterator<
 }
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  ISDENSEITERATOR SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+struct IsDenseIterator< DenseIterator<T> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
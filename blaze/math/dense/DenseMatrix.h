@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/math/constraints/Triangular.h>
+#include <blaze/math/dense/Reduction.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/Functions.h>
@@ -48,6 +49,7 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/IsNaN.h>
 #include <blaze/math/shims/IsOne.h>
+#include <blaze/math/smp/Reduction.h>
 #include <blaze/math/StorageOrder.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
@@ -605,6 +607,9 @@ bool isDiagonal( const DenseMatrix<MT,SO>& dm );
 template< typename MT, bool SO >
 bool isIdentity( const DenseMatrix<MT,SO>& dm );
 
+template< typename MT, bool SO >
+const typename MT::ElementType sum( const DenseMatrix<MT,SO>& dm );
+
 template< typename MT, bool SO >
 const typename MT::ElementType min( const DenseMatrix<MT,SO>& dm );
 
@@ -1580,6 +1585,41 @@ bool isIdentity( const DenseMatrix<MT,SO>& dm )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Returns the sum of all elements of the dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The sum of all dense matrix elements.
+//
+// This function returns the sum of all elements of the given dense matrix. The summation is
+// vectorized and, for large matrices, executed in parallel. The partial sums of blocks of
+// consecutive elements are combined pairwise, which bounds the growth of the rounding error.
+// The result does not depend on the number of threads. In case the matrix currently has
+// either 0 rows or 0 columns, the returned value is the default value (e.g. 0 in case of
+// fundamental data types).
+
+   \code
+   blaze::DynamicMatrix<double> A( 100UL, 100UL, 1.0 );
+   const double s = sum( A );  // Results in 10000
+   \endcode
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+const typename MT::ElementType sum( const DenseMatrix<MT,SO>& dm )
+{
+   typedef typename MT::ElementType    ET;
+   typedef typename MT::CompositeType  CT;
+
+   CT A( ~dm );  // Evaluation of the dense matrix operand
+
+   if( A.rows() == 0UL || A.columns() == 0UL ) return ET();
+
+   return smpReduce< Reduction<ReduceAdd,ReduceIdentity> >( A );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Returns the smallest element of the dense matrix.
 // \ingroup dense_matrix
@@ -1590,14 +1630,13 @@ bool isIdentity( const DenseMatrix<MT,SO>& dm )
 // This function returns the smallest element of the given dense matrix. This function can
 // only be used for element types that support the smaller-than relationship. In case the
 // matrix currently has either 0 rows or 0 columns, the returned value is the default value
-// (e.g. 0 in case of fundamental data types).
+// (e.g. 0 in case of fundamental data types). For floating point element types the reduction
+// is vectorized and, for large matrices, executed in parallel.
 */
 template< typename MT  // Type of the dense matrix
         , bool SO >    // Storage order
 const typename MT::ElementType min( const DenseMatrix<MT,SO>& dm )
 {
-   using blaze::min;
-
    typedef typename MT::ElementType    ET;
    typedef typename MT::CompositeType  CT;
 
@@ -1605,24 +1644,7 @@ const typename MT::ElementType min( const DenseMatrix<MT,SO>& dm )
 
    if( A.rows() == 0UL || A.columns() == 0UL ) return ET();
 
-   ET minimum( A(0,0) );
-
-   if( SO == rowMajor ) {
-      for( size_t j=1UL; j<A.columns(); ++j )
-         minimum = min( minimum, A(0UL,j) );
-      for( size_t i=1UL; i<A.rows(); ++i )
-         for( size_t j=0UL; j<A.columns(); ++j )
-            minimum = min( minimum, A(i,j) );
-   }
-   else {
-      for( size_t i=1UL; i<A.rows(); ++i )
-         minimum = min( minimum, A(i,0UL) );
-      for( size_t j=1UL; j<A.columns(); ++j )
-         for( size_t i=0UL; i<A.rows(); ++i )
-            minimum = min( minimum, A(i,j) );
-   }
-
-   return minimum;
+   return smpReduce< Reduction<ReduceMin,ReduceIdentity> >( A );
 }
 //*************************************************************************************************
 
@@ -1637,14 +1659,13 @@ const typename MT::ElementType min( const DenseMatrix<MT,SO>& dm )
 // This function returns the largest element of the given dense matrix. This function can
 // only be used for element types that support the smaller-than relationship. In case the
 // matrix currently has either 0 rows or 0 columns, the returned value is the default value
-// (e.g. 0 in case of fundamental data types).
+// (e.g. 0 in case of fundamental data types). For floating point element types the reduction
+// is vectorized and, for large matrices, executed in parallel.
 */
 template< typename MT  // Type of the dense matrix
         , bool SO >    // Transpose flag
 const typename MT::ElementType max( const DenseMatrix<MT,SO>& dm )
 {
-   using blaze::max;
-
    typedef typename MT::ElementType    ET;
    typedef typename MT::CompositeType  CT;
 
@@ -1652,24 +1673,7 @@ const typename MT::ElementType max( const DenseMatrix<MT,SO>& dm )
 
    if( A.rows() == 0UL || A.columns() == 0UL ) return ET();
 
-   ET maximum( A(0,0) );
-
-   if( SO == rowMajor ) {
-      for( size_t j=1UL; j<A.columns(); ++j )
-         maximum = max( maximum, A(0UL,j) );
-      for( size_t i=1UL; i<A.rows(); ++i )
-         for( size_t j=0UL; j<A.columns(); ++j )
-            maximum = max( maximum, A(i,j) );
-   }
-   else {
-      for( size_t i=1UL; i<A.rows(); ++i )
-         maximum = max( maximum, A(i,0UL) );
-      for( size_t j=1UL; j<A.columns(); ++j )
-         for( size_t i=0UL; i<A.rows(); ++i )
-            maximum = max( maximum, A(i,j) );
-   }
-
-   return maximum;
+   return smpReduce< Reduction<ReduceMax,ReduceIdentity> >( A );
 }
 //*************************************************************************************************
 
@@ -41,6 +41,8 @@
 //*************************************************************************************************
 
 #include <cmath>
+#include <blaze/math/dense/MultiAssign.h>
+#include <blaze/math/dense/Reduction.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/Functions.h>
@@ -48,6 +50,8 @@
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/IsNaN.h>
 #include <blaze/math/shims/Square.h>
+#include <blaze/math/smp/MultiAssign.h>
+#include <blaze/math/smp/Reduction.h>
 #include <blaze/math/traits/CMathTrait.h>
 #include <blaze/math/TransposeFlag.h>
 #include <blaze/util/Assert.h>
@@ -380,11 +384,29 @@ typename CMathTrait<typename VT::ElementType>::Type length( const DenseVector<VT
 template< typename VT, bool TF >
 const typename VT::ElementType sqrLength( const DenseVector<VT,TF>& dv );
 
+template< typename VT, bool TF >
+const typename VT::ElementType sum( const DenseVector<VT,TF>& dv );
+
+template< typename VT, bool TF >
+const typename VT::ElementType norm1( const DenseVector<VT,TF>& dv );
+
+template< typename VT, bool TF >
+const typename VT::ElementType normInf( const DenseVector<VT,TF>& dv );
+
 template< typename VT, bool TF >
 const typename VT::ElementType min( const DenseVector<VT,TF>& dv );
 
 template< typename VT, bool TF >
 const typename VT::ElementType max( const DenseVector<VT,TF>& dv );
+
+template< typename U1, typename U2 >
+inline void multiAssign( const U1& u1, const U2& u2 );
+
+template< typename U1, typename U2, typename U3 >
+inline void multiAssign( const U1& u1, const U2& u2, const U3& u3 );
+
+template< typename U1, typename U2, typename U3, typename U4 >
+inline void multiAssign( const U1& u1, const U2& u2, const U3& u3, const U4& u4 );
 //@}
 //*************************************************************************************************
 
@@ -467,10 +489,7 @@ typename CMathTrait<typename VT::ElementType>::Type length( const DenseVector<VT
 
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ElementType );
 
-   LengthType sum( 0 );
-   for( size_t i=0UL; i<(~dv).size(); ++i )
-      sum += sq( (~dv)[i] );
-   return std::sqrt( sum );
+   return std::sqrt( LengthType( sqrLength( ~dv ) ) );
 }
 //*************************************************************************************************
 
@@ -482,7 +501,8 @@ typename CMathTrait<typename VT::ElementType>::Type length( const DenseVector<VT
 // \param dv The given dense vector.
 // \return The square length of the dense vector.
 //
-// This function calculates the actual square length of the dense vector.
+// This function calculates the actual square length of the dense vector. The computation is
+// vectorized and, for large vectors, executed in parallel.
 //
 // \b Note: This operation is only defined for numeric data types. In case the element type is
 // not a numeric data type (i.e. a user defined data type or boolean) the attempt to use the
@@ -492,14 +512,110 @@ template< typename VT  // Type of the dense vector
         , bool TF >    // Transpose flag
 const typename VT::ElementType sqrLength( const DenseVector<VT,TF>& dv )
 {
-   typedef typename VT::ElementType  ElementType;
+   typedef typename VT::ElementType    ElementType;
+   typedef typename VT::CompositeType  CT;
 
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ElementType );
 
-   ElementType sum( 0 );
-   for( size_t i=0UL; i<(~dv).size(); ++i )
-      sum += sq( (~dv)[i] );
-   return sum;
+   CT a( ~dv );  // Evaluation of the dense vector operand
+
+   if( a.size() == 0UL ) return ElementType();
+
+   return smpReduce< Reduction<ReduceAdd,ReduceSqr> >( a );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the sum of all elements of the dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The sum of all dense vector elements.
+//
+// This function returns the sum of all elements of the given dense vector. The summation is
+// vectorized and, for large vectors, executed in parallel. The partial sums of blocks of
+// consecutive elements are combined pairwise, which bounds the growth of the rounding error.
+// The result does not depend on the number of threads. In case the vector currently has a
+// size of 0, the returned value is the default value (e.g. 0 in case of fundamental data
+// types).
+
+   \code
+   blaze::DynamicVector<double> a( 1000UL, 0.5 );
+   const double s = sum( a );  // Results in 500
+   \endcode
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+const typename VT::ElementType sum( const DenseVector<VT,TF>& dv )
+{
+   typedef typename VT::ElementType    ET;
+   typedef typename VT::CompositeType  CT;
+
+   CT a( ~dv );  // Evaluation of the dense vector operand
+
+   if( a.size() == 0UL ) return ET();
+
+   return smpReduce< Reduction<ReduceAdd,ReduceIdentity> >( a );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculation of the 1-norm of the dense vector \f$ \sum_i |a_i| \f$.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The 1-norm of the dense vector.
+//
+// This function returns the sum of the absolute values of the elements of the given dense
+// vector. For floating point element types the computation is vectorized and, for large
+// vectors, executed in parallel. In case the vector currently has a size of 0, the function
+// returns 0.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+const typename VT::ElementType norm1( const DenseVector<VT,TF>& dv )
+{
+   typedef typename VT::ElementType    ET;
+   typedef typename VT::CompositeType  CT;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ET );
+
+   CT a( ~dv );  // Evaluation of the dense vector operand
+
+   if( a.size() == 0UL ) return ET();
+
+   return smpReduce< Reduction<ReduceAdd,ReduceAbs> >( a );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculation of the infinity norm of the dense vector \f$ \max_i |a_i| \f$.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The infinity norm of the dense vector.
+//
+// This function returns the largest absolute value of the elements of the given dense vector.
+// For floating point element types the computation is vectorized and, for large vectors,
+// executed in parallel. In case the vector currently has a size of 0, the function returns 0.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+const typename VT::ElementType normInf( const DenseVector<VT,TF>& dv )
+{
+   typedef typename VT::ElementType    ET;
+   typedef typename VT::CompositeType  CT;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ET );
+
+   CT a( ~dv );  // Evaluation of the dense vector operand
+
+   if( a.size() == 0UL ) return ET();
+
+   return smpReduce< Reduction<ReduceMax,ReduceAbs> >( a );
 }
 //*************************************************************************************************
 
@@ -514,14 +630,13 @@ const typename VT::ElementType sqrLength( const DenseVector<VT,TF>& dv )
 // This function returns the smallest element of the given dense vector. This function can
 // only be used for element types that support the smaller-than relationship. In case the
 // vector currently has a size of 0, the returned value is the default value (e.g. 0 in case
-// of fundamental data types).
+// of fundamental data types). For floating point element types the reduction is vectorized
+// and, for large vectors, executed in parallel.
 */
 template< typename VT  // Type of the dense vector
         , bool TF >    // Transpose flag
 const typename VT::ElementType min( const DenseVector<VT,TF>& dv )
 {
-   using blaze::min;
-
    typedef typename VT::ElementType    ET;
    typedef typename VT::CompositeType  CT;
 
@@ -529,10 +644,7 @@ const typename VT::ElementType min( const DenseVector<VT,TF>& dv )
 
    if( a.size() == 0UL ) return ET();
 
-   ET minimum( a[0] );
-   for( size_t i=1UL; i<a.size(); ++i )
-      minimum = min( minimum, a[i] );
-   return minimum;
+   return smpReduce< Reduction<ReduceMin,ReduceIdentity> >( a );
 }
 //*************************************************************************************************
 
@@ -547,14 +659,13 @@ const typename VT::ElementType min( const DenseVector<VT,TF>& dv )
 // This function returns the largest element of the given dense vector. This function can
 // only be used for element types that support the smaller-than relationship. In case the
 // vector currently has a size of 0, the returned value is the default value (e.g. 0 in case
-// of fundamental data types).
+// of fundamental data types). For floating point element types the reduction is vectorized
+// and, for large vectors, executed in parallel.
 */
 template< typename VT  // Type of the dense vector
         , bool TF >    // Transpose flag
 const typename VT::ElementType max( const DenseVector<VT,TF>& dv )
 {
-   using blaze::max;
-
    typedef typename VT::ElementType    ET;
    typedef typename VT::CompositeType  CT;
 
@@ -562,10 +673,113 @@ const typename VT::ElementType max( const DenseVector<VT,TF>& dv )
 
    if( a.size() == 0UL ) return ET();
 
-   ET maximum( a[0] );
-   for( size_t i=1UL; i<a.size(); ++i )
-      maximum = max( maximum, a[i] );
-   return maximum;
+   return smpReduce< Reduction<ReduceMax,ReduceIdentity> >( a );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused evaluation of two dense vector updates.
+// \ingroup dense_vector
+//
+// \param u1 The first update.
+// \param u2 The second update.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function evaluates the given deferred updates in a single pass over the index range.
+// In comparison to the subsequent evaluation of the according (compound) assignments, each
+// element of the involved vectors is loaded and stored only once, which significantly reduces
+// the memory traffic of bandwidth-bound operations. The updates are created via the assignTo(),
+// addAssignTo(), subAssignTo(), and multAssignTo() functions:
+
+   \code
+   blaze::DynamicVector<double> x, r, d, h;
+   double alpha;
+   // ... Resizing and initialization
+
+   // Equivalent to 'x += alpha * d; r += alpha * h;'
+   multiAssign( addAssignTo( x, alpha * d ), addAssignTo( r, alpha * h ) );
+   \endcode
+
+// All target vectors must have the same size, otherwise a \a std::invalid_argument exception
+// is thrown. The evaluation is vectorized in case all updates are vectorizable and, for large
+// vectors, executed in parallel, where all updates share the same partitioning of the index
+// range. For each index the updates are applied in the given order, i.e. element-wise operands
+// see the results of the preceding updates of the same element. Operands that require an
+// intermediate evaluation (as for instance matrix/vector multiplications) are evaluated on
+// creation of the according update, i.e. before any target vector is modified. Therefore
+// operands must not access the target vectors of preceding updates at other indices than the
+// index currently being updated (as for instance via a shifted subvector).
+*/
+template< typename U1    // Type of the first update
+        , typename U2 >  // Type of the second update
+inline void multiAssign( const U1& u1, const U2& u2 )
+{
+   const DVecUpdateBatch<U1,U2> batch( u1, u2 );
+
+   if( batch.size() == 0UL ) return;
+
+   smpMultiAssign( batch );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused evaluation of three dense vector updates.
+// \ingroup dense_vector
+//
+// \param u1 The first update.
+// \param u2 The second update.
+// \param u3 The third update.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function evaluates the given deferred updates in a single pass over the index range.
+// For more details see the multiAssign() function for two updates.
+*/
+template< typename U1    // Type of the first update
+        , typename U2    // Type of the second update
+        , typename U3 >  // Type of the third update
+inline void multiAssign( const U1& u1, const U2& u2, const U3& u3 )
+{
+   const DVecUpdateBatch<U2,U3> tail( u2, u3 );
+   const DVecUpdateBatch< U1, DVecUpdateBatch<U2,U3> > batch( u1, tail );
+
+   if( batch.size() == 0UL ) return;
+
+   smpMultiAssign( batch );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused evaluation of four dense vector updates.
+// \ingroup dense_vector
+//
+// \param u1 The first update.
+// \param u2 The second update.
+// \param u3 The third update.
+// \param u4 The fourth update.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function evaluates the given deferred updates in a single pass over the index range.
+// For more details see the multiAssign() function for two updates.
+*/
+template< typename U1    // Type of the first update
+        , typename U2    // Type of the second update
+        , typename U3    // Type of the third update
+        , typename U4 >  // Type of the fourth update
+inline void multiAssign( const U1& u1, const U2& u2, const U3& u3, const U4& u4 )
+{
+   const DVecUpdateBatch<U3,U4> tail2( u3, u4 );
+   const DVecUpdateBatch< U2, DVecUpdateBatch<U3,U4> > tail1( u2, tail2 );
+   const DVecUpdateBatch< U1, DVecUpdateBatch< U2, DVecUpdateBatch<U3,U4> > > batch( u1, tail1 );
+
+   if( batch.size() == 0UL ) return;
+
+   smpMultiAssign( batch );
 }
 //*************************************************************************************************
 
@@ -55,8 +55,10 @@ template< typename, bool > class DynamicVector;
 template< typename, bool > class DynamicMatrix;
 template< typename, size_t, size_t, bool > class HybridMatrix;
 template< typename, size_t, bool > class HybridVector;
+template< typename, size_t, size_t > class MatrixBatch;
 template< typename, size_t, size_t, bool > class StaticMatrix;
 template< typename, size_t, bool > class StaticVector;
+template< typename, size_t > class VectorBatch;
 
 } // namespace blaze
 
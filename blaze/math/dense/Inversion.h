@@ -0,0 +1,1003 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Inversion.h
+//  \brief Header file for the inversion, determinant and solve functions for small dense matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_INVERSION_H_
+#define _BLAZE_MATH_DENSE_INVERSION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <blaze/math/dense/HybridMatrix.h>
+#include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/Or.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ROW KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default scaling of a padded matrix row (\f$ \vec{a}*=s \f$).
+// \ingroup dense_matrix
+//
+// \param a The first element of the row.
+// \param s The scaling factor.
+// \param n The number of elements of the row.
+// \return void
+*/
+template< typename Type >  // Data type of the row
+inline typename DisableIf< Or< IsFloat<Type>, IsDouble<Type> > >::Type
+   scaleRow( Type* a, Type s, size_t n )
+{
+   for( size_t j=0UL; j<n; ++j )
+      a[j] *= s;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized scaling of a padded matrix row (\f$ \vec{a}*=s \f$).
+// \ingroup dense_matrix
+//
+// \param a The first element of the row.
+// \param s The scaling factor.
+// \param n The number of elements of the row.
+// \return void
+//
+// The row has to be properly aligned and padded to a multiple of the intrinsic size. The zero
+// padding elements remain zero.
+*/
+template< typename Type >  // Data type of the row
+inline typename EnableIf< Or< IsFloat<Type>, IsDouble<Type> > >::Type
+   scaleRow( Type* a, Type s, size_t n )
+{
+   typedef IntrinsicTrait<Type>  IT;
+   typedef typename IT::Type     IntrinsicType;
+
+   const IntrinsicType xmm( set( s ) );
+
+   for( size_t j=0UL; j<n; j+=IT::size )
+      store( a+j, load( a+j ) * xmm );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default subtraction of a scaled padded matrix row (\f$ \vec{a}-=f*\vec{r} \f$).
+// \ingroup dense_matrix
+//
+// \param a The first element of the target row.
+// \param r The first element of the subtracted row.
+// \param f The scaling factor of the subtracted row.
+// \param n The number of elements of the rows.
+// \return void
+*/
+template< typename Type >  // Data type of the rows
+inline typename DisableIf< Or< IsFloat<Type>, IsDouble<Type> > >::Type
+   subRow( Type* a, const Type* r, Type f, size_t n )
+{
+   for( size_t j=0UL; j<n; ++j )
+      a[j] -= f * r[j];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized subtraction of a scaled padded matrix row (\f$ \vec{a}-=f*\vec{r} \f$).
+// \ingroup dense_matrix
+//
+// \param a The first element of the target row.
+// \param r The first element of the subtracted row.
+// \param f The scaling factor of the subtracted row.
+// \param n The number of elements of the rows.
+// \return void
+//
+// Both rows have to be properly aligned and padded to a multiple of the intrinsic size. The
+// zero padding elements remain zero.
+*/
+template< typename Type >  // Data type of the rows
+inline typename EnableIf< Or< IsFloat<Type>, IsDouble<Type> > >::Type
+   subRow( Type* a, const Type* r, Type f, size_t n )
+{
+   typedef IntrinsicTrait<Type>  IT;
+   typedef typename IT::Type     IntrinsicType;
+
+   const IntrinsicType xmm( set( f ) );
+
+   for( size_t j=0UL; j<n; j+=IT::size )
+      store( a+j, load( a+j ) - xmm * load( r+j ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INVERSION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of a 2x2 matrix via its adjugate matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be inverted.
+// \return void
+// \exception std::invalid_argument Inversion of singular matrix failed.
+*/
+template< typename MT >  // Type of the matrix
+inline void invert2x2( MT& A )
+{
+   typedef typename MT::ElementType  ET;
+
+   const ET det( A(0,0)*A(1,1) - A(0,1)*A(1,0) );
+
+   if( isDefault( det ) )
+      throw std::invalid_argument( "Inversion of singular matrix failed" );
+
+   const ET idet( ET(1) / det );
+   const ET a00( A(0,0) );
+
+   A(0,0) =  A(1,1) * idet;
+   A(1,0) = -A(1,0) * idet;
+   A(0,1) = -A(0,1) * idet;
+   A(1,1) =  a00    * idet;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of a 3x3 matrix via its adjugate matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be inverted.
+// \return void
+// \exception std::invalid_argument Inversion of singular matrix failed.
+*/
+template< typename MT >  // Type of the matrix
+inline void invert3x3( MT& A )
+{
+   typedef typename MT::ElementType  ET;
+
+   const ET c00( A(1,1)*A(2,2) - A(1,2)*A(2,1) );
+   const ET c01( A(1,2)*A(2,0) - A(1,0)*A(2,2) );
+   const ET c02( A(1,0)*A(2,1) - A(1,1)*A(2,0) );
+   const ET det( A(0,0)*c00 + A(0,1)*c01 + A(0,2)*c02 );
+
+   if( isDefault( det ) )
+      throw std::invalid_argument( "Inversion of singular matrix failed" );
+
+   const ET idet( ET(1) / det );
+
+   const ET i01( ( A(0,2)*A(2,1) - A(0,1)*A(2,2) ) * idet );
+   const ET i11( ( A(0,0)*A(2,2) - A(0,2)*A(2,0) ) * idet );
+   const ET i21( ( A(0,1)*A(2,0) - A(0,0)*A(2,1) ) * idet );
+   const ET i02( ( A(0,1)*A(1,2) - A(0,2)*A(1,1) ) * idet );
+   const ET i12( ( A(0,2)*A(1,0) - A(0,0)*A(1,2) ) * idet );
+   const ET i22( ( A(0,0)*A(1,1) - A(0,1)*A(1,0) ) * idet );
+
+   A(0,0) = c00 * idet;
+   A(1,0) = c01 * idet;
+   A(2,0) = c02 * idet;
+   A(0,1) = i01;
+   A(1,1) = i11;
+   A(2,1) = i21;
+   A(0,2) = i02;
+   A(1,2) = i12;
+   A(2,2) = i22;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Gauss-Jordan inversion of a padded square matrix.
+// \ingroup dense_matrix
+//
+// \param A The first element of the matrix to be inverted, which is destroyed.
+// \param B The first element of the identity matrix, which is replaced by the inverse.
+// \param n The number of rows and columns of the matrices.
+// \param spacing The spacing between the beginning of two rows of the matrices.
+// \return void
+// \exception std::invalid_argument Inversion of singular matrix failed.
+//
+// This function transforms \a A into the identity matrix by a Gauss-Jordan elimination with
+// partial pivoting and applies all row operations to \a B. All row operations are performed on
+// complete (vectorized) padded rows. In contrast to an in-place elimination, no single element
+// of a row is written between two vectorized row operations, which avoids store forwarding
+// stalls. Since \f$ (A^T)^{-1} = (A^{-1})^T \f$, the function can be used for both row-major
+// and column-major matrices.
+*/
+template< typename Type >  // Data type of the matrices
+void invertGaussJordan( Type* A, Type* B, size_t n, size_t spacing )
+{
+   using std::abs;
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      size_t p( k );
+      for( size_t i=k+1UL; i<n; ++i ) {
+         if( abs( A[i*spacing+k] ) > abs( A[p*spacing+k] ) )
+            p = i;
+      }
+
+      if( isDefault( A[p*spacing+k] ) )
+         throw std::invalid_argument( "Inversion of singular matrix failed" );
+
+      Type* const ak( A+k*spacing );
+      Type* const bk( B+k*spacing );
+
+      if( p != k ) {
+         std::swap_ranges( ak, ak+n, A+p*spacing );
+         std::swap_ranges( bk, bk+n, B+p*spacing );
+      }
+
+      const Type pinv( Type(1) / ak[k] );
+      scaleRow( ak, pinv, n );
+      scaleRow( bk, pinv, n );
+
+      for( size_t i=0UL; i<n; ++i )
+      {
+         if( i == k ) continue;
+
+         const Type f( A[i*spacing+k] );
+
+         if( isDefault( f ) ) continue;
+
+         subRow( A+i*spacing, ak, f, n );
+         subRow( B+i*spacing, bk, f, n );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of a small square matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be inverted.
+// \param n The number of rows and columns of the matrix.
+// \return void
+// \exception std::invalid_argument Inversion of singular matrix failed.
+//
+// Matrices up to 3x3 are inverted via their adjugate matrices, all larger matrices via the
+// Gauss-Jordan elimination.
+*/
+template< typename MT >  // Type of the matrix
+inline void invertSmall( MT& A, size_t n )
+{
+   typedef typename MT::ElementType  ET;
+
+   switch( n ) {
+      case 0UL:
+         break;
+      case 1UL:
+         if( isDefault( A(0,0) ) )
+            throw std::invalid_argument( "Inversion of singular matrix failed" );
+         A(0,0) = ET(1) / A(0,0);
+         break;
+      case 2UL:
+         invert2x2( A );
+         break;
+      case 3UL:
+         invert3x3( A );
+         break;
+      default: {
+         MT tmp( A );
+         reset( A );
+         for( size_t i=0UL; i<n; ++i )
+            A(i,i) = ET(1);
+         invertGaussJordan( tmp.data(), A.data(), n, A.spacing() );
+         break;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DETERMINANT KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the determinant of a padded square matrix via Gaussian elimination.
+// \ingroup dense_matrix
+//
+// \param A The first element of the matrix, which is destroyed during the computation.
+// \param n The number of rows and columns of the matrix.
+// \param spacing The spacing between the beginning of two rows of the matrix.
+// \return The determinant of the matrix.
+//
+// The determinant is computed as the signed product of the pivots of a Gaussian elimination
+// with partial pivoting. Since \f$ det(A^T) = det(A) \f$, the function can be used for both
+// row-major and column-major matrices.
+*/
+template< typename Type >  // Data type of the matrix
+Type determinantGauss( Type* A, size_t n, size_t spacing )
+{
+   using std::abs;
+
+   Type det( 1 );
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      size_t p( k );
+      for( size_t i=k+1UL; i<n; ++i ) {
+         if( abs( A[i*spacing+k] ) > abs( A[p*spacing+k] ) )
+            p = i;
+      }
+
+      if( isDefault( A[p*spacing+k] ) )
+         return Type(0);
+
+      Type* const rk( A+k*spacing );
+
+      if( p != k ) {
+         std::swap_ranges( rk, rk+n, A+p*spacing );
+         det = -det;
+      }
+
+      det *= rk[k];
+
+      const Type pinv( Type(1) / rk[k] );
+
+      for( size_t i=k+1UL; i<n; ++i ) {
+         Type* const ri( A+i*spacing );
+         subRow( ri, rk, ri[k]*pinv, n );
+      }
+   }
+
+   return det;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the determinant of a small square matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix, which is destroyed for matrices larger than 3x3.
+// \param n The number of rows and columns of the matrix.
+// \return The determinant of the matrix.
+*/
+template< typename MT >  // Type of the matrix
+inline typename MT::ElementType determinantSmall( MT& A, size_t n )
+{
+   typedef typename MT::ElementType  ET;
+
+   switch( n ) {
+      case 0UL:
+         return ET(1);
+      case 1UL:
+         return A(0,0);
+      case 2UL:
+         return A(0,0)*A(1,1) - A(0,1)*A(1,0);
+      case 3UL:
+         return A(0,0) * ( A(1,1)*A(2,2) - A(1,2)*A(2,1) ) +
+                A(0,1) * ( A(1,2)*A(2,0) - A(1,0)*A(2,2) ) +
+                A(0,2) * ( A(1,0)*A(2,1) - A(1,1)*A(2,0) );
+      default:
+         return determinantGauss( A.data(), n, A.spacing() );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVE KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Interchange of two elements of a right-hand side vector.
+// \ingroup dense_matrix
+*/
+template< typename VT >  // Type of the right-hand side vector
+inline void swapRhs( DenseVector<VT,false>& b, size_t i, size_t j )
+{
+   std::swap( (~b)[i], (~b)[j] );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Interchange of two rows of a right-hand side matrix.
+// \ingroup dense_matrix
+*/
+template< typename MT  // Type of the right-hand side matrix
+        , bool SO >    // Storage order of the right-hand side matrix
+inline void swapRhs( DenseMatrix<MT,SO>& B, size_t i, size_t j )
+{
+   for( size_t k=0UL; k<(~B).columns(); ++k )
+      std::swap( (~B)(i,k), (~B)(j,k) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Subtraction of a scaled element of a right-hand side vector (\f$ b_i-=f*b_j \f$).
+// \ingroup dense_matrix
+*/
+template< typename VT    // Type of the right-hand side vector
+        , typename ET >  // Type of the scaling factor
+inline void subRhs( DenseVector<VT,false>& b, size_t i, size_t j, const ET& f )
+{
+   (~b)[i] -= f * (~b)[j];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Subtraction of a scaled row of a right-hand side matrix (\f$ B_i-=f*B_j \f$).
+// \ingroup dense_matrix
+*/
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO        // Storage order of the right-hand side matrix
+        , typename ET >  // Type of the scaling factor
+inline void subRhs( DenseMatrix<MT,SO>& B, size_t i, size_t j, const ET& f )
+{
+   for( size_t k=0UL; k<(~B).columns(); ++k )
+      (~B)(i,k) -= f * (~B)(j,k);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scaling of an element of a right-hand side vector (\f$ b_i*=s \f$).
+// \ingroup dense_matrix
+*/
+template< typename VT    // Type of the right-hand side vector
+        , typename ET >  // Type of the scaling factor
+inline void scaleRhs( DenseVector<VT,false>& b, size_t i, const ET& s )
+{
+   (~b)[i] *= s;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scaling of a row of a right-hand side matrix (\f$ B_i*=s \f$).
+// \ingroup dense_matrix
+*/
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO        // Storage order of the right-hand side matrix
+        , typename ET >  // Type of the scaling factor
+inline void scaleRhs( DenseMatrix<MT,SO>& B, size_t i, const ET& s )
+{
+   for( size_t k=0UL; k<(~B).columns(); ++k )
+      (~B)(i,k) *= s;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place solution of a linear system with a padded row-major system matrix.
+// \ingroup dense_matrix
+//
+// \param A The first element of the row-major system matrix, which is destroyed.
+// \param n The number of rows and columns of the system matrix.
+// \param spacing The spacing between the beginning of two rows of the system matrix.
+// \param B The right-hand side vector or matrix, replaced by the solution.
+// \return void
+// \exception std::invalid_argument Matrix is singular.
+//
+// The system is solved by a Gaussian elimination with partial pivoting followed by a backward
+// substitution. The rows of the system matrix are updated as complete (vectorized) padded rows.
+*/
+template< typename Type  // Data type of the system matrix
+        , typename RT >  // Type of the right-hand side
+void solveGauss( Type* A, size_t n, size_t spacing, RT& B )
+{
+   using std::abs;
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      size_t p( k );
+      for( size_t i=k+1UL; i<n; ++i ) {
+         if( abs( A[i*spacing+k] ) > abs( A[p*spacing+k] ) )
+            p = i;
+      }
+
+      if( isDefault( A[p*spacing+k] ) )
+         throw std::invalid_argument( "Matrix is singular" );
+
+      Type* const rk( A+k*spacing );
+
+      if( p != k ) {
+         std::swap_ranges( rk, rk+n, A+p*spacing );
+         swapRhs( B, k, p );
+      }
+
+      const Type pinv( Type(1) / rk[k] );
+
+      for( size_t i=k+1UL; i<n; ++i ) {
+         Type* const ri( A+i*spacing );
+         const Type f( ri[k]*pinv );
+         if( isDefault( f ) ) continue;
+         subRow( ri, rk, f, n );
+         subRhs( B, i, k, f );
+      }
+   }
+
+   for( size_t i=n; i>0UL; --i ) {
+      const Type* const ri( A+(i-1UL)*spacing );
+      for( size_t j=i; j<n; ++j )
+         subRhs( B, i-1UL, j, ri[j] );
+      scaleRhs( B, i-1UL, Type(1) / ri[i-1UL] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Inversion, determinant and solve functions for small dense matrices */
+//@{
+template< typename Type, size_t N, bool SO >
+inline const StaticMatrix<Type,N,N,SO> inv( const StaticMatrix<Type,N,N,SO>& m );
+
+template< typename Type, size_t M, size_t N, bool SO >
+inline const HybridMatrix<Type,M,N,SO> inv( const HybridMatrix<Type,M,N,SO>& m );
+
+template< typename Type, size_t N, bool SO >
+inline void invert( StaticMatrix<Type,N,N,SO>& m );
+
+template< typename Type, size_t M, size_t N, bool SO >
+inline void invert( HybridMatrix<Type,M,N,SO>& m );
+
+template< typename Type, size_t N, bool SO >
+inline Type det( const StaticMatrix<Type,N,N,SO>& m );
+
+template< typename Type, size_t M, size_t N, bool SO >
+inline Type det( const HybridMatrix<Type,M,N,SO>& m );
+
+template< typename Type, size_t N, bool SO, typename VT >
+inline void solve( const StaticMatrix<Type,N,N,SO>& A, DenseVector<VT,false>& b );
+
+template< typename Type, size_t N, bool SO, typename MT, bool SO2 >
+inline void solve( const StaticMatrix<Type,N,N,SO>& A, DenseMatrix<MT,SO2>& B );
+
+template< typename Type, size_t M, size_t N, bool SO, typename VT >
+inline void solve( const HybridMatrix<Type,M,N,SO>& A, DenseVector<VT,false>& b );
+
+template< typename Type, size_t M, size_t N, bool SO, typename MT, bool SO2 >
+inline void solve( const HybridMatrix<Type,M,N,SO>& A, DenseMatrix<MT,SO2>& B );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inverting the given square static matrix.
+// \ingroup dense_matrix
+//
+// \param m The square matrix to be inverted.
+// \return The inverse of the matrix.
+// \exception std::invalid_argument Inversion of singular matrix failed.
+//
+// This function returns the inverse of the given square static matrix. Matrices up to 3x3 are
+// inverted via the closed form of their adjugate matrices, larger matrices via a Gauss-Jordan
+// elimination with partial pivoting, which operates on complete padded rows and is therefore
+// vectorized for single and double precision matrices. No dynamic memory is allocated. In case
+// the matrix is singular, a \a std::invalid_argument exception is thrown.
+
+   \code
+   blaze::StaticMatrix<double,6UL,6UL> A, B;
+   // ... Initialization
+
+   B = inv( A );  // Computing the inverse of A
+   \endcode
+*/
+template< typename Type  // Data type of the matrix
+        , size_t N       // Number of rows and columns
+        , bool SO >      // Storage order
+inline const StaticMatrix<Type,N,N,SO> inv( const StaticMatrix<Type,N,N,SO>& m )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+
+   StaticMatrix<Type,N,N,SO> tmp( m );
+   invertSmall( tmp, N );
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inverting the given square hybrid matrix.
+// \ingroup dense_matrix
+//
+// \param m The square matrix to be inverted.
+// \return The inverse of the matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Inversion of singular matrix failed.
+//
+// This function returns the inverse of the given square hybrid matrix (see the StaticMatrix
+// overload for details). In case the matrix is not square or singular, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Maximum number of rows
+        , size_t N       // Maximum number of columns
+        , bool SO >      // Storage order
+inline const HybridMatrix<Type,M,N,SO> inv( const HybridMatrix<Type,M,N,SO>& m )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+
+   if( m.rows() != m.columns() )
+      throw std::invalid_argument( "Invalid non-square matrix provided" );
+
+   HybridMatrix<Type,M,N,SO> tmp( m );
+   invertSmall( tmp, m.rows() );
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place inversion of the given square static matrix.
+// \ingroup dense_matrix
+//
+// \param m The square matrix to be inverted.
+// \return void
+// \exception std::invalid_argument Inversion of singular matrix failed.
+//
+// This function replaces the given square static matrix by its inverse. In contrast to the
+// inv() function, no temporary matrix has to be copied into the target matrix, which is
+// beneficial for very small matrices whose inversion costs are in the range of a copy
+// operation:
+
+   \code
+   blaze::StaticMatrix<double,3UL,3UL> A, B;
+   // ... Initialization
+
+   B = A;
+   invert( B );  // Equivalent to B = inv( A ), but without temporary
+   \endcode
+
+// In case the matrix is singular, a \a std::invalid_argument exception is thrown and the
+// matrix is left in an unspecified state.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t N       // Number of rows and columns
+        , bool SO >      // Storage order
+inline void invert( StaticMatrix<Type,N,N,SO>& m )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+
+   invertSmall( m, N );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place inversion of the given square hybrid matrix.
+// \ingroup dense_matrix
+//
+// \param m The square matrix to be inverted.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Inversion of singular matrix failed.
+//
+// This function replaces the given square hybrid matrix by its inverse (see the StaticMatrix
+// overload for details). In case the matrix is not square or singular, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Maximum number of rows
+        , size_t N       // Maximum number of columns
+        , bool SO >      // Storage order
+inline void invert( HybridMatrix<Type,M,N,SO>& m )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+
+   if( m.rows() != m.columns() )
+      throw std::invalid_argument( "Invalid non-square matrix provided" );
+
+   invertSmall( m, m.rows() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computing the determinant of the given square static matrix.
+// \ingroup dense_matrix
+//
+// \param m The square matrix.
+// \return The determinant of the matrix.
+//
+// The determinant of matrices up to 3x3 is computed in closed form, the determinant of larger
+// matrices via a vectorized Gaussian elimination with partial pivoting.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t N       // Number of rows and columns
+        , bool SO >      // Storage order
+inline Type det( const StaticMatrix<Type,N,N,SO>& m )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+
+   StaticMatrix<Type,N,N,SO> tmp( m );
+   return determinantSmall( tmp, N );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computing the determinant of the given square hybrid matrix.
+// \ingroup dense_matrix
+//
+// \param m The square matrix.
+// \return The determinant of the matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Maximum number of rows
+        , size_t N       // Maximum number of columns
+        , bool SO >      // Storage order
+inline Type det( const HybridMatrix<Type,M,N,SO>& m )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+
+   if( m.rows() != m.columns() )
+      throw std::invalid_argument( "Invalid non-square matrix provided" );
+
+   HybridMatrix<Type,M,N,SO> tmp( m );
+   return determinantSmall( tmp, m.rows() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place solution of a linear system with a square static system matrix (\f$ A x = b \f$).
+// \ingroup dense_matrix
+//
+// \param A The square system matrix.
+// \param b The right-hand side vector, replaced by the solution.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Matrix is singular.
+//
+// The system is solved by a Gaussian elimination with partial pivoting on a row-major copy of
+// the system matrix, which is vectorized for single and double precision matrices. In contrast
+// to the multiplication with the inverse, the solution does not suffer from the additional
+// rounding errors of the explicit inversion. No dynamic memory is allocated.
+
+   \code
+   blaze::StaticMatrix<double,6UL,6UL> A;
+   blaze::StaticVector<double,6UL> b;
+   // ... Initialization
+
+   solve( A, b );  // Solving A x = b in-place
+   \endcode
+*/
+template< typename Type  // Data type of the matrix
+        , size_t N       // Number of rows and columns
+        , bool SO        // Storage order
+        , typename VT >  // Type of the right-hand side vector
+inline void solve( const StaticMatrix<Type,N,N,SO>& A, DenseVector<VT,false>& b )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+
+   if( (~b).size() != N )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   StaticMatrix<Type,N,N,rowMajor> tmp( A );
+   solveGauss( tmp.data(), N, tmp.spacing(), b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place solution of a linear system with multiple right-hand sides (\f$ A X = B \f$).
+// \ingroup dense_matrix
+//
+// \param A The square system matrix.
+// \param B The right-hand sides (one per column), replaced by the solution.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Matrix is singular.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t N       // Number of rows and columns
+        , bool SO        // Storage order
+        , typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline void solve( const StaticMatrix<Type,N,N,SO>& A, DenseMatrix<MT,SO2>& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+
+   if( (~B).rows() != N )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   StaticMatrix<Type,N,N,rowMajor> tmp( A );
+   solveGauss( tmp.data(), N, tmp.spacing(), B );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place solution of a linear system with a square hybrid system matrix (\f$ A x = b \f$).
+// \ingroup dense_matrix
+//
+// \param A The square system matrix.
+// \param b The right-hand side vector, replaced by the solution.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Matrix is singular.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Maximum number of rows
+        , size_t N       // Maximum number of columns
+        , bool SO        // Storage order
+        , typename VT >  // Type of the right-hand side vector
+inline void solve( const HybridMatrix<Type,M,N,SO>& A, DenseVector<VT,false>& b )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+
+   if( A.rows() != A.columns() )
+      throw std::invalid_argument( "Invalid non-square matrix provided" );
+
+   if( (~b).size() != A.rows() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   HybridMatrix<Type,M,N,rowMajor> tmp( A );
+   solveGauss( tmp.data(), A.rows(), tmp.spacing(), b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place solution of a linear system with multiple right-hand sides (\f$ A X = B \f$).
+// \ingroup dense_matrix
+//
+// \param A The square system matrix.
+// \param B The right-hand sides (one per column), replaced by the solution.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Matrix is singular.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Maximum number of rows
+        , size_t N       // Maximum number of columns
+        , bool SO        // Storage order
+        , typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline void solve( const HybridMatrix<Type,M,N,SO>& A, DenseMatrix<MT,SO2>& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+
+   if( A.rows() != A.columns() )
+      throw std::invalid_argument( "Invalid non-square matrix provided" );
+
+   if( (~B).rows() != A.rows() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   HybridMatrix<Type,M,N,rowMajor> tmp( A );
+   solveGauss( tmp.data(), A.rows(), tmp.spacing(), B );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
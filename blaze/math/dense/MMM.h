@@ -0,0 +1,554 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/MMM.h
+//  \brief Header file for the cache-blocked dense matrix/dense matrix multiplication kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_MMM_H_
+#define _BLAZE_MATH_DENSE_MMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DMatTransExpr.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/ArenaAllocator.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/policies/Deallocate.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/UniqueArray.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS MMMBLOCKING
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Blocking parameters of the cache-blocked dense matrix/dense matrix multiplication.
+// \ingroup dense_matrix
+//
+// The MMMBlocking class template defines the register and cache block sizes of the packed
+// matrix/matrix multiplication kernel for the given element type \a T:
+//
+//  - \a mr: The number of rows of the register block of the micro-kernel.
+//  - \a nr: The number of columns of the register block of the micro-kernel (two intrinsic
+//           vectors).
+//  - \a kc: The depth of the packed panels. A \a kc x \a nr sliver of the right-hand side
+//           operand is supposed to stay in the L1 cache during a micro-kernel invocation.
+//  - \a mc: The number of rows of the packed block of the left-hand side operand. A \a mc x
+//           \a kc block is sized to one eighth of the outermost cache level.
+//  - \a nc: The number of columns of the packed panel of the right-hand side operand. A \a kc
+//           x \a nc panel is sized to half of the outermost cache level.
+//
+// The cache dependent block sizes are derived from the \a blaze::cacheSize setting in the
+// <tt>./blaze/config/CacheSize.h</tt> configuration file.
+*/
+template< typename T >  // Type of the matrix elements
+struct MMMBlocking
+{
+   //**********************************************************************************************
+   enum { mcRaw = cacheSize / ( 8UL * 256UL * sizeof(T) )
+        , ncRaw = cacheSize / ( 2UL * 256UL * sizeof(T) )
+        , mr    = 4UL
+        , nr    = 2UL * IntrinsicTrait<T>::size
+        , kc    = 256UL
+        , mc    = ( mcRaw < mr )?( mr ):( mcRaw - mcRaw % mr )
+        , nc    = ( ncRaw < nr )?( nr ):( ncRaw - ncRaw % nr ) };
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packs a block of the left-hand side operand of a matrix/matrix multiplication.
+// \ingroup dense_matrix
+//
+// \param A The left-hand side dense matrix operand.
+// \param buffer The target buffer for the packed block.
+// \param ibegin The index of the first row of the block.
+// \param kbegin The index of the first column of the block.
+// \param m The number of rows of the block.
+// \param k The number of columns of the block.
+// \return void
+//
+// This function copies the \a m x \a k block of \a A starting at (\a ibegin,\a kbegin) into
+// consecutive slivers of \a mr rows. Within each sliver the elements are stored column by
+// column, such that the micro-kernel can traverse the sliver with unit stride. Rows beyond
+// \a m are padded with zeros.
+*/
+template< typename MT  // Type of the left-hand side dense matrix
+        , bool SO >    // Storage order of the left-hand side dense matrix
+void mmmPackLeft( const DenseMatrix<MT,SO>& A, typename MT::ElementType* buffer,
+                  size_t ibegin, size_t kbegin, size_t m, size_t k )
+{
+   typedef typename MT::ElementType  ET;
+
+   const size_t mr( MMMBlocking<ET>::mr );
+
+   for( size_t ii=0UL; ii<m; ii+=mr )
+   {
+      const size_t iend( min( mr, m-ii ) );
+
+      if( SO ) {
+         for( size_t l=0UL; l<k; ++l ) {
+            for( size_t i=0UL; i<iend; ++i )
+               buffer[l*mr+i] = (~A)(ibegin+ii+i,kbegin+l);
+            for( size_t i=iend; i<mr; ++i )
+               buffer[l*mr+i] = ET();
+         }
+      }
+      else {
+         for( size_t i=0UL; i<iend; ++i ) {
+            for( size_t l=0UL; l<k; ++l )
+               buffer[l*mr+i] = (~A)(ibegin+ii+i,kbegin+l);
+         }
+         for( size_t i=iend; i<mr; ++i ) {
+            for( size_t l=0UL; l<k; ++l )
+               buffer[l*mr+i] = ET();
+         }
+      }
+
+      buffer += mr*k;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packs a panel of the right-hand side operand of a matrix/matrix multiplication.
+// \ingroup dense_matrix
+//
+// \param B The right-hand side dense matrix operand.
+// \param buffer The target buffer for the packed panel.
+// \param kbegin The index of the first row of the panel.
+// \param jbegin The index of the first column of the panel.
+// \param k The number of rows of the panel.
+// \param n The number of columns of the panel.
+// \return void
+//
+// This function copies the \a k x \a n panel of \a B starting at (\a kbegin,\a jbegin) into
+// consecutive slivers of \a nr columns. Within each sliver the elements are stored row by
+// row, such that the micro-kernel can load each row of the sliver by aligned intrinsic loads.
+// Columns beyond \a n are padded with zeros.
+*/
+template< typename MT  // Type of the right-hand side dense matrix
+        , bool SO >    // Storage order of the right-hand side dense matrix
+void mmmPackRight( const DenseMatrix<MT,SO>& B, typename MT::ElementType* buffer,
+                   size_t kbegin, size_t jbegin, size_t k, size_t n )
+{
+   typedef typename MT::ElementType  ET;
+
+   const size_t nr( MMMBlocking<ET>::nr );
+
+   for( size_t jj=0UL; jj<n; jj+=nr )
+   {
+      const size_t jend( min( nr, n-jj ) );
+
+      if( SO ) {
+         for( size_t j=0UL; j<jend; ++j ) {
+            for( size_t l=0UL; l<k; ++l )
+               buffer[l*nr+j] = (~B)(kbegin+l,jbegin+jj+j);
+         }
+         for( size_t j=jend; j<nr; ++j ) {
+            for( size_t l=0UL; l<k; ++l )
+               buffer[l*nr+j] = ET();
+         }
+      }
+      else {
+         for( size_t l=0UL; l<k; ++l ) {
+            for( size_t j=0UL; j<jend; ++j )
+               buffer[l*nr+j] = (~B)(kbegin+l,jbegin+jj+j);
+            for( size_t j=jend; j<nr; ++j )
+               buffer[l*nr+j] = ET();
+         }
+      }
+
+      buffer += nr*k;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MICRO-KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Update of a single row of a register block of a row-major target matrix.
+// \ingroup dense_matrix
+//
+// \param C The target row-major dense matrix.
+// \param i The row index of the target row.
+// \param j The column index of the first element of the register block.
+// \param n The number of valid columns of the register block.
+// \param factor The scaling factor for the computed values.
+// \param xmm1 The first intrinsic vector of the computed row.
+// \param xmm2 The second intrinsic vector of the computed row.
+// \param accumulate \a true to add the computed values, \a false to overwrite the target.
+// \return void
+*/
+template< typename MT1 >  // Type of the target dense matrix
+BLAZE_ALWAYS_INLINE void mmmUpdate( DenseMatrix<MT1,false>& C, size_t i, size_t j, size_t n,
+                                    const typename IntrinsicTrait<typename MT1::ElementType>::Type& factor,
+                                    const typename IntrinsicTrait<typename MT1::ElementType>::Type& xmm1,
+                                    const typename IntrinsicTrait<typename MT1::ElementType>::Type& xmm2,
+                                    bool accumulate )
+{
+   typedef IntrinsicTrait<typename MT1::ElementType>  IT;
+
+   if( accumulate ) {
+      (~C).store( i, j, fmadd( factor, xmm1, (~C).load(i,j) ) );
+      if( n > IT::size )
+         (~C).store( i, j+IT::size, fmadd( factor, xmm2, (~C).load(i,j+IT::size) ) );
+   }
+   else {
+      (~C).store( i, j, factor * xmm1 );
+      if( n > IT::size )
+         (~C).store( i, j+IT::size, factor * xmm2 );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Update of a single column of a register block of a column-major target matrix.
+// \ingroup dense_matrix
+//
+// \param C The target column-major dense matrix.
+// \param j The column index of the target column.
+// \param i The row index of the first element of the register block.
+// \param m The number of valid rows of the register block.
+// \param factor The scaling factor for the computed values.
+// \param xmm1 The first intrinsic vector of the computed column.
+// \param xmm2 The second intrinsic vector of the computed column.
+// \param accumulate \a true to add the computed values, \a false to overwrite the target.
+// \return void
+//
+// For column-major target matrices the packed kernel computes the transpose \f$ C^T=B^T*A^T \f$.
+// Therefore the roles of the row and column indices are interchanged in comparison to the
+// row-major update.
+*/
+template< typename MT1 >  // Type of the target dense matrix
+BLAZE_ALWAYS_INLINE void mmmUpdate( DenseMatrix<MT1,true>& C, size_t j, size_t i, size_t m,
+                                    const typename IntrinsicTrait<typename MT1::ElementType>::Type& factor,
+                                    const typename IntrinsicTrait<typename MT1::ElementType>::Type& xmm1,
+                                    const typename IntrinsicTrait<typename MT1::ElementType>::Type& xmm2,
+                                    bool accumulate )
+{
+   typedef IntrinsicTrait<typename MT1::ElementType>  IT;
+
+   if( accumulate ) {
+      (~C).store( i, j, fmadd( factor, xmm1, (~C).load(i,j) ) );
+      if( m > IT::size )
+         (~C).store( i+IT::size, j, fmadd( factor, xmm2, (~C).load(i+IT::size,j) ) );
+   }
+   else {
+      (~C).store( i, j, factor * xmm1 );
+      if( m > IT::size )
+         (~C).store( i+IT::size, j, factor * xmm2 );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Register-blocked micro-kernel of the packed matrix/matrix multiplication.
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param L Pointer to the packed \a mr x \a k sliver of the left-hand side operand.
+// \param R Pointer to the packed \a k x \a nr sliver of the right-hand side operand.
+// \param k The depth of the packed slivers.
+// \param i The row index of the first element of the register block.
+// \param j The column index of the first element of the register block.
+// \param m The number of valid rows of the register block.
+// \param n The number of valid columns of the register block.
+// \param factor The scaling factor for the computed values.
+// \param accumulate \a true to add the computed values, \a false to overwrite the target.
+// \return void
+//
+// This function computes an \a mr x \a nr register block of the product of the two packed
+// slivers in eight intrinsic accumulators and updates the according part of \a C. In case
+// \a C is a column-major matrix, all indices refer to the transpose of \a C.
+*/
+template< typename MT1  // Type of the target dense matrix
+        , bool SO >     // Storage order of the target dense matrix
+BLAZE_ALWAYS_INLINE void mmmMicroKernel( DenseMatrix<MT1,SO>& C, const typename MT1::ElementType* L,
+                                         const typename MT1::ElementType* R, size_t k,
+                                         size_t i, size_t j, size_t m, size_t n,
+                                         const typename IntrinsicTrait<typename MT1::ElementType>::Type& factor,
+                                         bool accumulate )
+{
+   typedef typename MT1::ElementType  ET;
+   typedef IntrinsicTrait<ET>         IT;
+   typedef typename IT::Type          IntrinsicType;
+
+   const size_t mr( MMMBlocking<ET>::mr );
+   const size_t nr( MMMBlocking<ET>::nr );
+
+   IntrinsicType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
+
+   for( size_t l=0UL; l<k; ++l ) {
+      const IntrinsicType b1( load( R          ) );
+      const IntrinsicType b2( load( R+IT::size ) );
+      const IntrinsicType a1( set( L[0] ) );
+      const IntrinsicType a2( set( L[1] ) );
+      const IntrinsicType a3( set( L[2] ) );
+      const IntrinsicType a4( set( L[3] ) );
+      xmm1 = fmadd( a1, b1, xmm1 );
+      xmm2 = fmadd( a1, b2, xmm2 );
+      xmm3 = fmadd( a2, b1, xmm3 );
+      xmm4 = fmadd( a2, b2, xmm4 );
+      xmm5 = fmadd( a3, b1, xmm5 );
+      xmm6 = fmadd( a3, b2, xmm6 );
+      xmm7 = fmadd( a4, b1, xmm7 );
+      xmm8 = fmadd( a4, b2, xmm8 );
+      L += mr;
+      R += nr;
+   }
+
+   mmmUpdate( C, i, j, n, factor, xmm1, xmm2, accumulate );
+   if( m > 1UL ) mmmUpdate( C, i+1UL, j, n, factor, xmm3, xmm4, accumulate );
+   if( m > 2UL ) mmmUpdate( C, i+2UL, j, n, factor, xmm5, xmm6, accumulate );
+   if( m > 3UL ) mmmUpdate( C, i+3UL, j, n, factor, xmm7, xmm8, accumulate );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the cache-blocked, packed dense matrix/dense matrix multiplication.
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param L The left-hand side operand of the (possibly transposed) product.
+// \param R The right-hand side operand of the (possibly transposed) product.
+// \param alpha The scaling factor for \f$ L*R \f$.
+// \param accumulate \a true to add the product to \a C, \a false to overwrite \a C.
+// \return void
+//
+// This function computes \f$ L*R \f$, which is either \f$ C \f$ (for row-major target matrices)
+// or \f$ C^T \f$ (for column-major target matrices). The operands are traversed in \a kc x \a nc
+// panels of \a R and \a mc x \a kc blocks of \a L (see MMMBlocking), which are packed into
+// contiguous, aligned buffers and consumed by the register-blocked micro-kernel. The packing
+// loops are chosen according to the storage order of \a L and \a R.
+*/
+template< typename MT1   // Type of the left-hand side target matrix
+        , bool SO1       // Storage order of the left-hand side target matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , bool SO2       // Storage order of the left-hand side matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , bool SO3       // Storage order of the right-hand side matrix operand
+        , typename ST >  // Type of the scaling factor
+void mmmBackend( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& L,
+                 const DenseMatrix<MT3,SO3>& R, ST alpha, bool accumulate )
+{
+   typedef typename MT1::ElementType  ET;
+   typedef MMMBlocking<ET>            Blocking;
+   typedef IntrinsicTrait<ET>         IT;
+   typedef typename IT::Type          IntrinsicType;
+
+   const size_t M( (~L).rows()    );
+   const size_t N( (~R).columns() );
+   const size_t K( (~L).columns() );
+
+   if( M == 0UL || N == 0UL || K == 0UL )
+      return;
+
+   const size_t mr( Blocking::mr );
+   const size_t nr( Blocking::nr );
+
+   const size_t kc( min( size_t( Blocking::kc ), K ) );
+   const size_t mc( min( size_t( Blocking::mc ), M + ( mr - M % mr ) % mr ) );
+   const size_t nc( min( size_t( Blocking::nc ), N + ( nr - N % nr ) % nr ) );
+
+   ArenaAllocator<ET> allocator;
+   UniqueArray<ET,Deallocate> Lp( allocator.allocate( mc*kc ) );
+   UniqueArray<ET,Deallocate> Rp( allocator.allocate( kc*nc ) );
+
+   const IntrinsicType factor( set( ET( alpha ) ) );
+
+   for( size_t jj=0UL; jj<N; jj+=nc )
+   {
+      const size_t nb( min( nc, N-jj ) );
+
+      for( size_t kk=0UL; kk<K; kk+=kc )
+      {
+         const size_t kb( min( kc, K-kk ) );
+         const bool   add( accumulate || kk != 0UL );
+
+         mmmPackRight( ~R, Rp.get(), kk, jj, kb, nb );
+
+         for( size_t ii=0UL; ii<M; ii+=mc )
+         {
+            const size_t mb( min( mc, M-ii ) );
+
+            mmmPackLeft( ~L, Lp.get(), ii, kk, mb, kb );
+
+            for( size_t j=0UL; j<nb; j+=nr ) {
+               for( size_t i=0UL; i<mb; i+=mr ) {
+                  mmmMicroKernel( C, Lp.get()+i*kb, Rp.get()+j*kb, kb, ii+i, jj+j,
+                                  min( mr, mb-i ), min( nr, nb-j ), factor, add );
+               }
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX/MATRIX MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Cache-blocked, packed dense matrix/dense matrix multiplication for row-major target
+//        matrices (\f$ C=\alpha*A*B \f$ or \f$ C+=\alpha*A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target row-major dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param accumulate \a true to add the product to \a C, \a false to overwrite \a C.
+// \return void
+//
+// This function implements a vectorized, cache-blocked matrix/matrix multiplication for large
+// dense matrices. The operands are traversed in \a kc x \a nc panels of \a B and \a mc x \a kc
+// blocks of \a A (see MMMBlocking), which are packed into contiguous, aligned buffers. The
+// packed data is consumed by a register-blocked micro-kernel that computes \a mr x \a nr blocks
+// of \a C. The packing works with any storage order of the operands. Since the target matrix
+// is accessed via intrinsic load and store operations, all three element types are required to
+// be identical and vectorizable.
+*/
+template< typename MT1   // Type of the left-hand side target matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , bool SO2       // Storage order of the left-hand side matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , bool SO3       // Storage order of the right-hand side matrix operand
+        , typename ST >  // Type of the scaling factor
+inline void mmm( DenseMatrix<MT1,false>& C, const DenseMatrix<MT2,SO2>& A,
+                 const DenseMatrix<MT3,SO3>& B, ST alpha, bool accumulate )
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( typename MT1::ElementType, typename MT2::ElementType );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( typename MT1::ElementType, typename MT3::ElementType );
+
+   BLAZE_INTERNAL_ASSERT( (~C).rows()    == (~A).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == (~B).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( (~A).columns() == (~B).rows()   , "Invalid matrix sizes"      );
+
+   mmmBackend( C, ~A, ~B, alpha, accumulate );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Cache-blocked, packed dense matrix/dense matrix multiplication for column-major target
+//        matrices (\f$ C=\alpha*A*B \f$ or \f$ C+=\alpha*A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target column-major dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param accumulate \a true to add the product to \a C, \a false to overwrite \a C.
+// \return void
+//
+// This function implements a vectorized, cache-blocked matrix/matrix multiplication for large
+// dense matrices. In order to vectorize along the columns of \a C, the kernel computes the
+// transposed product \f$ C^T=B^T*A^T \f$, i.e. the roles of both operands are interchanged
+// during packing. As for the row-major kernel, any storage order of the operands is supported
+// and all three element types are required to be identical and vectorizable.
+*/
+template< typename MT1   // Type of the left-hand side target matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , bool SO2       // Storage order of the left-hand side matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , bool SO3       // Storage order of the right-hand side matrix operand
+        , typename ST >  // Type of the scaling factor
+inline void mmm( DenseMatrix<MT1,true>& C, const DenseMatrix<MT2,SO2>& A,
+                 const DenseMatrix<MT3,SO3>& B, ST alpha, bool accumulate )
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( typename MT1::ElementType, typename MT2::ElementType );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( typename MT1::ElementType, typename MT3::ElementType );
+
+   BLAZE_INTERNAL_ASSERT( (~C).rows()    == (~A).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~C).columns() == (~B).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( (~A).columns() == (~B).rows()   , "Invalid matrix sizes"      );
+
+   mmmBackend( C, trans( ~B ), trans( ~A ), alpha, accumulate );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
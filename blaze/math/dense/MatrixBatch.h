@@ -0,0 +1,1087 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/MatrixBatch.h
+//  \brief Header file for the implementation of a batch of small matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_MATRIXBATCH_H_
+#define _BLAZE_MATH_DENSE_MATRIXBATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <stdexcept>
+#include <blaze/math/dense/BatchTrait.h>
+#include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/dense/VectorBatch.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/RotationMatrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup matrix_batch MatrixBatch
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of a batch of small, fixed-size matrices.
+// \ingroup matrix_batch
+//
+// The MatrixBatch class template represents an array of \a n matrices of the fixed size
+// \f$ M \times N \f$. The matrices are stored in the same blocked structure-of-arrays layout
+// as the vectors of a VectorBatch: The matrices are grouped into blocks of as many matrices as
+// fit into a SIMD register. Within a block, the elements (0,0) of all matrices are stored
+// contiguously, followed by the elements (0,1) of all matrices, and so on (i.e. the elements
+// of each matrix are ordered row-wise). Thus all batch operations process one element of a
+// complete block of matrices per SIMD instruction. For instance, a single 3x3 inversion in
+// double precision cannot make use of 256-bit registers, whereas the batched inversion inverts
+// four matrices at a time. The type of the elements and the size of the matrices are specified
+// via the three template parameters:
+
+   \code
+   template< typename Type, size_t M, size_t N >
+   class MatrixBatch;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. MatrixBatch can only be instantiated for
+//          non-cv-qualified floating point types. Batches of \c float and \c double values are
+//          vectorized.
+//  - M   : specifies the fixed number of rows of the matrices.
+//  - N   : specifies the fixed number of columns of the matrices.
+//
+// The individual matrices can be exchanged with StaticMatrix and RotationMatrix instances via
+// the set() and get() functions, the elements can be accessed directly via the function call
+// operator:
+
+   \code
+   blaze::MatrixBatch<double,3UL,3UL> A( 1000UL ), B;
+   blaze::VectorBatch<double,3UL> x( 1000UL ), y;
+   blaze::StaticMatrix<double,3UL,3UL> M;
+
+   A.set( 0UL, M );         // Setting the first matrix of A
+   A( 1UL, 0UL, 2UL ) = 4;  // Setting the element (0,2) of the second matrix of A
+
+   B = A;
+   invert( B );             // Batched inversion of all matrices of B
+   mult( A, x, y );         // Batched matrix/vector multiplication
+   B.get( 0UL, M );         // Extracting the first matrix of B
+   \endcode
+
+// The elements of the unused lanes of the last block are not part of the batch. They are
+// processed by the batch operations, but their values are unspecified.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+class MatrixBatch
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef BatchTrait<Type>  BT;  //!< Packed element access of the batch.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef MatrixBatch<Type,M,N>  This;            //!< Type of this MatrixBatch instance.
+   typedef Type                   ElementType;     //!< Type of the matrix elements.
+   typedef Type&                  Reference;       //!< Reference to a non-constant matrix value.
+   typedef const Type&            ConstReference;  //!< Reference to a constant matrix value.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Number of matrices per block.
+   enum { lanes = BT::size };
+
+   //! Number of elements per block.
+   enum { blockSize = M * N * lanes };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MatrixBatch();
+   explicit inline MatrixBatch( size_t n );
+            inline MatrixBatch( const MatrixBatch& b );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~MatrixBatch();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t index, size_t i, size_t j );
+   inline ConstReference operator()( size_t index, size_t i, size_t j ) const;
+   inline Type*          data  ();
+   inline const Type*    data  () const;
+   inline Type*          data  ( size_t b );
+   inline const Type*    data  ( size_t b ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline MatrixBatch& operator=( const MatrixBatch& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const;
+   inline size_t blocks() const;
+   inline void   reset();
+   inline void   resize( size_t n, bool preserve=true );
+   inline void   swap( MatrixBatch& b ) /* throw() */;
+
+   template< typename Other, bool SO >
+   inline void set( size_t index, const StaticMatrix<Other,M,N,SO>& m );
+
+   template< typename Other >
+   inline void set( size_t index, const RotationMatrix<Other>& m );
+
+   template< typename Other, bool SO >
+   inline void get( size_t index, StaticMatrix<Other,M,N,SO>& m ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t size_;      //!< The current number of matrices of the batch.
+   size_t blocks_;    //!< The current number of blocks of the batch.
+   size_t capacity_;  //!< The maximum number of blocks of the batch.
+   Type* v_;          //!< The dynamically allocated batch elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST          ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE       ( Type );
+   BLAZE_STATIC_ASSERT( M > 0UL && N > 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for MatrixBatch.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline MatrixBatch<Type,M,N>::MatrixBatch()
+   : size_    ( 0UL )   // The current number of matrices of the batch
+   , blocks_  ( 0UL )   // The current number of blocks of the batch
+   , capacity_( 0UL )   // The maximum number of blocks of the batch
+   , v_       ( NULL )  // The batch elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a batch of \a n matrices.
+//
+// \param n The number of matrices of the batch.
+//
+// All elements of all matrices are initialized to 0.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline MatrixBatch<Type,M,N>::MatrixBatch( size_t n )
+   : size_    ( n )                                      // The current number of matrices of the batch
+   , blocks_  ( ( n + lanes - 1UL ) / lanes )            // The current number of blocks of the batch
+   , capacity_( blocks_ )                                // The maximum number of blocks of the batch
+   , v_       ( allocate<Type>( capacity_*blockSize ) )  // The batch elements
+{
+   std::fill( v_, v_+capacity_*blockSize, Type() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for MatrixBatch.
+//
+// \param b Batch to be copied.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline MatrixBatch<Type,M,N>::MatrixBatch( const MatrixBatch& b )
+   : size_    ( b.size_ )                                // The current number of matrices of the batch
+   , blocks_  ( b.blocks_ )                              // The current number of blocks of the batch
+   , capacity_( b.blocks_ )                              // The maximum number of blocks of the batch
+   , v_       ( allocate<Type>( capacity_*blockSize ) )  // The batch elements
+{
+   std::copy( b.v_, b.v_+blocks_*blockSize, v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for MatrixBatch.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline MatrixBatch<Type,M,N>::~MatrixBatch()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access to a single element of a single matrix of the batch.
+//
+// \param index Index of the accessed matrix. The index has to be in the range \f$[0..n-1]\f$.
+// \param i Row index of the accessed element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Column index of the accessed element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename MatrixBatch<Type,M,N>::Reference
+   MatrixBatch<Type,M,N>::operator()( size_t index, size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid batch access index" );
+   BLAZE_USER_ASSERT( i < M, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < N, "Invalid column access index" );
+   return v_[(index/lanes)*blockSize + (i*N+j)*lanes + index%lanes];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to a single element of a single matrix of the batch.
+//
+// \param index Index of the accessed matrix. The index has to be in the range \f$[0..n-1]\f$.
+// \param i Row index of the accessed element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Column index of the accessed element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename MatrixBatch<Type,M,N>::ConstReference
+   MatrixBatch<Type,M,N>::operator()( size_t index, size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid batch access index" );
+   BLAZE_USER_ASSERT( i < M, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < N, "Invalid column access index" );
+   return v_[(index/lanes)*blockSize + (i*N+j)*lanes + index%lanes];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the batch elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the batch. The storage consists
+// of blocks() consecutive blocks of \a blockSize elements each.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline Type* MatrixBatch<Type,M,N>::data()
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the batch elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the batch. The storage consists
+// of blocks() consecutive blocks of \a blockSize elements each.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline const Type* MatrixBatch<Type,M,N>::data() const
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the elements of block \a b.
+//
+// \param b The block index.
+// \return Pointer to the first element of block \a b.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline Type* MatrixBatch<Type,M,N>::data( size_t b )
+{
+   BLAZE_USER_ASSERT( b < blocks_, "Invalid block access index" );
+   return v_ + b*blockSize;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the elements of block \a b.
+//
+// \param b The block index.
+// \return Pointer to the first element of block \a b.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline const Type* MatrixBatch<Type,M,N>::data( size_t b ) const
+{
+   BLAZE_USER_ASSERT( b < blocks_, "Invalid block access index" );
+   return v_ + b*blockSize;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for MatrixBatch.
+//
+// \param rhs Batch to be copied.
+// \return Reference to the assigned batch.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline MatrixBatch<Type,M,N>& MatrixBatch<Type,M,N>::operator=( const MatrixBatch& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   resize( rhs.size_, false );
+   std::copy( rhs.v_, rhs.v_+blocks_*blockSize, v_ );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of matrices of the batch.
+//
+// \return The number of matrices of the batch.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline size_t MatrixBatch<Type,M,N>::size() const
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of blocks of the batch.
+//
+// \return The number of blocks of the batch.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline size_t MatrixBatch<Type,M,N>::blocks() const
+{
+   return blocks_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void MatrixBatch<Type,M,N>::reset()
+{
+   std::fill( v_, v_+blocks_*blockSize, Type() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the number of matrices of the batch.
+//
+// \param n The new number of matrices of the batch.
+// \param preserve \a true if the old values of the batch should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the batch to \a n matrices. During this operation, new dynamic memory
+// may be allocated in case the capacity of the batch is too small. Note that this function may
+// invalidate all existing pointers to the batch elements. In case the old values are preserved
+// and the batch is extended, the new matrices are initialized to 0.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void MatrixBatch<Type,M,N>::resize( size_t n, bool preserve )
+{
+   const size_t newBlocks( ( n + lanes - 1UL ) / lanes );
+
+   if( newBlocks > capacity_ )
+   {
+      Type* tmp = allocate<Type>( newBlocks*blockSize );
+
+      if( preserve ) {
+         std::copy( v_, v_+blocks_*blockSize, tmp );
+         std::fill( tmp+blocks_*blockSize, tmp+newBlocks*blockSize, Type() );
+      }
+      else {
+         std::fill( tmp, tmp+newBlocks*blockSize, Type() );
+      }
+
+      std::swap( v_, tmp );
+      deallocate( tmp );
+      capacity_ = newBlocks;
+   }
+   else if( newBlocks > blocks_ )
+   {
+      std::fill( v_+blocks_*blockSize, v_+newBlocks*blockSize, Type() );
+   }
+
+   if( preserve && n > size_ ) {
+      for( size_t index=size_; index<n && index%lanes!=0UL; ++index )
+         for( size_t k=0UL; k<M*N; ++k )
+            v_[(index/lanes)*blockSize + k*lanes + index%lanes] = Type();
+   }
+
+   size_   = n;
+   blocks_ = newBlocks;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two batches.
+//
+// \param b The batch to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void MatrixBatch<Type,M,N>::swap( MatrixBatch& b ) /* throw() */
+{
+   std::swap( size_, b.size_ );
+   std::swap( blocks_, b.blocks_ );
+   std::swap( capacity_, b.capacity_ );
+   std::swap( v_, b.v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting a single matrix of the batch.
+//
+// \param index Index of the matrix. The index has to be in the range \f$[0..n-1]\f$.
+// \param m The new value of the matrix.
+// \return void
+*/
+template< typename Type   // Data type of the matrices
+        , size_t M        // Number of rows of each matrix
+        , size_t N >      // Number of columns of each matrix
+template< typename Other  // Data type of the static matrix
+        , bool SO >       // Storage order of the static matrix
+inline void MatrixBatch<Type,M,N>::set( size_t index, const StaticMatrix<Other,M,N,SO>& m )
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid batch access index" );
+
+   Type* const p( v_ + (index/lanes)*blockSize + index%lanes );
+   for( size_t i=0UL; i<M; ++i )
+      for( size_t j=0UL; j<N; ++j )
+         p[(i*N+j)*lanes] = m(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting a single rotation matrix of a batch of 3x3 matrices.
+//
+// \param index Index of the matrix. The index has to be in the range \f$[0..n-1]\f$.
+// \param m The rotation matrix to be stored in the batch.
+// \return void
+*/
+template< typename Type     // Data type of the matrices
+        , size_t M          // Number of rows of each matrix
+        , size_t N >        // Number of columns of each matrix
+template< typename Other >  // Data type of the rotation matrix
+inline void MatrixBatch<Type,M,N>::set( size_t index, const RotationMatrix<Other>& m )
+{
+   BLAZE_STATIC_ASSERT( M == 3UL && N == 3UL );
+   BLAZE_USER_ASSERT( index < size_, "Invalid batch access index" );
+
+   Type* const p( v_ + (index/lanes)*blockSize + index%lanes );
+   for( size_t k=0UL; k<9UL; ++k )
+      p[k*lanes] = m[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Extracting a single matrix of the batch.
+//
+// \param index Index of the matrix. The index has to be in the range \f$[0..n-1]\f$.
+// \param m The static matrix for the extracted matrix.
+// \return void
+*/
+template< typename Type   // Data type of the matrices
+        , size_t M        // Number of rows of each matrix
+        , size_t N >      // Number of columns of each matrix
+template< typename Other  // Data type of the static matrix
+        , bool SO >       // Storage order of the static matrix
+inline void MatrixBatch<Type,M,N>::get( size_t index, StaticMatrix<Other,M,N,SO>& m ) const
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid batch access index" );
+
+   const Type* const p( v_ + (index/lanes)*blockSize + index%lanes );
+   for( size_t i=0UL; i<M; ++i )
+      for( size_t j=0UL; j<N; ++j )
+         m(i,j) = p[(i*N+j)*lanes];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name MatrixBatch functions */
+//@{
+template< typename Type, size_t M, size_t N >
+inline void reset( MatrixBatch<Type,M,N>& b );
+
+template< typename Type, size_t M, size_t N >
+inline void swap( MatrixBatch<Type,M,N>& a, MatrixBatch<Type,M,N>& b ) /* throw() */;
+
+template< typename Type, size_t M, size_t N >
+inline void add( const MatrixBatch<Type,M,N>& A, const MatrixBatch<Type,M,N>& B,
+                 MatrixBatch<Type,M,N>& C );
+
+template< typename Type, size_t M, size_t N >
+inline void sub( const MatrixBatch<Type,M,N>& A, const MatrixBatch<Type,M,N>& B,
+                 MatrixBatch<Type,M,N>& C );
+
+template< typename Type, size_t M, size_t K, size_t N >
+inline void mult( const MatrixBatch<Type,M,K>& A, const MatrixBatch<Type,K,N>& B,
+                  MatrixBatch<Type,M,N>& C );
+
+template< typename Type, size_t M, size_t N >
+inline void mult( const MatrixBatch<Type,M,N>& A, const VectorBatch<Type,N>& x,
+                  VectorBatch<Type,M>& y );
+
+template< typename Type, size_t M, size_t N >
+inline void trans( const MatrixBatch<Type,M,N>& A, MatrixBatch<Type,N,M>& B );
+
+template< typename Type >
+inline void invert( MatrixBatch<Type,3UL,3UL>& A );
+
+template< typename Type >
+inline void toRotationMatrix( const VectorBatch<Type,4UL>& q, MatrixBatch<Type,3UL,3UL>& R );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given batch.
+// \ingroup matrix_batch
+//
+// \param b The batch to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void reset( MatrixBatch<Type,M,N>& b )
+{
+   b.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two batches.
+// \ingroup matrix_batch
+//
+// \param a The first batch to be swapped.
+// \param b The second batch to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void swap( MatrixBatch<Type,M,N>& a, MatrixBatch<Type,M,N>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched addition of two batches of matrices (\f$ C_k=A_k+B_k \f$).
+// \ingroup matrix_batch
+//
+// \param A The left-hand side batch.
+// \param B The right-hand side batch.
+// \param C The batch for the resulting matrices.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+//
+// The resulting batch \a C is resized to the size of \a A and \a B. It may be one of the
+// operands.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void add( const MatrixBatch<Type,M,N>& A, const MatrixBatch<Type,M,N>& B,
+                 MatrixBatch<Type,M,N>& C )
+{
+   typedef BatchTrait<Type>  BT;
+
+   if( A.size() != B.size() )
+      throw std::invalid_argument( "Batch sizes do not match" );
+
+   C.resize( A.size(), false );
+
+   const size_t elements( A.blocks() * MatrixBatch<Type,M,N>::blockSize );
+   const Type* pa( A.data() );
+   const Type* pb( B.data() );
+   Type* pc( C.data() );
+
+   for( size_t i=0UL; i<elements; i+=BT::size )
+      BT::store( pc+i, BT::load( pa+i ) + BT::load( pb+i ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched subtraction of two batches of matrices (\f$ C_k=A_k-B_k \f$).
+// \ingroup matrix_batch
+//
+// \param A The left-hand side batch.
+// \param B The right-hand side batch.
+// \param C The batch for the resulting matrices.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+//
+// The resulting batch \a C is resized to the size of \a A and \a B. It may be one of the
+// operands.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void sub( const MatrixBatch<Type,M,N>& A, const MatrixBatch<Type,M,N>& B,
+                 MatrixBatch<Type,M,N>& C )
+{
+   typedef BatchTrait<Type>  BT;
+
+   if( A.size() != B.size() )
+      throw std::invalid_argument( "Batch sizes do not match" );
+
+   C.resize( A.size(), false );
+
+   const size_t elements( A.blocks() * MatrixBatch<Type,M,N>::blockSize );
+   const Type* pa( A.data() );
+   const Type* pb( B.data() );
+   Type* pc( C.data() );
+
+   for( size_t i=0UL; i<elements; i+=BT::size )
+      BT::store( pc+i, BT::load( pa+i ) - BT::load( pb+i ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched multiplication of two batches of matrices (\f$ C_k=A_k*B_k \f$).
+// \ingroup matrix_batch
+//
+// \param A The left-hand side batch.
+// \param B The right-hand side batch.
+// \param C The batch for the resulting matrices.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+//
+// The resulting batch \a C is resized to the size of \a A and \a B. Since the result of each
+// block is computed before it is stored, \a C may be one of the operands.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of the left-hand side matrices
+        , size_t K       // Number of columns of the left-hand side matrices
+        , size_t N >     // Number of columns of the right-hand side matrices
+inline void mult( const MatrixBatch<Type,M,K>& A, const MatrixBatch<Type,K,N>& B,
+                  MatrixBatch<Type,M,N>& C )
+{
+   typedef BatchTrait<Type>         BT;
+   typedef typename BT::PackType    PackType;
+
+   const size_t L( BT::size );
+
+   if( A.size() != B.size() )
+      throw std::invalid_argument( "Batch sizes do not match" );
+
+   C.resize( A.size(), false );
+
+   PackType a[K];
+   PackType c[M*N];
+
+   for( size_t b=0UL; b<A.blocks(); ++b )
+   {
+      const Type* const pa( A.data(b) );
+      const Type* const pb( B.data(b) );
+
+      for( size_t i=0UL; i<M; ++i )
+      {
+         for( size_t k=0UL; k<K; ++k )
+            a[k] = BT::load( pa+(i*K+k)*L );
+
+         for( size_t j=0UL; j<N; ++j ) {
+            PackType sum( a[0] * BT::load( pb+j*L ) );
+            for( size_t k=1UL; k<K; ++k )
+               sum = sum + a[k] * BT::load( pb+(k*N+j)*L );
+            c[i*N+j] = sum;
+         }
+      }
+
+      Type* const pc( C.data(b) );
+
+      for( size_t k=0UL; k<M*N; ++k )
+         BT::store( pc+k*L, c[k] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched multiplication of a batch of matrices and a batch of vectors (\f$ \vec{y}_k=A_k*\vec{x}_k \f$).
+// \ingroup matrix_batch
+//
+// \param A The batch of matrices.
+// \param x The batch of vectors.
+// \param y The batch for the resulting vectors.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+//
+// The resulting batch \a y is resized to the size of \a A and \a x. Since the result of each
+// block is computed before it is stored, \a y may be the same batch as \a x.
+*/
+template< typename Type  // Data type of the matrices and vectors
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void mult( const MatrixBatch<Type,M,N>& A, const VectorBatch<Type,N>& x,
+                  VectorBatch<Type,M>& y )
+{
+   typedef BatchTrait<Type>         BT;
+   typedef typename BT::PackType    PackType;
+
+   const size_t L( BT::size );
+
+   if( A.size() != x.size() )
+      throw std::invalid_argument( "Batch sizes do not match" );
+
+   y.resize( A.size(), false );
+
+   PackType v[N];
+   PackType r[M];
+
+   for( size_t b=0UL; b<A.blocks(); ++b )
+   {
+      const Type* const pa( A.data(b) );
+      const Type* const px( x.data(b) );
+
+      for( size_t j=0UL; j<N; ++j )
+         v[j] = BT::load( px+j*L );
+
+      for( size_t i=0UL; i<M; ++i ) {
+         PackType sum( BT::load( pa+i*N*L ) * v[0] );
+         for( size_t j=1UL; j<N; ++j )
+            sum = sum + BT::load( pa+(i*N+j)*L ) * v[j];
+         r[i] = sum;
+      }
+
+      Type* const py( y.data(b) );
+
+      for( size_t i=0UL; i<M; ++i )
+         BT::store( py+i*L, r[i] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched transposition of a batch of matrices (\f$ B_k=A_k^T \f$).
+// \ingroup matrix_batch
+//
+// \param A The batch of matrices to be transposed.
+// \param B The batch for the transposed matrices.
+// \return void
+//
+// The resulting batch \a B is resized to the size of \a A. In case of square matrices, \a B may
+// be the same batch as \a A.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void trans( const MatrixBatch<Type,M,N>& A, MatrixBatch<Type,N,M>& B )
+{
+   typedef BatchTrait<Type>         BT;
+   typedef typename BT::PackType    PackType;
+
+   const size_t L( BT::size );
+
+   B.resize( A.size(), false );
+
+   PackType t[M*N];
+
+   for( size_t b=0UL; b<A.blocks(); ++b )
+   {
+      const Type* const pa( A.data(b) );
+
+      for( size_t i=0UL; i<M; ++i )
+         for( size_t j=0UL; j<N; ++j )
+            t[j*M+i] = BT::load( pa+(i*N+j)*L );
+
+      Type* const pb( B.data(b) );
+
+      for( size_t k=0UL; k<M*N; ++k )
+         BT::store( pb+k*L, t[k] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched in-place inversion of a batch of 3x3 matrices.
+// \ingroup matrix_batch
+//
+// \param A The batch of matrices to be inverted.
+// \return void
+// \exception std::invalid_argument Inversion of singular matrix failed.
+//
+// This function inverts all matrices of the given batch via their adjugate matrices. In case
+// one of the matrices is singular, a \a std::invalid_argument exception is thrown. In this case
+// the batch is left in an unspecified state.
+*/
+template< typename Type >  // Data type of the matrices
+inline void invert( MatrixBatch<Type,3UL,3UL>& A )
+{
+   typedef BatchTrait<Type>         BT;
+   typedef typename BT::PackType    PackType;
+
+   const size_t L( BT::size );
+
+   Type dets[BT::size];
+
+   for( size_t b=0UL; b<A.blocks(); ++b )
+   {
+      Type* const p( A.data(b) );
+
+      const PackType a00( BT::load( p     ) );
+      const PackType a01( BT::load( p+  L ) );
+      const PackType a02( BT::load( p+2*L ) );
+      const PackType a10( BT::load( p+3*L ) );
+      const PackType a11( BT::load( p+4*L ) );
+      const PackType a12( BT::load( p+5*L ) );
+      const PackType a20( BT::load( p+6*L ) );
+      const PackType a21( BT::load( p+7*L ) );
+      const PackType a22( BT::load( p+8*L ) );
+
+      const PackType c00( a11*a22 - a12*a21 );
+      const PackType c01( a12*a20 - a10*a22 );
+      const PackType c02( a10*a21 - a11*a20 );
+      const PackType det( a00*c00 + a01*c01 + a02*c02 );
+
+      BT::storeu( dets, det );
+
+      const size_t active( ( b+1UL < A.blocks() )?( L ):( A.size() - b*L ) );
+      for( size_t l=0UL; l<active; ++l ) {
+         if( isDefault( dets[l] ) )
+            throw std::invalid_argument( "Inversion of singular matrix failed" );
+      }
+
+      const PackType idet( BT::set( Type(1) ) / det );
+
+      BT::store( p    , c00 * idet );
+      BT::store( p+  L, ( a02*a21 - a01*a22 ) * idet );
+      BT::store( p+2*L, ( a01*a12 - a02*a11 ) * idet );
+      BT::store( p+3*L, c01 * idet );
+      BT::store( p+4*L, ( a00*a22 - a02*a20 ) * idet );
+      BT::store( p+5*L, ( a02*a10 - a00*a12 ) * idet );
+      BT::store( p+6*L, c02 * idet );
+      BT::store( p+7*L, ( a01*a20 - a00*a21 ) * idet );
+      BT::store( p+8*L, ( a00*a11 - a01*a10 ) * idet );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched conversion of a batch of quaternions to rotation matrices.
+// \ingroup matrix_batch
+//
+// \param q The batch of unit quaternions (see VectorBatch::set()).
+// \param R The batch for the resulting rotation matrices.
+// \return void
+//
+// This function computes the rotation matrix of each quaternion of the given batch in the same
+// way as the Quaternion::toRotationMatrix() function. The resulting batch \a R is resized to
+// the size of \a q.
+*/
+template< typename Type >  // Data type of the quaternions and matrices
+inline void toRotationMatrix( const VectorBatch<Type,4UL>& q, MatrixBatch<Type,3UL,3UL>& R )
+{
+   typedef BatchTrait<Type>         BT;
+   typedef typename BT::PackType    PackType;
+
+   const size_t L( BT::size );
+
+   R.resize( q.size(), false );
+
+   const PackType one( BT::set( Type(1) ) );
+   const PackType two( BT::set( Type(2) ) );
+
+   for( size_t b=0UL; b<q.blocks(); ++b )
+   {
+      const Type* const pq( q.data(b) );
+
+      const PackType q0( BT::load( pq     ) );
+      const PackType q1( BT::load( pq+  L ) );
+      const PackType q2( BT::load( pq+2*L ) );
+      const PackType q3( BT::load( pq+3*L ) );
+
+      const PackType q11( two*q1*q1 );
+      const PackType q22( two*q2*q2 );
+      const PackType q33( two*q3*q3 );
+
+      Type* const pr( R.data(b) );
+
+      BT::store( pr    , one - q22 - q33 );
+      BT::store( pr+  L, two*( q1*q2 - q0*q3 ) );
+      BT::store( pr+2*L, two*( q1*q3 + q0*q2 ) );
+      BT::store( pr+3*L, two*( q1*q2 + q0*q3 ) );
+      BT::store( pr+4*L, one - q11 - q33 );
+      BT::store( pr+5*L, two*( q2*q3 - q0*q1 ) );
+      BT::store( pr+6*L, two*( q1*q3 - q0*q2 ) );
+      BT::store( pr+7*L, two*( q2*q3 + q0*q1 ) );
+      BT::store( pr+8*L, one - q11 - q22 );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,400 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/MatrixChain.h
+//  \brief Header file for the reassociation of matrix/matrix multiplication chains
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_DENSE_MATRIXCHAIN_H_
+#define _BLAZE_MATH_DENSE_MATRIXCHAIN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CHAIN ASSIGNMENT POLICIES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Chain policy for the serial assignment of a matrix multiplication (\f$ C=A*B \f$).
+// \ingroup dense_matrix
+*/
+struct ChainAssign
+{
+   //**********************************************************************************************
+   template< typename MT1, typename MT2 >
+   static inline void evaluate( MT1& tmp, const MT2& rhs ) {
+      assign( tmp, rhs );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename MT1, typename MT2 >
+   static inline void apply( MT1& lhs, const MT2& rhs ) {
+      assign( lhs, rhs );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Chain policy for the serial addition assignment of a matrix multiplication
+//        (\f$ C+=A*B \f$).
+// \ingroup dense_matrix
+*/
+struct ChainAddAssign
+{
+   //**********************************************************************************************
+   template< typename MT1, typename MT2 >
+   static inline void evaluate( MT1& tmp, const MT2& rhs ) {
+      assign( tmp, rhs );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename MT1, typename MT2 >
+   static inline void apply( MT1& lhs, const MT2& rhs ) {
+      addAssign( lhs, rhs );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Chain policy for the serial subtraction assignment of a matrix multiplication
+//        (\f$ C-=A*B \f$).
+// \ingroup dense_matrix
+*/
+struct ChainSubAssign
+{
+   //**********************************************************************************************
+   template< typename MT1, typename MT2 >
+   static inline void evaluate( MT1& tmp, const MT2& rhs ) {
+      assign( tmp, rhs );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename MT1, typename MT2 >
+   static inline void apply( MT1& lhs, const MT2& rhs ) {
+      subAssign( lhs, rhs );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Chain policy for the SMP assignment of a matrix multiplication (\f$ C=A*B \f$).
+// \ingroup dense_matrix
+*/
+struct ChainSMPAssign
+{
+   //**********************************************************************************************
+   template< typename MT1, typename MT2 >
+   static inline void evaluate( MT1& tmp, const MT2& rhs ) {
+      smpAssign( tmp, rhs );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename MT1, typename MT2 >
+   static inline void apply( MT1& lhs, const MT2& rhs ) {
+      smpAssign( lhs, rhs );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Chain policy for the SMP addition assignment of a matrix multiplication
+//        (\f$ C+=A*B \f$).
+// \ingroup dense_matrix
+*/
+struct ChainSMPAddAssign
+{
+   //**********************************************************************************************
+   template< typename MT1, typename MT2 >
+   static inline void evaluate( MT1& tmp, const MT2& rhs ) {
+      smpAssign( tmp, rhs );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename MT1, typename MT2 >
+   static inline void apply( MT1& lhs, const MT2& rhs ) {
+      smpAddAssign( lhs, rhs );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Chain policy for the SMP subtraction assignment of a matrix multiplication
+//        (\f$ C-=A*B \f$).
+// \ingroup dense_matrix
+*/
+struct ChainSMPSubAssign
+{
+   //**********************************************************************************************
+   template< typename MT1, typename MT2 >
+   static inline void evaluate( MT1& tmp, const MT2& rhs ) {
+      smpAssign( tmp, rhs );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename MT1, typename MT2 >
+   static inline void apply( MT1& lhs, const MT2& rhs ) {
+      smpSubAssign( lhs, rhs );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CHAIN REASSOCIATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluation of the matrix chain \f$ X*(Y*Z) \f$ via an explicit temporary for \f$ Y*Z \f$.
+// \ingroup dense_matrix
+//
+// \param lhs The target left-hand side dense matrix.
+// \param X The left-hand side matrix operand.
+// \param Y The middle matrix operand.
+// \param Z The right-hand side matrix operand.
+// \return void
+*/
+template< typename OP    // Type of the chain policy
+        , typename MT    // Type of the target dense matrix
+        , bool SO        // Storage order of the target dense matrix
+        , typename MT1   // Type of the left-hand side matrix operand
+        , bool SO1       // Storage order of the left-hand side matrix operand
+        , typename MT2   // Type of the middle matrix operand
+        , bool SO2       // Storage order of the middle matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , bool SO3 >     // Storage order of the right-hand side matrix operand
+inline void multChainRight( DenseMatrix<MT,SO>& lhs, const Matrix<MT1,SO1>& X,
+                            const Matrix<MT2,SO2>& Y, const Matrix<MT3,SO3>& Z )
+{
+   typedef typename MultTrait<typename MT2::ResultType,typename MT3::ResultType>::Type  TmpType;
+
+   TmpType tmp;
+   resize( tmp, (~Y).rows(), (~Z).columns(), false );
+   OP::evaluate( tmp, (~Y) * (~Z) );
+   OP::apply( ~lhs, (~X) * tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluation of the matrix chain \f$ (X*Y)*Z \f$ via an explicit temporary for \f$ X*Y \f$.
+// \ingroup dense_matrix
+//
+// \param lhs The target left-hand side dense matrix.
+// \param X The left-hand side matrix operand.
+// \param Y The middle matrix operand.
+// \param Z The right-hand side matrix operand.
+// \return void
+*/
+template< typename OP    // Type of the chain policy
+        , typename MT    // Type of the target dense matrix
+        , bool SO        // Storage order of the target dense matrix
+        , typename MT1   // Type of the left-hand side matrix operand
+        , bool SO1       // Storage order of the left-hand side matrix operand
+        , typename MT2   // Type of the middle matrix operand
+        , bool SO2       // Storage order of the middle matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , bool SO3 >     // Storage order of the right-hand side matrix operand
+inline void multChainLeft( DenseMatrix<MT,SO>& lhs, const Matrix<MT1,SO1>& X,
+                           const Matrix<MT2,SO2>& Y, const Matrix<MT3,SO3>& Z )
+{
+   typedef typename MultTrait<typename MT1::ResultType,typename MT2::ResultType>::Type  TmpType;
+
+   TmpType tmp;
+   resize( tmp, (~X).rows(), (~Y).columns(), false );
+   OP::evaluate( tmp, (~X) * (~Y) );
+   OP::apply( ~lhs, tmp * (~Z) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reassociation of a matrix chain of the form \f$ (X*Y)*Z \f$.
+// \ingroup dense_matrix
+//
+// \param lhs The target left-hand side dense matrix.
+// \param A The left-hand side matrix multiplication operand \f$ X*Y \f$.
+// \param B The right-hand side matrix operand \f$ Z \f$.
+// \return \a true in case the chain has been evaluated, \a false if not.
+//
+// This function compares the number of scalar multiplications of the two possible associations
+// of the matrix chain \f$ X*Y*Z \f$ for the actual operand dimensions. In case \f$ X*(Y*Z) \f$
+// is cheaper than the given association, the chain is evaluated as \f$ X*(Y*Z) \f$ and the
+// function returns \a true. Otherwise the chain is left untouched and \a false is returned.
+*/
+template< typename OP     // Type of the chain policy
+        , typename MT     // Type of the target dense matrix
+        , bool SO         // Storage order of the target dense matrix
+        , typename MT1    // Type of the left-hand side matrix multiplication
+        , typename MT2 >  // Type of the right-hand side matrix operand
+inline typename EnableIfTrue< IsMatMatMultExpr<MT1>::value, bool >::Type
+   reorderChain( DenseMatrix<MT,SO>& lhs, const MT1& A, const MT2& B )
+{
+   const size_t m( A.rows() );
+   const size_t k( A.leftOperand().columns() );
+   const size_t p( A.columns() );
+   const size_t n( B.columns() );
+
+   BLAZE_INTERNAL_ASSERT( p == B.rows(), "Invalid matrix sizes" );
+
+   if( k*p*n + m*k*n >= m*k*p + m*p*n )
+      return false;
+
+   multChainRight<OP>( ~lhs, A.leftOperand(), A.rightOperand(), B );
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reassociation of a matrix chain of the form \f$ X*(Y*Z) \f$.
+// \ingroup dense_matrix
+//
+// \param lhs The target left-hand side dense matrix.
+// \param A The left-hand side matrix operand \f$ X \f$.
+// \param B The right-hand side matrix multiplication operand \f$ Y*Z \f$.
+// \return \a true in case the chain has been evaluated, \a false if not.
+//
+// This function compares the number of scalar multiplications of the two possible associations
+// of the matrix chain \f$ X*Y*Z \f$ for the actual operand dimensions. In case \f$ (X*Y)*Z \f$
+// is cheaper than the given association, the chain is evaluated as \f$ (X*Y)*Z \f$ and the
+// function returns \a true. Otherwise the chain is left untouched and \a false is returned.
+*/
+template< typename OP     // Type of the chain policy
+        , typename MT     // Type of the target dense matrix
+        , bool SO         // Storage order of the target dense matrix
+        , typename MT1    // Type of the left-hand side matrix operand
+        , typename MT2 >  // Type of the right-hand side matrix multiplication
+inline typename EnableIfTrue< !IsMatMatMultExpr<MT1>::value && IsMatMatMultExpr<MT2>::value, bool >::Type
+   reorderChain( DenseMatrix<MT,SO>& lhs, const MT1& A, const MT2& B )
+{
+   const size_t m( A.rows() );
+   const size_t k( A.columns() );
+   const size_t p( B.leftOperand().columns() );
+   const size_t n( B.columns() );
+
+   BLAZE_INTERNAL_ASSERT( k == B.rows(), "Invalid matrix sizes" );
+
+   if( m*k*p + m*p*n >= k*p*n + m*k*n )
+      return false;
+
+   multChainLeft<OP>( ~lhs, A, B.leftOperand(), B.rightOperand() );
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default reassociation of a matrix multiplication without nested multiplications.
+// \ingroup dense_matrix
+//
+// \param lhs The target left-hand side dense matrix.
+// \param A The left-hand side matrix operand.
+// \param B The right-hand side matrix operand.
+// \return \a false.
+*/
+template< typename OP     // Type of the chain policy
+        , typename MT     // Type of the target dense matrix
+        , bool SO         // Storage order of the target dense matrix
+        , typename MT1    // Type of the left-hand side matrix operand
+        , typename MT2 >  // Type of the right-hand side matrix operand
+inline typename DisableIfTrue< IsMatMatMultExpr<MT1>::value || IsMatMatMultExpr<MT2>::value, bool >::Type
+   reorderChain( DenseMatrix<MT,SO>& lhs, const MT1& A, const MT2& B )
+{
+   UNUSED_PARAMETER( lhs, A, B );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
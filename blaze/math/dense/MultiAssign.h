@@ -0,0 +1,624 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/MultiAssign.h
+//  \brief Header file for the fused multi-assignment kernels for dense vectors
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_DENSE_MULTIASSIGN_H_
+#define _BLAZE_MATH_DENSE_MULTIASSIGN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveCV.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  UPDATE POLICIES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Update policy for the assignment of a dense vector (\f$ \vec{a}=\vec{b} \f$).
+// \ingroup dense
+*/
+struct UpdateAssign
+{
+   //**********************************************************************************************
+   template< typename ET >
+   struct Vectorizable {
+      enum { value = 1 };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename T1, typename T2 >
+   static BLAZE_ALWAYS_INLINE void update( T1& lhs, const T2& rhs, size_t i ) {
+      lhs[i] = rhs[i];
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename T1, typename T2 >
+   static BLAZE_ALWAYS_INLINE void updateIntrinsic( T1& lhs, const T2& rhs, size_t i ) {
+      lhs.store( i, rhs.load(i) );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Update policy for the addition assignment of a dense vector (\f$ \vec{a}+=\vec{b} \f$).
+// \ingroup dense
+*/
+struct UpdateAddAssign
+{
+   //**********************************************************************************************
+   template< typename ET >
+   struct Vectorizable {
+      enum { value = IntrinsicTrait<ET>::addition };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename T1, typename T2 >
+   static BLAZE_ALWAYS_INLINE void update( T1& lhs, const T2& rhs, size_t i ) {
+      lhs[i] += rhs[i];
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename T1, typename T2 >
+   static BLAZE_ALWAYS_INLINE void updateIntrinsic( T1& lhs, const T2& rhs, size_t i ) {
+      lhs.store( i, lhs.load(i) + rhs.load(i) );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Update policy for the subtraction assignment of a dense vector (\f$ \vec{a}-=\vec{b} \f$).
+// \ingroup dense
+*/
+struct UpdateSubAssign
+{
+   //**********************************************************************************************
+   template< typename ET >
+   struct Vectorizable {
+      enum { value = IntrinsicTrait<ET>::subtraction };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename T1, typename T2 >
+   static BLAZE_ALWAYS_INLINE void update( T1& lhs, const T2& rhs, size_t i ) {
+      lhs[i] -= rhs[i];
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename T1, typename T2 >
+   static BLAZE_ALWAYS_INLINE void updateIntrinsic( T1& lhs, const T2& rhs, size_t i ) {
+      lhs.store( i, lhs.load(i) - rhs.load(i) );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Update policy for the componentwise multiplication assignment of a dense vector
+//        (\f$ \vec{a}*=\vec{b} \f$).
+// \ingroup dense
+*/
+struct UpdateMultAssign
+{
+   //**********************************************************************************************
+   template< typename ET >
+   struct Vectorizable {
+      enum { value = IntrinsicTrait<ET>::multiplication };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename T1, typename T2 >
+   static BLAZE_ALWAYS_INLINE void update( T1& lhs, const T2& rhs, size_t i ) {
+      lhs[i] *= rhs[i];
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename T1, typename T2 >
+   static BLAZE_ALWAYS_INLINE void updateIntrinsic( T1& lhs, const T2& rhs, size_t i ) {
+      lhs.store( i, lhs.load(i) * rhs.load(i) );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DVECUPDATE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Deferred update of a dense vector for the fused evaluation via multiAssign().
+// \ingroup dense
+//
+// The DVecUpdate class template represents a single deferred (compound) assignment of a dense
+// vector expression to a target dense vector. Instances are created via the assignTo(),
+// addAssignTo(), subAssignTo(), and multAssignTo() functions and are evaluated together with
+// other updates by the multiAssign() functions. Right-hand side operands that require an
+// intermediate evaluation (as for instance matrix/vector multiplications) are evaluated on
+// construction of the update, all other operands are evaluated element by element during
+// the fused evaluation.
+*/
+template< typename VT1   // Type of the target dense vector
+        , typename VT2   // Type of the right-hand side dense vector
+        , typename OP >  // Type of the update policy
+class DVecUpdate
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef typename VT1::ElementType    ET1;  //!< Element type of the target dense vector.
+   typedef typename VT2::ElementType    ET2;  //!< Element type of the right-hand side dense vector.
+   typedef typename VT2::CompositeType  CT2;  //!< Composite type of the right-hand side dense vector.
+
+   //! Type of the evaluated right-hand side operand.
+   typedef typename RemoveCV< typename RemoveReference<CT2>::Type >::Type  OT2;
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef ET1  ElementType;  //!< Element type of the update.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the vectorized evaluation of the update.
+   enum { vectorizable = VT1::vectorizable && OT2::vectorizable &&
+                         IsSame<ET1,ET2>::value && OP::template Vectorizable<ET1>::value };
+
+   //! Compilation switch for the SMP-parallel evaluation of the update.
+   enum { smpAssignable = IsSMPAssignable<VT1>::value && IsSMPAssignable<OT2>::value };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DVecUpdate class template.
+   //
+   // \param lhs The target dense vector.
+   // \param rhs The right-hand side dense vector.
+   */
+   explicit inline DVecUpdate( VT1& lhs, const VT2& rhs )
+      : lhs_( lhs )  // The target dense vector
+      , rhs_( rhs )  // The right-hand side dense vector
+   {
+      BLAZE_INTERNAL_ASSERT( lhs.size() == rhs.size(), "Invalid vector sizes" );
+   }
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the size of the target dense vector.
+   //
+   // \return The size of the target dense vector.
+   */
+   inline size_t size() const {
+      return lhs_.size();
+   }
+   //**********************************************************************************************
+
+   //**Update functions****************************************************************************
+   /*!\brief Updates a single element of the target dense vector.
+   //
+   // \param i Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \return void
+   */
+   BLAZE_ALWAYS_INLINE void update( size_t i ) const {
+      OP::update( lhs_, rhs_, i );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Updates a single intrinsic element of the target dense vector.
+   //
+   // \param i Access index. The index must be a multiple of the number of values inside the
+   //          intrinsic element.
+   // \return void
+   */
+   BLAZE_ALWAYS_INLINE void updateIntrinsic( size_t i ) const {
+      OP::updateIntrinsic( lhs_, rhs_, i );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   VT1& lhs_;  //!< The target dense vector.
+   CT2  rhs_;  //!< The right-hand side dense vector.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DVECUPDATEBATCH
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Batch of two deferred dense vector updates.
+// \ingroup dense
+//
+// The DVecUpdateBatch class template combines two updates (or an update and a further batch)
+// of the same size such that both are applied element by element in a single pass. The batch
+// is vectorizable if both updates are vectorizable and have the same element type.
+*/
+template< typename U1    // Type of the first update
+        , typename U2 >  // Type of the second update
+class DVecUpdateBatch
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef typename U1::ElementType  ElementType;  //!< Element type of the batch.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the vectorized evaluation of the batch.
+   enum { vectorizable = U1::vectorizable && U2::vectorizable &&
+                         IsSame<ElementType,typename U2::ElementType>::value };
+
+   //! Compilation switch for the SMP-parallel evaluation of the batch.
+   enum { smpAssignable = U1::smpAssignable && U2::smpAssignable };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DVecUpdateBatch class template.
+   //
+   // \param u1 The first update.
+   // \param u2 The second update.
+   // \exception std::invalid_argument Vector sizes do not match.
+   */
+   explicit inline DVecUpdateBatch( const U1& u1, const U2& u2 )
+      : u1_( u1 )  // The first update
+      , u2_( u2 )  // The second update
+   {
+      if( u1.size() != u2.size() )
+         throw std::invalid_argument( "Vector sizes do not match" );
+   }
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the common size of the target dense vectors.
+   //
+   // \return The size of the target dense vectors.
+   */
+   inline size_t size() const {
+      return u1_.size();
+   }
+   //**********************************************************************************************
+
+   //**Update functions****************************************************************************
+   /*!\brief Updates a single element of all target dense vectors.
+   //
+   // \param i Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \return void
+   */
+   BLAZE_ALWAYS_INLINE void update( size_t i ) const {
+      u1_.update( i );
+      u2_.update( i );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Updates a single intrinsic element of all target dense vectors.
+   //
+   // \param i Access index. The index must be a multiple of the number of values inside the
+   //          intrinsic element.
+   // \return void
+   */
+   BLAZE_ALWAYS_INLINE void updateIntrinsic( size_t i ) const {
+      u1_.updateIntrinsic( i );
+      u2_.updateIntrinsic( i );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   const U1& u1_;  //!< The first update.
+   const U2& u2_;  //!< The second update.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTI-ASSIGNMENT KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the fused evaluation of a range of dense vector updates.
+// \ingroup dense
+//
+// This kernel applies all updates of the given update or batch element by element.
+*/
+template< bool Vectorized >  // Vectorization flag
+struct MultiAssignKernel
+{
+   //**********************************************************************************************
+   template< typename UT >
+   static inline void run( const UT& u, size_t begin, size_t end )
+   {
+      for( size_t i=begin; i<end; ++i ) {
+         u.update( i );
+      }
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel for the fused evaluation of a range of dense vector updates.
+// \ingroup dense
+//
+// This kernel applies all updates of the given update or batch intrinsic element by intrinsic
+// element and handles the remainder of the range element by element. The first element of the
+// range must be aligned to the intrinsic vector size.
+*/
+template<>
+struct MultiAssignKernel<true>
+{
+   //**********************************************************************************************
+   template< typename UT >
+   static inline void run( const UT& u, size_t begin, size_t end )
+   {
+      typedef IntrinsicTrait<typename UT::ElementType>  IT;
+
+      BLAZE_INTERNAL_ASSERT( begin % IT::size == 0UL, "Unaligned update range detected" );
+
+      const size_t ipos( begin + ( ( end - begin ) & size_t(-IT::size) ) );
+
+      size_t i( begin );
+
+      for( ; i<ipos; i+=IT::size ) {
+         u.updateIntrinsic( i );
+      }
+      for( ; i<end; ++i ) {
+         u.update( i );
+      }
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Single-threaded fused evaluation of a range of dense vector updates.
+// \ingroup dense
+//
+// \param u The update or batch of updates to be evaluated.
+// \param begin The index of the first element of the range.
+// \param end The index one past the last element of the range.
+// \return void
+//
+// In case the update is vectorizable, the index \a begin must be a multiple of the number of
+// values inside an intrinsic element.
+*/
+template< typename UT >  // Type of the update or batch
+inline void multiAssignRange( const UT& u, size_t begin, size_t end )
+{
+   BLAZE_INTERNAL_ASSERT( begin <= end && end <= u.size(), "Invalid update range detected" );
+
+   MultiAssignKernel<UT::vectorizable>::run( u, begin, end );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name DVecUpdate functions */
+//@{
+template< typename VT1, typename VT2, bool TF >
+inline const DVecUpdate<VT1,VT2,UpdateAssign>
+   assignTo( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs );
+
+template< typename VT1, typename VT2, bool TF >
+inline const DVecUpdate<VT1,VT2,UpdateAddAssign>
+   addAssignTo( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs );
+
+template< typename VT1, typename VT2, bool TF >
+inline const DVecUpdate<VT1,VT2,UpdateSubAssign>
+   subAssignTo( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs );
+
+template< typename VT1, typename VT2, bool TF >
+inline const DVecUpdate<VT1,VT2,UpdateMultAssign>
+   multAssignTo( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a deferred assignment of a dense vector (\f$ \vec{a}=\vec{b} \f$).
+// \ingroup dense
+//
+// \param lhs The target dense vector.
+// \param rhs The right-hand side dense vector to be assigned.
+// \return The deferred assignment.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function creates a deferred assignment for the fused evaluation via multiAssign(). In
+// contrast to the assignment operator, the target vector is not resized, i.e. the sizes of the
+// two vectors have to match.
+*/
+template< typename VT1  // Type of the target dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF >     // Transpose flag
+inline const DVecUpdate<VT1,VT2,UpdateAssign>
+   assignTo( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   if( (~lhs).size() != (~rhs).size() )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   return DVecUpdate<VT1,VT2,UpdateAssign>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a deferred addition assignment of a dense vector (\f$ \vec{a}+=\vec{b} \f$).
+// \ingroup dense
+//
+// \param lhs The target dense vector.
+// \param rhs The right-hand side dense vector to be added.
+// \return The deferred addition assignment.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function creates a deferred addition assignment for the fused evaluation via
+// multiAssign().
+*/
+template< typename VT1  // Type of the target dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF >     // Transpose flag
+inline const DVecUpdate<VT1,VT2,UpdateAddAssign>
+   addAssignTo( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   if( (~lhs).size() != (~rhs).size() )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   return DVecUpdate<VT1,VT2,UpdateAddAssign>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a deferred subtraction assignment of a dense vector (\f$ \vec{a}-=\vec{b} \f$).
+// \ingroup dense
+//
+// \param lhs The target dense vector.
+// \param rhs The right-hand side dense vector to be subtracted.
+// \return The deferred subtraction assignment.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function creates a deferred subtraction assignment for the fused evaluation via
+// multiAssign().
+*/
+template< typename VT1  // Type of the target dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF >     // Transpose flag
+inline const DVecUpdate<VT1,VT2,UpdateSubAssign>
+   subAssignTo( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   if( (~lhs).size() != (~rhs).size() )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   return DVecUpdate<VT1,VT2,UpdateSubAssign>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a deferred componentwise multiplication assignment of a dense vector
+//        (\f$ \vec{a}*=\vec{b} \f$).
+// \ingroup dense
+//
+// \param lhs The target dense vector.
+// \param rhs The right-hand side dense vector to be multiplied.
+// \return The deferred multiplication assignment.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function creates a deferred componentwise multiplication assignment for the fused
+// evaluation via multiAssign().
+*/
+template< typename VT1  // Type of the target dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF >     // Transpose flag
+inline const DVecUpdate<VT1,VT2,UpdateMultAssign>
+   multAssignTo( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   if( (~lhs).size() != (~rhs).size() )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   return DVecUpdate<VT1,VT2,UpdateMultAssign>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
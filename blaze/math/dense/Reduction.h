@@ -0,0 +1,793 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Reduction.h
+//  \brief Header file for the reduction kernels for dense vectors and matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_DENSE_REDUCTION_H_
+#define _BLAZE_MATH_DENSE_REDUCTION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstdlib>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  REDUCTION POLICIES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Number of elements of a reduction block.
+// \ingroup dense
+//
+// All reductions split the elements of the dense vector or the lines of the dense matrix into
+// blocks of this size. The results of the blocks are combined pairwise, which bounds the growth
+// of the rounding error and makes the result independent of the number of threads.
+*/
+const size_t REDUCTION_BLOCK_SIZE = 1024UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Combine policy for the summation of elements.
+// \ingroup dense
+*/
+struct ReduceAdd
+{
+   //**********************************************************************************************
+   template< typename ET >
+   struct Vectorizable {
+      enum { value = IntrinsicTrait<ET>::addition && sizeof(ET) > 1UL };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename T >
+   static BLAZE_ALWAYS_INLINE T combine( const T& a, const T& b ) {
+      return a + b;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename ET, typename T >
+   static BLAZE_ALWAYS_INLINE ET reduce( const T& a ) {
+      return sum( a );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Combine policy for the minimum of elements.
+// \ingroup dense
+*/
+struct ReduceMin
+{
+   //**********************************************************************************************
+   template< typename ET >
+   struct Vectorizable {
+      enum { value = IsFloatingPoint<ET>::value && IntrinsicTrait<ET>::addition && !BLAZE_MIC_MODE };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename T >
+   static BLAZE_ALWAYS_INLINE T combine( const T& a, const T& b ) {
+      return min( a, b );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename ET, typename T >
+   static BLAZE_ALWAYS_INLINE ET reduce( const T& a ) {
+      ET minimum( a[0] );
+      for( size_t k=1UL; k<IntrinsicTrait<ET>::size; ++k )
+         minimum = min( minimum, a[k] );
+      return minimum;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Combine policy for the maximum of elements.
+// \ingroup dense
+*/
+struct ReduceMax
+{
+   //**********************************************************************************************
+   template< typename ET >
+   struct Vectorizable {
+      enum { value = IsFloatingPoint<ET>::value && IntrinsicTrait<ET>::addition && !BLAZE_MIC_MODE };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename T >
+   static BLAZE_ALWAYS_INLINE T combine( const T& a, const T& b ) {
+      return max( a, b );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename ET, typename T >
+   static BLAZE_ALWAYS_INLINE ET reduce( const T& a ) {
+      ET maximum( a[0] );
+      for( size_t k=1UL; k<IntrinsicTrait<ET>::size; ++k )
+         maximum = max( maximum, a[k] );
+      return maximum;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transform policy passing the elements unchanged.
+// \ingroup dense
+*/
+struct ReduceIdentity
+{
+   //**********************************************************************************************
+   template< typename ET >
+   struct Vectorizable {
+      enum { value = 1 };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename T >
+   static BLAZE_ALWAYS_INLINE T transform( const T& a ) {
+      return a;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transform policy for the absolute value of the elements.
+// \ingroup dense
+*/
+struct ReduceAbs
+{
+   //**********************************************************************************************
+   template< typename ET >
+   struct Vectorizable {
+      enum { value = IsFloatingPoint<ET>::value && !BLAZE_MIC_MODE };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename T >
+   static BLAZE_ALWAYS_INLINE T transform( const T& a ) {
+      using std::abs;
+      return abs( a );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transform policy for the square of the elements.
+// \ingroup dense
+*/
+struct ReduceSqr
+{
+   //**********************************************************************************************
+   template< typename ET >
+   struct Vectorizable {
+      enum { value = IntrinsicTrait<ET>::multiplication };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename T >
+   static BLAZE_ALWAYS_INLINE T transform( const T& a ) {
+      return a * a;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reduction operation combining a transform policy and a combine policy.
+// \ingroup dense
+//
+// The Reduction class template represents the reduction of the transformed elements of a dense
+// vector or matrix via the given combine operation. Vectorization is available if both the
+// combine and the transform policy can be vectorized for the given element type.
+*/
+template< typename C    // Type of the combine policy
+        , typename T >  // Type of the transform policy
+struct Reduction
+{
+   //**********************************************************************************************
+   template< typename ET >
+   struct Vectorizable {
+      enum { value = C::template Vectorizable<ET>::value && T::template Vectorizable<ET>::value };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename X >
+   static BLAZE_ALWAYS_INLINE X combine( const X& a, const X& b ) {
+      return C::combine( a, b );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename X >
+   static BLAZE_ALWAYS_INLINE X transform( const X& a ) {
+      return T::transform( a );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename X, typename V >
+   static BLAZE_ALWAYS_INLINE X accumulate( const X& a, const V& v, size_t i ) {
+      return C::combine( a, T::transform( v.load(i) ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename ET, typename X >
+   static BLAZE_ALWAYS_INLINE ET reduce( const X& a ) {
+      return C::template reduce<ET>( a );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Binary reduction operation for the sum of the componentwise product of two dense vectors.
+// \ingroup dense
+//
+// The ReduceProduct reduction is applied to the componentwise product of two dense vectors, i.e.
+// to a dense vector/dense vector multiplication expression. Whereas the elements of the operand
+// are the products of the two vectors, the vectorized kernel loads the factors of both vectors
+// and accumulates their products via fused multiply-add operations (\f$ acc=a*b+acc \f$).
+*/
+struct ReduceProduct
+{
+   //**********************************************************************************************
+   template< typename ET >
+   struct Vectorizable {
+      enum { value = IntrinsicTrait<ET>::addition && IntrinsicTrait<ET>::multiplication };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename X >
+   static BLAZE_ALWAYS_INLINE X combine( const X& a, const X& b ) {
+      return a + b;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename X >
+   static BLAZE_ALWAYS_INLINE X transform( const X& a ) {
+      return a;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename X, typename V >
+   static BLAZE_ALWAYS_INLINE X accumulate( const X& a, const V& v, size_t i ) {
+      return fmadd( v.leftOperand().load(i), v.rightOperand().load(i), a );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename ET, typename X >
+   static BLAZE_ALWAYS_INLINE ET reduce( const X& a ) {
+      return sum( a );
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS REDUCTIONCASCADE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pairwise combination of the partial results of a reduction.
+// \ingroup dense
+//
+// The ReductionCascade class template combines a sequence of partial results in a binary tree.
+// Two partial results of the same level are combined as soon as both are available, i.e. the
+// cascade works like a binary counter and requires a single value per level. Compared to a
+// sequential accumulation the rounding error of a summation grows logarithmically instead of
+// linearly in the number of partial results.
+*/
+template< typename Op    // Type of the reduction operation
+        , typename ET >  // Type of the partial results
+class ReductionCascade
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief The default constructor of the ReductionCascade class template.
+   */
+   explicit inline ReductionCascade()
+      : count_( 0UL )  // The number of partial results pushed so far
+   {}
+   //**********************************************************************************************
+
+   //**Push function*******************************************************************************
+   /*!\brief Adds the next partial result to the cascade.
+   //
+   // \param value The partial result.
+   // \return void
+   */
+   inline void push( const ET& value ) {
+      ET tmp( value );
+      size_t level( 0UL );
+      for( size_t count=count_; count & 1UL; count >>= 1, ++level )
+         tmp = Op::combine( partials_[level], tmp );
+      partials_[level] = tmp;
+      ++count_;
+   }
+   //**********************************************************************************************
+
+   //**Result function*****************************************************************************
+   /*!\brief Returns the combination of all partial results pushed so far.
+   //
+   // \return The result of the reduction.
+   */
+   inline ET result() const {
+      BLAZE_INTERNAL_ASSERT( count_ > 0UL, "Empty reduction cascade detected" );
+
+      size_t level( 0UL );
+      size_t count( count_ );
+      for( ; !( count & 1UL ); count >>= 1, ++level ) {}
+
+      ET tmp( partials_[level] );
+      for( count >>= 1, ++level; count != 0UL; count >>= 1, ++level ) {
+         if( count & 1UL )
+            tmp = Op::combine( partials_[level], tmp );
+      }
+      return tmp;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   size_t count_;                      //!< The number of partial results pushed so far.
+   ET partials_[sizeof(size_t)*8UL];  //!< The pending partial result of each level.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS REDUCTIONKERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default reduction kernel for a contiguous range of elements.
+// \ingroup dense
+//
+// This kernel reduces the given non-empty range of elements of a dense vector or a line of a
+// dense matrix element by element.
+*/
+template< typename Op        // Type of the reduction operation
+        , typename ET        // Element type of the operand
+        , bool Vectorized >  // Vectorization flag
+struct ReductionKernel
+{
+   //**********************************************************************************************
+   template< typename T >
+   static inline ET run( const T& v, size_t begin, size_t end )
+   {
+      BLAZE_INTERNAL_ASSERT( begin < end, "Invalid reduction range detected" );
+
+      ET result( Op::transform( ET( v[begin] ) ) );
+      for( size_t i=begin+1UL; i<end; ++i )
+         result = Op::combine( result, Op::transform( ET( v[i] ) ) );
+      return result;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized reduction kernel for a contiguous range of elements.
+// \ingroup dense
+//
+// This kernel reduces the given non-empty range of elements with four independent intrinsic
+// accumulators, which hides the latency of the combine operation. Each accumulation step is
+// delegated to the reduction operation, which allows binary reductions to fuse the combine
+// and transform steps. The first element of the range must be aligned to the intrinsic vector
+// size.
+*/
+template< typename Op    // Type of the reduction operation
+        , typename ET >  // Element type of the operand
+struct ReductionKernel<Op,ET,true>
+{
+   //**********************************************************************************************
+   template< typename T >
+   static inline ET run( const T& v, size_t begin, size_t end )
+   {
+      typedef IntrinsicTrait<ET>  IT;
+      typedef typename IT::Type   IntrinsicType;
+
+      BLAZE_INTERNAL_ASSERT( begin < end, "Invalid reduction range detected" );
+      BLAZE_INTERNAL_ASSERT( begin % IT::size == 0UL, "Unaligned reduction range detected" );
+
+      const size_t ipos( begin + ( ( end - begin ) & size_t(-IT::size*4) ) );
+      const size_t jpos( begin + ( ( end - begin ) & size_t(-IT::size) ) );
+
+      size_t i( begin );
+      ET result;
+
+      if( i < ipos )
+      {
+         IntrinsicType xmm1( Op::transform( v.load(i             ) ) );
+         IntrinsicType xmm2( Op::transform( v.load(i+IT::size    ) ) );
+         IntrinsicType xmm3( Op::transform( v.load(i+IT::size*2UL) ) );
+         IntrinsicType xmm4( Op::transform( v.load(i+IT::size*3UL) ) );
+
+         for( i+=IT::size*4UL; i<ipos; i+=IT::size*4UL ) {
+            xmm1 = Op::accumulate( xmm1, v, i              );
+            xmm2 = Op::accumulate( xmm2, v, i+IT::size     );
+            xmm3 = Op::accumulate( xmm3, v, i+IT::size*2UL );
+            xmm4 = Op::accumulate( xmm4, v, i+IT::size*3UL );
+         }
+         for( ; i<jpos; i+=IT::size ) {
+            xmm1 = Op::accumulate( xmm1, v, i );
+         }
+
+         result = Op::template reduce<ET>( Op::combine( Op::combine( xmm1, xmm2 ), Op::combine( xmm3, xmm4 ) ) );
+      }
+      else if( i < jpos )
+      {
+         IntrinsicType xmm1( Op::transform( v.load(i) ) );
+
+         for( i+=IT::size; i<jpos; i+=IT::size ) {
+            xmm1 = Op::accumulate( xmm1, v, i );
+         }
+
+         result = Op::template reduce<ET>( xmm1 );
+      }
+      else {
+         result = Op::transform( ET( v[i] ) );
+         ++i;
+      }
+
+      for( ; i<end; ++i )
+         result = Op::combine( result, Op::transform( ET( v[i] ) ) );
+
+      return result;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS REDUCTIONLINE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Adapter for the access to a single row of a row-major dense matrix.
+// \ingroup dense
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+class ReductionLine
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef typename MT::ElementType                    ElementType;
+   typedef typename IntrinsicTrait<ElementType>::Type  IntrinsicType;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   explicit inline ReductionLine( const MT& dm, size_t i )
+      : dm_( dm )  // The dense matrix
+      , i_ ( i  )  // The index of the row
+   {}
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   inline ElementType operator[]( size_t j ) const {
+      return dm_(i_,j);
+   }
+   //**********************************************************************************************
+
+   //**Load function*******************************************************************************
+   BLAZE_ALWAYS_INLINE IntrinsicType load( size_t j ) const {
+      return dm_.load(i_,j);
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   const MT& dm_;    //!< The dense matrix.
+   const size_t i_;  //!< The index of the row.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Adapter for the access to a single column of a column-major dense matrix.
+// \ingroup dense
+*/
+template< typename MT >  // Type of the dense matrix
+class ReductionLine<MT,columnMajor>
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef typename MT::ElementType                    ElementType;
+   typedef typename IntrinsicTrait<ElementType>::Type  IntrinsicType;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   explicit inline ReductionLine( const MT& dm, size_t j )
+      : dm_( dm )  // The dense matrix
+      , j_ ( j  )  // The index of the column
+   {}
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   inline ElementType operator[]( size_t i ) const {
+      return dm_(i,j_);
+   }
+   //**********************************************************************************************
+
+   //**Load function*******************************************************************************
+   BLAZE_ALWAYS_INLINE IntrinsicType load( size_t i ) const {
+      return dm_.load(i,j_);
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   const MT& dm_;    //!< The dense matrix.
+   const size_t j_;  //!< The index of the column.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  REDUCTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of reduction blocks of the given dense vector.
+// \ingroup dense
+//
+// \param dv The given dense vector.
+// \return The number of reduction blocks.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline size_t reductionBlocks( const DenseVector<VT,TF>& dv )
+{
+   return ( (~dv).size() + REDUCTION_BLOCK_SIZE - 1UL ) / REDUCTION_BLOCK_SIZE;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of reduction blocks of the given dense matrix.
+// \ingroup dense
+//
+// \param dm The given dense matrix.
+// \return The number of reduction blocks.
+//
+// Each row of a row-major matrix and each column of a column-major matrix is split into blocks
+// individually.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline size_t reductionBlocks( const DenseMatrix<MT,SO>& dm )
+{
+   const size_t lines( SO ? (~dm).columns() : (~dm).rows() );
+   const size_t n    ( SO ? (~dm).rows() : (~dm).columns() );
+
+   return lines * ( ( n + REDUCTION_BLOCK_SIZE - 1UL ) / REDUCTION_BLOCK_SIZE );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reduces a single block of the given dense vector.
+// \ingroup dense
+//
+// \param dv The given dense vector.
+// \param block The index of the block.
+// \return The result of the reduction of the block.
+*/
+template< typename Op  // Type of the reduction operation
+        , typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename VT::ElementType reduceBlock( const DenseVector<VT,TF>& dv, size_t block )
+{
+   typedef typename VT::ElementType  ET;
+
+   enum { vectorizable = VT::vectorizable && Op::template Vectorizable<ET>::value };
+
+   const size_t begin( block * REDUCTION_BLOCK_SIZE );
+   const size_t end  ( min( begin + REDUCTION_BLOCK_SIZE, (~dv).size() ) );
+
+   return ReductionKernel<Op,ET,vectorizable>::run( ~dv, begin, end );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reduces a single block of the given dense matrix.
+// \ingroup dense
+//
+// \param dm The given dense matrix.
+// \param block The index of the block.
+// \return The result of the reduction of the block.
+*/
+template< typename Op  // Type of the reduction operation
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename MT::ElementType reduceBlock( const DenseMatrix<MT,SO>& dm, size_t block )
+{
+   typedef typename MT::ElementType  ET;
+
+   enum { vectorizable = MT::vectorizable && Op::template Vectorizable<ET>::value };
+
+   const size_t n     ( SO ? (~dm).rows() : (~dm).columns() );
+   const size_t blocks( ( n + REDUCTION_BLOCK_SIZE - 1UL ) / REDUCTION_BLOCK_SIZE );
+   const size_t begin ( ( block % blocks ) * REDUCTION_BLOCK_SIZE );
+   const size_t end   ( min( begin + REDUCTION_BLOCK_SIZE, n ) );
+
+   const ReductionLine<MT,SO> line( ~dm, block / blocks );
+
+   return ReductionKernel<Op,ET,vectorizable>::run( line, begin, end );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Single-threaded reduction of the given non-empty dense vector or matrix.
+// \ingroup dense
+//
+// \param dx The given dense vector or matrix.
+// \return The result of the reduction.
+//
+// This function reduces all blocks of the given operand one after another and combines the
+// block results pairwise. The shared-memory parallel reductions split the same blocks among
+// the threads and combine the block results in the same order, i.e. the result does not depend
+// on the number of threads.
+*/
+template< typename Op   // Type of the reduction operation
+        , typename T >  // Type of the dense vector or matrix
+inline typename T::ElementType reduce( const T& dx )
+{
+   typedef typename T::ElementType  ET;
+
+   const size_t blocks( reductionBlocks( dx ) );
+
+   BLAZE_INTERNAL_ASSERT( blocks > 0UL, "Empty reduction operand detected" );
+
+   ReductionCascade<Op,ET> cascade;
+   for( size_t b=0UL; b<blocks; ++b ) {
+      cascade.push( reduceBlock<Op>( dx, b ) );
+   }
+   return cascade.result();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
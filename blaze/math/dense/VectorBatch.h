@@ -0,0 +1,842 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/VectorBatch.h
+//  \brief Header file for the implementation of a batch of small vectors
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_VECTORBATCH_H_
+#define _BLAZE_MATH_DENSE_VECTORBATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <stdexcept>
+#include <blaze/math/dense/BatchTrait.h>
+#include <blaze/math/dense/StaticVector.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Quaternion.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup vector_batch VectorBatch
+// \ingroup dense_vector
+*/
+/*!\brief Efficient implementation of a batch of small, fixed-size vectors.
+// \ingroup vector_batch
+//
+// The VectorBatch class template represents an array of \a n vectors of the fixed size \a N.
+// In contrast to an array of StaticVector instances, the elements are stored in a blocked
+// structure-of-arrays layout: The vectors are grouped into blocks of as many vectors as fit into
+// a SIMD register (the lanes of a block). Within a block, the first elements of all vectors are
+// stored contiguously, followed by the second elements of all vectors, and so on. Therefore the
+// batch operations (add(), sub(), rotate(), ...) process a complete block of vectors per SIMD
+// instruction, which in contrast to operations on a single 3D vector completely fill the SIMD
+// registers. The type of the elements and the size of the vectors are specified via the two
+// template parameters:
+
+   \code
+   template< typename Type, size_t N >
+   class VectorBatch;
+   \endcode
+
+//  - Type: specifies the type of the vector elements. VectorBatch can only be instantiated for
+//          non-cv-qualified floating point types. Batches of \c float and \c double values are
+//          vectorized.
+//  - N   : specifies the fixed size of the vectors.
+//
+// The individual vectors can be exchanged with StaticVector and Quaternion instances via the
+// set() and get() functions, the elements can be accessed directly via the function call
+// operator:
+
+   \code
+   blaze::VectorBatch<double,3UL> a( 1000UL ), b( 1000UL ), c;
+   blaze::StaticVector<double,3UL> v( 1.0, 2.0, 3.0 );
+
+   a.set( 0UL, v );         // Setting the first vector of a
+   b( 0UL, 2UL ) = 4.0;     // Setting the third element of the first vector of b
+
+   add( a, b, c );          // Batched addition of all vectors of a and b
+   c.get( 0UL, v );         // Extracting the first vector of c
+   \endcode
+
+// The elements of the unused lanes of the last block are not part of the batch. They are
+// processed by the batch operations, but their values are unspecified.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+class VectorBatch
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef BatchTrait<Type>  BT;  //!< Packed element access of the batch.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef VectorBatch<Type,N>  This;            //!< Type of this VectorBatch instance.
+   typedef Type                 ElementType;     //!< Type of the vector elements.
+   typedef Type&                Reference;       //!< Reference to a non-constant vector value.
+   typedef const Type&          ConstReference;  //!< Reference to a constant vector value.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Number of vectors per block.
+   enum { lanes = BT::size };
+
+   //! Number of elements per block.
+   enum { blockSize = N * lanes };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline VectorBatch();
+   explicit inline VectorBatch( size_t n );
+            inline VectorBatch( const VectorBatch& b );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~VectorBatch();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t index, size_t i );
+   inline ConstReference operator()( size_t index, size_t i ) const;
+   inline Type*          data  ();
+   inline const Type*    data  () const;
+   inline Type*          data  ( size_t b );
+   inline const Type*    data  ( size_t b ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline VectorBatch& operator=( const VectorBatch& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const;
+   inline size_t blocks() const;
+   inline void   reset();
+   inline void   resize( size_t n, bool preserve=true );
+   inline void   swap( VectorBatch& b ) /* throw() */;
+
+   template< typename Other, bool TF >
+   inline void set( size_t index, const StaticVector<Other,N,TF>& v );
+
+   template< typename Other >
+   inline void set( size_t index, const Quaternion<Other>& q );
+
+   template< typename Other, bool TF >
+   inline void get( size_t index, StaticVector<Other,N,TF>& v ) const;
+
+   template< typename Other >
+   inline void get( size_t index, Quaternion<Other>& q ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t size_;      //!< The current number of vectors of the batch.
+   size_t blocks_;    //!< The current number of blocks of the batch.
+   size_t capacity_;  //!< The maximum number of blocks of the batch.
+   Type* v_;          //!< The dynamically allocated batch elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST          ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE       ( Type );
+   BLAZE_STATIC_ASSERT( N > 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for VectorBatch.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline VectorBatch<Type,N>::VectorBatch()
+   : size_    ( 0UL )   // The current number of vectors of the batch
+   , blocks_  ( 0UL )   // The current number of blocks of the batch
+   , capacity_( 0UL )   // The maximum number of blocks of the batch
+   , v_       ( NULL )  // The batch elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a batch of \a n vectors.
+//
+// \param n The number of vectors of the batch.
+//
+// All elements of all vectors are initialized to 0.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline VectorBatch<Type,N>::VectorBatch( size_t n )
+   : size_    ( n )                                      // The current number of vectors of the batch
+   , blocks_  ( ( n + lanes - 1UL ) / lanes )            // The current number of blocks of the batch
+   , capacity_( blocks_ )                                // The maximum number of blocks of the batch
+   , v_       ( allocate<Type>( capacity_*blockSize ) )  // The batch elements
+{
+   std::fill( v_, v_+capacity_*blockSize, Type() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for VectorBatch.
+//
+// \param b Batch to be copied.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline VectorBatch<Type,N>::VectorBatch( const VectorBatch& b )
+   : size_    ( b.size_ )                                // The current number of vectors of the batch
+   , blocks_  ( b.blocks_ )                              // The current number of blocks of the batch
+   , capacity_( b.blocks_ )                              // The maximum number of blocks of the batch
+   , v_       ( allocate<Type>( capacity_*blockSize ) )  // The batch elements
+{
+   std::copy( b.v_, b.v_+blocks_*blockSize, v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for VectorBatch.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline VectorBatch<Type,N>::~VectorBatch()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access to a single element of a single vector of the batch.
+//
+// \param index Index of the accessed vector. The index has to be in the range \f$[0..n-1]\f$.
+// \param i Index of the accessed element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline typename VectorBatch<Type,N>::Reference
+   VectorBatch<Type,N>::operator()( size_t index, size_t i )
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid batch access index" );
+   BLAZE_USER_ASSERT( i < N, "Invalid vector access index" );
+   return v_[(index/lanes)*blockSize + i*lanes + index%lanes];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to a single element of a single vector of the batch.
+//
+// \param index Index of the accessed vector. The index has to be in the range \f$[0..n-1]\f$.
+// \param i Index of the accessed element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline typename VectorBatch<Type,N>::ConstReference
+   VectorBatch<Type,N>::operator()( size_t index, size_t i ) const
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid batch access index" );
+   BLAZE_USER_ASSERT( i < N, "Invalid vector access index" );
+   return v_[(index/lanes)*blockSize + i*lanes + index%lanes];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the batch elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the batch. The storage consists
+// of blocks() consecutive blocks of \a blockSize elements each.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline Type* VectorBatch<Type,N>::data()
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the batch elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the batch. The storage consists
+// of blocks() consecutive blocks of \a blockSize elements each.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline const Type* VectorBatch<Type,N>::data() const
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the elements of block \a b.
+//
+// \param b The block index.
+// \return Pointer to the first element of block \a b.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline Type* VectorBatch<Type,N>::data( size_t b )
+{
+   BLAZE_USER_ASSERT( b < blocks_, "Invalid block access index" );
+   return v_ + b*blockSize;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the elements of block \a b.
+//
+// \param b The block index.
+// \return Pointer to the first element of block \a b.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline const Type* VectorBatch<Type,N>::data( size_t b ) const
+{
+   BLAZE_USER_ASSERT( b < blocks_, "Invalid block access index" );
+   return v_ + b*blockSize;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for VectorBatch.
+//
+// \param rhs Batch to be copied.
+// \return Reference to the assigned batch.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline VectorBatch<Type,N>& VectorBatch<Type,N>::operator=( const VectorBatch& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   resize( rhs.size_, false );
+   std::copy( rhs.v_, rhs.v_+blocks_*blockSize, v_ );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of vectors of the batch.
+//
+// \return The number of vectors of the batch.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline size_t VectorBatch<Type,N>::size() const
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of blocks of the batch.
+//
+// \return The number of blocks of the batch.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline size_t VectorBatch<Type,N>::blocks() const
+{
+   return blocks_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline void VectorBatch<Type,N>::reset()
+{
+   std::fill( v_, v_+blocks_*blockSize, Type() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the number of vectors of the batch.
+//
+// \param n The new number of vectors of the batch.
+// \param preserve \a true if the old values of the batch should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the batch to \a n vectors. During this operation, new dynamic memory
+// may be allocated in case the capacity of the batch is too small. Note that this function may
+// invalidate all existing pointers to the batch elements. In case the old values are preserved
+// and the batch is extended, the new vectors are initialized to 0.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline void VectorBatch<Type,N>::resize( size_t n, bool preserve )
+{
+   const size_t newBlocks( ( n + lanes - 1UL ) / lanes );
+
+   if( newBlocks > capacity_ )
+   {
+      Type* tmp = allocate<Type>( newBlocks*blockSize );
+
+      if( preserve ) {
+         std::copy( v_, v_+blocks_*blockSize, tmp );
+         std::fill( tmp+blocks_*blockSize, tmp+newBlocks*blockSize, Type() );
+      }
+      else {
+         std::fill( tmp, tmp+newBlocks*blockSize, Type() );
+      }
+
+      std::swap( v_, tmp );
+      deallocate( tmp );
+      capacity_ = newBlocks;
+   }
+   else if( newBlocks > blocks_ )
+   {
+      std::fill( v_+blocks_*blockSize, v_+newBlocks*blockSize, Type() );
+   }
+
+   if( preserve && n > size_ ) {
+      for( size_t index=size_; index<n && index%lanes!=0UL; ++index )
+         for( size_t i=0UL; i<N; ++i )
+            v_[(index/lanes)*blockSize + i*lanes + index%lanes] = Type();
+   }
+
+   size_   = n;
+   blocks_ = newBlocks;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two batches.
+//
+// \param b The batch to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline void VectorBatch<Type,N>::swap( VectorBatch& b ) /* throw() */
+{
+   std::swap( size_, b.size_ );
+   std::swap( blocks_, b.blocks_ );
+   std::swap( capacity_, b.capacity_ );
+   std::swap( v_, b.v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting a single vector of the batch.
+//
+// \param index Index of the vector. The index has to be in the range \f$[0..n-1]\f$.
+// \param v The new value of the vector.
+// \return void
+*/
+template< typename Type   // Data type of the vectors
+        , size_t N >      // Number of elements of each vector
+template< typename Other  // Data type of the static vector
+        , bool TF >       // Transpose flag of the static vector
+inline void VectorBatch<Type,N>::set( size_t index, const StaticVector<Other,N,TF>& v )
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid batch access index" );
+
+   Type* const p( v_ + (index/lanes)*blockSize + index%lanes );
+   for( size_t i=0UL; i<N; ++i )
+      p[i*lanes] = v[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting a single quaternion of a batch of 4-dimensional vectors.
+//
+// \param index Index of the vector. The index has to be in the range \f$[0..n-1]\f$.
+// \param q The quaternion to be stored in the batch.
+// \return void
+//
+// This function stores the real part of the quaternion in the first and the imaginary parts
+// in the following three elements of the vector. It can only be used for batches of
+// 4-dimensional vectors, which represent batches of quaternions in all quaternion kernels.
+*/
+template< typename Type     // Data type of the vectors
+        , size_t N >        // Number of elements of each vector
+template< typename Other >  // Data type of the quaternion
+inline void VectorBatch<Type,N>::set( size_t index, const Quaternion<Other>& q )
+{
+   BLAZE_STATIC_ASSERT( N == 4UL );
+   BLAZE_USER_ASSERT( index < size_, "Invalid batch access index" );
+
+   Type* const p( v_ + (index/lanes)*blockSize + index%lanes );
+   for( size_t i=0UL; i<4UL; ++i )
+      p[i*lanes] = q[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Extracting a single vector of the batch.
+//
+// \param index Index of the vector. The index has to be in the range \f$[0..n-1]\f$.
+// \param v The static vector for the extracted vector.
+// \return void
+*/
+template< typename Type   // Data type of the vectors
+        , size_t N >      // Number of elements of each vector
+template< typename Other  // Data type of the static vector
+        , bool TF >       // Transpose flag of the static vector
+inline void VectorBatch<Type,N>::get( size_t index, StaticVector<Other,N,TF>& v ) const
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid batch access index" );
+
+   const Type* const p( v_ + (index/lanes)*blockSize + index%lanes );
+   for( size_t i=0UL; i<N; ++i )
+      v[i] = p[i*lanes];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Extracting a single quaternion of a batch of 4-dimensional vectors.
+//
+// \param index Index of the vector. The index has to be in the range \f$[0..n-1]\f$.
+// \param q The quaternion for the extracted vector.
+// \return void
+*/
+template< typename Type     // Data type of the vectors
+        , size_t N >        // Number of elements of each vector
+template< typename Other >  // Data type of the quaternion
+inline void VectorBatch<Type,N>::get( size_t index, Quaternion<Other>& q ) const
+{
+   BLAZE_STATIC_ASSERT( N == 4UL );
+   BLAZE_USER_ASSERT( index < size_, "Invalid batch access index" );
+
+   const Type* const p( v_ + (index/lanes)*blockSize + index%lanes );
+   q.set( p[0UL], p[lanes], p[2UL*lanes], p[3UL*lanes] );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name VectorBatch functions */
+//@{
+template< typename Type, size_t N >
+inline void reset( VectorBatch<Type,N>& b );
+
+template< typename Type, size_t N >
+inline void swap( VectorBatch<Type,N>& a, VectorBatch<Type,N>& b ) /* throw() */;
+
+template< typename Type, size_t N >
+inline void add( const VectorBatch<Type,N>& a, const VectorBatch<Type,N>& b, VectorBatch<Type,N>& c );
+
+template< typename Type, size_t N >
+inline void sub( const VectorBatch<Type,N>& a, const VectorBatch<Type,N>& b, VectorBatch<Type,N>& c );
+
+template< typename Type >
+inline void rotate( const VectorBatch<Type,4UL>& q, const VectorBatch<Type,3UL>& v,
+                    VectorBatch<Type,3UL>& r );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given batch.
+// \ingroup vector_batch
+//
+// \param b The batch to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline void reset( VectorBatch<Type,N>& b )
+{
+   b.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two batches.
+// \ingroup vector_batch
+//
+// \param a The first batch to be swapped.
+// \param b The second batch to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline void swap( VectorBatch<Type,N>& a, VectorBatch<Type,N>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched addition of two batches of vectors (\f$ \vec{c}_k=\vec{a}_k+\vec{b}_k \f$).
+// \ingroup vector_batch
+//
+// \param a The left-hand side batch.
+// \param b The right-hand side batch.
+// \param c The batch for the resulting vectors.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+//
+// The resulting batch \a c is resized to the size of \a a and \a b. It may be one of the
+// operands.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline void add( const VectorBatch<Type,N>& a, const VectorBatch<Type,N>& b, VectorBatch<Type,N>& c )
+{
+   typedef BatchTrait<Type>  BT;
+
+   if( a.size() != b.size() )
+      throw std::invalid_argument( "Batch sizes do not match" );
+
+   c.resize( a.size(), false );
+
+   const size_t elements( a.blocks() * VectorBatch<Type,N>::blockSize );
+   const Type* pa( a.data() );
+   const Type* pb( b.data() );
+   Type* pc( c.data() );
+
+   for( size_t i=0UL; i<elements; i+=BT::size )
+      BT::store( pc+i, BT::load( pa+i ) + BT::load( pb+i ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched subtraction of two batches of vectors (\f$ \vec{c}_k=\vec{a}_k-\vec{b}_k \f$).
+// \ingroup vector_batch
+//
+// \param a The left-hand side batch.
+// \param b The right-hand side batch.
+// \param c The batch for the resulting vectors.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+//
+// The resulting batch \a c is resized to the size of \a a and \a b. It may be one of the
+// operands.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline void sub( const VectorBatch<Type,N>& a, const VectorBatch<Type,N>& b, VectorBatch<Type,N>& c )
+{
+   typedef BatchTrait<Type>  BT;
+
+   if( a.size() != b.size() )
+      throw std::invalid_argument( "Batch sizes do not match" );
+
+   c.resize( a.size(), false );
+
+   const size_t elements( a.blocks() * VectorBatch<Type,N>::blockSize );
+   const Type* pa( a.data() );
+   const Type* pb( b.data() );
+   Type* pc( c.data() );
+
+   for( size_t i=0UL; i<elements; i+=BT::size )
+      BT::store( pc+i, BT::load( pa+i ) - BT::load( pb+i ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched rotation of a batch of vectors by a batch of quaternions.
+// \ingroup vector_batch
+//
+// \param q The batch of unit quaternions (see VectorBatch::set()).
+// \param v The batch of vectors to be rotated.
+// \param r The batch for the rotated vectors.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+//
+// This function rotates each vector of \a v by the corresponding quaternion of \a q in the
+// same way as the Quaternion::rotate() function. The resulting batch \a r is resized to the
+// size of \a q and \a v. Since the result of each block is computed before it is stored, \a r
+// may be the same batch as \a v.
+*/
+template< typename Type >  // Data type of the quaternions and vectors
+inline void rotate( const VectorBatch<Type,4UL>& q, const VectorBatch<Type,3UL>& v,
+                    VectorBatch<Type,3UL>& r )
+{
+   typedef BatchTrait<Type>         BT;
+   typedef typename BT::PackType    PackType;
+
+   const size_t L( BT::size );
+
+   if( q.size() != v.size() )
+      throw std::invalid_argument( "Batch sizes do not match" );
+
+   r.resize( q.size(), false );
+
+   for( size_t b=0UL; b<q.blocks(); ++b )
+   {
+      const Type* const pq( q.data(b) );
+      const Type* const pv( v.data(b) );
+
+      const PackType q0( BT::load( pq     ) );
+      const PackType q1( BT::load( pq+  L ) );
+      const PackType q2( BT::load( pq+2*L ) );
+      const PackType q3( BT::load( pq+3*L ) );
+      const PackType v0( BT::load( pv     ) );
+      const PackType v1( BT::load( pv+  L ) );
+      const PackType v2( BT::load( pv+2*L ) );
+
+      // Multiplication in two steps
+      const PackType w( q1*v0 + q2*v1 + q3*v2 );
+      const PackType x( q0*v0 - q3*v1 + q2*v2 );
+      const PackType y( q0*v1 - q1*v2 + q3*v0 );
+      const PackType z( q0*v2 - q2*v0 + q1*v1 );
+
+      Type* const pr( r.data(b) );
+
+      BT::store( pr    , q0*x + q1*w + q2*z - q3*y );
+      BT::store( pr+  L, q0*y + q2*w + q3*x - q1*z );
+      BT::store( pr+2*L, q0*z + q3*w + q1*y - q2*x );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -45,6 +45,8 @@
 #include <blaze/math/constraints/DenseMatrix.h>
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/dense/MatrixChain.h>
+#include <blaze/math/dense/MMM.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DenseVector.h>
@@ -87,6 +89,7 @@
 #include <blaze/math/typetraits/Rows.h>
 #include <blaze/system/BLAS.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/util/Arena.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/constraints/Numeric.h>
@@ -499,6 +502,11 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
          return;
       }
 
+      if( reorderChain<ChainAssign>( ~lhs, rhs.lhs_, rhs.rhs_ ) ) {
+         return;
+      }
+
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -661,14 +669,14 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 + a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 + a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 + a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 + a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -702,14 +710,14 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C).store( i    , j             , xmm1 );
@@ -732,10 +740,10 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -763,10 +771,10 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i    , j         , xmm1 );
@@ -785,8 +793,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j         );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+               xmm1 = fmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
             (~C).store( i, j         , xmm1 );
@@ -808,8 +816,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 + set( A(i+1UL,k) ) * b1;
+               xmm1 = fmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
             (~C).store( i    , j, xmm1 );
@@ -824,7 +832,7 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + set( A(i,k) ) * B.load(k,j);
+               xmm1 = fmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -923,8 +931,7 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(1), false );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -940,8 +947,9 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function relays to the default implementation of the assignment of a small dense
-   // matrix-dense matrix multiplication expression to a column-major dense matrix.
+   // This function implements the vectorized default assignment of a dense matrix-dense matrix
+   // multiplication expression to a column-major dense matrix. This kernel is optimized for large
+   // matrices.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -949,7 +957,7 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      selectSmallAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(1), false );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1235,6 +1243,11 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
          return;
       }
 
+      if( reorderChain<ChainAddAssign>( ~lhs, rhs.lhs_, rhs.rhs_ ) ) {
+         return;
+      }
+
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -1398,14 +1411,14 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 + a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 + a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 + a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 + a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -1446,14 +1459,14 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C).store( i    , j             , xmm1 );
@@ -1479,10 +1492,10 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -1513,10 +1526,10 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i    , j         , xmm1 );
@@ -1536,8 +1549,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j         );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+               xmm1 = fmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
             (~C).store( i, j         , xmm1 );
@@ -1560,8 +1573,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 + set( A(i+1UL,k) ) * b1;
+               xmm1 = fmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
             (~C).store( i    , j, xmm1 );
@@ -1576,7 +1589,7 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
             IntrinsicType xmm1( (~C).load(i,j) );
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + set( A(i,k) ) * B.load(k,j);
+               xmm1 = fmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -1676,8 +1689,7 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(1), true );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1693,8 +1705,9 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function relays to the default implementation of the addition assignment of a small
-   // dense matrix-dense matrix multiplication expression to a column-major dense matrix.
+   // This function implements the vectorized default addition assignment of a dense matrix-dense
+   // matrix multiplication expression to a column-major dense matrix. This kernel is optimized for
+   // large matrices.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -1702,7 +1715,7 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      selectSmallAddAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(1), true );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1963,6 +1976,11 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
          return;
       }
 
+      if( reorderChain<ChainSubAssign>( ~lhs, rhs.lhs_, rhs.rhs_ ) ) {
+         return;
+      }
+
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -2126,14 +2144,14 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 - a1 * B.load(k,j             );
-               xmm2 = xmm2 - a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 - a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 - a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 - a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 - a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 - a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 - a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fnmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fnmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fnmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fnmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fnmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fnmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fnmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fnmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -2174,14 +2192,14 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 - a1 * b1;
-               xmm2 = xmm2 - a1 * b2;
-               xmm3 = xmm3 - a1 * b3;
-               xmm4 = xmm4 - a1 * b4;
-               xmm5 = xmm5 - a2 * b1;
-               xmm6 = xmm6 - a2 * b2;
-               xmm7 = xmm7 - a2 * b3;
-               xmm8 = xmm8 - a2 * b4;
+               xmm1 = fnmadd( a1, b1, xmm1 );
+               xmm2 = fnmadd( a1, b2, xmm2 );
+               xmm3 = fnmadd( a1, b3, xmm3 );
+               xmm4 = fnmadd( a1, b4, xmm4 );
+               xmm5 = fnmadd( a2, b1, xmm5 );
+               xmm6 = fnmadd( a2, b2, xmm6 );
+               xmm7 = fnmadd( a2, b3, xmm7 );
+               xmm8 = fnmadd( a2, b4, xmm8 );
             }
 
             (~C).store( i    , j             , xmm1 );
@@ -2207,10 +2225,10 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 - a1 * B.load(k,j             );
-               xmm2 = xmm2 - a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 - a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 - a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fnmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fnmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fnmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fnmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -2241,10 +2259,10 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 - a1 * b1;
-               xmm2 = xmm2 - a1 * b2;
-               xmm3 = xmm3 - a2 * b1;
-               xmm4 = xmm4 - a2 * b2;
+               xmm1 = fnmadd( a1, b1, xmm1 );
+               xmm2 = fnmadd( a1, b2, xmm2 );
+               xmm3 = fnmadd( a2, b1, xmm3 );
+               xmm4 = fnmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i    , j         , xmm1 );
@@ -2264,8 +2282,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 - a1 * B.load(k,j         );
-               xmm2 = xmm2 - a1 * B.load(k,j+IT::size);
+               xmm1 = fnmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fnmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
             (~C).store( i, j         , xmm1 );
@@ -2288,8 +2306,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 - set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 - set( A(i+1UL,k) ) * b1;
+               xmm1 = fnmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fnmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
             (~C).store( i    , j, xmm1 );
@@ -2304,7 +2322,7 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
             IntrinsicType xmm1( (~C).load(i,j) );
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 - set( A(i,k) ) * B.load(k,j);
+               xmm1 = fnmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -2404,8 +2422,7 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(-1), true );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2421,8 +2438,9 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function relays to the default implementation of the subtraction assignment of a small
-   // dense matrix-dense matrix multiplication expression to a column-major dense matrix.
+   // This function implements the vectorized default subtraction assignment of a dense matrix-dense
+   // matrix multiplication expression to a column-major dense matrix. This kernel is optimized for
+   // large matrices.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -2430,7 +2448,7 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      selectSmallSubAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(-1), true );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2705,6 +2723,11 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
          return;
       }
 
+      if( reorderChain<ChainSMPAssign>( ~lhs, rhs.lhs_, rhs.rhs_ ) ) {
+         return;
+      }
+
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -2826,6 +2849,11 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
          return;
       }
 
+      if( reorderChain<ChainSMPAddAssign>( ~lhs, rhs.lhs_, rhs.rhs_ ) ) {
+         return;
+      }
+
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -2911,6 +2939,11 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
          return;
       }
 
+      if( reorderChain<ChainSMPSubAssign>( ~lhs, rhs.lhs_, rhs.rhs_ ) ) {
+         return;
+      }
+
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -3353,6 +3386,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -3527,14 +3561,14 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 + a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 + a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 + a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 + a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
             (~C).store( i, j             , xmm1 * factor );
@@ -3568,14 +3602,14 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C).store( i    , j             , xmm1 * factor );
@@ -3598,10 +3632,10 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
             (~C).store( i, j             , xmm1 * factor );
@@ -3629,10 +3663,10 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i    , j         , xmm1 * factor );
@@ -3651,8 +3685,8 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j         );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+               xmm1 = fmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
             (~C).store( i, j         , xmm1 * factor );
@@ -3674,8 +3708,8 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 + set( A(i+1UL,k) ) * b1;
+               xmm1 = fmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
             (~C).store( i    , j, xmm1 * factor );
@@ -3690,7 +3724,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + set( A(i,k) ) * B.load(k,j);
+               xmm1 = fmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
             (~C).store( i, j, xmm1 * factor );
@@ -3790,8 +3824,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, scalar, false );
    }
    //**********************************************************************************************
 
@@ -3806,8 +3839,9 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function relays to the default implementation of the assignment of a small scaled
-   // dense matrix-dense matrix multiplication expression to a column-major dense matrix.
+   // This function implements the vectorized default assignment of a scaled dense matrix-dense
+   // matrix multiplication expression to a column-major dense matrix. This kernel is optimized for
+   // large matrices.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -3816,7 +3850,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      selectSmallAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, scalar, false );
    }
    //**********************************************************************************************
 
@@ -4103,6 +4137,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -4235,24 +4270,24 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 + a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 + a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 + a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 + a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
-            (~C).store( i, j             , (~C).load(i,j             ) + xmm1 * factor );
-            (~C).store( i, j+IT::size    , (~C).load(i,j+IT::size    ) + xmm2 * factor );
-            (~C).store( i, j+IT::size*2UL, (~C).load(i,j+IT::size*2UL) + xmm3 * factor );
-            (~C).store( i, j+IT::size*3UL, (~C).load(i,j+IT::size*3UL) + xmm4 * factor );
-            (~C).store( i, j+IT::size*4UL, (~C).load(i,j+IT::size*4UL) + xmm5 * factor );
-            (~C).store( i, j+IT::size*5UL, (~C).load(i,j+IT::size*5UL) + xmm6 * factor );
-            (~C).store( i, j+IT::size*6UL, (~C).load(i,j+IT::size*6UL) + xmm7 * factor );
-            (~C).store( i, j+IT::size*7UL, (~C).load(i,j+IT::size*7UL) + xmm8 * factor );
+            (~C).store( i, j             , fmadd( xmm1, factor, (~C).load(i,j             ) ) );
+            (~C).store( i, j+IT::size    , fmadd( xmm2, factor, (~C).load(i,j+IT::size    ) ) );
+            (~C).store( i, j+IT::size*2UL, fmadd( xmm3, factor, (~C).load(i,j+IT::size*2UL) ) );
+            (~C).store( i, j+IT::size*3UL, fmadd( xmm4, factor, (~C).load(i,j+IT::size*3UL) ) );
+            (~C).store( i, j+IT::size*4UL, fmadd( xmm5, factor, (~C).load(i,j+IT::size*4UL) ) );
+            (~C).store( i, j+IT::size*5UL, fmadd( xmm6, factor, (~C).load(i,j+IT::size*5UL) ) );
+            (~C).store( i, j+IT::size*6UL, fmadd( xmm7, factor, (~C).load(i,j+IT::size*6UL) ) );
+            (~C).store( i, j+IT::size*7UL, fmadd( xmm8, factor, (~C).load(i,j+IT::size*7UL) ) );
          }
       }
 
@@ -4276,24 +4311,24 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
-            (~C).store( i    , j             , (~C).load(i    ,j             ) + xmm1 * factor );
-            (~C).store( i    , j+IT::size    , (~C).load(i    ,j+IT::size    ) + xmm2 * factor );
-            (~C).store( i    , j+IT::size*2UL, (~C).load(i    ,j+IT::size*2UL) + xmm3 * factor );
-            (~C).store( i    , j+IT::size*3UL, (~C).load(i    ,j+IT::size*3UL) + xmm4 * factor );
-            (~C).store( i+1UL, j             , (~C).load(i+1UL,j             ) + xmm5 * factor );
-            (~C).store( i+1UL, j+IT::size    , (~C).load(i+1UL,j+IT::size    ) + xmm6 * factor );
-            (~C).store( i+1UL, j+IT::size*2UL, (~C).load(i+1UL,j+IT::size*2UL) + xmm7 * factor );
-            (~C).store( i+1UL, j+IT::size*3UL, (~C).load(i+1UL,j+IT::size*3UL) + xmm8 * factor );
+            (~C).store( i    , j             , fmadd( xmm1, factor, (~C).load(i    ,j             ) ) );
+            (~C).store( i    , j+IT::size    , fmadd( xmm2, factor, (~C).load(i    ,j+IT::size    ) ) );
+            (~C).store( i    , j+IT::size*2UL, fmadd( xmm3, factor, (~C).load(i    ,j+IT::size*2UL) ) );
+            (~C).store( i    , j+IT::size*3UL, fmadd( xmm4, factor, (~C).load(i    ,j+IT::size*3UL) ) );
+            (~C).store( i+1UL, j             , fmadd( xmm5, factor, (~C).load(i+1UL,j             ) ) );
+            (~C).store( i+1UL, j+IT::size    , fmadd( xmm6, factor, (~C).load(i+1UL,j+IT::size    ) ) );
+            (~C).store( i+1UL, j+IT::size*2UL, fmadd( xmm7, factor, (~C).load(i+1UL,j+IT::size*2UL) ) );
+            (~C).store( i+1UL, j+IT::size*3UL, fmadd( xmm8, factor, (~C).load(i+1UL,j+IT::size*3UL) ) );
          }
 
          if( i < M )
@@ -4306,16 +4341,16 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
-            (~C).store( i, j             , (~C).load(i,j             ) + xmm1 * factor );
-            (~C).store( i, j+IT::size    , (~C).load(i,j+IT::size    ) + xmm2 * factor );
-            (~C).store( i, j+IT::size*2UL, (~C).load(i,j+IT::size*2UL) + xmm3 * factor );
-            (~C).store( i, j+IT::size*3UL, (~C).load(i,j+IT::size*3UL) + xmm4 * factor );
+            (~C).store( i, j             , fmadd( xmm1, factor, (~C).load(i,j             ) ) );
+            (~C).store( i, j+IT::size    , fmadd( xmm2, factor, (~C).load(i,j+IT::size    ) ) );
+            (~C).store( i, j+IT::size*2UL, fmadd( xmm3, factor, (~C).load(i,j+IT::size*2UL) ) );
+            (~C).store( i, j+IT::size*3UL, fmadd( xmm4, factor, (~C).load(i,j+IT::size*3UL) ) );
          }
       }
 
@@ -4337,15 +4372,15 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
-            (~C).store( i    , j         , (~C).load(i    ,j         ) + xmm1 * factor );
-            (~C).store( i    , j+IT::size, (~C).load(i    ,j+IT::size) + xmm2 * factor );
-            (~C).store( i+1UL, j         , (~C).load(i+1UL,j         ) + xmm3 * factor );
-            (~C).store( i+1UL, j+IT::size, (~C).load(i+1UL,j+IT::size) + xmm4 * factor );
+            (~C).store( i    , j         , fmadd( xmm1, factor, (~C).load(i    ,j         ) ) );
+            (~C).store( i    , j+IT::size, fmadd( xmm2, factor, (~C).load(i    ,j+IT::size) ) );
+            (~C).store( i+1UL, j         , fmadd( xmm3, factor, (~C).load(i+1UL,j         ) ) );
+            (~C).store( i+1UL, j+IT::size, fmadd( xmm4, factor, (~C).load(i+1UL,j+IT::size) ) );
          }
 
          if( i < M )
@@ -4358,12 +4393,12 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j         );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+               xmm1 = fmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
-            (~C).store( i, j         , (~C).load(i,j         ) + xmm1 * factor );
-            (~C).store( i, j+IT::size, (~C).load(i,j+IT::size) + xmm2 * factor );
+            (~C).store( i, j         , fmadd( xmm1, factor, (~C).load(i,j         ) ) );
+            (~C).store( i, j+IT::size, fmadd( xmm2, factor, (~C).load(i,j+IT::size) ) );
          }
       }
 
@@ -4381,12 +4416,12 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 + set( A(i+1UL,k) ) * b1;
+               xmm1 = fmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
-            (~C).store( i    , j, (~C).load(i    ,j) + xmm1 * factor );
-            (~C).store( i+1UL, j, (~C).load(i+1UL,j) + xmm2 * factor );
+            (~C).store( i    , j, fmadd( xmm1, factor, (~C).load(i    ,j) ) );
+            (~C).store( i+1UL, j, fmadd( xmm2, factor, (~C).load(i+1UL,j) ) );
          }
 
          if( i < M )
@@ -4397,10 +4432,10 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + set( A(i,k) ) * B.load(k,j);
+               xmm1 = fmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
-            (~C).store( i, j, (~C).load(i,j) + xmm1 * factor );
+            (~C).store( i, j, fmadd( xmm1, factor, (~C).load(i,j) ) );
          }
       }
    }
@@ -4497,8 +4532,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, scalar, true );
    }
    //**********************************************************************************************
 
@@ -4513,8 +4547,9 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function relays to the default implementation of the addition assignment of a small
-   // scaled dense matrix-dense matrix multiplication expression to a column-major dense matrix.
+   // This function implements the vectorized default addition assignment of a scaled dense
+   // matrix-dense matrix multiplication expression to a column-major dense matrix. This kernel is
+   // optimized for large matrices.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -4523,7 +4558,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      selectSmallAddAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, scalar, true );
    }
    //**********************************************************************************************
 
@@ -4786,6 +4821,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -4918,24 +4954,24 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 + a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 + a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 + a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 + a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
-            (~C).store( i, j             , (~C).load(i,j             ) - xmm1 * factor );
-            (~C).store( i, j+IT::size    , (~C).load(i,j+IT::size    ) - xmm2 * factor );
-            (~C).store( i, j+IT::size*2UL, (~C).load(i,j+IT::size*2UL) - xmm3 * factor );
-            (~C).store( i, j+IT::size*3UL, (~C).load(i,j+IT::size*3UL) - xmm4 * factor );
-            (~C).store( i, j+IT::size*4UL, (~C).load(i,j+IT::size*4UL) - xmm5 * factor );
-            (~C).store( i, j+IT::size*5UL, (~C).load(i,j+IT::size*5UL) - xmm6 * factor );
-            (~C).store( i, j+IT::size*6UL, (~C).load(i,j+IT::size*6UL) - xmm7 * factor );
-            (~C).store( i, j+IT::size*7UL, (~C).load(i,j+IT::size*7UL) - xmm8 * factor );
+            (~C).store( i, j             , fnmadd( xmm1, factor, (~C).load(i,j             ) ) );
+            (~C).store( i, j+IT::size    , fnmadd( xmm2, factor, (~C).load(i,j+IT::size    ) ) );
+            (~C).store( i, j+IT::size*2UL, fnmadd( xmm3, factor, (~C).load(i,j+IT::size*2UL) ) );
+            (~C).store( i, j+IT::size*3UL, fnmadd( xmm4, factor, (~C).load(i,j+IT::size*3UL) ) );
+            (~C).store( i, j+IT::size*4UL, fnmadd( xmm5, factor, (~C).load(i,j+IT::size*4UL) ) );
+            (~C).store( i, j+IT::size*5UL, fnmadd( xmm6, factor, (~C).load(i,j+IT::size*5UL) ) );
+            (~C).store( i, j+IT::size*6UL, fnmadd( xmm7, factor, (~C).load(i,j+IT::size*6UL) ) );
+            (~C).store( i, j+IT::size*7UL, fnmadd( xmm8, factor, (~C).load(i,j+IT::size*7UL) ) );
          }
       }
 
@@ -4959,24 +4995,24 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
-            (~C).store( i    , j             , (~C).load(i    ,j             ) - xmm1 * factor );
-            (~C).store( i    , j+IT::size    , (~C).load(i    ,j+IT::size    ) - xmm2 * factor );
-            (~C).store( i    , j+IT::size*2UL, (~C).load(i    ,j+IT::size*2UL) - xmm3 * factor );
-            (~C).store( i    , j+IT::size*3UL, (~C).load(i    ,j+IT::size*3UL) - xmm4 * factor );
-            (~C).store( i+1UL, j             , (~C).load(i+1UL,j             ) - xmm5 * factor );
-            (~C).store( i+1UL, j+IT::size    , (~C).load(i+1UL,j+IT::size    ) - xmm6 * factor );
-            (~C).store( i+1UL, j+IT::size*2UL, (~C).load(i+1UL,j+IT::size*2UL) - xmm7 * factor );
-            (~C).store( i+1UL, j+IT::size*3UL, (~C).load(i+1UL,j+IT::size*3UL) - xmm8 * factor );
+            (~C).store( i    , j             , fnmadd( xmm1, factor, (~C).load(i    ,j             ) ) );
+            (~C).store( i    , j+IT::size    , fnmadd( xmm2, factor, (~C).load(i    ,j+IT::size    ) ) );
+            (~C).store( i    , j+IT::size*2UL, fnmadd( xmm3, factor, (~C).load(i    ,j+IT::size*2UL) ) );
+            (~C).store( i    , j+IT::size*3UL, fnmadd( xmm4, factor, (~C).load(i    ,j+IT::size*3UL) ) );
+            (~C).store( i+1UL, j             , fnmadd( xmm5, factor, (~C).load(i+1UL,j             ) ) );
+            (~C).store( i+1UL, j+IT::size    , fnmadd( xmm6, factor, (~C).load(i+1UL,j+IT::size    ) ) );
+            (~C).store( i+1UL, j+IT::size*2UL, fnmadd( xmm7, factor, (~C).load(i+1UL,j+IT::size*2UL) ) );
+            (~C).store( i+1UL, j+IT::size*3UL, fnmadd( xmm8, factor, (~C).load(i+1UL,j+IT::size*3UL) ) );
          }
 
          if( i < M )
@@ -4989,16 +5025,16 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
-            (~C).store( i, j             , (~C).load(i,j             ) - xmm1 * factor );
-            (~C).store( i, j+IT::size    , (~C).load(i,j+IT::size    ) - xmm2 * factor );
-            (~C).store( i, j+IT::size*2UL, (~C).load(i,j+IT::size*2UL) - xmm3 * factor );
-            (~C).store( i, j+IT::size*3UL, (~C).load(i,j+IT::size*3UL) - xmm4 * factor );
+            (~C).store( i, j             , fnmadd( xmm1, factor, (~C).load(i,j             ) ) );
+            (~C).store( i, j+IT::size    , fnmadd( xmm2, factor, (~C).load(i,j+IT::size    ) ) );
+            (~C).store( i, j+IT::size*2UL, fnmadd( xmm3, factor, (~C).load(i,j+IT::size*2UL) ) );
+            (~C).store( i, j+IT::size*3UL, fnmadd( xmm4, factor, (~C).load(i,j+IT::size*3UL) ) );
          }
       }
 
@@ -5020,16 +5056,16 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
-            (~C).store( i    , j         , (~C).load(i    ,j         ) - xmm1 * factor );
-            (~C).store( i    , j+IT::size, (~C).load(i    ,j+IT::size) - xmm2 * factor );
-            (~C).store( i+1UL, j         , (~C).load(i+1UL,j         ) - xmm3 * factor );
-            (~C).store( i+1UL, j+IT::size, (~C).load(i+1UL,j+IT::size) - xmm4 * factor );
+            (~C).store( i    , j         , fnmadd( xmm1, factor, (~C).load(i    ,j         ) ) );
+            (~C).store( i    , j+IT::size, fnmadd( xmm2, factor, (~C).load(i    ,j+IT::size) ) );
+            (~C).store( i+1UL, j         , fnmadd( xmm3, factor, (~C).load(i+1UL,j         ) ) );
+            (~C).store( i+1UL, j+IT::size, fnmadd( xmm4, factor, (~C).load(i+1UL,j+IT::size) ) );
          }
 
          if( i < M )
@@ -5042,12 +5078,12 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j         );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+               xmm1 = fmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
-            (~C).store( i, j         , (~C).load(i,j         ) - xmm1 * factor );
-            (~C).store( i, j+IT::size, (~C).load(i,j+IT::size) - xmm2 * factor );
+            (~C).store( i, j         , fnmadd( xmm1, factor, (~C).load(i,j         ) ) );
+            (~C).store( i, j+IT::size, fnmadd( xmm2, factor, (~C).load(i,j+IT::size) ) );
          }
       }
 
@@ -5065,12 +5101,12 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 + set( A(i+1UL,k) ) * b1;
+               xmm1 = fmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
-            (~C).store( i    , j, (~C).load(i    ,j) - xmm1 * factor );
-            (~C).store( i+1UL, j, (~C).load(i+1UL,j) - xmm2 * factor );
+            (~C).store( i    , j, fnmadd( xmm1, factor, (~C).load(i    ,j) ) );
+            (~C).store( i+1UL, j, fnmadd( xmm2, factor, (~C).load(i+1UL,j) ) );
          }
 
          if( i < M )
@@ -5081,10 +5117,10 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + set( A(i,k) ) * B.load(k,j);
+               xmm1 = fmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
-            (~C).store( i, j, (~C).load(i,j) - xmm1 * factor );
+            (~C).store( i, j, fnmadd( xmm1, factor, (~C).load(i,j) ) );
          }
       }
    }
@@ -5180,8 +5216,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, -scalar, true );
    }
    //**********************************************************************************************
 
@@ -5196,8 +5231,9 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    // \param scalar The scaling factor.
    // \return void
    //
-   // This function relays to the default implementation of the subtraction assignment of a small
-   // scaled dense matrix-dense matrix multiplication expression to a column-major dense matrix.
+   // This function implements the vectorized default subtraction assignment of a scaled dense
+   // matrix-dense matrix multiplication expression to a column-major dense matrix. This kernel is
+   // optimized for large matrices.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
@@ -5206,7 +5242,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      selectSmallSubAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, -scalar, true );
    }
    //**********************************************************************************************
 
@@ -5484,6 +5520,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
       RT B( right );  // Evaluation of the right-hand side dense matrix operand
 
@@ -5606,6 +5643,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
       RT B( right );  // Evaluation of the right-hand side dense matrix operand
 
@@ -5693,6 +5731,7 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2>, ST, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
       RT B( right );  // Evaluation of the right-hand side dense matrix operand
 
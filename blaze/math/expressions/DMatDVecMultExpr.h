@@ -74,6 +74,7 @@
 #include <blaze/math/typetraits/Size.h>
 #include <blaze/system/BLAS.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/util/Arena.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/constraints/Reference.h>
@@ -452,6 +453,7 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( rhs.mat_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT x( serial( rhs.vec_ ) );  // Evaluation of the right-hand side dense vector operand
 
@@ -576,14 +578,14 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+7UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+7UL,j), x1, xmm8 );
          }
 
          y[i    ] = sum( xmm1 );
@@ -606,10 +608,10 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
          }
 
          y[i    ] = sum( xmm1 );
@@ -628,9 +630,9 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
          }
 
          y[i    ] = sum( xmm1 );
@@ -648,8 +650,8 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
          }
 
          y[i    ] = sum( xmm1 );
@@ -665,7 +667,7 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(j);
+            xmm1 = fmadd( A.load(i,j), x.load(j), xmm1 );
          }
 
          y[i] = sum( xmm1 );
@@ -1099,6 +1101,7 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( rhs.mat_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT x( serial( rhs.vec_ ) );  // Evaluation of the right-hand side dense vector operand
 
@@ -1223,14 +1226,14 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+7UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+7UL,j), x1, xmm8 );
          }
 
          y[i    ] += sum( xmm1 );
@@ -1253,10 +1256,10 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
          }
 
          y[i    ] += sum( xmm1 );
@@ -1275,9 +1278,9 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
          }
 
          y[i    ] += sum( xmm1 );
@@ -1295,8 +1298,8 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
          }
 
          y[i    ] += sum( xmm1 );
@@ -1312,7 +1315,7 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(j);
+            xmm1 = fmadd( A.load(i,j), x.load(j), xmm1 );
          }
 
          y[i] += sum( xmm1 );
@@ -1722,6 +1725,7 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( rhs.mat_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT x( serial( rhs.vec_ ) );  // Evaluation of the right-hand side dense vector operand
 
@@ -1846,14 +1850,14 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+7UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+7UL,j), x1, xmm8 );
          }
 
          y[i    ] -= sum( xmm1 );
@@ -1876,10 +1880,10 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
          }
 
          y[i    ] -= sum( xmm1 );
@@ -1898,9 +1902,9 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
          }
 
          y[i    ] -= sum( xmm1 );
@@ -1918,8 +1922,8 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
          }
 
          y[i    ] -= sum( xmm1 );
@@ -1935,7 +1939,7 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(j);
+            xmm1 = fmadd( A.load(i,j), x.load(j), xmm1 );
          }
 
          y[i] -= sum( xmm1 );
@@ -2386,6 +2390,7 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( rhs.mat_ );  // Evaluation of the left-hand side dense matrix operand
       RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
 
@@ -2459,6 +2464,7 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( rhs.mat_ );  // Evaluation of the left-hand side dense matrix operand
       RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
 
@@ -2503,6 +2509,7 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( rhs.mat_ );  // Evaluation of the left-hand side dense matrix operand
       RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
 
@@ -2907,6 +2914,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
       RT x( serial( right ) );  // Evaluation of the right-hand side dense vector operand
 
@@ -3032,14 +3040,14 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+7UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+7UL,j), x1, xmm8 );
          }
 
          y[i    ] = sum( xmm1 ) * scalar;
@@ -3062,10 +3070,10 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
          }
 
          y[i    ] = sum( xmm1 ) * scalar;
@@ -3084,9 +3092,9 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
          }
 
          y[i    ] = sum( xmm1 ) * scalar;
@@ -3104,8 +3112,8 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
          }
 
          y[i    ] = sum( xmm1 ) * scalar;
@@ -3121,7 +3129,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(j);
+            xmm1 = fmadd( A.load(i,j), x.load(j), xmm1 );
          }
 
          y[i] = sum( xmm1 ) * scalar;
@@ -3573,6 +3581,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
       RT x( serial( right ) );  // Evaluation of the right-hand side dense vector operand
 
@@ -3697,14 +3706,14 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+7UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+7UL,j), x1, xmm8 );
          }
 
          y[i    ] += sum( xmm1 ) * scalar;
@@ -3727,10 +3736,10 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
          }
 
          y[i    ] += sum( xmm1 ) * scalar;
@@ -3749,9 +3758,9 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
          }
 
          y[i    ] += sum( xmm1 ) * scalar;
@@ -3769,8 +3778,8 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
          }
 
          y[i    ] += sum( xmm1 ) * scalar;
@@ -3786,7 +3795,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(j);
+            xmm1 = fmadd( A.load(i,j), x.load(j), xmm1 );
          }
 
          y[i] += sum( xmm1 ) * scalar;
@@ -4197,6 +4206,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
       RT x( serial( right ) );  // Evaluation of the right-hand side dense vector operand
 
@@ -4321,14 +4331,14 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+7UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+7UL,j), x1, xmm8 );
          }
 
          y[i    ] -= sum( xmm1 ) * scalar;
@@ -4351,10 +4361,10 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+3UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+3UL,j), x1, xmm4 );
          }
 
          y[i    ] -= sum( xmm1 ) * scalar;
@@ -4373,9 +4383,9 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
-            xmm3 = xmm3 + A.load(i+2UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+2UL,j), x1, xmm3 );
          }
 
          y[i    ] -= sum( xmm1 ) * scalar;
@@ -4393,8 +4403,8 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
             const IntrinsicType x1( x.load(j) );
-            xmm1 = xmm1 + A.load(i    ,j) * x1;
-            xmm2 = xmm2 + A.load(i+1UL,j) * x1;
+            xmm1 = fmadd( A.load(i    ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+1UL,j), x1, xmm2 );
          }
 
          y[i    ] -= sum( xmm1 ) * scalar;
@@ -4410,7 +4420,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; j+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(j);
+            xmm1 = fmadd( A.load(i,j), x.load(j), xmm1 );
          }
 
          y[i] -= sum( xmm1 ) * scalar;
@@ -4860,6 +4870,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
       RT x( right );  // Evaluation of the right-hand side dense vector operand
 
@@ -4932,6 +4943,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
       RT x( right );  // Evaluation of the right-hand side dense vector operand
 
@@ -4977,6 +4989,7 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
       RT x( right );  // Evaluation of the right-hand side dense vector operand
 
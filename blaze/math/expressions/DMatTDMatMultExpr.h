@@ -45,6 +45,8 @@
 #include <blaze/math/constraints/DenseMatrix.h>
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/dense/MatrixChain.h>
+#include <blaze/math/dense/MMM.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
@@ -87,6 +89,7 @@
 #include <blaze/math/typetraits/Rows.h>
 #include <blaze/system/BLAS.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/util/Arena.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/constraints/Numeric.h>
@@ -480,6 +483,11 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
          return;
       }
 
+      if( reorderChain<ChainAssign>( ~lhs, rhs.lhs_, rhs.rhs_ ) ) {
+         return;
+      }
+
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -639,14 +647,14 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType b2( B.load(k,j+1UL) );
                const IntrinsicType b3( B.load(k,j+2UL) );
                const IntrinsicType b4( B.load(k,j+3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 );
@@ -673,10 +681,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 );
@@ -695,8 +703,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) = sum( xmm1 );
@@ -718,10 +726,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
-               xmm3 = xmm3 + a1 * B.load(k,j+2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+3UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+3UL), xmm4 );
             }
 
             (~C)(i,j    ) = sum( xmm1 );
@@ -740,8 +748,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) = sum( xmm1 );
@@ -756,7 +764,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) = sum( xmm1 );
@@ -815,14 +823,14 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a4( A.load(i+3UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
-               xmm5 = xmm5 + a3 * b1;
-               xmm6 = xmm6 + a3 * b2;
-               xmm7 = xmm7 + a4 * b1;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
+               xmm5 = fmadd( a3, b1, xmm5 );
+               xmm6 = fmadd( a3, b2, xmm6 );
+               xmm7 = fmadd( a4, b1, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 );
@@ -845,10 +853,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
-               xmm3 = xmm3 + A.load(i+2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+3UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+3UL,k), b1, xmm4 );
             }
 
             (~C)(i    ,j) = sum( xmm1 );
@@ -876,10 +884,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 );
@@ -898,8 +906,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) = sum( xmm1 );
@@ -921,8 +929,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) = sum( xmm1 );
@@ -937,7 +945,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) = sum( xmm1 );
@@ -993,8 +1001,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(1), false );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1020,8 +1027,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(1), false );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1270,6 +1276,11 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
          return;
       }
 
+      if( reorderChain<ChainAddAssign>( ~lhs, rhs.lhs_, rhs.rhs_ ) ) {
+         return;
+      }
+
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -1430,14 +1441,14 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType b2( B.load(k,j+1UL) );
                const IntrinsicType b3( B.load(k,j+2UL) );
                const IntrinsicType b4( B.load(k,j+3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 );
@@ -1464,10 +1475,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 );
@@ -1486,8 +1497,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) += sum( xmm1 );
@@ -1508,10 +1519,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
-               xmm3 = xmm3 + a1 * B.load(k,j+2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+3UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+3UL), xmm4 );
             }
 
             (~C)(i,j    ) += sum( xmm1 );
@@ -1530,8 +1541,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) += sum( xmm1 );
@@ -1546,7 +1557,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) += sum( xmm1 );
@@ -1605,14 +1616,14 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a4( A.load(i+3UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
-               xmm5 = xmm5 + a3 * b1;
-               xmm6 = xmm6 + a3 * b2;
-               xmm7 = xmm7 + a4 * b1;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
+               xmm5 = fmadd( a3, b1, xmm5 );
+               xmm6 = fmadd( a3, b2, xmm6 );
+               xmm7 = fmadd( a4, b1, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 );
@@ -1635,10 +1646,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
-               xmm3 = xmm3 + A.load(i+2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+3UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+3UL,k), b1, xmm4 );
             }
 
             (~C)(i    ,j) += sum( xmm1 );
@@ -1666,10 +1677,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 );
@@ -1688,8 +1699,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) += sum( xmm1 );
@@ -1711,8 +1722,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) += sum( xmm1 );
@@ -1727,7 +1738,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) += sum( xmm1 );
@@ -1783,8 +1794,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(1), true );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1810,8 +1820,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(1), true );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2035,6 +2044,11 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
          return;
       }
 
+      if( reorderChain<ChainSubAssign>( ~lhs, rhs.lhs_, rhs.rhs_ ) ) {
+         return;
+      }
+
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -2195,14 +2209,14 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType b2( B.load(k,j+1UL) );
                const IntrinsicType b3( B.load(k,j+2UL) );
                const IntrinsicType b4( B.load(k,j+3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 );
@@ -2229,10 +2243,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 );
@@ -2251,8 +2265,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) -= sum( xmm1 );
@@ -2274,10 +2288,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
-               xmm3 = xmm3 + a1 * B.load(k,j+2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+3UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+3UL), xmm4 );
             }
 
             (~C)(i,j    ) -= sum( xmm1 );
@@ -2296,8 +2310,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) -= sum( xmm1 );
@@ -2312,7 +2326,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) -= sum( xmm1 );
@@ -2371,14 +2385,14 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a4( A.load(i+3UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
-               xmm5 = xmm5 + a3 * b1;
-               xmm6 = xmm6 + a3 * b2;
-               xmm7 = xmm7 + a4 * b1;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
+               xmm5 = fmadd( a3, b1, xmm5 );
+               xmm6 = fmadd( a3, b2, xmm6 );
+               xmm7 = fmadd( a4, b1, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 );
@@ -2401,10 +2415,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
-               xmm3 = xmm3 + A.load(i+2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+3UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+3UL,k), b1, xmm4 );
             }
 
             (~C)(i    ,j) -= sum( xmm1 );
@@ -2432,10 +2446,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 );
@@ -2454,8 +2468,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) -= sum( xmm1 );
@@ -2476,8 +2490,8 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) -= sum( xmm1 );
@@ -2492,7 +2506,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) -= sum( xmm1 );
@@ -2548,8 +2562,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(-1), true );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2575,8 +2588,7 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(-1), true );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2815,6 +2827,11 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
          return;
       }
 
+      if( reorderChain<ChainSMPAssign>( ~lhs, rhs.lhs_, rhs.rhs_ ) ) {
+         return;
+      }
+
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -2900,6 +2917,11 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
          return;
       }
 
+      if( reorderChain<ChainSMPAddAssign>( ~lhs, rhs.lhs_, rhs.rhs_ ) ) {
+         return;
+      }
+
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -2949,6 +2971,11 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
          return;
       }
 
+      if( reorderChain<ChainSMPSubAssign>( ~lhs, rhs.lhs_, rhs.rhs_ ) ) {
+         return;
+      }
+
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -3338,6 +3365,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -3498,14 +3526,14 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType b2( B.load(k,j+1UL) );
                const IntrinsicType b3( B.load(k,j+2UL) );
                const IntrinsicType b4( B.load(k,j+3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 ) * scalar;
@@ -3532,10 +3560,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 ) * scalar;
@@ -3554,8 +3582,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) = sum( xmm1 ) * scalar;
@@ -3577,10 +3605,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
-               xmm3 = xmm3 + a1 * B.load(k,j+2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+3UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+3UL), xmm4 );
             }
 
             (~C)(i,j    ) = sum( xmm1 ) * scalar;
@@ -3599,8 +3627,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) = sum( xmm1 ) * scalar;
@@ -3615,7 +3643,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) = sum( xmm1 ) * scalar;
@@ -3674,14 +3702,14 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a4( A.load(i+3UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
-               xmm5 = xmm5 + a3 * b1;
-               xmm6 = xmm6 + a3 * b2;
-               xmm7 = xmm7 + a4 * b1;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
+               xmm5 = fmadd( a3, b1, xmm5 );
+               xmm6 = fmadd( a3, b2, xmm6 );
+               xmm7 = fmadd( a4, b1, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 ) * scalar;
@@ -3704,10 +3732,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
-               xmm3 = xmm3 + A.load(i+2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+3UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+3UL,k), b1, xmm4 );
             }
 
             (~C)(i    ,j) = sum( xmm1 ) * scalar;
@@ -3735,10 +3763,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) = sum( xmm1 ) * scalar;
@@ -3757,8 +3785,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) = sum( xmm1 ) * scalar;
@@ -3780,8 +3808,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) = sum( xmm1 ) * scalar;
@@ -3796,7 +3824,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) = sum( xmm1 ) * scalar;
@@ -3852,8 +3880,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, scalar, false );
    }
    //**********************************************************************************************
 
@@ -3879,8 +3906,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, scalar, false );
    }
    //**********************************************************************************************
 
@@ -4128,6 +4154,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -4266,14 +4293,14 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType b2( B.load(k,j+1UL) );
                const IntrinsicType b3( B.load(k,j+2UL) );
                const IntrinsicType b4( B.load(k,j+3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 ) * scalar;
@@ -4300,10 +4327,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 ) * scalar;
@@ -4322,8 +4349,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) += sum( xmm1 ) * scalar;
@@ -4345,10 +4372,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
-               xmm3 = xmm3 + a1 * B.load(k,j+2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+3UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+3UL), xmm4 );
             }
 
             (~C)(i,j    ) += sum( xmm1 ) * scalar;
@@ -4367,8 +4394,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) += sum( xmm1 ) * scalar;
@@ -4383,7 +4410,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) += sum( xmm1 ) * scalar;
@@ -4442,14 +4469,14 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a4( A.load(i+3UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
-               xmm5 = xmm5 + a3 * b1;
-               xmm6 = xmm6 + a3 * b2;
-               xmm7 = xmm7 + a4 * b1;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
+               xmm5 = fmadd( a3, b1, xmm5 );
+               xmm6 = fmadd( a3, b2, xmm6 );
+               xmm7 = fmadd( a4, b1, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 ) * scalar;
@@ -4472,10 +4499,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
-               xmm3 = xmm3 + A.load(i+2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+3UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+3UL,k), b1, xmm4 );
             }
 
             (~C)(i    ,j) += sum( xmm1 ) * scalar;
@@ -4503,10 +4530,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) += sum( xmm1 ) * scalar;
@@ -4525,8 +4552,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) += sum( xmm1 ) * scalar;
@@ -4548,8 +4575,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) += sum( xmm1 ) * scalar;
@@ -4564,7 +4591,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) += sum( xmm1 ) * scalar;
@@ -4620,8 +4647,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, scalar, true );
    }
    //**********************************************************************************************
 
@@ -4647,8 +4673,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, scalar, true );
    }
    //**********************************************************************************************
 
@@ -4873,6 +4898,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -5011,14 +5037,14 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType b2( B.load(k,j+1UL) );
                const IntrinsicType b3( B.load(k,j+2UL) );
                const IntrinsicType b4( B.load(k,j+3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 ) * scalar;
@@ -5045,10 +5071,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 ) * scalar;
@@ -5067,8 +5093,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) -= sum( xmm1 ) * scalar;
@@ -5090,10 +5116,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
-               xmm3 = xmm3 + a1 * B.load(k,j+2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+3UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+3UL), xmm4 );
             }
 
             (~C)(i,j    ) -= sum( xmm1 ) * scalar;
@@ -5112,8 +5138,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) -= sum( xmm1 ) * scalar;
@@ -5128,7 +5154,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) -= sum( xmm1 ) * scalar;
@@ -5188,14 +5214,14 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a4( A.load(i+3UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
-               xmm5 = xmm5 + a3 * b1;
-               xmm6 = xmm6 + a3 * b2;
-               xmm7 = xmm7 + a4 * b1;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
+               xmm5 = fmadd( a3, b1, xmm5 );
+               xmm6 = fmadd( a3, b2, xmm6 );
+               xmm7 = fmadd( a4, b1, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 ) * scalar;
@@ -5218,10 +5244,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
-               xmm3 = xmm3 + A.load(i+2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+3UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+3UL,k), b1, xmm4 );
             }
 
             (~C)(i    ,j) -= sum( xmm1 ) * scalar;
@@ -5249,10 +5275,10 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
                const IntrinsicType a2( A.load(i+1UL,k) );
                const IntrinsicType b1( B.load(k,j    ) );
                const IntrinsicType b2( B.load(k,j+1UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C)(i    ,j    ) -= sum( xmm1 ) * scalar;
@@ -5271,8 +5297,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + A.load(i    ,k) * b1;
-               xmm2 = xmm2 + A.load(i+1UL,k) * b1;
+               xmm1 = fmadd( A.load(i    ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+1UL,k), b1, xmm2 );
             }
 
             (~C)(i    ,j) -= sum( xmm1 ) * scalar;
@@ -5294,8 +5320,8 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
 
             for( size_t k=kbegin; k<kend; k+=IT::size ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * B.load(k,j    );
-               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm1 = fmadd( a1, B.load(k,j    ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+1UL), xmm2 );
             }
 
             (~C)(i,j    ) -= sum( xmm1 ) * scalar;
@@ -5310,7 +5336,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
             IntrinsicType xmm1, xmm2;
 
             for( size_t k=kbegin; k<K; k+=IT::size ) {
-               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+               xmm1 = fmadd( A.load(i,k), B.load(k,j), xmm1 );
             }
 
             (~C)(i,j) -= sum( xmm1 ) * scalar;
@@ -5366,8 +5392,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, -scalar, true );
    }
    //**********************************************************************************************
 
@@ -5393,8 +5418,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, -scalar, true );
    }
    //**********************************************************************************************
 
@@ -5635,6 +5659,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
       RT B( right );  // Evaluation of the right-hand side dense matrix operand
 
@@ -5720,6 +5745,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
       RT B( right );  // Evaluation of the right-hand side dense matrix operand
 
@@ -5770,6 +5796,7 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2>, ST, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
       RT B( right );  // Evaluation of the right-hand side dense matrix operand
 
@@ -150,6 +150,25 @@ class DVecScalarMultExpr : public DenseVector< DVecScalarMultExpr<VT,ST,TF>, TF
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Fused multiply-add evaluation strategy*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the dense vector operand does not require an intermediate evaluation and both the
+       target vector and the dense vector operand can be vectorized, \a value is set to 1 and
+       the addition and subtraction assignment are evaluated by fused multiply-add operations.
+       Otherwise \a value is set to 0 and the default strategy is chosen. */
+   template< typename VT2 >
+   struct UseFMAKernel {
+      enum { value = !useAssign && VT::vectorizable && VT2::vectorizable &&
+                     IsSame<ET,ST>::value &&
+                     IsSame<ET,typename VT2::ElementType>::value &&
+                     IntrinsicTrait<ET>::addition &&
+                     IntrinsicTrait<ET>::subtraction &&
+                     IntrinsicTrait<ET>::multiplication };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Parallel evaluation strategy****************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper structure for the explicit application of the SFINAE principle.
@@ -667,6 +686,52 @@ class DVecScalarMultExpr : public DenseVector< DVecScalarMultExpr<VT,ST,TF>, TF
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Addition assignment to dense vectors (fused multiply-add)************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized addition assignment of a dense vector-scalar multiplication to a
+   //        dense vector (\f$ \vec{y}+=s*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the vectorized addition assignment of a dense vector-scalar
+   // multiplication expression to a dense vector, which combines the multiplication and the
+   // addition into a single fused multiply-add operation per intrinsic element. Due to the
+   // explicit application of the SFINAE principle, this function can only be selected by the
+   // compiler in case the vector operand does not require an intermediate evaluation and all
+   // involved vectors are vectorizable.
+   */
+   template< typename VT2 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseFMAKernel<VT2> >::Type
+      addAssign( DenseVector<VT2,TF>& lhs, const DVecScalarMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      typedef IntrinsicTrait<ElementType>  IT;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const size_t N   ( (~lhs).size() );
+      const size_t ipos( N & size_t(-IT::size*4) );
+      BLAZE_INTERNAL_ASSERT( ( N - ( N % (IT::size*4UL) ) ) == ipos, "Invalid end calculation" );
+
+      const IntrinsicType factor( set( rhs.scalar_ ) );
+
+      for( size_t i=0UL; i<ipos; i+=IT::size*4UL ) {
+         (~lhs).store( i             , fmadd( rhs.vector_.load(i             ), factor, (~lhs).load(i             ) ) );
+         (~lhs).store( i+IT::size    , fmadd( rhs.vector_.load(i+IT::size    ), factor, (~lhs).load(i+IT::size    ) ) );
+         (~lhs).store( i+IT::size*2UL, fmadd( rhs.vector_.load(i+IT::size*2UL), factor, (~lhs).load(i+IT::size*2UL) ) );
+         (~lhs).store( i+IT::size*3UL, fmadd( rhs.vector_.load(i+IT::size*3UL), factor, (~lhs).load(i+IT::size*3UL) ) );
+      }
+      for( size_t i=ipos; i<N; i+=IT::size ) {
+         (~lhs).store( i, fmadd( rhs.vector_.load(i), factor, (~lhs).load(i) ) );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Addition assignment to sparse vectors*******************************************************
    // No special implementation for the addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -703,6 +768,52 @@ class DVecScalarMultExpr : public DenseVector< DVecScalarMultExpr<VT,ST,TF>, TF
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Subtraction assignment to dense vectors (fused multiply-add)*********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized subtraction assignment of a dense vector-scalar multiplication to a
+   //        dense vector (\f$ \vec{y}-=s*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the vectorized subtraction assignment of a dense vector-scalar
+   // multiplication expression to a dense vector, which combines the multiplication and the
+   // subtraction into a single fused multiply-add operation per intrinsic element. Due to the
+   // explicit application of the SFINAE principle, this function can only be selected by the
+   // compiler in case the vector operand does not require an intermediate evaluation and all
+   // involved vectors are vectorizable.
+   */
+   template< typename VT2 >  // Type of the target dense vector
+   friend inline typename EnableIf< UseFMAKernel<VT2> >::Type
+      subAssign( DenseVector<VT2,TF>& lhs, const DVecScalarMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      typedef IntrinsicTrait<ElementType>  IT;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const size_t N   ( (~lhs).size() );
+      const size_t ipos( N & size_t(-IT::size*4) );
+      BLAZE_INTERNAL_ASSERT( ( N - ( N % (IT::size*4UL) ) ) == ipos, "Invalid end calculation" );
+
+      const IntrinsicType factor( set( rhs.scalar_ ) );
+
+      for( size_t i=0UL; i<ipos; i+=IT::size*4UL ) {
+         (~lhs).store( i             , fnmadd( rhs.vector_.load(i             ), factor, (~lhs).load(i             ) ) );
+         (~lhs).store( i+IT::size    , fnmadd( rhs.vector_.load(i+IT::size    ), factor, (~lhs).load(i+IT::size    ) ) );
+         (~lhs).store( i+IT::size*2UL, fnmadd( rhs.vector_.load(i+IT::size*2UL), factor, (~lhs).load(i+IT::size*2UL) ) );
+         (~lhs).store( i+IT::size*3UL, fnmadd( rhs.vector_.load(i+IT::size*3UL), factor, (~lhs).load(i+IT::size*3UL) ) );
+      }
+      for( size_t i=ipos; i<N; i+=IT::size ) {
+         (~lhs).store( i, fnmadd( rhs.vector_.load(i), factor, (~lhs).load(i) ) );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse vectors****************************************************
    // No special implementation for the subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -52,6 +52,7 @@ template< typename, typename > class DMatDMatMultExpr;
 template< typename, typename, bool > class DMatDMatSubExpr;
 template< typename, typename > class DMatDVecMultExpr;
 template< typename, bool > class DMatEvalExpr;
+template< typename, typename, bool > class DMatMapExpr;
 template< typename, typename, bool > class DMatScalarDivExpr;
 template< typename, typename, bool > class DMatScalarMultExpr;
 template< typename, bool > class DMatSerialExpr;
@@ -70,9 +71,11 @@ template< typename, typename > class DMatTSMatSubExpr;
 template< typename, bool > class DVecAbsExpr;
 template< typename, typename, bool > class DVecDVecAddExpr;
 template< typename, typename > class DVecDVecCrossExpr;
+template< typename, typename, typename, bool > class DVecDVecMapExpr;
 template< typename, typename, bool > class DVecDVecMultExpr;
 template< typename, typename, bool > class DVecDVecSubExpr;
 template< typename, bool > class DVecEvalExpr;
+template< typename, typename, bool > class DVecMapExpr;
 template< typename, typename, bool > class DVecScalarDivExpr;
 template< typename, typename, bool > class DVecScalarMultExpr;
 template< typename, bool > class DVecSerialExpr;
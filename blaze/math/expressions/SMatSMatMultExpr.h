@@ -40,9 +40,7 @@
 // Includes
 //*************************************************************************************************
 
-#include <algorithm>
 #include <stdexcept>
-#include <vector>
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/SparseMatrix.h>
 #include <blaze/math/constraints/StorageOrder.h>
@@ -52,10 +50,9 @@
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatMatMultExpr.h>
 #include <blaze/math/expressions/SparseMatrix.h>
-#include <blaze/math/Infinity.h>
 #include <blaze/math/shims/IsDefault.h>
-#include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/SMMM.h>
 #include <blaze/math/traits/ColumnExprTrait.h>
 #include <blaze/math/traits/MultExprTrait.h>
 #include <blaze/math/traits/MultTrait.h>
@@ -85,7 +82,6 @@
 #include <blaze/math/typetraits/Rows.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
-#include <blaze/util/Byte.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/InvalidType.h>
@@ -446,7 +442,9 @@ class SMatSMatMultExpr : public SparseMatrix< SMatSMatMultExpr<MT1,MT2>, false >
    // \return void
    //
    // This function implements the performance optimized assignment of a sparse matrix-sparse
-   // matrix multiplication expression to a row-major sparse matrix.
+   // matrix multiplication expression to a row-major sparse matrix. The product is computed by
+   // the two-phase Gustavson kernel, which reserves the exact number of non-zero elements of
+   // the result before computing the values.
    */
    template< typename MT >  // Type of the target sparse matrix
    friend inline void assign( SparseMatrix<MT,false>& lhs, const SMatSMatMultExpr& rhs )
@@ -456,9 +454,6 @@ class SMatSMatMultExpr : public SparseMatrix< SMatSMatMultExpr<MT1,MT2>, false >
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      typedef typename RemoveReference<CT1>::Type::ConstIterator  LeftIterator;
-      typedef typename RemoveReference<CT2>::Type::ConstIterator  RightIterator;
-
       CT1 A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side sparse matrix operand
       CT2 B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side sparse matrix operand
 
@@ -469,91 +464,7 @@ class SMatSMatMultExpr : public SparseMatrix< SMatSMatMultExpr<MT1,MT2>, false >
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
 
-      // (Over-)Estimating the number of non-zero entries in the resulting matrix
-      size_t nonzeros( 0UL );
-
-      for( size_t i=0UL; i<(~lhs).rows(); ++i ) {
-         const LeftIterator lend( A.end(i) );
-         for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem ) {
-            nonzeros += B.nonZeros( lelem->index() );
-         }
-      }
-
-      if( nonzeros > (~lhs).rows() * (~lhs).columns() ) {
-         nonzeros = (~lhs).rows() * (~lhs).columns();
-      }
-
-      (~lhs).reserve( nonzeros );
-      nonzeros = 0UL;
-
-      // Performing the matrix-matrix multiplication
-      std::vector<ElementType> values ( (~lhs).columns(), ElementType() );
-      std::vector<byte>        valid  ( (~lhs).columns(), 0   );
-      std::vector<size_t>      indices( (~lhs).columns(), 0UL );
-      size_t minIndex( inf ), maxIndex( 0UL );
-
-      for( size_t i=0UL; i<(~lhs).rows(); ++i )
-      {
-         const LeftIterator lend( A.end(i) );
-         for( LeftIterator lelem=A.begin(i); lelem!=lend; ++lelem )
-         {
-            const RightIterator rend( B.end( lelem->index() ) );
-            for( RightIterator relem=B.begin( lelem->index() ); relem!=rend; ++relem )
-            {
-               if( !valid[relem->index()] ) {
-                  values[relem->index()] = lelem->value() * relem->value();
-                  valid [relem->index()] = 1;
-                  indices[nonzeros] = relem->index();
-                  ++nonzeros;
-                  if( relem->index() < minIndex ) minIndex = relem->index();
-                  if( relem->index() > maxIndex ) maxIndex = relem->index();
-               }
-               else {
-                  values[relem->index()] += lelem->value() * relem->value();
-               }
-            }
-         }
-
-         BLAZE_INTERNAL_ASSERT( nonzeros <= (~lhs).columns(), "Invalid number of non-zero elements" );
-
-         if( nonzeros > 0UL )
-         {
-            BLAZE_INTERNAL_ASSERT( minIndex <= maxIndex, "Invalid index detected" );
-
-            if( ( nonzeros + nonzeros ) < ( maxIndex - minIndex ) )
-            {
-               std::sort( indices.begin(), indices.begin() + nonzeros );
-
-               for( size_t j=0UL; j<nonzeros; ++j )
-               {
-                  const size_t index( indices[j] );
-                  if( !isDefault( values[index] ) ) {
-                     (~lhs).append( i, index, values[index] );
-                     reset( values[index] );
-                  }
-
-                  reset( valid [index] );
-               }
-            }
-            else {
-               for( size_t j=minIndex; j<=maxIndex; ++j )
-               {
-                  if( !isDefault( values[j] ) ) {
-                     (~lhs).append( i, j, values[j] );
-                     reset( values[j] );
-                  }
-
-                  reset( valid [j] );
-               }
-            }
-
-            nonzeros = 0UL;
-            minIndex = inf;
-            maxIndex = 0UL;
-         }
-
-         (~lhs).finalize( i );
-      }
+      smmm( ~lhs, A, B );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -46,6 +46,7 @@
 #include <blaze/math/constraints/StorageOrder.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/util/ArenaAllocator.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/Types.h>
@@ -516,7 +517,7 @@ class SMatTransposer : public SparseMatrix< SMatTransposer<MT,SO>, SO >
       const size_t n( columns() );
 
       // Counting the number of elements per row
-      std::vector<size_t> rowLengths( m, 0UL );
+      std::vector< size_t, ArenaAllocator<size_t> > rowLengths( m, 0UL );
       for( size_t j=0UL; j<n; ++j ) {
          for( RhsIterator element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
             ++rowLengths[element->index()];
@@ -952,7 +953,7 @@ class SMatTransposer<MT,true> : public SparseMatrix< SMatTransposer<MT,true>, tr
       const size_t n( columns() );
 
       // Counting the number of elements per row
-      std::vector<size_t> columnLengths( n, 0UL );
+      std::vector< size_t, ArenaAllocator<size_t> > columnLengths( n, 0UL );
       for( size_t i=0UL; i<m; ++i ) {
          for( RhsIterator element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
             ++columnLengths[element->index()];
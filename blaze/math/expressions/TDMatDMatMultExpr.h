@@ -45,6 +45,8 @@
 #include <blaze/math/constraints/DenseMatrix.h>
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/dense/MatrixChain.h>
+#include <blaze/math/dense/MMM.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
@@ -87,6 +89,7 @@
 #include <blaze/math/typetraits/Rows.h>
 #include <blaze/system/BLAS.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/util/Arena.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/constraints/Numeric.h>
@@ -481,6 +484,11 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
          return;
       }
 
+      if( reorderChain<ChainAssign>( ~lhs, rhs.lhs_, rhs.rhs_ ) ) {
+         return;
+      }
+
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -704,14 +712,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 + a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 + a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 + a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 + a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -745,14 +753,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C).store( i    , j             , xmm1 );
@@ -775,10 +783,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -806,10 +814,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i    , j         , xmm1 );
@@ -828,8 +836,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j         );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+               xmm1 = fmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
             (~C).store( i, j         , xmm1 );
@@ -851,8 +859,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 + set( A(i+1UL,k) ) * b1;
+               xmm1 = fmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
             (~C).store( i    , j, xmm1 );
@@ -867,7 +875,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + set( A(i,k) ) * B.load(k,j);
+               xmm1 = fmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -918,14 +926,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 + A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 + A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 + A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 + A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -959,14 +967,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a3 * b1;
-               xmm4 = xmm4 + a4 * b1;
-               xmm5 = xmm5 + a1 * b2;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a3 * b2;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a3, b1, xmm3 );
+               xmm4 = fmadd( a4, b1, xmm4 );
+               xmm5 = fmadd( a1, b2, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a3, b2, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C).store( i             , j    , xmm1 );
@@ -989,10 +997,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -1020,10 +1028,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a1 * b2;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a1, b2, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i         , j    , xmm1 );
@@ -1042,8 +1050,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i         ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size,k) * b1;
+               xmm1 = fmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
             (~C).store( i         , j, xmm1 );
@@ -1065,8 +1073,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * set( B(k,j    ) );
-               xmm2 = xmm2 + a1 * set( B(k,j+1UL) );
+               xmm1 = fmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
             (~C).store( i, j    , xmm1 );
@@ -1081,7 +1089,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + A.load(i,k) * set( B(k,j) );
+               xmm1 = fmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -1137,8 +1145,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(1), false );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1164,8 +1171,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(1), false );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1414,6 +1420,11 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
          return;
       }
 
+      if( reorderChain<ChainAddAssign>( ~lhs, rhs.lhs_, rhs.rhs_ ) ) {
+         return;
+      }
+
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -1628,14 +1639,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 + a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 + a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 + a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 + a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -1676,14 +1687,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C).store( i    , j             , xmm1 );
@@ -1709,10 +1720,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -1743,10 +1754,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i    , j         , xmm1 );
@@ -1766,8 +1777,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j         );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+               xmm1 = fmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
             (~C).store( i, j         , xmm1 );
@@ -1790,8 +1801,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 + set( A(i+1UL,k) ) * b1;
+               xmm1 = fmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
             (~C).store( i    , j, xmm1 );
@@ -1806,7 +1817,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
             IntrinsicType xmm1( (~C).load(i,j) );
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + set( A(i,k) ) * B.load(k,j);
+               xmm1 = fmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -1864,14 +1875,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 + A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 + A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 + A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 + A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -1912,14 +1923,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a3 * b1;
-               xmm4 = xmm4 + a4 * b1;
-               xmm5 = xmm5 + a1 * b2;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a3 * b2;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a3, b1, xmm3 );
+               xmm4 = fmadd( a4, b1, xmm4 );
+               xmm5 = fmadd( a1, b2, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a3, b2, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C).store( i             , j    , xmm1 );
@@ -1945,10 +1956,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -1979,10 +1990,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a1 * b2;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a1, b2, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i         , j    , xmm1 );
@@ -2002,8 +2013,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i         ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size,k) * b1;
+               xmm1 = fmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
             (~C).store( i         , j, xmm1 );
@@ -2026,8 +2037,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * set( B(k,j    ) );
-               xmm2 = xmm2 + a1 * set( B(k,j+1UL) );
+               xmm1 = fmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
             (~C).store( i, j    , xmm1 );
@@ -2042,7 +2053,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
             IntrinsicType xmm1( (~C).load(i,j) );
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + A.load(i,k) * set( B(k,j) );
+               xmm1 = fmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -2098,8 +2109,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(1), true );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2125,8 +2135,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(1), true );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2350,6 +2359,11 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
          return;
       }
 
+      if( reorderChain<ChainSubAssign>( ~lhs, rhs.lhs_, rhs.rhs_ ) ) {
+         return;
+      }
+
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -2564,14 +2578,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 - a1 * B.load(k,j             );
-               xmm2 = xmm2 - a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 - a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 - a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 - a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 - a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 - a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 - a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fnmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fnmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fnmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fnmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fnmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fnmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fnmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fnmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -2612,14 +2626,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 - a1 * b1;
-               xmm2 = xmm2 - a1 * b2;
-               xmm3 = xmm3 - a1 * b3;
-               xmm4 = xmm4 - a1 * b4;
-               xmm5 = xmm5 - a2 * b1;
-               xmm6 = xmm6 - a2 * b2;
-               xmm7 = xmm7 - a2 * b3;
-               xmm8 = xmm8 - a2 * b4;
+               xmm1 = fnmadd( a1, b1, xmm1 );
+               xmm2 = fnmadd( a1, b2, xmm2 );
+               xmm3 = fnmadd( a1, b3, xmm3 );
+               xmm4 = fnmadd( a1, b4, xmm4 );
+               xmm5 = fnmadd( a2, b1, xmm5 );
+               xmm6 = fnmadd( a2, b2, xmm6 );
+               xmm7 = fnmadd( a2, b3, xmm7 );
+               xmm8 = fnmadd( a2, b4, xmm8 );
             }
 
             (~C).store( i    , j             , xmm1 );
@@ -2645,10 +2659,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 - a1 * B.load(k,j             );
-               xmm2 = xmm2 - a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 - a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 - a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fnmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fnmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fnmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fnmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
             (~C).store( i, j             , xmm1 );
@@ -2679,10 +2693,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 - a1 * b1;
-               xmm2 = xmm2 - a1 * b2;
-               xmm3 = xmm3 - a2 * b1;
-               xmm4 = xmm4 - a2 * b2;
+               xmm1 = fnmadd( a1, b1, xmm1 );
+               xmm2 = fnmadd( a1, b2, xmm2 );
+               xmm3 = fnmadd( a2, b1, xmm3 );
+               xmm4 = fnmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i    , j         , xmm1 );
@@ -2702,8 +2716,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 - a1 * B.load(k,j         );
-               xmm2 = xmm2 - a1 * B.load(k,j+IT::size);
+               xmm1 = fnmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fnmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
             (~C).store( i, j         , xmm1 );
@@ -2726,8 +2740,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 - set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 - set( A(i+1UL,k) ) * b1;
+               xmm1 = fnmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fnmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
             (~C).store( i    , j, xmm1 );
@@ -2742,7 +2756,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
             IntrinsicType xmm1( (~C).load(i,j) );
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 - set( A(i,k) ) * B.load(k,j);
+               xmm1 = fnmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -2800,14 +2814,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 - A.load(i             ,k) * b1;
-               xmm2 = xmm2 - A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 - A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 - A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 - A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 - A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 - A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 - A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fnmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fnmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fnmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fnmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fnmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fnmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fnmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fnmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -2848,14 +2862,14 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 - a1 * b1;
-               xmm2 = xmm2 - a2 * b1;
-               xmm3 = xmm3 - a3 * b1;
-               xmm4 = xmm4 - a4 * b1;
-               xmm5 = xmm5 - a1 * b2;
-               xmm6 = xmm6 - a2 * b2;
-               xmm7 = xmm7 - a3 * b2;
-               xmm8 = xmm8 - a4 * b2;
+               xmm1 = fnmadd( a1, b1, xmm1 );
+               xmm2 = fnmadd( a2, b1, xmm2 );
+               xmm3 = fnmadd( a3, b1, xmm3 );
+               xmm4 = fnmadd( a4, b1, xmm4 );
+               xmm5 = fnmadd( a1, b2, xmm5 );
+               xmm6 = fnmadd( a2, b2, xmm6 );
+               xmm7 = fnmadd( a3, b2, xmm7 );
+               xmm8 = fnmadd( a4, b2, xmm8 );
             }
 
             (~C).store( i             , j    , xmm1 );
@@ -2881,10 +2895,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 - A.load(i             ,k) * b1;
-               xmm2 = xmm2 - A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 - A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 - A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fnmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fnmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fnmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fnmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -2915,10 +2929,10 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 - a1 * b1;
-               xmm2 = xmm2 - a2 * b1;
-               xmm3 = xmm3 - a1 * b2;
-               xmm4 = xmm4 - a2 * b2;
+               xmm1 = fnmadd( a1, b1, xmm1 );
+               xmm2 = fnmadd( a2, b1, xmm2 );
+               xmm3 = fnmadd( a1, b2, xmm3 );
+               xmm4 = fnmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i         , j    , xmm1 );
@@ -2938,8 +2952,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 - A.load(i         ,k) * b1;
-               xmm2 = xmm2 - A.load(i+IT::size,k) * b1;
+               xmm1 = fnmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fnmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
             (~C).store( i         , j, xmm1 );
@@ -2962,8 +2976,8 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 - a1 * set( B(k,j    ) );
-               xmm2 = xmm2 - a1 * set( B(k,j+1UL) );
+               xmm1 = fnmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fnmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
             (~C).store( i, j    , xmm1 );
@@ -2978,7 +2992,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
             IntrinsicType xmm1( (~C).load(i,j) );
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 - A.load(i,k) * set( B(k,j) );
+               xmm1 = fnmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -3034,8 +3048,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(-1), true );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -3061,8 +3074,7 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(-1), true );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -3302,6 +3314,11 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
          return;
       }
 
+      if( reorderChain<ChainSMPAssign>( ~lhs, rhs.lhs_, rhs.rhs_ ) ) {
+         return;
+      }
+
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -3388,6 +3405,11 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
          return;
       }
 
+      if( reorderChain<ChainSMPAddAssign>( ~lhs, rhs.lhs_, rhs.rhs_ ) ) {
+         return;
+      }
+
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -3437,6 +3459,11 @@ class TDMatDMatMultExpr : public DenseMatrix< TDMatDMatMultExpr<MT1,MT2>, true >
          return;
       }
 
+      if( reorderChain<ChainSMPSubAssign>( ~lhs, rhs.lhs_, rhs.rhs_ ) ) {
+         return;
+      }
+
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -3827,6 +3854,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -4068,14 +4096,14 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 + a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 + a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 + a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 + a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
             (~C).store( i, j             , xmm1 * factor );
@@ -4109,14 +4137,14 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
             (~C).store( i    , j             , xmm1 * factor );
@@ -4139,10 +4167,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
             (~C).store( i, j             , xmm1 * factor );
@@ -4170,10 +4198,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i    , j         , xmm1 * factor );
@@ -4192,8 +4220,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j         );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+               xmm1 = fmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
             (~C).store( i, j         , xmm1 * factor );
@@ -4215,8 +4243,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 + set( A(i+1UL,k) ) * b1;
+               xmm1 = fmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
             (~C).store( i    , j, xmm1 * factor );
@@ -4231,7 +4259,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + set( A(i,k) ) * B.load(k,j);
+               xmm1 = fmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
             (~C).store( i, j, xmm1 * factor );
@@ -4284,14 +4312,14 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 + A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 + A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 + A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 + A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
             (~C).store( i             , j, xmm1 * factor );
@@ -4325,14 +4353,14 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a3 * b1;
-               xmm4 = xmm4 + a4 * b1;
-               xmm5 = xmm5 + a1 * b2;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a3 * b2;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a3, b1, xmm3 );
+               xmm4 = fmadd( a4, b1, xmm4 );
+               xmm5 = fmadd( a1, b2, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a3, b2, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C).store( i             , j    , xmm1 * factor );
@@ -4355,10 +4383,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
             (~C).store( i             , j, xmm1 * factor );
@@ -4386,10 +4414,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a1 * b2;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a1, b2, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i         , j    , xmm1 * factor );
@@ -4408,8 +4436,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i         ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size,k) * b1;
+               xmm1 = fmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
             (~C).store( i         , j, xmm1 * factor );
@@ -4431,8 +4459,8 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * set( B(k,j    ) );
-               xmm2 = xmm2 + a1 * set( B(k,j+1UL) );
+               xmm1 = fmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
             (~C).store( i, j    , xmm1 * factor );
@@ -4447,7 +4475,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + A.load(i,k) * set( B(k,j) );
+               xmm1 = fmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
             (~C).store( i, j, xmm1 * factor );
@@ -4503,8 +4531,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, scalar, false );
    }
    //**********************************************************************************************
 
@@ -4530,8 +4557,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, scalar, false );
    }
    //**********************************************************************************************
 
@@ -4779,6 +4805,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -4911,24 +4938,24 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 + a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 + a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 + a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 + a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
-            (~C).store( i, j             , (~C).load(i,j             ) + xmm1 * factor );
-            (~C).store( i, j+IT::size    , (~C).load(i,j+IT::size    ) + xmm2 * factor );
-            (~C).store( i, j+IT::size*2UL, (~C).load(i,j+IT::size*2UL) + xmm3 * factor );
-            (~C).store( i, j+IT::size*3UL, (~C).load(i,j+IT::size*3UL) + xmm4 * factor );
-            (~C).store( i, j+IT::size*4UL, (~C).load(i,j+IT::size*4UL) + xmm5 * factor );
-            (~C).store( i, j+IT::size*5UL, (~C).load(i,j+IT::size*5UL) + xmm6 * factor );
-            (~C).store( i, j+IT::size*6UL, (~C).load(i,j+IT::size*6UL) + xmm7 * factor );
-            (~C).store( i, j+IT::size*7UL, (~C).load(i,j+IT::size*7UL) + xmm8 * factor );
+            (~C).store( i, j             , fmadd( xmm1, factor, (~C).load(i,j             ) ) );
+            (~C).store( i, j+IT::size    , fmadd( xmm2, factor, (~C).load(i,j+IT::size    ) ) );
+            (~C).store( i, j+IT::size*2UL, fmadd( xmm3, factor, (~C).load(i,j+IT::size*2UL) ) );
+            (~C).store( i, j+IT::size*3UL, fmadd( xmm4, factor, (~C).load(i,j+IT::size*3UL) ) );
+            (~C).store( i, j+IT::size*4UL, fmadd( xmm5, factor, (~C).load(i,j+IT::size*4UL) ) );
+            (~C).store( i, j+IT::size*5UL, fmadd( xmm6, factor, (~C).load(i,j+IT::size*5UL) ) );
+            (~C).store( i, j+IT::size*6UL, fmadd( xmm7, factor, (~C).load(i,j+IT::size*6UL) ) );
+            (~C).store( i, j+IT::size*7UL, fmadd( xmm8, factor, (~C).load(i,j+IT::size*7UL) ) );
          }
       }
 
@@ -4952,24 +4979,24 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
-            (~C).store( i    , j             , (~C).load(i    ,j             ) + xmm1 * factor );
-            (~C).store( i    , j+IT::size    , (~C).load(i    ,j+IT::size    ) + xmm2 * factor );
-            (~C).store( i    , j+IT::size*2UL, (~C).load(i    ,j+IT::size*2UL) + xmm3 * factor );
-            (~C).store( i    , j+IT::size*3UL, (~C).load(i    ,j+IT::size*3UL) + xmm4 * factor );
-            (~C).store( i+1UL, j             , (~C).load(i+1UL,j             ) + xmm5 * factor );
-            (~C).store( i+1UL, j+IT::size    , (~C).load(i+1UL,j+IT::size    ) + xmm6 * factor );
-            (~C).store( i+1UL, j+IT::size*2UL, (~C).load(i+1UL,j+IT::size*2UL) + xmm7 * factor );
-            (~C).store( i+1UL, j+IT::size*3UL, (~C).load(i+1UL,j+IT::size*3UL) + xmm8 * factor );
+            (~C).store( i    , j             , fmadd( xmm1, factor, (~C).load(i    ,j             ) ) );
+            (~C).store( i    , j+IT::size    , fmadd( xmm2, factor, (~C).load(i    ,j+IT::size    ) ) );
+            (~C).store( i    , j+IT::size*2UL, fmadd( xmm3, factor, (~C).load(i    ,j+IT::size*2UL) ) );
+            (~C).store( i    , j+IT::size*3UL, fmadd( xmm4, factor, (~C).load(i    ,j+IT::size*3UL) ) );
+            (~C).store( i+1UL, j             , fmadd( xmm5, factor, (~C).load(i+1UL,j             ) ) );
+            (~C).store( i+1UL, j+IT::size    , fmadd( xmm6, factor, (~C).load(i+1UL,j+IT::size    ) ) );
+            (~C).store( i+1UL, j+IT::size*2UL, fmadd( xmm7, factor, (~C).load(i+1UL,j+IT::size*2UL) ) );
+            (~C).store( i+1UL, j+IT::size*3UL, fmadd( xmm8, factor, (~C).load(i+1UL,j+IT::size*3UL) ) );
          }
 
          if( i < M )
@@ -4982,16 +5009,16 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
-            (~C).store( i, j             , (~C).load(i,j             ) + xmm1 * factor );
-            (~C).store( i, j+IT::size    , (~C).load(i,j+IT::size    ) + xmm2 * factor );
-            (~C).store( i, j+IT::size*2UL, (~C).load(i,j+IT::size*2UL) + xmm3 * factor );
-            (~C).store( i, j+IT::size*3UL, (~C).load(i,j+IT::size*3UL) + xmm4 * factor );
+            (~C).store( i, j             , fmadd( xmm1, factor, (~C).load(i,j             ) ) );
+            (~C).store( i, j+IT::size    , fmadd( xmm2, factor, (~C).load(i,j+IT::size    ) ) );
+            (~C).store( i, j+IT::size*2UL, fmadd( xmm3, factor, (~C).load(i,j+IT::size*2UL) ) );
+            (~C).store( i, j+IT::size*3UL, fmadd( xmm4, factor, (~C).load(i,j+IT::size*3UL) ) );
          }
       }
 
@@ -5013,16 +5040,16 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
-            (~C).store( i    , j         , (~C).load(i    ,j         ) + xmm1 * factor );
-            (~C).store( i    , j+IT::size, (~C).load(i    ,j+IT::size) + xmm2 * factor );
-            (~C).store( i+1UL, j         , (~C).load(i+1UL,j         ) + xmm3 * factor );
-            (~C).store( i+1UL, j+IT::size, (~C).load(i+1UL,j+IT::size) + xmm4 * factor );
+            (~C).store( i    , j         , fmadd( xmm1, factor, (~C).load(i    ,j         ) ) );
+            (~C).store( i    , j+IT::size, fmadd( xmm2, factor, (~C).load(i    ,j+IT::size) ) );
+            (~C).store( i+1UL, j         , fmadd( xmm3, factor, (~C).load(i+1UL,j         ) ) );
+            (~C).store( i+1UL, j+IT::size, fmadd( xmm4, factor, (~C).load(i+1UL,j+IT::size) ) );
          }
 
          if( i < M )
@@ -5035,12 +5062,12 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j         );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+               xmm1 = fmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
-            (~C).store( i, j         , (~C).load(i,j         ) + xmm1 * factor );
-            (~C).store( i, j+IT::size, (~C).load(i,j+IT::size) + xmm2 * factor );
+            (~C).store( i, j         , fmadd( xmm1, factor, (~C).load(i,j         ) ) );
+            (~C).store( i, j+IT::size, fmadd( xmm2, factor, (~C).load(i,j+IT::size) ) );
          }
       }
 
@@ -5058,12 +5085,12 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 + set( A(i+1UL,k) ) * b1;
+               xmm1 = fmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
-            (~C).store( i    , j, (~C).load(i    ,j) + xmm1 * factor );
-            (~C).store( i+1UL, j, (~C).load(i+1UL,j) + xmm2 * factor );
+            (~C).store( i    , j, fmadd( xmm1, factor, (~C).load(i    ,j) ) );
+            (~C).store( i+1UL, j, fmadd( xmm2, factor, (~C).load(i+1UL,j) ) );
          }
 
          if( i < M )
@@ -5074,10 +5101,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + set( A(i,k) ) * B.load(k,j);
+               xmm1 = fmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
-            (~C).store( i, j, (~C).load(i,j) + xmm1 * factor );
+            (~C).store( i, j, fmadd( xmm1, factor, (~C).load(i,j) ) );
          }
       }
    }
@@ -5127,24 +5154,24 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 + A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 + A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 + A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 + A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
-            (~C).store( i             , j, (~C).load(i             ,j) + xmm1 * factor );
-            (~C).store( i+IT::size    , j, (~C).load(i+IT::size    ,j) + xmm2 * factor );
-            (~C).store( i+IT::size*2UL, j, (~C).load(i+IT::size*2UL,j) + xmm3 * factor );
-            (~C).store( i+IT::size*3UL, j, (~C).load(i+IT::size*3UL,j) + xmm4 * factor );
-            (~C).store( i+IT::size*4UL, j, (~C).load(i+IT::size*4UL,j) + xmm5 * factor );
-            (~C).store( i+IT::size*5UL, j, (~C).load(i+IT::size*5UL,j) + xmm6 * factor );
-            (~C).store( i+IT::size*6UL, j, (~C).load(i+IT::size*6UL,j) + xmm7 * factor );
-            (~C).store( i+IT::size*7UL, j, (~C).load(i+IT::size*7UL,j) + xmm8 * factor );
+            (~C).store( i             , j, fmadd( xmm1, factor, (~C).load(i             ,j) ) );
+            (~C).store( i+IT::size    , j, fmadd( xmm2, factor, (~C).load(i+IT::size    ,j) ) );
+            (~C).store( i+IT::size*2UL, j, fmadd( xmm3, factor, (~C).load(i+IT::size*2UL,j) ) );
+            (~C).store( i+IT::size*3UL, j, fmadd( xmm4, factor, (~C).load(i+IT::size*3UL,j) ) );
+            (~C).store( i+IT::size*4UL, j, fmadd( xmm5, factor, (~C).load(i+IT::size*4UL,j) ) );
+            (~C).store( i+IT::size*5UL, j, fmadd( xmm6, factor, (~C).load(i+IT::size*5UL,j) ) );
+            (~C).store( i+IT::size*6UL, j, fmadd( xmm7, factor, (~C).load(i+IT::size*6UL,j) ) );
+            (~C).store( i+IT::size*7UL, j, fmadd( xmm8, factor, (~C).load(i+IT::size*7UL,j) ) );
          }
       }
 
@@ -5168,24 +5195,24 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a3 * b1;
-               xmm4 = xmm4 + a4 * b1;
-               xmm5 = xmm5 + a1 * b2;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a3 * b2;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a3, b1, xmm3 );
+               xmm4 = fmadd( a4, b1, xmm4 );
+               xmm5 = fmadd( a1, b2, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a3, b2, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
-            (~C).store( i             , j    , (~C).load(i             ,j    ) + xmm1 * factor );
-            (~C).store( i+IT::size    , j    , (~C).load(i+IT::size    ,j    ) + xmm2 * factor );
-            (~C).store( i+IT::size*2UL, j    , (~C).load(i+IT::size*2UL,j    ) + xmm3 * factor );
-            (~C).store( i+IT::size*3UL, j    , (~C).load(i+IT::size*3UL,j    ) + xmm4 * factor );
-            (~C).store( i             , j+1UL, (~C).load(i             ,j+1UL) + xmm5 * factor );
-            (~C).store( i+IT::size    , j+1UL, (~C).load(i+IT::size    ,j+1UL) + xmm6 * factor );
-            (~C).store( i+IT::size*2UL, j+1UL, (~C).load(i+IT::size*2UL,j+1UL) + xmm7 * factor );
-            (~C).store( i+IT::size*3UL, j+1UL, (~C).load(i+IT::size*3UL,j+1UL) + xmm8 * factor );
+            (~C).store( i             , j    , fmadd( xmm1, factor, (~C).load(i             ,j    ) ) );
+            (~C).store( i+IT::size    , j    , fmadd( xmm2, factor, (~C).load(i+IT::size    ,j    ) ) );
+            (~C).store( i+IT::size*2UL, j    , fmadd( xmm3, factor, (~C).load(i+IT::size*2UL,j    ) ) );
+            (~C).store( i+IT::size*3UL, j    , fmadd( xmm4, factor, (~C).load(i+IT::size*3UL,j    ) ) );
+            (~C).store( i             , j+1UL, fmadd( xmm5, factor, (~C).load(i             ,j+1UL) ) );
+            (~C).store( i+IT::size    , j+1UL, fmadd( xmm6, factor, (~C).load(i+IT::size    ,j+1UL) ) );
+            (~C).store( i+IT::size*2UL, j+1UL, fmadd( xmm7, factor, (~C).load(i+IT::size*2UL,j+1UL) ) );
+            (~C).store( i+IT::size*3UL, j+1UL, fmadd( xmm8, factor, (~C).load(i+IT::size*3UL,j+1UL) ) );
          }
 
          if( j < N )
@@ -5198,16 +5225,16 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
-            (~C).store( i             , j, (~C).load(i             ,j) + xmm1 * factor );
-            (~C).store( i+IT::size    , j, (~C).load(i+IT::size    ,j) + xmm2 * factor );
-            (~C).store( i+IT::size*2UL, j, (~C).load(i+IT::size*2UL,j) + xmm3 * factor );
-            (~C).store( i+IT::size*3UL, j, (~C).load(i+IT::size*3UL,j) + xmm4 * factor );
+            (~C).store( i             , j, fmadd( xmm1, factor, (~C).load(i             ,j) ) );
+            (~C).store( i+IT::size    , j, fmadd( xmm2, factor, (~C).load(i+IT::size    ,j) ) );
+            (~C).store( i+IT::size*2UL, j, fmadd( xmm3, factor, (~C).load(i+IT::size*2UL,j) ) );
+            (~C).store( i+IT::size*3UL, j, fmadd( xmm4, factor, (~C).load(i+IT::size*3UL,j) ) );
          }
       }
 
@@ -5229,16 +5256,16 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a1 * b2;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a1, b2, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
-            (~C).store( i         , j    , (~C).load(i         ,j    ) + xmm1 * factor );
-            (~C).store( i+IT::size, j    , (~C).load(i+IT::size,j    ) + xmm2 * factor );
-            (~C).store( i         , j+1UL, (~C).load(i         ,j+1UL) + xmm3 * factor );
-            (~C).store( i+IT::size, j+1UL, (~C).load(i+IT::size,j+1UL) + xmm4 * factor );
+            (~C).store( i         , j    , fmadd( xmm1, factor, (~C).load(i         ,j    ) ) );
+            (~C).store( i+IT::size, j    , fmadd( xmm2, factor, (~C).load(i+IT::size,j    ) ) );
+            (~C).store( i         , j+1UL, fmadd( xmm3, factor, (~C).load(i         ,j+1UL) ) );
+            (~C).store( i+IT::size, j+1UL, fmadd( xmm4, factor, (~C).load(i+IT::size,j+1UL) ) );
          }
 
          if( j < N )
@@ -5251,12 +5278,12 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i         ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size,k) * b1;
+               xmm1 = fmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
-            (~C).store( i         , j, (~C).load(i         ,j) + xmm1 * factor );
-            (~C).store( i+IT::size, j, (~C).load(i+IT::size,j) + xmm2 * factor );
+            (~C).store( i         , j, fmadd( xmm1, factor, (~C).load(i         ,j) ) );
+            (~C).store( i+IT::size, j, fmadd( xmm2, factor, (~C).load(i+IT::size,j) ) );
          }
       }
 
@@ -5274,12 +5301,12 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * set( B(k,j    ) );
-               xmm2 = xmm2 + a1 * set( B(k,j+1UL) );
+               xmm1 = fmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fmadd( a1, set( B(k,j+1UL) ), xmm2 );
 
             }
-            (~C).store( i, j    , (~C).load(i,j    ) + xmm1 * factor );
-            (~C).store( i, j+1UL, (~C).load(i,j+1UL) + xmm2 * factor );
+            (~C).store( i, j    , fmadd( xmm1, factor, (~C).load(i,j    ) ) );
+            (~C).store( i, j+1UL, fmadd( xmm2, factor, (~C).load(i,j+1UL) ) );
          }
 
          if( j < N )
@@ -5290,10 +5317,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + A.load(i,k) * set( B(k,j) );
+               xmm1 = fmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
-            (~C).store( i, j, (~C).load(i,j) + xmm1 * factor );
+            (~C).store( i, j, fmadd( xmm1, factor, (~C).load(i,j) ) );
          }
       }
    }
@@ -5346,8 +5373,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, scalar, true );
    }
    //**********************************************************************************************
 
@@ -5373,8 +5399,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, scalar, true );
    }
    //**********************************************************************************************
 
@@ -5599,6 +5624,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -5731,24 +5757,24 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
-               xmm5 = xmm5 + a1 * B.load(k,j+IT::size*4UL);
-               xmm6 = xmm6 + a1 * B.load(k,j+IT::size*5UL);
-               xmm7 = xmm7 + a1 * B.load(k,j+IT::size*6UL);
-               xmm8 = xmm8 + a1 * B.load(k,j+IT::size*7UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
+               xmm5 = fmadd( a1, B.load(k,j+IT::size*4UL), xmm5 );
+               xmm6 = fmadd( a1, B.load(k,j+IT::size*5UL), xmm6 );
+               xmm7 = fmadd( a1, B.load(k,j+IT::size*6UL), xmm7 );
+               xmm8 = fmadd( a1, B.load(k,j+IT::size*7UL), xmm8 );
             }
 
-            (~C).store( i, j             , (~C).load(i,j             ) - xmm1 * factor );
-            (~C).store( i, j+IT::size    , (~C).load(i,j+IT::size    ) - xmm2 * factor );
-            (~C).store( i, j+IT::size*2UL, (~C).load(i,j+IT::size*2UL) - xmm3 * factor );
-            (~C).store( i, j+IT::size*3UL, (~C).load(i,j+IT::size*3UL) - xmm4 * factor );
-            (~C).store( i, j+IT::size*4UL, (~C).load(i,j+IT::size*4UL) - xmm5 * factor );
-            (~C).store( i, j+IT::size*5UL, (~C).load(i,j+IT::size*5UL) - xmm6 * factor );
-            (~C).store( i, j+IT::size*6UL, (~C).load(i,j+IT::size*6UL) - xmm7 * factor );
-            (~C).store( i, j+IT::size*7UL, (~C).load(i,j+IT::size*7UL) - xmm8 * factor );
+            (~C).store( i, j             , fnmadd( xmm1, factor, (~C).load(i,j             ) ) );
+            (~C).store( i, j+IT::size    , fnmadd( xmm2, factor, (~C).load(i,j+IT::size    ) ) );
+            (~C).store( i, j+IT::size*2UL, fnmadd( xmm3, factor, (~C).load(i,j+IT::size*2UL) ) );
+            (~C).store( i, j+IT::size*3UL, fnmadd( xmm4, factor, (~C).load(i,j+IT::size*3UL) ) );
+            (~C).store( i, j+IT::size*4UL, fnmadd( xmm5, factor, (~C).load(i,j+IT::size*4UL) ) );
+            (~C).store( i, j+IT::size*5UL, fnmadd( xmm6, factor, (~C).load(i,j+IT::size*5UL) ) );
+            (~C).store( i, j+IT::size*6UL, fnmadd( xmm7, factor, (~C).load(i,j+IT::size*6UL) ) );
+            (~C).store( i, j+IT::size*7UL, fnmadd( xmm8, factor, (~C).load(i,j+IT::size*7UL) ) );
          }
       }
 
@@ -5772,24 +5798,24 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType b2( B.load(k,j+IT::size    ) );
                const IntrinsicType b3( B.load(k,j+IT::size*2UL) );
                const IntrinsicType b4( B.load(k,j+IT::size*3UL) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a1 * b3;
-               xmm4 = xmm4 + a1 * b4;
-               xmm5 = xmm5 + a2 * b1;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a2 * b3;
-               xmm8 = xmm8 + a2 * b4;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a1, b3, xmm3 );
+               xmm4 = fmadd( a1, b4, xmm4 );
+               xmm5 = fmadd( a2, b1, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a2, b3, xmm7 );
+               xmm8 = fmadd( a2, b4, xmm8 );
             }
 
-            (~C).store( i    , j             , (~C).load(i    ,j             ) - xmm1 * factor );
-            (~C).store( i    , j+IT::size    , (~C).load(i    ,j+IT::size    ) - xmm2 * factor );
-            (~C).store( i    , j+IT::size*2UL, (~C).load(i    ,j+IT::size*2UL) - xmm3 * factor );
-            (~C).store( i    , j+IT::size*3UL, (~C).load(i    ,j+IT::size*3UL) - xmm4 * factor );
-            (~C).store( i+1UL, j             , (~C).load(i+1UL,j             ) - xmm5 * factor );
-            (~C).store( i+1UL, j+IT::size    , (~C).load(i+1UL,j+IT::size    ) - xmm6 * factor );
-            (~C).store( i+1UL, j+IT::size*2UL, (~C).load(i+1UL,j+IT::size*2UL) - xmm7 * factor );
-            (~C).store( i+1UL, j+IT::size*3UL, (~C).load(i+1UL,j+IT::size*3UL) - xmm8 * factor );
+            (~C).store( i    , j             , fnmadd( xmm1, factor, (~C).load(i    ,j             ) ) );
+            (~C).store( i    , j+IT::size    , fnmadd( xmm2, factor, (~C).load(i    ,j+IT::size    ) ) );
+            (~C).store( i    , j+IT::size*2UL, fnmadd( xmm3, factor, (~C).load(i    ,j+IT::size*2UL) ) );
+            (~C).store( i    , j+IT::size*3UL, fnmadd( xmm4, factor, (~C).load(i    ,j+IT::size*3UL) ) );
+            (~C).store( i+1UL, j             , fnmadd( xmm5, factor, (~C).load(i+1UL,j             ) ) );
+            (~C).store( i+1UL, j+IT::size    , fnmadd( xmm6, factor, (~C).load(i+1UL,j+IT::size    ) ) );
+            (~C).store( i+1UL, j+IT::size*2UL, fnmadd( xmm7, factor, (~C).load(i+1UL,j+IT::size*2UL) ) );
+            (~C).store( i+1UL, j+IT::size*3UL, fnmadd( xmm8, factor, (~C).load(i+1UL,j+IT::size*3UL) ) );
          }
 
          if( i < M )
@@ -5802,16 +5828,16 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j             );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size    );
-               xmm3 = xmm3 + a1 * B.load(k,j+IT::size*2UL);
-               xmm4 = xmm4 + a1 * B.load(k,j+IT::size*3UL);
+               xmm1 = fmadd( a1, B.load(k,j             ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size    ), xmm2 );
+               xmm3 = fmadd( a1, B.load(k,j+IT::size*2UL), xmm3 );
+               xmm4 = fmadd( a1, B.load(k,j+IT::size*3UL), xmm4 );
             }
 
-            (~C).store( i, j             , (~C).load(i,j             ) - xmm1 * factor );
-            (~C).store( i, j+IT::size    , (~C).load(i,j+IT::size    ) - xmm2 * factor );
-            (~C).store( i, j+IT::size*2UL, (~C).load(i,j+IT::size*2UL) - xmm3 * factor );
-            (~C).store( i, j+IT::size*3UL, (~C).load(i,j+IT::size*3UL) - xmm4 * factor );
+            (~C).store( i, j             , fnmadd( xmm1, factor, (~C).load(i,j             ) ) );
+            (~C).store( i, j+IT::size    , fnmadd( xmm2, factor, (~C).load(i,j+IT::size    ) ) );
+            (~C).store( i, j+IT::size*2UL, fnmadd( xmm3, factor, (~C).load(i,j+IT::size*2UL) ) );
+            (~C).store( i, j+IT::size*3UL, fnmadd( xmm4, factor, (~C).load(i,j+IT::size*3UL) ) );
          }
       }
 
@@ -5833,16 +5859,16 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a2( set( A(i+1UL,k) ) );
                const IntrinsicType b1( B.load(k,j         ) );
                const IntrinsicType b2( B.load(k,j+IT::size) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a1 * b2;
-               xmm3 = xmm3 + a2 * b1;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a1, b2, xmm2 );
+               xmm3 = fmadd( a2, b1, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
-            (~C).store( i    , j         , (~C).load(i    ,j         ) - xmm1 * factor );
-            (~C).store( i    , j+IT::size, (~C).load(i    ,j+IT::size) - xmm2 * factor );
-            (~C).store( i+1UL, j         , (~C).load(i+1UL,j         ) - xmm3 * factor );
-            (~C).store( i+1UL, j+IT::size, (~C).load(i+1UL,j+IT::size) - xmm4 * factor );
+            (~C).store( i    , j         , fnmadd( xmm1, factor, (~C).load(i    ,j         ) ) );
+            (~C).store( i    , j+IT::size, fnmadd( xmm2, factor, (~C).load(i    ,j+IT::size) ) );
+            (~C).store( i+1UL, j         , fnmadd( xmm3, factor, (~C).load(i+1UL,j         ) ) );
+            (~C).store( i+1UL, j+IT::size, fnmadd( xmm4, factor, (~C).load(i+1UL,j+IT::size) ) );
          }
 
          if( i < M )
@@ -5855,12 +5881,12 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( set( A(i,k) ) );
-               xmm1 = xmm1 + a1 * B.load(k,j         );
-               xmm2 = xmm2 + a1 * B.load(k,j+IT::size);
+               xmm1 = fmadd( a1, B.load(k,j         ), xmm1 );
+               xmm2 = fmadd( a1, B.load(k,j+IT::size), xmm2 );
             }
 
-            (~C).store( i, j         , (~C).load(i,j         ) - xmm1 * factor );
-            (~C).store( i, j+IT::size, (~C).load(i,j+IT::size) - xmm2 * factor );
+            (~C).store( i, j         , fnmadd( xmm1, factor, (~C).load(i,j         ) ) );
+            (~C).store( i, j+IT::size, fnmadd( xmm2, factor, (~C).load(i,j+IT::size) ) );
          }
       }
 
@@ -5878,12 +5904,12 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( B.load(k,j) );
-               xmm1 = xmm1 + set( A(i    ,k) ) * b1;
-               xmm2 = xmm2 + set( A(i+1UL,k) ) * b1;
+               xmm1 = fmadd( set( A(i    ,k) ), b1, xmm1 );
+               xmm2 = fmadd( set( A(i+1UL,k) ), b1, xmm2 );
             }
 
-            (~C).store( i    , j, (~C).load(i    ,j) - xmm1 * factor );
-            (~C).store( i+1UL, j, (~C).load(i+1UL,j) - xmm2 * factor );
+            (~C).store( i    , j, fnmadd( xmm1, factor, (~C).load(i    ,j) ) );
+            (~C).store( i+1UL, j, fnmadd( xmm2, factor, (~C).load(i+1UL,j) ) );
          }
 
          if( i < M )
@@ -5894,10 +5920,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + set( A(i,k) ) * B.load(k,j);
+               xmm1 = fmadd( set( A(i,k) ), B.load(k,j), xmm1 );
             }
 
-            (~C).store( i, j, (~C).load(i,j) - xmm1 * factor );
+            (~C).store( i, j, fnmadd( xmm1, factor, (~C).load(i,j) ) );
          }
       }
    }
@@ -5947,24 +5973,24 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 + A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 + A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 + A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 + A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
-            (~C).store( i             , j, (~C).load(i             ,j) - xmm1 * factor );
-            (~C).store( i+IT::size    , j, (~C).load(i+IT::size    ,j) - xmm2 * factor );
-            (~C).store( i+IT::size*2UL, j, (~C).load(i+IT::size*2UL,j) - xmm3 * factor );
-            (~C).store( i+IT::size*3UL, j, (~C).load(i+IT::size*3UL,j) - xmm4 * factor );
-            (~C).store( i+IT::size*4UL, j, (~C).load(i+IT::size*4UL,j) - xmm5 * factor );
-            (~C).store( i+IT::size*5UL, j, (~C).load(i+IT::size*5UL,j) - xmm6 * factor );
-            (~C).store( i+IT::size*6UL, j, (~C).load(i+IT::size*6UL,j) - xmm7 * factor );
-            (~C).store( i+IT::size*7UL, j, (~C).load(i+IT::size*7UL,j) - xmm8 * factor );
+            (~C).store( i             , j, fnmadd( xmm1, factor, (~C).load(i             ,j) ) );
+            (~C).store( i+IT::size    , j, fnmadd( xmm2, factor, (~C).load(i+IT::size    ,j) ) );
+            (~C).store( i+IT::size*2UL, j, fnmadd( xmm3, factor, (~C).load(i+IT::size*2UL,j) ) );
+            (~C).store( i+IT::size*3UL, j, fnmadd( xmm4, factor, (~C).load(i+IT::size*3UL,j) ) );
+            (~C).store( i+IT::size*4UL, j, fnmadd( xmm5, factor, (~C).load(i+IT::size*4UL,j) ) );
+            (~C).store( i+IT::size*5UL, j, fnmadd( xmm6, factor, (~C).load(i+IT::size*5UL,j) ) );
+            (~C).store( i+IT::size*6UL, j, fnmadd( xmm7, factor, (~C).load(i+IT::size*6UL,j) ) );
+            (~C).store( i+IT::size*7UL, j, fnmadd( xmm8, factor, (~C).load(i+IT::size*7UL,j) ) );
          }
       }
 
@@ -5988,24 +6014,24 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a3 * b1;
-               xmm4 = xmm4 + a4 * b1;
-               xmm5 = xmm5 + a1 * b2;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a3 * b2;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a3, b1, xmm3 );
+               xmm4 = fmadd( a4, b1, xmm4 );
+               xmm5 = fmadd( a1, b2, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a3, b2, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
-            (~C).store( i             , j    , (~C).load(i             ,j    ) - xmm1 * factor );
-            (~C).store( i+IT::size    , j    , (~C).load(i+IT::size    ,j    ) - xmm2 * factor );
-            (~C).store( i+IT::size*2UL, j    , (~C).load(i+IT::size*2UL,j    ) - xmm3 * factor );
-            (~C).store( i+IT::size*3UL, j    , (~C).load(i+IT::size*3UL,j    ) - xmm4 * factor );
-            (~C).store( i             , j+1UL, (~C).load(i             ,j+1UL) - xmm5 * factor );
-            (~C).store( i+IT::size    , j+1UL, (~C).load(i+IT::size    ,j+1UL) - xmm6 * factor );
-            (~C).store( i+IT::size*2UL, j+1UL, (~C).load(i+IT::size*2UL,j+1UL) - xmm7 * factor );
-            (~C).store( i+IT::size*3UL, j+1UL, (~C).load(i+IT::size*3UL,j+1UL) - xmm8 * factor );
+            (~C).store( i             , j    , fnmadd( xmm1, factor, (~C).load(i             ,j    ) ) );
+            (~C).store( i+IT::size    , j    , fnmadd( xmm2, factor, (~C).load(i+IT::size    ,j    ) ) );
+            (~C).store( i+IT::size*2UL, j    , fnmadd( xmm3, factor, (~C).load(i+IT::size*2UL,j    ) ) );
+            (~C).store( i+IT::size*3UL, j    , fnmadd( xmm4, factor, (~C).load(i+IT::size*3UL,j    ) ) );
+            (~C).store( i             , j+1UL, fnmadd( xmm5, factor, (~C).load(i             ,j+1UL) ) );
+            (~C).store( i+IT::size    , j+1UL, fnmadd( xmm6, factor, (~C).load(i+IT::size    ,j+1UL) ) );
+            (~C).store( i+IT::size*2UL, j+1UL, fnmadd( xmm7, factor, (~C).load(i+IT::size*2UL,j+1UL) ) );
+            (~C).store( i+IT::size*3UL, j+1UL, fnmadd( xmm8, factor, (~C).load(i+IT::size*3UL,j+1UL) ) );
          }
 
          if( j < N )
@@ -6018,16 +6044,16 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
-            (~C).store( i             , j, (~C).load(i             ,j) - xmm1 * factor );
-            (~C).store( i+IT::size    , j, (~C).load(i+IT::size    ,j) - xmm2 * factor );
-            (~C).store( i+IT::size*2UL, j, (~C).load(i+IT::size*2UL,j) - xmm3 * factor );
-            (~C).store( i+IT::size*3UL, j, (~C).load(i+IT::size*3UL,j) - xmm4 * factor );
+            (~C).store( i             , j, fnmadd( xmm1, factor, (~C).load(i             ,j) ) );
+            (~C).store( i+IT::size    , j, fnmadd( xmm2, factor, (~C).load(i+IT::size    ,j) ) );
+            (~C).store( i+IT::size*2UL, j, fnmadd( xmm3, factor, (~C).load(i+IT::size*2UL,j) ) );
+            (~C).store( i+IT::size*3UL, j, fnmadd( xmm4, factor, (~C).load(i+IT::size*3UL,j) ) );
          }
       }
 
@@ -6049,16 +6075,16 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a1 * b2;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a1, b2, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
-            (~C).store( i         , j    , (~C).load(i         ,j    ) - xmm1 * factor );
-            (~C).store( i+IT::size, j    , (~C).load(i+IT::size,j    ) - xmm2 * factor );
-            (~C).store( i         , j+1UL, (~C).load(i         ,j+1UL) - xmm3 * factor );
-            (~C).store( i+IT::size, j+1UL, (~C).load(i+IT::size,j+1UL) - xmm4 * factor );
+            (~C).store( i         , j    , fnmadd( xmm1, factor, (~C).load(i         ,j    ) ) );
+            (~C).store( i+IT::size, j    , fnmadd( xmm2, factor, (~C).load(i+IT::size,j    ) ) );
+            (~C).store( i         , j+1UL, fnmadd( xmm3, factor, (~C).load(i         ,j+1UL) ) );
+            (~C).store( i+IT::size, j+1UL, fnmadd( xmm4, factor, (~C).load(i+IT::size,j+1UL) ) );
          }
 
          if( j < N )
@@ -6071,12 +6097,12 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i         ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size,k) * b1;
+               xmm1 = fmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
-            (~C).store( i         , j, (~C).load(i         ,j) - xmm1 * factor );
-            (~C).store( i+IT::size, j, (~C).load(i+IT::size,j) - xmm2 * factor );
+            (~C).store( i         , j, fnmadd( xmm1, factor, (~C).load(i         ,j) ) );
+            (~C).store( i+IT::size, j, fnmadd( xmm2, factor, (~C).load(i+IT::size,j) ) );
          }
       }
 
@@ -6094,12 +6120,12 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * set( B(k,j    ) );
-               xmm2 = xmm2 + a1 * set( B(k,j+1UL) );
+               xmm1 = fmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
-            (~C).store( i, j    , (~C).load(i,j    ) - xmm1 * factor );
-            (~C).store( i, j+1UL, (~C).load(i,j+1UL) - xmm2 * factor );
+            (~C).store( i, j    , fnmadd( xmm1, factor, (~C).load(i,j    ) ) );
+            (~C).store( i, j+1UL, fnmadd( xmm2, factor, (~C).load(i,j+1UL) ) );
          }
 
          if( j < N )
@@ -6110,10 +6136,10 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + A.load(i,k) * set( B(k,j) );
+               xmm1 = fmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
-            (~C).store( i, j, (~C).load(i,j) - xmm1 * factor );
+            (~C).store( i, j, fnmadd( xmm1, factor, (~C).load(i,j) ) );
          }
       }
    }
@@ -6166,8 +6192,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, -scalar, true );
    }
    //**********************************************************************************************
 
@@ -6193,8 +6218,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, -scalar, true );
    }
    //**********************************************************************************************
 
@@ -6435,6 +6459,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
       RT B( right );  // Evaluation of the right-hand side dense matrix operand
 
@@ -6520,6 +6545,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
       RT B( right );  // Evaluation of the right-hand side dense matrix operand
 
@@ -6570,6 +6596,7 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2>, ST, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
       RT B( right );  // Evaluation of the right-hand side dense matrix operand
 
@@ -74,6 +74,7 @@
 #include <blaze/math/typetraits/Size.h>
 #include <blaze/system/BLAS.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/util/Arena.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/constraints/Reference.h>
@@ -452,6 +453,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( rhs.mat_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT x( serial( rhs.vec_ ) );  // Evaluation of the right-hand side dense vector operand
 
@@ -609,14 +611,14 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
          }
 
          y.store( i             , xmm1 );
@@ -639,10 +641,10 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
          }
 
          y.store( i             , xmm1 );
@@ -661,9 +663,9 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
          }
 
          y.store( i             , xmm1 );
@@ -681,8 +683,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i         ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+            xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
          }
 
          y.store( i         , xmm1 );
@@ -698,7 +700,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; ++j ) {
-            xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+            xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
          }
 
          y.store( i, xmm1 );
@@ -779,14 +781,14 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-                  xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-                  xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-                  xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-                  xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+                  xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+                  xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+                  xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+                  xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
                }
 
                y.store( i             , y.load(i             ) + xmm1 );
@@ -805,10 +807,10 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
                }
 
                y.store( i             , y.load(i             ) + xmm1 );
@@ -823,9 +825,9 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
                }
 
                y.store( i             , y.load(i             ) + xmm1 );
@@ -839,8 +841,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i         ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+                  xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
                }
 
                y.store( i         , y.load(i         ) + xmm1 );
@@ -852,7 +854,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
                IntrinsicType xmm1;
 
                for( size_t j=jj; j<jend; ++j ) {
-                  xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+                  xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
                }
 
                y.store( i, y.load(i) + xmm1 );
@@ -1074,6 +1076,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( rhs.mat_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT x( serial( rhs.vec_ ) );  // Evaluation of the right-hand side dense vector operand
 
@@ -1224,14 +1227,14 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
          }
 
          y.store( i             , xmm1 );
@@ -1257,10 +1260,10 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
          }
 
          y.store( i             , xmm1 );
@@ -1281,9 +1284,9 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
          }
 
          y.store( i             , xmm1 );
@@ -1302,8 +1305,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i         ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+            xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
          }
 
          y.store( i         , xmm1 );
@@ -1319,7 +1322,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
          IntrinsicType xmm1( y.load(i) );
 
          for( size_t j=jbegin; j<jend; ++j ) {
-            xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+            xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
          }
 
          y.store( i, xmm1 );
@@ -1398,14 +1401,14 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-                  xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-                  xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-                  xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-                  xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+                  xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+                  xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+                  xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+                  xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
                }
 
                y.store( i             , y.load(i             ) + xmm1 );
@@ -1424,10 +1427,10 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
                }
 
                y.store( i             , y.load(i             ) + xmm1 );
@@ -1442,9 +1445,9 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
                }
 
                y.store( i             , y.load(i             ) + xmm1 );
@@ -1458,8 +1461,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i         ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+                  xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
                }
 
                y.store( i         , y.load(i         ) + xmm1 );
@@ -1471,7 +1474,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
                IntrinsicType xmm1;
 
                for( size_t j=jj; j<jend; ++j ) {
-                  xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+                  xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
                }
 
                y.store( i, y.load(i) + xmm1 );
@@ -1671,6 +1674,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( rhs.mat_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT x( serial( rhs.vec_ ) );  // Evaluation of the right-hand side dense vector operand
 
@@ -1822,14 +1826,14 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 - A.load(i             ,j) * x1;
-            xmm2 = xmm2 - A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 - A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 - A.load(i+IT::size*3UL,j) * x1;
-            xmm5 = xmm5 - A.load(i+IT::size*4UL,j) * x1;
-            xmm6 = xmm6 - A.load(i+IT::size*5UL,j) * x1;
-            xmm7 = xmm7 - A.load(i+IT::size*6UL,j) * x1;
-            xmm8 = xmm8 - A.load(i+IT::size*7UL,j) * x1;
+            xmm1 = fnmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fnmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fnmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fnmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+            xmm5 = fnmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+            xmm6 = fnmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+            xmm7 = fnmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+            xmm8 = fnmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
          }
 
          y.store( i             , xmm1 );
@@ -1855,10 +1859,10 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 - A.load(i             ,j) * x1;
-            xmm2 = xmm2 - A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 - A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 - A.load(i+IT::size*3UL,j) * x1;
+            xmm1 = fnmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fnmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fnmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fnmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
          }
 
          y.store( i             , xmm1 );
@@ -1879,9 +1883,9 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 - A.load(i             ,j) * x1;
-            xmm2 = xmm2 - A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 - A.load(i+IT::size*2UL,j) * x1;
+            xmm1 = fnmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fnmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fnmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
          }
 
          y.store( i             , xmm1 );
@@ -1900,8 +1904,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 - A.load(i         ,j) * x1;
-            xmm2 = xmm2 - A.load(i+IT::size,j) * x1;
+            xmm1 = fnmadd( A.load(i         ,j), x1, xmm1 );
+            xmm2 = fnmadd( A.load(i+IT::size,j), x1, xmm2 );
          }
 
          y.store( i         , xmm1 );
@@ -1917,7 +1921,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
          IntrinsicType xmm1( y.load(i) );
 
          for( size_t j=jbegin; j<jend; ++j ) {
-            xmm1 = xmm1 - A.load(i,j) * set( x[j] );
+            xmm1 = fnmadd( A.load(i,j), set( x[j] ), xmm1 );
          }
 
          y.store( i, xmm1 );
@@ -1997,14 +2001,14 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-                  xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-                  xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-                  xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-                  xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+                  xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+                  xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+                  xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+                  xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
                }
 
                y.store( i             , y.load(i             ) - xmm1 );
@@ -2023,10 +2027,10 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
                }
 
                y.store( i             , y.load(i             ) - xmm1 );
@@ -2041,9 +2045,9 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
                }
 
                y.store( i             , y.load(i             ) - xmm1 );
@@ -2057,8 +2061,8 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i         ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+                  xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
                }
 
                y.store( i         , y.load(i         ) - xmm1 );
@@ -2070,7 +2074,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
                IntrinsicType xmm1;
 
                for( size_t j=jj; j<jend; ++j ) {
-                  xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+                  xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
                }
 
                y.store( i, y.load(i) - xmm1 );
@@ -2311,6 +2315,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( rhs.mat_ );  // Evaluation of the left-hand side dense matrix operand
       RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
 
@@ -2384,6 +2389,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( rhs.mat_ );  // Evaluation of the left-hand side dense matrix operand
       RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
 
@@ -2428,6 +2434,7 @@ class TDMatDVecMultExpr : public DenseVector< TDMatDVecMultExpr<MT,VT>, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( rhs.mat_ );  // Evaluation of the left-hand side dense matrix operand
       RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
 
@@ -2833,6 +2840,7 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
       RT x( serial( right ) );  // Evaluation of the right-hand side dense vector operand
 
@@ -2995,14 +3003,14 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
          }
 
          y.store( i             , xmm1*factor );
@@ -3025,10 +3033,10 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
          }
 
          y.store( i             , xmm1*factor );
@@ -3047,9 +3055,9 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
          }
 
          y.store( i             , xmm1*factor );
@@ -3067,8 +3075,8 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i         ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+            xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
          }
 
          y.store( i         , xmm1*factor );
@@ -3085,7 +3093,7 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i,j) * x1;
+            xmm1 = fmadd( A.load(i,j), x1, xmm1 );
          }
 
          y.store( i, xmm1*factor );
@@ -3168,24 +3176,24 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-                  xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-                  xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-                  xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-                  xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+                  xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+                  xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+                  xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+                  xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
                }
 
-               y.store( i             , y.load(i             ) + xmm1*factor );
-               y.store( i+IT::size    , y.load(i+IT::size    ) + xmm2*factor );
-               y.store( i+IT::size*2UL, y.load(i+IT::size*2UL) + xmm3*factor );
-               y.store( i+IT::size*3UL, y.load(i+IT::size*3UL) + xmm4*factor );
-               y.store( i+IT::size*4UL, y.load(i+IT::size*4UL) + xmm5*factor );
-               y.store( i+IT::size*5UL, y.load(i+IT::size*5UL) + xmm6*factor );
-               y.store( i+IT::size*6UL, y.load(i+IT::size*6UL) + xmm7*factor );
-               y.store( i+IT::size*7UL, y.load(i+IT::size*7UL) + xmm8*factor );
+               y.store( i             , fmadd( xmm1, factor, y.load(i             ) ) );
+               y.store( i+IT::size    , fmadd( xmm2, factor, y.load(i+IT::size    ) ) );
+               y.store( i+IT::size*2UL, fmadd( xmm3, factor, y.load(i+IT::size*2UL) ) );
+               y.store( i+IT::size*3UL, fmadd( xmm4, factor, y.load(i+IT::size*3UL) ) );
+               y.store( i+IT::size*4UL, fmadd( xmm5, factor, y.load(i+IT::size*4UL) ) );
+               y.store( i+IT::size*5UL, fmadd( xmm6, factor, y.load(i+IT::size*5UL) ) );
+               y.store( i+IT::size*6UL, fmadd( xmm7, factor, y.load(i+IT::size*6UL) ) );
+               y.store( i+IT::size*7UL, fmadd( xmm8, factor, y.load(i+IT::size*7UL) ) );
             }
 
             for( ; (i+IT::size*3UL) < iend; i+=IT::size*4UL )
@@ -3194,16 +3202,16 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
                }
 
-               y.store( i             , y.load(i             ) + xmm1*factor );
-               y.store( i+IT::size    , y.load(i+IT::size    ) + xmm2*factor );
-               y.store( i+IT::size*2UL, y.load(i+IT::size*2UL) + xmm3*factor );
-               y.store( i+IT::size*3UL, y.load(i+IT::size*3UL) + xmm4*factor );
+               y.store( i             , fmadd( xmm1, factor, y.load(i             ) ) );
+               y.store( i+IT::size    , fmadd( xmm2, factor, y.load(i+IT::size    ) ) );
+               y.store( i+IT::size*2UL, fmadd( xmm3, factor, y.load(i+IT::size*2UL) ) );
+               y.store( i+IT::size*3UL, fmadd( xmm4, factor, y.load(i+IT::size*3UL) ) );
             }
 
             for( ; (i+IT::size*2UL) < iend; i+=IT::size*3UL )
@@ -3212,14 +3220,14 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
                }
 
-               y.store( i             , y.load(i             ) + xmm1*factor );
-               y.store( i+IT::size    , y.load(i+IT::size    ) + xmm2*factor );
-               y.store( i+IT::size*2UL, y.load(i+IT::size*2UL) + xmm3*factor );
+               y.store( i             , fmadd( xmm1, factor, y.load(i             ) ) );
+               y.store( i+IT::size    , fmadd( xmm2, factor, y.load(i+IT::size    ) ) );
+               y.store( i+IT::size*2UL, fmadd( xmm3, factor, y.load(i+IT::size*2UL) ) );
             }
 
             for( ; (i+IT::size) < iend; i+=IT::size*2UL )
@@ -3228,12 +3236,12 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i         ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+                  xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
                }
 
-               y.store( i         , y.load(i         ) + xmm1*factor );
-               y.store( i+IT::size, y.load(i+IT::size) + xmm2*factor );
+               y.store( i         , fmadd( xmm1, factor, y.load(i         ) ) );
+               y.store( i+IT::size, fmadd( xmm2, factor, y.load(i+IT::size) ) );
             }
 
             if( i < iend )
@@ -3241,10 +3249,10 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
                IntrinsicType xmm1;
 
                for( size_t j=jj; j<jend; ++j ) {
-                  xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+                  xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
                }
 
-               y.store( i, y.load(i) + xmm1*factor );
+               y.store( i, fmadd( xmm1, factor, y.load(i) ) );
             }
          }
       }
@@ -3462,6 +3470,7 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
       RT x( serial( right ) );  // Evaluation of the right-hand side dense vector operand
 
@@ -3589,24 +3598,24 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
          }
 
-         y.store( i             , y.load(i             ) + xmm1*factor );
-         y.store( i+IT::size    , y.load(i+IT::size    ) + xmm2*factor );
-         y.store( i+IT::size*2UL, y.load(i+IT::size*2UL) + xmm3*factor );
-         y.store( i+IT::size*3UL, y.load(i+IT::size*3UL) + xmm4*factor );
-         y.store( i+IT::size*4UL, y.load(i+IT::size*4UL) + xmm5*factor );
-         y.store( i+IT::size*5UL, y.load(i+IT::size*5UL) + xmm6*factor );
-         y.store( i+IT::size*6UL, y.load(i+IT::size*6UL) + xmm7*factor );
-         y.store( i+IT::size*7UL, y.load(i+IT::size*7UL) + xmm8*factor );
+         y.store( i             , fmadd( xmm1, factor, y.load(i             ) ) );
+         y.store( i+IT::size    , fmadd( xmm2, factor, y.load(i+IT::size    ) ) );
+         y.store( i+IT::size*2UL, fmadd( xmm3, factor, y.load(i+IT::size*2UL) ) );
+         y.store( i+IT::size*3UL, fmadd( xmm4, factor, y.load(i+IT::size*3UL) ) );
+         y.store( i+IT::size*4UL, fmadd( xmm5, factor, y.load(i+IT::size*4UL) ) );
+         y.store( i+IT::size*5UL, fmadd( xmm6, factor, y.load(i+IT::size*5UL) ) );
+         y.store( i+IT::size*6UL, fmadd( xmm7, factor, y.load(i+IT::size*6UL) ) );
+         y.store( i+IT::size*7UL, fmadd( xmm8, factor, y.load(i+IT::size*7UL) ) );
       }
 
       for( ; (i+IT::size*3UL) < M; i+=IT::size*4UL )
@@ -3619,16 +3628,16 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
          }
 
-         y.store( i             , y.load(i             ) + xmm1*factor );
-         y.store( i+IT::size    , y.load(i+IT::size    ) + xmm2*factor );
-         y.store( i+IT::size*2UL, y.load(i+IT::size*2UL) + xmm3*factor );
-         y.store( i+IT::size*3UL, y.load(i+IT::size*3UL) + xmm4*factor );
+         y.store( i             , fmadd( xmm1, factor, y.load(i             ) ) );
+         y.store( i+IT::size    , fmadd( xmm2, factor, y.load(i+IT::size    ) ) );
+         y.store( i+IT::size*2UL, fmadd( xmm3, factor, y.load(i+IT::size*2UL) ) );
+         y.store( i+IT::size*3UL, fmadd( xmm4, factor, y.load(i+IT::size*3UL) ) );
       }
 
       for( ; (i+IT::size*2UL) < M; i+=IT::size*3UL )
@@ -3641,14 +3650,14 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
          }
 
-         y.store( i             , y.load(i             ) + xmm1*factor );
-         y.store( i+IT::size    , y.load(i+IT::size    ) + xmm2*factor );
-         y.store( i+IT::size*2UL, y.load(i+IT::size*2UL) + xmm3*factor );
+         y.store( i             , fmadd( xmm1, factor, y.load(i             ) ) );
+         y.store( i+IT::size    , fmadd( xmm2, factor, y.load(i+IT::size    ) ) );
+         y.store( i+IT::size*2UL, fmadd( xmm3, factor, y.load(i+IT::size*2UL) ) );
       }
 
       for( ; (i+IT::size) < M; i+=IT::size*2UL )
@@ -3661,12 +3670,12 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i         ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+            xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
          }
 
-         y.store( i         , y.load(i         ) + xmm1*factor );
-         y.store( i+IT::size, y.load(i+IT::size) + xmm2*factor );
+         y.store( i         , fmadd( xmm1, factor, y.load(i         ) ) );
+         y.store( i+IT::size, fmadd( xmm2, factor, y.load(i+IT::size) ) );
       }
 
       if( i < M )
@@ -3678,10 +3687,10 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; ++j ) {
-            xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+            xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
          }
 
-         y.store( i, y.load(i) + xmm1*factor );
+         y.store( i, fmadd( xmm1, factor, y.load(i) ) );
       }
    }
    //**********************************************************************************************
@@ -3760,24 +3769,24 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-                  xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-                  xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-                  xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-                  xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+                  xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+                  xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+                  xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+                  xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
                }
 
-               y.store( i             , y.load(i             ) + xmm1*factor );
-               y.store( i+IT::size    , y.load(i+IT::size    ) + xmm2*factor );
-               y.store( i+IT::size*2UL, y.load(i+IT::size*2UL) + xmm3*factor );
-               y.store( i+IT::size*3UL, y.load(i+IT::size*3UL) + xmm4*factor );
-               y.store( i+IT::size*4UL, y.load(i+IT::size*4UL) + xmm5*factor );
-               y.store( i+IT::size*5UL, y.load(i+IT::size*5UL) + xmm6*factor );
-               y.store( i+IT::size*6UL, y.load(i+IT::size*6UL) + xmm7*factor );
-               y.store( i+IT::size*7UL, y.load(i+IT::size*7UL) + xmm8*factor );
+               y.store( i             , fmadd( xmm1, factor, y.load(i             ) ) );
+               y.store( i+IT::size    , fmadd( xmm2, factor, y.load(i+IT::size    ) ) );
+               y.store( i+IT::size*2UL, fmadd( xmm3, factor, y.load(i+IT::size*2UL) ) );
+               y.store( i+IT::size*3UL, fmadd( xmm4, factor, y.load(i+IT::size*3UL) ) );
+               y.store( i+IT::size*4UL, fmadd( xmm5, factor, y.load(i+IT::size*4UL) ) );
+               y.store( i+IT::size*5UL, fmadd( xmm6, factor, y.load(i+IT::size*5UL) ) );
+               y.store( i+IT::size*6UL, fmadd( xmm7, factor, y.load(i+IT::size*6UL) ) );
+               y.store( i+IT::size*7UL, fmadd( xmm8, factor, y.load(i+IT::size*7UL) ) );
             }
 
             for( ; (i+IT::size*3UL) < iend; i+=IT::size*4UL )
@@ -3786,16 +3795,16 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
                }
 
-               y.store( i             , y.load(i             ) + xmm1*factor );
-               y.store( i+IT::size    , y.load(i+IT::size    ) + xmm2*factor );
-               y.store( i+IT::size*2UL, y.load(i+IT::size*2UL) + xmm3*factor );
-               y.store( i+IT::size*3UL, y.load(i+IT::size*3UL) + xmm4*factor );
+               y.store( i             , fmadd( xmm1, factor, y.load(i             ) ) );
+               y.store( i+IT::size    , fmadd( xmm2, factor, y.load(i+IT::size    ) ) );
+               y.store( i+IT::size*2UL, fmadd( xmm3, factor, y.load(i+IT::size*2UL) ) );
+               y.store( i+IT::size*3UL, fmadd( xmm4, factor, y.load(i+IT::size*3UL) ) );
             }
 
             for( ; (i+IT::size*2UL) < iend; i+=IT::size*3UL )
@@ -3804,14 +3813,14 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
                }
 
-               y.store( i             , y.load(i             ) + xmm1*factor );
-               y.store( i+IT::size    , y.load(i+IT::size    ) + xmm2*factor );
-               y.store( i+IT::size*2UL, y.load(i+IT::size*2UL) + xmm3*factor );
+               y.store( i             , fmadd( xmm1, factor, y.load(i             ) ) );
+               y.store( i+IT::size    , fmadd( xmm2, factor, y.load(i+IT::size    ) ) );
+               y.store( i+IT::size*2UL, fmadd( xmm3, factor, y.load(i+IT::size*2UL) ) );
             }
 
             for( ; (i+IT::size) < iend; i+=IT::size*2UL )
@@ -3820,12 +3829,12 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i         ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+                  xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
                }
 
-               y.store( i         , y.load(i         ) + xmm1*factor );
-               y.store( i+IT::size, y.load(i+IT::size) + xmm2*factor );
+               y.store( i         , fmadd( xmm1, factor, y.load(i         ) ) );
+               y.store( i+IT::size, fmadd( xmm2, factor, y.load(i+IT::size) ) );
             }
 
             if( i < iend )
@@ -3833,10 +3842,10 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
                IntrinsicType xmm1;
 
                for( size_t j=jj; j<jend; ++j ) {
-                  xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+                  xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
                }
 
-               y.store( i, y.load(i) + xmm1*factor );
+               y.store( i, fmadd( xmm1, factor, y.load(i) ) );
             }
          }
       }
@@ -4034,6 +4043,7 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
       RT x( serial( right ) );  // Evaluation of the right-hand side dense vector operand
 
@@ -4161,24 +4171,24 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-            xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-            xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-            xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-            xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+            xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+            xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+            xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+            xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
          }
 
-         y.store( i             , y.load(i             ) - xmm1*factor );
-         y.store( i+IT::size    , y.load(i+IT::size    ) - xmm2*factor );
-         y.store( i+IT::size*2UL, y.load(i+IT::size*2UL) - xmm3*factor );
-         y.store( i+IT::size*3UL, y.load(i+IT::size*3UL) - xmm4*factor );
-         y.store( i+IT::size*4UL, y.load(i+IT::size*4UL) - xmm5*factor );
-         y.store( i+IT::size*5UL, y.load(i+IT::size*5UL) - xmm6*factor );
-         y.store( i+IT::size*6UL, y.load(i+IT::size*6UL) - xmm7*factor );
-         y.store( i+IT::size*7UL, y.load(i+IT::size*7UL) - xmm8*factor );
+         y.store( i             , fnmadd( xmm1, factor, y.load(i             ) ) );
+         y.store( i+IT::size    , fnmadd( xmm2, factor, y.load(i+IT::size    ) ) );
+         y.store( i+IT::size*2UL, fnmadd( xmm3, factor, y.load(i+IT::size*2UL) ) );
+         y.store( i+IT::size*3UL, fnmadd( xmm4, factor, y.load(i+IT::size*3UL) ) );
+         y.store( i+IT::size*4UL, fnmadd( xmm5, factor, y.load(i+IT::size*4UL) ) );
+         y.store( i+IT::size*5UL, fnmadd( xmm6, factor, y.load(i+IT::size*5UL) ) );
+         y.store( i+IT::size*6UL, fnmadd( xmm7, factor, y.load(i+IT::size*6UL) ) );
+         y.store( i+IT::size*7UL, fnmadd( xmm8, factor, y.load(i+IT::size*7UL) ) );
       }
 
       for( ; (i+IT::size*3UL) < M; i+=IT::size*4UL )
@@ -4191,16 +4201,16 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-            xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+            xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
          }
 
-         y.store( i             , y.load(i             ) - xmm1*factor );
-         y.store( i+IT::size    , y.load(i+IT::size    ) - xmm2*factor );
-         y.store( i+IT::size*2UL, y.load(i+IT::size*2UL) - xmm3*factor );
-         y.store( i+IT::size*3UL, y.load(i+IT::size*3UL) - xmm4*factor );
+         y.store( i             , fnmadd( xmm1, factor, y.load(i             ) ) );
+         y.store( i+IT::size    , fnmadd( xmm2, factor, y.load(i+IT::size    ) ) );
+         y.store( i+IT::size*2UL, fnmadd( xmm3, factor, y.load(i+IT::size*2UL) ) );
+         y.store( i+IT::size*3UL, fnmadd( xmm4, factor, y.load(i+IT::size*3UL) ) );
       }
 
       for( ; (i+IT::size*2UL) < M; i+=IT::size*3UL )
@@ -4213,14 +4223,14 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i             ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-            xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+            xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+            xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
          }
 
-         y.store( i             , y.load(i             ) - xmm1*factor );
-         y.store( i+IT::size    , y.load(i+IT::size    ) - xmm2*factor );
-         y.store( i+IT::size*2UL, y.load(i+IT::size*2UL) - xmm3*factor );
+         y.store( i             , fnmadd( xmm1, factor, y.load(i             ) ) );
+         y.store( i+IT::size    , fnmadd( xmm2, factor, y.load(i+IT::size    ) ) );
+         y.store( i+IT::size*2UL, fnmadd( xmm3, factor, y.load(i+IT::size*2UL) ) );
       }
 
       for( ; (i+IT::size) < M; i+=IT::size*2UL )
@@ -4233,12 +4243,12 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
          for( size_t j=jbegin; j<jend; ++j ) {
             const IntrinsicType x1( set( x[j] ) );
-            xmm1 = xmm1 + A.load(i         ,j) * x1;
-            xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+            xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+            xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
          }
 
-         y.store( i         , y.load(i         ) - xmm1*factor );
-         y.store( i+IT::size, y.load(i+IT::size) - xmm2*factor );
+         y.store( i         , fnmadd( xmm1, factor, y.load(i         ) ) );
+         y.store( i+IT::size, fnmadd( xmm2, factor, y.load(i+IT::size) ) );
       }
       if( i < M )
       {
@@ -4249,10 +4259,10 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
          IntrinsicType xmm1;
 
          for( size_t j=jbegin; j<jend; ++j ) {
-            xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+            xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
          }
 
-         y.store( i, y.load(i) - xmm1*factor );
+         y.store( i, fnmadd( xmm1, factor, y.load(i) ) );
       }
    }
    //**********************************************************************************************
@@ -4331,24 +4341,24 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
-                  xmm5 = xmm5 + A.load(i+IT::size*4UL,j) * x1;
-                  xmm6 = xmm6 + A.load(i+IT::size*5UL,j) * x1;
-                  xmm7 = xmm7 + A.load(i+IT::size*6UL,j) * x1;
-                  xmm8 = xmm8 + A.load(i+IT::size*7UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
+                  xmm5 = fmadd( A.load(i+IT::size*4UL,j), x1, xmm5 );
+                  xmm6 = fmadd( A.load(i+IT::size*5UL,j), x1, xmm6 );
+                  xmm7 = fmadd( A.load(i+IT::size*6UL,j), x1, xmm7 );
+                  xmm8 = fmadd( A.load(i+IT::size*7UL,j), x1, xmm8 );
                }
 
-               y.store( i             , y.load(i             ) - xmm1*factor );
-               y.store( i+IT::size    , y.load(i+IT::size    ) - xmm2*factor );
-               y.store( i+IT::size*2UL, y.load(i+IT::size*2UL) - xmm3*factor );
-               y.store( i+IT::size*3UL, y.load(i+IT::size*3UL) - xmm4*factor );
-               y.store( i+IT::size*4UL, y.load(i+IT::size*4UL) - xmm5*factor );
-               y.store( i+IT::size*5UL, y.load(i+IT::size*5UL) - xmm6*factor );
-               y.store( i+IT::size*6UL, y.load(i+IT::size*6UL) - xmm7*factor );
-               y.store( i+IT::size*7UL, y.load(i+IT::size*7UL) - xmm8*factor );
+               y.store( i             , fnmadd( xmm1, factor, y.load(i             ) ) );
+               y.store( i+IT::size    , fnmadd( xmm2, factor, y.load(i+IT::size    ) ) );
+               y.store( i+IT::size*2UL, fnmadd( xmm3, factor, y.load(i+IT::size*2UL) ) );
+               y.store( i+IT::size*3UL, fnmadd( xmm4, factor, y.load(i+IT::size*3UL) ) );
+               y.store( i+IT::size*4UL, fnmadd( xmm5, factor, y.load(i+IT::size*4UL) ) );
+               y.store( i+IT::size*5UL, fnmadd( xmm6, factor, y.load(i+IT::size*5UL) ) );
+               y.store( i+IT::size*6UL, fnmadd( xmm7, factor, y.load(i+IT::size*6UL) ) );
+               y.store( i+IT::size*7UL, fnmadd( xmm8, factor, y.load(i+IT::size*7UL) ) );
             }
 
             for( ; (i+IT::size*3UL) < iend; i+=IT::size*4UL )
@@ -4357,16 +4367,16 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
-                  xmm4 = xmm4 + A.load(i+IT::size*3UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
+                  xmm4 = fmadd( A.load(i+IT::size*3UL,j), x1, xmm4 );
                }
 
-               y.store( i             , y.load(i             ) - xmm1*factor );
-               y.store( i+IT::size    , y.load(i+IT::size    ) - xmm2*factor );
-               y.store( i+IT::size*2UL, y.load(i+IT::size*2UL) - xmm3*factor );
-               y.store( i+IT::size*3UL, y.load(i+IT::size*3UL) - xmm4*factor );
+               y.store( i             , fnmadd( xmm1, factor, y.load(i             ) ) );
+               y.store( i+IT::size    , fnmadd( xmm2, factor, y.load(i+IT::size    ) ) );
+               y.store( i+IT::size*2UL, fnmadd( xmm3, factor, y.load(i+IT::size*2UL) ) );
+               y.store( i+IT::size*3UL, fnmadd( xmm4, factor, y.load(i+IT::size*3UL) ) );
             }
 
             for( ; (i+IT::size*2UL) < iend; i+=IT::size*3UL )
@@ -4375,14 +4385,14 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i             ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size    ,j) * x1;
-                  xmm3 = xmm3 + A.load(i+IT::size*2UL,j) * x1;
+                  xmm1 = fmadd( A.load(i             ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size    ,j), x1, xmm2 );
+                  xmm3 = fmadd( A.load(i+IT::size*2UL,j), x1, xmm3 );
                }
 
-               y.store( i             , y.load(i             ) - xmm1*factor );
-               y.store( i+IT::size    , y.load(i+IT::size    ) - xmm2*factor );
-               y.store( i+IT::size*2UL, y.load(i+IT::size*2UL) - xmm3*factor );
+               y.store( i             , fnmadd( xmm1, factor, y.load(i             ) ) );
+               y.store( i+IT::size    , fnmadd( xmm2, factor, y.load(i+IT::size    ) ) );
+               y.store( i+IT::size*2UL, fnmadd( xmm3, factor, y.load(i+IT::size*2UL) ) );
             }
 
             for( ; (i+IT::size) < iend; i+=IT::size*2UL )
@@ -4391,12 +4401,12 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 
                for( size_t j=jj; j<jend; ++j ) {
                   const IntrinsicType x1( set( x[j] ) );
-                  xmm1 = xmm1 + A.load(i         ,j) * x1;
-                  xmm2 = xmm2 + A.load(i+IT::size,j) * x1;
+                  xmm1 = fmadd( A.load(i         ,j), x1, xmm1 );
+                  xmm2 = fmadd( A.load(i+IT::size,j), x1, xmm2 );
                }
 
-               y.store( i         , y.load(i         ) - xmm1*factor );
-               y.store( i+IT::size, y.load(i+IT::size) - xmm2*factor );
+               y.store( i         , fnmadd( xmm1, factor, y.load(i         ) ) );
+               y.store( i+IT::size, fnmadd( xmm2, factor, y.load(i+IT::size) ) );
             }
 
             if( i < iend )
@@ -4404,10 +4414,10 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
                IntrinsicType xmm1;
 
                for( size_t j=jj; j<jend; ++j ) {
-                  xmm1 = xmm1 + A.load(i,j) * set( x[j] );
+                  xmm1 = fmadd( A.load(i,j), set( x[j] ), xmm1 );
                }
 
-               y.store( i, y.load(i) - xmm1*factor );
+               y.store( i, fnmadd( xmm1, factor, y.load(i) ) );
             }
          }
       }
@@ -4644,6 +4654,7 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
       RT x( right );  // Evaluation of the right-hand side dense vector operand
 
@@ -4716,6 +4727,7 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
       RT x( right );  // Evaluation of the right-hand side dense vector operand
 
@@ -4761,6 +4773,7 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
       RT x( right );  // Evaluation of the right-hand side dense vector operand
 
@@ -45,6 +45,8 @@
 #include <blaze/math/constraints/DenseMatrix.h>
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/dense/MatrixChain.h>
+#include <blaze/math/dense/MMM.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
@@ -85,6 +87,7 @@
 #include <blaze/math/typetraits/Rows.h>
 #include <blaze/system/BLAS.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/util/Arena.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/constraints/Numeric.h>
@@ -497,6 +500,11 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
          return;
       }
 
+      if( reorderChain<ChainAssign>( ~lhs, rhs.lhs_, rhs.rhs_ ) ) {
+         return;
+      }
+
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -705,14 +713,14 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 + A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 + A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 + A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 + A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -746,14 +754,14 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a3 * b1;
-               xmm4 = xmm4 + a4 * b1;
-               xmm5 = xmm5 + a1 * b2;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a3 * b2;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a3, b1, xmm3 );
+               xmm4 = fmadd( a4, b1, xmm4 );
+               xmm5 = fmadd( a1, b2, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a3, b2, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C).store( i             , j    , xmm1 );
@@ -776,10 +784,10 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -807,10 +815,10 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a1 * b2;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a1, b2, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i         , j    , xmm1 );
@@ -829,8 +837,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i         ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size,k) * b1;
+               xmm1 = fmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
             (~C).store( i         , j, xmm1 );
@@ -852,8 +860,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * set( B(k,j    ) );
-               xmm2 = xmm2 + a1 * set( B(k,j+1UL) );
+               xmm1 = fmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
             (~C).store( i, j    , xmm1 );
@@ -868,7 +876,7 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + A.load(i,k) * set( B(k,j) );
+               xmm1 = fmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -924,7 +932,7 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      selectSmallAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(1), false );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -950,8 +958,7 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(1), false );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1238,6 +1245,11 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
          return;
       }
 
+      if( reorderChain<ChainAddAssign>( ~lhs, rhs.lhs_, rhs.rhs_ ) ) {
+         return;
+      }
+
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -1445,14 +1457,14 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 + A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 + A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 + A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 + A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -1493,14 +1505,14 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a3 * b1;
-               xmm4 = xmm4 + a4 * b1;
-               xmm5 = xmm5 + a1 * b2;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a3 * b2;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a3, b1, xmm3 );
+               xmm4 = fmadd( a4, b1, xmm4 );
+               xmm5 = fmadd( a1, b2, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a3, b2, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C).store( i             , j    , xmm1 );
@@ -1526,10 +1538,10 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -1560,10 +1572,10 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a1 * b2;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a1, b2, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i         , j    , xmm1 );
@@ -1583,8 +1595,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i         ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size,k) * b1;
+               xmm1 = fmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
             (~C).store( i         , j, xmm1 );
@@ -1607,8 +1619,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * set( B(k,j    ) );
-               xmm2 = xmm2 + a1 * set( B(k,j+1UL) );
+               xmm1 = fmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
             (~C).store( i, j    , xmm1 );
@@ -1623,7 +1635,7 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
             IntrinsicType xmm1( (~C).load(i,j) );
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + A.load(i,k) * set( B(k,j) );
+               xmm1 = fmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -1679,7 +1691,7 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      selectSmallAddAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(1), true );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1705,8 +1717,7 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(1), true );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1967,6 +1978,11 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
          return;
       }
 
+      if( reorderChain<ChainSubAssign>( ~lhs, rhs.lhs_, rhs.rhs_ ) ) {
+         return;
+      }
+
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -2174,14 +2190,14 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 - A.load(i             ,k) * b1;
-               xmm2 = xmm2 - A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 - A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 - A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 - A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 - A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 - A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 - A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fnmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fnmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fnmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fnmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fnmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fnmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fnmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fnmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -2222,14 +2238,14 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 - a1 * b1;
-               xmm2 = xmm2 - a2 * b1;
-               xmm3 = xmm3 - a3 * b1;
-               xmm4 = xmm4 - a4 * b1;
-               xmm5 = xmm5 - a1 * b2;
-               xmm6 = xmm6 - a2 * b2;
-               xmm7 = xmm7 - a3 * b2;
-               xmm8 = xmm8 - a4 * b2;
+               xmm1 = fnmadd( a1, b1, xmm1 );
+               xmm2 = fnmadd( a2, b1, xmm2 );
+               xmm3 = fnmadd( a3, b1, xmm3 );
+               xmm4 = fnmadd( a4, b1, xmm4 );
+               xmm5 = fnmadd( a1, b2, xmm5 );
+               xmm6 = fnmadd( a2, b2, xmm6 );
+               xmm7 = fnmadd( a3, b2, xmm7 );
+               xmm8 = fnmadd( a4, b2, xmm8 );
             }
 
             (~C).store( i             , j    , xmm1 );
@@ -2255,10 +2271,10 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 - A.load(i             ,k) * b1;
-               xmm2 = xmm2 - A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 - A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 - A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fnmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fnmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fnmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fnmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
             (~C).store( i             , j, xmm1 );
@@ -2289,10 +2305,10 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 - a1 * b1;
-               xmm2 = xmm2 - a2 * b1;
-               xmm3 = xmm3 - a1 * b2;
-               xmm4 = xmm4 - a2 * b2;
+               xmm1 = fnmadd( a1, b1, xmm1 );
+               xmm2 = fnmadd( a2, b1, xmm2 );
+               xmm3 = fnmadd( a1, b2, xmm3 );
+               xmm4 = fnmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i         , j    , xmm1 );
@@ -2312,8 +2328,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 - A.load(i         ,k) * b1;
-               xmm2 = xmm2 - A.load(i+IT::size,k) * b1;
+               xmm1 = fnmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fnmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
             (~C).store( i         , j, xmm1 );
@@ -2336,8 +2352,8 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 - a1 * set( B(k,j    ) );
-               xmm2 = xmm2 - a1 * set( B(k,j+1UL) );
+               xmm1 = fnmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fnmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
             (~C).store( i, j    , xmm1 );
@@ -2352,7 +2368,7 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
             IntrinsicType xmm1( (~C).load(i,j) );
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 - A.load(i,k) * set( B(k,j) );
+               xmm1 = fnmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
             (~C).store( i, j, xmm1 );
@@ -2408,7 +2424,7 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
    {
-      selectSmallSubAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(-1), true );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2434,8 +2450,7 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B );
+      mmm( ~C, A, B, ElementType(-1), true );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2712,6 +2727,11 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
          return;
       }
 
+      if( reorderChain<ChainSMPAssign>( ~lhs, rhs.lhs_, rhs.rhs_ ) ) {
+         return;
+      }
+
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -2834,6 +2854,11 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
          return;
       }
 
+      if( reorderChain<ChainSMPAddAssign>( ~lhs, rhs.lhs_, rhs.rhs_ ) ) {
+         return;
+      }
+
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -2920,6 +2945,11 @@ class TDMatTDMatMultExpr : public DenseMatrix< TDMatTDMatMultExpr<MT1,MT2>, true
          return;
       }
 
+      if( reorderChain<ChainSMPSubAssign>( ~lhs, rhs.lhs_, rhs.rhs_ ) ) {
+         return;
+      }
+
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
       RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -3363,6 +3393,7 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -3581,14 +3612,14 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 + A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 + A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 + A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 + A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
             (~C).store( i             , j, xmm1 * factor );
@@ -3622,14 +3653,14 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a3 * b1;
-               xmm4 = xmm4 + a4 * b1;
-               xmm5 = xmm5 + a1 * b2;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a3 * b2;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a3, b1, xmm3 );
+               xmm4 = fmadd( a4, b1, xmm4 );
+               xmm5 = fmadd( a1, b2, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a3, b2, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
             (~C).store( i             , j    , xmm1 * factor );
@@ -3652,10 +3683,10 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
             (~C).store( i             , j, xmm1 * factor );
@@ -3683,10 +3714,10 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a1 * b2;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a1, b2, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
             (~C).store( i         , j    , xmm1 * factor );
@@ -3705,8 +3736,8 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i         ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size,k) * b1;
+               xmm1 = fmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
             (~C).store( i         , j, xmm1 * factor );
@@ -3728,8 +3759,8 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * set( B(k,j    ) );
-               xmm2 = xmm2 + a1 * set( B(k,j+1UL) );
+               xmm1 = fmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
             (~C).store( i, j    , xmm1 * factor );
@@ -3744,7 +3775,7 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + A.load(i,k) * set( B(k,j) );
+               xmm1 = fmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
             (~C).store( i, j, xmm1 * factor );
@@ -3800,7 +3831,7 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      selectSmallAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, scalar, false );
    }
    //**********************************************************************************************
 
@@ -3826,8 +3857,7 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, scalar, false );
    }
    //**********************************************************************************************
 
@@ -4113,6 +4143,7 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -4289,24 +4320,24 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 + A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 + A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 + A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 + A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
-            (~C).store( i             , j, (~C).load(i             ,j) + xmm1 * factor );
-            (~C).store( i+IT::size    , j, (~C).load(i+IT::size    ,j) + xmm2 * factor );
-            (~C).store( i+IT::size*2UL, j, (~C).load(i+IT::size*2UL,j) + xmm3 * factor );
-            (~C).store( i+IT::size*3UL, j, (~C).load(i+IT::size*3UL,j) + xmm4 * factor );
-            (~C).store( i+IT::size*4UL, j, (~C).load(i+IT::size*4UL,j) + xmm5 * factor );
-            (~C).store( i+IT::size*5UL, j, (~C).load(i+IT::size*5UL,j) + xmm6 * factor );
-            (~C).store( i+IT::size*6UL, j, (~C).load(i+IT::size*6UL,j) + xmm7 * factor );
-            (~C).store( i+IT::size*7UL, j, (~C).load(i+IT::size*7UL,j) + xmm8 * factor );
+            (~C).store( i             , j, fmadd( xmm1, factor, (~C).load(i             ,j) ) );
+            (~C).store( i+IT::size    , j, fmadd( xmm2, factor, (~C).load(i+IT::size    ,j) ) );
+            (~C).store( i+IT::size*2UL, j, fmadd( xmm3, factor, (~C).load(i+IT::size*2UL,j) ) );
+            (~C).store( i+IT::size*3UL, j, fmadd( xmm4, factor, (~C).load(i+IT::size*3UL,j) ) );
+            (~C).store( i+IT::size*4UL, j, fmadd( xmm5, factor, (~C).load(i+IT::size*4UL,j) ) );
+            (~C).store( i+IT::size*5UL, j, fmadd( xmm6, factor, (~C).load(i+IT::size*5UL,j) ) );
+            (~C).store( i+IT::size*6UL, j, fmadd( xmm7, factor, (~C).load(i+IT::size*6UL,j) ) );
+            (~C).store( i+IT::size*7UL, j, fmadd( xmm8, factor, (~C).load(i+IT::size*7UL,j) ) );
          }
       }
 
@@ -4330,24 +4361,24 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a3 * b1;
-               xmm4 = xmm4 + a4 * b1;
-               xmm5 = xmm5 + a1 * b2;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a3 * b2;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a3, b1, xmm3 );
+               xmm4 = fmadd( a4, b1, xmm4 );
+               xmm5 = fmadd( a1, b2, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a3, b2, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
-            (~C).store( i             , j    , (~C).load(i             ,j    ) + xmm1 * factor );
-            (~C).store( i+IT::size    , j    , (~C).load(i+IT::size    ,j    ) + xmm2 * factor );
-            (~C).store( i+IT::size*2UL, j    , (~C).load(i+IT::size*2UL,j    ) + xmm3 * factor );
-            (~C).store( i+IT::size*3UL, j    , (~C).load(i+IT::size*3UL,j    ) + xmm4 * factor );
-            (~C).store( i             , j+1UL, (~C).load(i             ,j+1UL) + xmm5 * factor );
-            (~C).store( i+IT::size    , j+1UL, (~C).load(i+IT::size    ,j+1UL) + xmm6 * factor );
-            (~C).store( i+IT::size*2UL, j+1UL, (~C).load(i+IT::size*2UL,j+1UL) + xmm7 * factor );
-            (~C).store( i+IT::size*3UL, j+1UL, (~C).load(i+IT::size*3UL,j+1UL) + xmm8 * factor );
+            (~C).store( i             , j    , fmadd( xmm1, factor, (~C).load(i             ,j    ) ) );
+            (~C).store( i+IT::size    , j    , fmadd( xmm2, factor, (~C).load(i+IT::size    ,j    ) ) );
+            (~C).store( i+IT::size*2UL, j    , fmadd( xmm3, factor, (~C).load(i+IT::size*2UL,j    ) ) );
+            (~C).store( i+IT::size*3UL, j    , fmadd( xmm4, factor, (~C).load(i+IT::size*3UL,j    ) ) );
+            (~C).store( i             , j+1UL, fmadd( xmm5, factor, (~C).load(i             ,j+1UL) ) );
+            (~C).store( i+IT::size    , j+1UL, fmadd( xmm6, factor, (~C).load(i+IT::size    ,j+1UL) ) );
+            (~C).store( i+IT::size*2UL, j+1UL, fmadd( xmm7, factor, (~C).load(i+IT::size*2UL,j+1UL) ) );
+            (~C).store( i+IT::size*3UL, j+1UL, fmadd( xmm8, factor, (~C).load(i+IT::size*3UL,j+1UL) ) );
          }
 
          if( j < N )
@@ -4360,16 +4391,16 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
-            (~C).store( i             , j, (~C).load(i             ,j) + xmm1 * factor );
-            (~C).store( i+IT::size    , j, (~C).load(i+IT::size    ,j) + xmm2 * factor );
-            (~C).store( i+IT::size*2UL, j, (~C).load(i+IT::size*2UL,j) + xmm3 * factor );
-            (~C).store( i+IT::size*3UL, j, (~C).load(i+IT::size*3UL,j) + xmm4 * factor );
+            (~C).store( i             , j, fmadd( xmm1, factor, (~C).load(i             ,j) ) );
+            (~C).store( i+IT::size    , j, fmadd( xmm2, factor, (~C).load(i+IT::size    ,j) ) );
+            (~C).store( i+IT::size*2UL, j, fmadd( xmm3, factor, (~C).load(i+IT::size*2UL,j) ) );
+            (~C).store( i+IT::size*3UL, j, fmadd( xmm4, factor, (~C).load(i+IT::size*3UL,j) ) );
          }
       }
 
@@ -4391,16 +4422,16 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a1 * b2;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a1, b2, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
-            (~C).store( i         , j    , (~C).load(i         ,j    ) + xmm1 * factor );
-            (~C).store( i+IT::size, j    , (~C).load(i+IT::size,j    ) + xmm2 * factor );
-            (~C).store( i         , j+1UL, (~C).load(i         ,j+1UL) + xmm3 * factor );
-            (~C).store( i+IT::size, j+1UL, (~C).load(i+IT::size,j+1UL) + xmm4 * factor );
+            (~C).store( i         , j    , fmadd( xmm1, factor, (~C).load(i         ,j    ) ) );
+            (~C).store( i+IT::size, j    , fmadd( xmm2, factor, (~C).load(i+IT::size,j    ) ) );
+            (~C).store( i         , j+1UL, fmadd( xmm3, factor, (~C).load(i         ,j+1UL) ) );
+            (~C).store( i+IT::size, j+1UL, fmadd( xmm4, factor, (~C).load(i+IT::size,j+1UL) ) );
          }
 
          if( j < N )
@@ -4413,12 +4444,12 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i         ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size,k) * b1;
+               xmm1 = fmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
-            (~C).store( i         , j, (~C).load(i         ,j) + xmm1 * factor );
-            (~C).store( i+IT::size, j, (~C).load(i+IT::size,j) + xmm2 * factor );
+            (~C).store( i         , j, fmadd( xmm1, factor, (~C).load(i         ,j) ) );
+            (~C).store( i+IT::size, j, fmadd( xmm2, factor, (~C).load(i+IT::size,j) ) );
          }
       }
 
@@ -4436,12 +4467,12 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * set( B(k,j    ) );
-               xmm2 = xmm2 + a1 * set( B(k,j+1UL) );
+               xmm1 = fmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
-            (~C).store( i, j    , (~C).load(i,j    ) + xmm1 * factor );
-            (~C).store( i, j+1UL, (~C).load(i,j+1UL) + xmm2 * factor );
+            (~C).store( i, j    , fmadd( xmm1, factor, (~C).load(i,j    ) ) );
+            (~C).store( i, j+1UL, fmadd( xmm2, factor, (~C).load(i,j+1UL) ) );
          }
 
          if( j < N )
@@ -4452,10 +4483,10 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + A.load(i,k) * set( B(k,j) );
+               xmm1 = fmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
-            (~C).store( i, j, (~C).load(i,j) + xmm1 * factor );
+            (~C).store( i, j, fmadd( xmm1, factor, (~C).load(i,j) ) );
          }
       }
    }
@@ -4508,7 +4539,7 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      selectSmallAddAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, scalar, true );
    }
    //**********************************************************************************************
 
@@ -4534,8 +4565,7 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallAddAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, scalar, true );
    }
    //**********************************************************************************************
 
@@ -4799,6 +4829,7 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( serial( left  ) );  // Evaluation of the left-hand side dense matrix operand
       RT B( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -4975,24 +5006,24 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
-               xmm5 = xmm5 + A.load(i+IT::size*4UL,k) * b1;
-               xmm6 = xmm6 + A.load(i+IT::size*5UL,k) * b1;
-               xmm7 = xmm7 + A.load(i+IT::size*6UL,k) * b1;
-               xmm8 = xmm8 + A.load(i+IT::size*7UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
+               xmm5 = fmadd( A.load(i+IT::size*4UL,k), b1, xmm5 );
+               xmm6 = fmadd( A.load(i+IT::size*5UL,k), b1, xmm6 );
+               xmm7 = fmadd( A.load(i+IT::size*6UL,k), b1, xmm7 );
+               xmm8 = fmadd( A.load(i+IT::size*7UL,k), b1, xmm8 );
             }
 
-            (~C).store( i             , j, (~C).load(i             ,j) - xmm1 * factor );
-            (~C).store( i+IT::size    , j, (~C).load(i+IT::size    ,j) - xmm2 * factor );
-            (~C).store( i+IT::size*2UL, j, (~C).load(i+IT::size*2UL,j) - xmm3 * factor );
-            (~C).store( i+IT::size*3UL, j, (~C).load(i+IT::size*3UL,j) - xmm4 * factor );
-            (~C).store( i+IT::size*4UL, j, (~C).load(i+IT::size*4UL,j) - xmm5 * factor );
-            (~C).store( i+IT::size*5UL, j, (~C).load(i+IT::size*5UL,j) - xmm6 * factor );
-            (~C).store( i+IT::size*6UL, j, (~C).load(i+IT::size*6UL,j) - xmm7 * factor );
-            (~C).store( i+IT::size*7UL, j, (~C).load(i+IT::size*7UL,j) - xmm8 * factor );
+            (~C).store( i             , j, fnmadd( xmm1, factor, (~C).load(i             ,j) ) );
+            (~C).store( i+IT::size    , j, fnmadd( xmm2, factor, (~C).load(i+IT::size    ,j) ) );
+            (~C).store( i+IT::size*2UL, j, fnmadd( xmm3, factor, (~C).load(i+IT::size*2UL,j) ) );
+            (~C).store( i+IT::size*3UL, j, fnmadd( xmm4, factor, (~C).load(i+IT::size*3UL,j) ) );
+            (~C).store( i+IT::size*4UL, j, fnmadd( xmm5, factor, (~C).load(i+IT::size*4UL,j) ) );
+            (~C).store( i+IT::size*5UL, j, fnmadd( xmm6, factor, (~C).load(i+IT::size*5UL,j) ) );
+            (~C).store( i+IT::size*6UL, j, fnmadd( xmm7, factor, (~C).load(i+IT::size*6UL,j) ) );
+            (~C).store( i+IT::size*7UL, j, fnmadd( xmm8, factor, (~C).load(i+IT::size*7UL,j) ) );
          }
       }
 
@@ -5016,24 +5047,24 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a4( A.load(i+IT::size*3UL,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a3 * b1;
-               xmm4 = xmm4 + a4 * b1;
-               xmm5 = xmm5 + a1 * b2;
-               xmm6 = xmm6 + a2 * b2;
-               xmm7 = xmm7 + a3 * b2;
-               xmm8 = xmm8 + a4 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a3, b1, xmm3 );
+               xmm4 = fmadd( a4, b1, xmm4 );
+               xmm5 = fmadd( a1, b2, xmm5 );
+               xmm6 = fmadd( a2, b2, xmm6 );
+               xmm7 = fmadd( a3, b2, xmm7 );
+               xmm8 = fmadd( a4, b2, xmm8 );
             }
 
-            (~C).store( i             , j    , (~C).load(i             ,j    ) - xmm1 * factor );
-            (~C).store( i+IT::size    , j    , (~C).load(i+IT::size    ,j    ) - xmm2 * factor );
-            (~C).store( i+IT::size*2UL, j    , (~C).load(i+IT::size*2UL,j    ) - xmm3 * factor );
-            (~C).store( i+IT::size*3UL, j    , (~C).load(i+IT::size*3UL,j    ) - xmm4 * factor );
-            (~C).store( i             , j+1UL, (~C).load(i             ,j+1UL) - xmm5 * factor );
-            (~C).store( i+IT::size    , j+1UL, (~C).load(i+IT::size    ,j+1UL) - xmm6 * factor );
-            (~C).store( i+IT::size*2UL, j+1UL, (~C).load(i+IT::size*2UL,j+1UL) - xmm7 * factor );
-            (~C).store( i+IT::size*3UL, j+1UL, (~C).load(i+IT::size*3UL,j+1UL) - xmm8 * factor );
+            (~C).store( i             , j    , fnmadd( xmm1, factor, (~C).load(i             ,j    ) ) );
+            (~C).store( i+IT::size    , j    , fnmadd( xmm2, factor, (~C).load(i+IT::size    ,j    ) ) );
+            (~C).store( i+IT::size*2UL, j    , fnmadd( xmm3, factor, (~C).load(i+IT::size*2UL,j    ) ) );
+            (~C).store( i+IT::size*3UL, j    , fnmadd( xmm4, factor, (~C).load(i+IT::size*3UL,j    ) ) );
+            (~C).store( i             , j+1UL, fnmadd( xmm5, factor, (~C).load(i             ,j+1UL) ) );
+            (~C).store( i+IT::size    , j+1UL, fnmadd( xmm6, factor, (~C).load(i+IT::size    ,j+1UL) ) );
+            (~C).store( i+IT::size*2UL, j+1UL, fnmadd( xmm7, factor, (~C).load(i+IT::size*2UL,j+1UL) ) );
+            (~C).store( i+IT::size*3UL, j+1UL, fnmadd( xmm8, factor, (~C).load(i+IT::size*3UL,j+1UL) ) );
          }
 
          if( j < N )
@@ -5046,16 +5077,16 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i             ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size    ,k) * b1;
-               xmm3 = xmm3 + A.load(i+IT::size*2UL,k) * b1;
-               xmm4 = xmm4 + A.load(i+IT::size*3UL,k) * b1;
+               xmm1 = fmadd( A.load(i             ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size    ,k), b1, xmm2 );
+               xmm3 = fmadd( A.load(i+IT::size*2UL,k), b1, xmm3 );
+               xmm4 = fmadd( A.load(i+IT::size*3UL,k), b1, xmm4 );
             }
 
-            (~C).store( i             , j, (~C).load(i             ,j) - xmm1 * factor );
-            (~C).store( i+IT::size    , j, (~C).load(i+IT::size    ,j) - xmm2 * factor );
-            (~C).store( i+IT::size*2UL, j, (~C).load(i+IT::size*2UL,j) - xmm3 * factor );
-            (~C).store( i+IT::size*3UL, j, (~C).load(i+IT::size*3UL,j) - xmm4 * factor );
+            (~C).store( i             , j, fnmadd( xmm1, factor, (~C).load(i             ,j) ) );
+            (~C).store( i+IT::size    , j, fnmadd( xmm2, factor, (~C).load(i+IT::size    ,j) ) );
+            (~C).store( i+IT::size*2UL, j, fnmadd( xmm3, factor, (~C).load(i+IT::size*2UL,j) ) );
+            (~C).store( i+IT::size*3UL, j, fnmadd( xmm4, factor, (~C).load(i+IT::size*3UL,j) ) );
          }
       }
 
@@ -5077,16 +5108,16 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
                const IntrinsicType a2( A.load(i+IT::size,k) );
                const IntrinsicType b1( set( B(k,j    ) ) );
                const IntrinsicType b2( set( B(k,j+1UL) ) );
-               xmm1 = xmm1 + a1 * b1;
-               xmm2 = xmm2 + a2 * b1;
-               xmm3 = xmm3 + a1 * b2;
-               xmm4 = xmm4 + a2 * b2;
+               xmm1 = fmadd( a1, b1, xmm1 );
+               xmm2 = fmadd( a2, b1, xmm2 );
+               xmm3 = fmadd( a1, b2, xmm3 );
+               xmm4 = fmadd( a2, b2, xmm4 );
             }
 
-            (~C).store( i         , j    , (~C).load(i         ,j    ) - xmm1 * factor );
-            (~C).store( i+IT::size, j    , (~C).load(i+IT::size,j    ) - xmm2 * factor );
-            (~C).store( i         , j+1UL, (~C).load(i         ,j+1UL) - xmm3 * factor );
-            (~C).store( i+IT::size, j+1UL, (~C).load(i+IT::size,j+1UL) - xmm4 * factor );
+            (~C).store( i         , j    , fnmadd( xmm1, factor, (~C).load(i         ,j    ) ) );
+            (~C).store( i+IT::size, j    , fnmadd( xmm2, factor, (~C).load(i+IT::size,j    ) ) );
+            (~C).store( i         , j+1UL, fnmadd( xmm3, factor, (~C).load(i         ,j+1UL) ) );
+            (~C).store( i+IT::size, j+1UL, fnmadd( xmm4, factor, (~C).load(i+IT::size,j+1UL) ) );
          }
 
          if( j < N )
@@ -5099,12 +5130,12 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType b1( set( B(k,j) ) );
-               xmm1 = xmm1 + A.load(i         ,k) * b1;
-               xmm2 = xmm2 + A.load(i+IT::size,k) * b1;
+               xmm1 = fmadd( A.load(i         ,k), b1, xmm1 );
+               xmm2 = fmadd( A.load(i+IT::size,k), b1, xmm2 );
             }
 
-            (~C).store( i         , j, (~C).load(i         ,j) - xmm1 * factor );
-            (~C).store( i+IT::size, j, (~C).load(i+IT::size,j) - xmm2 * factor );
+            (~C).store( i         , j, fnmadd( xmm1, factor, (~C).load(i         ,j) ) );
+            (~C).store( i+IT::size, j, fnmadd( xmm2, factor, (~C).load(i+IT::size,j) ) );
          }
       }
 
@@ -5122,12 +5153,12 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
 
             for( size_t k=kbegin; k<kend; ++k ) {
                const IntrinsicType a1( A.load(i,k) );
-               xmm1 = xmm1 + a1 * set( B(k,j    ) );
-               xmm2 = xmm2 + a1 * set( B(k,j+1UL) );
+               xmm1 = fmadd( a1, set( B(k,j    ) ), xmm1 );
+               xmm2 = fmadd( a1, set( B(k,j+1UL) ), xmm2 );
             }
 
-            (~C).store( i, j    , (~C).load(i,j    ) - xmm1 * factor );
-            (~C).store( i, j+1UL, (~C).load(i,j+1UL) - xmm2 * factor );
+            (~C).store( i, j    , fnmadd( xmm1, factor, (~C).load(i,j    ) ) );
+            (~C).store( i, j+1UL, fnmadd( xmm2, factor, (~C).load(i,j+1UL) ) );
          }
 
          if( j < N )
@@ -5138,10 +5169,10 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
             IntrinsicType xmm1;
 
             for( size_t k=kbegin; k<K; ++k ) {
-               xmm1 = xmm1 + A.load(i,k) * set( B(k,j) );
+               xmm1 = fmadd( A.load(i,k), set( B(k,j) ), xmm1 );
             }
 
-            (~C).store( i, j, (~C).load(i,j) - xmm1 * factor );
+            (~C).store( i, j, fnmadd( xmm1, factor, (~C).load(i,j) ) );
          }
       }
    }
@@ -5194,7 +5225,7 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      selectSmallSubAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, -scalar, true );
    }
    //**********************************************************************************************
 
@@ -5220,8 +5251,7 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
    static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5,ST2> >::Type
       selectLargeSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B, ST2 scalar )
    {
-      // TODO
-      selectSmallSubAssignKernel( ~C, A, B, scalar );
+      mmm( ~C, A, B, -scalar, true );
    }
    //**********************************************************************************************
 
@@ -5500,6 +5530,7 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
       RT B( right );  // Evaluation of the right-hand side dense matrix operand
 
@@ -5622,6 +5653,7 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
       RT B( right );  // Evaluation of the right-hand side dense matrix operand
 
@@ -5710,6 +5742,7 @@ class DMatScalarMultExpr< TDMatTDMatMultExpr<MT1,MT2>, ST, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT A( left  );  // Evaluation of the left-hand side dense matrix operand
       RT B( right );  // Evaluation of the right-hand side dense matrix operand
 
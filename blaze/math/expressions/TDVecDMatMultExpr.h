@@ -75,6 +75,7 @@
 #include <blaze/math/typetraits/Size.h>
 #include <blaze/system/BLAS.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/util/Arena.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/constraints/Reference.h>
@@ -453,6 +454,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT x( serial( rhs.vec_ ) );  // Evaluation of the left-hand side dense vector operand
       RT A( serial( rhs.mat_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -610,14 +612,14 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
          }
 
          y.store( j             , xmm1 );
@@ -640,10 +642,10 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
          }
 
          y.store( j             , xmm1 );
@@ -662,9 +664,9 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
          }
 
          y.store( j             , xmm1 );
@@ -682,8 +684,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j         );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+            xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
          }
 
          y.store( j         , xmm1 );
@@ -699,7 +701,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; ++i ) {
-            xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+            xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
          }
 
          y.store( j, xmm1 );
@@ -780,14 +782,14 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-                  xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-                  xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-                  xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-                  xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+                  xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+                  xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+                  xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+                  xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
                }
 
                y.store( j             , y.load(j             ) + xmm1 );
@@ -806,10 +808,10 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
                }
 
                y.store( j             , y.load(j             ) + xmm1 );
@@ -824,9 +826,9 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
                }
 
                y.store( j             , y.load(j             ) + xmm1 );
@@ -840,8 +842,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j         );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+                  xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
                }
 
                y.store( j         , y.load(j         ) + xmm1 );
@@ -853,7 +855,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
                IntrinsicType xmm1;
 
                for( size_t i=ii; i<iend; ++i ) {
-                  xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+                  xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
                }
 
                y.store( j, y.load(j) + xmm1 );
@@ -1075,6 +1077,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT x( serial( rhs.vec_ ) );  // Evaluation of the left-hand side dense vector operand
       RT A( serial( rhs.mat_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -1225,14 +1228,14 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
          }
 
          y.store( j             , xmm1 );
@@ -1258,10 +1261,10 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
          }
 
          y.store( j             , xmm1 );
@@ -1282,9 +1285,9 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
          }
 
          y.store( j             , xmm1 );
@@ -1303,8 +1306,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j         );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+            xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
          }
 
          y.store( j         , xmm1 );
@@ -1320,7 +1323,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
          IntrinsicType xmm1( y.load(j) );
 
          for( size_t i=ibegin; i<iend; ++i ) {
-            xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+            xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
          }
 
          y.store( j, xmm1 );
@@ -1399,14 +1402,14 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-                  xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-                  xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-                  xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-                  xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+                  xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+                  xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+                  xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+                  xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
                }
 
                y.store( j             , y.load(j             ) + xmm1 );
@@ -1425,10 +1428,10 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
                }
 
                y.store( j             , y.load(j             ) + xmm1 );
@@ -1443,9 +1446,9 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
                }
 
                y.store( j             , y.load(j             ) + xmm1 );
@@ -1459,8 +1462,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j         );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+                  xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
                }
 
                y.store( j         , y.load(j         ) + xmm1 );
@@ -1472,7 +1475,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
                IntrinsicType xmm1;
 
                for( size_t i=ii; i<iend; ++i ) {
-                  xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+                  xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
                }
 
                y.store( j, y.load(j) + xmm1 );
@@ -1672,6 +1675,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT x( serial( rhs.vec_ ) );  // Evaluation of the left-hand side dense vector operand
       RT A( serial( rhs.mat_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -1823,14 +1827,14 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 - x1 * A.load(i,j             );
-            xmm2 = xmm2 - x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 - x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 - x1 * A.load(i,j+IT::size*3UL);
-            xmm5 = xmm5 - x1 * A.load(i,j+IT::size*4UL);
-            xmm6 = xmm6 - x1 * A.load(i,j+IT::size*5UL);
-            xmm7 = xmm7 - x1 * A.load(i,j+IT::size*6UL);
-            xmm8 = xmm8 - x1 * A.load(i,j+IT::size*7UL);
+            xmm1 = fnmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fnmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fnmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fnmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+            xmm5 = fnmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+            xmm6 = fnmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+            xmm7 = fnmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+            xmm8 = fnmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
          }
 
          y.store( j             , xmm1 );
@@ -1856,10 +1860,10 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 - x1 * A.load(i,j             );
-            xmm2 = xmm2 - x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 - x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 - x1 * A.load(i,j+IT::size*3UL);
+            xmm1 = fnmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fnmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fnmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fnmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
          }
 
          y.store( j             , xmm1 );
@@ -1880,9 +1884,9 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 - x1 * A.load(i,j             );
-            xmm2 = xmm2 - x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 - x1 * A.load(i,j+IT::size*2UL);
+            xmm1 = fnmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fnmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fnmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
          }
 
          y.store( j             , xmm1 );
@@ -1901,8 +1905,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 - x1 * A.load(i,j         );
-            xmm2 = xmm2 - x1 * A.load(i,j+IT::size);
+            xmm1 = fnmadd( x1, A.load(i,j         ), xmm1 );
+            xmm2 = fnmadd( x1, A.load(i,j+IT::size), xmm2 );
          }
 
          y.store( j         , xmm1 );
@@ -1918,7 +1922,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
          IntrinsicType xmm1( y.load(j) );
 
          for( size_t i=ibegin; i<iend; ++i ) {
-            xmm1 = xmm1 - set( x[i] ) * A.load(i,j);
+            xmm1 = fnmadd( set( x[i] ), A.load(i,j), xmm1 );
          }
 
          y.store( j, xmm1 );
@@ -1998,14 +2002,14 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-                  xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-                  xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-                  xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-                  xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+                  xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+                  xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+                  xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+                  xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
                }
 
                y.store( j             , y.load(j             ) - xmm1 );
@@ -2024,10 +2028,10 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
                }
 
                y.store( j             , y.load(j             ) - xmm1 );
@@ -2042,9 +2046,9 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
                }
 
                y.store( j             , y.load(j             ) - xmm1 );
@@ -2058,8 +2062,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j         );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+                  xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
                }
 
                y.store( j         , y.load(j         ) - xmm1 );
@@ -2071,7 +2075,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
                IntrinsicType xmm1;
 
                for( size_t i=ii; i<iend; ++i ) {
-                  xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+                  xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
                }
 
                y.store( j, y.load(j) - xmm1 );
@@ -2312,6 +2316,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT x( rhs.vec_ );  // Evaluation of the left-hand side dense vector operand
       RT A( rhs.mat_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -2385,6 +2390,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT x( rhs.vec_ );  // Evaluation of the left-hand side dense vector operand
       RT A( rhs.mat_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -2429,6 +2435,7 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT x( rhs.vec_ );  // Evaluation of the left-hand side dense vector operand
       RT A( rhs.mat_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -2833,6 +2840,7 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT x( serial( left  ) );  // Evaluation of the left-hand side dense vector operand
       RT A( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -2995,14 +3003,14 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
          }
 
          y.store( j             , xmm1*factor );
@@ -3025,10 +3033,10 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
          }
 
          y.store( j             , xmm1*factor );
@@ -3047,9 +3055,9 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
          }
 
          y.store( j             , xmm1*factor );
@@ -3067,8 +3075,8 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j         );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+            xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
          }
 
          y.store( j         , xmm1*factor );
@@ -3084,7 +3092,7 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; ++i ) {
-            xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+            xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
          }
 
          y.store( j, xmm1*factor );
@@ -3167,24 +3175,24 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-                  xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-                  xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-                  xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-                  xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+                  xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+                  xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+                  xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+                  xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
                }
 
-               y.store( j             , y.load(j             ) + xmm1*factor );
-               y.store( j+IT::size    , y.load(j+IT::size    ) + xmm2*factor );
-               y.store( j+IT::size*2UL, y.load(j+IT::size*2UL) + xmm3*factor );
-               y.store( j+IT::size*3UL, y.load(j+IT::size*3UL) + xmm4*factor );
-               y.store( j+IT::size*4UL, y.load(j+IT::size*4UL) + xmm5*factor );
-               y.store( j+IT::size*5UL, y.load(j+IT::size*5UL) + xmm6*factor );
-               y.store( j+IT::size*6UL, y.load(j+IT::size*6UL) + xmm7*factor );
-               y.store( j+IT::size*7UL, y.load(j+IT::size*7UL) + xmm8*factor );
+               y.store( j             , fmadd( xmm1, factor, y.load(j             ) ) );
+               y.store( j+IT::size    , fmadd( xmm2, factor, y.load(j+IT::size    ) ) );
+               y.store( j+IT::size*2UL, fmadd( xmm3, factor, y.load(j+IT::size*2UL) ) );
+               y.store( j+IT::size*3UL, fmadd( xmm4, factor, y.load(j+IT::size*3UL) ) );
+               y.store( j+IT::size*4UL, fmadd( xmm5, factor, y.load(j+IT::size*4UL) ) );
+               y.store( j+IT::size*5UL, fmadd( xmm6, factor, y.load(j+IT::size*5UL) ) );
+               y.store( j+IT::size*6UL, fmadd( xmm7, factor, y.load(j+IT::size*6UL) ) );
+               y.store( j+IT::size*7UL, fmadd( xmm8, factor, y.load(j+IT::size*7UL) ) );
             }
 
             for( ; (j+IT::size*3UL) < jend; j+=IT::size*4UL )
@@ -3193,16 +3201,16 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
                }
 
-               y.store( j             , y.load(j             ) + xmm1*factor );
-               y.store( j+IT::size    , y.load(j+IT::size    ) + xmm2*factor );
-               y.store( j+IT::size*2UL, y.load(j+IT::size*2UL) + xmm3*factor );
-               y.store( j+IT::size*3UL, y.load(j+IT::size*3UL) + xmm4*factor );
+               y.store( j             , fmadd( xmm1, factor, y.load(j             ) ) );
+               y.store( j+IT::size    , fmadd( xmm2, factor, y.load(j+IT::size    ) ) );
+               y.store( j+IT::size*2UL, fmadd( xmm3, factor, y.load(j+IT::size*2UL) ) );
+               y.store( j+IT::size*3UL, fmadd( xmm4, factor, y.load(j+IT::size*3UL) ) );
             }
 
             for( ; (j+IT::size*2UL) < jend; j+=IT::size*3UL )
@@ -3211,14 +3219,14 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
                }
 
-               y.store( j             , y.load(j             ) + xmm1*factor );
-               y.store( j+IT::size    , y.load(j+IT::size    ) + xmm2*factor );
-               y.store( j+IT::size*2UL, y.load(j+IT::size*2UL) + xmm3*factor );
+               y.store( j             , fmadd( xmm1, factor, y.load(j             ) ) );
+               y.store( j+IT::size    , fmadd( xmm2, factor, y.load(j+IT::size    ) ) );
+               y.store( j+IT::size*2UL, fmadd( xmm3, factor, y.load(j+IT::size*2UL) ) );
             }
 
             for( ; (j+IT::size) < jend; j+=IT::size*2UL )
@@ -3227,12 +3235,12 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j         );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+                  xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
                }
 
-               y.store( j         , y.load(j         ) + xmm1*factor );
-               y.store( j+IT::size, y.load(j+IT::size) + xmm2*factor );
+               y.store( j         , fmadd( xmm1, factor, y.load(j         ) ) );
+               y.store( j+IT::size, fmadd( xmm2, factor, y.load(j+IT::size) ) );
             }
 
             if( j < jend )
@@ -3240,10 +3248,10 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
                IntrinsicType xmm1;
 
                for( size_t i=ii; i<iend; ++i ) {
-                  xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+                  xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
                }
 
-               y.store( j, y.load(j) + xmm1*factor );
+               y.store( j, fmadd( xmm1, factor, y.load(j) ) );
             }
          }
       }
@@ -3460,6 +3468,7 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT x( serial( left  ) );  // Evaluation of the left-hand side dense vector operand
       RT A( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -3587,24 +3596,24 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
          }
 
-         y.store( j             , y.load(j             ) + xmm1*factor );
-         y.store( j+IT::size    , y.load(j+IT::size    ) + xmm2*factor );
-         y.store( j+IT::size*2UL, y.load(j+IT::size*2UL) + xmm3*factor );
-         y.store( j+IT::size*3UL, y.load(j+IT::size*3UL) + xmm4*factor );
-         y.store( j+IT::size*4UL, y.load(j+IT::size*4UL) + xmm5*factor );
-         y.store( j+IT::size*5UL, y.load(j+IT::size*5UL) + xmm6*factor );
-         y.store( j+IT::size*6UL, y.load(j+IT::size*6UL) + xmm7*factor );
-         y.store( j+IT::size*7UL, y.load(j+IT::size*7UL) + xmm8*factor );
+         y.store( j             , fmadd( xmm1, factor, y.load(j             ) ) );
+         y.store( j+IT::size    , fmadd( xmm2, factor, y.load(j+IT::size    ) ) );
+         y.store( j+IT::size*2UL, fmadd( xmm3, factor, y.load(j+IT::size*2UL) ) );
+         y.store( j+IT::size*3UL, fmadd( xmm4, factor, y.load(j+IT::size*3UL) ) );
+         y.store( j+IT::size*4UL, fmadd( xmm5, factor, y.load(j+IT::size*4UL) ) );
+         y.store( j+IT::size*5UL, fmadd( xmm6, factor, y.load(j+IT::size*5UL) ) );
+         y.store( j+IT::size*6UL, fmadd( xmm7, factor, y.load(j+IT::size*6UL) ) );
+         y.store( j+IT::size*7UL, fmadd( xmm8, factor, y.load(j+IT::size*7UL) ) );
       }
 
       for( ; (j+IT::size*3UL) < N; j+=IT::size*4UL )
@@ -3617,16 +3626,16 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
          }
 
-         y.store( j             , y.load(j             ) + xmm1*factor );
-         y.store( j+IT::size    , y.load(j+IT::size    ) + xmm2*factor );
-         y.store( j+IT::size*2UL, y.load(j+IT::size*2UL) + xmm3*factor );
-         y.store( j+IT::size*3UL, y.load(j+IT::size*3UL) + xmm4*factor );
+         y.store( j             , fmadd( xmm1, factor, y.load(j             ) ) );
+         y.store( j+IT::size    , fmadd( xmm2, factor, y.load(j+IT::size    ) ) );
+         y.store( j+IT::size*2UL, fmadd( xmm3, factor, y.load(j+IT::size*2UL) ) );
+         y.store( j+IT::size*3UL, fmadd( xmm4, factor, y.load(j+IT::size*3UL) ) );
       }
 
       for( ; (j+IT::size*2UL) < N; j+=IT::size*3UL )
@@ -3639,14 +3648,14 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
          }
 
-         y.store( j             , y.load(j             ) + xmm1*factor );
-         y.store( j+IT::size    , y.load(j+IT::size    ) + xmm2*factor );
-         y.store( j+IT::size*2UL, y.load(j+IT::size*2UL) + xmm3*factor );
+         y.store( j             , fmadd( xmm1, factor, y.load(j             ) ) );
+         y.store( j+IT::size    , fmadd( xmm2, factor, y.load(j+IT::size    ) ) );
+         y.store( j+IT::size*2UL, fmadd( xmm3, factor, y.load(j+IT::size*2UL) ) );
       }
 
       for( ; (j+IT::size) < N; j+=IT::size*2UL )
@@ -3659,12 +3668,12 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j         );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+            xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
          }
 
-         y.store( j         , y.load(j         ) + xmm1*factor );
-         y.store( j+IT::size, y.load(j+IT::size) + xmm2*factor );
+         y.store( j         , fmadd( xmm1, factor, y.load(j         ) ) );
+         y.store( j+IT::size, fmadd( xmm2, factor, y.load(j+IT::size) ) );
       }
 
       if( j < N )
@@ -3676,10 +3685,10 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; ++i ) {
-            xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+            xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
          }
 
-         y.store( j, y.load(j) + xmm1*factor );
+         y.store( j, fmadd( xmm1, factor, y.load(j) ) );
       }
    }
    //**********************************************************************************************
@@ -3758,24 +3767,24 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-                  xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-                  xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-                  xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-                  xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+                  xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+                  xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+                  xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+                  xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
                }
 
-               y.store( j             , y.load(j             ) + xmm1*factor );
-               y.store( j+IT::size    , y.load(j+IT::size    ) + xmm2*factor );
-               y.store( j+IT::size*2UL, y.load(j+IT::size*2UL) + xmm3*factor );
-               y.store( j+IT::size*3UL, y.load(j+IT::size*3UL) + xmm4*factor );
-               y.store( j+IT::size*4UL, y.load(j+IT::size*4UL) + xmm5*factor );
-               y.store( j+IT::size*5UL, y.load(j+IT::size*5UL) + xmm6*factor );
-               y.store( j+IT::size*6UL, y.load(j+IT::size*6UL) + xmm7*factor );
-               y.store( j+IT::size*7UL, y.load(j+IT::size*7UL) + xmm8*factor );
+               y.store( j             , fmadd( xmm1, factor, y.load(j             ) ) );
+               y.store( j+IT::size    , fmadd( xmm2, factor, y.load(j+IT::size    ) ) );
+               y.store( j+IT::size*2UL, fmadd( xmm3, factor, y.load(j+IT::size*2UL) ) );
+               y.store( j+IT::size*3UL, fmadd( xmm4, factor, y.load(j+IT::size*3UL) ) );
+               y.store( j+IT::size*4UL, fmadd( xmm5, factor, y.load(j+IT::size*4UL) ) );
+               y.store( j+IT::size*5UL, fmadd( xmm6, factor, y.load(j+IT::size*5UL) ) );
+               y.store( j+IT::size*6UL, fmadd( xmm7, factor, y.load(j+IT::size*6UL) ) );
+               y.store( j+IT::size*7UL, fmadd( xmm8, factor, y.load(j+IT::size*7UL) ) );
             }
 
             for( ; (j+IT::size*3UL) < jend; j+=IT::size*4UL )
@@ -3784,16 +3793,16 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
                }
 
-               y.store( j             , y.load(j             ) + xmm1*factor );
-               y.store( j+IT::size    , y.load(j+IT::size    ) + xmm2*factor );
-               y.store( j+IT::size*2UL, y.load(j+IT::size*2UL) + xmm3*factor );
-               y.store( j+IT::size*3UL, y.load(j+IT::size*3UL) + xmm4*factor );
+               y.store( j             , fmadd( xmm1, factor, y.load(j             ) ) );
+               y.store( j+IT::size    , fmadd( xmm2, factor, y.load(j+IT::size    ) ) );
+               y.store( j+IT::size*2UL, fmadd( xmm3, factor, y.load(j+IT::size*2UL) ) );
+               y.store( j+IT::size*3UL, fmadd( xmm4, factor, y.load(j+IT::size*3UL) ) );
             }
 
             for( ; (j+IT::size*2UL) < jend; j+=IT::size*3UL )
@@ -3802,14 +3811,14 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
                }
 
-               y.store( j             , y.load(j             ) + xmm1*factor );
-               y.store( j+IT::size    , y.load(j+IT::size    ) + xmm2*factor );
-               y.store( j+IT::size*2UL, y.load(j+IT::size*2UL) + xmm3*factor );
+               y.store( j             , fmadd( xmm1, factor, y.load(j             ) ) );
+               y.store( j+IT::size    , fmadd( xmm2, factor, y.load(j+IT::size    ) ) );
+               y.store( j+IT::size*2UL, fmadd( xmm3, factor, y.load(j+IT::size*2UL) ) );
             }
 
             for( ; (j+IT::size) < jend; j+=IT::size*2UL )
@@ -3818,12 +3827,12 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j         );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+                  xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
                }
 
-               y.store( j         , y.load(j         ) + xmm1*factor );
-               y.store( j+IT::size, y.load(j+IT::size) + xmm2*factor );
+               y.store( j         , fmadd( xmm1, factor, y.load(j         ) ) );
+               y.store( j+IT::size, fmadd( xmm2, factor, y.load(j+IT::size) ) );
             }
 
             if( j < jend )
@@ -3831,10 +3840,10 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
                IntrinsicType xmm1;
 
                for( size_t i=ii; i<iend; ++i ) {
-                  xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+                  xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
                }
 
-               y.store( j, y.load(j) + xmm1*factor );
+               y.store( j, fmadd( xmm1, factor, y.load(j) ) );
             }
          }
       }
@@ -4032,6 +4041,7 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT x( serial( left  ) );  // Evaluation of the left-hand side dense vector operand
       RT A( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -4159,24 +4169,24 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
          }
 
-         y.store( j             , y.load(j             ) - xmm1*factor );
-         y.store( j+IT::size    , y.load(j+IT::size    ) - xmm2*factor );
-         y.store( j+IT::size*2UL, y.load(j+IT::size*2UL) - xmm3*factor );
-         y.store( j+IT::size*3UL, y.load(j+IT::size*3UL) - xmm4*factor );
-         y.store( j+IT::size*4UL, y.load(j+IT::size*4UL) - xmm5*factor );
-         y.store( j+IT::size*5UL, y.load(j+IT::size*5UL) - xmm6*factor );
-         y.store( j+IT::size*6UL, y.load(j+IT::size*6UL) - xmm7*factor );
-         y.store( j+IT::size*7UL, y.load(j+IT::size*7UL) - xmm8*factor );
+         y.store( j             , fnmadd( xmm1, factor, y.load(j             ) ) );
+         y.store( j+IT::size    , fnmadd( xmm2, factor, y.load(j+IT::size    ) ) );
+         y.store( j+IT::size*2UL, fnmadd( xmm3, factor, y.load(j+IT::size*2UL) ) );
+         y.store( j+IT::size*3UL, fnmadd( xmm4, factor, y.load(j+IT::size*3UL) ) );
+         y.store( j+IT::size*4UL, fnmadd( xmm5, factor, y.load(j+IT::size*4UL) ) );
+         y.store( j+IT::size*5UL, fnmadd( xmm6, factor, y.load(j+IT::size*5UL) ) );
+         y.store( j+IT::size*6UL, fnmadd( xmm7, factor, y.load(j+IT::size*6UL) ) );
+         y.store( j+IT::size*7UL, fnmadd( xmm8, factor, y.load(j+IT::size*7UL) ) );
       }
 
       for( ; (j+IT::size*3UL) < N; j+=IT::size*4UL )
@@ -4189,16 +4199,16 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
          }
 
-         y.store( j             , y.load(j             ) - xmm1*factor );
-         y.store( j+IT::size    , y.load(j+IT::size    ) - xmm2*factor );
-         y.store( j+IT::size*2UL, y.load(j+IT::size*2UL) - xmm3*factor );
-         y.store( j+IT::size*3UL, y.load(j+IT::size*3UL) - xmm4*factor );
+         y.store( j             , fnmadd( xmm1, factor, y.load(j             ) ) );
+         y.store( j+IT::size    , fnmadd( xmm2, factor, y.load(j+IT::size    ) ) );
+         y.store( j+IT::size*2UL, fnmadd( xmm3, factor, y.load(j+IT::size*2UL) ) );
+         y.store( j+IT::size*3UL, fnmadd( xmm4, factor, y.load(j+IT::size*3UL) ) );
       }
 
       for( ; (j+IT::size*2UL) < N; j+=IT::size*3UL )
@@ -4211,14 +4221,14 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j             );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-            xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+            xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
          }
 
-         y.store( j             , y.load(j             ) - xmm1*factor );
-         y.store( j+IT::size    , y.load(j+IT::size    ) - xmm2*factor );
-         y.store( j+IT::size*2UL, y.load(j+IT::size*2UL) - xmm3*factor );
+         y.store( j             , fnmadd( xmm1, factor, y.load(j             ) ) );
+         y.store( j+IT::size    , fnmadd( xmm2, factor, y.load(j+IT::size    ) ) );
+         y.store( j+IT::size*2UL, fnmadd( xmm3, factor, y.load(j+IT::size*2UL) ) );
       }
 
       for( ; (j+IT::size) < N; j+=IT::size*2UL )
@@ -4231,12 +4241,12 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; ++i ) {
             const IntrinsicType x1( set( x[i] ) );
-            xmm1 = xmm1 + x1 * A.load(i,j         );
-            xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+            xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
          }
 
-         y.store( j         , y.load(j         ) - xmm1*factor );
-         y.store( j+IT::size, y.load(j+IT::size) - xmm2*factor );
+         y.store( j         , fnmadd( xmm1, factor, y.load(j         ) ) );
+         y.store( j+IT::size, fnmadd( xmm2, factor, y.load(j+IT::size) ) );
       }
 
       if( j < N )
@@ -4248,10 +4258,10 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; ++i ) {
-            xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+            xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
          }
 
-         y.store( j, y.load(j) - xmm1*factor );
+         y.store( j, fnmadd( xmm1, factor, y.load(j) ) );
       }
    }
    //**********************************************************************************************
@@ -4330,24 +4340,24 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
-                  xmm5 = xmm5 + x1 * A.load(i,j+IT::size*4UL);
-                  xmm6 = xmm6 + x1 * A.load(i,j+IT::size*5UL);
-                  xmm7 = xmm7 + x1 * A.load(i,j+IT::size*6UL);
-                  xmm8 = xmm8 + x1 * A.load(i,j+IT::size*7UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
+                  xmm5 = fmadd( x1, A.load(i,j+IT::size*4UL), xmm5 );
+                  xmm6 = fmadd( x1, A.load(i,j+IT::size*5UL), xmm6 );
+                  xmm7 = fmadd( x1, A.load(i,j+IT::size*6UL), xmm7 );
+                  xmm8 = fmadd( x1, A.load(i,j+IT::size*7UL), xmm8 );
                }
 
-               y.store( j             , y.load(j             ) - xmm1*factor );
-               y.store( j+IT::size    , y.load(j+IT::size    ) - xmm2*factor );
-               y.store( j+IT::size*2UL, y.load(j+IT::size*2UL) - xmm3*factor );
-               y.store( j+IT::size*3UL, y.load(j+IT::size*3UL) - xmm4*factor );
-               y.store( j+IT::size*4UL, y.load(j+IT::size*4UL) - xmm5*factor );
-               y.store( j+IT::size*5UL, y.load(j+IT::size*5UL) - xmm6*factor );
-               y.store( j+IT::size*6UL, y.load(j+IT::size*6UL) - xmm7*factor );
-               y.store( j+IT::size*7UL, y.load(j+IT::size*7UL) - xmm8*factor );
+               y.store( j             , fnmadd( xmm1, factor, y.load(j             ) ) );
+               y.store( j+IT::size    , fnmadd( xmm2, factor, y.load(j+IT::size    ) ) );
+               y.store( j+IT::size*2UL, fnmadd( xmm3, factor, y.load(j+IT::size*2UL) ) );
+               y.store( j+IT::size*3UL, fnmadd( xmm4, factor, y.load(j+IT::size*3UL) ) );
+               y.store( j+IT::size*4UL, fnmadd( xmm5, factor, y.load(j+IT::size*4UL) ) );
+               y.store( j+IT::size*5UL, fnmadd( xmm6, factor, y.load(j+IT::size*5UL) ) );
+               y.store( j+IT::size*6UL, fnmadd( xmm7, factor, y.load(j+IT::size*6UL) ) );
+               y.store( j+IT::size*7UL, fnmadd( xmm8, factor, y.load(j+IT::size*7UL) ) );
             }
 
             for( ; (j+IT::size*3UL) < jend; j+=IT::size*4UL )
@@ -4356,16 +4366,16 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
-                  xmm4 = xmm4 + x1 * A.load(i,j+IT::size*3UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
+                  xmm4 = fmadd( x1, A.load(i,j+IT::size*3UL), xmm4 );
                }
 
-               y.store( j             , y.load(j             ) - xmm1*factor );
-               y.store( j+IT::size    , y.load(j+IT::size    ) - xmm2*factor );
-               y.store( j+IT::size*2UL, y.load(j+IT::size*2UL) - xmm3*factor );
-               y.store( j+IT::size*3UL, y.load(j+IT::size*3UL) - xmm4*factor );
+               y.store( j             , fnmadd( xmm1, factor, y.load(j             ) ) );
+               y.store( j+IT::size    , fnmadd( xmm2, factor, y.load(j+IT::size    ) ) );
+               y.store( j+IT::size*2UL, fnmadd( xmm3, factor, y.load(j+IT::size*2UL) ) );
+               y.store( j+IT::size*3UL, fnmadd( xmm4, factor, y.load(j+IT::size*3UL) ) );
             }
 
             for( ; (j+IT::size*2UL) < jend; j+=IT::size*3UL )
@@ -4374,14 +4384,14 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j             );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size    );
-                  xmm3 = xmm3 + x1 * A.load(i,j+IT::size*2UL);
+                  xmm1 = fmadd( x1, A.load(i,j             ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size    ), xmm2 );
+                  xmm3 = fmadd( x1, A.load(i,j+IT::size*2UL), xmm3 );
                }
 
-               y.store( j             , y.load(j             ) - xmm1*factor );
-               y.store( j+IT::size    , y.load(j+IT::size    ) - xmm2*factor );
-               y.store( j+IT::size*2UL, y.load(j+IT::size*2UL) - xmm3*factor );
+               y.store( j             , fnmadd( xmm1, factor, y.load(j             ) ) );
+               y.store( j+IT::size    , fnmadd( xmm2, factor, y.load(j+IT::size    ) ) );
+               y.store( j+IT::size*2UL, fnmadd( xmm3, factor, y.load(j+IT::size*2UL) ) );
             }
 
             for( ; (j+IT::size) < jend; j+=IT::size*2UL )
@@ -4390,12 +4400,12 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
 
                for( size_t i=ii; i<iend; ++i ) {
                   const IntrinsicType x1( set( x[i] ) );
-                  xmm1 = xmm1 + x1 * A.load(i,j         );
-                  xmm2 = xmm2 + x1 * A.load(i,j+IT::size);
+                  xmm1 = fmadd( x1, A.load(i,j         ), xmm1 );
+                  xmm2 = fmadd( x1, A.load(i,j+IT::size), xmm2 );
                }
 
-               y.store( j         , y.load(j         ) - xmm1*factor );
-               y.store( j+IT::size, y.load(j+IT::size) - xmm2*factor );
+               y.store( j         , fnmadd( xmm1, factor, y.load(j         ) ) );
+               y.store( j+IT::size, fnmadd( xmm2, factor, y.load(j+IT::size) ) );
             }
 
             if( j < jend )
@@ -4403,10 +4413,10 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
                IntrinsicType xmm1;
 
                for( size_t i=ii; i<iend; ++i ) {
-                  xmm1 = xmm1 + set( x[i] ) * A.load(i,j);
+                  xmm1 = fmadd( set( x[i] ), A.load(i,j), xmm1 );
                }
 
-               y.store( j, y.load(j) - xmm1*factor );
+               y.store( j, fnmadd( xmm1, factor, y.load(j) ) );
             }
          }
       }
@@ -4643,6 +4653,7 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT x( left  );  // Evaluation of the left-hand side dense vector operand
       RT A( right );  // Evaluation of the right-hand side dense matrix operand
 
@@ -4715,6 +4726,7 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT x( left  );  // Evaluation of the left-hand side dense vector operand
       RT A( right );  // Evaluation of the right-hand side dense matrix operand
 
@@ -4760,6 +4772,7 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT x( left  );  // Evaluation of the left-hand side dense vector operand
       RT A( right );  // Evaluation of the right-hand side dense matrix operand
 
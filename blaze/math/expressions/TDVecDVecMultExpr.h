@@ -41,65 +41,27 @@
 //*************************************************************************************************
 
 #include <stdexcept>
+#include <blaze/math/dense/Reduction.h>
 #include <blaze/math/expressions/DenseVector.h>
-#include <blaze/math/Intrinsics.h>
+#include <blaze/math/expressions/DVecDVecMultExpr.h>
+#include <blaze/math/expressions/DVecTransExpr.h>
+#include <blaze/math/smp/Reduction.h>
 #include <blaze/math/traits/MultTrait.h>
-#include <blaze/util/DisableIf.h>
-#include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
 #include <blaze/util/Types.h>
-#include <blaze/util/typetraits/IsSame.h>
-#include <blaze/util/typetraits/RemoveReference.h>
 
 
 namespace blaze {
 
 //=================================================================================================
 //
-//  CLASS DEFINITION
+//  GLOBAL FUNCTIONS
 //
 //=================================================================================================
 
 //*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-/*!\brief Auxiliary helper struct for the dense vector/dense vector scalar multiplication.
-// \ingroup dense_vector
-*/
-template< typename T1    // Type of the left-hand side dense vector
-        , typename T2 >  // Type of the right-hand side dense vector
-struct TDVecDVecMultExprHelper
-{
-   //**Type definitions****************************************************************************
-   //! Composite type of the left-hand side dense vector expression.
-   typedef typename RemoveReference< typename T1::CompositeType >::Type  CT1;
-
-   //! Composite type of the right-hand side dense vector expression.
-   typedef typename RemoveReference< typename T2::CompositeType >::Type  CT2;
-   //**********************************************************************************************
-
-   //**********************************************************************************************
-   enum { value = CT1::vectorizable &&
-                  CT2::vectorizable &&
-                  IsSame< typename CT1::ElementType, typename CT2::ElementType>::value &&
-                  IntrinsicTrait< typename CT1::ElementType >::addition &&
-                  IntrinsicTrait< typename CT2::ElementType >::multiplication };
-   //**********************************************************************************************
-};
-/*! \endcond */
-//*************************************************************************************************
-
-
-
-
-//=================================================================================================
-//
-//  GLOBAL BINARY ARITHMETIC OPERATORS
-//
-//=================================================================================================
-
-//*************************************************************************************************
-/*!\brief Default multiplication operator for the scalar product (inner product) of two dense
-//        vectors (\f$ s=\vec{a}*\vec{b} \f$).
+/*!\brief Computes the scalar product (inner product) of two dense vectors with the same transpose
+//        flag (\f$ s=\vec{a}\cdot\vec{b} \f$).
 // \ingroup dense_vector
 //
 // \param lhs The left-hand side dense vector for the inner product.
@@ -107,27 +69,30 @@ struct TDVecDVecMultExprHelper
 // \return The scalar product.
 // \exception std::invalid_argument Vector sizes do not match.
 //
-// This operator represents the scalar product (inner product) of two dense vectors:
+// This function computes the scalar product (inner product) of two dense vectors:
 
    \code
    blaze::DynamicVector<double> a, b;
-   blaze::double res;
+   double res;
    // ... Resizing and initialization
-   res = trans(a) * b;
+   res = dot( a, b );
    \endcode
 
-// The operator returns a scalar value of the higher-order element type of the two involved
+// The scalar product is computed as the sum of the componentwise product of the two vectors.
+// The vectorized kernel accumulates the products via fused multiply-add operations, and large
+// vectors are reduced in parallel in the same way as by the sum() function.
+// The function returns a scalar value of the higher-order element type of the two involved
 // vector element types \a T1::ElementType and \a T2::ElementType. Both vector types \a T1
 // and \a T2 as well as the two element types \a T1::ElementType and \a T2::ElementType have
 // to be supported by the MultTrait class template.\n
 // In case the current sizes of the two given vectors don't match, a \a std::invalid_argument
 // is thrown.
 */
-template< typename T1    // Type of the left-hand side dense vector
-        , typename T2 >  // Type of the right-hand side dense vector
-inline typename DisableIf< TDVecDVecMultExprHelper<T1,T2>,
-                           const typename MultTrait<typename T1::ElementType,typename T2::ElementType>::Type >::Type
-   operator*( const DenseVector<T1,true>& lhs, const DenseVector<T2,false>& rhs )
+template< typename T1  // Type of the left-hand side dense vector
+        , typename T2  // Type of the right-hand side dense vector
+        , bool TF >    // Transpose flag
+inline const typename MultTrait<typename T1::ElementType,typename T2::ElementType>::Type
+   dot( const DenseVector<T1,TF>& lhs, const DenseVector<T2,TF>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
@@ -145,19 +110,22 @@ inline typename DisableIf< TDVecDVecMultExprHelper<T1,T2>,
    Lhs left ( ~lhs );
    Rhs right( ~rhs );
 
-   MultType sp( left[0UL] * right[0UL] );
-
-   for( size_t i=1UL; i<left.size(); ++i )
-      sp += left[i] * right[i];
-
-   return sp;
+   return smpReduce<ReduceProduct>( left * right );
 }
 //*************************************************************************************************
 
 
+
+
+//=================================================================================================
+//
+//  GLOBAL BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
 //*************************************************************************************************
-/*!\brief Intrinsic optimized multiplication operator for the scalar product (inner product) of
-//        two dense vectors (\f$ s=\vec{a}*\vec{b} \f$).
+/*!\brief Multiplication operator for the scalar product (inner product) of two dense vectors
+//        (\f$ s=\vec{a}*\vec{b} \f$).
 // \ingroup dense_vector
 //
 // \param lhs The left-hand side dense vector for the inner product.
@@ -179,51 +147,19 @@ inline typename DisableIf< TDVecDVecMultExprHelper<T1,T2>,
 // The operator returns a scalar value of the higher-order element type of the two involved
 // vector element types \a T1::ElementType and \a T2::ElementType. Both vector types \a T1
 // and \a T2 as well as the two element types \a T1::ElementType and \a T2::ElementType have
-// to be supported by the MultTrait class template.\n
+// to be supported by the MultTrait class template. The scalar product is computed by the dot()
+// function.\n
 // In case the current sizes of the two given vectors don't match, a \a std::invalid_argument
 // is thrown.
 */
 template< typename T1    // Type of the left-hand side dense vector
         , typename T2 >  // Type of the right-hand side dense vector
-inline typename EnableIf< TDVecDVecMultExprHelper<T1,T2>,
-                          const typename MultTrait<typename T1::ElementType,typename T2::ElementType>::Type >::Type
+inline const typename MultTrait<typename T1::ElementType,typename T2::ElementType>::Type
    operator*( const DenseVector<T1,true>& lhs, const DenseVector<T2,false>& rhs )
 {
    BLAZE_FUNCTION_TRACE;
 
-   if( (~lhs).size() != (~rhs).size() )
-      throw std::invalid_argument( "Vector sizes do not match" );
-
-   typedef typename T1::CompositeType         Lhs;
-   typedef typename T2::CompositeType         Rhs;
-   typedef typename T1::ElementType           ET1;
-   typedef typename T2::ElementType           ET2;
-   typedef typename MultTrait<ET1,ET2>::Type  MultType;
-   typedef IntrinsicTrait<MultType>           IT;
-
-   if( (~lhs).size() == 0UL ) return MultType();
-
-   Lhs left ( ~lhs );
-   Rhs right( ~rhs );
-
-   typename IT::Type xmm1, xmm2, xmm3, xmm4;
-
-   const size_t N  ( left.size() );
-   const size_t end( N - N % (IT::size*4UL) );
-
-   for( size_t i=0UL; i<end; i+=IT::size*4UL ) {
-      xmm1 = xmm1 + ( left.load(i             ) * right.load(i             ) );
-      xmm2 = xmm2 + ( left.load(i+IT::size    ) * right.load(i+IT::size    ) );
-      xmm3 = xmm3 + ( left.load(i+IT::size*2UL) * right.load(i+IT::size*2UL) );
-      xmm4 = xmm4 + ( left.load(i+IT::size*3UL) * right.load(i+IT::size*3UL) );
-   }
-
-   MultType sp( sum( xmm1 + xmm2 + xmm3 + xmm4 ) );
-
-   for( size_t i=end; i<N; ++i )
-      sp += left[i] * right[i];
-
-   return sp;
+   return dot( ~lhs, trans( ~rhs ) );
 }
 //*************************************************************************************************
 
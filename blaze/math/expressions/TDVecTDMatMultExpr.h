@@ -73,6 +73,7 @@
 #include <blaze/math/typetraits/Size.h>
 #include <blaze/system/BLAS.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/util/Arena.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/constraints/Reference.h>
@@ -451,6 +452,7 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT x( serial( rhs.vec_ ) );  // Evaluation of the left-hand side dense vector operand
       RT A( serial( rhs.mat_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -575,14 +577,14 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+7UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+7UL), xmm8 );
          }
 
          y[j    ] = sum( xmm1 );
@@ -605,10 +607,10 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
          }
 
          y[j    ] = sum( xmm1 );
@@ -627,9 +629,9 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
          }
 
          y[j    ] = sum( xmm1 );
@@ -647,8 +649,8 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
          }
 
          y[j    ] = sum( xmm1 );
@@ -664,7 +666,7 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
-            xmm1 = xmm1 + x.load(i) * A.load(i,j);
+            xmm1 = fmadd( x.load(i), A.load(i,j), xmm1 );
          }
 
          y[j] = sum( xmm1 );
@@ -1098,6 +1100,7 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT x( serial( rhs.vec_ ) );  // Evaluation of the left-hand side dense vector operand
       RT A( serial( rhs.mat_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -1223,14 +1226,14 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+7UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+7UL), xmm8 );
          }
 
          y[j    ] += sum( xmm1 );
@@ -1253,10 +1256,10 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
          }
 
          y[j    ] += sum( xmm1 );
@@ -1275,9 +1278,9 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
          }
 
          y[j    ] += sum( xmm1 );
@@ -1295,8 +1298,8 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
          }
 
          y[j    ] += sum( xmm1 );
@@ -1312,7 +1315,7 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(i);
+            xmm1 = fmadd( A.load(i,j), x.load(i), xmm1 );
          }
 
          y[j] += sum( xmm1 );
@@ -1723,6 +1726,7 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT x( serial( rhs.vec_ ) );  // Evaluation of the left-hand side dense vector operand
       RT A( serial( rhs.mat_ ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -1848,14 +1852,14 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+7UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+7UL), xmm8 );
          }
 
          y[j    ] -= sum( xmm1 );
@@ -1878,10 +1882,10 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
          }
 
          y[j    ] -= sum( xmm1 );
@@ -1900,9 +1904,9 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
          }
 
          y[j    ] -= sum( xmm1 );
@@ -1920,8 +1924,8 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
          }
 
          y[j    ] -= sum( xmm1 );
@@ -1937,7 +1941,7 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(i);
+            xmm1 = fmadd( A.load(i,j), x.load(i), xmm1 );
          }
 
          y[j] -= sum( xmm1 );
@@ -2389,6 +2393,7 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT x( rhs.vec_ );  // Evaluation of the left-hand side dense vector operand
       RT A( rhs.mat_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -2462,6 +2467,7 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT x( rhs.vec_ );  // Evaluation of the left-hand side dense vector operand
       RT A( rhs.mat_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -2506,6 +2512,7 @@ class TDVecTDMatMultExpr : public DenseVector< TDVecTDMatMultExpr<VT,MT>, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT x( rhs.vec_ );  // Evaluation of the left-hand side dense vector operand
       RT A( rhs.mat_ );  // Evaluation of the right-hand side dense matrix operand
 
@@ -2911,6 +2918,7 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT x( serial( left  ) );  // Evaluation of the left-hand side dense vector operand
       RT A( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -3036,14 +3044,14 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+7UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+7UL), xmm8 );
          }
 
          y[j    ] = sum( xmm1 ) * scalar;
@@ -3066,10 +3074,10 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
          }
 
          y[j    ] = sum( xmm1 ) * scalar;
@@ -3088,9 +3096,9 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
          }
 
          y[j    ] = sum( xmm1 ) * scalar;
@@ -3108,8 +3116,8 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
          }
 
          y[j    ] = sum( xmm1 ) * scalar;
@@ -3125,7 +3133,7 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(i);
+            xmm1 = fmadd( A.load(i,j), x.load(i), xmm1 );
          }
 
          y[j] = sum( xmm1 ) * scalar;
@@ -3581,6 +3589,7 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT x( serial( left  ) );  // Evaluation of the left-hand side dense vector operand
       RT A( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -3706,14 +3715,14 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+7UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+7UL), xmm8 );
          }
 
          y[j    ] += sum( xmm1 ) * scalar;
@@ -3736,10 +3745,10 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
          }
 
          y[j    ] += sum( xmm1 ) * scalar;
@@ -3758,9 +3767,9 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
          }
 
          y[j    ] += sum( xmm1 ) * scalar;
@@ -3778,8 +3787,8 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
          }
 
          y[j    ] += sum( xmm1 ) * scalar;
@@ -3795,7 +3804,7 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(i);
+            xmm1 = fmadd( A.load(i,j), x.load(i), xmm1 );
          }
 
          y[j] += sum( xmm1 ) * scalar;
@@ -4211,6 +4220,7 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT x( serial( left  ) );  // Evaluation of the left-hand side dense vector operand
       RT A( serial( right ) );  // Evaluation of the right-hand side dense matrix operand
 
@@ -4336,14 +4346,14 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
-            xmm5 = xmm5 + x1 * A.load(i,j+4UL);
-            xmm6 = xmm6 + x1 * A.load(i,j+5UL);
-            xmm7 = xmm7 + x1 * A.load(i,j+6UL);
-            xmm8 = xmm8 + x1 * A.load(i,j+7UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
+            xmm5 = fmadd( x1, A.load(i,j+4UL), xmm5 );
+            xmm6 = fmadd( x1, A.load(i,j+5UL), xmm6 );
+            xmm7 = fmadd( x1, A.load(i,j+6UL), xmm7 );
+            xmm8 = fmadd( x1, A.load(i,j+7UL), xmm8 );
          }
 
          y[j    ] -= sum( xmm1 ) * scalar;
@@ -4366,10 +4376,10 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
-            xmm4 = xmm4 + x1 * A.load(i,j+3UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
+            xmm4 = fmadd( x1, A.load(i,j+3UL), xmm4 );
          }
 
          y[j    ] -= sum( xmm1 ) * scalar;
@@ -4388,9 +4398,9 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
-            xmm3 = xmm3 + x1 * A.load(i,j+2UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
+            xmm3 = fmadd( x1, A.load(i,j+2UL), xmm3 );
          }
 
          y[j    ] -= sum( xmm1 ) * scalar;
@@ -4408,8 +4418,8 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
             const IntrinsicType x1( x.load(i) );
-            xmm1 = xmm1 + x1 * A.load(i,j    );
-            xmm2 = xmm2 + x1 * A.load(i,j+1UL);
+            xmm1 = fmadd( x1, A.load(i,j    ), xmm1 );
+            xmm2 = fmadd( x1, A.load(i,j+1UL), xmm2 );
          }
 
          y[j    ] -= sum( xmm1 ) * scalar;
@@ -4425,7 +4435,7 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
          IntrinsicType xmm1;
 
          for( size_t i=ibegin; i<iend; i+=IT::size ) {
-            xmm1 = xmm1 + A.load(i,j) * x.load(i);
+            xmm1 = fmadd( A.load(i,j), x.load(i), xmm1 );
          }
 
          y[j] -= sum( xmm1 ) * scalar;
@@ -4883,6 +4893,7 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT x( left  );  // Evaluation of the left-hand side dense vector operand
       RT A( right );  // Evaluation of the right-hand side dense matrix operand
 
@@ -4957,6 +4968,7 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT x( left  );  // Evaluation of the left-hand side dense vector operand
       RT A( right );  // Evaluation of the right-hand side dense matrix operand
 
@@ -5003,6 +5015,7 @@ class DVecScalarMultExpr< TDVecTDMatMultExpr<VT,MT>, ST, true >
          return;
       }
 
+      const ArenaTemporaries arena;  // Serving the evaluated operands from the arena
       LT x( left  );  // Evaluation of the left-hand side dense vector operand
       RT A( right );  // Evaluation of the right-hand side dense matrix operand
 
@@ -46,7 +46,6 @@
 #include <blaze/math/constraints/SparseMatrix.h>
 #include <blaze/math/constraints/SparseVector.h>
 #include <blaze/math/constraints/TransposeFlag.h>
-#include <blaze/math/dense/DynamicVector.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatVecMultExpr.h>
@@ -63,6 +62,7 @@
 #include <blaze/math/typetraits/Rows.h>
 #include <blaze/math/typetraits/Size.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/util/ArenaAllocator.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Byte.h>
 #include <blaze/util/constraints/Reference.h>
@@ -404,8 +404,8 @@ class TSMatSVecMultExpr : public SparseVector< TSMatSVecMultExpr<MT,VT>, false >
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      DynamicVector<ElementType> tmp( (~lhs).size() );
-      std::vector<byte> indices( (~lhs).size(), 0 );
+      std::vector< ElementType, ArenaAllocator<ElementType> > tmp( (~lhs).size() );
+      std::vector< byte, ArenaAllocator<byte> > indices( (~lhs).size(), 0 );
       size_t nonzeros( 0UL );
 
       const VectorIterator vend ( x.end() );
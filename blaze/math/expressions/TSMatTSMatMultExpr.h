@@ -40,9 +40,7 @@
 // Includes
 //*************************************************************************************************
 
-#include <algorithm>
 #include <stdexcept>
-#include <vector>
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/SparseMatrix.h>
 #include <blaze/math/constraints/StorageOrder.h>
@@ -51,10 +49,9 @@
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatMatMultExpr.h>
 #include <blaze/math/expressions/SparseMatrix.h>
-#include <blaze/math/Infinity.h>
 #include <blaze/math/shims/IsDefault.h>
-#include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/SMMM.h>
 #include <blaze/math/traits/ColumnExprTrait.h>
 #include <blaze/math/traits/MultExprTrait.h>
 #include <blaze/math/traits/MultTrait.h>
@@ -84,7 +81,6 @@
 #include <blaze/math/typetraits/Rows.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
-#include <blaze/util/Byte.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/InvalidType.h>
@@ -481,7 +477,9 @@ class TSMatTSMatMultExpr : public SparseMatrix< TSMatTSMatMultExpr<MT1,MT2>, tru
    // \return void
    //
    // This function implements the performance optimized assignment of a transpose sparse matrix-
-   // transpose sparse matrix multiplication expression to a column-major sparse matrix.
+   // transpose sparse matrix multiplication expression to a column-major sparse matrix. The product
+   // is computed column-wise by the Gustavson kernel of the sparse matrix/sparse matrix
+   // multiplication.
    */
    template< typename MT >  // Type of the target sparse matrix
    friend inline void assign( SparseMatrix<MT,true>& lhs, const TSMatTSMatMultExpr& rhs )
@@ -491,9 +489,6 @@ class TSMatTSMatMultExpr : public SparseMatrix< TSMatTSMatMultExpr<MT1,MT2>, tru
       BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
 
-      typedef typename RemoveReference<CT1>::Type::ConstIterator  LeftIterator;
-      typedef typename RemoveReference<CT2>::Type::ConstIterator  RightIterator;
-
       CT1 A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side sparse matrix operand
       CT2 B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side sparse matrix operand
 
@@ -504,91 +499,7 @@ class TSMatTSMatMultExpr : public SparseMatrix< TSMatTSMatMultExpr<MT1,MT2>, tru
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
 
-      // (Over-)Estimating the number of non-zero entries in the resulting matrix
-      size_t nonzeros( 0UL );
-
-      for( size_t j=0UL; j<(~lhs).columns(); ++j ) {
-         const RightIterator rend( B.end(j) );
-         for( RightIterator relem=B.begin(j); relem!=rend; ++relem ) {
-            nonzeros += A.nonZeros( relem->index() );
-         }
-      }
-
-      if( nonzeros > (~lhs).rows() * (~lhs).columns() ) {
-         nonzeros = (~lhs).rows() * (~lhs).columns();
-      }
-
-      (~lhs).reserve( nonzeros );
-      nonzeros = 0UL;
-
-      // Performing the matrix-matrix multiplication
-      std::vector<ElementType> values ( (~lhs).rows(), ElementType() );
-      std::vector<byte>        valid  ( (~lhs).rows(), 0   );
-      std::vector<size_t>      indices( (~lhs).rows(), 0UL );
-      size_t minIndex( inf ), maxIndex( 0UL );
-
-      for( size_t j=0UL; j<(~lhs).columns(); ++j )
-      {
-         const RightIterator rend( B.end(j) );
-         for( RightIterator relem=B.begin(j); relem!=rend; ++relem )
-         {
-            const LeftIterator lend( A.end( relem->index() ) );
-            for( LeftIterator lelem=A.begin( relem->index() ); lelem!=lend; ++lelem )
-            {
-               if( !valid[lelem->index()] ) {
-                  values[lelem->index()] = lelem->value() * relem->value();
-                  valid [lelem->index()] = 1;
-                  indices[nonzeros] = lelem->index();
-                  ++nonzeros;
-                  if( lelem->index() < minIndex ) minIndex = lelem->index();
-                  if( lelem->index() > maxIndex ) maxIndex = lelem->index();
-               }
-               else {
-                  values[lelem->index()] += lelem->value() * relem->value();
-               }
-            }
-         }
-
-         BLAZE_INTERNAL_ASSERT( nonzeros <= (~lhs).rows(), "Invalid number of non-zero elements" );
-
-         if( nonzeros > 0UL )
-         {
-            BLAZE_INTERNAL_ASSERT( minIndex <= maxIndex, "Invalid index detected" );
-
-            if( ( nonzeros + nonzeros ) < ( maxIndex - minIndex ) )
-            {
-               std::sort( indices.begin(), indices.begin() + nonzeros );
-
-               for( size_t i=0UL; i<nonzeros; ++i )
-               {
-                  const size_t index( indices[i] );
-                  if( !isDefault( values[index] ) ) {
-                     (~lhs).append( index, j, values[index] );
-                     reset( values[index] );
-                  }
-
-                  reset( valid [index] );
-               }
-            }
-            else {
-               for( size_t i=minIndex; i<=maxIndex; ++i )
-               {
-                  if( !isDefault( values[i] ) ) {
-                     (~lhs).append( i, j, values[i] );
-                     reset( values[i] );
-                  }
-
-                  reset( valid [i] );
-               }
-            }
-
-            nonzeros = 0UL;
-            minIndex = inf;
-            maxIndex = 0UL;
-         }
-
-         (~lhs).finalize( j );
-      }
+      smmm( ~lhs, B, A );
    }
    /*! \endcond */
    //**********************************************************************************************
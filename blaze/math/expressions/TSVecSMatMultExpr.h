@@ -48,7 +48,6 @@
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/constraints/TransposeFlag.h>
 #include <blaze/math/constraints/TVecMatMultExpr.h>
-#include <blaze/math/dense/DynamicVector.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/SparseVector.h>
@@ -66,6 +65,7 @@
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/typetraits/Size.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/util/ArenaAllocator.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Byte.h>
 #include <blaze/util/constraints/Reference.h>
@@ -408,8 +408,8 @@ class TSVecSMatMultExpr : public SparseVector< TSVecSMatMultExpr<VT,MT>, true >
       BLAZE_INTERNAL_ASSERT( A.columns() == (~lhs).size()     , "Invalid vector size"       );
 
       // Performing the sparse vector-sparse matrix multiplication
-      DynamicVector<ElementType> tmp( (~lhs).size() );
-      std::vector<byte> indices( (~lhs).size(), 0 );
+      std::vector< ElementType, ArenaAllocator<ElementType> > tmp( (~lhs).size() );
+      std::vector< byte, ArenaAllocator<byte> > indices( (~lhs).size(), 0 );
       size_t nonzeros( 0UL );
 
       const VectorIterator vend( x.end() );
@@ -0,0 +1,106 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/functors/Exp.h
+//  \brief Header file for the Exp functor
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_FUNCTORS_EXP_H_
+#define _BLAZE_MATH_FUNCTORS_EXP_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/intrinsics/FloatingPoint.h>
+#include <blaze/system/Inline.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Generic wrapper for the exp() function.
+// \ingroup math
+//
+// The Exp functor computes the exponential of scalar values and intrinsic vectors. It
+// can be used as operation of the map() functions for dense vectors and dense matrices.
+*/
+struct Exp
+{
+   //**********************************************************************************************
+   /*!\brief Returns the result of the exp() function for the given value.
+   //
+   // \param a The given value.
+   // \return The result of the exp() function for the given value.
+   */
+   template< typename T >
+   BLAZE_ALWAYS_INLINE T operator()( const T& a ) const
+   {
+      using std::exp;
+      return exp( a );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the result of the exp() function for the given intrinsic vector.
+   //
+   // \param a The given intrinsic vector.
+   // \return The result of the exp() function for the given intrinsic vector.
+   */
+   template< typename T >
+   BLAZE_ALWAYS_INLINE T load( const T& a ) const
+   {
+      return exp( a );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Compile time check whether the exp() function is vectorizable for the data type \a T.
+   */
+   template< typename T >
+   struct Vectorizable {
+      enum { value = TranscendentalTrait<T>::value };
+   };
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,112 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/functors/Minimum.h
+//  \brief Header file for the Minimum functor
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_FUNCTORS_MINIMUM_H_
+#define _BLAZE_MATH_FUNCTORS_MINIMUM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/traits/MathTrait.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Generic wrapper for the min() function.
+// \ingroup math
+//
+// The Minimum functor computes the minimum of two scalar values or two intrinsic vectors.
+// It can be used as operation of the binary map() function for dense vectors.
+*/
+struct Minimum
+{
+   //**********************************************************************************************
+   /*!\brief Returns the result of the min() function for the given values.
+   //
+   // \param a The left-hand side value.
+   // \param b The right-hand side value.
+   // \return The result of the min() function for the given values.
+   */
+   template< typename T1, typename T2 >
+   BLAZE_ALWAYS_INLINE const typename MathTrait<T1,T2>::HighType
+      operator()( const T1& a, const T2& b ) const
+   {
+      return min( a, b );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the result of the min() function for the given intrinsic vectors.
+   //
+   // \param a The left-hand side intrinsic vector.
+   // \param b The right-hand side intrinsic vector.
+   // \return The result of the min() function for the given intrinsic vectors.
+   */
+   template< typename T >
+   BLAZE_ALWAYS_INLINE T load( const T& a, const T& b ) const
+   {
+      return min( a, b );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Compile time check whether the min() function is vectorizable for the data type \a T.
+   */
+   template< typename T >
+   struct Vectorizable {
+      enum { value = !BLAZE_MIC_MODE && ( ( IsFloat<T>::value && BLAZE_SSE_MODE ) ||
+                                          ( IsDouble<T>::value && BLAZE_SSE2_MODE ) ) };
+   };
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
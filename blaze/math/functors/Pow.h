@@ -0,0 +1,177 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/functors/Pow.h
+//  \brief Header file for the Pow and UnaryPow functors
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_FUNCTORS_POW_H_
+#define _BLAZE_MATH_FUNCTORS_POW_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/intrinsics/FloatingPoint.h>
+#include <blaze/math/traits/MathTrait.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Generic wrapper for the pow() function.
+// \ingroup math
+//
+// The Pow functor raises scalar values or intrinsic vectors to the power of the second operand.
+// It can be used as operation of the binary map() function for dense vectors.
+*/
+struct Pow
+{
+   //**********************************************************************************************
+   /*!\brief Returns the result of the pow() function for the given values.
+   //
+   // \param a The left-hand side value.
+   // \param b The right-hand side value.
+   // \return The result of the pow() function for the given values.
+   */
+   template< typename T1, typename T2 >
+   BLAZE_ALWAYS_INLINE const typename MathTrait<T1,T2>::HighType
+      operator()( const T1& a, const T2& b ) const
+   {
+      using std::pow;
+      return pow( a, b );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the result of the pow() function for the given intrinsic vectors.
+   //
+   // \param a The left-hand side intrinsic vector.
+   // \param b The right-hand side intrinsic vector.
+   // \return The result of the pow() function for the given intrinsic vectors.
+   */
+   template< typename T >
+   BLAZE_ALWAYS_INLINE T load( const T& a, const T& b ) const
+   {
+      return pow( a, b );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Compile time check whether the pow() function is vectorizable for the data type \a T.
+   */
+   template< typename T >
+   struct Vectorizable {
+      enum { value = TranscendentalTrait<T>::value };
+   };
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Generic wrapper for the pow() function with fixed exponent.
+// \ingroup math
+//
+// The UnaryPow functor raises scalar values and intrinsic vectors to the power of the exponent
+// given at construction time. It can be used as operation of the map() functions for dense
+// vectors and dense matrices.
+*/
+template< typename ET >  // Type of the exponent
+class UnaryPow
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor of the UnaryPow functor.
+   //
+   // \param exp The exponent.
+   */
+   explicit inline UnaryPow( ET exp )
+      : exp_( exp )  // The exponent
+   {}
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the result of the pow() function for the given value.
+   //
+   // \param a The given value.
+   // \return The result of the pow() function for the given value.
+   */
+   template< typename T >
+   BLAZE_ALWAYS_INLINE T operator()( const T& a ) const
+   {
+      using std::pow;
+      return pow( a, exp_ );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns the result of the pow() function for the given intrinsic vector.
+   //
+   // \param a The given intrinsic vector.
+   // \return The result of the pow() function for the given intrinsic vector.
+   */
+   template< typename T >
+   BLAZE_ALWAYS_INLINE T load( const T& a ) const
+   {
+      return pow( a, set( exp_ ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Compile time check whether the pow() function is vectorizable for the data type \a T.
+   */
+   template< typename T >
+   struct Vectorizable {
+      enum { value = TranscendentalTrait<T>::value && IsSame<T,ET>::value };
+   };
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   ET exp_;  //!< The exponent.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -61,7 +61,12 @@ namespace blaze {
 // \param a The vector of 8-bit integral values.
 // \return The absolute values.
 */
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512_MODE
+BLAZE_ALWAYS_INLINE sse_int8_t abs( const sse_int8_t& a )
+{
+   return _mm512_abs_epi8( a.value );
+}
+#elif BLAZE_AVX2_MODE
 BLAZE_ALWAYS_INLINE sse_int8_t abs( const sse_int8_t& a )
 {
    return _mm256_abs_epi8( a.value );
@@ -83,7 +88,12 @@ BLAZE_ALWAYS_INLINE sse_int8_t abs( const sse_int8_t& a )
 // \param a The vector of 16-bit integral values.
 // \return The absolute values.
 */
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512_MODE
+BLAZE_ALWAYS_INLINE sse_int16_t abs( const sse_int16_t& a )
+{
+   return _mm512_abs_epi16( a.value );
+}
+#elif BLAZE_AVX2_MODE
 BLAZE_ALWAYS_INLINE sse_int16_t abs( const sse_int16_t& a )
 {
    return _mm256_abs_epi16( a.value );
@@ -105,7 +115,12 @@ BLAZE_ALWAYS_INLINE sse_int16_t abs( const sse_int16_t& a )
 // \param a The vector of 32-bit integral values.
 // \return The absolute values.
 */
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512_MODE
+BLAZE_ALWAYS_INLINE sse_int32_t abs( const sse_int32_t& a )
+{
+   return _mm512_abs_epi32( a.value );
+}
+#elif BLAZE_AVX2_MODE
 BLAZE_ALWAYS_INLINE sse_int32_t abs( const sse_int32_t& a )
 {
    return _mm256_abs_epi32( a.value );
@@ -118,6 +133,60 @@ BLAZE_ALWAYS_INLINE sse_int32_t abs( const sse_int32_t& a )
 #endif
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\fn sse_float_t abs( sse_float_t )
+// \brief Absolute value of a vector of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of single precision floating point values.
+// \return The absolute values.
+*/
+#if BLAZE_AVX512_MODE
+BLAZE_ALWAYS_INLINE sse_float_t abs( const sse_float_t& a )
+{
+   return _mm512_abs_ps( a.value );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_float_t abs( const sse_float_t& a )
+{
+   return _mm256_andnot_ps( _mm256_set1_ps( -0.0F ), a.value );
+}
+#elif BLAZE_SSE_MODE
+BLAZE_ALWAYS_INLINE sse_float_t abs( const sse_float_t& a )
+{
+   return _mm_andnot_ps( _mm_set1_ps( -0.0F ), a.value );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t abs( sse_double_t )
+// \brief Absolute value of a vector of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of double precision floating point values.
+// \return The absolute values.
+*/
+#if BLAZE_AVX512_MODE
+BLAZE_ALWAYS_INLINE sse_double_t abs( const sse_double_t& a )
+{
+   return _mm512_abs_pd( a.value );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_double_t abs( const sse_double_t& a )
+{
+   return _mm256_andnot_pd( _mm256_set1_pd( -0.0 ), a.value );
+}
+#elif BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE sse_double_t abs( const sse_double_t& a )
+{
+   return _mm_andnot_pd( _mm_set1_pd( -0.0 ), a.value );
+}
+#endif
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
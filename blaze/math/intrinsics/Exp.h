@@ -0,0 +1,163 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Exp.h
+//  \brief Header file for the intrinsic exponential functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_EXP_H_
+#define _BLAZE_MATH_INTRINSICS_EXP_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <limits>
+#include <blaze/math/intrinsics/Addition.h>
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/math/intrinsics/Division.h>
+#include <blaze/math/intrinsics/FloatingPoint.h>
+#include <blaze/math/intrinsics/FMA.h>
+#include <blaze/math/intrinsics/Max.h>
+#include <blaze/math/intrinsics/Min.h>
+#include <blaze/math/intrinsics/Multiplication.h>
+#include <blaze/math/intrinsics/Set.h>
+#include <blaze/math/intrinsics/Subtraction.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC EXPONENTIAL FUNCTIONS
+//
+//=================================================================================================
+
+#if BLAZE_SSE2_MODE && !BLAZE_AVX512_MODE && !BLAZE_MIC_MODE
+
+//*************************************************************************************************
+/*!\fn sse_float_t exp( sse_float_t )
+// \brief Exponential function for a vector of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of single precision floating point values.
+// \return The resulting exponential values.
+//
+// The argument is reduced to \f$ r = a - n \ln 2 \f$ with \f$ |r| \leq \ln(2)/2 \f$ by means
+// of a two part representation of \f$ \ln 2 \f$ (Cody-Waite reduction). \f$ e^r \f$ is
+// approximated by a polynomial of degree 7 and scaled by \f$ 2^n \f$. The maximum error is
+// 2 ULP for all arguments resulting in normalized values. Arguments larger than 88.72 result
+// in infinity, arguments smaller than -87.34 result in zero.
+*/
+BLAZE_ALWAYS_INLINE sse_float_t exp( const sse_float_t& a )
+{
+   const sse_float_t zero( set( 0.0F ) );
+   const sse_float_t one ( set( 1.0F ) );
+   const sse_float_t inf ( set( std::numeric_limits<float>::infinity() ) );
+   const sse_float_t high( set(  88.72283905206835F ) );
+   const sse_float_t low ( set( -87.33654475055310F ) );
+
+   const sse_float_t x( min( high, max( low, a ) ) );
+   const sse_float_t n( rint( x * set( 1.44269504088896341F ) ) );
+   const sse_float_t r( fnmadd( n, set( -2.12194440E-4F ), fnmadd( n, set( 0.693359375F ), x ) ) );
+
+   sse_float_t p( set( 1.9875691500E-4F ) );
+   p = fmadd( p, r, set( 1.3981999507E-3F ) );
+   p = fmadd( p, r, set( 8.3334519073E-3F ) );
+   p = fmadd( p, r, set( 4.1665795894E-2F ) );
+   p = fmadd( p, r, set( 1.6666665459E-1F ) );
+   p = fmadd( p, r, set( 5.0000001201E-1F ) );
+   p = fmadd( p, r*r, r ) + one;
+
+   // Splitting the scaling for n=128
+   const sse_float_t s( select( cmplt( zero, n ), one, zero ) );
+   const sse_float_t y( p * exp2i( n - s ) * ( one + s ) );
+
+   return select( cmplt( a, low ), zero, select( cmplt( high, a ), inf, y ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t exp( sse_double_t )
+// \brief Exponential function for a vector of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of double precision floating point values.
+// \return The resulting exponential values.
+//
+// The argument is reduced to \f$ r = a - n \ln 2 \f$ with \f$ |r| \leq \ln(2)/2 \f$ by means
+// of a two part representation of \f$ \ln 2 \f$ (Cody-Waite reduction). \f$ e^r \f$ is
+// approximated by the Pade approximation \f$ 1 + 2rP(r^2)/(Q(r^2)-rP(r^2)) \f$ and scaled by
+// \f$ 2^n \f$. The maximum error is 2 ULP for all arguments resulting in normalized values.
+// Arguments larger than 709.78 result in infinity, arguments smaller than -708.39 result in
+// zero.
+*/
+BLAZE_ALWAYS_INLINE sse_double_t exp( const sse_double_t& a )
+{
+   const sse_double_t zero( set( 0.0 ) );
+   const sse_double_t one ( set( 1.0 ) );
+   const sse_double_t inf ( set( std::numeric_limits<double>::infinity() ) );
+   const sse_double_t high( set(  709.782712893383996843 ) );
+   const sse_double_t low ( set( -708.396418532264106224 ) );
+
+   const sse_double_t x( min( high, max( low, a ) ) );
+   const sse_double_t n( rint( x * set( 1.4426950408889634073599 ) ) );
+   const sse_double_t r( fnmadd( n, set( 1.42860682030941723212E-6 ), fnmadd( n, set( 6.93145751953125E-1 ), x ) ) );
+   const sse_double_t rr( r * r );
+
+   sse_double_t p( set( 1.26177193074810590878E-4 ) );
+   p = fmadd( p, rr, set( 3.02994407707441961300E-2 ) );
+   p = fmadd( p, rr, set( 9.99999999999999999910E-1 ) );
+   p = p * r;
+
+   sse_double_t q( set( 3.00198505138664455042E-6 ) );
+   q = fmadd( q, rr, set( 2.52448340349684104192E-3 ) );
+   q = fmadd( q, rr, set( 2.27265548208155028766E-1 ) );
+   q = fmadd( q, rr, set( 2.00000000000000000009E0 ) );
+
+   const sse_double_t e( p / ( q - p ) );
+
+   // Splitting the scaling for n=1024
+   const sse_double_t s( select( cmplt( zero, n ), one, zero ) );
+   const sse_double_t y( ( one + ( e + e ) ) * exp2i( n - s ) * ( one + s ) );
+
+   return select( cmplt( a, low ), zero, select( cmplt( high, a ), inf, y ) );
+}
+//*************************************************************************************************
+
+#endif
+
+} // namespace blaze
+
+#endif
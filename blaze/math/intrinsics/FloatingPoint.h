@@ -0,0 +1,621 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/FloatingPoint.h
+//  \brief Header file for the intrinsic floating point manipulation functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_FLOATINGPOINT_H_
+#define _BLAZE_MATH_INTRINSICS_FLOATINGPOINT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS TRANSCENDENTALTRAIT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Availability of the intrinsic transcendental functions for the data type \a T.
+// \ingroup intrinsics
+//
+// The \a value member enumeration of the TranscendentalTrait class template is set to 1 in
+// case the intrinsic exp(), log(), sin(), cos(), and pow() functions are available for the
+// intrinsic type of \a T. This is the case for single and double precision floating point
+// values in case SSE2 or AVX is available. Otherwise \a value is set to 0.
+*/
+template< typename T >
+struct TranscendentalTrait
+{
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   enum { value = ( IsFloat<T>::value || IsDouble<T>::value ) &&
+                  BLAZE_SSE2_MODE && !BLAZE_AVX512_MODE && !BLAZE_MIC_MODE };
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INTRINSIC FLOATING POINT MANIPULATION FUNCTIONS
+//
+//=================================================================================================
+
+// The following functions are the building blocks of the intrinsic transcendental functions.
+// All of them operate on the bit representation of IEEE 754 values and are therefore only
+// provided for the SSE2 and AVX modes (see the TranscendentalTrait class template). All
+// integral values (exponents and quadrants) are represented as integral floating point values.
+
+#if !BLAZE_AVX512_MODE && !BLAZE_MIC_MODE
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Rounding of a vector of single precision values to the nearest integral values.
+// \ingroup intrinsics
+//
+// \param a The vector of single precision floating point values (\f$ |a| < 2^{31} \f$).
+// \return The rounded values.
+*/
+#if BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_float_t rint( const sse_float_t& a )
+{
+   return _mm256_round_ps( a.value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+}
+#elif BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE sse_float_t rint( const sse_float_t& a )
+{
+   return _mm_cvtepi32_ps( _mm_cvtps_epi32( a.value ) );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Rounding of a vector of double precision values to the nearest integral values.
+// \ingroup intrinsics
+//
+// \param a The vector of double precision floating point values (\f$ |a| < 2^{31} \f$).
+// \return The rounded values.
+*/
+#if BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_double_t rint( const sse_double_t& a )
+{
+   return _mm256_round_pd( a.value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+}
+#elif BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE sse_double_t rint( const sse_double_t& a )
+{
+   return _mm_cvtepi32_pd( _mm_cvtpd_epi32( a.value ) );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Rounding of a vector of single precision values to the next smaller integral values.
+// \ingroup intrinsics
+//
+// \param a The vector of single precision floating point values (\f$ |a| < 2^{31} \f$).
+// \return The rounded values.
+*/
+#if BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_float_t floor( const sse_float_t& a )
+{
+   return _mm256_floor_ps( a.value );
+}
+#elif BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE sse_float_t floor( const sse_float_t& a )
+{
+   const __m128 r( _mm_cvtepi32_ps( _mm_cvtps_epi32( a.value ) ) );
+   return _mm_sub_ps( r, _mm_and_ps( _mm_cmplt_ps( a.value, r ), _mm_set1_ps( 1.0F ) ) );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Rounding of a vector of double precision values to the next smaller integral values.
+// \ingroup intrinsics
+//
+// \param a The vector of double precision floating point values (\f$ |a| < 2^{31} \f$).
+// \return The rounded values.
+*/
+#if BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_double_t floor( const sse_double_t& a )
+{
+   return _mm256_floor_pd( a.value );
+}
+#elif BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE sse_double_t floor( const sse_double_t& a )
+{
+   const __m128d r( _mm_cvtepi32_pd( _mm_cvtpd_epi32( a.value ) ) );
+   return _mm_sub_pd( r, _mm_and_pd( _mm_cmplt_pd( a.value, r ), _mm_set1_pd( 1.0 ) ) );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of \f$ 2^n \f$ for a vector of integral single precision values.
+// \ingroup intrinsics
+//
+// \param n The vector of integral exponents in the range \f$ [-126..127] \f$.
+// \return The resulting powers of two.
+*/
+#if BLAZE_AVX2_MODE
+BLAZE_ALWAYS_INLINE sse_float_t exp2i( const sse_float_t& n )
+{
+   const __m256i e( _mm256_add_epi32( _mm256_cvtps_epi32( n.value ), _mm256_set1_epi32( 127 ) ) );
+   return _mm256_castsi256_ps( _mm256_slli_epi32( e, 23 ) );
+}
+#elif BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_float_t exp2i( const sse_float_t& n )
+{
+   const __m256i e( _mm256_cvtps_epi32( n.value ) );
+   const __m128i bias( _mm_set1_epi32( 127 ) );
+   const __m128i lo( _mm_slli_epi32( _mm_add_epi32( _mm256_castsi256_si128( e ), bias ), 23 ) );
+   const __m128i hi( _mm_slli_epi32( _mm_add_epi32( _mm256_extractf128_si256( e, 1 ), bias ), 23 ) );
+   return _mm256_castsi256_ps( _mm256_insertf128_si256( _mm256_castsi128_si256( lo ), hi, 1 ) );
+}
+#elif BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE sse_float_t exp2i( const sse_float_t& n )
+{
+   const __m128i e( _mm_add_epi32( _mm_cvtps_epi32( n.value ), _mm_set1_epi32( 127 ) ) );
+   return _mm_castsi128_ps( _mm_slli_epi32( e, 23 ) );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of \f$ 2^n \f$ for a vector of integral double precision values.
+// \ingroup intrinsics
+//
+// \param n The vector of integral exponents in the range \f$ [-1022..1023] \f$.
+// \return The resulting powers of two.
+*/
+#if BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_double_t exp2i( const sse_double_t& n )
+{
+   const __m128i e( _mm_slli_epi32( _mm_add_epi32( _mm256_cvtpd_epi32( n.value ), _mm_set1_epi32( 1023 ) ), 20 ) );
+   const __m128i lo( _mm_unpacklo_epi32( _mm_setzero_si128(), e ) );
+   const __m128i hi( _mm_unpackhi_epi32( _mm_setzero_si128(), e ) );
+   return _mm256_castsi256_pd( _mm256_insertf128_si256( _mm256_castsi128_si256( lo ), hi, 1 ) );
+}
+#elif BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE sse_double_t exp2i( const sse_double_t& n )
+{
+   const __m128i e( _mm_slli_epi32( _mm_add_epi32( _mm_cvtpd_epi32( n.value ), _mm_set1_epi32( 1023 ) ), 20 ) );
+   return _mm_castsi128_pd( _mm_unpacklo_epi32( _mm_setzero_si128(), e ) );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Extraction of the mantissas of a vector of single precision values.
+// \ingroup intrinsics
+//
+// \param a The vector of positive, normalized single precision floating point values.
+// \return The mantissas in the range \f$ [0.5..1) \f$.
+//
+// This function returns the mantissas \f$ m \f$ of the decompositions \f$ a = m \cdot 2^e \f$
+// (see the exponent() function).
+*/
+#if BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_float_t mantissa( const sse_float_t& a )
+{
+   const __m256 mask( _mm256_castsi256_ps( _mm256_set1_epi32( 0x007FFFFF ) ) );
+   return _mm256_or_ps( _mm256_and_ps( a.value, mask ), _mm256_set1_ps( 0.5F ) );
+}
+#elif BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE sse_float_t mantissa( const sse_float_t& a )
+{
+   const __m128 mask( _mm_castsi128_ps( _mm_set1_epi32( 0x007FFFFF ) ) );
+   return _mm_or_ps( _mm_and_ps( a.value, mask ), _mm_set1_ps( 0.5F ) );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Extraction of the mantissas of a vector of double precision values.
+// \ingroup intrinsics
+//
+// \param a The vector of positive, normalized double precision floating point values.
+// \return The mantissas in the range \f$ [0.5..1) \f$.
+//
+// This function returns the mantissas \f$ m \f$ of the decompositions \f$ a = m \cdot 2^e \f$
+// (see the exponent() function).
+*/
+#if BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_double_t mantissa( const sse_double_t& a )
+{
+   const __m256d mask( _mm256_castsi256_pd( _mm256_set_epi32( 0x000FFFFF, -1, 0x000FFFFF, -1,
+                                                               0x000FFFFF, -1, 0x000FFFFF, -1 ) ) );
+   return _mm256_or_pd( _mm256_and_pd( a.value, mask ), _mm256_set1_pd( 0.5 ) );
+}
+#elif BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE sse_double_t mantissa( const sse_double_t& a )
+{
+   const __m128d mask( _mm_castsi128_pd( _mm_set_epi32( 0x000FFFFF, -1, 0x000FFFFF, -1 ) ) );
+   return _mm_or_pd( _mm_and_pd( a.value, mask ), _mm_set1_pd( 0.5 ) );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Extraction of the exponents of a vector of single precision values.
+// \ingroup intrinsics
+//
+// \param a The vector of positive, normalized single precision floating point values.
+// \return The integral exponents.
+//
+// This function returns the exponents \f$ e \f$ of the decompositions \f$ a = m \cdot 2^e \f$
+// with \f$ m \in [0.5..1) \f$. The biased exponent bits are converted exactly since they
+// represent an integral multiple of \f$ 2^{23} \f$ with at most 8 significant bits.
+*/
+#if BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_float_t exponent( const sse_float_t& a )
+{
+   const __m256 mask( _mm256_castsi256_ps( _mm256_set1_epi32( 0x7F800000 ) ) );
+   const __m256 e( _mm256_cvtepi32_ps( _mm256_castps_si256( _mm256_and_ps( a.value, mask ) ) ) );
+   return _mm256_sub_ps( _mm256_mul_ps( e, _mm256_set1_ps( 1.0F / 8388608.0F ) ), _mm256_set1_ps( 126.0F ) );
+}
+#elif BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE sse_float_t exponent( const sse_float_t& a )
+{
+   const __m128 mask( _mm_castsi128_ps( _mm_set1_epi32( 0x7F800000 ) ) );
+   const __m128 e( _mm_cvtepi32_ps( _mm_castps_si128( _mm_and_ps( a.value, mask ) ) ) );
+   return _mm_sub_ps( _mm_mul_ps( e, _mm_set1_ps( 1.0F / 8388608.0F ) ), _mm_set1_ps( 126.0F ) );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Extraction of the exponents of a vector of double precision values.
+// \ingroup intrinsics
+//
+// \param a The vector of positive, normalized double precision floating point values.
+// \return The integral exponents.
+//
+// This function returns the exponents \f$ e \f$ of the decompositions \f$ a = m \cdot 2^e \f$
+// with \f$ m \in [0.5..1) \f$. The biased exponent bits are shifted into the mantissa of
+// \f$ 2^{52} \f$, which converts them into a floating point value without any rounding.
+*/
+#if BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_double_t exponent( const sse_double_t& a )
+{
+   const __m128i magic( _mm_set_epi32( 0x43300000, 0, 0x43300000, 0 ) );
+   const __m256i bits( _mm256_castpd_si256( a.value ) );
+   const __m128i lo( _mm_or_si128( _mm_srli_epi64( _mm256_castsi256_si128( bits ), 52 ), magic ) );
+   const __m128i hi( _mm_or_si128( _mm_srli_epi64( _mm256_extractf128_si256( bits, 1 ), 52 ), magic ) );
+   const __m256d e( _mm256_castsi256_pd( _mm256_insertf128_si256( _mm256_castsi128_si256( lo ), hi, 1 ) ) );
+   return _mm256_sub_pd( e, _mm256_set1_pd( 4503599627370496.0 + 1022.0 ) );
+}
+#elif BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE sse_double_t exponent( const sse_double_t& a )
+{
+   const __m128i magic( _mm_set_epi32( 0x43300000, 0, 0x43300000, 0 ) );
+   const __m128i e( _mm_or_si128( _mm_srli_epi64( _mm_castpd_si128( a.value ), 52 ), magic ) );
+   return _mm_sub_pd( _mm_castsi128_pd( e ), _mm_set1_pd( 4503599627370496.0 + 1022.0 ) );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Componentwise less-than comparison of two vectors of single precision values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The resulting bit mask.
+*/
+#if BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_float_t cmplt( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm256_cmp_ps( a.value, b.value, _CMP_LT_OQ );
+}
+#elif BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE sse_float_t cmplt( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm_cmplt_ps( a.value, b.value );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Componentwise less-than comparison of two vectors of double precision values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The resulting bit mask.
+*/
+#if BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_double_t cmplt( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm256_cmp_pd( a.value, b.value, _CMP_LT_OQ );
+}
+#elif BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE sse_double_t cmplt( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm_cmplt_pd( a.value, b.value );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Componentwise equality comparison of two vectors of single precision values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The resulting bit mask.
+*/
+#if BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_float_t cmpeq( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm256_cmp_ps( a.value, b.value, _CMP_EQ_OQ );
+}
+#elif BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE sse_float_t cmpeq( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm_cmpeq_ps( a.value, b.value );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Componentwise equality comparison of two vectors of double precision values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The resulting bit mask.
+*/
+#if BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_double_t cmpeq( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm256_cmp_pd( a.value, b.value, _CMP_EQ_OQ );
+}
+#elif BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE sse_double_t cmpeq( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm_cmpeq_pd( a.value, b.value );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Componentwise not-greater-or-equal comparison of two vectors of single precision values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The resulting bit mask.
+//
+// In contrast to the cmplt() function, the comparison evaluates to \a true in case any of the
+// two operands is not a number.
+*/
+#if BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_float_t cmpnge( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm256_cmp_ps( a.value, b.value, _CMP_NGE_UQ );
+}
+#elif BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE sse_float_t cmpnge( const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm_cmpnge_ps( a.value, b.value );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Componentwise not-greater-or-equal comparison of two vectors of double precision values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The resulting bit mask.
+//
+// In contrast to the cmplt() function, the comparison evaluates to \a true in case any of the
+// two operands is not a number.
+*/
+#if BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_double_t cmpnge( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm256_cmp_pd( a.value, b.value, _CMP_NGE_UQ );
+}
+#elif BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE sse_double_t cmpnge( const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm_cmpnge_pd( a.value, b.value );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Componentwise selection between two vectors of single precision values.
+// \ingroup intrinsics
+//
+// \param mask The bit mask resulting from a comparison.
+// \param a The values selected for set mask components.
+// \param b The values selected for cleared mask components.
+// \return The selected values.
+*/
+#if BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_float_t select( const sse_float_t& mask, const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm256_blendv_ps( b.value, a.value, mask.value );
+}
+#elif BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE sse_float_t select( const sse_float_t& mask, const sse_float_t& a, const sse_float_t& b )
+{
+   return _mm_or_ps( _mm_and_ps( mask.value, a.value ), _mm_andnot_ps( mask.value, b.value ) );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Componentwise selection between two vectors of double precision values.
+// \ingroup intrinsics
+//
+// \param mask The bit mask resulting from a comparison.
+// \param a The values selected for set mask components.
+// \param b The values selected for cleared mask components.
+// \return The selected values.
+*/
+#if BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE sse_double_t select( const sse_double_t& mask, const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm256_blendv_pd( b.value, a.value, mask.value );
+}
+#elif BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE sse_double_t select( const sse_double_t& mask, const sse_double_t& a, const sse_double_t& b )
+{
+   return _mm_or_pd( _mm_and_pd( mask.value, a.value ), _mm_andnot_pd( mask.value, b.value ) );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Test whether any component of a single precision comparison mask is set.
+// \ingroup intrinsics
+//
+// \param mask The bit mask resulting from a comparison.
+// \return \a true in case at least one component is set, \a false if not.
+*/
+#if BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE bool any( const sse_float_t& mask )
+{
+   return _mm256_movemask_ps( mask.value ) != 0;
+}
+#elif BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE bool any( const sse_float_t& mask )
+{
+   return _mm_movemask_ps( mask.value ) != 0;
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Test whether any component of a double precision comparison mask is set.
+// \ingroup intrinsics
+//
+// \param mask The bit mask resulting from a comparison.
+// \return \a true in case at least one component is set, \a false if not.
+*/
+#if BLAZE_AVX_MODE
+BLAZE_ALWAYS_INLINE bool any( const sse_double_t& mask )
+{
+   return _mm256_movemask_pd( mask.value ) != 0;
+}
+#elif BLAZE_SSE2_MODE
+BLAZE_ALWAYS_INLINE bool any( const sse_double_t& mask )
+{
+   return _mm_movemask_pd( mask.value ) != 0;
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+} // namespace blaze
+
+#endif
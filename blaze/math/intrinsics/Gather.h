@@ -0,0 +1,144 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Gather.h
+//  \brief Header file for the intrinsic gather functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_GATHER_H_
+#define _BLAZE_MATH_INTRINSICS_GATHER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/math/intrinsics/Load.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC GATHER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the gather operation.
+// \ingroup intrinsics
+//
+// \param address The base address of the values to be gathered.
+// \param indices The indices of the values to be gathered.
+// \return The vector of gathered values.
+//
+// This function is selected for all instruction sets without gather operations. It copies the
+// indexed values into a properly aligned buffer and loads the buffer.
+*/
+template< typename IT    // Type of the intrinsic vector
+        , typename T >  // Type of the values
+BLAZE_ALWAYS_INLINE IT gatherBackend( const T* address, const int32_t* indices )
+{
+   AlignedArray<T,sizeof(IT)/sizeof(T)> array;
+   for( size_t i=0UL; i<sizeof(IT)/sizeof(T); ++i )
+      array[i] = address[indices[i]];
+   return load( array.data() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param address The base address of the values to be gathered.
+// \param indices The indices of the values to be gathered.
+// \return The vector of gathered values.
+//
+// This function loads the single precision floating point values at the positions
+// <tt>address[indices[0]]</tt>, <tt>address[indices[1]]</tt>, ... into a vector. The
+// \a indices array must contain as many 32-bit indices as the vector contains values and
+// is not required to be properly aligned.
+*/
+BLAZE_ALWAYS_INLINE sse_float_t gather( const float* address, const int32_t* indices )
+{
+#if BLAZE_AVX512_MODE
+   return _mm512_mask_i32gather_ps( _mm512_setzero_ps(), static_cast<__mmask16>( 0xFFFF )
+                                  , _mm512_loadu_si512( indices ), address, 4 );
+#elif BLAZE_AVX2_MODE
+   return _mm256_mask_i32gather_ps( _mm256_setzero_ps(), address
+                                  , _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices ) )
+                                  , _mm256_castsi256_ps( _mm256_set1_epi32( -1 ) ), 4 );
+#else
+   return gatherBackend<sse_float_t>( address, indices );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param address The base address of the values to be gathered.
+// \param indices The indices of the values to be gathered.
+// \return The vector of gathered values.
+//
+// This function loads the double precision floating point values at the positions
+// <tt>address[indices[0]]</tt>, <tt>address[indices[1]]</tt>, ... into a vector. The
+// \a indices array must contain as many 32-bit indices as the vector contains values and
+// is not required to be properly aligned.
+*/
+BLAZE_ALWAYS_INLINE sse_double_t gather( const double* address, const int32_t* indices )
+{
+#if BLAZE_AVX512_MODE
+   return _mm512_mask_i32gather_pd( _mm512_setzero_pd(), static_cast<__mmask8>( 0xFF )
+                                  , _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices ) )
+                                  , address, 8 );
+#elif BLAZE_AVX2_MODE
+   return _mm256_mask_i32gather_pd( _mm256_setzero_pd(), address
+                                  , _mm_loadu_si128( reinterpret_cast<const __m128i*>( indices ) )
+                                  , _mm256_castsi256_pd( _mm256_set1_epi64x( -1L ) ), 8 );
+#else
+   return gatherBackend<sse_double_t>( address, indices );
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -80,7 +80,9 @@ BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,2UL> >, sse
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512_MODE
+   return _mm512_load_si512( reinterpret_cast<const __m512i*>( address ) );
+#elif BLAZE_AVX2_MODE
    return _mm256_load_si256( reinterpret_cast<const __m256i*>( address ) );
 #elif BLAZE_SSE2_MODE
    return _mm_load_si128( reinterpret_cast<const __m128i*>( address ) );
@@ -108,7 +110,7 @@ BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,4UL> >, sse
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE || BLAZE_MIC_MODE
    return _mm512_load_epi32( address );
 #elif BLAZE_AVX2_MODE
    return _mm256_load_si256( reinterpret_cast<const __m256i*>( address ) );
@@ -138,7 +140,7 @@ BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,8UL> >, sse
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE || BLAZE_MIC_MODE
    return _mm512_load_epi64( address );
 #elif BLAZE_AVX2_MODE
    return _mm256_load_si256( reinterpret_cast<const __m256i*>( address ) );
@@ -166,7 +168,7 @@ BLAZE_ALWAYS_INLINE sse_float_t load( const float* address )
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE || BLAZE_MIC_MODE
    return _mm512_load_ps( address );
 #elif BLAZE_AVX_MODE
    return _mm256_load_ps( address );
@@ -194,7 +196,7 @@ BLAZE_ALWAYS_INLINE sse_double_t load( const double* address )
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE || BLAZE_MIC_MODE
    return _mm512_load_pd( address );
 #elif BLAZE_AVX_MODE
    return _mm256_load_pd( address );
@@ -223,7 +225,7 @@ BLAZE_ALWAYS_INLINE sse_cfloat_t load( const complex<float>* address )
    BLAZE_STATIC_ASSERT  ( sizeof( complex<float> ) == 2UL*sizeof( float ) );
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE || BLAZE_MIC_MODE
    return _mm512_load_ps( reinterpret_cast<const float*>( address ) );
 #elif BLAZE_AVX_MODE
    return _mm256_load_ps( reinterpret_cast<const float*>( address ) );
@@ -252,7 +254,7 @@ BLAZE_ALWAYS_INLINE sse_cdouble_t load( const complex<double>* address )
    BLAZE_STATIC_ASSERT  ( sizeof( complex<double> ) == 2UL*sizeof( double ) );
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE || BLAZE_MIC_MODE
    return _mm512_load_pd( reinterpret_cast<const double*>( address ) );
 #elif BLAZE_AVX_MODE
    return _mm256_load_pd( reinterpret_cast<const double*>( address ) );
@@ -75,7 +75,9 @@ template< typename T >  // Type of the integral value
 BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,2UL> >, sse_int16_t >::Type
    loadu( const T* address )
 {
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512_MODE
+   return _mm512_loadu_si512( reinterpret_cast<const __m512i*>( address ) );
+#elif BLAZE_AVX2_MODE
    return _mm256_loadu_si256( reinterpret_cast<const __m256i*>( address ) );
 #elif BLAZE_SSE2_MODE
    return _mm_loadu_si128( reinterpret_cast<const __m128i*>( address ) );
@@ -100,7 +102,9 @@ template< typename T >  // Type of the integral value
 BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,4UL> >, sse_int32_t >::Type
    loadu( const T* address )
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE
+   return _mm512_loadu_si512( reinterpret_cast<const __m512i*>( address ) );
+#elif BLAZE_MIC_MODE
    __m512i v1 = _mm512_setzero_epi32();
    v1 = _mm512_loadunpacklo_epi32( v1, address );
    v1 = _mm512_loadunpackhi_epi32( v1, address+16UL );
@@ -130,7 +134,9 @@ template< typename T >  // Type of the integral value
 BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,8UL> >, sse_int64_t >::Type
    loadu( const T* address )
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE
+   return _mm512_loadu_si512( reinterpret_cast<const __m512i*>( address ) );
+#elif BLAZE_MIC_MODE
    __m512i v1 = _mm512_setzero_epi32();
    v1 = _mm512_loadunpacklo_epi64( v1, address );
    v1 = _mm512_loadunpackhi_epi64( v1, address+8UL );
@@ -158,7 +164,9 @@ BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,8UL> >, sse
 */
 BLAZE_ALWAYS_INLINE sse_float_t loadu( const float* address )
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE
+   return _mm512_loadu_ps( address );
+#elif BLAZE_MIC_MODE
    __m512 v1 = _mm512_setzero_ps();
    v1 = _mm512_loadunpacklo_ps( v1, address );
    v1 = _mm512_loadunpackhi_ps( v1, address+16UL );
@@ -186,7 +194,9 @@ BLAZE_ALWAYS_INLINE sse_float_t loadu( const float* address )
 */
 BLAZE_ALWAYS_INLINE sse_double_t loadu( const double* address )
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE
+   return _mm512_loadu_pd( address );
+#elif BLAZE_MIC_MODE
    __m512d v1 = _mm512_setzero_pd();
    v1 = _mm512_loadunpacklo_pd( v1, address );
    v1 = _mm512_loadunpackhi_pd( v1, address+8UL );
@@ -216,7 +226,9 @@ BLAZE_ALWAYS_INLINE sse_cfloat_t loadu( const complex<float>* address )
 {
    BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE
+   return _mm512_loadu_ps( reinterpret_cast<const float*>( address ) );
+#elif BLAZE_MIC_MODE
    __m512 v1 = _mm512_setzero_ps();
    v1 = _mm512_loadunpacklo_ps( v1, reinterpret_cast<const float*>( address     ) );
    v1 = _mm512_loadunpackhi_ps( v1, reinterpret_cast<const float*>( address+8UL ) );
@@ -246,7 +258,9 @@ BLAZE_ALWAYS_INLINE sse_cdouble_t loadu( const complex<double>* address )
 {
    BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE
+   return _mm512_loadu_pd( reinterpret_cast<const double*>( address ) );
+#elif BLAZE_MIC_MODE
    __m512d v1 = _mm512_setzero_pd();
    v1 = _mm512_loadunpacklo_pd( v1, reinterpret_cast<const double*>( address     ) );
    v1 = _mm512_loadunpackhi_pd( v1, reinterpret_cast<const double*>( address+4UL ) );
@@ -0,0 +1,175 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Log.h
+//  \brief Header file for the intrinsic logarithm functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_LOG_H_
+#define _BLAZE_MATH_INTRINSICS_LOG_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <limits>
+#include <blaze/math/intrinsics/Addition.h>
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/math/intrinsics/Division.h>
+#include <blaze/math/intrinsics/FloatingPoint.h>
+#include <blaze/math/intrinsics/FMA.h>
+#include <blaze/math/intrinsics/Multiplication.h>
+#include <blaze/math/intrinsics/Set.h>
+#include <blaze/math/intrinsics/Subtraction.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC LOGARITHM FUNCTIONS
+//
+//=================================================================================================
+
+#if BLAZE_SSE2_MODE && !BLAZE_AVX512_MODE && !BLAZE_MIC_MODE
+
+//*************************************************************************************************
+/*!\fn sse_float_t log( sse_float_t )
+// \brief Natural logarithm for a vector of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of single precision floating point values.
+// \return The resulting natural logarithms.
+//
+// The argument is decomposed into \f$ a = m \cdot 2^e \f$ with \f$ m \in [\sqrt{0.5}..\sqrt{2})
+// \f$. \f$ \ln(m) \f$ is approximated by \f$ x - x^2/2 + x^3 P(x) \f$ with a polynomial \f$ P
+// \f$ of degree 8 in \f$ x = m-1 \f$ and \f$ e \ln 2 \f$ is added in two parts. The maximum
+// error is 1 ULP for all positive arguments. Negative arguments result in NaN, zero results in
+// negative infinity.
+*/
+BLAZE_ALWAYS_INLINE sse_float_t log( const sse_float_t& a )
+{
+   const sse_float_t zero( set( 0.0F ) );
+   const sse_float_t one ( set( 1.0F ) );
+   const sse_float_t inf ( set( std::numeric_limits<float>::infinity() ) );
+   const sse_float_t ninf( set( -std::numeric_limits<float>::infinity() ) );
+   const sse_float_t nan ( set( std::numeric_limits<float>::quiet_NaN() ) );
+
+   // Scaling of subnormal arguments
+   const sse_float_t tiny( cmplt( a, set( std::numeric_limits<float>::min() ) ) );
+   const sse_float_t x( select( tiny, a * set( 33554432.0F ), a ) );
+
+   const sse_float_t small( cmplt( mantissa( x ), set( 0.707106781186547524F ) ) );
+   const sse_float_t e( exponent( x ) - select( tiny, set( 25.0F ), zero ) - select( small, one, zero ) );
+   const sse_float_t m( mantissa( x ) + select( small, mantissa( x ), zero ) - one );
+   const sse_float_t z( m * m );
+
+   sse_float_t p( set( 7.0376836292E-2F ) );
+   p = fmadd( p, m, set( -1.1514610310E-1F ) );
+   p = fmadd( p, m, set(  1.1676998740E-1F ) );
+   p = fmadd( p, m, set( -1.2420140846E-1F ) );
+   p = fmadd( p, m, set(  1.4249322787E-1F ) );
+   p = fmadd( p, m, set( -1.6668057665E-1F ) );
+   p = fmadd( p, m, set(  2.0000714765E-1F ) );
+   p = fmadd( p, m, set( -2.4999993993E-1F ) );
+   p = fmadd( p, m, set(  3.3333331174E-1F ) );
+
+   sse_float_t y( p * m * z );
+   y = fmadd( e, set( -2.12194440E-4F ), y );
+   y = fnmadd( set( 0.5F ), z, y );
+   y = fmadd( e, set( 0.693359375F ), m + y );
+
+   return select( cmpnge( a, zero ), nan,
+                  select( cmpeq( a, zero ), ninf, select( cmpeq( a, inf ), inf, y ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t log( sse_double_t )
+// \brief Natural logarithm for a vector of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of double precision floating point values.
+// \return The resulting natural logarithms.
+//
+// The argument is decomposed into \f$ a = m \cdot 2^e \f$ with \f$ m \in [\sqrt{0.5}..\sqrt{2})
+// \f$. \f$ \ln(m) \f$ is approximated by the rational function \f$ x - x^2/2 + x^3 P(x)/Q(x) \f$
+// in \f$ x = m-1 \f$ and \f$ e \ln 2 \f$ is added in two parts. The maximum error is 1 ULP for
+// all positive arguments. Negative arguments result in NaN, zero results in negative infinity.
+*/
+BLAZE_ALWAYS_INLINE sse_double_t log( const sse_double_t& a )
+{
+   const sse_double_t zero( set( 0.0 ) );
+   const sse_double_t one ( set( 1.0 ) );
+   const sse_double_t inf ( set( std::numeric_limits<double>::infinity() ) );
+   const sse_double_t ninf( set( -std::numeric_limits<double>::infinity() ) );
+   const sse_double_t nan ( set( std::numeric_limits<double>::quiet_NaN() ) );
+
+   // Scaling of subnormal arguments
+   const sse_double_t tiny( cmplt( a, set( std::numeric_limits<double>::min() ) ) );
+   const sse_double_t x( select( tiny, a * set( 18014398509481984.0 ), a ) );
+
+   const sse_double_t small( cmplt( mantissa( x ), set( 0.70710678118654752440 ) ) );
+   const sse_double_t e( exponent( x ) - select( tiny, set( 54.0 ), zero ) - select( small, one, zero ) );
+   const sse_double_t m( mantissa( x ) + select( small, mantissa( x ), zero ) - one );
+   const sse_double_t z( m * m );
+
+   sse_double_t p( set( 1.01875663804580931796E-4 ) );
+   p = fmadd( p, m, set( 4.97494994976747001425E-1 ) );
+   p = fmadd( p, m, set( 4.70579119878881725854E0 ) );
+   p = fmadd( p, m, set( 1.44989225341610930846E1 ) );
+   p = fmadd( p, m, set( 1.79368678507819816313E1 ) );
+   p = fmadd( p, m, set( 7.70838733755885391666E0 ) );
+
+   sse_double_t q( m + set( 1.12873587189167450590E1 ) );
+   q = fmadd( q, m, set( 4.52279145837532221105E1 ) );
+   q = fmadd( q, m, set( 8.29875266912776603211E1 ) );
+   q = fmadd( q, m, set( 7.11544750618563894466E1 ) );
+   q = fmadd( q, m, set( 2.31251620126765340583E1 ) );
+
+   sse_double_t y( m * ( z * p / q ) );
+   y = fmadd( e, set( -2.121944400546905827679E-4 ), y );
+   y = fnmadd( set( 0.5 ), z, y );
+   y = fmadd( e, set( 0.693359375 ), m + y );
+
+   return select( cmpnge( a, zero ), nan,
+                  select( cmpeq( a, zero ), ninf, select( cmpeq( a, inf ), inf, y ) ) );
+}
+//*************************************************************************************************
+
+#endif
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,316 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Maskload.h
+//  \brief Header file for the intrinsic masked load functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_MASKLOAD_H_
+#define _BLAZE_MATH_INTRINSICS_MASKLOAD_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/math/intrinsics/Load.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/HasSize.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC MASKLOAD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the masked load of a partial vector.
+// \ingroup intrinsics
+//
+// \param address The first value to be loaded.
+// \param n The number of values to be loaded.
+// \return The loaded vector, padded with zeros.
+//
+// This function is selected for all instruction sets without masked load operations. It copies
+// the \a n given values into a zero-initialized, properly aligned buffer and loads the buffer.
+*/
+template< typename IT    // Type of the intrinsic vector
+        , typename T >  // Type of the values
+BLAZE_ALWAYS_INLINE IT maskloadBackend( const T* address, size_t n )
+{
+   AlignedArray<T,sizeof(IT)/sizeof(T)> array;
+   for( size_t i=0UL; i<n; ++i )
+      array[i] = address[i];
+   for( size_t i=n; i<sizeof(IT)/sizeof(T); ++i )
+      array[i] = T();
+   return load( array.data() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked load of a partial vector of 2-byte integral values.
+// \ingroup intrinsics
+//
+// \param address The first integral value to be loaded.
+// \param n The number of values to be loaded \f$[0..N-1]\f$.
+// \return The loaded vector, padded with zeros.
+//
+// This function loads the first \a n 2-byte integral values into a vector and sets the remaining
+// elements of the vector to zero. The memory beyond the \a n-th value is not accessed. The given
+// address is not required to be properly aligned.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,2UL> >, sse_int16_t >::Type
+   maskload( const T* address, size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( n < sizeof(sse_int16_t)/sizeof(T), "Invalid number of values" );
+
+#if BLAZE_AVX512_MODE
+   const __mmask32 mask( static_cast<__mmask32>( ( 1U << n ) - 1U ) );
+   return _mm512_maskz_loadu_epi16( mask, address );
+#else
+   return maskloadBackend<sse_int16_t>( address, n );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked load of a partial vector of 4-byte integral values.
+// \ingroup intrinsics
+//
+// \param address The first integral value to be loaded.
+// \param n The number of values to be loaded \f$[0..N-1]\f$.
+// \return The loaded vector, padded with zeros.
+//
+// This function loads the first \a n 4-byte integral values into a vector and sets the remaining
+// elements of the vector to zero. The memory beyond the \a n-th value is not accessed. The given
+// address is not required to be properly aligned.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,4UL> >, sse_int32_t >::Type
+   maskload( const T* address, size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( n < sizeof(sse_int32_t)/sizeof(T), "Invalid number of values" );
+
+#if BLAZE_AVX512_MODE
+   const __mmask16 mask( static_cast<__mmask16>( ( 1U << n ) - 1U ) );
+   return _mm512_maskz_loadu_epi32( mask, address );
+#elif BLAZE_AVX2_MODE
+   const __m256i mask( _mm256_cmpgt_epi32( _mm256_set1_epi32( static_cast<int>( n ) )
+                                       , _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 ) ) );
+   return _mm256_maskload_epi32( reinterpret_cast<const int*>( address ), mask );
+#else
+   return maskloadBackend<sse_int32_t>( address, n );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked load of a partial vector of 8-byte integral values.
+// \ingroup intrinsics
+//
+// \param address The first integral value to be loaded.
+// \param n The number of values to be loaded \f$[0..N-1]\f$.
+// \return The loaded vector, padded with zeros.
+//
+// This function loads the first \a n 8-byte integral values into a vector and sets the remaining
+// elements of the vector to zero. The memory beyond the \a n-th value is not accessed. The given
+// address is not required to be properly aligned.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,8UL> >, sse_int64_t >::Type
+   maskload( const T* address, size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( n < sizeof(sse_int64_t)/sizeof(T), "Invalid number of values" );
+
+#if BLAZE_AVX512_MODE
+   const __mmask8 mask( static_cast<__mmask8>( ( 1U << n ) - 1U ) );
+   return _mm512_maskz_loadu_epi64( mask, address );
+#elif BLAZE_AVX2_MODE
+   const __m256i mask( _mm256_cmpgt_epi64( _mm256_set1_epi64x( static_cast<long long>( n ) )
+                                       , _mm256_setr_epi64x( 0LL, 1LL, 2LL, 3LL ) ) );
+   return _mm256_maskload_epi64( reinterpret_cast<const long long*>( address ), mask );
+#else
+   return maskloadBackend<sse_int64_t>( address, n );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked load of a partial vector of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param address The first float value to be loaded.
+// \param n The number of values to be loaded \f$[0..N-1]\f$.
+// \return The loaded vector, padded with zeros.
+//
+// This function loads the first \a n single precision floating point values into a vector and sets
+// the remaining elements of the vector to zero. The memory beyond the \a n-th value is not
+// accessed. The given address is not required to be properly aligned.
+*/
+BLAZE_ALWAYS_INLINE sse_float_t maskload( const float* address, size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( n < sizeof(sse_float_t)/sizeof(float), "Invalid number of values" );
+
+#if BLAZE_AVX512_MODE
+   const __mmask16 mask( static_cast<__mmask16>( ( 1U << n ) - 1U ) );
+   return _mm512_maskz_loadu_ps( mask, address );
+#elif BLAZE_AVX_MODE
+   const __m256i mask( _mm256_castps_si256(
+      _mm256_cmp_ps( _mm256_setr_ps( 0.0F, 1.0F, 2.0F, 3.0F, 4.0F, 5.0F, 6.0F, 7.0F )
+                   , _mm256_set1_ps( static_cast<float>( n ) ), _CMP_LT_OQ ) ) );
+   return _mm256_maskload_ps( address, mask );
+#else
+   return maskloadBackend<sse_float_t>( address, n );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked load of a partial vector of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param address The first double value to be loaded.
+// \param n The number of values to be loaded \f$[0..N-1]\f$.
+// \return The loaded vector, padded with zeros.
+//
+// This function loads the first \a n double precision floating point values into a vector and sets
+// the remaining elements of the vector to zero. The memory beyond the \a n-th value is not
+// accessed. The given address is not required to be properly aligned.
+*/
+BLAZE_ALWAYS_INLINE sse_double_t maskload( const double* address, size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( n < sizeof(sse_double_t)/sizeof(double), "Invalid number of values" );
+
+#if BLAZE_AVX512_MODE
+   const __mmask8 mask( static_cast<__mmask8>( ( 1U << n ) - 1U ) );
+   return _mm512_maskz_loadu_pd( mask, address );
+#elif BLAZE_AVX_MODE
+   const __m256i mask( _mm256_castpd_si256(
+      _mm256_cmp_pd( _mm256_setr_pd( 0.0, 1.0, 2.0, 3.0 )
+                   , _mm256_set1_pd( static_cast<double>( n ) ), _CMP_LT_OQ ) ) );
+   return _mm256_maskload_pd( address, mask );
+#else
+   return maskloadBackend<sse_double_t>( address, n );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked load of a partial vector of 'complex<float>' values.
+// \ingroup intrinsics
+//
+// \param address The first 'complex<float>' value to be loaded.
+// \param n The number of values to be loaded \f$[0..N-1]\f$.
+// \return The loaded vector, padded with zeros.
+//
+// This function loads the first \a n 'complex<float>' values into a vector and sets the remaining
+// elements of the vector to zero. The memory beyond the \a n-th value is not accessed. The given
+// address is not required to be properly aligned.
+*/
+BLAZE_ALWAYS_INLINE sse_cfloat_t maskload( const complex<float>* address, size_t n )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
+
+   BLAZE_INTERNAL_ASSERT( n < sizeof(sse_cfloat_t)/sizeof(complex<float>)
+                        , "Invalid number of values" );
+
+#if BLAZE_AVX512_MODE
+   const __mmask16 mask( static_cast<__mmask16>( ( 1U << 2UL*n ) - 1U ) );
+   return _mm512_maskz_loadu_ps( mask, reinterpret_cast<const float*>( address ) );
+#elif BLAZE_AVX_MODE
+   const __m256i mask( _mm256_castps_si256(
+      _mm256_cmp_ps( _mm256_setr_ps( 0.0F, 1.0F, 2.0F, 3.0F, 4.0F, 5.0F, 6.0F, 7.0F )
+                   , _mm256_set1_ps( static_cast<float>( 2UL*n ) ), _CMP_LT_OQ ) ) );
+   return _mm256_maskload_ps( reinterpret_cast<const float*>( address ), mask );
+#else
+   return maskloadBackend<sse_cfloat_t>( address, n );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked load of a partial vector of 'complex<double>' values.
+// \ingroup intrinsics
+//
+// \param address The first 'complex<double>' value to be loaded.
+// \param n The number of values to be loaded \f$[0..N-1]\f$.
+// \return The loaded vector, padded with zeros.
+//
+// This function loads the first \a n 'complex<double>' values into a vector and sets the remaining
+// elements of the vector to zero. The memory beyond the \a n-th value is not accessed. The given
+// address is not required to be properly aligned.
+*/
+BLAZE_ALWAYS_INLINE sse_cdouble_t maskload( const complex<double>* address, size_t n )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
+
+   BLAZE_INTERNAL_ASSERT( n < sizeof(sse_cdouble_t)/sizeof(complex<double>)
+                        , "Invalid number of values" );
+
+#if BLAZE_AVX512_MODE
+   const __mmask8 mask( static_cast<__mmask8>( ( 1U << 2UL*n ) - 1U ) );
+   return _mm512_maskz_loadu_pd( mask, reinterpret_cast<const double*>( address ) );
+#elif BLAZE_AVX_MODE
+   const __m256i mask( _mm256_castpd_si256(
+      _mm256_cmp_pd( _mm256_setr_pd( 0.0, 1.0, 2.0, 3.0 )
+                   , _mm256_set1_pd( static_cast<double>( 2UL*n ) ), _CMP_LT_OQ ) ) );
+   return _mm256_maskload_pd( reinterpret_cast<const double*>( address ), mask );
+#else
+   return maskloadBackend<sse_cdouble_t>( address, n );
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
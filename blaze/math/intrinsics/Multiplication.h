@@ -62,7 +62,12 @@ namespace blaze {
 // \param b The right-hand side operand.
 // \return The result of the multiplication.
 */
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512_MODE
+BLAZE_ALWAYS_INLINE sse_int16_t operator*( const sse_int16_t& a, const sse_int16_t& b )
+{
+   return _mm512_mullo_epi16( a.value, b.value );
+}
+#elif BLAZE_AVX2_MODE
 BLAZE_ALWAYS_INLINE sse_int16_t operator*( const sse_int16_t& a, const sse_int16_t& b )
 {
    return _mm256_mullo_epi16( a.value, b.value );
@@ -85,7 +90,7 @@ BLAZE_ALWAYS_INLINE sse_int16_t operator*( const sse_int16_t& a, const sse_int16
 // \param b The right-hand side operand.
 // \return The result of the multiplication.
 */
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE || BLAZE_MIC_MODE
 BLAZE_ALWAYS_INLINE sse_int32_t operator*( const sse_int32_t& a, const sse_int32_t& b )
 {
    return _mm512_mullo_epi32( a.value, b.value );
@@ -104,6 +109,24 @@ BLAZE_ALWAYS_INLINE sse_int32_t operator*( const sse_int32_t& a, const sse_int32
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!n sse_int64_t operator*( sse_int64_t, sse_int64_t )
+// \brief Multiplication of two vectors of 64-bit integral values.
+// \ingroup intrinsics
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The result of the multiplication.
+*/
+#if BLAZE_AVX512_MODE
+BLAZE_ALWAYS_INLINE sse_int64_t operator*( const sse_int64_t& a, const sse_int64_t& b )
+{
+   return _mm512_mullo_epi64( a.value, b.value );
+}
+#endif
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\fn sse_float_t operator*( sse_float_t, sse_float_t )
 // \brief Multiplication of two vectors of single precision floating point values.
@@ -113,7 +136,7 @@ BLAZE_ALWAYS_INLINE sse_int32_t operator*( const sse_int32_t& a, const sse_int32
 // \param b The right-hand side operand.
 // \return The result of the multiplication.
 */
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE || BLAZE_MIC_MODE
 BLAZE_ALWAYS_INLINE sse_float_t operator*( const sse_float_t& a, const sse_float_t& b )
 {
    return _mm512_mul_ps( a.value, b.value );
@@ -141,7 +164,7 @@ BLAZE_ALWAYS_INLINE sse_float_t operator*( const sse_float_t& a, const sse_float
 // \param b The right-hand side operand.
 // \return The result of the multiplication.
 */
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE || BLAZE_MIC_MODE
 BLAZE_ALWAYS_INLINE sse_double_t operator*( const sse_double_t& a, const sse_double_t& b )
 {
    return _mm512_mul_pd( a.value, b.value );
@@ -169,7 +192,18 @@ BLAZE_ALWAYS_INLINE sse_double_t operator*( const sse_double_t& a, const sse_dou
 // \param b The right-hand side operand.
 // \return The result of the multiplication.
 */
-#if BLAZE_AVX_MODE
+#if BLAZE_AVX512_MODE
+BLAZE_ALWAYS_INLINE sse_cfloat_t operator*( const sse_cfloat_t& a, const sse_cfloat_t& b )
+{
+   __m512 x, y;
+
+   x = _mm512_shuffle_ps( a.value, a.value, 0xF5 );
+   y = _mm512_shuffle_ps( b.value, b.value, 0xB1 );
+   y = _mm512_mul_ps( x, y );
+   x = _mm512_shuffle_ps( a.value, a.value, 0xA0 );
+   return _mm512_fmaddsub_ps( x, b.value, y );
+}
+#elif BLAZE_AVX_MODE
 BLAZE_ALWAYS_INLINE sse_cfloat_t operator*( const sse_cfloat_t& a, const sse_cfloat_t& b )
 {
    __m256 x, y, z;
@@ -206,7 +240,18 @@ BLAZE_ALWAYS_INLINE sse_cfloat_t operator*( const sse_cfloat_t& a, const sse_cfl
 // \param b The right-hand side operand.
 // \return The result of the multiplication.
 */
-#if BLAZE_AVX_MODE
+#if BLAZE_AVX512_MODE
+BLAZE_ALWAYS_INLINE sse_cdouble_t operator*( const sse_cdouble_t& a, const sse_cdouble_t& b )
+{
+   __m512d x, y;
+
+   x = _mm512_shuffle_pd( a.value, a.value, 0xFF );
+   y = _mm512_shuffle_pd( b.value, b.value, 0x55 );
+   y = _mm512_mul_pd( x, y );
+   x = _mm512_shuffle_pd( a.value, a.value, 0x00 );
+   return _mm512_fmaddsub_pd( x, b.value, y );
+}
+#elif BLAZE_AVX_MODE
 BLAZE_ALWAYS_INLINE sse_cdouble_t operator*( const sse_cdouble_t& a, const sse_cdouble_t& b )
 {
    __m256d x, y, z;
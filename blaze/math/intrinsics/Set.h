@@ -72,7 +72,9 @@ template< typename T >  // Type of the integral value
 BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,2UL> >, sse_int16_t >::Type
    set( T value )
 {
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512_MODE
+   return _mm512_set1_epi16( value );
+#elif BLAZE_AVX2_MODE
    return _mm256_set1_epi16( value );
 #elif BLAZE_SSE2_MODE
    return _mm_set1_epi16( value );
@@ -94,7 +96,7 @@ template< typename T >  // Type of the integral value
 BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,4UL> >, sse_int32_t >::Type
    set( T value )
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE || BLAZE_MIC_MODE
    return _mm512_set1_epi32( value );
 #elif BLAZE_AVX2_MODE
    return _mm256_set1_epi32( value );
@@ -118,7 +120,7 @@ template< typename T >  // Type of the integral value
 BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,8UL> >, sse_int64_t >::Type
    set( T value )
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE || BLAZE_MIC_MODE
    return _mm512_set1_epi64( value );
 #elif BLAZE_AVX2_MODE
    return _mm256_set1_epi64x( value );
@@ -140,7 +142,7 @@ BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,8UL> >, sse
 */
 BLAZE_ALWAYS_INLINE sse_float_t set( float value )
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE || BLAZE_MIC_MODE
    return _mm512_set1_ps( value );
 #elif BLAZE_AVX_MODE
    return _mm256_set1_ps( value );
@@ -162,7 +164,7 @@ BLAZE_ALWAYS_INLINE sse_float_t set( float value )
 */
 BLAZE_ALWAYS_INLINE sse_double_t set( double value )
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE || BLAZE_MIC_MODE
    return _mm512_set1_pd( value );
 #elif BLAZE_AVX_MODE
    return _mm256_set1_pd( value );
@@ -184,7 +186,7 @@ BLAZE_ALWAYS_INLINE sse_double_t set( double value )
 */
 BLAZE_ALWAYS_INLINE sse_cfloat_t set( const complex<float>& value )
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE || BLAZE_MIC_MODE
    return _mm512_set_ps( value.imag(), value.real(), value.imag(), value.real(),
                          value.imag(), value.real(), value.imag(), value.real(),
                          value.imag(), value.real(), value.imag(), value.real(),
@@ -211,7 +213,7 @@ BLAZE_ALWAYS_INLINE sse_cfloat_t set( const complex<float>& value )
 */
 BLAZE_ALWAYS_INLINE sse_cdouble_t set( const complex<double>& value )
 {
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE || BLAZE_MIC_MODE
    return _mm512_set_pd( value.imag(), value.real(), value.imag(), value.real(),
                          value.imag(), value.real(), value.imag(), value.real() );
 #elif BLAZE_AVX_MODE
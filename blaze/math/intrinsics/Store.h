@@ -81,7 +81,9 @@ BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,2UL> > >::T
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512_MODE
+   _mm512_store_si512( reinterpret_cast<__m512i*>( address ), value.value );
+#elif BLAZE_AVX2_MODE
    _mm256_store_si256( reinterpret_cast<__m256i*>( address ), value.value );
 #elif BLAZE_SSE2_MODE
    _mm_store_si128( reinterpret_cast<__m128i*>( address ), value.value );
@@ -110,7 +112,7 @@ BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,4UL> > >::T
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE || BLAZE_MIC_MODE
    _mm512_store_epi32( address, value.value );
 #elif BLAZE_AVX2_MODE
    _mm256_store_si256( reinterpret_cast<__m256i*>( address ), value.value );
@@ -141,7 +143,7 @@ BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,8UL> > >::T
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE || BLAZE_MIC_MODE
    _mm512_store_epi64( address, value.value );
 #elif BLAZE_AVX2_MODE
    _mm256_store_si256( reinterpret_cast<__m256i*>( address ), value.value );
@@ -170,7 +172,7 @@ BLAZE_ALWAYS_INLINE void store( float* address, const sse_float_t& value )
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE || BLAZE_MIC_MODE
    _mm512_store_ps( address, value.value );
 #elif BLAZE_AVX_MODE
    _mm256_store_ps( address, value.value );
@@ -199,7 +201,7 @@ BLAZE_ALWAYS_INLINE void store( double* address, const sse_double_t& value )
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE || BLAZE_MIC_MODE
    _mm512_store_pd( address, value.value );
 #elif BLAZE_AVX_MODE
    _mm256_store_pd( address, value.value );
@@ -229,7 +231,7 @@ BLAZE_ALWAYS_INLINE void store( complex<float>* address, const sse_cfloat_t& val
    BLAZE_STATIC_ASSERT  ( sizeof( complex<float> ) == 2UL*sizeof( float ) );
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE || BLAZE_MIC_MODE
    _mm512_store_ps( reinterpret_cast<float*>( address ), value.value );
 #elif BLAZE_AVX_MODE
    _mm256_store_ps( reinterpret_cast<float*>( address ), value.value );
@@ -259,7 +261,7 @@ BLAZE_ALWAYS_INLINE void store( complex<double>* address, const sse_cdouble_t& v
    BLAZE_STATIC_ASSERT  ( sizeof( complex<double> ) == 2UL*sizeof( double ) );
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE || BLAZE_MIC_MODE
    _mm512_store_pd( reinterpret_cast<double*>( address ), value.value );
 #elif BLAZE_AVX_MODE
    _mm256_store_pd( reinterpret_cast<double*>( address ), value.value );
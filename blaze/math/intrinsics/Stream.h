@@ -77,7 +77,9 @@ BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,2UL> > >::T
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_AVX2_MODE
+#if BLAZE_AVX512_MODE
+   _mm512_stream_si512( reinterpret_cast<__m512i*>( address ), value.value );
+#elif BLAZE_AVX2_MODE
    _mm256_stream_si256( reinterpret_cast<__m256i*>( address ), value.value );
 #elif BLAZE_SSE2_MODE
    _mm_stream_si128( reinterpret_cast<__m128i*>( address ), value.value );
@@ -102,7 +104,9 @@ BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,4UL> > >::T
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE
+   _mm512_stream_si512( reinterpret_cast<__m512i*>( address ), value.value );
+#elif BLAZE_MIC_MODE
    _mm512_store_epi32( address, value.value );
 #elif BLAZE_AVX2_MODE
    _mm256_stream_si256( reinterpret_cast<__m256i*>( address ), value.value );
@@ -129,7 +133,9 @@ BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,8UL> > >::T
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE
+   _mm512_stream_si512( reinterpret_cast<__m512i*>( address ), value.value );
+#elif BLAZE_MIC_MODE
    _mm512_store_epi64( address, value.value );
 #elif BLAZE_AVX2_MODE
    _mm256_stream_si256( reinterpret_cast<__m256i*>( address ), value.value );
@@ -154,7 +160,9 @@ BLAZE_ALWAYS_INLINE void stream( float* address, const sse_float_t& value )
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE
+   _mm512_stream_ps( address, value.value );
+#elif BLAZE_MIC_MODE
    _mm512_storenr_ps( address, value.value );
 #elif BLAZE_AVX_MODE
    _mm256_stream_ps( address, value.value );
@@ -179,7 +187,9 @@ BLAZE_ALWAYS_INLINE void stream( double* address, const sse_double_t& value )
 {
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE
+   _mm512_stream_pd( address, value.value );
+#elif BLAZE_MIC_MODE
    _mm512_storenr_pd( address, value.value );
 #elif BLAZE_AVX_MODE
    _mm256_stream_pd( address, value.value );
@@ -205,7 +215,9 @@ BLAZE_ALWAYS_INLINE void stream( complex<float>* address, const sse_cfloat_t& va
    BLAZE_STATIC_ASSERT  ( sizeof( complex<float> ) == 2UL*sizeof( float ) );
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE
+   _mm512_stream_ps( reinterpret_cast<float*>( address ), value.value );
+#elif BLAZE_MIC_MODE
    _mm512_storenr_ps( reinterpret_cast<float*>( address ), value.value );
 #elif BLAZE_AVX_MODE
    _mm256_stream_ps( reinterpret_cast<float*>( address ), value.value );
@@ -231,7 +243,9 @@ BLAZE_ALWAYS_INLINE void stream( complex<double>* address, const sse_cdouble_t&
    BLAZE_STATIC_ASSERT  ( sizeof( complex<double> ) == 2UL*sizeof( double ) );
    BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
 
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE
+   _mm512_stream_pd( reinterpret_cast<double*>( address ), value.value );
+#elif BLAZE_MIC_MODE
    _mm512_storenr_pd( reinterpret_cast<double*>( address ), value.value );
 #elif BLAZE_AVX_MODE
    _mm256_stream_pd( reinterpret_cast<double*>( address ), value.value );
@@ -0,0 +1,414 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Trigonometric.h
+//  \brief Header file for the intrinsic trigonometric functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_INTRINSICS_TRIGONOMETRIC_H_
+#define _BLAZE_MATH_INTRINSICS_TRIGONOMETRIC_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/intrinsics/Abs.h>
+#include <blaze/math/intrinsics/Addition.h>
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/math/intrinsics/FloatingPoint.h>
+#include <blaze/math/intrinsics/FMA.h>
+#include <blaze/math/intrinsics/Load.h>
+#include <blaze/math/intrinsics/Multiplication.h>
+#include <blaze/math/intrinsics/Set.h>
+#include <blaze/math/intrinsics/Store.h>
+#include <blaze/math/intrinsics/Subtraction.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC TRIGONOMETRIC FUNCTIONS
+//
+//=================================================================================================
+
+// The sine and cosine functions reduce the absolute value of the argument to the interval
+// \f$ [-\pi/4..\pi/4] \f$ by subtracting an even multiple \f$ y \f$ of \f$ \pi/4 \f$, which
+// is represented in three parts (Cody-Waite reduction). The octant \f$ y \bmod 8 \f$ selects
+// between the sine and cosine polynomials and determines the sign of the result. Since the
+// leading parts of \f$ \pi/4 \f$ have only few significant bits, their products with \f$ y \f$
+// are exact for arguments up to \f$ 2^{13} \f$ (single precision) and \f$ 2^{26} \f$ (double
+// precision) in magnitude, independent of whether the multiply-add operations are fused or not.
+// Within this range the stated accuracies hold. Vectors containing at least one argument beyond
+// this range (including infinite arguments) are evaluated by means of the scalar std::sin()
+// and std::cos() functions.
+
+#if BLAZE_SSE2_MODE && !BLAZE_AVX512_MODE && !BLAZE_MIC_MODE
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scalar evaluation of a trigonometric function for a vector of floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of floating point values.
+// \param f The scalar trigonometric function.
+// \return The resulting values.
+//
+// This function is the fallback of the vectorized sine and cosine functions for arguments
+// beyond the range of the Cody-Waite reduction.
+*/
+template< typename T     // Type of the floating point values
+        , typename IT >  // Type of the intrinsic vector
+inline IT trigonometricFallback( const IT& a, T (*f)( T ) )
+{
+   enum { size = sizeof( IT ) / sizeof( T ) };
+
+   AlignedArray<T,size> array;
+   store( array.data(), a );
+   for( size_t i=0UL; i<size; ++i )
+      array[i] = f( array[i] );
+   return load( array.data() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Test whether a vector of single precision values exceeds the range of the reduction.
+// \ingroup intrinsics
+//
+// \param x The vector of non-negative single precision floating point values.
+// \return \a true in case any value is larger than \f$ 2^{13} \f$, \a false if not.
+*/
+BLAZE_ALWAYS_INLINE bool exceedsTrigonometricRange( const sse_float_t& x )
+{
+   return any( cmplt( set( 8192.0F ), x ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Test whether a vector of double precision values exceeds the range of the reduction.
+// \ingroup intrinsics
+//
+// \param x The vector of non-negative double precision floating point values.
+// \return \a true in case any value is larger than \f$ 2^{26} \f$, \a false if not.
+*/
+BLAZE_ALWAYS_INLINE bool exceedsTrigonometricRange( const sse_double_t& x )
+{
+   return any( cmplt( set( 67108864.0 ), x ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reduction of a vector of single precision values for the trigonometric functions.
+// \ingroup intrinsics
+//
+// \param a The vector of non-negative single precision floating point values (\f$ a \leq 2^{13} \f$).
+// \param y The resulting even multiples of \f$ \pi/4 \f$.
+// \return The reduced arguments in the range \f$ [-\pi/4..\pi/4] \f$.
+*/
+BLAZE_ALWAYS_INLINE sse_float_t reduceTrigonometric( const sse_float_t& a, sse_float_t& y )
+{
+   y = floor( fmadd( a, set( 0.636619772367581343F ), set( 0.5F ) ) ) * set( 2.0F );
+   const sse_float_t z( fnmadd( y, set( 3.77489497744594108E-8F ),
+                         fnmadd( y, set( 2.4187564849853515625E-4F ), fnmadd( y, set( 0.78515625F ), a ) ) ) );
+
+   return z;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reduction of a vector of double precision values for the trigonometric functions.
+// \ingroup intrinsics
+//
+// \param a The vector of non-negative double precision floating point values (\f$ a \leq 2^{26} \f$).
+// \param y The resulting even multiples of \f$ \pi/4 \f$.
+// \return The reduced arguments in the range \f$ [-\pi/4..\pi/4] \f$.
+*/
+BLAZE_ALWAYS_INLINE sse_double_t reduceTrigonometric( const sse_double_t& a, sse_double_t& y )
+{
+   y = floor( fmadd( a, set( 0.63661977236758134308 ), set( 0.5 ) ) ) * set( 2.0 );
+   const sse_double_t z( fnmadd( y, set( 2.69515142907905952645E-15 ),
+                          fnmadd( y, set( 3.77489470793079817668E-8 ), fnmadd( y, set( 7.85398125648498535156E-1 ), a ) ) ) );
+
+   return z;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sine polynomial for a vector of reduced single precision values.
+// \ingroup intrinsics
+//
+// \param z The vector of reduced arguments in the range \f$ [-\pi/4..\pi/4] \f$.
+// \return The resulting sine values.
+*/
+BLAZE_ALWAYS_INLINE sse_float_t sinPolynomial( const sse_float_t& z )
+{
+   const sse_float_t zz( z * z );
+
+   sse_float_t p( set( -1.9515295891E-4F ) );
+   p = fmadd( p, zz, set(  8.3321608736E-3F ) );
+   p = fmadd( p, zz, set( -1.6666654611E-1F ) );
+
+   return fmadd( p * zz, z, z );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sine polynomial for a vector of reduced double precision values.
+// \ingroup intrinsics
+//
+// \param z The vector of reduced arguments in the range \f$ [-\pi/4..\pi/4] \f$.
+// \return The resulting sine values.
+*/
+BLAZE_ALWAYS_INLINE sse_double_t sinPolynomial( const sse_double_t& z )
+{
+   const sse_double_t zz( z * z );
+
+   sse_double_t p( set( 1.58962301576546568060E-10 ) );
+   p = fmadd( p, zz, set( -2.50507477628578072866E-8 ) );
+   p = fmadd( p, zz, set(  2.75573136213857245213E-6 ) );
+   p = fmadd( p, zz, set( -1.98412698295895385996E-4 ) );
+   p = fmadd( p, zz, set(  8.33333333332211858878E-3 ) );
+   p = fmadd( p, zz, set( -1.66666666666666307295E-1 ) );
+
+   return fmadd( p * zz, z, z );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cosine polynomial for a vector of reduced single precision values.
+// \ingroup intrinsics
+//
+// \param z The vector of reduced arguments in the range \f$ [-\pi/4..\pi/4] \f$.
+// \return The resulting cosine values.
+*/
+BLAZE_ALWAYS_INLINE sse_float_t cosPolynomial( const sse_float_t& z )
+{
+   const sse_float_t zz( z * z );
+
+   sse_float_t p( set( 2.443315711809948E-5F ) );
+   p = fmadd( p, zz, set( -1.388731625493765E-3F ) );
+   p = fmadd( p, zz, set(  4.166664568298827E-2F ) );
+
+   return fmadd( p * zz, zz, fnmadd( set( 0.5F ), zz, set( 1.0F ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cosine polynomial for a vector of reduced double precision values.
+// \ingroup intrinsics
+//
+// \param z The vector of reduced arguments in the range \f$ [-\pi/4..\pi/4] \f$.
+// \return The resulting cosine values.
+*/
+BLAZE_ALWAYS_INLINE sse_double_t cosPolynomial( const sse_double_t& z )
+{
+   const sse_double_t zz( z * z );
+
+   sse_double_t p( set( -1.13585365213876817300E-11 ) );
+   p = fmadd( p, zz, set(  2.08757008419747316778E-9 ) );
+   p = fmadd( p, zz, set( -2.75573141792967388112E-7 ) );
+   p = fmadd( p, zz, set(  2.48015872888517045348E-5 ) );
+   p = fmadd( p, zz, set( -1.38888888888730564116E-3 ) );
+   p = fmadd( p, zz, set(  4.16666666666665929218E-2 ) );
+
+   return fmadd( p * zz, zz, fnmadd( set( 0.5 ), zz, set( 1.0 ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_float_t sin( sse_float_t )
+// \brief Sine function for a vector of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of single precision floating point values.
+// \return The resulting sine values.
+//
+// For arguments up to \f$ 2^{13} \f$ in magnitude the maximum error is 2 ULP for results with a
+// magnitude above 0.5. Close to the roots of the sine the absolute error is bounded by the
+// machine epsilon. In case any argument exceeds this range, the entire vector is evaluated by
+// means of the scalar std::sin() function.
+*/
+BLAZE_ALWAYS_INLINE sse_float_t sin( const sse_float_t& a )
+{
+   const sse_float_t one( set( 1.0F ) );
+   const sse_float_t x( abs( a ) );
+
+   if( exceedsTrigonometricRange( x ) )
+      return trigonometricFallback<float>( a, std::sin );
+
+   sse_float_t y;
+   const sse_float_t z( reduceTrigonometric( x, y ) );
+   const sse_float_t octant ( y - floor( y * set( 0.125F ) ) * set( 8.0F ) );
+   const sse_float_t quadrant( y - floor( y * set( 0.25F ) ) * set( 4.0F ) );
+
+   const sse_float_t p( select( cmpeq( quadrant, set( 2.0F ) ), cosPolynomial( z ), sinPolynomial( z ) ) );
+   const sse_float_t s( select( cmplt( set( 3.0F ), octant ), set( -1.0F ), one ) );
+
+   return p * select( cmplt( a, set( 0.0F ) ), s * set( -1.0F ), s );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t sin( sse_double_t )
+// \brief Sine function for a vector of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of double precision floating point values.
+// \return The resulting sine values.
+//
+// For arguments up to \f$ 2^{26} \f$ in magnitude the maximum error is 2 ULP for results with a
+// magnitude above 0.5. Close to the roots of the sine the absolute error is bounded by the
+// machine epsilon. In case any argument exceeds this range, the entire vector is evaluated by
+// means of the scalar std::sin() function.
+*/
+BLAZE_ALWAYS_INLINE sse_double_t sin( const sse_double_t& a )
+{
+   const sse_double_t one( set( 1.0 ) );
+   const sse_double_t x( abs( a ) );
+
+   if( exceedsTrigonometricRange( x ) )
+      return trigonometricFallback<double>( a, std::sin );
+
+   sse_double_t y;
+   const sse_double_t z( reduceTrigonometric( x, y ) );
+   const sse_double_t octant ( y - floor( y * set( 0.125 ) ) * set( 8.0 ) );
+   const sse_double_t quadrant( y - floor( y * set( 0.25 ) ) * set( 4.0 ) );
+
+   const sse_double_t p( select( cmpeq( quadrant, set( 2.0 ) ), cosPolynomial( z ), sinPolynomial( z ) ) );
+   const sse_double_t s( select( cmplt( set( 3.0 ), octant ), set( -1.0 ), one ) );
+
+   return p * select( cmplt( a, set( 0.0 ) ), s * set( -1.0 ), s );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_float_t cos( sse_float_t )
+// \brief Cosine function for a vector of single precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of single precision floating point values.
+// \return The resulting cosine values.
+//
+// For arguments up to \f$ 2^{13} \f$ in magnitude the maximum error is 2 ULP for results with a
+// magnitude above 0.5. Close to the roots of the cosine the absolute error is bounded by the
+// machine epsilon. In case any argument exceeds this range, the entire vector is evaluated by
+// means of the scalar std::cos() function.
+*/
+BLAZE_ALWAYS_INLINE sse_float_t cos( const sse_float_t& a )
+{
+   const sse_float_t x( abs( a ) );
+
+   if( exceedsTrigonometricRange( x ) )
+      return trigonometricFallback<float>( a, std::cos );
+
+   sse_float_t y;
+   const sse_float_t z( reduceTrigonometric( x, y ) );
+   const sse_float_t octant ( y - floor( y * set( 0.125F ) ) * set( 8.0F ) );
+   const sse_float_t quadrant( y - floor( y * set( 0.25F ) ) * set( 4.0F ) );
+
+   const sse_float_t p( select( cmpeq( quadrant, set( 2.0F ) ), sinPolynomial( z ), cosPolynomial( z ) ) );
+
+   // Negative results in the octants 2 and 4
+   return select( cmpeq( abs( octant - set( 3.0F ) ), set( 1.0F ) ), p * set( -1.0F ), p );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\fn sse_double_t cos( sse_double_t )
+// \brief Cosine function for a vector of double precision floating point values.
+// \ingroup intrinsics
+//
+// \param a The vector of double precision floating point values.
+// \return The resulting cosine values.
+//
+// For arguments up to \f$ 2^{26} \f$ in magnitude the maximum error is 2 ULP for results with a
+// magnitude above 0.5. Close to the roots of the cosine the absolute error is bounded by the
+// machine epsilon. In case any argument exceeds this range, the entire vector is evaluated by
+// means of the scalar std::cos() function.
+*/
+BLAZE_ALWAYS_INLINE sse_double_t cos( const sse_double_t& a )
+{
+   const sse_double_t x( abs( a ) );
+
+   if( exceedsTrigonometricRange( x ) )
+      return trigonometricFallback<double>( a, std::cos );
+
+   sse_double_t y;
+   const sse_double_t z( reduceTrigonometric( x, y ) );
+   const sse_double_t octant ( y - floor( y * set( 0.125 ) ) * set( 8.0 ) );
+   const sse_double_t quadrant( y - floor( y * set( 0.25 ) ) * set( 4.0 ) );
+
+   const sse_double_t p( select( cmpeq( quadrant, set( 2.0 ) ), sinPolynomial( z ), cosPolynomial( z ) ) );
+
+   // Negative results in the octants 2 and 4
+   return select( cmpeq( abs( octant - set( 3.0 ) ), set( 1.0 ) ), p * set( -1.0 ), p );
+}
+//*************************************************************************************************
+
+#endif
+
+} // namespace blaze
+
+#endif
@@ -41,9 +41,11 @@
 //*************************************************************************************************
 
 #include <cmath>
+#include <vector>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/Functions.h>
+#include <blaze/math/problems/Update.h>
 #include <blaze/system/Precision.h>
 #include <blaze/util/Types.h>
 
@@ -74,6 +76,8 @@ struct BoxLCP
    inline real   ubound  ( size_t index ) const;
    inline real   residual( size_t index ) const;
    inline real   residual()               const;
+   inline void   update  ( const std::vector<size_t>& removed,
+                           const CMatMxN& rows, const CMatMxN& columns );
    //@}
    //**********************************************************************************************
 
@@ -181,6 +185,36 @@ inline real BoxLCP::residual() const
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Removes and appends unknowns of the BLCP.
+//
+// \param removed The ascending indices of the unknowns to be removed.
+// \param rows The rows of the appended unknowns with respect to the updated numbering.
+// \param columns The columns of the appended unknowns for all remaining rows.
+// \return void
+// \exception std::invalid_argument Invalid block index.
+// \exception std::invalid_argument Invalid number of appended rows.
+// \exception std::invalid_argument Invalid number of appended columns.
+//
+// This function updates the problem from one time step to the next without reassembling the system
+// matrix. The remaining unknowns keep their relative order and their current values, i.e. the
+// previous solution serves as initial solution of the next solution process. The appended unknowns
+// are numbered consecutively behind the remaining unknowns. The right-hand side, the unknowns and
+// the bounds of the appended rows are initialized to zero, i.e. the right-hand side and the bounds
+// of the new unknowns have to be set afterwards.
+*/
+inline void BoxLCP::update( const std::vector<size_t>& removed, const CMatMxN& rows, const CMatMxN& columns )
+{
+   updateMatrix( A_, removed, 1UL, rows, columns );
+
+   updateVector( b_, removed, 1UL, rows.rows() );
+   updateVector( x_, removed, 1UL, rows.rows() );
+   updateVector( xmin_, removed, 1UL, rows.rows() );
+   updateVector( xmax_, removed, 1UL, rows.rows() );
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -41,10 +41,12 @@
 //*************************************************************************************************
 
 #include <cmath>
+#include <vector>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/Infinity.h>
+#include <blaze/math/problems/Update.h>
 #include <blaze/system/Precision.h>
 #include <blaze/util/Types.h>
 
@@ -74,6 +76,8 @@ struct ContactLCP
    inline real   ubound  ( size_t index ) const;
    inline real   residual( size_t index ) const;
    inline real   residual()               const;
+   inline void   update  ( const std::vector<size_t>& removed,
+                           const CMatMxN& rows, const CMatMxN& columns );
    //@}
    //**********************************************************************************************
 
@@ -179,6 +183,35 @@ inline real ContactLCP::residual() const
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Removes and appends contacts of the contact LCP.
+//
+// \param removed The ascending indices of the contacts to be removed.
+// \param rows The rows of the appended unknowns with respect to the updated numbering.
+// \param columns The columns of the appended unknowns for all remaining rows.
+// \return void
+// \exception std::invalid_argument Invalid block index.
+// \exception std::invalid_argument Invalid number of appended rows.
+// \exception std::invalid_argument Invalid number of appended columns.
+//
+// This function updates the problem from one time step to the next without reassembling the system
+// matrix. The remaining unknowns keep their relative order and their current values, i.e. the
+// previous solution serves as initial solution of the next solution process. The appended unknowns
+// are numbered consecutively behind the remaining unknowns. The right-hand side, the unknowns and
+// the coefficients of friction of the appended contacts are initialized to zero, i.e. the right-
+// hand side and the coefficients of friction of the new contacts have to be set afterwards.
+*/
+inline void ContactLCP::update( const std::vector<size_t>& removed, const CMatMxN& rows, const CMatMxN& columns )
+{
+   updateMatrix( A_, removed, 3UL, rows, columns );
+
+   updateVector( b_, removed, 3UL, rows.rows() );
+   updateVector( x_, removed, 3UL, rows.rows() );
+   updateVector( cof_, removed, 1UL, rows.rows()/3UL );
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
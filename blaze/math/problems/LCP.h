@@ -41,10 +41,12 @@
 //*************************************************************************************************
 
 #include <cmath>
+#include <vector>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/Infinity.h>
+#include <blaze/math/problems/Update.h>
 #include <blaze/system/Precision.h>
 #include <blaze/util/Types.h>
 
@@ -76,6 +78,8 @@ struct LCP
    inline real   ubound  ( size_t index ) const;
    inline real   residual( size_t index ) const;
    inline real   residual()               const;
+   inline void   update  ( const std::vector<size_t>& removed,
+                           const CMatMxN& rows, const CMatMxN& columns );
    //@}
    //**********************************************************************************************
 
@@ -179,6 +183,33 @@ inline real LCP::residual() const
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Removes and appends unknowns of the linear complementarity problem.
+//
+// \param removed The ascending indices of the unknowns to be removed.
+// \param rows The rows of the appended unknowns with respect to the updated numbering.
+// \param columns The columns of the appended unknowns for all remaining rows.
+// \return void
+// \exception std::invalid_argument Invalid block index.
+// \exception std::invalid_argument Invalid number of appended rows.
+// \exception std::invalid_argument Invalid number of appended columns.
+//
+// This function updates the problem from one time step to the next without reassembling the system
+// matrix. The remaining unknowns keep their relative order and their current values, i.e. the
+// previous solution serves as initial solution of the next solution process. The appended unknowns
+// are numbered consecutively behind the remaining unknowns. The right-hand side and the unknowns
+// of the appended rows are initialized to zero.
+*/
+inline void LCP::update( const std::vector<size_t>& removed, const CMatMxN& rows, const CMatMxN& columns )
+{
+   updateMatrix( A_, removed, 1UL, rows, columns );
+
+   updateVector( b_, removed, 1UL, rows.rows() );
+   updateVector( x_, removed, 1UL, rows.rows() );
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -0,0 +1,188 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/problems/Update.h
+//  \brief Header file for the incremental update of complementarity problems
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_PROBLEMS_UPDATE_H_
+#define _BLAZE_MATH_PROBLEMS_UPDATE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/system/Precision.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  UPDATE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Removes and appends blocks of rows and columns of the system matrix of a problem.
+// \ingroup math
+//
+// \param A The system matrix to be updated.
+// \param removed The ascending indices of the blocks to be removed.
+// \param bs The number of unknowns per block.
+// \param rows The rows of the appended unknowns with respect to the updated numbering.
+// \param columns The columns of the appended unknowns for all remaining rows.
+// \return void
+// \exception std::invalid_argument Invalid block index.
+// \exception std::invalid_argument Invalid number of appended rows.
+// \exception std::invalid_argument Invalid number of appended columns.
+//
+// The remaining rows and columns keep their relative order, the appended unknowns are numbered
+// consecutively behind the remaining unknowns. Due to the compressed storage, the update copies
+// the remaining elements once, but it does not touch any element values.
+*/
+inline void updateMatrix( CMatMxN& A, const std::vector<size_t>& removed, size_t bs,
+                          const CMatMxN& rows, const CMatMxN& columns )
+{
+   typedef CMatMxN::ConstIterator  ConstIterator;
+
+   const size_t n( A.rows() );
+
+   for( size_t k=0UL; k<removed.size(); ++k ) {
+      if( ( removed[k]+1UL )*bs > n || ( k > 0UL && removed[k] <= removed[k-1UL] ) )
+         throw std::invalid_argument( "Invalid block index" );
+   }
+
+   const size_t nrem( n - removed.size()*bs );
+   const size_t m( rows.rows() );
+
+   if( m % bs != 0UL || rows.columns() != nrem+m )
+      throw std::invalid_argument( "Invalid number of appended rows" );
+
+   if( columns.rows() != nrem || columns.columns() != m )
+      throw std::invalid_argument( "Invalid number of appended columns" );
+
+   if( removed.empty() && m == 0UL )
+      return;
+
+   // Computing the new index of each remaining unknown
+   std::vector<size_t> index( n );
+
+   for( size_t j=0UL, k=0UL, l=0UL; j<n; ++j ) {
+      if( k < removed.size() && j/bs == removed[k] ) {
+         index[j] = nrem+m;
+         if( ( j+1UL ) % bs == 0UL ) ++k;
+      }
+      else index[j] = l++;
+   }
+
+   // Assembling the updated matrix
+   CMatMxN tmp( nrem+m, nrem+m );
+   tmp.reserve( A.nonZeros() + rows.nonZeros() + 2UL*columns.nonZeros() );
+
+   for( size_t i=0UL, r=0UL; i<n; ++i )
+   {
+      if( index[i] == nrem+m ) continue;
+
+      const ConstIterator end( A.end(i) );
+      for( ConstIterator element=A.begin(i); element!=end; ++element ) {
+         const size_t j( index[element->index()] );
+         if( j != nrem+m ) tmp.append( r, j, element->value() );
+      }
+
+      const ConstIterator cend( columns.end(r) );
+      for( ConstIterator element=columns.begin(r); element!=cend; ++element )
+         tmp.append( r, nrem+element->index(), element->value() );
+
+      tmp.finalize( r );
+      ++r;
+   }
+
+   for( size_t i=0UL; i<m; ++i )
+   {
+      const ConstIterator end( rows.end(i) );
+      for( ConstIterator element=rows.begin(i); element!=end; ++element )
+         tmp.append( nrem+i, element->index(), element->value() );
+
+      tmp.finalize( nrem+i );
+   }
+
+   A.swap( tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Removes and appends blocks of elements of a vector of a problem.
+// \ingroup math
+//
+// \param v The vector to be updated.
+// \param removed The ascending indices of the blocks to be removed.
+// \param bs The number of elements per block.
+// \param m The number of appended elements.
+// \param value The initial value of the appended elements.
+// \return void
+//
+// The remaining elements are moved to the front of the vector in place, keeping their relative
+// order. The block indices are expected to be checked by a preceding call to updateMatrix().
+*/
+inline void updateVector( VecN& v, const std::vector<size_t>& removed, size_t bs,
+                          size_t m, real value = real(0) )
+{
+   const size_t n( v.size() );
+   size_t l( removed.empty() ? n : removed[0]*bs );
+
+   for( size_t k=0UL; k<removed.size(); ++k ) {
+      const size_t jend( ( k+1UL < removed.size() )?( removed[k+1UL]*bs ):( n ) );
+      for( size_t j=( removed[k]+1UL )*bs; j<jend; ++j, ++l )
+         v[l] = v[j];
+   }
+
+   v.resize( l+m, true );
+
+   for( size_t j=l; j<l+m; ++j )
+      v[j] = value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,817 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/SparseAssembly.h
+//  \brief Header file for the row-wise assembly kernels of the sparse matrix SMP assignment
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_SPARSEASSEMBLY_H_
+#define _BLAZE_MATH_SMP_SPARSEASSEMBLY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/DenseSubmatrix.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/sparse/SMMM.h>
+#include <blaze/math/SparseSubmatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/math/typetraits/IsMatMatAddExpr.h>
+#include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/math/typetraits/IsMatMatSubExpr.h>
+#include <blaze/math/typetraits/IsMatScalarMultExpr.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveCV.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Appends an element to the given row of a row-major sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target row-major sparse matrix.
+// \param i The index of the row.
+// \param j The column index of the element.
+// \param value The value of the element.
+// \return void
+*/
+template< typename MT  // Type of the target sparse matrix
+        , typename T > // Type of the value
+inline void smpAppend( SparseMatrix<MT,rowMajor>& lhs, size_t i, size_t j, const T& value )
+{
+   (~lhs).append( i, j, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Appends an element to the given column of a column-major sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target column-major sparse matrix.
+// \param j The index of the column.
+// \param i The row index of the element.
+// \param value The value of the element.
+// \return void
+*/
+template< typename MT  // Type of the target sparse matrix
+        , typename T > // Type of the value
+inline void smpAppend( SparseMatrix<MT,columnMajor>& lhs, size_t j, size_t i, const T& value )
+{
+   (~lhs).append( i, j, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERAND EVALUATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluation of a sparse matrix operand of an assembly kernel.
+// \ingroup smp
+//
+// The SparseAssemblyOperand class template stores an operand of a compound sparse matrix
+// expression. Operands that can be traversed directly (i.e. sparse matrices and cheap sparse
+// matrix expressions) are stored as given by the expression.
+*/
+template< typename OT                                                 // Type of the operand
+        , typename MT = typename RemoveCV< typename RemoveReference<OT>::Type >::Type
+        , bool RE = RequiresEvaluation<MT>::value >                   // Evaluation flag
+struct SparseAssemblyOperand
+{
+   //**Type definitions****************************************************************************
+   typedef OT  Type;  //!< Type of the stored operand.
+   //**********************************************************************************************
+
+   //**Evaluate function***************************************************************************
+   /*!\brief Returns the given operand.
+   //
+   // \param op The operand.
+   // \return The given operand.
+   */
+   static inline Type evaluate( Type op ) {
+      return op;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SparseAssemblyOperand class template for operands that require
+//        an intermediate evaluation.
+// \ingroup smp
+//
+// Operands that require an intermediate evaluation (as for instance nested additions or
+// multiplications) are evaluated into a temporary sparse matrix. In case the operand is
+// large enough, the temporary is assembled by the active SMP backend.
+*/
+template< typename OT  // Type of the operand
+        , typename MT >  // Type of the operand without reference and cv-qualifiers
+struct SparseAssemblyOperand<OT,MT,true>
+{
+   //**Type definitions****************************************************************************
+   typedef const typename MT::ResultType  Type;  //!< Type of the stored operand.
+   //**********************************************************************************************
+
+   //**Evaluate function***************************************************************************
+   /*!\brief Evaluates the given operand.
+   //
+   // \param op The operand.
+   // \return The evaluated operand.
+   */
+   static inline typename MT::ResultType evaluate( const MT& op ) {
+      typename MT::ResultType tmp( op.rows(), op.columns() );
+      if( op.canSMPAssign() )
+         smpAssign_backend( tmp, op );
+      else
+         assign( tmp, op );
+      return tmp;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KERNEL SELECTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the selection of the merge and product kernels.
+// \ingroup smp
+//
+// In case \a MT is a sparse matrix addition, subtraction or multiplication whose operands are
+// both sparse matrices with storage order \a SO, \a value is set to 1. Otherwise \a value is
+// set to 0.
+*/
+template< typename MT                                                 // Type of the expression
+        , bool SO                                                     // Storage order of the target
+        , bool = IsMatMatAddExpr<MT>::value || IsMatMatSubExpr<MT>::value || IsMatMatMultExpr<MT>::value >
+struct HasSparseAssemblyOperands
+{
+   enum { value = 0 };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the HasSparseAssemblyOperands helper struct for additions,
+//        subtractions and multiplications.
+// \ingroup smp
+*/
+template< typename MT  // Type of the expression
+        , bool SO >    // Storage order of the target
+struct HasSparseAssemblyOperands<MT,SO,true>
+{
+ private:
+   typedef typename RemoveCV< typename RemoveReference<typename MT::LeftOperand >::Type >::Type  LT;
+   typedef typename RemoveCV< typename RemoveReference<typename MT::RightOperand>::Type >::Type  RT;
+
+ public:
+   enum { value = IsSparseMatrix<LT>::value && IsColumnMajorMatrix<LT>::value == SO &&
+                  IsSparseMatrix<RT>::value && IsColumnMajorMatrix<RT>::value == SO };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Selection of the assembly kernel for the SMP assignment of a matrix to a sparse matrix.
+// \ingroup smp
+//
+// This helper struct selects the assembly kernel for the assignment of a matrix of type \a MT2
+// to a sparse matrix of type \a MT1:
+//
+//  - \a direct: \a MT2 is a sparse matrix (or cheap sparse matrix expression) with the storage
+//    order of the target, whose rows/columns can be traversed directly.
+//  - \a merge: \a MT2 is the addition or subtraction of two sparse matrices with the storage
+//    order of the target.
+//  - \a product: \a MT2 is the multiplication of two sparse matrices with the storage order of
+//    the target.
+//  - \a scale: \a MT2 is the scaling of a sparse matrix expression with the storage order of
+//    the target, which requires an intermediate evaluation.
+//  - \a blocked: All other matrices (dense matrices, operands with a different storage order,
+//    and sparse matrix expressions without a dedicated kernel).
+*/
+template< typename MT1    // Type of the target sparse matrix
+        , typename MT2 >  // Type of the right-hand side matrix
+struct SparseAssemblyKind
+{
+   enum { direct = 0, merge = 1, product = 2, scale = 3, blocked = 4 };
+
+ private:
+   enum { SO = IsColumnMajorMatrix<MT1>::value };
+   enum { sameOrder = IsSparseMatrix<MT2>::value && IsColumnMajorMatrix<MT2>::value == SO };
+   enum { binary = sameOrder && HasSparseAssemblyOperands<MT2,SO>::value };
+
+ public:
+   enum { value = ( sameOrder && !RequiresEvaluation<MT2>::value )
+                  ?( direct )
+                  :( ( binary && !IsMatMatMultExpr<MT2>::value )
+                     ?( merge )
+                     :( ( binary && IsMatMatMultExpr<MT2>::value )
+                        ?( product )
+                        :( ( sameOrder && IsMatScalarMultExpr<MT2>::value )
+                           ?( scale )
+                           :( blocked ) ) ) ) };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS SPARSEASSEMBLY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Row-wise assembly kernels for the SMP assignment to a sparse matrix.
+// \ingroup smp
+//
+// The SparseAssembly class template provides the two phases of the SMP assignment of a matrix
+// of type \a MT2 to a sparse matrix of type \a MT1. The count() function computes the exact
+// number of non-zero elements of a range of rows (or columns for a column-major target), the
+// fill() function appends the elements of a range of rows/columns to the target matrix, whose
+// storage has been partitioned accordingly. Both functions can be called concurrently for
+// disjoint ranges. The general kernel handles all matrices that cannot be traversed row-wise:
+// each range is evaluated into a sparse block during the count phase, which is copied into the
+// target matrix during the fill phase. Therefore the count() and fill() functions have to be
+// called for the same ranges of \a sizePerTask rows/columns.
+*/
+template< typename MT1                                         // Type of the target sparse matrix
+        , typename MT2                                         // Type of the right-hand side matrix
+        , int Kind = SparseAssemblyKind<MT1,MT2>::value >      // Type of the assembly kernel
+class SparseAssembly
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef typename MT1::ResultType      Block;          //!< Type of the evaluated blocks.
+   typedef typename Block::ConstIterator  BlockIterator;  //!< Iterator over the elements of a block.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   enum { SO = IsColumnMajorMatrix<MT1>::value };
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the general assembly kernel.
+   //
+   // \param rhs The right-hand side matrix to be assigned.
+   // \param sizePerTask The number of rows/columns per range.
+   */
+   explicit inline SparseAssembly( const MT2& rhs, size_t sizePerTask )
+      : rhs_        ( rhs )          // The right-hand side matrix
+      , sizePerTask_( sizePerTask )  // The number of rows/columns per range
+      , blocks_     ()               // The evaluated blocks
+   {
+      const size_t size( SO ? rhs.columns() : rhs.rows() );
+      blocks_.resize( ( sizePerTask > 0UL )?( ( size + sizePerTask - 1UL ) / sizePerTask ):( 0UL ) );
+   }
+   //**********************************************************************************************
+
+   //**Count function******************************************************************************
+   /*!\brief Computes the number of non-zero elements of the given range of rows/columns.
+   //
+   // \param begin The index of the first row/column of the range.
+   // \param end The index one past the last row/column of the range.
+   // \param nonzeros The resulting number of non-zero elements per row/column.
+   // \return void
+   */
+   inline void count( size_t begin, size_t end, size_t* nonzeros ) {
+      BLAZE_INTERNAL_ASSERT( begin % sizePerTask_ == 0UL, "Invalid range of rows/columns" );
+
+      Block& block( blocks_[begin/sizePerTask_] );
+
+      if( SO )
+         block = serial( submatrix<unaligned>( rhs_, 0UL, begin, rhs_.rows(), end-begin ) );
+      else
+         block = serial( submatrix<unaligned>( rhs_, begin, 0UL, end-begin, rhs_.columns() ) );
+
+      for( size_t k=begin; k<end; ++k )
+         nonzeros[k-begin] = block.nonZeros( k-begin );
+   }
+   //**********************************************************************************************
+
+   //**Fill function*******************************************************************************
+   /*!\brief Appends the elements of the given range of rows/columns to the target matrix.
+   //
+   // \param lhs The target sparse matrix.
+   // \param begin The index of the first row/column of the range.
+   // \param end The index one past the last row/column of the range.
+   // \return void
+   */
+   inline void fill( MT1& lhs, size_t begin, size_t end ) const {
+      const Block& block( blocks_[begin/sizePerTask_] );
+
+      for( size_t k=begin; k<end; ++k ) {
+         const BlockIterator last( block.end( k-begin ) );
+         for( BlockIterator element=block.begin( k-begin ); element!=last; ++element )
+            smpAppend( lhs, k, element->index(), element->value() );
+      }
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   const MT2&         rhs_;          //!< The right-hand side matrix.
+   const size_t       sizePerTask_;  //!< The number of rows/columns per range.
+   std::vector<Block> blocks_;       //!< The evaluated blocks.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE SPECIALIZATION FOR DIRECTLY ACCESSIBLE SPARSE MATRICES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SparseAssembly class template for directly accessible sparse
+//        matrices.
+// \ingroup smp
+//
+// This specialization traverses the rows/columns of a sparse matrix (or of a cheap sparse matrix
+// expression as for instance a scaled or transposed sparse matrix) with the storage order of the
+// target matrix. No intermediate memory is required.
+*/
+template< typename MT1    // Type of the target sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+class SparseAssembly<MT1,MT2,SparseAssemblyKind<MT1,MT2>::direct>
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef typename MT2::CompositeType  CT;              //!< Composite type of the right-hand side matrix.
+   typedef typename MT2::ConstIterator  ConstIterator;  //!< Iterator over the elements of the right-hand side matrix.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the direct assembly kernel.
+   //
+   // \param rhs The right-hand side sparse matrix to be assigned.
+   */
+   explicit inline SparseAssembly( const MT2& rhs, size_t /*sizePerTask*/ )
+      : rhs_( rhs )  // The right-hand side sparse matrix
+   {}
+   //**********************************************************************************************
+
+   //**Count function******************************************************************************
+   /*!\brief Computes the number of non-zero elements of the given range of rows/columns.
+   //
+   // \param begin The index of the first row/column of the range.
+   // \param end The index one past the last row/column of the range.
+   // \param nonzeros The resulting number of non-zero elements per row/column.
+   // \return void
+   */
+   inline void count( size_t begin, size_t end, size_t* nonzeros ) const {
+      for( size_t k=begin; k<end; ++k ) {
+         size_t nonZeros( 0UL );
+         const ConstIterator last( rhs_.end(k) );
+         for( ConstIterator element=rhs_.begin(k); element!=last; ++element )
+            ++nonZeros;
+         nonzeros[k-begin] = nonZeros;
+      }
+   }
+   //**********************************************************************************************
+
+   //**Fill function*******************************************************************************
+   /*!\brief Appends the elements of the given range of rows/columns to the target matrix.
+   //
+   // \param lhs The target sparse matrix.
+   // \param begin The index of the first row/column of the range.
+   // \param end The index one past the last row/column of the range.
+   // \return void
+   */
+   inline void fill( MT1& lhs, size_t begin, size_t end ) const {
+      for( size_t k=begin; k<end; ++k ) {
+         const ConstIterator last( rhs_.end(k) );
+         for( ConstIterator element=rhs_.begin(k); element!=last; ++element )
+            smpAppend( lhs, k, element->index(), element->value() );
+      }
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   CT rhs_;  //!< The right-hand side sparse matrix.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE SPECIALIZATION FOR SPARSE MATRIX ADDITIONS AND SUBTRACTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SparseAssembly class template for sparse matrix additions and
+//        subtractions.
+// \ingroup smp
+//
+// This specialization merges the rows/columns of the two operands of a sparse matrix addition
+// or subtraction. Operands that require an intermediate evaluation are evaluated once (and in
+// parallel) before the merge.
+*/
+template< typename MT1    // Type of the target sparse matrix
+        , typename MT2 >  // Type of the right-hand side addition or subtraction
+class SparseAssembly<MT1,MT2,SparseAssemblyKind<MT1,MT2>::merge>
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef SparseAssemblyOperand<typename MT2::LeftOperand>   LeftOperand;   //!< Evaluation of the left-hand side operand.
+   typedef SparseAssemblyOperand<typename MT2::RightOperand>  RightOperand;  //!< Evaluation of the right-hand side operand.
+
+   typedef typename LeftOperand::Type   LT;  //!< Type of the stored left-hand side operand.
+   typedef typename RightOperand::Type  RT;  //!< Type of the stored right-hand side operand.
+
+   //! Iterator over the elements of the left-hand side operand.
+   typedef typename RemoveCV< typename RemoveReference<LT>::Type >::Type::ConstIterator  LeftIterator;
+
+   //! Iterator over the elements of the right-hand side operand.
+   typedef typename RemoveCV< typename RemoveReference<RT>::Type >::Type::ConstIterator  RightIterator;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   enum { subtraction = IsMatMatSubExpr<MT2>::value };
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the merge assembly kernel.
+   //
+   // \param rhs The right-hand side addition or subtraction to be assigned.
+   */
+   explicit inline SparseAssembly( const MT2& rhs, size_t /*sizePerTask*/ )
+      : lhs_( LeftOperand::evaluate( rhs.leftOperand() ) )    // The left-hand side operand
+      , rhs_( RightOperand::evaluate( rhs.rightOperand() ) )  // The right-hand side operand
+   {}
+   //**********************************************************************************************
+
+   //**Count function******************************************************************************
+   /*!\brief Computes the number of non-zero elements of the given range of rows/columns.
+   //
+   // \param begin The index of the first row/column of the range.
+   // \param end The index one past the last row/column of the range.
+   // \param nonzeros The resulting number of non-zero elements per row/column.
+   // \return void
+   */
+   inline void count( size_t begin, size_t end, size_t* nonzeros ) const {
+      for( size_t k=begin; k<end; ++k )
+      {
+         const LeftIterator  lend( lhs_.end(k) );
+         const RightIterator rend( rhs_.end(k) );
+
+         LeftIterator  l( lhs_.begin(k) );
+         RightIterator r( rhs_.begin(k) );
+         size_t nonZeros( 0UL );
+
+         while( l != lend && r != rend ) {
+            if( l->index() <= r->index() ) {
+               if( l->index() == r->index() ) ++r;
+               ++l;
+            }
+            else ++r;
+            ++nonZeros;
+         }
+
+         for( ; l!=lend; ++l ) ++nonZeros;
+         for( ; r!=rend; ++r ) ++nonZeros;
+
+         nonzeros[k-begin] = nonZeros;
+      }
+   }
+   //**********************************************************************************************
+
+   //**Fill function*******************************************************************************
+   /*!\brief Appends the elements of the given range of rows/columns to the target matrix.
+   //
+   // \param lhs The target sparse matrix.
+   // \param begin The index of the first row/column of the range.
+   // \param end The index one past the last row/column of the range.
+   // \return void
+   */
+   inline void fill( MT1& lhs, size_t begin, size_t end ) const {
+      for( size_t k=begin; k<end; ++k )
+      {
+         const LeftIterator  lend( lhs_.end(k) );
+         const RightIterator rend( rhs_.end(k) );
+
+         LeftIterator  l( lhs_.begin(k) );
+         RightIterator r( rhs_.begin(k) );
+
+         while( l != lend && r != rend )
+         {
+            if( l->index() < r->index() ) {
+               smpAppend( lhs, k, l->index(), l->value() );
+               ++l;
+            }
+            else if( l->index() > r->index() ) {
+               if( subtraction ) smpAppend( lhs, k, r->index(), -r->value() );
+               else              smpAppend( lhs, k, r->index(),  r->value() );
+               ++r;
+            }
+            else {
+               if( subtraction ) smpAppend( lhs, k, l->index(), l->value() - r->value() );
+               else              smpAppend( lhs, k, l->index(), l->value() + r->value() );
+               ++l;
+               ++r;
+            }
+         }
+
+         for( ; l!=lend; ++l ) {
+            smpAppend( lhs, k, l->index(), l->value() );
+         }
+
+         for( ; r!=rend; ++r ) {
+            if( subtraction ) smpAppend( lhs, k, r->index(), -r->value() );
+            else              smpAppend( lhs, k, r->index(),  r->value() );
+         }
+      }
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   LT lhs_;  //!< The left-hand side operand.
+   RT rhs_;  //!< The right-hand side operand.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE SPECIALIZATION FOR SPARSE MATRIX MULTIPLICATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SparseAssembly class template for sparse matrix multiplications.
+// \ingroup smp
+//
+// This specialization computes the rows/columns of a sparse matrix multiplication by means of
+// the Gustavson kernels of the sparse matrix/sparse matrix multiplication: the count phase
+// computes the exact structure of each row/column, the fill phase accumulates and appends its
+// values. Both phases use the accumulators of the executing thread. Operands that require an
+// intermediate evaluation are evaluated once (and in parallel) before the multiplication.
+*/
+template< typename MT1    // Type of the target sparse matrix
+        , typename MT2 >  // Type of the right-hand side multiplication
+class SparseAssembly<MT1,MT2,SparseAssemblyKind<MT1,MT2>::product>
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef SparseAssemblyOperand<typename MT2::LeftOperand>   LeftOperand;   //!< Evaluation of the left-hand side operand.
+   typedef SparseAssemblyOperand<typename MT2::RightOperand>  RightOperand;  //!< Evaluation of the right-hand side operand.
+
+   typedef typename LeftOperand::Type   LT;  //!< Type of the stored left-hand side operand.
+   typedef typename RightOperand::Type  RT;  //!< Type of the stored right-hand side operand.
+
+   typedef typename MT1::ElementType  ElementType;  //!< Element type of the target sparse matrix.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   enum { SO = IsColumnMajorMatrix<MT1>::value };
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the product assembly kernel.
+   //
+   // \param rhs The right-hand side multiplication to be assigned.
+   */
+   explicit inline SparseAssembly( const MT2& rhs, size_t /*sizePerTask*/ )
+      : lhs_( LeftOperand::evaluate( rhs.leftOperand() ) )    // The left-hand side operand
+      , rhs_( RightOperand::evaluate( rhs.rightOperand() ) )  // The right-hand side operand
+   {}
+   //**********************************************************************************************
+
+   //**Count function******************************************************************************
+   /*!\brief Computes the number of non-zero elements of the given range of rows/columns.
+   //
+   // \param begin The index of the first row/column of the range.
+   // \param end The index one past the last row/column of the range.
+   // \param nonzeros The resulting number of non-zero elements per row/column.
+   // \return void
+   */
+   inline void count( size_t begin, size_t end, size_t* nonzeros ) const {
+      SMMMWorkspace<ElementType>& ws( smmmWorkspace<ElementType>() );
+      for( size_t k=begin; k<end; ++k ) {
+         nonzeros[k-begin] = ( SO )
+                             ?( smmmRowStructure( ws, rhs_, lhs_, k, smmmFlops( rhs_, lhs_, k ), false ) )
+                             :( smmmRowStructure( ws, lhs_, rhs_, k, smmmFlops( lhs_, rhs_, k ), false ) );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Fill function*******************************************************************************
+   /*!\brief Appends the elements of the given range of rows/columns to the target matrix.
+   //
+   // \param lhs The target sparse matrix.
+   // \param begin The index of the first row/column of the range.
+   // \param end The index one past the last row/column of the range.
+   // \return void
+   */
+   inline void fill( MT1& lhs, size_t begin, size_t end ) const {
+      SMMMWorkspace<ElementType>& ws( smmmWorkspace<ElementType>() );
+      for( size_t k=begin; k<end; ++k ) {
+         const size_t nonzeros( ( SO )
+                                ?( smmmRowProduct( ws, rhs_, lhs_, k, smmmFlops( rhs_, lhs_, k ) ) )
+                                :( smmmRowProduct( ws, lhs_, rhs_, k, smmmFlops( lhs_, rhs_, k ) ) ) );
+         for( size_t j=0UL; j<nonzeros; ++j )
+            smpAppend( lhs, k, ws.indices_[j], ws.results_[j] );
+      }
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   LT lhs_;  //!< The left-hand side operand.
+   RT rhs_;  //!< The right-hand side operand.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE SPECIALIZATION FOR SCALED SPARSE MATRIX EXPRESSIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SparseAssembly class template for scaled sparse matrix
+//        expressions.
+// \ingroup smp
+//
+// This specialization handles the scaling of a sparse matrix expression that requires an
+// intermediate evaluation (as for instance the scaling of a sparse matrix addition). The
+// operand is evaluated once (and in parallel), afterwards its rows/columns are scaled while
+// they are copied into the target matrix.
+*/
+template< typename MT1    // Type of the target sparse matrix
+        , typename MT2 >  // Type of the right-hand side scalar multiplication
+class SparseAssembly<MT1,MT2,SparseAssemblyKind<MT1,MT2>::scale>
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef SparseAssemblyOperand<typename MT2::LeftOperand>  Operand;  //!< Evaluation of the sparse matrix operand.
+   typedef typename Operand::Type                            OT;       //!< Type of the stored sparse matrix operand.
+   typedef typename MT2::RightOperand                        ST;       //!< Type of the scalar value.
+
+   //! Iterator over the elements of the sparse matrix operand.
+   typedef typename RemoveCV< typename RemoveReference<OT>::Type >::Type::ConstIterator  ConstIterator;
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the scaling assembly kernel.
+   //
+   // \param rhs The right-hand side scalar multiplication to be assigned.
+   */
+   explicit inline SparseAssembly( const MT2& rhs, size_t /*sizePerTask*/ )
+      : matrix_( Operand::evaluate( rhs.leftOperand() ) )  // The sparse matrix operand
+      , scalar_( rhs.rightOperand() )                      // The scalar value
+   {}
+   //**********************************************************************************************
+
+   //**Count function******************************************************************************
+   /*!\brief Computes the number of non-zero elements of the given range of rows/columns.
+   //
+   // \param begin The index of the first row/column of the range.
+   // \param end The index one past the last row/column of the range.
+   // \param nonzeros The resulting number of non-zero elements per row/column.
+   // \return void
+   */
+   inline void count( size_t begin, size_t end, size_t* nonzeros ) const {
+      for( size_t k=begin; k<end; ++k ) {
+         size_t nonZeros( 0UL );
+         const ConstIterator last( matrix_.end(k) );
+         for( ConstIterator element=matrix_.begin(k); element!=last; ++element )
+            ++nonZeros;
+         nonzeros[k-begin] = nonZeros;
+      }
+   }
+   //**********************************************************************************************
+
+   //**Fill function*******************************************************************************
+   /*!\brief Appends the elements of the given range of rows/columns to the target matrix.
+   //
+   // \param lhs The target sparse matrix.
+   // \param begin The index of the first row/column of the range.
+   // \param end The index one past the last row/column of the range.
+   // \return void
+   */
+   inline void fill( MT1& lhs, size_t begin, size_t end ) const {
+      for( size_t k=begin; k<end; ++k ) {
+         const ConstIterator last( matrix_.end(k) );
+         for( ConstIterator element=matrix_.begin(k); element!=last; ++element )
+            smpAppend( lhs, k, element->index(), element->value() * scalar_ );
+      }
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   OT matrix_;  //!< The sparse matrix operand.
+   ST scalar_;  //!< The scalar value.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,124 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/default/Reduction.h
+//  \brief Header file for the default SMP reduction of dense vectors and matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_DEFAULT_REDUCTION_H_
+#define _BLAZE_MATH_SMP_DEFAULT_REDUCTION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dense/Reduction.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Reduction SMP functions */
+//@{
+template< typename Op, typename VT, bool TF >
+inline typename VT::ElementType smpReduce( const DenseVector<VT,TF>& dv );
+
+template< typename Op, typename MT, bool SO >
+inline typename MT::ElementType smpReduce( const DenseMatrix<MT,SO>& dm );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The non-empty dense vector to be reduced.
+// \return The result of the reduction.
+//
+// This function implements the default SMP reduction of a dense vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reductions. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// according reduction function (as for instance sum() or max()).
+*/
+template< typename Op  // Type of the reduction operation
+        , typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename VT::ElementType smpReduce( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~dv).size() > 0UL, "Invalid vector size" );
+   return reduce<Op>( ~dv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The non-empty dense matrix to be reduced.
+// \return The result of the reduction.
+//
+// This function implements the default SMP reduction of a dense matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reductions. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// according reduction function (as for instance sum() or max()).
+*/
+template< typename Op  // Type of the reduction operation
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename MT::ElementType smpReduce( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~dm).rows() > 0UL && (~dm).columns() > 0UL, "Invalid matrix size" );
+   return reduce<Op>( ~dm );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -110,20 +110,20 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMajor
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t tasks      ( TheThreadBackend::size() * SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).rows() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare ( (~lhs).rows() / tasks + addon );
+   const size_t rest       ( equalShare & ( IT::size - 1UL ) );
+   const size_t rowsPerTask( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t row( i*rowsPerThread );
+      const size_t row( i*rowsPerTask );
 
       if( row >= (~lhs).rows() )
          continue;
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
+      const size_t m( min( rowsPerTask, (~lhs).rows() - row ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
@@ -185,20 +185,20 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,columnMa
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t tasks      ( TheThreadBackend::size() * SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).columns() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare ( (~lhs).columns() / tasks + addon );
+   const size_t rest       ( equalShare & ( IT::size - 1UL ) );
+   const size_t colsPerTask( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t column( i*colsPerThread );
+      const size_t column( i*colsPerTask );
 
       if( column >= (~lhs).columns() )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+      const size_t n( min( colsPerTask, (~lhs).columns() - column ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
@@ -254,18 +254,18 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowMajo
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~lhs).rows() / threads + addon );
+   const size_t tasks      ( TheThreadBackend::size() * SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).rows() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t rowsPerTask( (~lhs).rows() / tasks + addon );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t row( i*rowsPerThread );
+      const size_t row( i*rowsPerTask );
 
       if( row >= (~lhs).rows() )
          continue;
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
+      const size_t m( min( rowsPerTask, (~lhs).rows() - row ) );
       UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
       TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
    }
@@ -306,18 +306,18 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,columnM
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~lhs).columns() / threads + addon );
+   const size_t tasks      ( TheThreadBackend::size() * SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).columns() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t colsPerTask( (~lhs).columns() / tasks + addon );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t column( i*colsPerThread );
+      const size_t column( i*colsPerTask );
 
       if( column >= (~lhs).columns() )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+      const size_t n( min( colsPerTask, (~lhs).columns() - column ) );
       UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
       TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
    }
@@ -459,20 +459,20 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMa
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t tasks      ( TheThreadBackend::size() * SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).rows() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare ( (~lhs).rows() / tasks + addon );
+   const size_t rest       ( equalShare & ( IT::size - 1UL ) );
+   const size_t rowsPerTask( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t row( i*rowsPerThread );
+      const size_t row( i*rowsPerTask );
 
       if( row >= (~lhs).rows() )
          continue;
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
+      const size_t m( min( rowsPerTask, (~lhs).rows() - row ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
@@ -534,20 +534,20 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,colum
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t tasks      ( TheThreadBackend::size() * SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).columns() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare ( (~lhs).columns() / tasks + addon );
+   const size_t rest       ( equalShare & ( IT::size - 1UL ) );
+   const size_t colsPerTask( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t column( i*colsPerThread );
+      const size_t column( i*colsPerTask );
 
       if( column >= (~lhs).columns() )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+      const size_t n( min( colsPerTask, (~lhs).columns() - column ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
@@ -603,18 +603,18 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowM
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~lhs).rows() / threads + addon );
+   const size_t tasks      ( TheThreadBackend::size() * SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).rows() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t rowsPerTask( (~lhs).rows() / tasks + addon );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t row( i*rowsPerThread );
+      const size_t row( i*rowsPerTask );
 
       if( row >= (~lhs).rows() )
          continue;
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
+      const size_t m( min( rowsPerTask, (~lhs).rows() - row ) );
       UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
       TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
    }
@@ -655,18 +655,18 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,colu
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~lhs).columns() / threads + addon );
+   const size_t tasks      ( TheThreadBackend::size() * SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).columns() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t colsPerTask( (~lhs).columns() / tasks + addon );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t column( i*colsPerThread );
+      const size_t column( i*colsPerTask );
 
       if( column >= (~lhs).columns() )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+      const size_t n( min( colsPerTask, (~lhs).columns() - column ) );
       UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
       TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
    }
@@ -809,20 +809,20 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMa
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t tasks      ( TheThreadBackend::size() * SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).rows() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare ( (~lhs).rows() / tasks + addon );
+   const size_t rest       ( equalShare & ( IT::size - 1UL ) );
+   const size_t rowsPerTask( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t row( i*rowsPerThread );
+      const size_t row( i*rowsPerTask );
 
       if( row >= (~lhs).rows() )
          continue;
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
+      const size_t m( min( rowsPerTask, (~lhs).rows() - row ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
@@ -884,20 +884,20 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,colum
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t tasks      ( TheThreadBackend::size() * SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).columns() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare ( (~lhs).columns() / tasks + addon );
+   const size_t rest       ( equalShare & ( IT::size - 1UL ) );
+   const size_t colsPerTask( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t column( i*colsPerThread );
+      const size_t column( i*colsPerTask );
 
       if( column >= (~lhs).columns() )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+      const size_t n( min( colsPerTask, (~lhs).columns() - column ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
@@ -953,18 +953,18 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowM
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~lhs).rows() / threads + addon );
+   const size_t tasks      ( TheThreadBackend::size() * SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).rows() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t rowsPerTask( (~lhs).rows() / tasks + addon );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t row( i*rowsPerThread );
+      const size_t row( i*rowsPerTask );
 
       if( row >= (~lhs).rows() )
          continue;
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
+      const size_t m( min( rowsPerTask, (~lhs).rows() - row ) );
       UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
       TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
    }
@@ -1005,18 +1005,18 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,colu
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~lhs).columns() / threads + addon );
+   const size_t tasks      ( TheThreadBackend::size() * SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).columns() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t colsPerTask( (~lhs).columns() / tasks + addon );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t column( i*colsPerThread );
+      const size_t column( i*colsPerTask );
 
       if( column >= (~lhs).columns() )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+      const size_t n( min( colsPerTask, (~lhs).columns() - column ) );
       UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
       TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
    }
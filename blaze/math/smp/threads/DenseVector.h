@@ -109,20 +109,20 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& r
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t tasks      ( TheThreadBackend::size() * SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).size() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare ( (~lhs).size() / tasks + addon );
+   const size_t rest       ( equalShare & ( IT::size - 1UL ) );
+   const size_t sizePerTask( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( i*sizePerTask );
 
       if( index >= (~lhs).size() )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t size( min( sizePerTask, (~lhs).size() - index ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
@@ -179,18 +179,18 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>&
    typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const size_t tasks      ( TheThreadBackend::size() * SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).size() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t sizePerTask( (~lhs).size() / tasks + addon );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( i*sizePerTask );
 
       if( index >= (~lhs).size() )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t size( min( sizePerTask, (~lhs).size() - index ) );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
       TheThreadBackend::scheduleAssign( target, subvector<unaligned>( ~rhs, index, size ) );
    }
@@ -331,20 +331,20 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t tasks      ( TheThreadBackend::size() * SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).size() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare ( (~lhs).size() / tasks + addon );
+   const size_t rest       ( equalShare & ( IT::size - 1UL ) );
+   const size_t sizePerTask( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( i*sizePerTask );
 
       if( index >= (~lhs).size() )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t size( min( sizePerTask, (~lhs).size() - index ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
@@ -401,18 +401,18 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
    typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const size_t tasks      ( TheThreadBackend::size() * SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).size() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t sizePerTask( (~lhs).size() / tasks + addon );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( i*sizePerTask );
 
       if( index >= (~lhs).size() )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t size( min( sizePerTask, (~lhs).size() - index ) );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
       TheThreadBackend::scheduleAddAssign( target, subvector<unaligned>( ~rhs, index, size ) );
    }
@@ -554,20 +554,20 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t tasks      ( TheThreadBackend::size() * SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).size() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare ( (~lhs).size() / tasks + addon );
+   const size_t rest       ( equalShare & ( IT::size - 1UL ) );
+   const size_t sizePerTask( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( i*sizePerTask );
 
       if( index >= (~lhs).size() )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t size( min( sizePerTask, (~lhs).size() - index ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
@@ -624,18 +624,18 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
    typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const size_t tasks      ( TheThreadBackend::size() * SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).size() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t sizePerTask( (~lhs).size() / tasks + addon );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( i*sizePerTask );
 
       if( index >= (~lhs).size() )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t size( min( sizePerTask, (~lhs).size() - index ) );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
       TheThreadBackend::scheduleSubAssign( target, subvector<unaligned>( ~rhs, index, size ) );
    }
@@ -778,20 +778,20 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const size_t tasks      ( TheThreadBackend::size() * SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).size() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare ( (~lhs).size() / tasks + addon );
+   const size_t rest       ( equalShare & ( IT::size - 1UL ) );
+   const size_t sizePerTask( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( i*sizePerTask );
 
       if( index >= (~lhs).size() )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t size( min( sizePerTask, (~lhs).size() - index ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
@@ -848,18 +848,18 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF
    typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const size_t tasks      ( TheThreadBackend::size() * SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( (~lhs).size() % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t sizePerTask( (~lhs).size() / tasks + addon );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i<tasks; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( i*sizePerTask );
 
       if( index >= (~lhs).size() )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t size( min( sizePerTask, (~lhs).size() - index ) );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
       TheThreadBackend::scheduleMultAssign( target, subvector<unaligned>( ~rhs, index, size ) );
    }
@@ -0,0 +1,195 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/MultiAssign.h
+//  \brief Header file for the C++11/Boost thread-based SMP multi-assignment of dense vectors
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_THREADS_MULTIASSIGN_H_
+#define _BLAZE_MATH_SMP_THREADS_MULTIASSIGN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dense/MultiAssign.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  MULTI-ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Task for the fused evaluation of a range of dense vector updates.
+// \ingroup smp
+*/
+template< typename UT >  // Type of the update or batch
+class MultiAssignTask
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the MultiAssignTask class template.
+   //
+   // \param u The update or batch of updates to be evaluated.
+   // \param begin The index of the first element of the range.
+   // \param end The index one past the last element of the range.
+   */
+   explicit inline MultiAssignTask( const UT& u, size_t begin, size_t end )
+      : u_    ( &u    )  // The update or batch of updates to be evaluated
+      , begin_( begin )  // The index of the first element of the range
+      , end_  ( end   )  // The index one past the last element of the range
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Evaluates the updates for the range of elements.
+   //
+   // \return void
+   */
+   void operator()() const {
+      multiAssignRange( *u_, begin_, end_ );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   const UT* u_;   //!< The update or batch of updates to be evaluated.
+   size_t begin_;  //!< The index of the first element of the range.
+   size_t end_;    //!< The index one past the last element of the range.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP multi-assignment of dense vectors.
+// \ingroup smp
+//
+// \param u The update or batch of updates to be evaluated.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP
+// multi-assignment of dense vectors. The index range is split into contiguous parts, each
+// of which is shared by all updates of the batch.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of fused updates. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// multiAssign() functions.
+*/
+template< typename UT >  // Type of the update or batch
+void smpMultiAssign_backend( const UT& u )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef IntrinsicTrait<typename UT::ElementType>  IT;
+
+   const size_t n          ( u.size() );
+   const size_t tasks      ( TheThreadBackend::size() * SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( n % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare ( n / tasks + addon );
+   const size_t rest       ( equalShare & ( IT::size - 1UL ) );
+   const size_t sizePerTask( ( UT::vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+
+   for( size_t i=0UL; i<tasks; ++i )
+   {
+      const size_t begin( i*sizePerTask );
+
+      if( begin >= n )
+         break;
+
+      TheThreadBackend::scheduleTask( MultiAssignTask<UT>( u, begin, min( begin+sizePerTask, n ) ) );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP multi-assignment of dense vectors.
+// \ingroup smp
+//
+// \param u The update or batch of updates to be evaluated.
+// \return void
+//
+// This function implements the C++11/Boost thread-based SMP multi-assignment of dense vectors.
+// In case one of the updates is not SMP-assignable, in case the size of the target vectors is
+// below the SMP_DVECASSIGN_THRESHOLD, or in case the function is called within a serial or
+// parallel section, the updates are evaluated single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of fused updates. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// multiAssign() functions.
+*/
+template< typename UT >  // Type of the update or batch
+inline void smpMultiAssign( const UT& u )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !UT::smpAssignable || isSerialSectionActive() || isParallelSectionActive() ||
+       u.size() < SMP_DVECASSIGN_THRESHOLD ) {
+      multiAssignRange( u, 0UL, u.size() );
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      smpMultiAssign_backend( u );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,269 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/Reduction.h
+//  \brief Header file for the C++11/Boost thread-based SMP reduction of dense vectors and matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_THREADS_REDUCTION_H_
+#define _BLAZE_MATH_SMP_THREADS_REDUCTION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/dense/Reduction.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Task for the reduction of a range of reduction blocks.
+// \ingroup smp
+*/
+template< typename Op   // Type of the reduction operation
+        , typename T >  // Type of the dense vector or matrix
+class ReductionTask
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef typename T::ElementType  ElementType;  //!< Element type of the dense vector or matrix.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the ReductionTask class template.
+   //
+   // \param dx The dense vector or matrix to be reduced.
+   // \param begin The index of the first reduction block.
+   // \param end The index one past the last reduction block.
+   // \param partials The results of the reduction blocks.
+   */
+   explicit inline ReductionTask( const T& dx, size_t begin, size_t end, ElementType* partials )
+      : dx_      ( &dx      )  // The dense vector or matrix to be reduced
+      , begin_   ( begin    )  // The index of the first reduction block
+      , end_     ( end      )  // The index one past the last reduction block
+      , partials_( partials )  // The results of the reduction blocks
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Reduces the range of reduction blocks.
+   //
+   // \return void
+   */
+   void operator()() const {
+      for( size_t b=begin_; b<end_; ++b ) {
+         partials_[b] = reduceBlock<Op>( *dx_, b );
+      }
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   const T* dx_;            //!< The dense vector or matrix to be reduced.
+   size_t begin_;           //!< The index of the first reduction block.
+   size_t end_;             //!< The index one past the last reduction block.
+   ElementType* partials_;  //!< The results of the reduction blocks.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP reduction of a dense vector or matrix.
+// \ingroup smp
+//
+// \param dx The non-empty dense vector or matrix to be reduced.
+// \return The result of the reduction.
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP reduction of
+// a dense vector or matrix. The reduction blocks are distributed among the tasks and the results
+// of the blocks are combined in their original order. Therefore the result is identical to the
+// result of the single-threaded reduction.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reductions. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// according reduction function (as for instance sum() or max()).
+*/
+template< typename Op   // Type of the reduction operation
+        , typename T >  // Type of the dense vector or matrix
+typename T::ElementType smpReduce_backend( const T& dx )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   typedef typename T::ElementType  ET;
+
+   const size_t blocks     ( reductionBlocks( dx ) );
+   const size_t tasks      ( TheThreadBackend::size() * SMP_TASKS_PER_THREAD );
+   const size_t addon      ( ( ( blocks % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t sizePerTask( blocks / tasks + addon );
+
+   std::vector<ET> partials( blocks );
+
+   for( size_t i=0UL; i<tasks; ++i )
+   {
+      const size_t begin( i*sizePerTask );
+
+      if( begin >= blocks )
+         break;
+
+      TheThreadBackend::scheduleTask(
+         ReductionTask<Op,T>( dx, begin, min( begin+sizePerTask, blocks ), &partials[0] ) );
+   }
+
+   TheThreadBackend::wait();
+
+   ReductionCascade<Op,ET> cascade;
+   for( size_t b=0UL; b<blocks; ++b ) {
+      cascade.push( partials[b] );
+   }
+   return cascade.result();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The non-empty dense vector to be reduced.
+// \return The result of the reduction.
+//
+// This function implements the C++11/Boost thread-based SMP reduction of a dense vector. In case the size
+// of the vector is below the SMP_DVECREDUCE_THRESHOLD or in case the function is called within
+// a serial or parallel section, the reduction is executed single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reductions. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// according reduction function (as for instance sum() or max()).
+*/
+template< typename Op  // Type of the reduction operation
+        , typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline typename VT::ElementType smpReduce( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef typename VT::ElementType  ET;
+
+   BLAZE_INTERNAL_ASSERT( (~dv).size() > 0UL, "Invalid vector size" );
+
+   if( isSerialSectionActive() || isParallelSectionActive() ||
+       (~dv).size() < SMP_DVECREDUCE_THRESHOLD ) {
+      return reduce<Op>( ~dv );
+   }
+
+   ET result = ET();
+
+   BLAZE_PARALLEL_SECTION
+   {
+      result = smpReduce_backend<Op>( ~dv );
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The non-empty dense matrix to be reduced.
+// \return The result of the reduction.
+//
+// This function implements the C++11/Boost thread-based SMP reduction of a dense matrix. In case the number
+// of elements of the matrix is below the SMP_DMATREDUCE_THRESHOLD or in case the function is
+// called within a serial or parallel section, the reduction is executed single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reductions. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// according reduction function (as for instance sum() or max()).
+*/
+template< typename Op  // Type of the reduction operation
+        , typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline typename MT::ElementType smpReduce( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef typename MT::ElementType  ET;
+
+   BLAZE_INTERNAL_ASSERT( (~dm).rows() > 0UL && (~dm).columns() > 0UL, "Invalid matrix size" );
+
+   if( isSerialSectionActive() || isParallelSectionActive() ||
+       (~dm).rows() * (~dm).columns() < SMP_DMATREDUCE_THRESHOLD ) {
+      return reduce<Op>( ~dm );
+   }
+
+   ET result = ET();
+
+   BLAZE_PARALLEL_SECTION
+   {
+      result = smpReduce_backend<Op>( ~dm );
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
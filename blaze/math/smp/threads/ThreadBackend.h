@@ -75,7 +75,8 @@ namespace blaze {
 //
 // The ThreadBackend class template represents the backend system for the C++11 and Boost
 // thread-based parallelization. It provides the functionality to manage a pool of active
-// threads and to schedule (compound) assignment tasks for execution.\n
+// threads and to schedule (compound) assignment tasks, the evaluation of temporary blocks and
+// further internal computation tasks for execution.\n
 // This class must \b NOT be used explicitly! It is reserved for internal use only. Using
 // this class explicitly might result in erroneous results and/or in undefined behavior.
 */
@@ -109,6 +110,18 @@ class ThreadBackend
 
    template< typename Target, typename Source >
    static inline void scheduleMultAssign( Target& target, const Source& source );
+
+   template< typename Block, typename Source >
+   static inline void scheduleEvaluation( Block& block, const Source& source );
+
+   template< typename Block, typename Target, typename Source >
+   static inline void scheduleAddEvaluation( Block& block, const Target& target, const Source& source );
+
+   template< typename Block, typename Target, typename Source >
+   static inline void scheduleSubEvaluation( Block& block, const Target& target, const Source& source );
+
+   template< typename Task >
+   static inline void scheduleTask( const Task& task );
    //@}
    //**********************************************************************************************
 
@@ -277,6 +290,138 @@ class ThreadBackend
    };
    //**********************************************************************************************
 
+   //**Private class Evaluator*********************************************************************
+   /*!\brief Auxiliary functor for the threaded evaluation of an operand into a temporary block.
+   */
+   template< typename Block     // Type of the temporary block
+           , typename Source >  // Type of the source operand
+   struct Evaluator
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Evaluator class template.
+      //
+      // \param block The temporary block to be assigned to.
+      // \param source The source operand to be evaluated into the block.
+      */
+      explicit inline Evaluator( Block& block, const Source& source )
+         : block_ ( &block )  // The temporary block
+         , source_( source )  // The source operand
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Evaluates the source operand into the temporary block.
+      //
+      // \return void
+      */
+      inline void operator()() {
+         *block_ = serial( source_ );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Block*       block_;   //!< The temporary block.
+      const Source source_;  //!< The source operand.
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      BLAZE_CONSTRAINT_MUST_BE_EXPRESSION_TYPE( Source );
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class AddEvaluator******************************************************************
+   /*!\brief Auxiliary functor for the threaded evaluation of an addition into a temporary block.
+   */
+   template< typename Block     // Type of the temporary block
+           , typename Target    // Type of the target operand
+           , typename Source >  // Type of the source operand
+   struct AddEvaluator
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the AddEvaluator class template.
+      //
+      // \param block The temporary block to be assigned to.
+      // \param target The target operand to be evaluated into the block.
+      // \param source The source operand to be added to the block.
+      */
+      explicit inline AddEvaluator( Block& block, const Target& target, const Source& source )
+         : block_ ( &block )  // The temporary block
+         , target_( target )  // The target operand
+         , source_( source )  // The source operand
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Evaluates the sum of the target and source operand into the temporary block.
+      //
+      // \return void
+      */
+      inline void operator()() {
+         *block_  = serial( target_ );
+         *block_ += serial( source_ );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Block*       block_;   //!< The temporary block.
+      const Target target_;  //!< The target operand.
+      const Source source_;  //!< The source operand.
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      BLAZE_CONSTRAINT_MUST_BE_EXPRESSION_TYPE( Target );
+      BLAZE_CONSTRAINT_MUST_BE_EXPRESSION_TYPE( Source );
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class SubEvaluator******************************************************************
+   /*!\brief Auxiliary functor for the threaded evaluation of a subtraction into a temporary block.
+   */
+   template< typename Block     // Type of the temporary block
+           , typename Target    // Type of the target operand
+           , typename Source >  // Type of the source operand
+   struct SubEvaluator
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the SubEvaluator class template.
+      //
+      // \param block The temporary block to be assigned to.
+      // \param target The target operand to be evaluated into the block.
+      // \param source The source operand to be subtracted from the block.
+      */
+      explicit inline SubEvaluator( Block& block, const Target& target, const Source& source )
+         : block_ ( &block )  // The temporary block
+         , target_( target )  // The target operand
+         , source_( source )  // The source operand
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Evaluates the difference of the target and source operand into the temporary block.
+      //
+      // \return void
+      */
+      inline void operator()() {
+         *block_  = serial( target_ );
+         *block_ -= serial( source_ );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Block*       block_;   //!< The temporary block.
+      const Target target_;  //!< The target operand.
+      const Source source_;  //!< The source operand.
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      BLAZE_CONSTRAINT_MUST_BE_EXPRESSION_TYPE( Target );
+      BLAZE_CONSTRAINT_MUST_BE_EXPRESSION_TYPE( Source );
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
    //**Initialization functions********************************************************************
    /*!\name Initialization functions */
    //@{
@@ -498,6 +643,117 @@ inline void ThreadBackend<TT,MT,LT,CT>::scheduleMultAssign( Target& target, cons
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling the evaluation of the given operand into a temporary block for execution.
+//
+// \param block The temporary block to be assigned to.
+// \param source The source operand to be evaluated into the block.
+// \return void
+//
+// This function schedules the serial evaluation of the given operand into the given temporary
+// block for execution. The block has to stay valid until the scheduled task has been completed.
+*/
+template< typename TT        // Type of the encapsulated thread
+        , typename MT        // Type of the synchronization mutex
+        , typename LT        // Type of the mutex lock
+        , typename CT >      // Type of the condition variable
+template< typename Block     // Type of the temporary block
+        , typename Source >  // Type of the source operand
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleEvaluation( Block& block, const Source& source )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Block );
+   threadpool_.schedule( Evaluator<Block,Source>( block, source ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling the evaluation of an addition into a temporary block for execution.
+//
+// \param block The temporary block to be assigned to.
+// \param target The target operand to be evaluated into the block.
+// \param source The source operand to be added to the block.
+// \return void
+//
+// This function schedules the serial evaluation of the sum of the two given operands into the
+// given temporary block for execution. The block has to stay valid until the scheduled task
+// has been completed.
+*/
+template< typename TT        // Type of the encapsulated thread
+        , typename MT        // Type of the synchronization mutex
+        , typename LT        // Type of the mutex lock
+        , typename CT >      // Type of the condition variable
+template< typename Block     // Type of the temporary block
+        , typename Target    // Type of the target operand
+        , typename Source >  // Type of the source operand
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleAddEvaluation( Block& block, const Target& target,
+                                                                const Source& source )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Block );
+   threadpool_.schedule( AddEvaluator<Block,Target,Source>( block, target, source ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling the evaluation of a subtraction into a temporary block for execution.
+//
+// \param block The temporary block to be assigned to.
+// \param target The target operand to be evaluated into the block.
+// \param source The source operand to be subtracted from the block.
+// \return void
+//
+// This function schedules the serial evaluation of the difference of the two given operands
+// into the given temporary block for execution. The block has to stay valid until the scheduled
+// task has been completed.
+*/
+template< typename TT        // Type of the encapsulated thread
+        , typename MT        // Type of the synchronization mutex
+        , typename LT        // Type of the mutex lock
+        , typename CT >      // Type of the condition variable
+template< typename Block     // Type of the temporary block
+        , typename Target    // Type of the target operand
+        , typename Source >  // Type of the source operand
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleSubEvaluation( Block& block, const Target& target,
+                                                                const Source& source )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Block );
+   threadpool_.schedule( SubEvaluator<Block,Target,Source>( block, target, source ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling the given computation task for execution.
+//
+// \param task The computation task to be executed.
+// \return void
+//
+// This function schedules the given computation task for execution. The task is copied into the
+// thread pool and executed by means of its function call operator. It is the responsibility of
+// the task to restrict itself to a part of the computation that is independent of all other
+// concurrently executed tasks.
+*/
+template< typename TT      // Type of the encapsulated thread
+        , typename MT      // Type of the synchronization mutex
+        , typename LT      // Type of the mutex lock
+        , typename CT >    // Type of the condition variable
+template< typename Task >  // Type of the computation task
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleTask( const Task& task )
+{
+   threadpool_.schedule( task );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -0,0 +1,202 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/BiCGSTAB.h
+//  \brief Header file for the BiCGSTAB solver
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_BICGSTAB_H_
+#define _BLAZE_MATH_SOLVERS_BICGSTAB_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/problems/LSE.h>
+#include <blaze/math/solvers/Preconditioner.h>
+#include <blaze/math/solvers/Solver.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief A biconjugate gradient stabilized (BiCGSTAB) solver.
+// \ingroup lse_solvers
+//
+// The BiCGSTAB solver computes the solution of the linear system \f$ A \cdot x + b = 0 \f$ for
+// general, non-symmetric square system matrices. Each iteration requires two sparse matrix/vector
+// multiplications and, in contrast to GMRES, a constant amount of memory. The solution process
+// is terminated as soon as the maximum norm of the residual \f$ A \cdot x + b \f$ drops below
+// the threshold of the solver.
+//
+// Optionally, the BiCGSTAB solver can be combined with a preconditioner (see JacobiPreconditioner,
+// BlockJacobiPreconditioner and ICPreconditioner), which is applied from the right. The
+// preconditioner is not owned by the solver and has to outlive all subsequent calls to solve().
+// All helper vectors of the solver are kept between solution processes, i.e. repeatedly solving
+// systems of the same size does not allocate.
+
+   \code
+   blaze::BiCGSTAB solver;
+   blaze::JacobiPreconditioner jacobi;
+
+   solver.setPreconditioner( &jacobi );
+   solver.setThreshold( 1E-8 );
+   solver.solve( A, b, x );
+   \endcode
+*/
+class BiCGSTAB : public Solver
+{
+public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit BiCGSTAB();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline const Preconditioner* getPreconditioner() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Set functions*******************************************************************************
+   /*!\name Set functions */
+   //@{
+   inline void setPreconditioner( Preconditioner* preconditioner );
+   //@}
+   //**********************************************************************************************
+
+   //**Solver functions****************************************************************************
+   /*!\name Solver functions */
+   //@{
+   inline bool solve( LSE& lse );
+          bool solve( const CMatMxN& A, const VecN& b, VecN& x );
+   //@}
+   //**********************************************************************************************
+
+private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   VecN r_;                          //!< The residual vector.
+   VecN r0_;                         //!< The initial (shadow) residual vector.
+   VecN p_;                          //!< The search direction.
+   VecN v_;                          //!< The product of the system matrix and the search direction.
+   VecN s_;                          //!< The intermediate residual vector.
+   VecN t_;                          //!< The product of the system matrix and the intermediate residual.
+   VecN ph_;                         //!< The preconditioned search direction.
+   VecN sh_;                         //!< The preconditioned intermediate residual.
+   Preconditioner* preconditioner_;  //!< The (optional) preconditioner of the system matrix.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the preconditioner of the BiCGSTAB solver.
+//
+// \return The preconditioner of the BiCGSTAB solver (NULL in case no preconditioner is used).
+*/
+inline const Preconditioner* BiCGSTAB::getPreconditioner() const
+{
+   return preconditioner_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Sets the preconditioner of the BiCGSTAB solver.
+//
+// \param preconditioner The new preconditioner (NULL to disable preconditioning).
+// \return void
+//
+// The given preconditioner is not owned by the BiCGSTAB solver and has to outlive all subsequent
+// calls to solve().
+*/
+inline void BiCGSTAB::setPreconditioner( Preconditioner* preconditioner )
+{
+   preconditioner_ = preconditioner;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solves the given linear system of equations.
+//
+// \param lse The linear system of equations \f$ A \cdot x + b = 0 \f$.
+// \return \a true if the system was solved within accuracy, \a false if not.
+// \exception std::invalid_argument System matrix is not square.
+// \exception std::invalid_argument Invalid right-hand side vector size.
+*/
+inline bool BiCGSTAB::solve( LSE& lse )
+{
+   return solve( lse.A_, lse.b_, lse.x_ );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,103 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/BlockJacobiPreconditioner.h
+//  \brief Header file for the block Jacobi preconditioner
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_BLOCKJACOBIPRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_BLOCKJACOBIPRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/solvers/Preconditioner.h>
+#include <blaze/math/StaticMatrix.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief A 3x3 block Jacobi preconditioner.
+// \ingroup lse_solvers
+//
+// The block Jacobi preconditioner uses the inverses of the 3x3 diagonal blocks of the system
+// matrix, i.e. \f$ M = blockdiag(A) \f$. It is well suited for systems that couple three
+// unknowns per node, as for instance the stiffness matrices of three-dimensional elasticity
+// problems. In case the number of unknowns is not a multiple of three, the trailing unknowns
+// are treated by a scalar Jacobi preconditioner.
+*/
+class BlockJacobiPreconditioner : public Preconditioner
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit BlockJacobiPreconditioner();
+   //@}
+   //**********************************************************************************************
+
+   //**Preconditioner functions********************************************************************
+   /*!\name Preconditioner functions */
+   //@{
+   virtual void setup( const CMatMxN& A );
+   virtual void apply( const VecN& r, VecN& z ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef StaticMatrix<real,3UL,3UL,false>  Block;  //!< Type of the inverted diagonal blocks.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::vector<Block> blocks_;  //!< The inverted 3x3 diagonal blocks of the system matrix.
+   VecN inv_;                   //!< The inverse diagonal elements of the trailing unknowns.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
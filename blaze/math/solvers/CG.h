@@ -43,6 +43,7 @@
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/problems/LSE.h>
+#include <blaze/math/solvers/Preconditioner.h>
 #include <blaze/math/solvers/Solver.h>
 
 
@@ -60,6 +61,12 @@ namespace blaze {
 //
 // TODO: description
 // TODO: Problem formulation: \f$ A \cdot x + b = 0 \f$ !!
+//
+// Optionally, the CG solver can be combined with a preconditioner (see JacobiPreconditioner,
+// BlockJacobiPreconditioner and ICPreconditioner), which is set up once per solution process
+// and applied once per iteration. The preconditioner is not owned by the solver and has to
+// outlive all subsequent calls to solve(). All helper vectors of the solver are kept between
+// solution processes, i.e. repeatedly solving systems of the same size does not allocate.
 */
 class CG : public Solver
 {
@@ -71,6 +78,22 @@ public:
    //@}
    //**********************************************************************************************
 
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline const Preconditioner* getPreconditioner() const;
+   inline bool                  getSymmetryCheck () const;
+   //@}
+   //**********************************************************************************************
+
+   //**Set functions*******************************************************************************
+   /*!\name Set functions */
+   //@{
+   inline void setPreconditioner( Preconditioner* preconditioner );
+   inline void setSymmetryCheck ( bool check );
+   //@}
+   //**********************************************************************************************
+
    //**Solver functions****************************************************************************
    /*!\name Solver functions */
    //@{
@@ -83,9 +106,12 @@ private:
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   VecN r_;  //!< TODO
-   VecN d_;  //!< TODO
-   VecN h_;  //!< TODO
+   VecN r_;                          //!< The residual vector.
+   VecN d_;                          //!< The search direction.
+   VecN h_;                          //!< The product of the system matrix and the search direction.
+   VecN z_;                          //!< The preconditioned residual vector.
+   Preconditioner* preconditioner_;  //!< The (optional) preconditioner of the system matrix.
+   bool symmetryCheck_;              //!< Flag for the symmetry check of the system matrix.
    //@}
    //**********************************************************************************************
 };
@@ -94,6 +120,79 @@ private:
 
 
 
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the preconditioner of the CG solver.
+//
+// \return The preconditioner of the CG solver (NULL in case no preconditioner is used).
+*/
+inline const Preconditioner* CG::getPreconditioner() const
+{
+   return preconditioner_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the system matrix is checked for symmetry.
+//
+// \return \a true if the symmetry check is active, \a false if not.
+*/
+inline bool CG::getSymmetryCheck() const
+{
+   return symmetryCheck_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Sets the preconditioner of the CG solver.
+//
+// \param preconditioner The new preconditioner (NULL to disable preconditioning).
+// \return void
+//
+// The given preconditioner is not owned by the CG solver and has to outlive all subsequent calls
+// to solve().
+*/
+inline void CG::setPreconditioner( Preconditioner* preconditioner )
+{
+   preconditioner_ = preconditioner;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Activates or deactivates the symmetry check of the system matrix.
+//
+// \param check \a true to activate the symmetry check, \a false to deactivate it.
+// \return void
+//
+// By default, the CG solver checks every system matrix for symmetry, which requires a complete
+// traversal of the matrix. In case the symmetry of the system matrix is guaranteed by other
+// means, the check can be deactivated.
+*/
+inline void CG::setSymmetryCheck( bool check )
+{
+   symmetryCheck_ = check;
+}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  SOLVER FUNCTIONS
@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/BlockCompressedMatrix.h>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/Functions.h>
@@ -69,6 +70,9 @@ namespace blaze {
 // TODO: description of the CPG solver
 // TODO: capabilities of the CPG solver (which LCP problems, etc)
 // TODO: known issues of the CPG solver
+//
+// For contact LCPs, the LCP matrix is converted into a block compressed matrix with 3x3 blocks,
+// which is used for all matrix/vector products of the solver.
 */
 class CPG : public Solver
 {
@@ -88,13 +92,23 @@ class CPG : public Solver
    //**********************************************************************************************
 
  private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename CP > inline void setup  ( const CP& cp );
+   template< typename CP > inline void product( const CP& cp, const VecN& x, VecN& y ) const;
+   //@}
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
    VecN                r_;         //!< TODO
    VecN                w_;         //!< TODO
    VecN                p_;         //!< TODO
+   VecN                q_;         //!< The product of the LCP matrix and the descent direction.
    DynamicVector<int>  activity_;  //!< TODO
+   BlockCompressedMatrix<real,3UL> blockA_;  //!< The 3x3 block copy of the LCP matrix (contact LCPs only).
    //@}
    //**********************************************************************************************
 };
@@ -121,8 +135,7 @@ template< typename CP >  // Type of the complementarity problem
 bool CPG::solve( CP& cp )
 {
    const size_t n( cp.size() );
-   const CMatMxN& A( cp.A_ );
-   const VecN&    b( cp.b_ );
+   const VecN& b( cp.b_ );
 
    bool converged( false );
    VecN& x( cp.x_ );
@@ -131,14 +144,18 @@ bool CPG::solve( CP& cp )
    real beta( 0 ),  beta_nom( 0 ),  beta_denom( 0 );
    real tmp( 0 );
 
-   BLAZE_INTERNAL_ASSERT( isSymmetric( A ), "The CPG solver requires that the system matrix is symmetric" );
+   BLAZE_INTERNAL_ASSERT( isSymmetric( cp.A_ ), "The CPG solver requires that the system matrix is symmetric" );
 
    // Allocating helper data
    r_.resize( n, false );
    w_.resize( n, false );
    p_.resize( n, false );
+   q_.resize( n, false );
    activity_.resize( n, false );
 
+   // Setting up the block representation of the LCP matrix
+   setup( cp );
+
    // Determining activity and project initial solution to feasible region
    for( size_t i=0; i<n; ++i ) {
       if( x[i] <= cp.lbound( i ) ) {
@@ -169,7 +186,8 @@ bool CPG::solve( CP& cp )
    for( ; !converged && it < maxIterations_; ++it )
    {
       // Computing the steepest descent direction
-      r_ = -( A*x + b );
+      product( cp, x, r_ );
+      r_ = -( r_ + b );
 
       // Projecting the gradient and the previous descent direction
       beta_nom = real(0);
@@ -204,7 +222,8 @@ bool CPG::solve( CP& cp )
 
       // Finding the minimum along the descent direction p
       alpha_nom   = trans(r_) * p_;
-      alpha_denom = trans(p_) * A * p_;
+      product( cp, p_, q_ );
+      alpha_denom = trans(p_) * q_;
 
       if( alpha_denom == 0 )
          // In case p^T A p is zero, no reduction of the objective function can be obtained
@@ -279,6 +298,66 @@ bool CPG::solve( CP& cp )
 }
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*!\brief Sets up the solver specific representation of the LCP matrix.
+//
+// \param cp The complementarity problem to solve.
+// \return void
+//
+// Per default, the CPG solver works directly on the scalar LCP matrix, i.e. no setup is required.
+*/
+template< typename CP >  // Type of the complementarity problem
+inline void CPG::setup( const CP& /*cp*/ )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Converts the LCP matrix of the given contact LCP into 3x3 blocks.
+//
+// \param cp The contact LCP to solve.
+// \return void
+*/
+template<>
+inline void CPG::setup( const ContactLCP& cp )
+{
+   blockA_ = cp.A_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the product of the LCP matrix and the given vector (\f$ y = A x \f$).
+//
+// \param cp The complementarity problem to solve.
+// \param x The right-hand side vector.
+// \param y The resulting vector.
+// \return void
+*/
+template< typename CP >  // Type of the complementarity problem
+inline void CPG::product( const CP& cp, const VecN& x, VecN& y ) const
+{
+   y = cp.A_ * x;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the product of the 3x3 block LCP matrix and the given vector (\f$ y = A x \f$).
+//
+// \param cp The contact LCP to solve.
+// \param x The right-hand side vector.
+// \param y The resulting vector.
+// \return void
+*/
+template<>
+inline void CPG::product( const ContactLCP& /*cp*/, const VecN& x, VecN& y ) const
+{
+   multiply( y, blockA_, x );
+}
+//*************************************************************************************************
+
+
 
 
 
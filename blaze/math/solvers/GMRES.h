@@ -0,0 +1,227 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/GMRES.h
+//  \brief Header file for the restarted GMRES solver
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_GMRES_H_
+#define _BLAZE_MATH_SOLVERS_GMRES_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/problems/LSE.h>
+#include <blaze/math/solvers/Preconditioner.h>
+#include <blaze/math/solvers/Solver.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief A restarted generalized minimal residual (GMRES(m)) solver.
+// \ingroup lse_solvers
+//
+// The GMRES solver computes the solution of the linear system \f$ A \cdot x + b = 0 \f$ for
+// general, non-symmetric square system matrices. In each cycle, the solver builds an orthonormal
+// basis of a Krylov subspace of at most \a m dimensions via the modified Gram-Schmidt Arnoldi
+// process and minimizes the Euclidean norm of the residual over this subspace. After \a m
+// iterations the cycle is restarted with the current approximation (see setRestart()). Each
+// iteration requires a single sparse matrix/vector multiplication, the basis requires the
+// memory of \a m+1 vectors.
+//
+// The Euclidean norm of the residual that is available for free during a cycle is used to end
+// a cycle early. The solution process is terminated as soon as the maximum norm of the explicitly
+// computed residual \f$ A \cdot x + b \f$ at the beginning of a cycle drops below the threshold
+// of the solver.
+//
+// Optionally, the GMRES solver can be combined with a preconditioner (see JacobiPreconditioner,
+// BlockJacobiPreconditioner and ICPreconditioner), which is applied from the right. The
+// preconditioner is not owned by the solver and has to outlive all subsequent calls to solve().
+// All helper data of the solver is kept between solution processes, i.e. repeatedly solving
+// systems of the same size does not allocate.
+
+   \code
+   blaze::GMRES solver;
+
+   solver.setRestart( 50UL );
+   solver.setThreshold( 1E-8 );
+   solver.solve( A, b, x );
+   \endcode
+*/
+class GMRES : public Solver
+{
+public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit GMRES( size_t restart=30UL );
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline const Preconditioner* getPreconditioner() const;
+   inline size_t                getRestart       () const;
+   //@}
+   //**********************************************************************************************
+
+   //**Set functions*******************************************************************************
+   /*!\name Set functions */
+   //@{
+   inline void setPreconditioner( Preconditioner* preconditioner );
+          void setRestart       ( size_t restart );
+   //@}
+   //**********************************************************************************************
+
+   //**Solver functions****************************************************************************
+   /*!\name Solver functions */
+   //@{
+   inline bool solve( LSE& lse );
+          bool solve( const CMatMxN& A, const VecN& b, VecN& x );
+   //@}
+   //**********************************************************************************************
+
+private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t restart_;                  //!< The maximum dimension of the Krylov subspace of a cycle.
+   std::vector<VecN> V_;             //!< The orthonormal basis of the Krylov subspace.
+   MatMxN H_;                        //!< The Hessenberg matrix of the Arnoldi process.
+   VecN cs_;                         //!< The cosines of the Givens rotations.
+   VecN sn_;                         //!< The sines of the Givens rotations.
+   VecN g_;                          //!< The rotated right-hand side of the least squares problem.
+   VecN y_;                          //!< The solution of the least squares problem.
+   VecN r_;                          //!< The residual vector.
+   VecN w_;                          //!< The new basis vector of the Arnoldi process.
+   VecN z_;                          //!< The preconditioned basis vector.
+   Preconditioner* preconditioner_;  //!< The (optional) preconditioner of the system matrix.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the preconditioner of the GMRES solver.
+//
+// \return The preconditioner of the GMRES solver (NULL in case no preconditioner is used).
+*/
+inline const Preconditioner* GMRES::getPreconditioner() const
+{
+   return preconditioner_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum dimension of the Krylov subspace of a single cycle.
+//
+// \return The number of iterations after which the GMRES solver is restarted.
+*/
+inline size_t GMRES::getRestart() const
+{
+   return restart_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Sets the preconditioner of the GMRES solver.
+//
+// \param preconditioner The new preconditioner (NULL to disable preconditioning).
+// \return void
+//
+// The given preconditioner is not owned by the GMRES solver and has to outlive all subsequent
+// calls to solve().
+*/
+inline void GMRES::setPreconditioner( Preconditioner* preconditioner )
+{
+   preconditioner_ = preconditioner;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solves the given linear system of equations.
+//
+// \param lse The linear system of equations \f$ A \cdot x + b = 0 \f$.
+// \return \a true if the system was solved within accuracy, \a false if not.
+// \exception std::invalid_argument System matrix is not square.
+// \exception std::invalid_argument Invalid right-hand side vector size.
+*/
+inline bool GMRES::solve( LSE& lse )
+{
+   return solve( lse.A_, lse.b_, lse.x_ );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
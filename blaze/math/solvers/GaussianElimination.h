@@ -44,6 +44,7 @@
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/problems/LSE.h>
+#include <blaze/math/solvers/LUDecomposition.h>
 #include <blaze/math/solvers/Solver.h>
 
 
@@ -61,6 +62,11 @@ namespace blaze {
 //
 // TODO: description
 // TODO: Problem formulation: \f$ A \cdot x + b = 0 \f$ !!
+//
+// The system matrix is factorized via a blocked LU decomposition with partial pivoting (see
+// LUDecomposition). The decomposition of the last solved system remains available via
+// getDecomposition() and can be used to solve the same system for further right-hand sides
+// without refactorization.
 */
 class GaussianElimination : public Solver
 {
@@ -72,6 +78,13 @@ class GaussianElimination : public Solver
    //@}
    //**********************************************************************************************
 
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline const LUDecomposition& getDecomposition() const;
+   //@}
+   //**********************************************************************************************
+
    //**Solver functions****************************************************************************
    /*!\name Solver functions */
    //@{
@@ -84,8 +97,8 @@ class GaussianElimination : public Solver
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   MatMxN A_;  //!< TODO
-   VecN   b_;  //!< TODO
+   LUDecomposition lu_;  //!< The LU decomposition of the system matrix.
+   VecN            b_;   //!< The negative right-hand side vector.
    //@}
    //**********************************************************************************************
 };
@@ -94,6 +107,30 @@ class GaussianElimination : public Solver
 
 
 
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the LU decomposition of the last solved system.
+//
+// \return The LU decomposition of the system matrix of the last solved system.
+//
+// The decomposition can be used to solve the last system for further right-hand sides. Note
+// that the decomposition solves \f$ A x = b \f$, i.e. the right-hand sides have to be negated
+// with respect to the problem formulation of the solver.
+*/
+inline const LUDecomposition& GaussianElimination::getDecomposition() const
+{
+   return lu_;
+}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  SOLVER FUNCTIONS
@@ -0,0 +1,131 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/ICPreconditioner.h
+//  \brief Header file for the incomplete Cholesky preconditioner
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_ICPRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_ICPRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/solvers/Preconditioner.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief An incomplete Cholesky preconditioner without fill-in.
+// \ingroup lse_solvers
+//
+// The IC(0) preconditioner computes a lower triangular matrix \f$ L \f$ with the sparsity pattern
+// of the lower part of the symmetric system matrix such that \f$ L L^T \approx A \f$. Since the
+// incomplete factorization of a symmetric positive definite matrix may break down, the diagonal
+// of the system matrix is shifted by an increasing amount until the factorization succeeds.
+*/
+class ICPreconditioner : public Preconditioner
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ICPreconditioner();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline real getShift() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Preconditioner functions********************************************************************
+   /*!\name Preconditioner functions */
+   //@{
+   virtual void setup( const CMatMxN& A );
+   virtual void apply( const VecN& r, VecN& z ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   bool factorize( const CMatMxN& A, real shift );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   CMatMxN L_;    //!< The incomplete Cholesky factor of the system matrix.
+   VecN diag_;    //!< The inverse diagonal elements of the incomplete Cholesky factor.
+   real shift_;   //!< The relative diagonal shift used for the last factorization.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the relative diagonal shift used for the last factorization.
+//
+// \return The relative diagonal shift (0 in case no shift was necessary).
+*/
+inline real ICPreconditioner::getShift() const
+{
+   return shift_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,417 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/LUDecomposition.h
+//  \brief Header file for the LU decomposition
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_LUDECOMPOSITION_H_
+#define _BLAZE_MATH_SOLVERS_LUDECOMPOSITION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include <blaze/math/Accuracy.h>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DenseSubmatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Dense LU decomposition with partial pivoting.
+// \ingroup lse_solvers
+//
+// The LUDecomposition class computes the factorization \f$ P A = L U \f$ of a square matrix,
+// where \f$ P \f$ is a row permutation, \f$ L \f$ is a unit lower triangular matrix and \f$ U \f$
+// is an upper triangular matrix. Factorization and solution are separated, i.e. a single
+// factorization can be reused for an arbitrary number of right-hand sides:
+
+   \code
+   blaze::LUDecomposition lu;
+   lu.factorize( A );
+
+   lu.solve( b1, x1 );  // Solving A x1 = b1
+   lu.solve( b2, x2 );  // Solving A x2 = b2
+   lu.solve( B, X );    // Solving A X = B for all columns of B at once
+   \endcode
+
+// The factorization is computed by a right-looking blocked algorithm: The columns of the matrix
+// are processed in panels of \a blockSize columns. After the factorization of a panel, the
+// according rows of \f$ U \f$ are computed and the trailing submatrix is updated by a single
+// dense matrix multiplication, which is executed via the active shared-memory parallelization
+// backend. In case a pivot is zero, the according column of \f$ L \f$ is left zero and the
+// matrix is reported as singular. The solution of a singular system sets all unknowns of
+// singular rows to zero.
+//
+// The factorization and substitution kernels are also available for other element types via
+// the luDecompose() and luSolve() functions (see for instance MixedPrecisionRefinement, which
+// factorizes a single precision copy of the system matrix).
+*/
+class LUDecomposition
+{
+ public:
+   //**Compilation flags***************************************************************************
+   //! The number of columns of a single panel of the blocked factorization.
+   enum { blockSize = 64 };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit LUDecomposition();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline size_t        size()       const;
+   inline bool          isSingular() const;
+   inline const MatMxN& getFactors() const;
+   inline size_t        getPivot( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Factorization functions*********************************************************************
+   /*!\name Factorization functions */
+   //@{
+   void factorize( const MatMxN& A );
+   void factorize( const CMatMxN& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Solver functions****************************************************************************
+   /*!\name Solver functions */
+   //@{
+   void solve( const VecN& b, VecN& x ) const;
+   void solve( const MatMxN& B, MatMxN& X ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MatMxN LU_;                //!< The combined factors \f$ L \f$ (strictly lower part) and \f$ U \f$.
+   std::vector<size_t> p_;    //!< The row permutation: row \a i of \f$ P A \f$ is row \a p_[i] of \f$ A \f$.
+   MatMxN L21_;               //!< Copy of the current panel of \f$ L \f$ below the diagonal block.
+   MatMxN U12_;               //!< Copy of the current block row of \f$ U \f$ right of the diagonal block.
+   bool singular_;            //!< Flag for a singular matrix.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows and columns of the factorized matrix.
+//
+// \return The size of the factorized matrix.
+*/
+inline size_t LUDecomposition::size() const
+{
+   return LU_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the factorized matrix is singular.
+//
+// \return \a true in case a pivot is zero or below the accuracy, \a false if not.
+*/
+inline bool LUDecomposition::isSingular() const
+{
+   return singular_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the combined factors of the LU decomposition.
+//
+// \return The unit lower triangular factor \f$ L \f$ (without the diagonal) and the upper
+//         triangular factor \f$ U \f$ stored in a single matrix.
+*/
+inline const MatMxN& LUDecomposition::getFactors() const
+{
+   return LU_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the row of the factorized matrix that is pivoted to the given row.
+//
+// \param i The index of the row of \f$ P A \f$ \f$[0..size()-1]\f$.
+// \return The according row of the factorized matrix \f$ A \f$.
+*/
+inline size_t LUDecomposition::getPivot( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < p_.size(), "Invalid row access index" );
+   return p_[i];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LU DECOMPOSITION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unblocked LU decomposition with partial pivoting of a single panel.
+// \ingroup lse_solvers
+//
+// \param LU The matrix to be factorized.
+// \param p The row permutation.
+// \param k The index of the first column of the panel.
+// \param kb The number of columns of the panel.
+// \return void
+//
+// This function factorizes the columns \f$ [k..k+kb) \f$ of all rows \f$ [k..n) \f$. The pivot
+// of each column is the element of largest magnitude on or below the diagonal. The according
+// complete rows of the matrix are swapped. In case the pivot is zero, the column is already
+// eliminated and the according column of \f$ L \f$ is left zero.
+*/
+template< typename Type >  // Element type of the factorized matrix
+void luPanel( DynamicMatrix<Type,rowMajor>& LU, std::vector<size_t>& p, size_t k, size_t kb )
+{
+   const size_t n ( LU.rows() );
+   const size_t k2( k+kb );
+
+   for( size_t j=k; j<k2; ++j )
+   {
+      // Partial search for pivot
+      size_t pivot( j );
+      Type maxval( std::fabs( LU(j,j) ) );
+
+      for( size_t i=j+1UL; i<n; ++i ) {
+         if( std::fabs( LU(i,j) ) > maxval ) {
+            pivot  = i;
+            maxval = std::fabs( LU(i,j) );
+         }
+      }
+
+      // Swapping rows such that the pivot lies on the diagonal
+      if( pivot != j ) {
+         std::swap_ranges( LU.data(pivot), LU.data(pivot)+n, LU.data(j) );
+         std::swap( p[pivot], p[j] );
+      }
+
+      if( isDefault( LU(j,j) ) ) {
+         for( size_t i=j+1UL; i<n; ++i ) {
+            BLAZE_INTERNAL_ASSERT( isDefault( LU(i,j) ), "Fatal error in LU decomposition" );
+         }
+         continue;
+      }
+
+      // Eliminating the column below the diagonal within the panel
+      const Type inv( Type(1) / LU(j,j) );
+      const Type* const u( LU.data(j) );
+
+      for( size_t i=j+1UL; i<n; ++i )
+      {
+         Type* const a( LU.data(i) );
+
+         if( isDefault( a[j] ) ) continue;
+
+         a[j] *= inv;
+         for( size_t l=j+1UL; l<k2; ++l )
+            a[l] -= a[j] * u[l];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked in-place LU decomposition with partial pivoting.
+// \ingroup lse_solvers
+//
+// \param LU The square matrix to be factorized, on exit the combined factors.
+// \param p The resulting row permutation.
+// \param L21 Workspace for the current panel of \f$ L \f$.
+// \param U12 Workspace for the current block row of \f$ U \f$.
+// \return \a true in case the matrix is singular, \a false if not.
+//
+// For each panel of LUDecomposition::blockSize columns, the panel is factorized via an unblocked
+// elimination with partial pivoting (see luPanel()). Afterwards the according block row of
+// \f$ U \f$ is computed by a forward substitution with the unit lower triangular diagonal block
+// and the trailing submatrix is updated via \f$ A_{22} -= L_{21} U_{12} \f$. The two operands of
+// the update are copied in order to avoid the aliasing with the updated submatrix.
+*/
+template< typename Type >  // Element type of the factorized matrix
+bool luDecompose( DynamicMatrix<Type,rowMajor>& LU, std::vector<size_t>& p,
+                  DynamicMatrix<Type,rowMajor>& L21, DynamicMatrix<Type,rowMajor>& U12 )
+{
+   const size_t n( LU.rows() );
+
+   BLAZE_USER_ASSERT( LU.columns() == n, "Non-square matrix detected" );
+
+   p.resize( n );
+   for( size_t i=0UL; i<n; ++i ) {
+      p[i] = i;
+   }
+
+   for( size_t k=0UL; k<n; k+=LUDecomposition::blockSize )
+   {
+      const size_t kb( std::min( size_t( LUDecomposition::blockSize ), n-k ) );
+      const size_t k2( k+kb );
+      const size_t m ( n-k2 );
+
+      // Factorizing the current panel
+      luPanel( LU, p, k, kb );
+
+      if( m == 0UL ) break;
+
+      // Computing the block row of U (U12 = L11^{-1} A12)
+      for( size_t i=k+1UL; i<k2; ++i )
+      {
+         Type* const a( LU.data(i) );
+
+         for( size_t j=k; j<i; ++j ) {
+            if( isDefault( a[j] ) ) continue;
+            const Type* const u( LU.data(j) );
+            for( size_t l=k2; l<n; ++l )
+               a[l] -= a[j] * u[l];
+         }
+      }
+
+      // Updating the trailing submatrix (A22 -= L21 U12)
+      L21 = submatrix( LU, k2, k, m, kb );
+      U12 = submatrix( LU, k, k2, kb, m );
+      submatrix( LU, k2, k2, m, m ) -= L21 * U12;
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( !( std::fabs( LU(i,i) ) > accuracy ) )
+         return true;
+   }
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Solves the linear system \f$ A x = b \f$ with the LU factors of \f$ A \f$.
+// \ingroup lse_solvers
+//
+// \param LU The combined LU factors of the system matrix (see luDecompose()).
+// \param p The row permutation of the factorization.
+// \param b The right-hand side vector.
+// \param x The resulting solution vector.
+// \return void
+//
+// The system is solved by a forward substitution with \f$ L \f$ and a backward substitution
+// with \f$ U \f$. Unknowns of singular rows, i.e. rows with a diagonal element of \f$ U \f$
+// below the accuracy, are set to zero. \a b and \a x must not refer to the same vector.
+*/
+template< typename Type >  // Element type of the factors and vectors
+void luSolve( const DynamicMatrix<Type,rowMajor>& LU, const std::vector<size_t>& p,
+              const DynamicVector<Type,columnVector>& b, DynamicVector<Type,columnVector>& x )
+{
+   const size_t n( LU.rows() );
+
+   BLAZE_INTERNAL_ASSERT( &b != &x, "Aliasing of the right-hand side and the solution detected" );
+   BLAZE_USER_ASSERT( b.size() == n, "Invalid right-hand side vector size" );
+
+   x.resize( n, false );
+
+   // Performing the forward substitution (L y = P b)
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const Type* const lu( LU.data(i) );
+      Type rhs( b[p[i]] );
+
+      for( size_t j=0UL; j<i; ++j ) {
+         rhs -= lu[j] * x[j];
+      }
+
+      x[i] = rhs;
+   }
+
+   // Performing the backward substitution (U x = y)
+   for( size_t i=n-1UL; i<n; --i )
+   {
+      const Type* const lu( LU.data(i) );
+      Type rhs( x[i] );
+
+      for( size_t j=i+1UL; j<n; ++j ) {
+         rhs -= lu[j] * x[j];
+      }
+
+      if( std::fabs( lu[i] ) > accuracy )
+         x[i] = rhs / lu[i];
+      else
+         reset( x[i] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
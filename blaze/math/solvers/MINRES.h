@@ -0,0 +1,193 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/MINRES.h
+//  \brief Header file for the MINRES solver
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_MINRES_H_
+#define _BLAZE_MATH_SOLVERS_MINRES_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/problems/LSE.h>
+#include <blaze/math/solvers/Solver.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief A minimal residual (MINRES) solver.
+// \ingroup lse_solvers
+//
+// The MINRES solver computes the solution of the linear system \f$ A \cdot x + b = 0 \f$ for
+// symmetric, but possibly indefinite system matrices (e.g. saddle point problems), for which
+// the CG solver may break down. It combines the short recurrences of the Lanczos process with
+// Givens rotations to minimize the Euclidean norm of the residual, i.e. in contrast to GMRES
+// it requires only a constant amount of memory. Each iteration requires a single sparse
+// matrix/vector multiplication.
+//
+// The Euclidean norm of the residual that is available from the recurrences is used to end the
+// iterations early. The resulting precision is the maximum norm of the explicitly computed final
+// residual \f$ A \cdot x + b \f$. All helper vectors of the solver are kept between solution
+// processes, i.e. repeatedly solving systems of the same size does not allocate.
+*/
+class MINRES : public Solver
+{
+public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit MINRES();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline bool getSymmetryCheck() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Set functions*******************************************************************************
+   /*!\name Set functions */
+   //@{
+   inline void setSymmetryCheck( bool check );
+   //@}
+   //**********************************************************************************************
+
+   //**Solver functions****************************************************************************
+   /*!\name Solver functions */
+   //@{
+   inline bool solve( LSE& lse );
+          bool solve( const CMatMxN& A, const VecN& b, VecN& x );
+   //@}
+   //**********************************************************************************************
+
+private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   VecN r1_;             //!< The second to last Lanczos vector (unnormalized).
+   VecN r2_;             //!< The last Lanczos vector (unnormalized).
+   VecN y_;              //!< The product of the system matrix and the current Lanczos vector.
+   VecN v_;              //!< The current (normalized) Lanczos vector.
+   VecN w_;              //!< The current search direction.
+   VecN w1_;             //!< The second to last search direction.
+   VecN w2_;             //!< The last search direction.
+   bool symmetryCheck_;  //!< Flag for the symmetry check of the system matrix.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the system matrix is checked for symmetry.
+//
+// \return \a true if the symmetry check is active, \a false if not.
+*/
+inline bool MINRES::getSymmetryCheck() const
+{
+   return symmetryCheck_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Activates or deactivates the symmetry check of the system matrix.
+//
+// \param check \a true to activate the symmetry check, \a false to deactivate it.
+// \return void
+//
+// By default, the MINRES solver checks every system matrix for symmetry, which requires a
+// complete traversal of the matrix. In case the symmetry of the system matrix is guaranteed by
+// other means, the check can be deactivated.
+*/
+inline void MINRES::setSymmetryCheck( bool check )
+{
+   symmetryCheck_ = check;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solves the given linear system of equations.
+//
+// \param lse The linear system of equations \f$ A \cdot x + b = 0 \f$.
+// \return \a true if the system was solved within accuracy, \a false if not.
+// \exception std::invalid_argument System matrix is not square.
+// \exception std::invalid_argument System matrix is not symmetric.
+// \exception std::invalid_argument Invalid right-hand side vector size.
+*/
+inline bool MINRES::solve( LSE& lse )
+{
+   return solve( lse.A_, lse.b_, lse.x_ );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
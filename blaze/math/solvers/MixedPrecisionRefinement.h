@@ -0,0 +1,217 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/MixedPrecisionRefinement.h
+//  \brief Header file for the mixed precision iterative refinement solver
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_MIXEDPRECISIONREFINEMENT_H_
+#define _BLAZE_MATH_SOLVERS_MIXEDPRECISIONREFINEMENT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/problems/LSE.h>
+#include <blaze/math/solvers/LUDecomposition.h>
+#include <blaze/math/solvers/Solver.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Mixed precision iterative refinement solver for dense linear systems.
+// \ingroup lse_solvers
+//
+// The MixedPrecisionRefinement solver computes the solution of the linear system
+// \f$ A \cdot x + b = 0 \f$ by means of a single precision LU decomposition of the system
+// matrix (see LUDecomposition), which requires half the memory bandwidth and processes twice
+// as many elements per SIMD operation as a factorization in double precision. The accuracy of
+// the solution is recovered by iterative refinement: In each iteration, the residual
+// \f$ r = A \cdot x + b \f$ is computed in the precision of \a blaze::real, the correction
+// \f$ A \cdot d = r \f$ is solved with the single precision factors and the solution is updated
+// via \f$ x -= d \f$. The iterations are stopped as soon as the maximum norm of the residual
+// drops below the threshold of the solver.
+//
+// In case the single precision factorization is singular or the refinement stagnates, i.e. an
+// iteration does not reduce the maximum norm of the residual at least by the stagnation factor
+// (see setStagnationFactor()), the solver automatically falls back to a factorization of the
+// system matrix in the precision of \a blaze::real and continues the refinement with these
+// factors. Whether the last solution process required this fallback can be queried via
+// getFallback(). All helper data of the solver is kept between solution processes, i.e.
+// repeatedly solving systems of the same size does not allocate.
+
+   \code
+   blaze::MixedPrecisionRefinement solver;
+   blaze::MatMxN A;
+   blaze::VecN b, x;
+   // ... Initialization of the linear system
+
+   solver.setThreshold( 1E-12 );
+   solver.solve( A, b, x );
+   \endcode
+*/
+class MixedPrecisionRefinement : public Solver
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit MixedPrecisionRefinement();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline real getStagnationFactor() const;
+   inline bool getFallback        () const;
+   //@}
+   //**********************************************************************************************
+
+   //**Set functions*******************************************************************************
+   /*!\name Set functions */
+   //@{
+   void setStagnationFactor( real factor );
+   //@}
+   //**********************************************************************************************
+
+   //**Solver functions****************************************************************************
+   /*!\name Solver functions */
+   //@{
+   inline bool solve( LSE& lse );
+          bool solve( const CMatMxN& A, const VecN& b, VecN& x );
+          bool solve( const MatMxN& A, const VecN& b, VecN& x );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef DynamicMatrix<float,rowMajor>      FactorType;  //!< Type of the single precision factors.
+   typedef DynamicVector<float,columnVector>  VectorType;  //!< Type of the single precision vectors.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >
+   bool refine( const MT& A, const VecN& b, VecN& x );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   FactorType LU_;          //!< The single precision LU factors of the system matrix.
+   std::vector<size_t> p_;  //!< The row permutation of the single precision factorization.
+   FactorType L21_;         //!< Workspace for the panels of the single precision factorization.
+   FactorType U12_;         //!< Workspace for the block rows of the single precision factorization.
+   VectorType rf_;          //!< The single precision residual vector.
+   VectorType df_;          //!< The single precision correction vector.
+   LUDecomposition lu_;     //!< The fallback factorization of the system matrix.
+   VecN r_;                 //!< The residual vector.
+   VecN d_;                 //!< The correction vector.
+   real stagnation_;        //!< The minimum relative reduction of the residual per iteration.
+   bool fallback_;          //!< Flag for the fallback in the last solution process.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the stagnation factor of the refinement.
+//
+// \return The maximum admissible ratio of the residuals of two consecutive iterations.
+*/
+inline real MixedPrecisionRefinement::getStagnationFactor() const
+{
+   return stagnation_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the last solution process fell back to a full precision factorization.
+//
+// \return \a true in case of a fallback, \a false if the single precision factors sufficed.
+*/
+inline bool MixedPrecisionRefinement::getFallback() const
+{
+   return fallback_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solves the given linear system of equations.
+//
+// \param lse The linear system of equations \f$ A \cdot x + b = 0 \f$.
+// \return \a true if the system was solved within accuracy, \a false if not.
+// \exception std::invalid_argument Invalid matrix size.
+// \exception std::invalid_argument Invalid right-hand side vector size.
+*/
+inline bool MixedPrecisionRefinement::solve( LSE& lse )
+{
+   return solve( lse.A_, lse.b_, lse.x_ );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,14 +40,30 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/system/SMP.h>
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+#  include <omp.h>
+#elif BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+#  include <blaze/math/smp/threads/ThreadBackend.h>
+#endif
+
 #include <cmath>
+#include <vector>
+#include <blaze/math/BlockCompressedMatrix.h>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/problems/BoxLCP.h>
 #include <blaze/math/problems/ContactLCP.h>
 #include <blaze/math/problems/LCP.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/solvers/Solver.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/AlignedArray.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/ColorMacros.h>
 #include <blaze/util/logging/DebugSection.h>
@@ -69,10 +85,59 @@ namespace blaze {
 // TODO: description of the PGS solver
 // TODO: capabilities of the PGS solver (which LCP problems, etc)
 // TODO: known issues of the PGS solver
+//
+// Per default, the PGS solver performs strictly sequential Gauss-Seidel sweeps. Via setMode()
+// one of two parallel sweeps can be selected, which are executed via the active shared-memory
+// parallelization backend:
+//
+//  - \a colored: The unknowns are colored such that no two coupled unknowns share a color. The
+//    colors are processed one after another, all unknowns of a single color are updated
+//    concurrently. The result of a sweep is independent of the number of threads.
+//  - \a blockJacobi: The unknowns are partitioned into one contiguous block per thread. Within
+//    a block, the unknowns are updated in Gauss-Seidel fashion, between the blocks the values
+//    of the previous sweep are used (Jacobi). The convergence rate depends on the number of
+//    threads.
+//
+// For contact LCPs, the three unknowns of a contact are always updated together. The LCP matrix
+// is converted into a block compressed matrix with 3x3 blocks and the local problem of a contact,
+// consisting of the 3x3 diagonal block and the friction box of the contact, is solved exactly in
+// a single step. In all modes, the precision of a sweep is the maximum change of an unknown, i.e.
+// convergence is reported identically to the sequential solver.
+
+   \code
+   blaze::PGS pgs;
+   pgs.setMode( blaze::PGS::colored );
+   pgs.solve( lcp );
+   \endcode
+
+// In time-stepping simulations, the LCPs of two subsequent time steps usually differ in a small
+// number of contacts only. Instead of assembling and solving a new problem, the problem of the
+// previous time step can be updated via update(). The remaining unknowns keep their values of
+// the previous solution and the inverse diagonal, the 3x3 block matrix and the coloring of the
+// solver are updated instead of recomputed. Only the values of the appended unknowns have to be
+// computed:
+
+   \code
+   pgs.solve( lcp );
+
+   // Removing the contacts 2 and 7, appending the rows and columns of the new contacts
+   pgs.update( lcp, removed, rows, columns );
+   // ... setting the right-hand side of the next time step
+   pgs.solve( lcp );  // Starts from the previous solution
+   \endcode
 */
 class PGS : public Solver
 {
  public:
+   //**Type definitions****************************************************************************
+   //! Sweep modes of the PGS solver.
+   enum Mode {
+      sequential  = 0,  //!< Sequential Gauss-Seidel sweeps.
+      colored     = 1,  //!< Parallel Gauss-Seidel sweeps over the unknowns of each color.
+      blockJacobi = 2   //!< Jacobi between the threads, Gauss-Seidel within each thread.
+   };
+   //**********************************************************************************************
+
    //**Constructors********************************************************************************
    /*!\name Constructors */
    //@{
@@ -80,18 +145,102 @@ class PGS : public Solver
    //@}
    //**********************************************************************************************
 
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline Mode   getMode()       const;
+   inline size_t getLastColors() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Set functions*******************************************************************************
+   /*!\name Set functions */
+   //@{
+   inline void setMode( Mode mode );
+   //@}
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
-   template< typename CP > bool solve( CP& cp );
+   template< typename CP > bool solve ( CP& cp );
+   template< typename CP > void update( CP& cp, const std::vector<size_t>& removed,
+                                        const CMatMxN& rows, const CMatMxN& columns );
    //@}
    //**********************************************************************************************
 
  private:
+   //**Type definitions****************************************************************************
+   typedef BlockCompressedMatrix<real,3UL>  BlockMatrix;  //!< Type of the 3x3 block LCP matrix.
+   //**********************************************************************************************
+
+   //**Private class SweepTask*********************************************************************
+   /*!\brief Auxiliary functor for the threaded execution of a partial PGS sweep.
+   */
+   template< typename CP >  // Type of the complementarity problem
+   struct SweepTask
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the SweepTask class template.
+      //
+      // \param pgs The PGS solver.
+      // \param cp The complementarity problem to solve.
+      // \param kbegin The index of the first block of unknowns to be updated.
+      // \param kend The index one past the last block of unknowns to be updated.
+      // \param rmax The resulting maximum change of an unknown.
+      */
+      explicit inline SweepTask( const PGS& pgs, CP& cp, size_t kbegin, size_t kend, real& rmax )
+         : pgs_   ( &pgs )    // The PGS solver
+         , cp_    ( &cp )     // The complementarity problem
+         , kbegin_( kbegin )  // The index of the first block of unknowns
+         , kend_  ( kend )    // The index one past the last block of unknowns
+         , rmax_  ( &rmax )   // The resulting maximum change of an unknown
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Updates the assigned range of blocks of unknowns.
+      //
+      // \return void
+      */
+      inline void operator()() {
+         *rmax_ = pgs_->sweep( *cp_, kbegin_, kend_ );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      const PGS* pgs_;     //!< The PGS solver.
+      CP*        cp_;      //!< The complementarity problem.
+      size_t     kbegin_;  //!< The index of the first block of unknowns.
+      size_t     kend_;    //!< The index one past the last block of unknowns.
+      real*      rmax_;    //!< The resulting maximum change of an unknown.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
-   template< typename CP > inline real sweep( CP& cp ) const;
+   template< typename CP > static inline size_t blockSize();
+
+   template< typename CP > inline void setup  ( const CP& cp );
+   template< typename CP > void        color  ( const CP& cp );
+   template< typename CP > void        recolor( const std::vector<size_t>& removed,
+                                                const CMatMxN& rows, const CMatMxN& columns );
+                           void        sortColors();
+   template< typename CP > real        iterate( CP& cp );
+   template< typename CP > real        sweepParallel( CP& cp, size_t kbegin, size_t kend, size_t tasks );
+   template< typename CP > inline real sweep  ( CP& cp, size_t kbegin, size_t kend ) const;
+   template< typename CP > inline real relax  ( CP& cp, size_t k, const VecN& y, size_t jbegin, size_t jend ) const;
+
+   static inline real rowResidual( const CMatMxN& A, const VecN& b, const VecN& x,
+                                   const VecN& y, size_t jbegin, size_t jend, size_t i );
+
+   static bool solveContact( const real* D, const real* r, real mu, real* x );
+   static bool solveSystem ( const real* D, const real* r, const real (*V)[3],
+                             const size_t* rows, size_t k, real* z );
+
+   static inline size_t threads();
    //@}
    //**********************************************************************************************
 
@@ -101,6 +250,21 @@ class PGS : public Solver
    VecN diagonal_;  //!< Vector for the diagonal entries of the LCP matrix.
                     /*!< For performance reasons, the vector contains the inverse of the
                          diagonal elements. */
+   Mode mode_;      //!< The sweep mode of the PGS solver.
+   VecN xold_;      //!< The unknowns of the previous sweep (block Jacobi mode only).
+   CompressedMatrix<real,columnMajor> pattern_;  //!< The column-major copy of the LCP matrix.
+                                                 /*!< The copy is used to take the coupling
+                                                      of non-symmetric LCP matrices into
+                                                      account during the coloring. */
+   std::vector<size_t> colors_;      //!< The color of each block of unknowns.
+   std::vector<size_t> colorStart_;  //!< The index of the first block of each color in order_.
+   std::vector<size_t> order_;       //!< The blocks of unknowns sorted by color.
+   std::vector<real>   rmax_;        //!< The maximum change of an unknown per parallel task.
+   BlockMatrix         blockA_;      //!< The 3x3 block copy of the LCP matrix (contact LCPs only).
+   bool                updated_;     //!< Flag for an incremental update of the cached data.
+                                     /*!< The flag is set by update() and indicates that the
+                                          inverse diagonal, the block matrix and the coloring
+                                          match the updated problem. */
    //@}
    //**********************************************************************************************
 };
@@ -109,19 +273,111 @@ class PGS : public Solver
 
 
 
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the sweep mode of the PGS solver.
+//
+// \return The sweep mode of the PGS solver.
+*/
+inline PGS::Mode PGS::getMode() const
+{
+   return mode_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of colors used in the last solution process.
+//
+// \return The number of colors of the last solution process (0 in case no coloring was used).
+*/
+inline size_t PGS::getLastColors() const
+{
+   return ( mode_ == colored && !colorStart_.empty() )?( colorStart_.size() - 1UL ):( 0UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Sets the sweep mode of the PGS solver.
+//
+// \param mode The new sweep mode.
+// \return void
+//
+// Note that the solve() and update() functions are explicitly instantiated for all problem types
+// in src/math/solvers/PGS.cpp. Therefore the \a colored and \a blockJacobi modes only execute in
+// parallel in case this source file is compiled with an active shared-memory parallelization
+// backend (OpenMP, C++11 threads or Boost threads), independent of the settings of the calling
+// code (except for Visual C++, which instantiates both functions in the calling code). Otherwise
+// all sweeps are executed serially: the \a colored mode computes the same result as in parallel,
+// the \a blockJacobi mode uses a single block and thus performs sequential sweeps.
+*/
+inline void PGS::setMode( Mode mode )
+{
+   mode_ = mode;
+   colorStart_.clear();
+}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  UTILITY FUNCTIONS
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*!\brief Returns the number of unknowns that are updated together.
+//
+// \return The number of unknowns per block.
+*/
+template< typename CP >  // Type of the complementarity problem
+inline size_t PGS::blockSize()
+{
+   return 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of unknowns that are updated together.
+//
+// \return The number of unknowns per block.
+//
+// The normal and the two frictional unknowns of a contact are updated together.
+*/
+template<>
+inline size_t PGS::blockSize<ContactLCP>()
+{
+   return 3UL;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Solves the provided complementarity problem.
 //
 // \param cp The complementarity problem to solve.
 // \return Returns \a true if the solution is sufficiently accurate, otherwise it returns \a false.
 //
-// TODO
+// The solution process starts from the current unknowns of the problem. In case the problem has
+// been updated via update() since the last solution process, the cached inverse diagonal, block
+// matrix and coloring are reused, otherwise they are recomputed from the LCP matrix.
 */
 template< typename CP >  // Type of the complementarity problem
 bool PGS::solve( CP& cp )
@@ -130,16 +386,33 @@ bool PGS::solve( CP& cp )
    const CMatMxN& A( cp.A_ );
    bool converged( false );
 
-   // Allocating the helper data
-   diagonal_.resize( n, false );
-
-   // Locating the diagonal entries in system matrix and precomputing the inverse values
-   for( size_t i=0; i<n; ++i ) {
-      const real tmp( A(i,i) );
-      BLAZE_INTERNAL_ASSERT( tmp != real(0), "Invalid diagonal element in the LCP matrix" );
-      diagonal_[i] = real(1) / tmp;
+   // Reusing the data of an incremental update or recomputing all helper data
+   if( !updated_ || diagonal_.size() != n )
+   {
+      // Allocating the helper data
+      diagonal_.resize( n, false );
+
+      // Locating the diagonal entries in system matrix and precomputing the inverse values
+      for( size_t i=0; i<n; ++i ) {
+         const real tmp( A(i,i) );
+         BLAZE_INTERNAL_ASSERT( tmp != real(0), "Invalid diagonal element in the LCP matrix" );
+         diagonal_[i] = real(1) / tmp;
+      }
+
+      // Setting up the block representation of the LCP matrix
+      setup( cp );
+
+      // Coloring the blocks of unknowns
+      if( mode_ == colored )
+         color( cp );
+   }
+   else if( mode_ == colored && colorStart_.empty() )
+   {
+      color( cp );
    }
 
+   updated_ = false;
+
    // Projecting the initial solution to a feasible region
    for( size_t i=0; i<n; ++i ) {
       cp.project( i );
@@ -154,7 +427,7 @@ bool PGS::solve( CP& cp )
    size_t it( 0 );
 
    for( ; !converged && it<maxIterations_; ++it ) {
-      lastPrecision_ = sweep( cp );
+      lastPrecision_ = iterate( cp );
       if( lastPrecision_ < threshold_ )
          converged = true;
    }
@@ -174,87 +447,543 @@ bool PGS::solve( CP& cp )
 
 
 //*************************************************************************************************
-/*!\brief TODO
+/*!\brief Removes and appends blocks of unknowns of the given complementarity problem.
+//
+// \param cp The complementarity problem to update.
+// \param removed The ascending indices of the blocks of unknowns to be removed.
+// \param rows The rows of the appended unknowns with respect to the updated numbering.
+// \param columns The columns of the appended unknowns for all remaining rows.
+// \return void
+// \exception std::invalid_argument Invalid block index.
+// \exception std::invalid_argument Invalid number of appended rows.
+// \exception std::invalid_argument Invalid number of appended columns.
+//
+// This function updates the given problem via its update() function (see for instance
+// LCP::update()) and keeps the helper data of the last solution process consistent with the
+// updated problem. A block of unknowns refers to a single unknown for LCPs and box LCPs and to
+// the three unknowns of a contact for contact LCPs. The inverse diagonal and the colors of the
+// remaining blocks are kept, only the appended blocks are inverted and colored. The following
+// solve() call reuses this data and starts from the remaining previous solution.
+//
+// The update assumes that \a cp is the problem of the last solution process of the solver and
+// that the remaining rows of the LCP matrix are not changed apart from the appended columns. In
+// case the solver has not solved \a cp before, the problem is updated and the next solve() call
+// recomputes all helper data.
+*/
+template< typename CP >  // Type of the complementarity problem
+void PGS::update( CP& cp, const std::vector<size_t>& removed, const CMatMxN& rows, const CMatMxN& columns )
+{
+   const bool cached( diagonal_.size() == cp.size() );
+
+   cp.update( removed, rows, columns );
+
+   updated_ = cached;
+
+   if( !cached )
+      return;
+
+   const size_t bs  ( blockSize<CP>() );
+   const size_t m   ( rows.rows() );
+   const size_t nrem( cp.size() - m );
+
+   // Updating the inverse diagonal entries
+   updateVector( diagonal_, removed, bs, m );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      const CMatMxN::ConstIterator element( rows.find( i, nrem+i ) );
+      BLAZE_INTERNAL_ASSERT( element != rows.end(i) && element->value() != real(0),
+                             "Invalid diagonal element in the LCP matrix" );
+      diagonal_[nrem+i] = real(1) / element->value();
+   }
+
+   // Updating the block representation of the LCP matrix
+   setup( cp );
+
+   // Updating the coloring of the blocks of unknowns
+   if( mode_ == colored && !colorStart_.empty() )
+      recolor<CP>( removed, rows, columns );
+   else colorStart_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets up the solver specific representation of the LCP matrix.
+//
+// \param cp The complementarity problem to solve.
+// \return void
+//
+// The default PGS sweeps work directly on the scalar LCP matrix, i.e. no setup is required.
+*/
+template< typename CP >  // Type of the complementarity problem
+inline void PGS::setup( const CP& /*cp*/ )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Converts the LCP matrix of the given contact LCP into 3x3 blocks.
+//
+// \param cp The contact LCP to solve.
+// \return void
+//
+// The memory of the block matrix is reused, i.e. repeatedly solving contact LCPs with the same
+// number of coupled contacts does not allocate.
+*/
+template<>
+inline void PGS::setup( const ContactLCP& cp )
+{
+   blockA_ = cp.A_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greedy coloring of the blocks of unknowns of the given complementarity problem.
 //
 // \param cp The complementarity problem to solve.
-// \return TODO
+// \return void
 //
-// TODO
+// Two blocks of unknowns are coupled if the LCP matrix contains a non-zero element in a row of
+// the first and a column of the second block or vice versa. This function assigns each block
+// the smallest color not used by any of its previously colored coupled blocks and sorts the
+// blocks by color. The blocks of a single color are kept in ascending order.
 */
 template< typename CP >  // Type of the complementarity problem
-inline real PGS::sweep( CP& cp ) const
+void PGS::color( const CP& cp )
 {
-   real maxResidual( 0 ), xold( 0 );
-   const size_t n( cp.size() );
+   typedef CMatMxN::ConstIterator                             RowIterator;
+   typedef CompressedMatrix<real,columnMajor>::ConstIterator  ColumnIterator;
 
    const CMatMxN& A( cp.A_ );
-   const VecN&    b( cp.b_ );
-   VecN& x( cp.x_ );
+   const size_t bs( blockSize<CP>() );
+   const size_t nb( cp.size() / bs );
+
+   pattern_ = A;
+
+   colors_.resize( nb );
+   colorStart_.clear();
 
-   for( size_t i=0; i<n; ++i )
+   std::vector<size_t> marker;  // The last block that has marked a color as used
+
+   for( size_t k=0UL; k<nb; ++k )
    {
-      const real residual( - b[i] - ( A * x )[i] );
+      for( size_t i=k*bs; i<(k+1UL)*bs; ++i )
+      {
+         const RowIterator rend( A.end(i) );
+         for( RowIterator element=A.begin(i); element!=rend; ++element ) {
+            const size_t l( element->index() / bs );
+            if( l < k ) marker[colors_[l]] = k;
+         }
+
+         const ColumnIterator cend( pattern_.end(i) );
+         for( ColumnIterator element=pattern_.begin(i); element!=cend; ++element ) {
+            const size_t l( element->index() / bs );
+            if( l < k ) marker[colors_[l]] = k;
+         }
+      }
+
+      size_t c( 0UL );
+      while( c < marker.size() && marker[c] == k ) ++c;
+
+      if( c == marker.size() )
+         marker.push_back( k );
+
+      colors_[k] = c;
+   }
 
-      // Updating and projecting the unknown
-      xold = x[i];
-      x[i] += diagonal_[i] * residual;
-      cp.project( i );
-      maxResidual = max( maxResidual, std::fabs( xold - x[i] ) );
+   // Sorting the blocks by color
+   sortColors();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Updates the coloring of the blocks of unknowns after an incremental update.
+//
+// \param removed The ascending indices of the removed blocks of unknowns.
+// \param rows The rows of the appended unknowns.
+// \param columns The columns of the appended unknowns for all remaining rows.
+// \return void
+//
+// Removing blocks never invalidates the coloring of the remaining blocks. Therefore the remaining
+// blocks keep their colors and only the appended blocks are colored greedily as in color(). The
+// coupling of an appended block is determined from the appended rows and columns only, i.e. the
+// cost of the update is proportional to the number of appended elements. Note that the resulting
+// number of colors may exceed the number of colors of a complete recoloring.
+*/
+template< typename CP >  // Type of the complementarity problem
+void PGS::recolor( const std::vector<size_t>& removed, const CMatMxN& rows, const CMatMxN& columns )
+{
+   typedef CMatMxN::ConstIterator                             RowIterator;
+   typedef CompressedMatrix<real,columnMajor>::ConstIterator  ColumnIterator;
+
+   const size_t bs  ( blockSize<CP>() );
+   const size_t nb  ( colors_.size() );
+   const size_t nrem( columns.rows() );
+   const size_t mb  ( rows.rows() / bs );
+
+   // Removing the colors of the removed blocks
+   size_t l( 0UL );
+   for( size_t k=0UL, r=0UL; k<nb; ++k ) {
+      if( r < removed.size() && removed[r] == k ) ++r;
+      else colors_[l++] = colors_[k];
+   }
+   colors_.resize( l+mb );
+
+   // Coloring the appended blocks
+   const CompressedMatrix<real,columnMajor> rowsT( rows ), columnsT( columns );
+   std::vector<size_t> marker( colorStart_.size()-1UL, l+mb );  // The last block that has marked a color as used
+
+   for( size_t kk=0UL; kk<mb; ++kk )
+   {
+      const size_t k( l+kk );
+
+      for( size_t i=kk*bs; i<(kk+1UL)*bs; ++i )
+      {
+         const RowIterator rend( rows.end(i) );
+         for( RowIterator element=rows.begin(i); element!=rend; ++element ) {
+            const size_t b( element->index() / bs );
+            if( b < k ) marker[colors_[b]] = k;
+         }
+
+         const ColumnIterator tend( rowsT.end(nrem+i) );
+         for( ColumnIterator element=rowsT.begin(nrem+i); element!=tend; ++element ) {
+            const size_t b( l + element->index() / bs );
+            if( b < k ) marker[colors_[b]] = k;
+         }
+
+         const ColumnIterator cend( columnsT.end(i) );
+         for( ColumnIterator element=columnsT.begin(i); element!=cend; ++element ) {
+            marker[colors_[element->index() / bs]] = k;
+         }
+      }
+
+      size_t c( 0UL );
+      while( c < marker.size() && marker[c] == k ) ++c;
+
+      if( c == marker.size() )
+         marker.push_back( k );
+
+      colors_[k] = c;
+   }
+
+   // Sorting the blocks by color
+   sortColors();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs a single PGS sweep in the selected sweep mode.
+//
+// \param cp The complementarity problem to solve.
+// \return The maximum change of an unknown during the sweep.
+*/
+template< typename CP >  // Type of the complementarity problem
+real PGS::iterate( CP& cp )
+{
+   const size_t nb( cp.size() / blockSize<CP>() );
+
+   if( mode_ == colored )
+   {
+      real rmax( 0 );
+      for( size_t c=1UL; c<colorStart_.size(); ++c ) {
+         rmax = max( rmax, sweepParallel( cp, colorStart_[c-1UL], colorStart_[c],
+                                          threads()*SMP_TASKS_PER_THREAD ) );
+      }
+      return rmax;
+   }
+   else if( mode_ == blockJacobi )
+   {
+      xold_ = cp.x_;
+      return sweepParallel( cp, 0UL, nb, threads() );
+   }
+   else
+   {
+      return sweep( cp, 0UL, nb );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Updates the given range of blocks of unknowns in parallel.
+//
+// \param cp The complementarity problem to solve.
+// \param kbegin The index of the first block of unknowns to be updated.
+// \param kend The index one past the last block of unknowns to be updated.
+// \param tasks The number of tasks the range is split into.
+// \return The maximum change of an unknown within the given range.
+//
+// The range of blocks is split into the given number of tasks, which are executed by the
+// active shared-memory parallelization backend. Within a serial section or in case the range
+// is small, the tasks are executed one after another. Since the partitioning of the range does
+// not depend on the execution, both cases compute the same result.
+*/
+template< typename CP >  // Type of the complementarity problem
+real PGS::sweepParallel( CP& cp, size_t kbegin, size_t kend, size_t tasks )
+{
+   const size_t m( kend - kbegin );
+   const size_t addon( ( ( m % tasks ) != 0UL )? 1UL : 0UL );
+   const size_t sizePerTask( m / tasks + addon );
+
+   rmax_.assign( tasks, real(0) );
+
+#if BLAZE_OPENMP_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   if( !isSerialSectionActive() && !isParallelSectionActive() &&
+       m*blockSize<CP>() > SMP_PGS_THRESHOLD )
+   {
+      BLAZE_PARALLEL_SECTION
+      {
+#  if BLAZE_OPENMP_PARALLEL_MODE
+#pragma omp parallel for schedule(dynamic,1) shared( cp )
+         for( int i=0; i<static_cast<int>( tasks ); ++i )
+         {
+            const size_t ibegin( kbegin + i*sizePerTask );
+
+            if( ibegin >= kend )
+               continue;
+
+            rmax_[i] = sweep( cp, ibegin, min( ibegin+sizePerTask, kend ) );
+         }
+#  else
+         for( size_t i=0UL; i<tasks; ++i )
+         {
+            const size_t ibegin( kbegin + i*sizePerTask );
+
+            if( ibegin >= kend )
+               break;
+
+            TheThreadBackend::scheduleTask(
+               SweepTask<CP>( *this, cp, ibegin, min( ibegin+sizePerTask, kend ), rmax_[i] ) );
+         }
+
+         TheThreadBackend::wait();
+#  endif
+      }
+   }
+   else
+#endif
+   {
+      for( size_t i=0UL; i<tasks; ++i )
+      {
+         const size_t ibegin( kbegin + i*sizePerTask );
+
+         if( ibegin >= kend )
+            break;
+
+         rmax_[i] = sweep( cp, ibegin, min( ibegin+sizePerTask, kend ) );
+      }
+   }
+
+   real rmax( 0 );
+   for( size_t i=0UL; i<tasks; ++i ) {
+      rmax = max( rmax, rmax_[i] );
    }
 
-   return maxResidual;
+   return rmax;
 }
 //*************************************************************************************************
 
 
 //*************************************************************************************************
-/*!\brief TODO
+/*!\brief Sequentially updates the given range of blocks of unknowns.
 //
 // \param cp The complementarity problem to solve.
-// \return TODO
+// \param kbegin The index of the first block of unknowns to be updated.
+// \param kend The index one past the last block of unknowns to be updated.
+// \return The maximum change of an unknown within the given range.
 //
-// TODO: specialization for contact LCPs
-// TODO: more infos
+// In the colored mode, the range refers to the blocks sorted by color. In the block Jacobi
+// mode, all unknowns outside the range are taken from the previous sweep.
 */
-template<>
-inline real PGS::sweep( ContactLCP& cp ) const
+template< typename CP >  // Type of the complementarity problem
+inline real PGS::sweep( CP& cp, size_t kbegin, size_t kend ) const
 {
-   const size_t N( cp.size() / 3 );
-   real rmax( 0 ), residual, flimit, aux;
-   size_t j;
+   const size_t n( cp.size() );
+   real rmax( 0 );
 
-   const CMatMxN& A( cp.A_ );
-   const VecN&  b( cp.b_ );
+   if( mode_ == colored ) {
+      for( size_t k=kbegin; k<kend; ++k )
+         rmax = max( rmax, relax( cp, order_[k], cp.x_, 0UL, n ) );
+   }
+   else if( mode_ == blockJacobi ) {
+      const size_t bs( blockSize<CP>() );
+      for( size_t k=kbegin; k<kend; ++k )
+         rmax = max( rmax, relax( cp, k, xold_, kbegin*bs, kend*bs ) );
+   }
+   else {
+      for( size_t k=kbegin; k<kend; ++k )
+         rmax = max( rmax, relax( cp, k, cp.x_, 0UL, n ) );
+   }
+
+   return rmax;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Updates and projects a single unknown.
+//
+// \param cp The complementarity problem to solve.
+// \param k The index of the unknown.
+// \param y The unknowns used outside the range \f$ [jbegin..jend) \f$.
+// \param jbegin The index of the first unknown taken from the current solution.
+// \param jend The index one past the last unknown taken from the current solution.
+// \return The change of the unknown.
+*/
+template< typename CP >  // Type of the complementarity problem
+inline real PGS::relax( CP& cp, size_t k, const VecN& y, size_t jbegin, size_t jend ) const
+{
+   VecN& x( cp.x_ );
+
+   const real residual( rowResidual( cp.A_, cp.b_, x, y, jbegin, jend, k ) );
+
+   // Updating and projecting the unknown
+   const real xold( x[k] );
+   x[k] += diagonal_[k] * residual;
+   cp.project( k );
+
+   return std::fabs( xold - x[k] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Updates and projects the three unknowns of a single contact.
+//
+// \param cp The contact LCP to solve.
+// \param k The index of the contact.
+// \param y The unknowns used outside the range \f$ [jbegin..jend) \f$.
+// \param jbegin The index of the first unknown taken from the current solution.
+// \param jend The index one past the last unknown taken from the current solution.
+// \return The maximum change of the three unknowns.
+//
+// The coupling to all other contacts is accumulated block by block into the local right-hand
+// side \f$ r = -b_k - \sum_{l \neq k} A_{kl} x_l \f$. Afterwards the local problem consisting
+// of the 3x3 diagonal block \f$ A_{kk} \f$ and the friction box of the contact is solved exactly
+// (see solveContact()). In case the local problem has no solution (which may only happen for
+// degenerate diagonal blocks), the normal unknown is projected onto the non-negative half-axis
+// and the two frictional unknowns are projected onto the friction box defined by the updated
+// normal unknown one after another.
+*/
+template<>
+inline real PGS::relax( ContactLCP& cp, size_t k, const VecN& y, size_t jbegin, size_t jend ) const
+{
+   const VecN& b( cp.b_ );
    VecN& x( cp.x_ );
 
-   for( size_t i=0; i<N; ++i )
+   const size_t kdiag( blockA_.diagonal( k ) );
+   const size_t j( k*3UL );
+
+   AlignedArray<real,BlockMatrix::spacing> tmp;
+   for( size_t l=0UL; l<BlockMatrix::spacing; ++l )
+      reset( tmp[l] );
+
+   // Accumulating the coupling to all other contacts
+   for( size_t l=blockA_.offset(k); l<blockA_.offset(k+1UL); ++l )
    {
-      j = i * 3;
-      residual = -b[j] - ( A * x )[j];
-      aux = max( 0, x[j] + diagonal_[j] * residual );
-      rmax = max( rmax, std::fabs( x[j] - aux ) );
-      x[j] = aux;
-
-      flimit = cp.cof_[i] * x[j];
-
-      ++j;
-      residual = -b[j] - ( A * x )[j];
-      aux = max( -flimit, min( flimit, x[j] + diagonal_[j] * residual ) );
-      rmax = max( rmax, std::fabs( x[j] - aux ) );
-      x[j] = aux;
-
-      ++j;
-      residual = -b[j] - ( A * x )[j];
-      aux = max( -flimit, min( flimit, x[j] + diagonal_[j] * residual ) );
-      rmax = max( rmax, std::fabs( x[j] - aux ) );
-      x[j] = aux;
+      if( l == kdiag ) continue;
+
+      const size_t i( blockA_.index(l)*3UL );
+      const VecN& z( ( i >= jbegin && i < jend )?( x ):( y ) );
+      addBlockProduct<3UL>( tmp.data(), blockA_.block(l), z.data()+i );
    }
 
+   const real r[3] = { -b[j] - tmp[0], -b[j+1UL] - tmp[1], -b[j+2UL] - tmp[2] };
+   real aux[3];
+
+   BLAZE_INTERNAL_ASSERT( kdiag != blockA_.offset(k+1UL), "Missing diagonal block in the LCP matrix" );
+
+   // Solving the local contact problem
+   if( solveContact( blockA_.block( kdiag ), r, cp.cof_[k], aux ) )
+   {
+      const real rmax( max( std::fabs( x[j] - aux[0] ), std::fabs( x[j+1UL] - aux[1] ),
+                            std::fabs( x[j+2UL] - aux[2] ) ) );
+
+      x[j    ] = aux[0];
+      x[j+1UL] = aux[1];
+      x[j+2UL] = aux[2];
+
+      return rmax;
+   }
+
+   // Falling back to the successive projection of the three unknowns
+   const real* D( blockA_.block( kdiag ) );
+   const size_t S( BlockMatrix::spacing );
+   real rmax( 0 ), residual, flimit, tmpx;
+
+   residual = r[0] - D[0]*x[j] - D[0+S]*x[j+1UL] - D[0+2UL*S]*x[j+2UL];
+   tmpx = max( 0, x[j] + diagonal_[j] * residual );
+   rmax = max( rmax, std::fabs( x[j] - tmpx ) );
+   x[j] = tmpx;
+
+   flimit = cp.cof_[k] * x[j];
+
+   residual = r[1] - D[1]*x[j] - D[1+S]*x[j+1UL] - D[1+2UL*S]*x[j+2UL];
+   tmpx = max( -flimit, min( flimit, x[j+1UL] + diagonal_[j+1UL] * residual ) );
+   rmax = max( rmax, std::fabs( x[j+1UL] - tmpx ) );
+   x[j+1UL] = tmpx;
+
+   residual = r[2] - D[2]*x[j] - D[2+S]*x[j+1UL] - D[2+2UL*S]*x[j+2UL];
+   tmpx = max( -flimit, min( flimit, x[j+2UL] + diagonal_[j+2UL] * residual ) );
+   rmax = max( rmax, std::fabs( x[j+2UL] - tmpx ) );
+   x[j+2UL] = tmpx;
+
    return rmax;
 }
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Computes the residual \f$ -b_i - A_i x \f$ of a single row of the LCP.
+//
+// \param A The LCP matrix.
+// \param b The right-hand side vector.
+// \param x The current solution.
+// \param y The unknowns used outside the range \f$ [jbegin..jend) \f$.
+// \param jbegin The index of the first unknown taken from \a x.
+// \param jend The index one past the last unknown taken from \a x.
+// \param i The index of the row.
+// \return The residual of the row.
+*/
+inline real PGS::rowResidual( const CMatMxN& A, const VecN& b, const VecN& x,
+                              const VecN& y, size_t jbegin, size_t jend, size_t i )
+{
+   typedef CMatMxN::ConstIterator  ConstIterator;
+
+   real tmp( b[i] );
+
+   const ConstIterator end( A.end(i) );
+   for( ConstIterator element=A.begin(i); element!=end; ++element ) {
+      const size_t j( element->index() );
+      tmp += element->value() * ( ( j >= jbegin && j < jend )?( x[j] ):( y[j] ) );
+   }
+
+   return -tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of threads of the active shared-memory parallelization backend.
+//
+// \return The number of threads (1 in case no parallelization backend is active).
+*/
+inline size_t PGS::threads()
+{
+#if BLAZE_OPENMP_PARALLEL_MODE
+   return omp_get_max_threads();
+#elif BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   return TheThreadBackend::size();
+#else
+   return 1UL;
+#endif
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -269,6 +998,9 @@ inline real PGS::sweep( ContactLCP& cp ) const
 extern template bool PGS::solve<LCP>( LCP& );
 extern template bool PGS::solve<BoxLCP>( BoxLCP& );
 extern template bool PGS::solve<ContactLCP>( ContactLCP& );
+extern template void PGS::update<LCP>( LCP&, const std::vector<size_t>&, const CMatMxN&, const CMatMxN& );
+extern template void PGS::update<BoxLCP>( BoxLCP&, const std::vector<size_t>&, const CMatMxN&, const CMatMxN& );
+extern template void PGS::update<ContactLCP>( ContactLCP&, const std::vector<size_t>&, const CMatMxN&, const CMatMxN& );
 #endif
 /*! \endcond */
 //*************************************************************************************************
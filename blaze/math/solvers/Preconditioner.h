@@ -0,0 +1,95 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/Preconditioner.h
+//  \brief Header file for the Preconditioner base class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_PRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_PRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Base class for all preconditioners of the linear system solvers.
+// \ingroup lse_solvers
+//
+// A preconditioner approximates the inverse of a system matrix \f$ A \f$ by a matrix \f$ M^{-1}
+// \f$ that is cheap to apply. The setup() function is called by the solver once per solution
+// process and computes the preconditioner for the given system matrix, the apply() function is
+// called once per iteration and computes \f$ z = M^{-1} r \f$. Both functions may reuse the
+// memory of previous setups, i.e. repeatedly solving systems of the same size does not allocate.
+
+   \code
+   blaze::CG cg;
+   blaze::ICPreconditioner ic;
+
+   cg.setPreconditioner( &ic );
+   cg.solve( A, b, x );
+   \endcode
+*/
+class Preconditioner
+{
+ public:
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   virtual ~Preconditioner() {}
+   //@}
+   //**********************************************************************************************
+
+   //**Preconditioner functions********************************************************************
+   /*!\name Preconditioner functions */
+   //@{
+   virtual void setup( const CMatMxN& A ) = 0;
+   virtual void apply( const VecN& r, VecN& z ) const = 0;
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
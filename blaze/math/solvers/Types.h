@@ -44,11 +44,20 @@ namespace blaze {
 //
 //=================================================================================================
 
+class BiCGSTAB;
+class BlockJacobiPreconditioner;
 class CG;
 class CPG;
 class GaussianElimination;
+class GMRES;
+class ICPreconditioner;
+class JacobiPreconditioner;
 class Lemke;
+class LUDecomposition;
+class MINRES;
+class MixedPrecisionRefinement;
 class PGS;
+class Preconditioner;
 
 } // namespace blaze
 
@@ -0,0 +1,985 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/BlockCompressedMatrix.h
+//  \brief Implementation of a block compressed row sparse matrix with fixed-size blocks
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDMATRIX_H_
+#define _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/SMP.h>
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+#  include <omp.h>
+#elif BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+#  include <blaze/math/smp/threads/ThreadBackend.h>
+#endif
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/Or.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup block_compressed_matrix BlockCompressedMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Sparse matrix in the block compressed row (BSR) storage format.
+// \ingroup block_compressed_matrix
+//
+// The BlockCompressedMatrix class template represents a sparse matrix that is composed of dense
+// \a N x \a N blocks. The matrix stores the non-zero blocks row by row in a single contiguous,
+// aligned array, along with a single column index per block. Every block is stored in column-
+// major order, each column padded to \a spacing elements. In comparison to a scalar
+// CompressedMatrix, the index overhead is reduced by a factor of \f$ N^2 \f$ and the product of
+// a block with a dense vector can be performed by intrinsic operations on the padded columns of
+// the block. The type of the elements and the size of the blocks are specified via the two
+// template parameters:
+
+   \code
+   template< typename Type, size_t N >
+   class BlockCompressedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. BlockCompressedMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type.
+//  - N   : specifies the number of rows and columns of every block.
+//
+// A BlockCompressedMatrix is set up from an arbitrary sparse matrix whose number of rows and
+// columns are multiples of \a N. Every \a N x \a N block containing at least one non-zero
+// element is stored completely. The sparsity pattern cannot be modified afterwards, but the
+// values of the stored blocks can be updated via the block() function. Assigning a sparse
+// matrix reuses the memory of the previous setup:
+
+   \code
+   using blaze::rowMajor;
+   using blaze::columnVector;
+
+   blaze::CompressedMatrix<double,rowMajor> A;
+   blaze::DynamicVector<double,columnVector> x, y;
+   // ... Resizing and initialization
+
+   blaze::BlockCompressedMatrix<double,3UL> B( A );  // Conversion into 3x3 blocks
+
+   y.resize( B.rows() );
+   multiply( y, B, x );  // Computing y = A * x
+   \endcode
+
+// In case the element type is \c float or \c double, the product of a block and a dense
+// vector is computed by broadcasting the elements of the vector and accumulating the scaled
+// columns of the block via fused multiply-add operations.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t N >     // Number of rows and columns of the blocks
+class BlockCompressedMatrix
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef BlockCompressedMatrix<Type,N>  This;         //!< Type of this BlockCompressedMatrix instance.
+   typedef Type                           ElementType;  //!< Type of the sparse matrix elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for intrinsic optimization.
+   /*! The \a vectorizable compilation flag indicates whether the product of a block and a dense
+       vector is performed by intrinsic operations. This is the case for \c float and \c double
+       elements. */
+   enum { vectorizable = Or< IsFloat<Type>, IsDouble<Type> >::value };
+
+   //! The number of rows and columns of the blocks.
+   enum { blockSize = N };
+
+   //! The number of elements per column of a block including the padding elements.
+   enum { spacing = vectorizable ? N + ( IntrinsicTrait<Type>::size - N % IntrinsicTrait<Type>::size ) % IntrinsicTrait<Type>::size : N };
+
+   //! The number of elements per block including the padding elements.
+   enum { blockSpacing = N * spacing };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline BlockCompressedMatrix();
+
+   template< typename MT, bool SO >
+   explicit inline BlockCompressedMatrix( const SparseMatrix<MT,SO>& sm );
+
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   // No explicitly declared copy assignment operator.
+   template< typename MT, bool SO > inline BlockCompressedMatrix& operator=( const SparseMatrix<MT,SO>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const;
+   inline size_t columns() const;
+   inline size_t blockRows() const;
+   inline size_t blockColumns() const;
+   inline size_t blocks() const;
+   inline size_t nonZeros() const;
+   inline void   swap( BlockCompressedMatrix& sm ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline size_t      offset  ( size_t i ) const;
+   inline size_t      index   ( size_t k ) const;
+   inline size_t      diagonal( size_t i ) const;
+   inline Type*       block   ( size_t k );
+   inline const Type* block   ( size_t k ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT > void init( const SparseMatrix<MT,false>& sm );
+   template< typename MT > void init( const SparseMatrix<MT,true>&  sm );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;  //!< The number of block rows of the sparse matrix.
+   size_t n_;  //!< The number of block columns of the sparse matrix.
+
+   std::vector<size_t> offsets_;    //!< The offset of the first block of each block row.
+   std::vector<size_t> indices_;    //!< The block column index of each block.
+   std::vector<size_t> diagonals_;  //!< The position of the diagonal block of each block row.
+   DynamicVector<Type> blocks_;     //!< The elements of the non-zero blocks of the sparse matrix.
+                                    /*!< The blocks are stored one after another, each one
+                                         in column-major order with padded columns. */
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_STATIC_ASSERT( N > 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for BlockCompressedMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t N >     // Number of rows and columns of the blocks
+inline BlockCompressedMatrix<Type,N>::BlockCompressedMatrix()
+   : m_        ( 0UL )       // The number of block rows of the sparse matrix
+   , n_        ( 0UL )       // The number of block columns of the sparse matrix
+   , offsets_  ( 1UL, 0UL )  // The offset of the first block of each block row
+   , indices_  ()            // The block column index of each block
+   , diagonals_()            // The position of the diagonal block of each block row
+   , blocks_   ()            // The non-zero blocks of the sparse matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different sparse matrices.
+//
+// \param sm Sparse matrix to be converted into the block compressed row format.
+// \exception std::invalid_argument Invalid matrix size for the given block size.
+//
+// This constructor converts the given sparse matrix into the block compressed row format. In
+// case the number of rows or columns of the given matrix is not a multiple of the block size
+// \a N, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t N >     // Number of rows and columns of the blocks
+template< typename MT    // Type of the foreign sparse matrix
+        , bool SO >      // Storage order of the foreign sparse matrix
+inline BlockCompressedMatrix<Type,N>::BlockCompressedMatrix( const SparseMatrix<MT,SO>& sm )
+   : m_        ( 0UL )  // The number of block rows of the sparse matrix
+   , n_        ( 0UL )  // The number of block columns of the sparse matrix
+   , offsets_  ()       // The offset of the first block of each block row
+   , indices_  ()       // The block column index of each block
+   , diagonals_()       // The position of the diagonal block of each block row
+   , blocks_   ()       // The non-zero blocks of the sparse matrix
+{
+   if( (~sm).rows() % N != 0UL || (~sm).columns() % N != 0UL )
+      throw std::invalid_argument( "Invalid matrix size for the given block size" );
+
+   init( ~sm );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different sparse matrices.
+//
+// \param rhs Sparse matrix to be converted into the block compressed row format.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid matrix size for the given block size.
+//
+// The given sparse matrix is converted into the block compressed row format. The memory of
+// the previous setup is reused, i.e. repeatedly assigning matrices with the same number of
+// non-zero blocks does not allocate. In case the number of rows or columns of the given matrix
+// is not a multiple of the block size \a N, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t N >     // Number of rows and columns of the blocks
+template< typename MT    // Type of the foreign sparse matrix
+        , bool SO >      // Storage order of the foreign sparse matrix
+inline BlockCompressedMatrix<Type,N>&
+   BlockCompressedMatrix<Type,N>::operator=( const SparseMatrix<MT,SO>& rhs )
+{
+   if( (~rhs).rows() % N != 0UL || (~rhs).columns() % N != 0UL )
+      throw std::invalid_argument( "Invalid matrix size for the given block size" );
+
+   init( ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t N >     // Number of rows and columns of the blocks
+inline size_t BlockCompressedMatrix<Type,N>::rows() const
+{
+   return m_*N;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t N >     // Number of rows and columns of the blocks
+inline size_t BlockCompressedMatrix<Type,N>::columns() const
+{
+   return n_*N;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of block rows of the sparse matrix.
+//
+// \return The number of block rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t N >     // Number of rows and columns of the blocks
+inline size_t BlockCompressedMatrix<Type,N>::blockRows() const
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of block columns of the sparse matrix.
+//
+// \return The number of block columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t N >     // Number of rows and columns of the blocks
+inline size_t BlockCompressedMatrix<Type,N>::blockColumns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero blocks of the sparse matrix.
+//
+// \return The number of non-zero blocks of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t N >     // Number of rows and columns of the blocks
+inline size_t BlockCompressedMatrix<Type,N>::blocks() const
+{
+   return indices_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements of the sparse matrix.
+//
+// \return The number of stored elements of the sparse matrix.
+//
+// The returned number includes all elements of the non-zero blocks, i.e. also the zero elements
+// within the non-zero blocks.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t N >     // Number of rows and columns of the blocks
+inline size_t BlockCompressedMatrix<Type,N>::nonZeros() const
+{
+   return indices_.size()*N*N;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The sparse matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t N >     // Number of rows and columns of the blocks
+inline void BlockCompressedMatrix<Type,N>::swap( BlockCompressedMatrix& sm ) /* throw() */
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   offsets_.swap( sm.offsets_ );
+   indices_.swap( sm.indices_ );
+   diagonals_.swap( sm.diagonals_ );
+   blocks_.swap( sm.blocks_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of a row-major sparse matrix into the block compressed row format.
+//
+// \param sm The row-major sparse matrix to be converted.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t N >     // Number of rows and columns of the blocks
+template< typename MT >  // Type of the foreign sparse matrix
+void BlockCompressedMatrix<Type,N>::init( const SparseMatrix<MT,false>& sm )
+{
+   typedef typename MT::CompositeType                         CT;
+   typedef typename RemoveReference<CT>::Type::ConstIterator  ConstIterator;
+
+   CT A( ~sm );  // Evaluation of the sparse matrix
+
+   m_ = A.rows() / N;
+   n_ = A.columns() / N;
+
+   offsets_.resize( m_+1UL );
+   diagonals_.resize( m_ );
+   indices_.clear();
+
+   // Setting up the block sparsity pattern
+   std::vector<size_t> marker( n_, m_ );  // The last block row that has marked a block column
+
+   offsets_[0UL] = 0UL;
+
+   for( size_t i=0UL; i<m_; ++i )
+   {
+      for( size_t r=i*N; r<(i+1UL)*N; ++r ) {
+         for( ConstIterator element=A.begin(r); element!=A.end(r); ++element ) {
+            const size_t j( element->index() / N );
+            if( marker[j] != i ) {
+               marker[j] = i;
+               indices_.push_back( j );
+            }
+         }
+      }
+
+      std::sort( indices_.begin()+offsets_[i], indices_.end() );
+      offsets_[i+1UL] = indices_.size();
+
+      diagonals_[i] = std::lower_bound( indices_.begin()+offsets_[i], indices_.end(), i ) - indices_.begin();
+      if( diagonals_[i] != offsets_[i+1UL] && indices_[diagonals_[i]] != i )
+         diagonals_[i] = offsets_[i+1UL];
+   }
+
+   // Copying the values into the blocks
+   blocks_.resize( indices_.size()*blockSpacing, false );
+   reset( blocks_ );
+
+   for( size_t i=0UL; i<m_; ++i )
+   {
+      for( size_t k=offsets_[i]; k<offsets_[i+1UL]; ++k ) {
+         marker[indices_[k]] = k;
+      }
+
+      for( size_t r=i*N; r<(i+1UL)*N; ++r ) {
+         for( ConstIterator element=A.begin(r); element!=A.end(r); ++element ) {
+            const size_t j( element->index() );
+            blocks_[marker[j/N]*blockSpacing + (j%N)*spacing + r-i*N] = element->value();
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of a column-major sparse matrix into the block compressed row format.
+//
+// \param sm The column-major sparse matrix to be converted.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t N >     // Number of rows and columns of the blocks
+template< typename MT >  // Type of the foreign sparse matrix
+void BlockCompressedMatrix<Type,N>::init( const SparseMatrix<MT,true>& sm )
+{
+   const CompressedMatrix<Type,false> tmp( ~sm );
+   init( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the position of the first block of the given block row.
+//
+// \param i The index of the block row \f$[0..blockRows()]\f$.
+// \return The position of the first block of the block row.
+//
+// For \a i equal to the number of block rows, the function returns the total number of blocks.
+// The blocks of a block row are stored in the range <tt>[offset(i)..offset(i+1))</tt> in
+// ascending order of their block column indices.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t N >     // Number of rows and columns of the blocks
+inline size_t BlockCompressedMatrix<Type,N>::offset( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < offsets_.size(), "Invalid block row access index" );
+   return offsets_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the block column index of the given block.
+//
+// \param k The position of the block \f$[0..blocks()-1]\f$.
+// \return The block column index of the block.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t N >     // Number of rows and columns of the blocks
+inline size_t BlockCompressedMatrix<Type,N>::index( size_t k ) const
+{
+   BLAZE_USER_ASSERT( k < indices_.size(), "Invalid block access index" );
+   return indices_[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the position of the diagonal block of the given block row.
+//
+// \param i The index of the block row \f$[0..blockRows()-1]\f$.
+// \return The position of the diagonal block, <tt>offset(i+1)</tt> in case it is not stored.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t N >     // Number of rows and columns of the blocks
+inline size_t BlockCompressedMatrix<Type,N>::diagonal( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < diagonals_.size(), "Invalid block row access index" );
+   return diagonals_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the given block.
+//
+// \param k The position of the block \f$[0..blocks()-1]\f$.
+// \return Pointer to the first element of the block.
+//
+// The block is stored in column-major order and every column is padded to \a spacing elements,
+// i.e. the element \f$ (i,j) \f$ of the block is located at <tt>block(k)[i+j*spacing]</tt>. In
+// case the element type is vectorizable, every column is properly aligned. The values of the
+// block can be modified, but its position within the matrix is fixed. The padding elements
+// have to remain zero.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t N >     // Number of rows and columns of the blocks
+inline Type* BlockCompressedMatrix<Type,N>::block( size_t k )
+{
+   BLAZE_USER_ASSERT( k < indices_.size(), "Invalid block access index" );
+   return blocks_.data() + k*blockSpacing;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the given block.
+//
+// \param k The position of the block \f$[0..blocks()-1]\f$.
+// \return Pointer to the first element of the block.
+//
+// The element \f$ (i,j) \f$ of the block is located at <tt>block(k)[i+j*spacing]</tt>.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t N >     // Number of rows and columns of the blocks
+inline const Type* BlockCompressedMatrix<Type,N>::block( size_t k ) const
+{
+   BLAZE_USER_ASSERT( k < indices_.size(), "Invalid block access index" );
+   return blocks_.data() + k*blockSpacing;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BLOCKCOMPRESSEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BlockCompressedMatrix operators */
+//@{
+template< typename Type, size_t N >
+inline void swap( BlockCompressedMatrix<Type,N>& a, BlockCompressedMatrix<Type,N>& b ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two block compressed matrices.
+// \ingroup block_compressed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrices
+        , size_t N >     // Number of rows and columns of the blocks
+inline void swap( BlockCompressedMatrix<Type,N>& a, BlockCompressedMatrix<Type,N>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BLOCK KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default accumulation of a block/vector product (\f$ \vec{y}+=B*\vec{x} \f$).
+// \ingroup block_compressed_matrix
+//
+// \param y The padded target array of size <tt>BlockCompressedMatrix<Type,N>::spacing</tt>.
+// \param B The padded, column-major block (see BlockCompressedMatrix::block()).
+// \param x The array of the \a N elements of the right-hand side vector.
+// \return void
+//
+// The target array has to be properly aligned. The padding elements of the target array are
+// not modified. The block size \a N has to be specified explicitly, e.g.
+// <tt>addBlockProduct<3UL>( y, A.block(k), x )</tt>.
+*/
+template< size_t N         // Number of rows and columns of the block
+        , typename Type >  // Data type of the block
+inline typename DisableIf< Or< IsFloat<Type>, IsDouble<Type> > >::Type
+   addBlockProduct( Type* y, const Type* B, const Type* x )
+{
+   const size_t MM( BlockCompressedMatrix<Type,N>::spacing );
+
+   for( size_t j=0UL; j<N; ++j ) {
+      for( size_t i=0UL; i<N; ++i ) {
+         y[i] += B[i+j*MM] * x[j];
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Vectorized accumulation of a block/vector product (\f$ \vec{y}+=B*\vec{x} \f$).
+// \ingroup block_compressed_matrix
+//
+// \param y The padded target array of size <tt>BlockCompressedMatrix<Type,N>::spacing</tt>.
+// \param B The padded, column-major block (see BlockCompressedMatrix::block()).
+// \param x The array of the \a N elements of the right-hand side vector.
+// \return void
+//
+// The target array and the block have to be properly aligned. Every element of \a x is
+// broadcast and multiplied with the according padded column of the block. Since the padding
+// elements of the block are zero, the padding elements of the target array are not modified.
+// The block size \a N has to be specified explicitly, e.g.
+// <tt>addBlockProduct<3UL>( y, A.block(k), x )</tt>.
+*/
+template< size_t N         // Number of rows and columns of the block
+        , typename Type >  // Data type of the block
+inline typename EnableIf< Or< IsFloat<Type>, IsDouble<Type> > >::Type
+   addBlockProduct( Type* y, const Type* B, const Type* x )
+{
+   typedef IntrinsicTrait<Type>  IT;
+   typedef typename IT::Type     IntrinsicType;
+
+   const size_t MM( BlockCompressedMatrix<Type,N>::spacing );
+
+   for( size_t l=0UL; l<MM; l+=IT::size )
+   {
+      IntrinsicType xmm( load( y+l ) );
+
+      for( size_t j=0UL; j<N; ++j ) {
+         xmm = fmadd( load( B+j*MM+l ), set( x[j] ), xmm );
+      }
+
+      store( y+l, xmm );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel of the block compressed matrix/dense vector multiplication.
+// \ingroup block_compressed_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side block compressed matrix operand.
+// \param x The right-hand side dense vector operand.
+// \param ibegin The index of the first block row to be computed.
+// \param iend The index one past the last block row to be computed.
+// \return void
+//
+// This function computes the given range of block rows block by block. The partial results
+// of a block row are accumulated in a padded, aligned array (see addBlockProduct()).
+*/
+template< typename VT1     // Type of the target dense vector
+        , typename Type    // Data type of the sparse matrix
+        , size_t N         // Number of rows and columns of the blocks
+        , typename VT2 >   // Type of the right-hand side dense vector
+inline void bsrmvKernel( VT1& y, const BlockCompressedMatrix<Type,N>& A, const VT2& x,
+                         size_t ibegin, size_t iend )
+{
+   AlignedArray<Type,BlockCompressedMatrix<Type,N>::spacing> tmp;
+   Type xtmp[N];
+
+   for( size_t i=ibegin; i<iend; ++i )
+   {
+      for( size_t l=0UL; l<BlockCompressedMatrix<Type,N>::spacing; ++l )
+         reset( tmp[l] );
+
+      for( size_t k=A.offset(i); k<A.offset(i+1UL); ++k )
+      {
+         const size_t j( A.index(k)*N );
+
+         for( size_t l=0UL; l<N; ++l )
+            xtmp[l] = x[j+l];
+
+         addBlockProduct<N>( tmp.data(), A.block(k), xtmp );
+      }
+
+      for( size_t l=0UL; l<N; ++l )
+         y[i*N+l] = tmp[l];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Task for the parallel block compressed matrix/dense vector multiplication.
+// \ingroup block_compressed_matrix
+*/
+template< typename VT1     // Type of the target dense vector
+        , typename Type    // Data type of the sparse matrix
+        , size_t N         // Number of rows and columns of the blocks
+        , typename VT2 >   // Type of the right-hand side dense vector
+struct BsrmvTask
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the BsrmvTask class template.
+   //
+   // \param y The target dense vector.
+   // \param A The left-hand side block compressed matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param ibegin The index of the first block row to be computed.
+   // \param iend The index one past the last block row to be computed.
+   */
+   explicit inline BsrmvTask( VT1& y, const BlockCompressedMatrix<Type,N>& A, const VT2& x,
+                              size_t ibegin, size_t iend )
+      : y_     ( &y )      // The target dense vector
+      , A_     ( &A )      // The left-hand side block compressed matrix operand
+      , x_     ( &x )      // The right-hand side dense vector operand
+      , ibegin_( ibegin )  // The index of the first block row
+      , iend_  ( iend )    // The index one past the last block row
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the assigned range of block rows.
+   //
+   // \return void
+   */
+   inline void operator()() {
+      bsrmvKernel( *y_, *A_, *x_, ibegin_, iend_ );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   VT1*                                 y_;       //!< The target dense vector.
+   const BlockCompressedMatrix<Type,N>* A_;       //!< The left-hand side block compressed matrix operand.
+   const VT2*                           x_;       //!< The right-hand side dense vector operand.
+   size_t                               ibegin_;  //!< The index of the first block row.
+   size_t                               iend_;    //!< The index one past the last block row.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the block compressed matrix/dense vector multiplication.
+// \ingroup block_compressed_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side block compressed matrix operand.
+// \param x The right-hand side dense vector operand.
+// \return void
+//
+// In case the shared-memory parallelization is active and the target vector is large enough,
+// the block rows of the matrix are partitioned into ranges that are computed concurrently.
+// Within a serial section or in case the target vector is small, the computation is performed
+// serially.
+*/
+template< typename VT1     // Type of the target dense vector
+        , typename Type    // Data type of the sparse matrix
+        , size_t N         // Number of rows and columns of the blocks
+        , typename VT2 >   // Type of the right-hand side dense vector
+void bsrmvBackend( VT1& y, const BlockCompressedMatrix<Type,N>& A, const VT2& x )
+{
+   const size_t m( A.blockRows() );
+
+#if BLAZE_OPENMP_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   if( isSerialSectionActive() || isParallelSectionActive() || A.rows() <= SMP_SMATDVECMULT_THRESHOLD ) {
+      bsrmvKernel( y, A, x, 0UL, m );
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+#  if BLAZE_OPENMP_PARALLEL_MODE
+      const size_t tasks( omp_get_max_threads() * SMP_TASKS_PER_THREAD );
+#  else
+      const size_t tasks( TheThreadBackend::size() * SMP_TASKS_PER_THREAD );
+#  endif
+      const size_t addon( ( ( m % tasks ) != 0UL )? 1UL : 0UL );
+      const size_t sizePerTask( m / tasks + addon );
+
+#  if BLAZE_OPENMP_PARALLEL_MODE
+#pragma omp parallel for schedule(dynamic,1) shared( y, A, x )
+      for( int i=0; i<static_cast<int>( tasks ); ++i )
+      {
+         const size_t ibegin( i*sizePerTask );
+
+         if( ibegin >= m )
+            continue;
+
+         bsrmvKernel( y, A, x, ibegin, min( ibegin+sizePerTask, m ) );
+      }
+#  else
+      for( size_t i=0UL; i<tasks; ++i )
+      {
+         const size_t ibegin( i*sizePerTask );
+
+         if( ibegin >= m )
+            break;
+
+         TheThreadBackend::scheduleTask(
+            BsrmvTask<VT1,Type,N,VT2>( y, A, x, ibegin, min( ibegin+sizePerTask, m ) ) );
+      }
+
+      TheThreadBackend::wait();
+#  endif
+   }
+#else
+   bsrmvKernel( y, A, x, 0UL, m );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BLOCK COMPRESSED MATRIX/DENSE VECTOR MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication of a block compressed matrix and a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup block_compressed_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side block compressed matrix operand.
+// \param x The right-hand side dense vector operand.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function computes the product of the given block compressed matrix and the dense vector
+// \a x and assigns the result to the dense vector \a y. The size of \a x has to match the
+// number of columns of \a A and the size of \a y has to match the number of rows of \a A.
+// Otherwise a \a std::invalid_argument exception is thrown.
+*/
+template< typename VT1     // Type of the target dense vector
+        , typename Type    // Data type of the sparse matrix
+        , size_t N         // Number of rows and columns of the blocks
+        , typename VT2 >   // Type of the right-hand side dense vector
+void multiply( DenseVector<VT1,false>& y, const BlockCompressedMatrix<Type,N>& A,
+               const DenseVector<VT2,false>& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef typename VT2::ResultType     RT;
+   typedef typename VT2::CompositeType  CT;
+
+   if( (~y).size() != A.rows() || (~x).size() != A.columns() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   if( (~x).isAliased( &(~y) ) ) {
+      const RT tmp( ~x );
+      bsrmvBackend( ~y, A, tmp );
+   }
+   else {
+      CT tmp( ~x );
+      bsrmvBackend( ~y, A, tmp );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -382,8 +382,9 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
    //**Low-level utility functions*****************************************************************
    /*!\name Low-level utility functions */
    //@{
-   inline void append  ( size_t i, size_t j, const Type& value, bool check=false );
-   inline void finalize( size_t i );
+   inline void append   ( size_t i, size_t j, const Type& value, bool check=false );
+   inline void finalize ( size_t i );
+          void partition( const size_t* offsets );
    //@}
    //**********************************************************************************************
 
@@ -489,11 +490,11 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix()
 template< typename Type  // Data type of the sparse matrix
         , bool SO >      // Storage order
 inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n )
-   : m_       ( m )                     // The current number of rows of the sparse matrix
-   , n_       ( n )                     // The current number of columns of the sparse matrix
-   , capacity_( m )                     // The current capacity of the pointer array
-   , begin_( new Iterator[2UL*m+2UL] )  // Pointers to the first non-zero element of each row
-   , end_  ( begin_+(m+1UL) )           // Pointers one past the last non-zero element of each row
+   : m_       ( m )                          // The current number of rows of the sparse matrix
+   , n_       ( checkSparseDimension( n ) )  // The current number of columns of the sparse matrix
+   , capacity_( m )                          // The current capacity of the pointer array
+   , begin_( new Iterator[2UL*m+2UL] )       // Pointers to the first non-zero element of each row
+   , end_  ( begin_+(m+1UL) )                // Pointers one past the last non-zero element of each row
 {
    for( size_t i=0UL; i<2UL*m_+2UL; ++i )
       begin_[i] = NULL;
@@ -513,11 +514,11 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n )
 template< typename Type  // Data type of the sparse matrix
         , bool SO >      // Storage order
 inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
-   : m_       ( m )                     // The current number of rows of the sparse matrix
-   , n_       ( n )                     // The current number of columns of the sparse matrix
-   , capacity_( m )                     // The current capacity of the pointer array
-   , begin_( new Iterator[2UL*m+2UL] )  // Pointers to the first non-zero element of each row
-   , end_  ( begin_+(m+1UL) )           // Pointers one past the last non-zero element of each row
+   : m_       ( m )                          // The current number of rows of the sparse matrix
+   , n_       ( checkSparseDimension( n ) )  // The current number of columns of the sparse matrix
+   , capacity_( m )                          // The current capacity of the pointer array
+   , begin_( new Iterator[2UL*m+2UL] )       // Pointers to the first non-zero element of each row
+   , end_  ( begin_+(m+1UL) )                // Pointers one past the last non-zero element of each row
 {
    begin_[0UL] = allocate<Element>( nonzeros );
    for( size_t i=1UL; i<(2UL*m_+1UL); ++i )
@@ -541,11 +542,11 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, size_t n
 template< typename Type  // Data type of the sparse matrix
         , bool SO >      // Storage order
 CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
-   : m_       ( m )                      // The current number of rows of the sparse matrix
-   , n_       ( n )                      // The current number of columns of the sparse matrix
-   , capacity_( m )                      // The current capacity of the pointer array
-   , begin_( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
-   , end_  ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
+   : m_       ( m )                          // The current number of rows of the sparse matrix
+   , n_       ( checkSparseDimension( n ) )  // The current number of columns of the sparse matrix
+   , capacity_( m )                          // The current capacity of the pointer array
+   , begin_( new Iterator[2UL*m_+2UL] )      // Pointers to the first non-zero element of each row
+   , end_  ( begin_+(m_+1UL) )               // Pointers one past the last non-zero element of each row
 {
    BLAZE_USER_ASSERT( nonzeros.size() == m, "Size of capacity vector and number of rows don't match" );
 
@@ -595,18 +596,16 @@ template< typename Type  // Data type of the sparse matrix
 template< typename MT    // Type of the foreign dense matrix
         , bool SO2 >     // Storage order of the foreign dense matrix
 inline CompressedMatrix<Type,SO>::CompressedMatrix( const DenseMatrix<MT,SO2>& dm )
-   : m_       ( (~dm).rows() )              // The current number of rows of the sparse matrix
-   , n_       ( (~dm).columns() )           // The current number of columns of the sparse matrix
-   , capacity_( m_ )                        // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
-   , end_     ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
+   : m_       ( (~dm).rows() )                             // The current number of rows of the sparse matrix
+   , n_       ( checkSparseDimension( (~dm).columns() ) )  // The current number of columns of the sparse matrix
+   , capacity_( m_ )                                       // The current capacity of the pointer array
+   , begin_   ( new Iterator[2UL*m_+2UL] )                 // Pointers to the first non-zero element of each row
+   , end_     ( begin_+(m_+1UL) )                          // Pointers one past the last non-zero element of each row
 {
-   using blaze::assign;
-
    for( size_t i=0UL; i<2UL*m_+2UL; ++i )
       begin_[i] = NULL;
 
-   assign( *this, ~dm );
+   smpAssign( *this, ~dm );
 }
 //*************************************************************************************************
 
@@ -621,14 +620,12 @@ template< typename Type  // Data type of the sparse matrix
 template< typename MT    // Type of the foreign sparse matrix
         , bool SO2 >     // Storage order of the foreign sparse matrix
 inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>& sm )
-   : m_       ( (~sm).rows() )              // The current number of rows of the sparse matrix
-   , n_       ( (~sm).columns() )           // The current number of columns of the sparse matrix
-   , capacity_( m_ )                        // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
-   , end_     ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
+   : m_       ( (~sm).rows() )                             // The current number of rows of the sparse matrix
+   , n_       ( checkSparseDimension( (~sm).columns() ) )  // The current number of columns of the sparse matrix
+   , capacity_( m_ )                                       // The current capacity of the pointer array
+   , begin_   ( new Iterator[2UL*m_+2UL] )                 // Pointers to the first non-zero element of each row
+   , end_     ( begin_+(m_+1UL) )                          // Pointers one past the last non-zero element of each row
 {
-   using blaze::assign;
-
    const size_t nonzeros( (~sm).nonZeros() );
 
    begin_[0UL] = allocate<Element>( nonzeros );
@@ -636,7 +633,7 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>&
       begin_[i+1UL] = end_[i] = begin_[0UL];
    end_[m_] = begin_[0UL]+nonzeros;
 
-   assign( *this, ~sm );
+   smpAssign( *this, ~sm );
 }
 //*************************************************************************************************
 
@@ -920,15 +917,14 @@ template< typename MT    // Type of the right-hand side dense matrix
 inline CompressedMatrix<Type,SO>&
    CompressedMatrix<Type,SO>::operator=( const DenseMatrix<MT,SO2>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ) {
       CompressedMatrix tmp( ~rhs );
       swap( tmp );
    }
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
-      assign( *this, ~rhs );
+      reset();
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -952,8 +948,6 @@ template< typename MT    // Type of the right-hand side sparse matrix
 inline CompressedMatrix<Type,SO>&
    CompressedMatrix<Type,SO>::operator=( const SparseMatrix<MT,SO2>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ||
        (~rhs).rows()     > capacity_ ||
        (~rhs).nonZeros() > capacity() ) {
@@ -963,7 +957,7 @@ inline CompressedMatrix<Type,SO>&
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
       reset();
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -988,12 +982,10 @@ template< typename MT    // Type of the right-hand side matrix
 inline CompressedMatrix<Type,SO>&
    CompressedMatrix<Type,SO>::operator+=( const Matrix<MT,SO2>& rhs )
 {
-   using blaze::addAssign;
-
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ )
       throw std::invalid_argument( "Matrix sizes do not match" );
 
-   addAssign( *this, ~rhs );
+   smpAddAssign( *this, ~rhs );
    return *this;
 }
 //*************************************************************************************************
@@ -1015,12 +1007,10 @@ template< typename MT    // Type of the right-hand side matrix
         , bool SO2 >     // Storage order of the right-hand side matrix
 inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::operator-=( const Matrix<MT,SO2>& rhs )
 {
-   using blaze::subAssign;
-
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ )
       throw std::invalid_argument( "Matrix sizes do not match" );
 
-   subAssign( *this, ~rhs );
+   smpSubAssign( *this, ~rhs );
    return *this;
 }
 //*************************************************************************************************
@@ -1526,6 +1516,8 @@ void CompressedMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
 
    if( m == m_ && n == n_ ) return;
 
+   checkSparseDimension( n );
+
    if( m > capacity_ )
    {
       Iterator* newBegin( new Iterator[2UL*m+2UL] );
@@ -2121,6 +2113,50 @@ inline void CompressedMatrix<Type,SO>::finalize( size_t i )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Partitioning the storage of the sparse matrix among its rows/columns.
+//
+// \param offsets The offsets of the first element of each row/column (\f$ M+1 \f$ or \f$ N+1 \f$ values).
+// \return void
+//
+// This function is part of the low-level interface to efficiently fill a matrix with elements.
+// It removes all elements from the sparse matrix, makes sure the capacity of the matrix is at
+// least \a offsets[M] (or \a offsets[N]), and lets row/column \a i start at \a offsets[i]. The
+// given offsets are required to start at 0 and to be non-decreasing. Afterwards each row/column
+// \a i can be filled with up to \f$ offsets[i+1]-offsets[i] \f$ elements via the append()
+// function. Since the filling of a row/column does not affect any other row/column, different
+// rows/columns can be filled concurrently. The finalize() function must not be used in
+// combination with this function.
+//
+// \b Note: Since this function resets the matrix, it invalidates all iterators!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO >      // Storage order
+void CompressedMatrix<Type,SO>::partition( const size_t* offsets )
+{
+   BLAZE_USER_ASSERT( offsets[0UL] == 0UL, "Invalid offset of the first row" );
+
+   const size_t nonzeros( offsets[m_] );
+
+   if( nonzeros > capacity() ) {
+      Iterator newStorage( allocate<Element>( nonzeros ) );
+      std::swap( newStorage, begin_[0UL] );
+      deallocate( newStorage );
+      end_[m_] = begin_[0UL] + nonzeros;
+   }
+
+   const Iterator storage( begin_[0UL] );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      BLAZE_USER_ASSERT( offsets[i] <= offsets[i+1UL], "Invalid row offsets" );
+      begin_[i] = end_[i] = storage + offsets[i];
+   }
+
+   begin_[m_] = storage + nonzeros;
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -2625,8 +2661,9 @@ class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,t
    //**Low-level utility functions*****************************************************************
    /*!\name Low-level utility functions */
    //@{
-   inline void append  ( size_t i, size_t j, const Type& value, bool check=false );
-   inline void finalize( size_t j );
+   inline void append   ( size_t i, size_t j, const Type& value, bool check=false );
+   inline void finalize ( size_t j );
+          void partition( const size_t* offsets );
    //@}
    //**********************************************************************************************
 
@@ -2734,11 +2771,11 @@ inline CompressedMatrix<Type,true>::CompressedMatrix()
 */
 template< typename Type >  // Data type of the sparse matrix
 inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n )
-   : m_       ( m )                     // The current number of rows of the sparse matrix
-   , n_       ( n )                     // The current number of columns of the sparse matrix
-   , capacity_( n )                     // The current capacity of the pointer array
-   , begin_( new Iterator[2UL*n+2UL] )  // Pointers to the first non-zero element of each column
-   , end_  ( begin_+(n+1UL) )           // Pointers one past the last non-zero element of each column
+   : m_       ( checkSparseDimension( m ) )  // The current number of rows of the sparse matrix
+   , n_       ( n )                          // The current number of columns of the sparse matrix
+   , capacity_( n )                          // The current capacity of the pointer array
+   , begin_( new Iterator[2UL*n+2UL] )       // Pointers to the first non-zero element of each column
+   , end_  ( begin_+(n+1UL) )                // Pointers one past the last non-zero element of each column
 {
    for( size_t j=0UL; j<2UL*n_+2UL; ++j )
       begin_[j] = NULL;
@@ -2759,11 +2796,11 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n )
 */
 template< typename Type >  // Data type of the sparse matrix
 inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
-   : m_       ( m )                     // The current number of rows of the sparse matrix
-   , n_       ( n )                     // The current number of columns of the sparse matrix
-   , capacity_( n )                     // The current capacity of the pointer array
-   , begin_( new Iterator[2UL*n+2UL] )  // Pointers to the first non-zero element of each column
-   , end_  ( begin_+(n+1UL) )           // Pointers one past the last non-zero element of each column
+   : m_       ( checkSparseDimension( m ) )  // The current number of rows of the sparse matrix
+   , n_       ( n )                          // The current number of columns of the sparse matrix
+   , capacity_( n )                          // The current capacity of the pointer array
+   , begin_( new Iterator[2UL*n+2UL] )       // Pointers to the first non-zero element of each column
+   , end_  ( begin_+(n+1UL) )                // Pointers one past the last non-zero element of each column
 {
    begin_[0UL] = allocate<Element>( nonzeros );
    for( size_t j=1UL; j<(2UL*n_+1UL); ++j )
@@ -2787,11 +2824,11 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, size_t
 */
 template< typename Type >  // Data type of the sparse matrix
 CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
-   : m_       ( m )                      // The current number of rows of the sparse matrix
-   , n_       ( n )                      // The current number of columns of the sparse matrix
-   , capacity_( n )                      // The current capacity of the pointer array
-   , begin_( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
-   , end_  ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
+   : m_       ( checkSparseDimension( m ) )  // The current number of rows of the sparse matrix
+   , n_       ( n )                          // The current number of columns of the sparse matrix
+   , capacity_( n )                          // The current capacity of the pointer array
+   , begin_( new Iterator[2UL*n_+2UL] )      // Pointers to the first non-zero element of each column
+   , end_  ( begin_+(n_+1UL) )               // Pointers one past the last non-zero element of each column
 {
    BLAZE_USER_ASSERT( nonzeros.size() == n, "Size of capacity vector and number of columns don't match" );
 
@@ -2843,18 +2880,16 @@ template< typename Type >  // Data type of the sparse matrix
 template< typename MT      // Type of the foreign dense matrix
         , bool SO >        // Storage order of the foreign dense matrix
 inline CompressedMatrix<Type,true>::CompressedMatrix( const DenseMatrix<MT,SO>& dm )
-   : m_       ( (~dm).rows() )              // The current number of rows of the sparse matrix
-   , n_       ( (~dm).columns() )           // The current number of columns of the sparse matrix
-   , capacity_( n_ )                        // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
-   , end_     ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
+   : m_       ( checkSparseDimension( (~dm).rows() ) )  // The current number of rows of the sparse matrix
+   , n_       ( (~dm).columns() )                       // The current number of columns of the sparse matrix
+   , capacity_( n_ )                                    // The current capacity of the pointer array
+   , begin_   ( new Iterator[2UL*n_+2UL] )              // Pointers to the first non-zero element of each column
+   , end_     ( begin_+(n_+1UL) )                       // Pointers one past the last non-zero element of each column
 {
-   using blaze::assign;
-
    for( size_t j=0UL; j<2UL*n_+2UL; ++j )
       begin_[j] = NULL;
 
-   assign( *this, ~dm );
+   smpAssign( *this, ~dm );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -2870,14 +2905,12 @@ template< typename Type >  // Data type of the sparse matrix
 template< typename MT      // Type of the foreign sparse matrix
         , bool SO >        // Storage order of the foreign sparse matrix
 inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>& sm )
-   : m_       ( (~sm).rows() )              // The current number of rows of the sparse matrix
-   , n_       ( (~sm).columns() )           // The current number of columns of the sparse matrix
-   , capacity_( n_ )                        // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
-   , end_     ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
+   : m_       ( checkSparseDimension( (~sm).rows() ) )  // The current number of rows of the sparse matrix
+   , n_       ( (~sm).columns() )                       // The current number of columns of the sparse matrix
+   , capacity_( n_ )                                    // The current capacity of the pointer array
+   , begin_   ( new Iterator[2UL*n_+2UL] )              // Pointers to the first non-zero element of each column
+   , end_     ( begin_+(n_+1UL) )                       // Pointers one past the last non-zero element of each column
 {
-   using blaze::assign;
-
    const size_t nonzeros( (~sm).nonZeros() );
 
    begin_[0UL] = allocate<Element>( nonzeros );
@@ -2885,7 +2918,7 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>&
       begin_[j+1UL] = end_[j] = begin_[0UL];
    end_[n_] = begin_[0UL]+nonzeros;
 
-   assign( *this, ~sm );
+   smpAssign( *this, ~sm );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3150,15 +3183,14 @@ template< typename MT      // Type of the right-hand side dense matrix
 inline CompressedMatrix<Type,true>&
    CompressedMatrix<Type,true>::operator=( const DenseMatrix<MT,SO>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ) {
       CompressedMatrix tmp( ~rhs );
       swap( tmp );
    }
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
-      assign( *this, ~rhs );
+      reset();
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -3183,8 +3215,6 @@ template< typename MT      // Type of the right-hand side sparse matrix
 inline CompressedMatrix<Type,true>&
    CompressedMatrix<Type,true>::operator=( const SparseMatrix<MT,SO>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ||
        (~rhs).columns()  > capacity_ ||
        (~rhs).nonZeros() > capacity() ) {
@@ -3194,7 +3224,7 @@ inline CompressedMatrix<Type,true>&
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
       reset();
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -3219,12 +3249,10 @@ template< typename MT      // Type of the right-hand side matrix
         , bool SO >        // Storage order of the right-hand side matrix
 inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator+=( const Matrix<MT,SO>& rhs )
 {
-   using blaze::addAssign;
-
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ )
       throw std::invalid_argument( "Matrix sizes do not match" );
 
-   addAssign( *this, ~rhs );
+   smpAddAssign( *this, ~rhs );
    return *this;
 }
 /*! \endcond */
@@ -3247,12 +3275,10 @@ template< typename MT      // Type of the right-hand side matrix
         , bool SO >        // Storage order of the right-hand side matrix
 inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator-=( const Matrix<MT,SO>& rhs )
 {
-   using blaze::subAssign;
-
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ )
       throw std::invalid_argument( "Matrix sizes do not match" );
 
-   subAssign( *this, ~rhs );
+   smpSubAssign( *this, ~rhs );
    return *this;
 }
 /*! \endcond */
@@ -3761,6 +3787,8 @@ void CompressedMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
 
    if( m == m_ && n == n_ ) return;
 
+   checkSparseDimension( m );
+
    if( n > capacity_ )
    {
       Iterator* newBegin( new Iterator[2UL*n+2UL] );
@@ -4357,6 +4385,50 @@ inline void CompressedMatrix<Type,true>::finalize( size_t j )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitioning the storage of the sparse matrix among its columns.
+//
+// \param offsets The offsets of the first element of each column (\f$ N+1 \f$ values).
+// \return void
+//
+// This function is part of the low-level interface to efficiently fill a matrix with elements.
+// It removes all elements from the sparse matrix, makes sure the capacity of the matrix is at
+// least \a offsets[N], and lets column \a j start at \a offsets[j]. The given offsets are
+// required to start at 0 and to be non-decreasing. Afterwards each column \a j can be filled
+// with up to \f$ offsets[j+1]-offsets[j] \f$ elements via the append() function. Since the
+// filling of a column does not affect any other column, different columns can be filled
+// concurrently. The finalize() function must not be used in combination with this function.
+//
+// \b Note: Since this function resets the matrix, it invalidates all iterators!
+*/
+template< typename Type >  // Data type of the sparse matrix
+void CompressedMatrix<Type,true>::partition( const size_t* offsets )
+{
+   BLAZE_USER_ASSERT( offsets[0UL] == 0UL, "Invalid offset of the first column" );
+
+   const size_t nonzeros( offsets[n_] );
+
+   if( nonzeros > capacity() ) {
+      Iterator newStorage( allocate<Element>( nonzeros ) );
+      std::swap( newStorage, begin_[0UL] );
+      deallocate( newStorage );
+      end_[n_] = begin_[0UL] + nonzeros;
+   }
+
+   const Iterator storage( begin_[0UL] );
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      BLAZE_USER_ASSERT( offsets[j] <= offsets[j+1UL], "Invalid column offsets" );
+      begin_[j] = end_[j] = storage + offsets[j];
+   }
+
+   begin_[n_] = storage + nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
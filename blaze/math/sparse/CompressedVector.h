@@ -448,10 +448,10 @@ inline CompressedVector<Type,TF>::CompressedVector()
 template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 inline CompressedVector<Type,TF>::CompressedVector( size_t n )
-   : size_    ( n   )   // The current size/dimension of the compressed vector
-   , capacity_( 0UL )   // The maximum capacity of the compressed vector
-   , begin_   ( NULL )  // Pointer to the first non-zero element of the compressed vector
-   , end_     ( NULL )  // Pointer to the last non-zero element of the compressed vector
+   : size_    ( checkSparseDimension( n ) )  // The current size/dimension of the compressed vector
+   , capacity_( 0UL )                        // The maximum capacity of the compressed vector
+   , begin_   ( NULL )                       // Pointer to the first non-zero element of the compressed vector
+   , end_     ( NULL )                       // Pointer to the last non-zero element of the compressed vector
 {}
 //*************************************************************************************************
 
@@ -465,7 +465,7 @@ inline CompressedVector<Type,TF>::CompressedVector( size_t n )
 template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 inline CompressedVector<Type,TF>::CompressedVector( size_t n, size_t nonzeros )
-   : size_    ( n )                               // The current size/dimension of the compressed vector
+   : size_    ( checkSparseDimension( n ) )       // The current size/dimension of the compressed vector
    , capacity_( nonzeros )                        // The maximum capacity of the compressed vector
    , begin_   ( allocate<Element>( capacity_ ) )  // Pointer to the first non-zero element of the compressed vector
    , end_     ( begin_ )                          // Pointer to the last non-zero element of the compressed vector
@@ -503,13 +503,12 @@ template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 template< typename VT >  // Type of the foreign dense vector
 inline CompressedVector<Type,TF>::CompressedVector( const DenseVector<VT,TF>& dv )
-   : size_    ( (~dv).size() )  // The current size/dimension of the compressed vector
-   , capacity_( 0UL  )          // The maximum capacity of the compressed vector
-   , begin_   ( NULL )          // Pointer to the first non-zero element of the compressed vector
-   , end_     ( NULL )          // Pointer to the last non-zero element of the compressed vector
+   : size_    ( checkSparseDimension( (~dv).size() ) )  // The current size/dimension of the compressed vector
+   , capacity_( 0UL  )                                  // The maximum capacity of the compressed vector
+   , begin_   ( NULL )                                  // Pointer to the first non-zero element of the compressed vector
+   , end_     ( NULL )                                  // Pointer to the last non-zero element of the compressed vector
 {
-   using blaze::assign;
-   assign( *this, ~dv );
+   smpAssign( *this, ~dv );
 }
 //*************************************************************************************************
 
@@ -523,13 +522,12 @@ template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 template< typename VT >  // Type of the foreign sparse vector
 inline CompressedVector<Type,TF>::CompressedVector( const SparseVector<VT,TF>& sv )
-   : size_    ( (~sv).size() )                    // The current size/dimension of the compressed vector
-   , capacity_( (~sv).nonZeros() )                // The maximum capacity of the compressed vector
-   , begin_   ( allocate<Element>( capacity_ ) )  // Pointer to the first non-zero element of the compressed vector
-   , end_     ( begin_ )                          // Pointer to the last non-zero element of the compressed vector
+   : size_    ( checkSparseDimension( (~sv).size() ) )  // The current size/dimension of the compressed vector
+   , capacity_( (~sv).nonZeros() )                      // The maximum capacity of the compressed vector
+   , begin_   ( allocate<Element>( capacity_ ) )        // Pointer to the first non-zero element of the compressed vector
+   , end_     ( begin_ )                                // Pointer to the last non-zero element of the compressed vector
 {
-   using blaze::assign;
-   assign( *this, ~sv );
+   smpAssign( *this, ~sv );
 }
 //*************************************************************************************************
 
@@ -752,8 +750,6 @@ template< typename VT >  // Type of the right-hand side dense vector
 inline CompressedVector<Type,TF>&
    CompressedVector<Type,TF>::operator=( const DenseVector<VT,TF>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ) {
       CompressedVector tmp( ~rhs );
       swap( tmp );
@@ -761,7 +757,7 @@ inline CompressedVector<Type,TF>&
    else {
       size_ = (~rhs).size();
       end_  = begin_;
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -784,8 +780,6 @@ template< typename VT >  // Type of the right-hand side sparse vector
 inline CompressedVector<Type,TF>&
    CompressedVector<Type,TF>::operator=( const SparseVector<VT,TF>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) || (~rhs).nonZeros() > capacity_ ) {
       CompressedVector tmp( ~rhs );
       swap( tmp );
@@ -793,7 +787,7 @@ inline CompressedVector<Type,TF>&
    else {
       size_ = (~rhs).size();
       end_  = begin_;
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -816,12 +810,10 @@ template< typename Type  // Data type of the vector
 template< typename VT >  // Type of the right-hand side vector
 inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator+=( const Vector<VT,TF>& rhs )
 {
-   using blaze::addAssign;
-
    if( (~rhs).size() != size_ )
       throw std::invalid_argument( "Vector sizes do not match" );
 
-   addAssign( *this, ~rhs );
+   smpAddAssign( *this, ~rhs );
 
    return *this;
 }
@@ -843,12 +835,10 @@ template< typename Type  // Data type of the vector
 template< typename VT >  // Type of the right-hand side vector
 inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator-=( const Vector<VT,TF>& rhs )
 {
-   using blaze::subAssign;
-
    if( (~rhs).size() != size_ )
       throw std::invalid_argument( "Vector sizes do not match" );
 
-   subAssign( *this, ~rhs );
+   smpSubAssign( *this, ~rhs );
 
    return *this;
 }
@@ -1214,6 +1204,8 @@ template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 inline void CompressedVector<Type,TF>::resize( size_t n, bool preserve )
 {
+   checkSparseDimension( n );
+
    if( preserve ) {
       end_ = lowerBound( n );
    }
@@ -0,0 +1,1256 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SMMM.h
+//  \brief Header file for the sparse matrix/sparse matrix multiplication kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_SMMM_H_
+#define _BLAZE_MATH_SPARSE_SMMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/SMP.h>
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+#  include <omp.h>
+#elif BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+#  include <blaze/math/smp/threads/ThreadBackend.h>
+#endif
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/system/ThreadLocal.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ACCUMULATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Density cutoff of the accumulators of the sparse matrix/sparse matrix multiplication.
+// \ingroup sparse_matrix
+//
+// A row (or column for column-major matrices) of a sparse matrix product is accumulated in a
+// dense accumulator if the number of scalar multiplications of the row/column is at least the
+// 1/smmmDenseCutoff-th part of its length. All other rows/columns are accumulated in a hash
+// table, whose size is proportional to the number of scalar multiplications.
+*/
+const size_t smmmDenseCutoff = 256UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Base class of the thread-local workspaces of the sparse matrix multiplication kernels.
+// \ingroup sparse_matrix
+//
+// The workspaces of a thread are linked in a list, which allows to release the workspaces of
+// all element types via the releaseSMMMWorkspace() function.
+*/
+struct SMMMWorkspaceBase
+{
+   virtual ~SMMMWorkspaceBase() {}
+
+   SMMMWorkspaceBase*  next_;   //!< The next workspace of the calling thread.
+   SMMMWorkspaceBase** owner_;  //!< The thread-local pointer referring to the workspace.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Thread-local workspace of the sparse matrix/sparse matrix multiplication kernels.
+// \ingroup sparse_matrix
+//
+// The SMMMWorkspace class template holds the dense accumulator, the hash accumulator and the
+// buffers for the indices and values of a single row/column of a sparse matrix product. Every
+// thread owns one workspace per element type (see the smmmWorkspace() function), which grows
+// on demand and is reused by all subsequent products computed by the thread until it is
+// released via the releaseSMMMWorkspace() function.
+*/
+template< typename ET >  // Element type of the accumulators
+struct SMMMWorkspace : public SMMMWorkspaceBase
+{
+   std::vector<ET>     values_;   //!< The values of the dense accumulator.
+   std::vector<size_t> marker_;   //!< The row/column markers of the dense accumulator.
+   size_t              stamp_;    //!< The marker of the current row/column.
+   std::vector<size_t> keys_;     //!< The keys of the hash accumulator.
+   std::vector<ET>     entries_;  //!< The values of the hash accumulator.
+   std::vector<size_t> indices_;  //!< The sorted indices of the current row/column.
+   std::vector<ET>     results_;  //!< The values of the current row/column.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the list of the workspaces of the calling thread.
+// \ingroup sparse_matrix
+//
+// \return Reference to the thread-local head of the list.
+*/
+inline SMMMWorkspaceBase*& smmmWorkspaceList()
+{
+   static BLAZE_THREAD_LOCAL SMMMWorkspaceBase* list;
+   return list;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the workspace of the sparse matrix/sparse matrix multiplication kernels of the
+//        calling thread.
+// \ingroup sparse_matrix
+//
+// \return Reference to the thread-local workspace.
+// \exception std::bad_alloc Allocation failed.
+//
+// The workspace is created on the first call within a thread and is kept until it is released
+// via the releaseSMMMWorkspace() function. Therefore the accumulators are allocated once per
+// thread instead of once per product.
+*/
+template< typename ET >  // Element type of the accumulators
+inline SMMMWorkspace<ET>& smmmWorkspace()
+{
+   static BLAZE_THREAD_LOCAL SMMMWorkspaceBase* workspace;
+
+   if( workspace == NULL ) {
+      SMMMWorkspace<ET>* ws( new SMMMWorkspace<ET>() );
+      ws->stamp_ = 0UL;
+      ws->next_  = smmmWorkspaceList();
+      ws->owner_ = &workspace;
+      smmmWorkspaceList() = ws;
+      workspace = ws;
+   }
+
+   return *static_cast<SMMMWorkspace<ET>*>( workspace );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Setup of the dense accumulator of the given workspace.
+// \ingroup sparse_matrix
+//
+// \param ws The workspace.
+// \param n The length of the rows/columns of the product.
+// \return The marker of the next row/column.
+*/
+template< typename ET >  // Element type of the accumulators
+inline size_t smmmDenseSetup( SMMMWorkspace<ET>& ws, size_t n )
+{
+   if( ws.marker_.size() < n ) {
+      ws.values_.resize( n );
+      ws.marker_.resize( n, 0UL );
+   }
+
+   return ++ws.stamp_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Setup of the hash accumulator of the given workspace.
+// \ingroup sparse_matrix
+//
+// \param ws The workspace.
+// \param entries The maximum number of entries of the hash table.
+// \param empty The key of an empty slot.
+// \return The number of slots of the hash table (a power of two).
+//
+// This function clears a hash table with at least twice as many slots as the given number of
+// entries.
+*/
+template< typename ET >  // Element type of the accumulators
+inline size_t smmmHashSetup( SMMMWorkspace<ET>& ws, size_t entries, size_t empty )
+{
+   size_t slots( 16UL );
+   while( slots < entries + entries )
+      slots += slots;
+
+   if( ws.keys_.size() < slots ) {
+      ws.keys_.resize( slots );
+      ws.entries_.resize( slots );
+   }
+
+   std::fill( ws.keys_.begin(), ws.keys_.begin() + slots, empty );
+
+   return slots;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the slot of the given key within a hash accumulator.
+// \ingroup sparse_matrix
+//
+// \param keys The keys of the hash table.
+// \param key The key to be searched.
+// \param mask The number of slots of the hash table minus one.
+// \param empty The key of an empty slot.
+// \return The slot of the given key or the first empty slot in its probe sequence.
+*/
+inline size_t smmmHashFind( const size_t* keys, size_t key, size_t mask, size_t empty )
+{
+   size_t slot( ( key * 107UL ) & mask );
+
+   while( keys[slot] != key && keys[slot] != empty )
+      slot = ( slot + 1UL ) & mask;
+
+   return slot;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of scalar multiplications of a row/column of a sparse matrix/sparse
+//        matrix multiplication.
+// \ingroup sparse_matrix
+//
+// \param L The left-hand side sparse matrix operand.
+// \param R The right-hand side sparse matrix operand.
+// \param i The index of the row/column.
+// \return The number of scalar multiplications of the row/column.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side sparse matrix
+        , bool SO >     // Storage order of both sparse matrices
+inline size_t smmmFlops( const SparseMatrix<MT1,SO>& L, const SparseMatrix<MT2,SO>& R, size_t i )
+{
+   typedef typename MT1::ConstIterator  LeftIterator;
+
+   size_t flops( 0UL );
+
+   const LeftIterator lend( (~L).end(i) );
+   for( LeftIterator lelem=(~L).begin(i); lelem!=lend; ++lelem ) {
+      flops += (~R).nonZeros( lelem->index() );
+   }
+
+   return flops;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROW KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the structure of a row/column of a sparse matrix/sparse matrix multiplication.
+// \ingroup sparse_matrix
+//
+// \param ws The workspace of the calling thread.
+// \param L The left-hand side sparse matrix operand.
+// \param R The right-hand side sparse matrix operand.
+// \param i The index of the row/column.
+// \param flops The number of scalar multiplications of the row/column.
+// \param sorted \a true if the indices are required in ascending order, \a false if not.
+// \return The number of structural non-zero elements of the row/column.
+//
+// This function performs the symbolic phase of the Gustavson algorithm for a single row of
+// \f$ L*R \f$ (row-major matrices) or a single column of \f$ R*L \f$ (column-major matrices).
+// The indices of the structural non-zero elements are stored in the index buffer of the given
+// workspace.
+*/
+template< typename ET   // Element type of the accumulators
+        , typename MT1  // Type of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side sparse matrix
+        , bool SO >     // Storage order of both sparse matrices
+size_t smmmRowStructure( SMMMWorkspace<ET>& ws, const SparseMatrix<MT1,SO>& L,
+                         const SparseMatrix<MT2,SO>& R, size_t i, size_t flops, bool sorted )
+{
+   typedef typename MT1::ConstIterator  LeftIterator;
+   typedef typename MT2::ConstIterator  RightIterator;
+
+   const size_t n( SO ? (~R).rows() : (~R).columns() );
+
+   if( flops == 0UL )
+      return 0UL;
+
+   if( ws.indices_.size() < min( flops, n ) )
+      ws.indices_.resize( min( flops, n ) );
+
+   size_t* const indices( &ws.indices_[0] );
+   size_t count( 0UL );
+
+   const LeftIterator lend( (~L).end(i) );
+
+   if( flops * smmmDenseCutoff >= n )
+   {
+      const size_t stamp( smmmDenseSetup( ws, n ) );
+      size_t* const marker( &ws.marker_[0] );
+      size_t minIndex( n ), maxIndex( 0UL );
+
+      for( LeftIterator lelem=(~L).begin(i); lelem!=lend; ++lelem ) {
+         const RightIterator rend( (~R).end( lelem->index() ) );
+         for( RightIterator relem=(~R).begin( lelem->index() ); relem!=rend; ++relem ) {
+            const size_t j( relem->index() );
+            if( marker[j] != stamp ) {
+               marker[j] = stamp;
+               indices[count] = j;
+               ++count;
+               if( j < minIndex ) minIndex = j;
+               if( j > maxIndex ) maxIndex = j;
+            }
+         }
+      }
+
+      if( sorted && count > 1UL ) {
+         if( ( count + count ) < ( maxIndex - minIndex ) ) {
+            std::sort( indices, indices + count );
+         }
+         else {
+            count = 0UL;
+            for( size_t j=minIndex; j<=maxIndex; ++j ) {
+               if( marker[j] == stamp ) {
+                  indices[count] = j;
+                  ++count;
+               }
+            }
+         }
+      }
+   }
+   else
+   {
+      const size_t mask( smmmHashSetup( ws, flops, n ) - 1UL );
+      size_t* const keys( &ws.keys_[0] );
+
+      for( LeftIterator lelem=(~L).begin(i); lelem!=lend; ++lelem ) {
+         const RightIterator rend( (~R).end( lelem->index() ) );
+         for( RightIterator relem=(~R).begin( lelem->index() ); relem!=rend; ++relem ) {
+            const size_t slot( smmmHashFind( keys, relem->index(), mask, n ) );
+            if( keys[slot] == n ) {
+               keys[slot] = relem->index();
+               indices[count] = relem->index();
+               ++count;
+            }
+         }
+      }
+
+      if( sorted ) {
+         std::sort( indices, indices + count );
+      }
+   }
+
+   return count;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes a row/column of a sparse matrix/sparse matrix multiplication.
+// \ingroup sparse_matrix
+//
+// \param ws The workspace of the calling thread.
+// \param L The left-hand side sparse matrix operand.
+// \param R The right-hand side sparse matrix operand.
+// \param i The index of the row/column.
+// \param flops The number of scalar multiplications of the row/column.
+// \return The number of non-zero elements of the row/column.
+//
+// This function computes a single row of \f$ L*R \f$ (row-major matrices) or a single column of
+// \f$ R*L \f$ (column-major matrices) by means of the Gustavson algorithm. The indices and values
+// of the resulting non-zero elements are stored in ascending order in the index and value
+// buffers of the given workspace. Elements that cancel out numerically are not stored.
+*/
+template< typename ET   // Element type of the accumulators
+        , typename MT1  // Type of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side sparse matrix
+        , bool SO >     // Storage order of both sparse matrices
+size_t smmmRowProduct( SMMMWorkspace<ET>& ws, const SparseMatrix<MT1,SO>& L,
+                       const SparseMatrix<MT2,SO>& R, size_t i, size_t flops )
+{
+   typedef typename MT1::ConstIterator  LeftIterator;
+   typedef typename MT2::ConstIterator  RightIterator;
+
+   const size_t n( SO ? (~R).rows() : (~R).columns() );
+
+   if( flops == 0UL )
+      return 0UL;
+
+   if( ws.indices_.size() < min( flops, n ) )
+      ws.indices_.resize( min( flops, n ) );
+
+   if( ws.results_.size() < min( flops, n ) )
+      ws.results_.resize( min( flops, n ) );
+
+   size_t* const indices( &ws.indices_[0] );
+   ET*     const results( &ws.results_[0] );
+   size_t count( 0UL ), nonzeros( 0UL );
+
+   const LeftIterator lend( (~L).end(i) );
+
+   if( flops * smmmDenseCutoff >= n )
+   {
+      const size_t stamp( smmmDenseSetup( ws, n ) );
+      size_t* const marker( &ws.marker_[0] );
+      ET*     const values( &ws.values_[0] );
+      size_t minIndex( n ), maxIndex( 0UL );
+
+      for( LeftIterator lelem=(~L).begin(i); lelem!=lend; ++lelem )
+      {
+         const RightIterator rend( (~R).end( lelem->index() ) );
+         for( RightIterator relem=(~R).begin( lelem->index() ); relem!=rend; ++relem )
+         {
+            const size_t j( relem->index() );
+
+            if( marker[j] != stamp ) {
+               marker[j] = stamp;
+               values[j] = lelem->value() * relem->value();
+               indices[count] = j;
+               ++count;
+               if( j < minIndex ) minIndex = j;
+               if( j > maxIndex ) maxIndex = j;
+            }
+            else {
+               values[j] += lelem->value() * relem->value();
+            }
+         }
+      }
+
+      if( ( count + count ) < ( maxIndex - minIndex ) )
+      {
+         std::sort( indices, indices + count );
+
+         for( size_t jj=0UL; jj<count; ++jj ) {
+            const size_t j( indices[jj] );
+            if( !isDefault( values[j] ) ) {
+               indices[nonzeros] = j;
+               results[nonzeros] = values[j];
+               ++nonzeros;
+            }
+         }
+      }
+      else
+      {
+         for( size_t j=minIndex; j<=maxIndex; ++j ) {
+            if( marker[j] == stamp && !isDefault( values[j] ) ) {
+               indices[nonzeros] = j;
+               results[nonzeros] = values[j];
+               ++nonzeros;
+            }
+         }
+      }
+   }
+   else
+   {
+      const size_t mask( smmmHashSetup( ws, flops, n ) - 1UL );
+      size_t* const keys   ( &ws.keys_[0] );
+      ET*     const entries( &ws.entries_[0] );
+
+      for( LeftIterator lelem=(~L).begin(i); lelem!=lend; ++lelem )
+      {
+         const RightIterator rend( (~R).end( lelem->index() ) );
+         for( RightIterator relem=(~R).begin( lelem->index() ); relem!=rend; ++relem )
+         {
+            const size_t slot( smmmHashFind( keys, relem->index(), mask, n ) );
+
+            if( keys[slot] == n ) {
+               keys[slot]    = relem->index();
+               entries[slot] = lelem->value() * relem->value();
+               indices[count] = relem->index();
+               ++count;
+            }
+            else {
+               entries[slot] += lelem->value() * relem->value();
+            }
+         }
+      }
+
+      std::sort( indices, indices + count );
+
+      for( size_t jj=0UL; jj<count; ++jj ) {
+         const size_t j( indices[jj] );
+         const size_t slot( smmmHashFind( keys, j, mask, n ) );
+         if( !isDefault( entries[slot] ) ) {
+            indices[nonzeros] = j;
+            results[nonzeros] = entries[slot];
+            ++nonzeros;
+         }
+      }
+   }
+
+   return nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Recomputes a row/column of a sparse matrix/sparse matrix multiplication within a fixed
+//        sparsity pattern.
+// \ingroup sparse_matrix
+//
+// \param ws The workspace of the calling thread.
+// \param C The target sparse matrix with a fixed sparsity pattern.
+// \param L The left-hand side sparse matrix operand.
+// \param R The right-hand side sparse matrix operand.
+// \param i The index of the row/column.
+// \return void
+//
+// This function recomputes the values of the given row/column of the target matrix without
+// modifying its sparsity pattern. The positions of the pattern are cleared in the dense
+// accumulator of the given workspace, the products are accumulated and the values are gathered
+// back into the target matrix. Since the pattern provides the sorted indices of the row/column,
+// neither a sort nor a scan of the accumulator is required, which is why the dense accumulator
+// is used independent of the number of scalar multiplications. Contributions outside of the
+// pattern are discarded.
+*/
+template< typename ET     // Element type of the accumulators
+        , typename MT1    // Type of the target sparse matrix
+        , bool SO         // Storage order of all three sparse matrices
+        , typename MT2    // Type of the left-hand side sparse matrix
+        , typename MT3 >  // Type of the right-hand side sparse matrix
+void smmmRowNumeric( SMMMWorkspace<ET>& ws, SparseMatrix<MT1,SO>& C,
+                     const SparseMatrix<MT2,SO>& L, const SparseMatrix<MT3,SO>& R, size_t i )
+{
+   typedef typename MT1::Iterator       TargetIterator;
+   typedef typename MT2::ConstIterator  LeftIterator;
+   typedef typename MT3::ConstIterator  RightIterator;
+
+   const size_t n( SO ? (~R).rows() : (~R).columns() );
+
+   const TargetIterator cend( (~C).end(i) );
+
+   if( (~C).begin(i) == cend )
+      return;
+
+   smmmDenseSetup( ws, n );
+   ET* const values( &ws.values_[0] );
+
+   for( TargetIterator celem=(~C).begin(i); celem!=cend; ++celem )
+      reset( values[celem->index()] );
+
+   const LeftIterator lend( (~L).end(i) );
+   for( LeftIterator lelem=(~L).begin(i); lelem!=lend; ++lelem ) {
+      const RightIterator rend( (~R).end( lelem->index() ) );
+      for( RightIterator relem=(~R).begin( lelem->index() ); relem!=rend; ++relem ) {
+         values[relem->index()] += lelem->value() * relem->value();
+      }
+   }
+
+   for( TargetIterator celem=(~C).begin(i); celem!=cend; ++celem )
+      celem->value() = values[celem->index()];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RANGE KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the computation of the number of non-zero elements of a range of rows or
+//        columns of a sparse matrix/sparse matrix multiplication.
+*/
+template< typename ET     // Element type of the accumulators
+        , typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2 >  // Type of the right-hand side sparse matrix
+struct SMMMCountKernel
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SMMMCountKernel class template.
+   //
+   // \param L The left-hand side sparse matrix operand.
+   // \param R The right-hand side sparse matrix operand.
+   // \param nonzeros The resulting number of non-zero elements per row/column.
+   */
+   explicit inline SMMMCountKernel( const MT1& L, const MT2& R, size_t* nonzeros )
+      : L_       ( &L )        // The left-hand side sparse matrix operand
+      , R_       ( &R )        // The right-hand side sparse matrix operand
+      , nonzeros_( nonzeros )  // The resulting number of non-zero elements
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the number of non-zero elements of the given range of rows/columns.
+   //
+   // \param ibegin The index of the first row/column to be computed.
+   // \param iend The index one past the last row/column to be computed.
+   // \return void
+   */
+   inline void operator()( size_t ibegin, size_t iend ) const {
+      SMMMWorkspace<ET>& ws( smmmWorkspace<ET>() );
+      for( size_t i=ibegin; i<iend; ++i )
+         nonzeros_[i] = smmmRowStructure( ws, *L_, *R_, i, smmmFlops( *L_, *R_, i ), false );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const MT1* L_;         //!< The left-hand side sparse matrix operand.
+   const MT2* R_;         //!< The right-hand side sparse matrix operand.
+   size_t*    nonzeros_;  //!< The resulting number of non-zero elements per row/column.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the setup of the sparsity pattern of a range of rows or columns of a sparse
+//        matrix/sparse matrix multiplication.
+//
+// The kernel requires the storage of the target sparse matrix to be partitioned according to the
+// number of non-zero elements of the rows/columns (see the CompressedMatrix::partition()
+// function).
+*/
+template< typename MT1    // Type of the target sparse matrix
+        , typename MT2    // Type of the left-hand side sparse matrix
+        , typename MT3 >  // Type of the right-hand side sparse matrix
+struct SMMMPatternKernel
+{
+   //**Type definitions****************************************************************************
+   typedef typename MT1::ElementType  ElementType;  //!< Element type of the target sparse matrix.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SMMMPatternKernel class template.
+   //
+   // \param C The target sparse matrix.
+   // \param L The left-hand side sparse matrix operand.
+   // \param R The right-hand side sparse matrix operand.
+   */
+   explicit inline SMMMPatternKernel( MT1& C, const MT2& L, const MT3& R )
+      : C_( &C )  // The target sparse matrix
+      , L_( &L )  // The left-hand side sparse matrix operand
+      , R_( &R )  // The right-hand side sparse matrix operand
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Appends the structure of the given range of rows/columns to the target matrix.
+   //
+   // \param ibegin The index of the first row/column to be computed.
+   // \param iend The index one past the last row/column to be computed.
+   // \return void
+   */
+   inline void operator()( size_t ibegin, size_t iend ) const {
+      SMMMWorkspace<ElementType>& ws( smmmWorkspace<ElementType>() );
+      for( size_t i=ibegin; i<iend; ++i ) {
+         const size_t count( smmmRowStructure( ws, *L_, *R_, i, smmmFlops( *L_, *R_, i ), true ) );
+         for( size_t j=0UL; j<count; ++j ) {
+            if( IsColumnMajorMatrix<MT1>::value ) C_->append( ws.indices_[j], i, ElementType() );
+            else                                  C_->append( i, ws.indices_[j], ElementType() );
+         }
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   MT1*       C_;  //!< The target sparse matrix.
+   const MT2* L_;  //!< The left-hand side sparse matrix operand.
+   const MT3* R_;  //!< The right-hand side sparse matrix operand.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the numeric phase of a range of rows or columns of a sparse matrix/sparse
+//        matrix multiplication.
+*/
+template< typename MT1    // Type of the target sparse matrix
+        , typename MT2    // Type of the left-hand side sparse matrix
+        , typename MT3 >  // Type of the right-hand side sparse matrix
+struct SMMMNumericKernel
+{
+   //**Type definitions****************************************************************************
+   typedef typename MT1::ElementType  ElementType;  //!< Element type of the target sparse matrix.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SMMMNumericKernel class template.
+   //
+   // \param C The target sparse matrix with a fixed sparsity pattern.
+   // \param L The left-hand side sparse matrix operand.
+   // \param R The right-hand side sparse matrix operand.
+   */
+   explicit inline SMMMNumericKernel( MT1& C, const MT2& L, const MT3& R )
+      : C_( &C )  // The target sparse matrix
+      , L_( &L )  // The left-hand side sparse matrix operand
+      , R_( &R )  // The right-hand side sparse matrix operand
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the values of the given range of rows/columns.
+   //
+   // \param ibegin The index of the first row/column to be computed.
+   // \param iend The index one past the last row/column to be computed.
+   // \return void
+   */
+   inline void operator()( size_t ibegin, size_t iend ) const {
+      SMMMWorkspace<ElementType>& ws( smmmWorkspace<ElementType>() );
+      for( size_t i=ibegin; i<iend; ++i )
+         smmmRowNumeric( ws, *C_, *L_, *R_, i );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   MT1*       C_;  //!< The target sparse matrix.
+   const MT2* L_;  //!< The left-hand side sparse matrix operand.
+   const MT3* R_;  //!< The right-hand side sparse matrix operand.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary functor for the threaded execution of a range kernel of the sparse matrix/
+//        sparse matrix multiplication.
+*/
+template< typename Kernel >  // Type of the range kernel
+struct SMMMTask
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SMMMTask class template.
+   //
+   // \param kernel The range kernel.
+   // \param ibegin The index of the first row/column to be computed.
+   // \param iend The index one past the last row/column to be computed.
+   */
+   explicit inline SMMMTask( const Kernel& kernel, size_t ibegin, size_t iend )
+      : kernel_( kernel )  // The range kernel
+      , ibegin_( ibegin )  // The index of the first row/column
+      , iend_  ( iend )    // The index one past the last row/column
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Executes the range kernel for the assigned range of rows/columns.
+   //
+   // \return void
+   */
+   inline void operator()() {
+      kernel_( ibegin_, iend_ );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Kernel kernel_;  //!< The range kernel.
+   size_t ibegin_;  //!< The index of the first row/column.
+   size_t iend_;    //!< The index one past the last row/column.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Execution of a range kernel of the sparse matrix/sparse matrix multiplication.
+// \ingroup sparse_matrix
+//
+// \param kernel The range kernel.
+// \param m The total number of rows/columns.
+// \return void
+//
+// This function executes the given range kernel for all \a m rows/columns. In case the
+// shared-memory parallelization is active and the number of rows/columns is large enough, the
+// rows/columns are partitioned into blocks that are processed concurrently. Within a serial
+// section or a parallel section, or in case the number of rows/columns is small, the kernel
+// is executed serially.
+*/
+template< typename Kernel >  // Type of the range kernel
+void smmmExecute( const Kernel& kernel, size_t m )
+{
+#if BLAZE_OPENMP_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   if( isSerialSectionActive() || isParallelSectionActive() || m <= SMP_SMATSMATMULT_THRESHOLD ) {
+      kernel( 0UL, m );
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+#  if BLAZE_OPENMP_PARALLEL_MODE
+      const size_t tasks( omp_get_max_threads() * SMP_TASKS_PER_THREAD );
+#  else
+      const size_t tasks( TheThreadBackend::size() * SMP_TASKS_PER_THREAD );
+#  endif
+      const size_t addon( ( ( m % tasks ) != 0UL )? 1UL : 0UL );
+      const size_t sizePerTask( m / tasks + addon );
+
+#  if BLAZE_OPENMP_PARALLEL_MODE
+#pragma omp parallel for schedule(dynamic,1) shared( kernel )
+      for( int i=0; i<static_cast<int>( tasks ); ++i )
+      {
+         const size_t ibegin( i*sizePerTask );
+
+         if( ibegin >= m )
+            continue;
+
+         kernel( ibegin, min( ibegin+sizePerTask, m ) );
+      }
+#  else
+      for( size_t i=0UL; i<tasks; ++i )
+      {
+         const size_t ibegin( i*sizePerTask );
+
+         if( ibegin >= m )
+            break;
+
+         TheThreadBackend::scheduleTask( SMMMTask<Kernel>( kernel, ibegin, min( ibegin+sizePerTask, m ) ) );
+      }
+
+      TheThreadBackend::wait();
+#  endif
+   }
+#else
+   kernel( 0UL, m );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SYMBOLIC KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Setup of the given sparsity pattern in a compressed matrix.
+// \ingroup sparse_matrix
+//
+// \param C The target compressed matrix.
+// \param L The left-hand side sparse matrix operand.
+// \param R The right-hand side sparse matrix operand.
+// \param offsets The offsets of the rows/columns of the pattern.
+// \return void
+//
+// This function partitions the storage of the given compressed matrix according to the given
+// row/column offsets and appends the structure of the rows/columns in parallel.
+*/
+template< typename Type   // Data type of the target compressed matrix
+        , bool SO         // Storage order of all three sparse matrices
+        , typename MT2    // Type of the left-hand side sparse matrix
+        , typename MT3 >  // Type of the right-hand side sparse matrix
+void smmmPattern( CompressedMatrix<Type,SO>& C, const SparseMatrix<MT2,SO>& L,
+                  const SparseMatrix<MT3,SO>& R, const size_t* offsets )
+{
+   const size_t m( SO ? (~L).columns() : (~L).rows() );
+
+   C.partition( offsets );
+
+   smmmExecute( SMMMPatternKernel< CompressedMatrix<Type,SO>, MT2, MT3 >( C, ~L, ~R ), m );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Setup of the given sparsity pattern in a sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param C The target sparse matrix.
+// \param L The left-hand side sparse matrix operand.
+// \param R The right-hand side sparse matrix operand.
+// \param offsets The offsets of the rows/columns of the pattern.
+// \return void
+//
+// This function resets the given sparse matrix, reserves the total number of non-zero elements
+// of the pattern and serially appends the structure of the rows/columns.
+*/
+template< typename MT1    // Type of the target sparse matrix
+        , bool SO         // Storage order of all three sparse matrices
+        , typename MT2    // Type of the left-hand side sparse matrix
+        , typename MT3 >  // Type of the right-hand side sparse matrix
+void smmmPattern( SparseMatrix<MT1,SO>& C, const SparseMatrix<MT2,SO>& L,
+                  const SparseMatrix<MT3,SO>& R, const size_t* offsets )
+{
+   typedef typename MT1::ElementType  ElementType;
+
+   const size_t m( SO ? (~L).columns() : (~L).rows() );
+
+   (~C).reset();
+   (~C).reserve( offsets[m] );
+
+   SMMMWorkspace<ElementType>& ws( smmmWorkspace<ElementType>() );
+
+   for( size_t i=0UL; i<m; ++i )
+   {
+      const size_t count( smmmRowStructure( ws, L, R, i, smmmFlops( L, R, i ), true ) );
+
+      for( size_t j=0UL; j<count; ++j ) {
+         if( SO ) (~C).append( ws.indices_[j], i, ElementType() );
+         else     (~C).append( i, ws.indices_[j], ElementType() );
+      }
+
+      (~C).finalize( i );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Setup of the sparsity pattern of a sparse matrix/sparse matrix multiplication.
+// \ingroup sparse_matrix
+//
+// \param C The target sparse matrix.
+// \param L The left-hand side sparse matrix operand.
+// \param R The right-hand side sparse matrix operand.
+// \return void
+//
+// This function fills the given target matrix with the structure of the product of the two
+// given sparse matrices. For row-major matrices the function computes the structure of
+// \f$ L*R \f$, for column-major matrices the structure of \f$ R*L \f$. In a first pass the exact
+// number of structural non-zero elements of each row/column is computed, which is turned into
+// row/column offsets by a prefix sum. Exactly as much memory as required by the pattern is
+// reserved before the structure is appended in a second pass. Both passes are executed in
+// parallel in case the shared-memory parallelization is active (the second pass only for
+// compressed matrices). All elements of the resulting sparsity pattern are set to their default
+// value, including those that would cancel out numerically.
+*/
+template< typename MT1    // Type of the target sparse matrix
+        , bool SO         // Storage order of all three sparse matrices
+        , typename MT2    // Type of the left-hand side sparse matrix
+        , typename MT3 >  // Type of the right-hand side sparse matrix
+void smmmSymbolicBackend( SparseMatrix<MT1,SO>& C, const SparseMatrix<MT2,SO>& L,
+                          const SparseMatrix<MT3,SO>& R )
+{
+   typedef typename MT1::ElementType  ElementType;
+
+   const size_t m( SO ? (~L).columns() : (~L).rows() );
+
+   std::vector<size_t> offsets( m+1UL, 0UL );
+
+   smmmExecute( SMMMCountKernel<ElementType,MT2,MT3>( ~L, ~R, &offsets[0]+1UL ), m );
+
+   for( size_t i=0UL; i<m; ++i )
+      offsets[i+1UL] += offsets[i];
+
+   smmmPattern( ~C, L, R, &offsets[0] );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMERIC KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default sparse matrix/sparse matrix multiplication (\f$ C=A*B \f$).
+// \ingroup sparse_matrix
+//
+// \param C The target sparse matrix.
+// \param L The left-hand side sparse matrix operand.
+// \param R The right-hand side sparse matrix operand.
+// \return void
+//
+// This function implements the Gustavson algorithm for the product of the two given sparse
+// matrices. For row-major matrices the function computes \f$ L*R \f$, for column-major matrices
+// \f$ R*L \f$. The number of non-zero elements of the product is estimated by the number of
+// scalar multiplications, which only requires a single pass over the left-hand side operand.
+// Each row/column is accumulated either in a hash table sized by its number of scalar
+// multiplications or, above the density cutoff, in a dense accumulator and appended to the
+// target matrix. Elements that cancel out numerically are not stored.\n
+// The accumulators are taken from the workspace of the calling thread. Therefore the concurrent
+// evaluation of disjoint blocks of the product (as for instance performed by the SMP assignment)
+// does not require any synchronization.
+*/
+template< typename MT1    // Type of the target sparse matrix
+        , bool SO         // Storage order of all three sparse matrices
+        , typename MT2    // Type of the left-hand side sparse matrix
+        , typename MT3 >  // Type of the right-hand side sparse matrix
+void smmm( SparseMatrix<MT1,SO>& C, const SparseMatrix<MT2,SO>& L, const SparseMatrix<MT3,SO>& R )
+{
+   typedef typename MT1::ElementType  ElementType;
+
+   const size_t m( SO ? (~L).columns() : (~L).rows()    );
+   const size_t n( SO ? (~R).rows()    : (~R).columns() );
+
+   BLAZE_INTERNAL_ASSERT( ( SO ? (~C).columns() : (~C).rows()    ) == m, "Invalid matrix sizes" );
+   BLAZE_INTERNAL_ASSERT( ( SO ? (~C).rows()    : (~C).columns() ) == n, "Invalid matrix sizes" );
+
+   // (Over-)Estimating the number of non-zero elements of the product
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      nonzeros += min( smmmFlops( L, R, i ), n );
+   }
+
+   (~C).reserve( nonzeros );
+
+   // Accumulating and appending the rows/columns of the product
+   SMMMWorkspace<ElementType>& ws( smmmWorkspace<ElementType>() );
+
+   for( size_t i=0UL; i<m; ++i )
+   {
+      const size_t count( smmmRowProduct( ws, L, R, i, smmmFlops( L, R, i ) ) );
+
+      for( size_t j=0UL; j<count; ++j ) {
+         if( SO ) (~C).append( ws.indices_[j], i, ws.results_[j] );
+         else     (~C).append( i, ws.indices_[j], ws.results_[j] );
+      }
+
+      (~C).finalize( i );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the numeric phase of a sparse matrix/sparse matrix multiplication.
+// \ingroup sparse_matrix
+//
+// \param C The target sparse matrix with a fixed sparsity pattern.
+// \param L The left-hand side sparse matrix operand.
+// \param R The right-hand side sparse matrix operand.
+// \return void
+//
+// This function recomputes all values of the given target matrix. The pattern of the target
+// matrix is required to contain the structure of the product, as for instance set up by
+// smmmSymbolic(). In case the shared-memory parallelization is active and the target matrix is
+// large enough, the rows/columns of the target matrix are partitioned into blocks that are
+// computed concurrently, each with the accumulators of its thread.
+*/
+template< typename MT1    // Type of the target sparse matrix
+        , bool SO         // Storage order of all three sparse matrices
+        , typename MT2    // Type of the left-hand side sparse matrix
+        , typename MT3 >  // Type of the right-hand side sparse matrix
+void smmmNumericBackend( SparseMatrix<MT1,SO>& C, const SparseMatrix<MT2,SO>& L,
+                         const SparseMatrix<MT3,SO>& R )
+{
+   const size_t m( SO ? (~C).columns() : (~C).rows() );
+
+   smmmExecute( SMMMNumericKernel<MT1,MT2,MT3>( ~C, ~L, ~R ), m );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SPARSE MATRIX/SPARSE MATRIX MULTIPLICATION WITH REUSABLE SPARSITY PATTERN
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Symbolic phase of a sparse matrix/sparse matrix multiplication (\f$ C=A*B \f$).
+// \ingroup sparse_matrix
+//
+// \param C The target sparse matrix.
+// \param A The left-hand side sparse matrix operand.
+// \param B The right-hand side sparse matrix operand.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function sets up the sparsity pattern of the product \f$ A*B \f$ in the given target
+// matrix. All elements of the pattern are initialized to their default value. In combination
+// with the smmmNumeric() function, the symbolic phase allows to reuse the sparsity pattern for
+// several products of matrices with the same sparsity patterns:
+
+   \code
+   using blaze::rowMajor;
+
+   blaze::CompressedMatrix<double,rowMajor> J, W, C;
+   // ... Initialization of J and W
+
+   C.resize( J.rows(), W.columns() );
+   smmmSymbolic( C, J, W );  // Computing the sparsity pattern of J*W once
+
+   for( size_t step=0UL; step<steps; ++step ) {
+      // ... Updating the values of J and W
+      smmmNumeric( C, J, W );  // Recomputing only the values of J*W
+   }
+   \endcode
+
+// All three matrices are required to have the same storage order. In case the number of rows
+// and columns of the target matrix does not match the size of the product, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT1    // Type of the target sparse matrix
+        , bool SO         // Storage order of all three sparse matrices
+        , typename MT2    // Type of the left-hand side sparse matrix
+        , typename MT3 >  // Type of the right-hand side sparse matrix
+void smmmSymbolic( SparseMatrix<MT1,SO>& C, const SparseMatrix<MT2,SO>& A,
+                   const SparseMatrix<MT3,SO>& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~A).columns() != (~B).rows() ||
+       (~C).rows() != (~A).rows() || (~C).columns() != (~B).columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   typename MT2::CompositeType tmpA( ~A );  // Evaluation of the left-hand side sparse matrix operand
+   typename MT3::CompositeType tmpB( ~B );  // Evaluation of the right-hand side sparse matrix operand
+
+   if( SO ) smmmSymbolicBackend( ~C, tmpB, tmpA );
+   else     smmmSymbolicBackend( ~C, tmpA, tmpB );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Numeric phase of a sparse matrix/sparse matrix multiplication (\f$ C=A*B \f$).
+// \ingroup sparse_matrix
+//
+// \param C The target sparse matrix with a fixed sparsity pattern.
+// \param A The left-hand side sparse matrix operand.
+// \param B The right-hand side sparse matrix operand.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function recomputes the values of the product \f$ A*B \f$ within the existing sparsity
+// pattern of the given target matrix, i.e. no memory is allocated for the target matrix and
+// no element is inserted or removed. Elements that cancel out numerically remain part of the
+// pattern. The sparsity pattern of the target matrix is required to contain the structure of
+// the product, as for instance set up by a previous call to smmmSymbolic() for matrices with
+// the same sparsity patterns. Contributions outside of the pattern are discarded.\n
+// In case the shared-memory parallelization is active, the rows (or columns for column-major
+// matrices) of the target matrix are computed in parallel. All three matrices are required to
+// have the same storage order. In case the number of rows and columns of the target matrix does
+// not match the size of the product, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT1    // Type of the target sparse matrix
+        , bool SO         // Storage order of all three sparse matrices
+        , typename MT2    // Type of the left-hand side sparse matrix
+        , typename MT3 >  // Type of the right-hand side sparse matrix
+void smmmNumeric( SparseMatrix<MT1,SO>& C, const SparseMatrix<MT2,SO>& A,
+                  const SparseMatrix<MT3,SO>& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~A).columns() != (~B).rows() ||
+       (~C).rows() != (~A).rows() || (~C).columns() != (~B).columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   typename MT2::CompositeType tmpA( ~A );  // Evaluation of the left-hand side sparse matrix operand
+   typename MT3::CompositeType tmpB( ~B );  // Evaluation of the right-hand side sparse matrix operand
+
+   if( SO ) smmmNumericBackend( ~C, tmpB, tmpA );
+   else     smmmNumericBackend( ~C, tmpA, tmpB );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Releases the workspaces of the sparse matrix multiplication kernels of the calling thread.
+// \ingroup sparse_matrix
+//
+// \return void
+//
+// The sparse matrix/sparse matrix multiplication kernels accumulate the rows/columns of the
+// product in a thread-local workspace per element type, which is kept for subsequent products.
+// This function returns the memory of all workspaces of the calling thread to the system. The
+// memory is not released automatically at the end of a thread; threads that compute sparse
+// matrix products and that are terminated before the end of the program should therefore call
+// releaseSMMMWorkspace(). Subsequent products of the thread allocate a new workspace.
+*/
+inline void releaseSMMMWorkspace()
+{
+   SMMMWorkspaceBase*& list( smmmWorkspaceList() );
+
+   while( list != NULL ) {
+      SMMMWorkspaceBase* ws( list );
+      list = ws->next_;
+      *ws->owner_ = NULL;
+      delete ws;
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
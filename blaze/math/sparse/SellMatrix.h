@@ -0,0 +1,929 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SellMatrix.h
+//  \brief Implementation of a sparse matrix in the SELL-C-sigma storage format
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SELLMATRIX_H_
+#define _BLAZE_MATH_SPARSE_SELLMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/SMP.h>
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+#  include <omp.h>
+#elif BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+#  include <blaze/math/smp/threads/ThreadBackend.h>
+#endif
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/Or.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup sell_matrix SellMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Read-only sparse matrix in the SELL-C-sigma storage format.
+// \ingroup sell_matrix
+//
+// The SellMatrix class template represents a read-only sparse matrix in the sliced ELLPACK
+// format (SELL-C-sigma), which is specifically designed for a vectorized sparse matrix/dense
+// vector multiplication. The rows of the matrix are grouped into chunks of \a C consecutive
+// rows, where \a C corresponds to the number of values in a single intrinsic vector of the
+// given element type \a Type. Within every chunk, the non-zero elements are stored column by
+// column, i.e. the j-th non-zero elements of all \a C rows of a chunk are stored contiguously.
+// Rows shorter than the longest row of a chunk are padded with zeros. In order to minimize
+// the padding, the rows within windows of \a sigma consecutive rows are sorted by their number
+// of non-zero elements before they are grouped into chunks.
+//
+// A SellMatrix is set up from an arbitrary sparse matrix and cannot be modified afterwards. Its
+// only purpose is the fast repeated multiplication with a dense vector via the multiply()
+// function, for instance within an iterative solver:
+
+   \code
+   using blaze::rowMajor;
+   using blaze::columnVector;
+
+   blaze::CompressedMatrix<double,rowMajor> A;
+   blaze::DynamicVector<double,columnVector> x, y;
+   // ... Resizing and initialization
+
+   blaze::SellMatrix<double> S( A );  // Conversion into the SELL-C-sigma format
+
+   y.resize( S.rows() );
+   multiply( y, S, x );  // Computing y = A * x
+   \endcode
+
+// In case the element type is \c float or \c double, the multiplication processes a complete
+// chunk per intrinsic operation and loads the required elements of the dense vector by gather
+// operations. The column indices are stored as 32-bit integral values, which limits the number
+// of columns of a SellMatrix to \f$ 2^{31}-1 \f$.
+*/
+template< typename Type >  // Data type of the sparse matrix
+class SellMatrix
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef SellMatrix<Type>  This;           //!< Type of this SellMatrix instance.
+   typedef Type              ElementType;    //!< Type of the sparse matrix elements.
+   typedef const Type&       ConstReference;  //!< Reference to a constant sparse matrix value.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for intrinsic optimization.
+   /*! The \a vectorizable compilation flag indicates whether the multiplication with a dense
+       vector is performed by intrinsic gather operations. This is the case for \c float and
+       \c double elements. */
+   enum { vectorizable = Or< IsFloat<Type>, IsDouble<Type> >::value };
+
+   //! The number of rows per chunk.
+   enum { chunkSize = vectorizable ? IntrinsicTrait<Type>::size : 1 };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SellMatrix();
+
+   template< typename MT, bool SO >
+   explicit inline SellMatrix( const SparseMatrix<MT,SO>& sm, size_t sigma=32UL*chunkSize );
+
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   // No explicitly declared copy assignment operator.
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const;
+   inline size_t columns() const;
+   inline size_t nonZeros() const;
+   inline size_t capacity() const;
+   inline size_t sigma() const;
+   inline size_t chunks() const;
+   inline void   swap( SellMatrix& sm ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline size_t         offset( size_t c ) const;
+   inline size_t         width ( size_t c ) const;
+   inline size_t         row   ( size_t i ) const;
+   inline const Type*    data   () const;
+   inline const int32_t* indices() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**RowLength class definition******************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Comparison of rows by their number of non-zero elements.
+   */
+   struct RowLength
+   {
+      explicit inline RowLength( const std::vector<size_t>& nonzeros ) : nonzeros_( &nonzeros ) {}
+      inline bool operator()( size_t i, size_t j ) const {
+         return (*nonzeros_)[i] > (*nonzeros_)[j];
+      }
+      const std::vector<size_t>* nonzeros_;  //!< The number of non-zero elements of each row.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT > void init( const SparseMatrix<MT,false>& sm );
+   template< typename MT > void init( const SparseMatrix<MT,true>&  sm );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;         //!< The number of rows of the sparse matrix.
+   size_t n_;         //!< The number of columns of the sparse matrix.
+   size_t nonZeros_;  //!< The number of non-zero elements of the sparse matrix.
+   size_t sigma_;     //!< The size of the sorting windows.
+
+   std::vector<size_t> offsets_;  //!< The offset of the first element of each chunk.
+   std::vector<size_t> rows_;     //!< The original row index of each stored row.
+
+   std::vector< Type, AlignedAllocator<Type> > values_;  //!< The padded values of all chunks.
+   std::vector<int32_t> indices_;  //!< The padded column indices of all chunks.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SellMatrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline SellMatrix<Type>::SellMatrix()
+   : m_       ( 0UL )        // The number of rows of the sparse matrix
+   , n_       ( 0UL )        // The number of columns of the sparse matrix
+   , nonZeros_( 0UL )        // The number of non-zero elements of the sparse matrix
+   , sigma_   ( 1UL )        // The size of the sorting windows
+   , offsets_ ( 1UL, 0UL )   // The offset of the first element of each chunk
+   , rows_    ()             // The original row index of each stored row
+   , values_  ()             // The padded values of all chunks
+   , indices_ ()             // The padded column indices of all chunks
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different sparse matrices.
+//
+// \param sm Sparse matrix to be converted into the SELL-C-sigma format.
+// \param sigma The number of consecutive rows that are sorted by their number of non-zeros.
+// \exception std::invalid_argument Invalid sorting window.
+// \exception std::invalid_argument Invalid number of columns.
+//
+// This constructor converts the given sparse matrix into the SELL-C-sigma format. The rows
+// within every window of \a sigma consecutive rows are sorted by decreasing number of non-zero
+// elements. A value of 1 disables the sorting, a value larger or equal to the number of rows
+// sorts all rows of the matrix. In case \a sigma is 0 or in case the number of columns of the
+// matrix exceeds \f$ 2^{31}-1 \f$, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the sparse matrix
+template< typename MT      // Type of the foreign sparse matrix
+        , bool SO >        // Storage order of the foreign sparse matrix
+inline SellMatrix<Type>::SellMatrix( const SparseMatrix<MT,SO>& sm, size_t sigma )
+   : m_       ( (~sm).rows() )     // The number of rows of the sparse matrix
+   , n_       ( (~sm).columns() )  // The number of columns of the sparse matrix
+   , nonZeros_( 0UL )              // The number of non-zero elements of the sparse matrix
+   , sigma_   ( sigma )            // The size of the sorting windows
+   , offsets_ ()                   // The offset of the first element of each chunk
+   , rows_    ()                   // The original row index of each stored row
+   , values_  ()                   // The padded values of all chunks
+   , indices_ ()                   // The padded column indices of all chunks
+{
+   if( sigma == 0UL )
+      throw std::invalid_argument( "Invalid sorting window" );
+
+   if( n_ > static_cast<size_t>( std::numeric_limits<int32_t>::max() ) )
+      throw std::invalid_argument( "Invalid number of columns" );
+
+   init( ~sm );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t SellMatrix<Type>::rows() const
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t SellMatrix<Type>::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix.
+//
+// \return The number of non-zero elements in the sparse matrix.
+//
+// The returned number does not include the padding elements of the chunks.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t SellMatrix<Type>::nonZeros() const
+{
+   return nonZeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements including the padding elements.
+//
+// \return The number of stored elements including the padding elements.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t SellMatrix<Type>::capacity() const
+{
+   return values_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the sorting windows.
+//
+// \return The number of consecutive rows that have been sorted by their number of non-zeros.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t SellMatrix<Type>::sigma() const
+{
+   return sigma_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of chunks of the sparse matrix.
+//
+// \return The number of chunks of the sparse matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t SellMatrix<Type>::chunks() const
+{
+   return offsets_.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The sparse matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline void SellMatrix<Type>::swap( SellMatrix& sm ) /* throw() */
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   std::swap( nonZeros_, sm.nonZeros_ );
+   std::swap( sigma_, sm.sigma_ );
+   offsets_.swap( sm.offsets_ );
+   rows_.swap( sm.rows_ );
+   values_.swap( sm.values_ );
+   indices_.swap( sm.indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of a row-major sparse matrix into the SELL-C-sigma format.
+//
+// \param sm The row-major sparse matrix to be converted.
+// \return void
+*/
+template< typename Type >  // Data type of the sparse matrix
+template< typename MT >    // Type of the foreign sparse matrix
+void SellMatrix<Type>::init( const SparseMatrix<MT,false>& sm )
+{
+   typedef typename MT::CompositeType           CT;
+   typedef typename RemoveReference<CT>::Type::ConstIterator  ConstIterator;
+
+   CT A( ~sm );  // Evaluation of the sparse matrix
+
+   const size_t C( chunkSize );
+   const size_t chunkCount( ( m_ + C - 1UL ) / C );
+
+   std::vector<size_t> nonzeros( m_, 0UL );
+   for( size_t i=0UL; i<m_; ++i ) {
+      for( ConstIterator element=A.begin(i); element!=A.end(i); ++element )
+         ++nonzeros[i];
+      nonZeros_ += nonzeros[i];
+   }
+
+   rows_.resize( m_ );
+   for( size_t i=0UL; i<m_; ++i )
+      rows_[i] = i;
+
+   if( sigma_ > 1UL ) {
+      for( size_t i=0UL; i<m_; i+=sigma_ ) {
+         std::stable_sort( rows_.begin()+i, rows_.begin()+min( i+sigma_, m_ ), RowLength( nonzeros ) );
+      }
+   }
+
+   offsets_.resize( chunkCount+1UL );
+   offsets_[0UL] = 0UL;
+
+   for( size_t c=0UL; c<chunkCount; ++c ) {
+      size_t width( 0UL );
+      for( size_t i=c*C; i<min( (c+1UL)*C, m_ ); ++i )
+         width = max( width, nonzeros[rows_[i]] );
+      offsets_[c+1UL] = offsets_[c] + width*C;
+   }
+
+   values_.assign( offsets_[chunkCount], Type() );
+   indices_.assign( offsets_[chunkCount], 0 );
+
+   for( size_t c=0UL; c<chunkCount; ++c ) {
+      for( size_t l=0UL; l<C && c*C+l<m_; ++l )
+      {
+         size_t pos( offsets_[c] + l );
+         for( ConstIterator element=A.begin(rows_[c*C+l]); element!=A.end(rows_[c*C+l]); ++element ) {
+            values_[pos]  = element->value();
+            indices_[pos] = static_cast<int32_t>( element->index() );
+            pos += C;
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of a column-major sparse matrix into the SELL-C-sigma format.
+//
+// \param sm The column-major sparse matrix to be converted.
+// \return void
+*/
+template< typename Type >  // Data type of the sparse matrix
+template< typename MT >    // Type of the foreign sparse matrix
+void SellMatrix<Type>::init( const SparseMatrix<MT,true>& sm )
+{
+   const CompressedMatrix<Type,false> tmp( ~sm );
+   init( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the offset of the first element of the given chunk.
+//
+// \param c The index of the chunk \f$[0..chunks()]\f$.
+// \return The offset of the first element of the chunk.
+//
+// For \a c equal to the number of chunks, the function returns the total number of stored
+// elements.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t SellMatrix<Type>::offset( size_t c ) const
+{
+   BLAZE_USER_ASSERT( c < offsets_.size(), "Invalid chunk access index" );
+   return offsets_[c];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of elements per row of the given chunk.
+//
+// \param c The index of the chunk \f$[0..chunks()-1]\f$.
+// \return The number of elements per row of the chunk including the padding elements.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t SellMatrix<Type>::width( size_t c ) const
+{
+   BLAZE_USER_ASSERT( c+1UL < offsets_.size(), "Invalid chunk access index" );
+   return ( offsets_[c+1UL] - offsets_[c] ) / chunkSize;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the original index of the given stored row.
+//
+// \param i The position of the row within the storage \f$[0..M-1]\f$.
+// \return The index of the row within the original sparse matrix.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline size_t SellMatrix<Type>::row( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+   return rows_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the padded values of the sparse matrix.
+//
+// \return Pointer to the padded values of the sparse matrix.
+//
+// The j-th element of the l-th row of chunk \a c is stored at position
+// <tt>offset(c) + j*chunkSize + l</tt>. The values of every chunk are properly aligned.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline const Type* SellMatrix<Type>::data() const
+{
+   return values_.empty() ? NULL : &values_[0];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the padded column indices of the sparse matrix.
+//
+// \return Pointer to the padded column indices of the sparse matrix.
+//
+// The column indices are stored in the same order as the values (see the data() function).
+// The column index of a padding element is 0.
+*/
+template< typename Type >  // Data type of the sparse matrix
+inline const int32_t* SellMatrix<Type>::indices() const
+{
+   return indices_.empty() ? NULL : &indices_[0];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SELLMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SellMatrix operators */
+//@{
+template< typename Type >
+inline void swap( SellMatrix<Type>& a, SellMatrix<Type>& b ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two SELL-C-sigma matrices.
+// \ingroup sell_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type >  // Data type of the sparse matrices
+inline void swap( SellMatrix<Type>& a, SellMatrix<Type>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Helper structure for the selection of the vectorized SELL-C-sigma multiplication kernel.
+// \ingroup sell_matrix
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename VT >  // Type of the right-hand side dense vector
+struct UseVectorizedSellKernel
+{
+   enum { value = SellMatrix<Type>::vectorizable &&
+                  IsSame<Type,typename VT::ElementType>::value &&
+                  HasConstDataAccess<VT>::value };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel of the SELL-C-sigma matrix/dense vector multiplication.
+// \ingroup sell_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side SELL-C-sigma matrix operand.
+// \param x The right-hand side dense vector operand.
+// \param cbegin The index of the first chunk to be computed.
+// \param cend The index one past the last chunk to be computed.
+// \return void
+//
+// This function computes the rows of the given range of chunks element by element.
+*/
+template< typename VT1     // Type of the target dense vector
+        , typename Type    // Data type of the sparse matrix
+        , typename VT2 >   // Type of the right-hand side dense vector
+inline typename DisableIf< UseVectorizedSellKernel<Type,VT2> >::Type
+   sellmvKernel( VT1& y, const SellMatrix<Type>& A, const VT2& x, size_t cbegin, size_t cend )
+{
+   const size_t C( SellMatrix<Type>::chunkSize );
+   const Type* const values( A.data() );
+   const int32_t* const indices( A.indices() );
+
+   for( size_t c=cbegin; c<cend; ++c )
+   {
+      const size_t offset( A.offset(c) );
+      const size_t width ( A.width(c) );
+
+      for( size_t l=0UL; l<C && c*C+l<A.rows(); ++l )
+      {
+         typename VT1::ElementType tmp = typename VT1::ElementType();
+
+         for( size_t j=0UL; j<width; ++j ) {
+            const size_t pos( offset + j*C + l );
+            tmp += values[pos] * x[ indices[pos] ];
+         }
+
+         y[A.row(c*C+l)] = tmp;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel of the SELL-C-sigma matrix/dense vector multiplication.
+// \ingroup sell_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side SELL-C-sigma matrix operand.
+// \param x The right-hand side dense vector operand.
+// \param cbegin The index of the first chunk to be computed.
+// \param cend The index one past the last chunk to be computed.
+// \return void
+//
+// This function computes all rows of a chunk at once. Per column of a chunk, the values are
+// loaded by a single aligned load and the according elements of the dense vector are loaded
+// by a single gather operation.
+*/
+template< typename VT1     // Type of the target dense vector
+        , typename Type    // Data type of the sparse matrix
+        , typename VT2 >   // Type of the right-hand side dense vector
+inline typename EnableIf< UseVectorizedSellKernel<Type,VT2> >::Type
+   sellmvKernel( VT1& y, const SellMatrix<Type>& A, const VT2& x, size_t cbegin, size_t cend )
+{
+   typedef IntrinsicTrait<Type>  IT;
+   typedef typename IT::Type     IntrinsicType;
+
+   const size_t C( SellMatrix<Type>::chunkSize );
+   const Type* const values( A.data() );
+   const int32_t* const indices( A.indices() );
+   const Type* const xdata( x.data() );
+
+   AlignedArray<Type,SellMatrix<Type>::chunkSize> tmp;
+
+   for( size_t c=cbegin; c<cend; ++c )
+   {
+      const size_t offset( A.offset(c) );
+      const size_t width ( A.width(c) );
+
+      IntrinsicType xmm1, xmm2;
+      size_t j( 0UL );
+
+      for( ; (j+2UL) <= width; j+=2UL ) {
+         const size_t pos( offset + j*C );
+         xmm1 = fmadd( load( values+pos   ), gather( xdata, indices+pos   ), xmm1 );
+         xmm2 = fmadd( load( values+pos+C ), gather( xdata, indices+pos+C ), xmm2 );
+      }
+      if( j < width ) {
+         const size_t pos( offset + j*C );
+         xmm1 = fmadd( load( values+pos ), gather( xdata, indices+pos ), xmm1 );
+      }
+
+      store( tmp.data(), xmm1 + xmm2 );
+
+      for( size_t l=0UL; l<C && c*C+l<A.rows(); ++l ) {
+         y[A.row(c*C+l)] = tmp[l];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Task for the parallel SELL-C-sigma matrix/dense vector multiplication.
+// \ingroup sell_matrix
+*/
+template< typename VT1     // Type of the target dense vector
+        , typename Type    // Data type of the sparse matrix
+        , typename VT2 >   // Type of the right-hand side dense vector
+struct SellmvTask
+{
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SellmvTask class template.
+   //
+   // \param y The target dense vector.
+   // \param A The left-hand side SELL-C-sigma matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param cbegin The index of the first chunk to be computed.
+   // \param cend The index one past the last chunk to be computed.
+   */
+   explicit inline SellmvTask( VT1& y, const SellMatrix<Type>& A, const VT2& x,
+                               size_t cbegin, size_t cend )
+      : y_     ( &y )      // The target dense vector
+      , A_     ( &A )      // The left-hand side SELL-C-sigma matrix operand
+      , x_     ( &x )      // The right-hand side dense vector operand
+      , cbegin_( cbegin )  // The index of the first chunk
+      , cend_  ( cend )    // The index one past the last chunk
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Computes the rows of the assigned range of chunks.
+   //
+   // \return void
+   */
+   inline void operator()() {
+      sellmvKernel( *y_, *A_, *x_, cbegin_, cend_ );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   VT1*                    y_;       //!< The target dense vector.
+   const SellMatrix<Type>* A_;       //!< The left-hand side SELL-C-sigma matrix operand.
+   const VT2*              x_;       //!< The right-hand side dense vector operand.
+   size_t                  cbegin_;  //!< The index of the first chunk.
+   size_t                  cend_;    //!< The index one past the last chunk.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the SELL-C-sigma matrix/dense vector multiplication.
+// \ingroup sell_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side SELL-C-sigma matrix operand.
+// \param x The right-hand side dense vector operand.
+// \return void
+//
+// In case the shared-memory parallelization is active and the target vector is large enough,
+// the chunks of the matrix are partitioned into blocks that are computed concurrently. Within
+// a serial section or in case the target vector is small, the computation is performed
+// serially.
+*/
+template< typename VT1     // Type of the target dense vector
+        , typename Type    // Data type of the sparse matrix
+        , typename VT2 >   // Type of the right-hand side dense vector
+void sellmvBackend( VT1& y, const SellMatrix<Type>& A, const VT2& x )
+{
+   const size_t chunks( A.chunks() );
+
+#if BLAZE_OPENMP_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   if( isSerialSectionActive() || isParallelSectionActive() || A.rows() <= SMP_SMATDVECMULT_THRESHOLD ) {
+      sellmvKernel( y, A, x, 0UL, chunks );
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+#  if BLAZE_OPENMP_PARALLEL_MODE
+      const size_t tasks( omp_get_max_threads() * SMP_TASKS_PER_THREAD );
+#  else
+      const size_t tasks( TheThreadBackend::size() * SMP_TASKS_PER_THREAD );
+#  endif
+      const size_t addon( ( ( chunks % tasks ) != 0UL )? 1UL : 0UL );
+      const size_t sizePerTask( chunks / tasks + addon );
+
+#  if BLAZE_OPENMP_PARALLEL_MODE
+#pragma omp parallel for schedule(dynamic,1) shared( y, A, x )
+      for( int i=0; i<static_cast<int>( tasks ); ++i )
+      {
+         const size_t cbegin( i*sizePerTask );
+
+         if( cbegin >= chunks )
+            continue;
+
+         sellmvKernel( y, A, x, cbegin, min( cbegin+sizePerTask, chunks ) );
+      }
+#  else
+      for( size_t i=0UL; i<tasks; ++i )
+      {
+         const size_t cbegin( i*sizePerTask );
+
+         if( cbegin >= chunks )
+            break;
+
+         TheThreadBackend::scheduleTask(
+            SellmvTask<VT1,Type,VT2>( y, A, x, cbegin, min( cbegin+sizePerTask, chunks ) ) );
+      }
+
+      TheThreadBackend::wait();
+#  endif
+   }
+#else
+   sellmvKernel( y, A, x, 0UL, chunks );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SELL-C-SIGMA MATRIX/DENSE VECTOR MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication of a SELL-C-sigma matrix and a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup sell_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side SELL-C-sigma matrix operand.
+// \param x The right-hand side dense vector operand.
+// \return void
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function computes the product of the given SELL-C-sigma matrix and the dense vector
+// \a x and assigns the result to the dense vector \a y. The size of \a x has to match the
+// number of columns of \a A and the size of \a y has to match the number of rows of \a A.
+// Otherwise a \a std::invalid_argument exception is thrown.
+*/
+template< typename VT1     // Type of the target dense vector
+        , typename Type    // Data type of the sparse matrix
+        , typename VT2 >   // Type of the right-hand side dense vector
+void multiply( DenseVector<VT1,false>& y, const SellMatrix<Type>& A, const DenseVector<VT2,false>& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   typedef typename VT2::ResultType     RT;
+   typedef typename VT2::CompositeType  CT;
+
+   if( (~y).size() != A.rows() || (~x).size() != A.columns() )
+      throw std::invalid_argument( "Matrix and vector sizes do not match" );
+
+   if( (~x).isAliased( &(~y) ) ) {
+      const RT tmp( ~x );
+      sellmvBackend( ~y, A, tmp );
+   }
+   else {
+      CT tmp( ~x );
+      sellmvBackend( ~y, A, tmp );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,8 +40,12 @@
 // Includes
 //*************************************************************************************************
 
+#include <limits>
+#include <stdexcept>
 #include <blaze/math/sparse/SparseElement.h>
 #include <blaze/math/typetraits/IsSparseElement.h>
+#include <blaze/system/Sparse.h>
+#include <blaze/util/Assert.h>
 #include <blaze/util/constraints/Const.h>
 #include <blaze/util/constraints/Pointer.h>
 #include <blaze/util/constraints/Reference.h>
@@ -64,7 +68,9 @@ namespace blaze {
 // \ingroup math
 //
 // The ValueIndexPair class represents a single index-value-pair of a sparse vector or sparse
-// matrix.
+// matrix. Internally the index is stored as \a sparse_index_t, which can be configured via the
+// <tt>./blaze/config/Sparse.h</tt> configuration file in order to reduce the memory footprint
+// of a single element.
 */
 template< typename Type >  // Type of the value element
 class ValueIndexPair : private SparseElement
@@ -120,8 +126,8 @@ class ValueIndexPair : private SparseElement
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   Type   value_;  //!< Value of the value-index-pair.
-   size_t index_;  //!< Index of the value-index-pair.
+   Type           value_;  //!< Value of the value-index-pair.
+   sparse_index_t index_;  //!< Index of the value-index-pair.
    //@}
    //**********************************************************************************************
 
@@ -173,7 +179,9 @@ template< typename Type >  // Type of the value element
 inline ValueIndexPair<Type>::ValueIndexPair( const Type& v, size_t i )
    : value_( v )  // Value of the value-index-pair
    , index_( i )  // Index of the value-index-pair
-{}
+{
+   BLAZE_INTERNAL_ASSERT( index_ == i, "Index exceeds the range of the sparse index type" );
+}
 //*************************************************************************************************
 
 
@@ -334,6 +342,39 @@ inline typename ValueIndexPair<Type>::IndexType ValueIndexPair<Type>::index() co
 }
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks whether all indices of the given dimension can be represented by the sparse index.
+// \ingroup math
+//
+// \param n The number of elements of a sparse vector or of a row/column of a sparse matrix.
+// \return The given dimension.
+// \exception std::invalid_argument Dimension exceeds the range of the sparse index type.
+//
+// This function is used by the compressed vector and matrix types to validate every dimension
+// that is stored in terms of the configured \a sparse_index_t index type. In case the largest
+// index of the given dimension exceeds the range of \a sparse_index_t, a \a std::invalid_argument
+// exception is thrown.
+*/
+inline size_t checkSparseDimension( size_t n )
+{
+   if( n > 0UL && n-1UL > static_cast<size_t>( std::numeric_limits<sparse_index_t>::max() ) )
+      throw std::invalid_argument( "Dimension exceeds the range of the sparse index type" );
+
+   return n;
+}
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
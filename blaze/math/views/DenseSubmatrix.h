@@ -74,6 +74,7 @@
 #include <blaze/math/typetraits/IsAdaptor.h>
 #include <blaze/math/typetraits/IsColumnMajorMatrix.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
+#include <blaze/math/typetraits/IsDenseIterator.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsLower.h>
 #include <blaze/math/typetraits/IsRestricted.h>
@@ -97,12 +98,14 @@
 #include <blaze/util/constraints/Vectorizable.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/FalseType.h>
 #include <blaze/util/logging/FunctionTrace.h>
 #include <blaze/util/mpl/And.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/mpl/Or.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Template.h>
+#include <blaze/util/TrueType.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsConst.h>
 #include <blaze/util/typetraits/IsFloatingPoint.h>
@@ -700,12 +703,7 @@ class DenseSubmatrix : public DenseMatrix< DenseSubmatrix<MT,AF,SO>, SO >
             return iterator_.loadu();
          }
          else {
-            AlignedArray<ElementType,IT::size> array;
-            for( size_t j=0UL; j<rest_; ++j )
-               array[j] = *(iterator_+j);
-            for( size_t j=rest_; j<IT::size; ++j )
-               array[j] = ElementType();
-            return blaze::load( array.data() );
+            return loadTail( typename IsDenseIterator<IteratorType>::Type() );
          }
       }
       //*******************************************************************************************
@@ -864,6 +862,34 @@ class DenseSubmatrix : public DenseMatrix< DenseSubmatrix<MT,AF,SO>, SO >
       //*******************************************************************************************
 
     private:
+      //**Tail load functions**********************************************************************
+      /*!\brief Masked load of the final, partial intrinsic element of the submatrix.
+      //
+      // \return The loaded intrinsic element.
+      //
+      // This function is selected in case the underlying iterator refers to contiguous memory.
+      */
+      inline IntrinsicType loadTail( TrueType ) const {
+         return blaze::maskload( iterator_.base(), rest_ );
+      }
+
+      /*!\brief Element-wise load of the final, partial intrinsic element of the submatrix.
+      //
+      // \return The loaded intrinsic element.
+      //
+      // This function is selected in case the underlying iterator does not provide a pointer
+      // to contiguous memory (as for instance in case of nested views).
+      */
+      inline IntrinsicType loadTail( FalseType ) const {
+         AlignedArray<ElementType,IT::size> array;
+         for( size_t j=0UL; j<rest_; ++j )
+            array[j] = *(iterator_+j);
+         for( size_t j=rest_; j<IT::size; ++j )
+            array[j] = ElementType();
+         return blaze::load( array.data() );
+      }
+      //*******************************************************************************************
+
       //**Member variables*************************************************************************
       IteratorType iterator_;   //!< Iterator to the current submatrix element.
       IteratorType final_;      //!< The final iterator for intrinsic operations.
@@ -1136,6 +1162,17 @@ class DenseSubmatrix : public DenseMatrix< DenseSubmatrix<MT,AF,SO>, SO >
    //@}
    //**********************************************************************************************
 
+   //**Tail functions******************************************************************************
+   /*!\name Tail functions */
+   //@{
+   inline IntrinsicType loadTail( size_t i, size_t j, TrueType  ) const;
+   inline IntrinsicType loadTail( size_t i, size_t j, FalseType ) const;
+
+   inline void storeTail( size_t i, size_t j, const IntrinsicType& value, TrueType  );
+   inline void storeTail( size_t i, size_t j, const IntrinsicType& value, FalseType );
+   //@}
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
@@ -3163,8 +3200,6 @@ template< typename MT  // Type of the dense matrix
 inline typename DenseSubmatrix<MT,AF,SO>::IntrinsicType
    DenseSubmatrix<MT,AF,SO>::loadu( size_t i, size_t j ) const
 {
-   using blaze::load;
-
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
 
    BLAZE_INTERNAL_ASSERT( i < rows()         , "Invalid row access index"    );
@@ -3178,12 +3213,7 @@ inline typename DenseSubmatrix<MT,AF,SO>::IntrinsicType
       return matrix_.loadu( row_+i, column_+j );
    }
    else {
-      AlignedArray<ElementType,IT::size> array;
-      for( size_t k=0UL; k<rest_; ++k )
-         array[k] = matrix_(row_+i,column_+j+k);
-      for( size_t k=rest_; k<IT::size; ++k )
-         array[k] = ElementType();
-      return load( array.data() );
+      return loadTail( i, j, typename IsDenseIterator<typename MT::ConstIterator>::Type() );
    }
 }
 //*************************************************************************************************
@@ -3236,8 +3266,6 @@ template< typename MT  // Type of the dense matrix
         , bool SO >    // Storage order
 inline void DenseSubmatrix<MT,AF,SO>::storeu( size_t i, size_t j, const IntrinsicType& value )
 {
-   using blaze::store;
-
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
 
    BLAZE_INTERNAL_ASSERT( i < rows()         , "Invalid row access index"    );
@@ -3251,15 +3279,109 @@ inline void DenseSubmatrix<MT,AF,SO>::storeu( size_t i, size_t j, const Intrinsi
       matrix_.storeu( row_+i, column_+j, value );
    }
    else {
-      AlignedArray<ElementType,IT::size> array;
-      store( array.data(), value );
-      for( size_t k=0UL; k<rest_; ++k )
-         matrix_(row_+i,column_+j+k) = array[k];
+      storeTail( i, j, value, typename IsDenseIterator<typename MT::Iterator>::Type() );
    }
 }
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Masked load of the final, partial intrinsic element of the submatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded intrinsic element.
+//
+// This function is selected in case the underlying dense matrix provides an iterator to
+// contiguous memory. The elements beyond the end of the submatrix are not accessed.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool AF      // Alignment flag
+        , bool SO >    // Storage order
+inline typename DenseSubmatrix<MT,AF,SO>::IntrinsicType
+   DenseSubmatrix<MT,AF,SO>::loadTail( size_t i, size_t j, TrueType ) const
+{
+   const MT& matrix( matrix_ );
+   return maskload( ( matrix.begin(row_+i)+column_+j ).base(), rest_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise load of the final, partial intrinsic element of the submatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded intrinsic element.
+//
+// This function is selected in case the underlying dense matrix does not provide an iterator
+// to contiguous memory (as for instance in case of nested views).
+*/
+template< typename MT  // Type of the dense matrix
+        , bool AF      // Alignment flag
+        , bool SO >    // Storage order
+inline typename DenseSubmatrix<MT,AF,SO>::IntrinsicType
+   DenseSubmatrix<MT,AF,SO>::loadTail( size_t i, size_t j, FalseType ) const
+{
+   using blaze::load;
+
+   AlignedArray<ElementType,IT::size> array;
+   for( size_t k=0UL; k<rest_; ++k )
+      array[k] = matrix_(row_+i,column_+j+k);
+   for( size_t k=rest_; k<IT::size; ++k )
+      array[k] = ElementType();
+   return load( array.data() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked store of the final, partial intrinsic element of the submatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The intrinsic element to be stored.
+// \return void
+//
+// This function is selected in case the underlying dense matrix provides an iterator to
+// contiguous memory. The elements beyond the end of the submatrix are not modified.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool AF      // Alignment flag
+        , bool SO >    // Storage order
+inline void DenseSubmatrix<MT,AF,SO>::storeTail( size_t i, size_t j, const IntrinsicType& value, TrueType )
+{
+   maskstore( ( matrix_.begin(row_+i)+column_+j ).base(), rest_, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise store of the final, partial intrinsic element of the submatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The intrinsic element to be stored.
+// \return void
+//
+// This function is selected in case the underlying dense matrix does not provide an iterator
+// to contiguous memory (as for instance in case of nested views).
+*/
+template< typename MT  // Type of the dense matrix
+        , bool AF      // Alignment flag
+        , bool SO >    // Storage order
+inline void DenseSubmatrix<MT,AF,SO>::storeTail( size_t i, size_t j, const IntrinsicType& value, FalseType )
+{
+   using blaze::store;
+
+   AlignedArray<ElementType,IT::size> array;
+   store( array.data(), value );
+   for( size_t k=0UL; k<rest_; ++k )
+      matrix_(row_+i,column_+j+k) = array[k];
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Aligned, non-temporal store of an intrinsic element of the submatrix.
 //
@@ -4091,12 +4213,7 @@ class DenseSubmatrix<MT,unaligned,true> : public DenseMatrix< DenseSubmatrix<MT,
             return iterator_.loadu();
          }
          else {
-            AlignedArray<ElementType,IT::size> array;
-            for( size_t i=0UL; i<rest_; ++i )
-               array[i] = *(iterator_+i);
-            for( size_t i=rest_; i<IT::size; ++i )
-               array[i] = ElementType();
-            return blaze::load( array.data() );
+            return loadTail( typename IsDenseIterator<IteratorType>::Type() );
          }
       }
       //*******************************************************************************************
@@ -4255,6 +4372,34 @@ class DenseSubmatrix<MT,unaligned,true> : public DenseMatrix< DenseSubmatrix<MT,
       //*******************************************************************************************
 
     private:
+      //**Tail load functions**********************************************************************
+      /*!\brief Masked load of the final, partial intrinsic element of the submatrix.
+      //
+      // \return The loaded intrinsic element.
+      //
+      // This function is selected in case the underlying iterator refers to contiguous memory.
+      */
+      inline IntrinsicType loadTail( TrueType ) const {
+         return blaze::maskload( iterator_.base(), rest_ );
+      }
+
+      /*!\brief Element-wise load of the final, partial intrinsic element of the submatrix.
+      //
+      // \return The loaded intrinsic element.
+      //
+      // This function is selected in case the underlying iterator does not provide a pointer
+      // to contiguous memory (as for instance in case of nested views).
+      */
+      inline IntrinsicType loadTail( FalseType ) const {
+         AlignedArray<ElementType,IT::size> array;
+         for( size_t i=0UL; i<rest_; ++i )
+            array[i] = *(iterator_+i);
+         for( size_t i=rest_; i<IT::size; ++i )
+            array[i] = ElementType();
+         return blaze::load( array.data() );
+      }
+      //*******************************************************************************************
+
       //**Member variables*************************************************************************
       IteratorType iterator_;   //!< Iterator to the current submatrix element.
       IteratorType final_;      //!< The final iterator for intrinsic operations.
@@ -4521,6 +4666,17 @@ class DenseSubmatrix<MT,unaligned,true> : public DenseMatrix< DenseSubmatrix<MT,
    //@}
    //**********************************************************************************************
 
+   //**Tail functions******************************************************************************
+   /*!\name Tail functions */
+   //@{
+   inline IntrinsicType loadTail( size_t i, size_t j, TrueType  ) const;
+   inline IntrinsicType loadTail( size_t i, size_t j, FalseType ) const;
+
+   inline void storeTail( size_t i, size_t j, const IntrinsicType& value, TrueType  );
+   inline void storeTail( size_t i, size_t j, const IntrinsicType& value, FalseType );
+   //@}
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
@@ -6502,8 +6658,6 @@ template< typename MT >  // Type of the dense matrix
 inline typename DenseSubmatrix<MT,unaligned,true>::IntrinsicType
    DenseSubmatrix<MT,unaligned,true>::loadu( size_t i, size_t j ) const
 {
-   using blaze::load;
-
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
 
    BLAZE_INTERNAL_ASSERT( i < rows()         , "Invalid row access index"    );
@@ -6517,12 +6671,7 @@ inline typename DenseSubmatrix<MT,unaligned,true>::IntrinsicType
       return matrix_.loadu( row_+i, column_+j );
    }
    else {
-      AlignedArray<ElementType,IT::size> array;
-      for( size_t k=0UL; k<rest_; ++k )
-         array[k] = matrix_(row_+i+k,column_+j);
-      for( size_t k=rest_; k<IT::size; ++k )
-         array[k] = ElementType();
-      return load( array.data() );
+      return loadTail( i, j, typename IsDenseIterator<typename MT::ConstIterator>::Type() );
    }
 }
 /*! \endcond */
@@ -6574,8 +6723,6 @@ inline void DenseSubmatrix<MT,unaligned,true>::store( size_t i, size_t j, const
 template< typename MT >  // Type of the dense matrix
 inline void DenseSubmatrix<MT,unaligned,true>::storeu( size_t i, size_t j, const IntrinsicType& value )
 {
-   using blaze::store;
-
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
 
    BLAZE_INTERNAL_ASSERT( i < rows()         , "Invalid row access index"    );
@@ -6589,16 +6736,110 @@ inline void DenseSubmatrix<MT,unaligned,true>::storeu( size_t i, size_t j, const
       matrix_.storeu( row_+i, column_+j, value );
    }
    else {
-      AlignedArray<ElementType,IT::size> array;
-      store( array.data(), value );
-      for( size_t k=0UL; k<rest_; ++k )
-         matrix_(row_+i+k,column_+j) = array[k];
+      storeTail( i, j, value, typename IsDenseIterator<typename MT::Iterator>::Type() );
    }
 }
 /*! \endcond */
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Masked load of the final, partial intrinsic element of the submatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded intrinsic element.
+//
+// This function is selected in case the underlying dense matrix provides an iterator to
+// contiguous memory. The elements beyond the end of the submatrix are not accessed.
+*/
+template< typename MT >  // Type of the dense matrix
+inline typename DenseSubmatrix<MT,unaligned,true>::IntrinsicType
+   DenseSubmatrix<MT,unaligned,true>::loadTail( size_t i, size_t j, TrueType ) const
+{
+   const MT& matrix( matrix_ );
+   return maskload( ( matrix.begin(column_+j)+row_+i ).base(), rest_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Element-wise load of the final, partial intrinsic element of the submatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded intrinsic element.
+//
+// This function is selected in case the underlying dense matrix does not provide an iterator
+// to contiguous memory (as for instance in case of nested views).
+*/
+template< typename MT >  // Type of the dense matrix
+inline typename DenseSubmatrix<MT,unaligned,true>::IntrinsicType
+   DenseSubmatrix<MT,unaligned,true>::loadTail( size_t i, size_t j, FalseType ) const
+{
+   using blaze::load;
+
+   AlignedArray<ElementType,IT::size> array;
+   for( size_t k=0UL; k<rest_; ++k )
+      array[k] = matrix_(row_+i+k,column_+j);
+   for( size_t k=rest_; k<IT::size; ++k )
+      array[k] = ElementType();
+   return load( array.data() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Masked store of the final, partial intrinsic element of the submatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The intrinsic element to be stored.
+// \return void
+//
+// This function is selected in case the underlying dense matrix provides an iterator to
+// contiguous memory. The elements beyond the end of the submatrix are not modified.
+*/
+template< typename MT >  // Type of the dense matrix
+inline void DenseSubmatrix<MT,unaligned,true>::storeTail( size_t i, size_t j, const IntrinsicType& value, TrueType )
+{
+   maskstore( ( matrix_.begin(column_+j)+row_+i ).base(), rest_, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Element-wise store of the final, partial intrinsic element of the submatrix.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The intrinsic element to be stored.
+// \return void
+//
+// This function is selected in case the underlying dense matrix does not provide an iterator
+// to contiguous memory (as for instance in case of nested views).
+*/
+template< typename MT >  // Type of the dense matrix
+inline void DenseSubmatrix<MT,unaligned,true>::storeTail( size_t i, size_t j, const IntrinsicType& value, FalseType )
+{
+   using blaze::store;
+
+   AlignedArray<ElementType,IT::size> array;
+   store( array.data(), value );
+   for( size_t k=0UL; k<rest_; ++k )
+      matrix_(row_+i+k,column_+j) = array[k];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Aligned, non-temporal store of an intrinsic element of the submatrix.
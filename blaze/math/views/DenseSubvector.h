@@ -62,6 +62,7 @@
 #include <blaze/math/traits/SubvectorTrait.h>
 #include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsDenseIterator.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsRestricted.h>
 #include <blaze/math/typetraits/IsRowVector.h>
@@ -76,10 +77,12 @@
 #include <blaze/util/constraints/Vectorizable.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/FalseType.h>
 #include <blaze/util/logging/FunctionTrace.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/mpl/Or.h>
 #include <blaze/util/Template.h>
+#include <blaze/util/TrueType.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsConst.h>
 #include <blaze/util/typetraits/IsNumeric.h>
@@ -607,12 +610,7 @@ class DenseSubvector : public DenseVector< DenseSubvector<VT,AF,TF>, TF >
             return iterator_.loadu();
          }
          else {
-            AlignedArray<ElementType,IT::size> array;
-            for( size_t i=0UL; i<rest_; ++i )
-               array[i] = *(iterator_+i);
-            for( size_t i=rest_; i<IT::size; ++i )
-               array[i] = ElementType();
-            return blaze::load( array.data() );
+            return loadTail( typename IsDenseIterator<IteratorType>::Type() );
          }
       }
       //*******************************************************************************************
@@ -771,6 +769,34 @@ class DenseSubvector : public DenseVector< DenseSubvector<VT,AF,TF>, TF >
       //*******************************************************************************************
 
     private:
+      //**Tail load functions**********************************************************************
+      /*!\brief Masked load of the final, partial intrinsic element of the subvector.
+      //
+      // \return The loaded intrinsic element.
+      //
+      // This function is selected in case the underlying iterator refers to contiguous memory.
+      */
+      inline IntrinsicType loadTail( TrueType ) const {
+         return blaze::maskload( iterator_.base(), rest_ );
+      }
+
+      /*!\brief Element-wise load of the final, partial intrinsic element of the subvector.
+      //
+      // \return The loaded intrinsic element.
+      //
+      // This function is selected in case the underlying iterator does not provide a pointer
+      // to contiguous memory (as for instance in case of nested views).
+      */
+      inline IntrinsicType loadTail( FalseType ) const {
+         AlignedArray<ElementType,IT::size> array;
+         for( size_t i=0UL; i<rest_; ++i )
+            array[i] = *(iterator_+i);
+         for( size_t i=rest_; i<IT::size; ++i )
+            array[i] = ElementType();
+         return blaze::load( array.data() );
+      }
+      //*******************************************************************************************
+
       //**Member variables*************************************************************************
       IteratorType iterator_;   //!< Iterator to the current subvector element.
       IteratorType final_;      //!< The final iterator for intrinsic operations.
@@ -972,6 +998,17 @@ class DenseSubvector : public DenseVector< DenseSubvector<VT,AF,TF>, TF >
    //**********************************************************************************************
 
  private:
+   //**Tail functions******************************************************************************
+   /*!\name Tail functions */
+   //@{
+   inline IntrinsicType loadTail( size_t index, TrueType  ) const;
+   inline IntrinsicType loadTail( size_t index, FalseType ) const;
+
+   inline void storeTail( size_t index, const IntrinsicType& value, TrueType  );
+   inline void storeTail( size_t index, const IntrinsicType& value, FalseType );
+   //@}
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
@@ -1793,8 +1830,6 @@ template< typename VT  // Type of the dense vector
 inline typename DenseSubvector<VT,AF,TF>::IntrinsicType
    DenseSubvector<VT,AF,TF>::loadu( size_t index ) const
 {
-   using blaze::load;
-
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
 
    BLAZE_INTERNAL_ASSERT( index < size()         , "Invalid subvector access index" );
@@ -1807,12 +1842,7 @@ inline typename DenseSubvector<VT,AF,TF>::IntrinsicType
       return vector_.loadu( offset_+index );
    }
    else {
-      AlignedArray<ElementType,IT::size> array;
-      for( size_t i=0UL; i<rest_; ++i )
-         array[i] = vector_[offset_+index+i];
-      for( size_t i=rest_; i<IT::size; ++i )
-         array[i] = ElementType();
-      return load( array.data() );
+      return loadTail( index, typename IsDenseIterator<typename VT::ConstIterator>::Type() );
    }
 }
 //*************************************************************************************************
@@ -1861,8 +1891,6 @@ template< typename VT  // Type of the dense vector
         , bool TF >    // Transpose flag
 inline void DenseSubvector<VT,AF,TF>::storeu( size_t index, const IntrinsicType& value )
 {
-   using blaze::store;
-
    BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
 
    BLAZE_INTERNAL_ASSERT( index < size()         , "Invalid subvector access index" );
@@ -1875,15 +1903,105 @@ inline void DenseSubvector<VT,AF,TF>::storeu( size_t index, const IntrinsicType&
       vector_.storeu( offset_+index, value );
    }
    else {
-      AlignedArray<ElementType,IT::size> array;
-      store( array.data(), value );
-      for( size_t i=0UL; i<rest_; ++i )
-         vector_[offset_+index+i] = array[i];
+      storeTail( index, value, typename IsDenseIterator<typename VT::Iterator>::Type() );
    }
 }
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Masked load of the final, partial intrinsic element of the subvector.
+//
+// \param index Access index of the final intrinsic element.
+// \return The loaded intrinsic element.
+//
+// This function is selected in case the underlying dense vector provides an iterator to
+// contiguous memory. The elements beyond the end of the subvector are not accessed.
+*/
+template< typename VT  // Type of the dense vector
+        , bool AF      // Alignment flag
+        , bool TF >    // Transpose flag
+inline typename DenseSubvector<VT,AF,TF>::IntrinsicType
+   DenseSubvector<VT,AF,TF>::loadTail( size_t index, TrueType ) const
+{
+   const VT& vector( vector_ );
+   return maskload( ( vector.begin()+offset_+index ).base(), rest_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise load of the final, partial intrinsic element of the subvector.
+//
+// \param index Access index of the final intrinsic element.
+// \return The loaded intrinsic element.
+//
+// This function is selected in case the underlying dense vector does not provide an iterator
+// to contiguous memory (as for instance in case of nested views).
+*/
+template< typename VT  // Type of the dense vector
+        , bool AF      // Alignment flag
+        , bool TF >    // Transpose flag
+inline typename DenseSubvector<VT,AF,TF>::IntrinsicType
+   DenseSubvector<VT,AF,TF>::loadTail( size_t index, FalseType ) const
+{
+   using blaze::load;
+
+   AlignedArray<ElementType,IT::size> array;
+   for( size_t i=0UL; i<rest_; ++i )
+      array[i] = vector_[offset_+index+i];
+   for( size_t i=rest_; i<IT::size; ++i )
+      array[i] = ElementType();
+   return load( array.data() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked store of the final, partial intrinsic element of the subvector.
+//
+// \param index Access index of the final intrinsic element.
+// \param value The intrinsic element to be stored.
+// \return void
+//
+// This function is selected in case the underlying dense vector provides an iterator to
+// contiguous memory. The elements beyond the end of the subvector are not modified.
+*/
+template< typename VT  // Type of the dense vector
+        , bool AF      // Alignment flag
+        , bool TF >    // Transpose flag
+inline void DenseSubvector<VT,AF,TF>::storeTail( size_t index, const IntrinsicType& value, TrueType )
+{
+   maskstore( ( vector_.begin()+offset_+index ).base(), rest_, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Element-wise store of the final, partial intrinsic element of the subvector.
+//
+// \param index Access index of the final intrinsic element.
+// \param value The intrinsic element to be stored.
+// \return void
+//
+// This function is selected in case the underlying dense vector does not provide an iterator
+// to contiguous memory (as for instance in case of nested views).
+*/
+template< typename VT  // Type of the dense vector
+        , bool AF      // Alignment flag
+        , bool TF >    // Transpose flag
+inline void DenseSubvector<VT,AF,TF>::storeTail( size_t index, const IntrinsicType& value, FalseType )
+{
+   using blaze::store;
+
+   AlignedArray<ElementType,IT::size> array;
+   store( array.data(), value );
+   for( size_t i=0UL; i<rest_; ++i )
+      vector_[offset_+index+i] = array[i];
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Aligned, non-temporal store of an intrinsic element of the subvector.
 //
@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
 #include <blaze/config/SMP.h>
 
 
@@ -123,4 +125,23 @@
 #endif
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( blaze::SMP_TASKS_PER_THREAD > 0UL );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
 #endif
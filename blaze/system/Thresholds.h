@@ -80,6 +80,9 @@ BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECADD_THRESHOLD    >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECSUB_THRESHOLD    >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECMULT_THRESHOLD   >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DVECSCALARMULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SVECSVECADD_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SVECSVECSUB_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SVECSCALARMULT_THRESHOLD >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DMATDVECMULT_THRESHOLD   >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDVECMULT_THRESHOLD  >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_TDVECDMATMULT_THRESHOLD  >= 0UL );
@@ -118,7 +121,13 @@ BLAZE_STATIC_ASSERT( blaze::SMP_SMATSMATMULT_THRESHOLD   >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_SMATTSMATMULT_THRESHOLD  >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSMATMULT_THRESHOLD  >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTSMATMULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATSMATADD_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATSMATSUB_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATSCALARMULT_THRESHOLD >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DVECTDVECMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECREDUCE_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATREDUCE_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_PGS_THRESHOLD            >= 0UL );
 
 }
 /*! \endcond */
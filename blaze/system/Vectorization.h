@@ -233,6 +233,42 @@
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Compilation switch for the AVX-512 mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the AVX-512 mode. In case the AVX-512 mode is enabled
+// (i.e. in case the AVX-512F, AVX-512BW, and AVX-512DQ functionality is available) the Blaze
+// library attempts to vectorize the linear algebra operations by 512-bit AVX-512 intrinsics.
+// In case the AVX-512 mode is disabled, the Blaze library falls back to the AVX2/AVX or SSE
+// intrinsics or chooses default, non-vectorized functionality for the operations.
+*/
+#if BLAZE_USE_VECTORIZATION && defined(__AVX512F__) && defined(__AVX512BW__) && \
+    defined(__AVX512DQ__)
+#  define BLAZE_AVX512_MODE 1
+#else
+#  define BLAZE_AVX512_MODE 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the FMA mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the FMA mode. In case the FMA mode is enabled
+// (i.e. in case FMA functionality is available) the Blaze library attempts to use fused
+// multiply-add intrinsics in all multiply-accumulate loops. In case the FMA mode is disabled,
+// the Blaze library resorts to separate multiplication and addition intrinsics.
+*/
+#if BLAZE_USE_VECTORIZATION && defined(__FMA__)
+#  define BLAZE_FMA_MODE 1
+#else
+#  define BLAZE_FMA_MODE 0
+#endif
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Compilation switch for the MIC mode.
 // \ingroup system
@@ -268,6 +304,8 @@ BLAZE_STATIC_ASSERT( !BLAZE_SSSE3_MODE || BLAZE_SSE3_MODE  );
 BLAZE_STATIC_ASSERT( !BLAZE_SSE4_MODE  || BLAZE_SSSE3_MODE );
 BLAZE_STATIC_ASSERT( !BLAZE_AVX_MODE   || BLAZE_SSE4_MODE  );
 BLAZE_STATIC_ASSERT( !BLAZE_AVX2_MODE  || BLAZE_AVX_MODE   );
+BLAZE_STATIC_ASSERT( !BLAZE_AVX512_MODE || BLAZE_AVX2_MODE  );
+BLAZE_STATIC_ASSERT( !BLAZE_FMA_MODE   || BLAZE_AVX_MODE   );
 
 }
 /*! \endcond */
@@ -282,7 +320,7 @@ BLAZE_STATIC_ASSERT( !BLAZE_AVX2_MODE  || BLAZE_AVX_MODE   );
 //
 //=================================================================================================
 
-#if BLAZE_MIC_MODE || BLAZE_AVX_MODE || BLAZE_AVX2_MODE
+#if BLAZE_MIC_MODE || BLAZE_AVX_MODE || BLAZE_AVX2_MODE || BLAZE_AVX512_MODE || BLAZE_FMA_MODE
 #  include <immintrin.h>
 #elif BLAZE_SSE4_MODE
 #  include <smmintrin.h>
@@ -0,0 +1,653 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/Arena.h
+//  \brief Header file for the thread-local memory arena
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_UTIL_ARENA_H_
+#define _BLAZE_UTIL_ARENA_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <new>
+#include <blaze/system/ThreadLocal.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Byte.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ARENA STATE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Header of a single memory chunk of the thread-local arena.
+// \ingroup util
+//
+// The usable memory of a chunk directly follows its header.
+*/
+struct ArenaChunk
+{
+   ArenaChunk* prev_;  //!< The previously allocated chunk of the arena.
+   size_t      size_;  //!< The number of usable bytes of the chunk.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief State of the thread-local arena.
+// \ingroup util
+*/
+struct ArenaState
+{
+   ArenaChunk* chunk_;     //!< The current memory chunk.
+   byte*       top_;       //!< The first free byte of the current memory chunk.
+   byte*       end_;       //!< The end of the current memory chunk.
+   size_t      used_;      //!< The number of bytes currently in use (including padding).
+   size_t      peak_;      //!< The maximum number of bytes in use since the last reset.
+   size_t      capacity_;  //!< The total number of usable bytes of all chunks.
+   size_t      demand_;    //!< The capacity requested for the next outermost scope.
+   size_t      depth_;     //!< The nesting depth of the active arena scopes.
+   size_t      routed_;    //!< The nesting depth of the active arena temporaries guards.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Minimum number of usable bytes of a single memory chunk of the arena.
+// \ingroup util
+*/
+const size_t arenaChunkSize = 65536UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the arena state of the calling thread.
+// \ingroup util
+//
+// \return Reference to the thread-local arena state.
+*/
+inline ArenaState& arenaState()
+{
+   static BLAZE_THREAD_LOCAL ArenaState state;
+   return state;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the first usable byte of the given memory chunk.
+// \ingroup util
+//
+// \param chunk The memory chunk.
+// \return Pointer to the first usable byte of the chunk.
+*/
+inline byte* arenaBegin( ArenaChunk* chunk )
+{
+   return reinterpret_cast<byte*>( chunk + 1 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Allocation of a new memory chunk for the given arena.
+// \ingroup util
+//
+// \param state The arena state.
+// \param size The number of usable bytes of the new chunk.
+// \return void
+// \exception std::bad_alloc Allocation failed.
+*/
+inline void pushArenaChunk( ArenaState& state, size_t size )
+{
+   void* const raw( std::malloc( sizeof(ArenaChunk) + size ) );
+
+   if( raw == NULL )
+      throw std::bad_alloc();
+
+   ArenaChunk* const chunk( static_cast<ArenaChunk*>( raw ) );
+   chunk->prev_ = state.chunk_;
+   chunk->size_ = size;
+
+   state.chunk_     = chunk;
+   state.top_       = arenaBegin( chunk );
+   state.end_       = state.top_ + size;
+   state.capacity_ += size;
+
+   if( state.demand_ < state.capacity_ )
+      state.demand_ = state.capacity_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Resetting the given arena to the given memory chunk and position.
+// \ingroup util
+//
+// \param state The arena state.
+// \param chunk The memory chunk to return to.
+// \param top The first free byte within the memory chunk.
+// \param used The number of bytes in use at the given position.
+// \return void
+//
+// All chunks that have been allocated after the given chunk are released.
+*/
+inline void rewindArena( ArenaState& state, ArenaChunk* chunk, byte* top, size_t used )
+{
+   while( state.chunk_ != chunk ) {
+      ArenaChunk* const prev( state.chunk_->prev_ );
+      state.capacity_ -= state.chunk_->size_;
+      std::free( state.chunk_ );
+      state.chunk_ = prev;
+   }
+
+   state.top_  = top;
+   state.end_  = ( chunk != NULL )?( arenaBegin( chunk ) + chunk->size_ ):( NULL );
+   state.used_ = used;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Adapting the memory of an inactive arena to its demand.
+// \ingroup util
+//
+// \param state The arena state.
+// \return void
+// \exception std::bad_alloc Allocation failed.
+//
+// This function replaces all memory chunks of the given arena by a single chunk that is large
+// enough to serve the capacity of all previous chunks. Thus the next outermost scope can be
+// served without any further allocation as long as its demand does not exceed the demand of
+// the previous scopes.
+*/
+inline void consolidateArena( ArenaState& state )
+{
+   BLAZE_INTERNAL_ASSERT( state.depth_ == 0UL, "Active arena scope detected" );
+
+   if( state.demand_ > 0UL && state.chunk_ != NULL && state.chunk_->prev_ == NULL &&
+       state.chunk_->size_ >= state.demand_ ) {
+      state.top_  = arenaBegin( state.chunk_ );
+      state.used_ = 0UL;
+      return;
+   }
+
+   const size_t demand( state.demand_ );
+
+   rewindArena( state, NULL, NULL, 0UL );
+
+   if( demand > 0UL )
+      pushArenaChunk( state, demand );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned allocation from the arena of the calling thread.
+// \ingroup util
+//
+// \param size The number of bytes to be allocated.
+// \param alignment The required minimum alignment.
+// \return Byte pointer to the first byte of the aligned memory.
+// \exception std::bad_alloc Allocation failed.
+*/
+inline byte* arenaAllocate( size_t size, size_t alignment )
+{
+   ArenaState& state( arenaState() );
+
+   BLAZE_INTERNAL_ASSERT( state.depth_ > 0UL, "No active arena scope detected" );
+
+   const size_t mask( alignment - 1UL );
+   byte* address( NULL );
+
+   if( state.chunk_ != NULL ) {
+      address = state.top_ + ( ( alignment - reinterpret_cast<size_t>( state.top_ ) ) & mask );
+   }
+
+   if( state.chunk_ == NULL || address > state.end_ || size > size_t( state.end_ - address ) )
+   {
+      size_t chunkSize( size + alignment );
+      if( chunkSize < state.capacity_ ) chunkSize = state.capacity_;
+      if( chunkSize < arenaChunkSize  ) chunkSize = arenaChunkSize;
+
+      pushArenaChunk( state, chunkSize );
+      address = state.top_ + ( ( alignment - reinterpret_cast<size_t>( state.top_ ) ) & mask );
+   }
+
+   state.used_ += size_t( address - state.top_ ) + size;
+   state.top_   = address + size;
+
+   if( state.peak_ < state.used_ )
+      state.peak_ = state.used_;
+
+   return address;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks whether the given address belongs to the arena of the calling thread.
+// \ingroup util
+//
+// \param address The address to be checked.
+// \return \a true if the address belongs to the arena, \a false if not.
+*/
+inline bool arenaOwns( const void* address )
+{
+   const byte* const ptr( static_cast<const byte*>( address ) );
+
+   for( ArenaChunk* chunk=arenaState().chunk_; chunk!=NULL; chunk=chunk->prev_ ) {
+      const byte* const begin( arenaBegin( chunk ) );
+      if( ptr >= begin && ptr <= begin + chunk->size_ )
+         return true;
+   }
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scope guard for the thread-local memory arena.
+// \ingroup util
+//
+// While an ArenaScope is alive, the temporaries that are created by the calling thread during
+// the evaluation of expressions are served from a thread-local arena instead of the heap. This
+// includes the evaluated operands of dense matrix/matrix and matrix/vector multiplications
+// (as for instance the result of an eval() or of a nested expression), the packing buffers of
+// the dense matrix multiplication, and the accumulators of the sparse kernels. Deallocating
+// arena memory has no effect, instead all arena memory allocated within a scope is released at
+// once at the end of the scope:
+
+   \code
+   blaze::DynamicMatrix<double> A( 100UL, 100UL ), B( 100UL, 100UL );
+   blaze::DynamicVector<double> x( 100UL ), y( 100UL );
+
+   while( running )
+   {
+      blaze::ArenaScope scope;  // Serving the temporaries of the following expressions
+
+      y = ( A + B ) * x;        // The temporary for (A+B) is allocated from the arena
+      y += A * B * x;
+   }  // Releasing the arena memory of the temporaries
+   \endcode
+
+// Scopes can be nested, in which case each scope only releases the memory allocated within
+// it. After the outermost scope of a thread has ended, the memory of the arena is combined in
+// a single chunk that is large enough for the demand of all previous scopes. Therefore, from
+// the second iteration of a loop with constant demand on, the expressions within the scope
+// don't cause any further heap allocation. Via the reserveArena() function it is possible to
+// reserve the memory up front. Information about the memory in use is provided by the
+// getArenaUsage(), getArenaPeak(), and getArenaCapacity() functions.
+//
+// All other memory is allocated from the heap as usual, even within an active scope. This
+// includes the memory of all vectors and matrices that are created or resized by the user (as
+// for instance \c y in the example above) and the memory of the targets of the assignments.
+// Custom data structures can explicitly draw from the arena via the ArenaAllocator. Since the
+// arena is thread-local, the temporaries created by the threads of the SMP backends are
+// allocated from the heap as well. The memory of the arena of a thread is not released
+// automatically at the end of the thread; threads that are terminated before the end of the
+// program should therefore call releaseArena().
+*/
+class ArenaScope : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline ArenaScope();
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~ArenaScope();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   ArenaChunk* chunk_;  //!< The current memory chunk at the beginning of the scope.
+   byte*       top_;    //!< The first free byte of the memory chunk at the beginning of the scope.
+   size_t      used_;   //!< The number of bytes in use at the beginning of the scope.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor of the ArenaScope class.
+//
+// The constructor activates the arena of the calling thread and stores the current position
+// of the arena.
+*/
+inline ArenaScope::ArenaScope()
+   : chunk_( arenaState().chunk_ )  // The current memory chunk at the beginning of the scope
+   , top_  ( arenaState().top_   )  // The first free byte of the memory chunk
+   , used_ ( arenaState().used_  )  // The number of bytes in use at the beginning of the scope
+{
+   ++arenaState().depth_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor of the ArenaScope class.
+//
+// The destructor releases all arena memory that has been allocated within the scope. In case
+// of the outermost scope, the memory of the arena is adapted to the demand of the scope.
+*/
+inline ArenaScope::~ArenaScope()
+{
+   ArenaState& state( arenaState() );
+
+   BLAZE_INTERNAL_ASSERT( state.depth_ > 0UL, "No active arena scope detected" );
+
+   rewindArena( state, chunk_, top_, used_ );
+
+   if( --state.depth_ == 0UL ) {
+      try {
+         consolidateArena( state );
+      }
+      catch( ... ) {}
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS ARENATEMPORARIES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Guard for the evaluation of expression temporaries from the thread-local arena.
+// \ingroup util
+//
+// While an ArenaTemporaries guard is alive and an ArenaScope is active on the calling thread,
+// the aligned arrays of built-in data types that are acquired via the allocate() function are
+// served from the arena. The guard is exclusively used by the expression templates around the
+// evaluation of their operands, i.e. in places where all vectors and matrices created by the
+// calling thread are local temporaries and no assignment target is resized:
+
+   \code
+   const ArenaTemporaries arena;  // Serving the operand temporaries from the arena
+   LT A( serial( rhs.lhs_ ) );    // Evaluation of the left-hand side dense matrix operand
+   RT B( serial( rhs.rhs_ ) );    // Evaluation of the right-hand side dense matrix operand
+   \endcode
+*/
+class ArenaTemporaries : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief The constructor of the ArenaTemporaries class.
+   */
+   explicit inline ArenaTemporaries()
+   {
+      ++arenaState().routed_;
+   }
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\brief The destructor of the ArenaTemporaries class.
+   */
+   inline ~ArenaTemporaries()
+   {
+      BLAZE_INTERNAL_ASSERT( arenaState().routed_ > 0UL, "No active arena temporaries detected" );
+      --arenaState().routed_;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ARENA FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Arena functions */
+//@{
+inline bool   isArenaActive();
+inline bool   isArenaRouted();
+inline size_t getArenaUsage();
+inline size_t getArenaPeak();
+inline size_t getArenaCapacity();
+inline void   resetArenaPeak();
+inline void   reserveArena( size_t bytes );
+inline void   releaseArena();
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether an arena scope is active on the calling thread.
+// \ingroup util
+//
+// \return \a true if an arena scope is active, \a false if not.
+*/
+inline bool isArenaActive()
+{
+   return arenaState().depth_ > 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the allocations of the calling thread are served from the arena.
+// \ingroup util
+//
+// \return \a true if an arena scope and an ArenaTemporaries guard are active, \a false if not.
+*/
+inline bool isArenaRouted()
+{
+   const ArenaState& state( arenaState() );
+   return state.depth_ > 0UL && state.routed_ > 0UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of arena bytes currently in use by the calling thread.
+// \ingroup util
+//
+// \return The number of bytes in use, including the padding for alignment.
+*/
+inline size_t getArenaUsage()
+{
+   return arenaState().used_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum number of arena bytes in use by the calling thread.
+// \ingroup util
+//
+// \return The peak number of bytes in use since the first allocation or the last resetArenaPeak().
+*/
+inline size_t getArenaPeak()
+{
+   return arenaState().peak_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of bytes of the arena of the calling thread.
+// \ingroup util
+//
+// \return The number of bytes of all memory chunks of the arena.
+*/
+inline size_t getArenaCapacity()
+{
+   return arenaState().capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the peak statistics of the arena of the calling thread to the current usage.
+// \ingroup util
+//
+// \return void
+*/
+inline void resetArenaPeak()
+{
+   ArenaState& state( arenaState() );
+   state.peak_ = state.used_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reserves memory for the arena of the calling thread.
+// \ingroup util
+//
+// \param bytes The minimum number of bytes of the arena.
+// \return void
+// \exception std::bad_alloc Allocation failed.
+//
+// This function guarantees that the arena consists of a single chunk of at least \a bytes
+// bytes. In case the function is called within an active scope, the memory is reserved at
+// the end of the outermost scope.
+*/
+inline void reserveArena( size_t bytes )
+{
+   ArenaState& state( arenaState() );
+
+   if( state.demand_ < bytes )
+      state.demand_ = bytes;
+
+   if( state.depth_ == 0UL )
+      consolidateArena( state );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Releases the memory of the arena of the calling thread.
+// \ingroup util
+//
+// \return void
+//
+// This function returns all memory of the arena to the system and resets its statistics. The
+// function must not be called within an active arena scope, in which case it has no effect.
+*/
+inline void releaseArena()
+{
+   ArenaState& state( arenaState() );
+
+   BLAZE_USER_ASSERT( state.depth_ == 0UL, "Active arena scope detected" );
+
+   if( state.depth_ > 0UL )
+      return;
+
+   state.demand_ = 0UL;
+   state.peak_   = 0UL;
+
+   consolidateArena( state );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
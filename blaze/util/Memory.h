@@ -46,6 +46,7 @@
 #include <cstdlib>
 #include <new>
 #include <stdexcept>
+#include <blaze/util/Arena.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Byte.h>
 #include <blaze/util/DisableIf.h>
@@ -138,7 +139,9 @@ inline void deallocate_backend( const void* address )
 // The allocate() function provides the functionality to allocate memory based on the alignment
 // restrictions of the given built-in data type. For instance, in case SSE vectorization is
 // possible, the returned memory is guaranteed to be at least 16-byte aligned. In case AVX is
-// active, the memory is even guaranteed to be at least 32-byte aligned.
+// active, the memory is even guaranteed to be at least 32-byte aligned. During the evaluation
+// of expression temporaries within an active ArenaScope, the memory is allocated from the
+// thread-local arena (see the ArenaScope class for details).
 //
 // Examples:
 
@@ -153,6 +156,8 @@ typename EnableIf< IsBuiltin<T>, T* >::Type allocate( size_t size )
    const size_t alignment( AlignmentOf<T>::value );
 
    if( alignment >= 8UL ) {
+      if( isArenaRouted() )
+         return reinterpret_cast<T*>( arenaAllocate( size*sizeof(T), alignment ) );
       return reinterpret_cast<T*>( allocate_backend( size*sizeof(T), alignment ) );
    }
    else return ::new T[size];
@@ -220,7 +225,8 @@ typename DisableIf< IsBuiltin<T>, T* >::Type allocate( size_t size )
 // \return void
 //
 // This function deallocates the given memory that was previously allocated via the allocate()
-// function.
+// function. Memory of the thread-local arena is not deallocated, but released at the end of
+// the according ArenaScope.
 */
 template< typename T >
 typename EnableIf< IsBuiltin<T> >::Type deallocate( T* address )
@@ -231,6 +237,10 @@ typename EnableIf< IsBuiltin<T> >::Type deallocate( T* address )
    const size_t alignment( AlignmentOf<T>::value );
 
    if( alignment >= 8UL ) {
+      if( arenaOwns( address ) ) {
+         BLAZE_USER_ASSERT( isArenaActive(), "Arena memory released outside of an arena scope" );
+         return;
+      }
       deallocate_backend( address );
    }
    else delete[] address;
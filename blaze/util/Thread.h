@@ -44,6 +44,7 @@
 #include <boost/scoped_ptr.hpp>
 #include <blaze/util/Assert.h>
 #include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -259,7 +260,7 @@ class Thread : private NonCopyable
    //**Constructors********************************************************************************
    /*!\name Constructors */
    //@{
-   explicit Thread( ThreadPoolType* pool );
+   explicit Thread( ThreadPoolType* pool, size_t id );
    //@}
    //**********************************************************************************************
 
@@ -325,6 +326,7 @@ class Thread : private NonCopyable
                                       pool to learn whether the thread has terminated
                                       its execution. */
    ThreadPoolType* pool_;        //!< Handle to the managing thread pool.
+   size_t          id_;          //!< The ID of the thread within the managing thread pool.
    ThreadHandle    thread_;      //!< Handle to the thread of execution.
    //@}
    //**********************************************************************************************
@@ -350,6 +352,7 @@ class Thread : private NonCopyable
 /*!\brief Starting a thread in a thread pool.
 //
 // \param pool Handle to the managing thread pool.
+// \param id The ID of the thread within the managing thread pool.
 //
 // This function creates a new thread in the given thread pool. The thread is kept alive until
 // explicitly killed by the managing thread pool.
@@ -358,9 +361,10 @@ template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
-Thread<TT,MT,LT,CT>::Thread( ThreadPoolType* pool )
+Thread<TT,MT,LT,CT>::Thread( ThreadPoolType* pool, size_t id )
    : terminated_( false )  // Thread termination flag
    , pool_      ( pool  )  // Handle to the managing thread pool
+   , id_        ( id    )  // The ID of the thread within the managing thread pool
    , thread_    ( 0     )  // Handle to the thread of execution
 {
    thread_.reset( new ThreadType( boost::bind( &Thread::run, this ) ) );
@@ -644,7 +648,7 @@ void Thread<TT,MT,LT,CT>::run()
    BLAZE_INTERNAL_ASSERT( pool_, "Uninitialized pool handle detected" );
 
    // Executing scheduled tasks
-   while( pool_->executeTask() ) {}
+   while( pool_->executeTask( id_ ) ) {}
 
    // Setting the termination flag
    terminated_ = true;
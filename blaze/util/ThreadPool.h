@@ -40,7 +40,9 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
 #include <stdexcept>
+#include <boost/atomic.hpp>
 #include <boost/bind.hpp>
 #include <blaze/util/Assert.h>
 #include <blaze/util/NonCopyable.h>
@@ -50,6 +52,7 @@
 #include <blaze/util/threadpool/Task.h>
 #include <blaze/util/threadpool/TaskQueue.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/UniqueArray.h>
 
 
 namespace blaze {
@@ -192,6 +195,19 @@ namespace blaze {
 // for the given functions/functors.
 //
 //
+// \section threadpool_scheduling Task scheduling
+//
+// Every thread of the thread pool owns a separate task queue. The scheduled tasks are evenly
+// distributed among these task queues in a round-robin fashion. Each thread first executes the
+// tasks of its own task queue. As soon as its own task queue is empty, the thread steals tasks
+// from the end of the task queues of the other threads. Since the task queues are protected by
+// individual mutexes and the number of pending tasks is managed atomically, threads only contend
+// for the thread pool's mutex when they run out of work. This work stealing strategy guarantees
+// that a single delayed thread (for instance a thread that has to share its core with another
+// process) does not delay the completion of all scheduled tasks, provided that the work is split
+// into more tasks than threads.
+//
+//
 // \section threadpool_exception Throwing exceptions in a thread parallel environment
 //
 // It can happen that during the execution of a given task a thread encounters an erroneous
@@ -376,12 +392,21 @@ class ThreadPool : private NonCopyable
    //@}
    //**********************************************************************************************
 
+ private:
+   //**Scheduling functions************************************************************************
+   /*!\name Scheduling functions */
+   //@{
+   void enqueue( const threadpool::Task& task );
+   //@}
+   //**********************************************************************************************
+
  private:
    //**Thread functions****************************************************************************
    /*!\name Thread functions */
    //@{
    void createThread();
-   bool executeTask();
+   bool executeTask( size_t id );
+   bool acquireTask( size_t id, threadpool::Task& task );
    //@}
    //**********************************************************************************************
 
@@ -393,8 +418,17 @@ class ThreadPool : private NonCopyable
                                /*!< This number may differ from the total number of threads
                                     during a resize of the thread pool. */
    volatile size_t active_;    //!< Number of currently active/busy threads.
+   size_t created_;            //!< Total number of threads created by the thread pool.
    Threads threads_;           //!< The threads contained in the thread pool.
-   TaskQueue taskqueue_;       //!< Task queue for the scheduled tasks.
+
+   const size_t capacity_;               //!< The maximum number of task queues.
+   boost::atomic<size_t> queues_;        //!< The number of task queues in use.
+   UniqueArray<TaskQueue> taskqueues_;   //!< The task queues of the individual threads.
+   UniqueArray<Mutex> queueMutexes_;     //!< Synchronization mutexes for the task queues.
+   boost::atomic<size_t> pending_;       //!< Number of scheduled, not yet acquired tasks.
+   boost::atomic<size_t> idle_;          //!< Number of threads about to wait for new tasks.
+   boost::atomic<size_t> next_;          //!< Counter for the round-robin task distribution.
+
    mutable Mutex mutex_;       //!< Synchronization mutex.
    Condition waitForTask_;     //!< Wait condition for idle threads.
    Condition waitForThread_;   //!< Wait condition for the thread management.
@@ -424,21 +458,30 @@ class ThreadPool : private NonCopyable
 // \param n Initial number of threads \f$[1..\infty)\f$.
 //
 // This constructor creates a thread pool with initially \a n new threads. All threads are
-// initially idle until a task is scheduled.
+// initially idle until a task is scheduled. The number of task queues is determined by the
+// larger of \a n and the number of hardware threads. In case the thread pool is resized to a
+// larger number of threads, several threads share a task queue.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
 ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n )
-   : total_     ( 0 )  // Total number of threads in the thread pool
-   , expected_  ( 0 )  // Expected number of threads in the thread pool
-   , active_    ( 0 )  // Number of currently active/busy threads
-   , threads_      ()  // The threads contained in the thread pool
-   , taskqueue_    ()  // Task queue for the scheduled tasks
-   , mutex_        ()  // Synchronization mutex
-   , waitForTask_  ()  // Wait condition for idle threads
-   , waitForThread_()  // Wait condition for the thread management
+   : total_       ( 0 )   // Total number of threads in the thread pool
+   , expected_    ( 0 )   // Expected number of threads in the thread pool
+   , active_      ( 0 )   // Number of currently active/busy threads
+   , created_     ( 0 )   // Total number of threads created by the thread pool
+   , threads_     ()      // The threads contained in the thread pool
+   , capacity_    ( std::max<size_t>( std::max<size_t>( n, TT::hardware_concurrency() ), 1UL ) )
+   , queues_      ( 1 )   // The number of task queues in use
+   , taskqueues_  ( new TaskQueue[capacity_] )  // The task queues of the individual threads
+   , queueMutexes_( new Mutex[capacity_] )      // Synchronization mutexes for the task queues
+   , pending_     ( 0 )   // Number of scheduled, not yet acquired tasks
+   , idle_        ( 0 )   // Number of threads about to wait for new tasks
+   , next_        ( 0 )   // Counter for the round-robin task distribution
+   , mutex_       ()      // Synchronization mutex
+   , waitForTask_ ()      // Wait condition for idle threads
+   , waitForThread_()     // Wait condition for the thread management
 {
    resize( n );
 }
@@ -465,10 +508,10 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 ThreadPool<TT,MT,LT,CT>::~ThreadPool()
 {
-   Lock lock( mutex_ );
-
    // Removing all currently queued tasks
-   taskqueue_.clear();
+   clear();
+
+   Lock lock( mutex_ );
 
    // Setting the expected number of threads
    expected_ = 0;
@@ -511,8 +554,7 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline bool ThreadPool<TT,MT,LT,CT>::isEmpty() const
 {
-   Lock lock( mutex_ );
-   return taskqueue_.isEmpty();
+   return pending_ == 0UL;
 }
 //*************************************************************************************************
 
@@ -592,9 +634,7 @@ template< typename TT          // Type of the encapsulated thread
 template< typename Callable >  // Type of the function/functor
 void ThreadPool<TT,MT,LT,CT>::schedule( Callable func )
 {
-   Lock lock( mutex_ );
-   taskqueue_.push( func );
-   waitForTask_.notify_one();
+   enqueue( func );
 }
 //*************************************************************************************************
 
@@ -617,9 +657,7 @@ template< typename Callable  // Type of the function/functor
         , typename A1 >      // Type of the first argument
 void ThreadPool<TT,MT,LT,CT>::schedule( Callable func, A1 a1 )
 {
-   Lock lock( mutex_ );
-   taskqueue_.push( boost::bind<void>( func, a1 ) );
-   waitForTask_.notify_one();
+   enqueue( boost::bind<void>( func, a1 ) );
 }
 //*************************************************************************************************
 
@@ -644,9 +682,7 @@ template< typename Callable  // Type of the function/functor
         , typename A2 >      // Type of the second argument
 void ThreadPool<TT,MT,LT,CT>::schedule( Callable func, A1 a1, A2 a2 )
 {
-   Lock lock( mutex_ );
-   taskqueue_.push( boost::bind<void>( func, a1, a2 ) );
-   waitForTask_.notify_one();
+   enqueue( boost::bind<void>( func, a1, a2 ) );
 }
 //*************************************************************************************************
 
@@ -673,9 +709,7 @@ template< typename Callable  // Type of the function/functor
         , typename A3 >      // Type of the third argument
 void ThreadPool<TT,MT,LT,CT>::schedule( Callable func, A1 a1, A2 a2, A3 a3 )
 {
-   Lock lock( mutex_ );
-   taskqueue_.push( boost::bind<void>( func, a1, a2, a3 ) );
-   waitForTask_.notify_one();
+   enqueue( boost::bind<void>( func, a1, a2, a3 ) );
 }
 //*************************************************************************************************
 
@@ -704,9 +738,7 @@ template< typename Callable  // Type of the function/functor
         , typename A4 >      // Type of the fourth argument
 void ThreadPool<TT,MT,LT,CT>::schedule( Callable func, A1 a1, A2 a2, A3 a3, A4 a4 )
 {
-   Lock lock( mutex_ );
-   taskqueue_.push( boost::bind<void>( func, a1, a2, a3, a4 ) );
-   waitForTask_.notify_one();
+   enqueue( boost::bind<void>( func, a1, a2, a3, a4 ) );
 }
 //*************************************************************************************************
 
@@ -737,9 +769,41 @@ template< typename Callable  // Type of the function/functor
         , typename A5 >      // Type of the fifth argument
 void ThreadPool<TT,MT,LT,CT>::schedule( Callable func, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5 )
 {
-   Lock lock( mutex_ );
-   taskqueue_.push( boost::bind<void>( func, a1, a2, a3, a4, a5 ) );
-   waitForTask_.notify_one();
+   enqueue( boost::bind<void>( func, a1, a2, a3, a4, a5 ) );
+}
+//*************************************************************************************************
+
+
+
+
+//*************************************************************************************************
+/*!\brief Adding the given task to the task queues of the thread pool.
+//
+// \param task The task to be added.
+// \return void
+//
+// This function adds the given task to one of the task queues of the thread pool. The task
+// queues are selected in a round-robin fashion. In case any thread is waiting for new tasks,
+// one waiting thread is notified.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::enqueue( const threadpool::Task& task )
+{
+   const size_t index( next_++ % queues_ );
+
+   {
+      Lock lock( queueMutexes_[index] );
+      taskqueues_[index].push( task );
+      ++pending_;
+   }
+
+   if( idle_ != 0UL ) {
+      Lock lock( mutex_ );
+      waitForTask_.notify_one();
+   }
 }
 //*************************************************************************************************
 
@@ -810,6 +874,8 @@ void ThreadPool<TT,MT,LT,CT>::resize( size_t n, bool block )
 
       // Adding new threads to the thread pool
       if( n > expected_ ) {
+         if( n > queues_ )
+            queues_ = std::min( n, capacity_ );
          for( size_t i=expected_; i<n; ++i )
             createThread();
       }
@@ -852,7 +918,7 @@ void ThreadPool<TT,MT,LT,CT>::wait()
 {
    Lock lock( mutex_ );
 
-   while( !taskqueue_.isEmpty() || active_ > 0 ) {
+   while( pending_ != 0UL || active_ > 0 ) {
       waitForThread_.wait( lock );
    }
 }
@@ -873,8 +939,11 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 void ThreadPool<TT,MT,LT,CT>::clear()
 {
-   Lock lock( mutex_ );
-   taskqueue_.clear();
+   for( size_t i=0UL; i<capacity_; ++i ) {
+      Lock lock( queueMutexes_[i] );
+      pending_ -= taskqueues_[i].size();
+      taskqueues_[i].clear();
+   }
 }
 //*************************************************************************************************
 
@@ -898,7 +967,8 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 void ThreadPool<TT,MT,LT,CT>::createThread()
 {
-   threads_.pushBack( new ManagedThread( this ) );
+   threads_.pushBack( new ManagedThread( this, created_ ) );
+   ++created_;
    ++total_;
    ++expected_;
    ++active_;
@@ -909,6 +979,7 @@ void ThreadPool<TT,MT,LT,CT>::createThread()
 //*************************************************************************************************
 /*!\brief Executing a scheduled task.
 //
+// \param id The ID of the calling thread.
 // \return \a true in case a task was successfully finished, \a false if not.
 //
 // This function is repeatedly called by every thread to execute one of the scheduled tasks.
@@ -919,21 +990,27 @@ template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
-bool ThreadPool<TT,MT,LT,CT>::executeTask()
+bool ThreadPool<TT,MT,LT,CT>::executeTask( size_t id )
 {
    threadpool::Task task;
 
    // Acquiring a scheduled task
+   while( !acquireTask( id, task ) )
    {
       Lock lock( mutex_ );
 
-      while( taskqueue_.isEmpty() )
+      // Announcing the upcoming wait before checking for new tasks. In combination with the
+      // reverse order in the enqueue() function this guarantees that no wakeup is lost.
+      ++idle_;
+
+      if( pending_ == 0UL )
       {
          --active_;
          waitForThread_.notify_all();
 
          if( total_ > expected_ ) {
             --total_;
+            --idle_;
             return false;
          }
 
@@ -941,8 +1018,7 @@ bool ThreadPool<TT,MT,LT,CT>::executeTask()
          ++active_;
       }
 
-      BLAZE_INTERNAL_ASSERT( !taskqueue_.isEmpty(), "Empty task queue detected" );
-      task = taskqueue_.pop();
+      --idle_;
    }
 
    // Executing the task
@@ -952,6 +1028,45 @@ bool ThreadPool<TT,MT,LT,CT>::executeTask()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Acquiring a scheduled task.
+//
+// \param id The ID of the calling thread.
+// \param task The acquired task.
+// \return \a true in case a task was acquired, \a false if all task queues are empty.
+//
+// This function acquires the next task for the calling thread. In case the task queue of the
+// thread contains any task, the first task of this queue is acquired. Otherwise the function
+// attempts to steal the last task from the task queues of the other threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+bool ThreadPool<TT,MT,LT,CT>::acquireTask( size_t id, threadpool::Task& task )
+{
+   const size_t queues( queues_ );
+   const size_t home  ( id % queues );
+
+   for( size_t i=0UL; i<queues && pending_ != 0UL; ++i )
+   {
+      const size_t index( ( home + i ) % queues );
+
+      Lock lock( queueMutexes_[index] );
+
+      if( taskqueues_[index].isEmpty() )
+         continue;
+
+      task = ( i == 0UL )?( taskqueues_[index].pop() ):( taskqueues_[index].steal() );
+      --pending_;
+      return true;
+   }
+
+   return false;
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
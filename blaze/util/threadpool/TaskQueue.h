@@ -58,8 +58,9 @@ namespace threadpool {
 /*!\brief Task queue for the thread pool.
 // \ingroup threads
 //
-// The TaskQueue class represents the internal task container of a thread pool. It uses a FIFO
-// (first in, first out) strategy to store and remove the assigned tasks.
+// The TaskQueue class represents the internal task container of a single thread of a thread
+// pool. It uses a FIFO (first in, first out) strategy to store and remove the assigned tasks.
+// Additionally, idle threads of the thread pool can steal tasks from the end of the queue.
 */
 class TaskQueue
 {
@@ -101,6 +102,7 @@ class TaskQueue
    //@{
    inline void push ( Task task );
    inline Task pop  ();
+   inline Task steal();
    inline void clear();
    //@}
    //**********************************************************************************************
@@ -243,6 +245,23 @@ inline Task TaskQueue::pop()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Returns the task from the back of the task queue.
+//
+// \return The last task in the task queue.
+//
+// This function removes the most recently added task from the task queue. It is used by idle
+// threads of a thread pool to steal work from the queue of another thread.
+*/
+inline Task TaskQueue::steal()
+{
+   const Task task( tasks_.back() );
+   tasks_.pop_back();
+   return task;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Removing all tasks from the task queue.
 //
@@ -79,7 +79,7 @@ struct AlignmentOf
  public:
    //**Member enumerations*************************************************************************
    /*! \cond BLAZE_INTERNAL */
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE || BLAZE_MIC_MODE
    enum { value = ( IsVectorizable<T>::value )?( 64UL ):( boost::alignment_of<T>::value ) };
 #elif BLAZE_AVX2_MODE
    enum { value = ( IsVectorizable<T>::value )?( 32UL ):( boost::alignment_of<T>::value ) };
@@ -104,7 +104,7 @@ struct AlignmentOf<float>
 {
  public:
    //**Member enumerations*************************************************************************
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE || BLAZE_MIC_MODE
    enum { value = 64UL };
 #elif BLAZE_AVX_MODE
    enum { value = 32UL };
@@ -129,7 +129,7 @@ struct AlignmentOf<double>
 {
  public:
    //**Member enumerations*************************************************************************
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE || BLAZE_MIC_MODE
    enum { value = 64UL };
 #elif BLAZE_AVX_MODE
    enum { value = 32UL };
@@ -154,7 +154,7 @@ struct AlignmentOf< complex<float> >
 {
  public:
    //**Member enumerations*************************************************************************
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE || BLAZE_MIC_MODE
    enum { value = 64UL };
 #elif BLAZE_AVX_MODE
    enum { value = 32UL };
@@ -179,7 +179,7 @@ struct AlignmentOf< complex<double> >
 {
  public:
    //**Member enumerations*************************************************************************
-#if BLAZE_MIC_MODE
+#if BLAZE_AVX512_MODE || BLAZE_MIC_MODE
    enum { value = 64UL };
 #elif BLAZE_AVX_MODE
    enum { value = 32UL };
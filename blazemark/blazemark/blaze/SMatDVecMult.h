@@ -57,6 +57,8 @@ namespace blaze {
 /*!\name Blaze kernel functions */
 //@{
 double smatdvecmult( size_t N, size_t F, size_t steps );
+
+double smatdvecmultSell( size_t N, size_t F, size_t steps );
 //@}
 //*************************************************************************************************
 
@@ -57,6 +57,8 @@ namespace blaze {
 /*!\name Blaze kernel functions */
 //@{
 double smatsmatmult( size_t N, size_t F, size_t steps );
+
+double smatsmatmultNumeric( size_t N, size_t F, size_t steps );
 //@}
 //*************************************************************************************************
 
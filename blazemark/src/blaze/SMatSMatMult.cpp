@@ -39,6 +39,7 @@
 
 #include <iostream>
 #include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/sparse/SMMM.h>
 #include <blaze/util/Timing.h>
 #include <blazemark/blaze/init/CompressedMatrix.h>
 #include <blazemark/blaze/SMatSMatMult.h>
@@ -106,6 +107,59 @@ double smatsmatmult( size_t N, size_t F, size_t steps )
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Blaze sparse matrix/sparse matrix multiplication kernel with reused sparsity pattern.
+//
+// \param N The number of rows and columns of the matrices.
+// \param F The number of non-zero elements in each row of the sparse matrices.
+// \param steps The number of iteration steps to perform.
+// \return Minimum runtime of the kernel function.
+//
+// This kernel function implements the sparse matrix/sparse matrix multiplication by means of
+// the Blaze symbolic and numeric multiplication phases. The sparsity pattern of the result is
+// computed once, each iteration step only recomputes the values of the product.
+*/
+double smatsmatmultNumeric( size_t N, size_t F, size_t steps )
+{
+   using ::blazemark::element_t;
+   using ::blaze::rowMajor;
+
+   ::blaze::setSeed( seed );
+
+   ::blaze::CompressedMatrix<element_t,rowMajor> A( N, N, N*F ), B( N, N, N*F ), C( N, N );
+   ::blaze::timing::WcTimer timer;
+
+   init( A, F );
+   init( B, F );
+
+   ::blaze::smmmSymbolic( C, A, B );
+
+   for( size_t rep=0UL; rep<reps; ++rep )
+   {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         ::blaze::smmmNumeric( C, A, B );
+      }
+      timer.end();
+
+      if( C.rows() != N )
+         std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+
+      if( timer.last() > maxtime )
+         break;
+   }
+
+   const double minTime( timer.min()     );
+   const double avgTime( timer.average() );
+
+   if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
+      std::cerr << " Blaze kernel 'smatsmatmultNumeric': Time deviation too large!!!\n";
+
+   return minTime;
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 } // namespace blazemark
@@ -0,0 +1,545 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/batch/OperationTest.h
+//  \brief Header file for the batched small matrix and vector operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_BATCH_OPERATIONTEST_H_
+#define _BLAZETEST_MATHTEST_BATCH_OPERATIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/Inversion.h>
+#include <blaze/math/MatrixBatch.h>
+#include <blaze/math/Quaternion.h>
+#include <blaze/math/RotationMatrix.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/math/StaticVector.h>
+#include <blaze/math/VectorBatch.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace batch {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the batched small matrix and vector operations.
+//
+// This class represents a test suite for the MatrixBatch and VectorBatch class templates and
+// their batched kernels. All results are compared to the results of the corresponding
+// operations on single StaticMatrix, StaticVector and Quaternion instances. It performs a
+// series of runtime tests.
+*/
+class OperationTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit OperationTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testAccess   ();
+   void testAddSub   ();
+   void testMult     ();
+   void testTrans    ();
+   void testInvert   ();
+   void testRotation ();
+
+   template< typename Type > void testAddSub  ( size_t n );
+   template< typename Type > void testMult    ( size_t n );
+   template< typename Type > void testTrans   ( size_t n );
+   template< typename Type > void testInvert  ( size_t n );
+   template< typename Type > void testRotation( size_t n );
+
+   template< typename Type, size_t M, size_t N >
+   void checkMatrix( const blaze::MatrixBatch<Type,M,N>& batch, size_t index,
+                     const blaze::StaticMatrix<Type,M,N,blaze::rowMajor>& expected ) const;
+
+   template< typename Type, size_t N >
+   void checkVector( const blaze::VectorBatch<Type,N>& batch, size_t index,
+                     const blaze::StaticVector<Type,N,blaze::columnVector>& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type, size_t M, size_t N >
+   static blaze::StaticMatrix<Type,M,N,blaze::rowMajor> createMatrix();
+
+   template< typename Type, size_t N >
+   static blaze::StaticVector<Type,N,blaze::columnVector> createVector();
+
+   template< typename Type >
+   static double tolerance();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the batched addition and subtraction.
+//
+// \param n The number of matrices and vectors of the batches.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type >  // Data type of the batches
+void OperationTest::testAddSub( size_t n )
+{
+   typedef blaze::StaticMatrix<Type,3UL,3UL,blaze::rowMajor>  MT;
+   typedef blaze::StaticVector<Type,4UL,blaze::columnVector>  VT;
+
+   blaze::MatrixBatch<Type,3UL,3UL> A( n ), B( n ), C;
+   blaze::VectorBatch<Type,4UL> a( n ), b( n ), c, d;
+
+   for( size_t k=0UL; k<n; ++k ) {
+      A.set( k, createMatrix<Type,3UL,3UL>() );
+      B.set( k, createMatrix<Type,3UL,3UL>() );
+      a.set( k, createVector<Type,4UL>() );
+      b.set( k, createVector<Type,4UL>() );
+   }
+
+   blaze::add( A, B, C );
+   blaze::add( a, b, c );
+   blaze::sub( a, b, d );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      MT mA, mB;
+      VT va, vb;
+      A.get( k, mA );
+      B.get( k, mB );
+      a.get( k, va );
+      b.get( k, vb );
+
+      checkMatrix( C, k, MT( mA + mB ) );
+      checkVector( c, k, VT( va + vb ) );
+      checkVector( d, k, VT( va - vb ) );
+   }
+
+   blaze::sub( C, B, C );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      MT mA;
+      A.get( k, mA );
+      checkMatrix( C, k, mA );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched matrix/matrix and matrix/vector multiplications.
+//
+// \param n The number of matrices and vectors of the batches.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type >  // Data type of the batches
+void OperationTest::testMult( size_t n )
+{
+   typedef blaze::StaticMatrix<Type,3UL,3UL,blaze::rowMajor>  M33;
+   typedef blaze::StaticMatrix<Type,3UL,4UL,blaze::rowMajor>  M34;
+   typedef blaze::StaticVector<Type,3UL,blaze::columnVector>  V3;
+   typedef blaze::StaticVector<Type,4UL,blaze::columnVector>  V4;
+
+   blaze::MatrixBatch<Type,3UL,3UL> A( n ), AA;
+   blaze::MatrixBatch<Type,3UL,4UL> B( n ), C;
+   blaze::VectorBatch<Type,4UL> x( n );
+   blaze::VectorBatch<Type,3UL> y;
+
+   for( size_t k=0UL; k<n; ++k ) {
+      A.set( k, createMatrix<Type,3UL,3UL>() );
+      B.set( k, createMatrix<Type,3UL,4UL>() );
+      x.set( k, createVector<Type,4UL>() );
+   }
+
+   blaze::mult( A, B, C );
+   blaze::mult( B, x, y );
+
+   AA = A;
+   blaze::mult( AA, AA, AA );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      M33 mA;
+      M34 mB;
+      V4 vx;
+      A.get( k, mA );
+      B.get( k, mB );
+      x.get( k, vx );
+
+      checkMatrix( C, k, M34( mA * mB ) );
+      checkVector( y, k, V3( mB * vx ) );
+      checkMatrix( AA, k, M33( mA * mA ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched transposition.
+//
+// \param n The number of matrices of the batches.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type >  // Data type of the batches
+void OperationTest::testTrans( size_t n )
+{
+   typedef blaze::StaticMatrix<Type,3UL,3UL,blaze::rowMajor>  M33;
+   typedef blaze::StaticMatrix<Type,2UL,5UL,blaze::rowMajor>  M25;
+   typedef blaze::StaticMatrix<Type,5UL,2UL,blaze::rowMajor>  M52;
+
+   blaze::MatrixBatch<Type,3UL,3UL> A( n ), At;
+   blaze::MatrixBatch<Type,2UL,5UL> B( n );
+   blaze::MatrixBatch<Type,5UL,2UL> Bt;
+
+   for( size_t k=0UL; k<n; ++k ) {
+      A.set( k, createMatrix<Type,3UL,3UL>() );
+      B.set( k, createMatrix<Type,2UL,5UL>() );
+   }
+
+   At = A;
+   blaze::trans( At, At );
+   blaze::trans( B, Bt );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      M33 mA;
+      M25 mB;
+      A.get( k, mA );
+      B.get( k, mB );
+
+      checkMatrix( At, k, M33( blaze::trans( mA ) ) );
+      checkMatrix( Bt, k, M52( blaze::trans( mB ) ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched 3x3 inversion.
+//
+// \param n The number of matrices of the batch.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type >  // Data type of the batch
+void OperationTest::testInvert( size_t n )
+{
+   typedef blaze::StaticMatrix<Type,3UL,3UL,blaze::rowMajor>  MT;
+
+   blaze::MatrixBatch<Type,3UL,3UL> A( n );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      MT m( createMatrix<Type,3UL,3UL>() );
+      for( size_t i=0UL; i<3UL; ++i )
+         m(i,i) += Type(4);
+      A.set( k, m );
+   }
+
+   blaze::MatrixBatch<Type,3UL,3UL> B( A );
+   blaze::invert( B );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      MT m;
+      A.get( k, m );
+      blaze::invert( m );
+      checkMatrix( B, k, m );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched quaternion kernels.
+//
+// \param n The number of quaternions and vectors of the batches.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type >  // Data type of the batches
+void OperationTest::testRotation( size_t n )
+{
+   typedef blaze::StaticMatrix<Type,3UL,3UL,blaze::rowMajor>  MT;
+   typedef blaze::StaticVector<Type,3UL,blaze::columnVector>  VT;
+
+   blaze::VectorBatch<Type,4UL> q( n );
+   blaze::VectorBatch<Type,3UL> v( n ), w;
+   blaze::MatrixBatch<Type,3UL,3UL> R;
+
+   for( size_t k=0UL; k<n; ++k ) {
+      const blaze::Quaternion<Type> quat( blaze::rand<Type>( Type(-3), Type(3) ),
+                                          blaze::rand<Type>( Type(-3), Type(3) ),
+                                          blaze::rand<Type>( Type(-3), Type(3) ) );
+      q.set( k, quat );
+      v.set( k, createVector<Type,3UL>() );
+   }
+
+   blaze::rotate( q, v, w );
+   blaze::toRotationMatrix( q, R );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      blaze::Quaternion<Type> quat;
+      VT vec;
+      q.get( k, quat );
+      v.get( k, vec );
+
+      const blaze::RotationMatrix<Type> rot( quat.toRotationMatrix() );
+      MT m;
+      for( size_t i=0UL; i<9UL; ++i )
+         m(i/3UL,i%3UL) = rot[i];
+
+      checkVector( w, k, VT( quat.rotate( vec ) ) );
+      checkMatrix( R, k, m );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking a single matrix of a batch.
+//
+// \param batch The batch to be checked.
+// \param index The index of the matrix to be checked.
+// \param expected The expected matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type  // Data type of the batch
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+void OperationTest::checkMatrix( const blaze::MatrixBatch<Type,M,N>& batch, size_t index,
+                                 const blaze::StaticMatrix<Type,M,N,blaze::rowMajor>& expected ) const
+{
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         if( !( std::fabs( batch(index,i,j) - expected(i,j) ) <= tolerance<Type>() ) ) {
+            blaze::StaticMatrix<Type,M,N,blaze::rowMajor> result;
+            batch.get( index, result );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid batch result\n"
+                << " Details:\n"
+                << "   Batch size: " << batch.size() << "\n"
+                << "   Matrix index: " << index << "\n"
+                << "   Result:\n" << result << "\n"
+                << "   Expected result:\n" << expected << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking a single vector of a batch.
+//
+// \param batch The batch to be checked.
+// \param index The index of the vector to be checked.
+// \param expected The expected vector.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type  // Data type of the batch
+        , size_t N >     // Number of elements of each vector
+void OperationTest::checkVector( const blaze::VectorBatch<Type,N>& batch, size_t index,
+                                 const blaze::StaticVector<Type,N,blaze::columnVector>& expected ) const
+{
+   for( size_t i=0UL; i<N; ++i ) {
+      if( !( std::fabs( batch(index,i) - expected[i] ) <= tolerance<Type>() ) ) {
+         blaze::StaticVector<Type,N,blaze::columnVector> result;
+         batch.get( index, result );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid batch result\n"
+             << " Details:\n"
+             << "   Batch size: " << batch.size() << "\n"
+             << "   Vector index: " << index << "\n"
+             << "   Result:\n" << result << "\n"
+             << "   Expected result:\n" << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creation of a random matrix with elements in the range \f$[-1..1]\f$.
+//
+// \return The random matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+blaze::StaticMatrix<Type,M,N,blaze::rowMajor> OperationTest::createMatrix()
+{
+   blaze::StaticMatrix<Type,M,N,blaze::rowMajor> A;
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         A(i,j) = blaze::rand<Type>( Type(-1), Type(1) );
+      }
+   }
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creation of a random vector with elements in the range \f$[-1..1]\f$.
+//
+// \return The random vector.
+*/
+template< typename Type  // Data type of the vector
+        , size_t N >     // Number of elements
+blaze::StaticVector<Type,N,blaze::columnVector> OperationTest::createVector()
+{
+   blaze::StaticVector<Type,N,blaze::columnVector> v;
+   for( size_t i=0UL; i<N; ++i ) {
+      v[i] = blaze::rand<Type>( Type(-1), Type(1) );
+   }
+   return v;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the admissible deviation of a single element for the given data type.
+//
+// \return The admissible deviation.
+*/
+template< typename Type >  // Data type of the batch
+double OperationTest::tolerance()
+{
+   return ( sizeof(Type) == sizeof(float) )?( 1E-5 ):( 1E-13 );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the batched small matrix and vector operations.
+//
+// \return void
+*/
+void runTest()
+{
+   OperationTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the batch operation test.
+*/
+#define RUN_BATCH_OPERATION_TEST \
+   blazetest::mathtest::batch::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace batch
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
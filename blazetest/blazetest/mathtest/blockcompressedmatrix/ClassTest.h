@@ -0,0 +1,353 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/blockcompressedmatrix/ClassTest.h
+//  \brief Header file for the BlockCompressedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_BLOCKCOMPRESSEDMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_BLOCKCOMPRESSEDMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/BlockCompressedMatrix.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace blockcompressedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the BlockCompressedMatrix class template.
+//
+// This class represents a test suite for the blaze::BlockCompressedMatrix class template. It
+// performs a series of runtime tests.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors();
+   void testAssignment  ();
+   void testMultiply    ();
+   void testSwap        ();
+
+   template< typename Type, size_t N >
+   void testMultiply( size_t m, size_t n );
+
+   template< typename Type >
+   void checkRows( const Type& matrix, size_t expectedRows ) const;
+
+   template< typename Type >
+   void checkColumns( const Type& matrix, size_t expectedColumns ) const;
+
+   template< typename Type >
+   void checkBlocks( const Type& matrix, size_t expectedBlocks ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type, size_t N >
+   static blaze::StaticMatrix<Type,N,N,blaze::columnMajor>
+      block( const blaze::BlockCompressedMatrix<Type,N>& matrix, size_t k );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the number of rows of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expectedRows The expected number of rows of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of rows of the given matrix. In case the actual number of
+// rows does not correspond to the given expected number of rows, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkRows( const Type& matrix, size_t expectedRows ) const
+{
+   if( matrix.rows() != expectedRows ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of rows detected\n"
+          << " Details:\n"
+          << "   Number of rows         : " << matrix.rows() << "\n"
+          << "   Expected number of rows: " << expectedRows << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of columns of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expectedColumns The expected number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of columns of the given matrix. In case the actual number of
+// columns does not correspond to the given expected number of columns, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkColumns( const Type& matrix, size_t expectedColumns ) const
+{
+   if( matrix.columns() != expectedColumns ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of columns detected\n"
+          << " Details:\n"
+          << "   Number of columns         : " << matrix.columns() << "\n"
+          << "   Expected number of columns: " << expectedColumns << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of non-zero blocks of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expectedBlocks The expected number of non-zero blocks of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of non-zero blocks of the given matrix. In case the actual
+// number of non-zero blocks does not correspond to the given expected number, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkBlocks( const Type& matrix, size_t expectedBlocks ) const
+{
+   if( matrix.blocks() != expectedBlocks ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero blocks\n"
+          << " Details:\n"
+          << "   Number of blocks         : " << matrix.blocks() << "\n"
+          << "   Expected number of blocks: " << expectedBlocks << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the block compressed matrix/dense vector multiplication for a random matrix.
+//
+// \param m The number of block rows of the random matrix.
+// \param n The number of block columns of the random matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the result of the multiply() function for a random sparse matrix
+// with the result of the according CompressedMatrix multiplication. All values are integral
+// in order to guarantee an exact result independent of the order of the summation. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t N >     // Number of rows and columns of the blocks
+void ClassTest::testMultiply( size_t m, size_t n )
+{
+   blaze::CompressedMatrix<Type,blaze::rowMajor> A( m*N, n*N );
+   for( size_t i=0UL; i<m*N; ++i ) {
+      const size_t nonzeros( n > 0UL ? blaze::rand<size_t>( 0UL, n ) : 0UL );
+      for( size_t k=0UL; k<nonzeros; ++k ) {
+         A( i, blaze::rand<size_t>( 0UL, n*N-1UL ) ) = Type( blaze::rand<int>( -9, 9 ) );
+      }
+   }
+
+   blaze::DynamicVector<Type,blaze::columnVector> x( n*N ), y( m*N );
+   for( size_t j=0UL; j<n*N; ++j ) {
+      x[j] = Type( blaze::rand<int>( -9, 9 ) );
+   }
+
+   const blaze::DynamicVector<Type,blaze::columnVector> ref( A * x );
+   const blaze::BlockCompressedMatrix<Type,N> B( A );
+
+   checkRows   ( B, m*N );
+   checkColumns( B, n*N );
+
+   multiply( y, B, x );
+
+   if( y != ref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Multiplication failed\n"
+          << " Details:\n"
+          << "   Block rows   : " << m << "\n"
+          << "   Block columns: " << n << "\n"
+          << "   Block size   : " << N << "\n"
+          << "   Result:\n" << y << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copying a single block of the given block compressed matrix.
+//
+// \param matrix The block compressed matrix.
+// \param k The position of the block.
+// \return The copy of the block.
+//
+// This function copies the padded, column-major block at position \a k of the given matrix
+// into a StaticMatrix, which can be compared and printed.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t N >     // Number of rows and columns of the blocks
+blaze::StaticMatrix<Type,N,N,blaze::columnMajor>
+   ClassTest::block( const blaze::BlockCompressedMatrix<Type,N>& matrix, size_t k )
+{
+   const size_t S( blaze::BlockCompressedMatrix<Type,N>::spacing );
+   const Type* B( matrix.block( k ) );
+
+   blaze::StaticMatrix<Type,N,N,blaze::columnMajor> tmp;
+   for( size_t j=0UL; j<N; ++j ) {
+      for( size_t i=0UL; i<N; ++i ) {
+         tmp(i,j) = B[i+j*S];
+      }
+   }
+
+   return tmp;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the BlockCompressedMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the BlockCompressedMatrix class test.
+*/
+#define RUN_BLOCKCOMPRESSEDMATRIX_CLASS_TEST \
+   blazetest::mathtest::blockcompressedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blockcompressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,325 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/cholesky/OperationTest.h
+//  \brief Header file for the Cholesky and LDLT decomposition operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_CHOLESKY_OPERATIONTEST_H_
+#define _BLAZETEST_MATHTEST_CHOLESKY_OPERATIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/Cholesky.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace cholesky {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the dense Cholesky and LDLT decompositions.
+//
+// This class represents a test suite for the llt() and ldlt() decompositions and the according
+// triangular solve functions. It performs a series of runtime tests.
+*/
+class OperationTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit OperationTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testLLT            ();
+   void testLDLT           ();
+   void testTriangularSolve();
+
+   template< bool SO >
+   void testLLT( size_t n );
+
+   template< bool SO >
+   void testLDLT( size_t n );
+
+   template< typename MT >
+   void checkError( const MT& error, size_t n, const std::string& error_msg ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< bool SO >
+   static blaze::DynamicMatrix<double,SO> createSPD( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the size of the given error matrix.
+//
+// \param error The error matrix (e.g. the residual of a decomposition or of a solve).
+// \param n The size of the tested system.
+// \param error_msg The error message in case the error is too large.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks whether all elements of the given error matrix are below a size-dependent
+// tolerance. In case an element exceeds the tolerance, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename MT >  // Type of the error matrix
+void OperationTest::checkError( const MT& error, size_t n, const std::string& error_msg ) const
+{
+   const double tolerance( 1E-12 * double( n+1UL ) * double( n+1UL ) );
+
+   for( size_t i=0UL; i<error.rows(); ++i ) {
+      for( size_t j=0UL; j<error.columns(); ++j ) {
+         if( !( std::fabs( error(i,j) ) <= tolerance ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: " << error_msg << "\n"
+                << " Details:\n"
+                << "   Matrix size: " << n << "\n"
+                << "   Error (" << i << "," << j << "): " << error(i,j) << "\n"
+                << "   Tolerance  : " << tolerance << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Cholesky decomposition of a random symmetric positive definite matrix.
+//
+// \param n The number of rows and columns of the random matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function decomposes a random symmetric positive definite matrix and checks both the
+// reconstruction \f$ L L^T \f$ and the solution of a system with multiple right-hand sides.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO >  // Storage order of the matrices
+void OperationTest::testLLT( size_t n )
+{
+   const blaze::DynamicMatrix<double,SO> M( createSPD<SO>( n ) );
+   const blaze::SymmetricMatrix< blaze::DynamicMatrix<double,SO> > A( M );
+   blaze::LowerMatrix< blaze::DynamicMatrix<double,SO> > L;
+
+   blaze::llt( A, L );
+
+   checkError( blaze::DynamicMatrix<double,SO>( L * trans( L ) - M ), n, "Invalid Cholesky factor" );
+
+   blaze::DynamicMatrix<double,!SO> B( n, 3UL );
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<3UL; ++j ) {
+         B(i,j) = blaze::rand<double>( -1.0, 1.0 );
+      }
+   }
+
+   blaze::DynamicMatrix<double,!SO> X( B );
+   blaze::lltSolve( L, X );
+
+   checkError( blaze::DynamicMatrix<double,!SO>( M * X - B ), n, "Invalid solution" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the LDLT decomposition of a random symmetric positive definite matrix.
+//
+// \param n The number of rows and columns of the random matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function decomposes a random symmetric positive definite matrix and checks both the
+// reconstruction \f$ L D L^T \f$ and the solution of a single system. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO >  // Storage order of the matrices
+void OperationTest::testLDLT( size_t n )
+{
+   const blaze::DynamicMatrix<double,SO> M( createSPD<SO>( n ) );
+   const blaze::SymmetricMatrix< blaze::DynamicMatrix<double,SO> > A( M );
+   blaze::UniLowerMatrix< blaze::DynamicMatrix<double,SO> > L;
+   blaze::DynamicVector<double,blaze::columnVector> d;
+
+   blaze::ldlt( A, L, d );
+
+   blaze::DynamicMatrix<double,SO> D( n, n, 0.0 );
+   for( size_t i=0UL; i<n; ++i ) {
+      D(i,i) = d[i];
+   }
+
+   checkError( blaze::DynamicMatrix<double,SO>( L * D * trans( L ) - M ), n, "Invalid LDLT factors" );
+
+   blaze::DynamicVector<double,blaze::columnVector> b( n ), x;
+   for( size_t i=0UL; i<n; ++i ) {
+      b[i] = blaze::rand<double>( -1.0, 1.0 );
+   }
+
+   x = b;
+   blaze::ldltSolve( L, d, x );
+
+   blaze::DynamicMatrix<double,SO> r( n, 1UL );
+   column( r, 0UL ) = M * x - b;
+
+   checkError( r, n, "Invalid solution" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creation of a random, well-conditioned symmetric positive definite matrix.
+//
+// \param n The number of rows and columns of the matrix.
+// \return The random symmetric positive definite matrix.
+*/
+template< bool SO >  // Storage order of the matrix
+blaze::DynamicMatrix<double,SO> OperationTest::createSPD( size_t n )
+{
+   blaze::DynamicMatrix<double,SO> R( n, n );
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         R(i,j) = blaze::rand<double>( -1.0, 1.0 );
+      }
+   }
+
+   blaze::DynamicMatrix<double,SO> M( R * trans( R ) );
+   for( size_t i=0UL; i<n; ++i ) {
+      M(i,i) += double( n );
+   }
+
+   return M;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the dense Cholesky and LDLT decompositions.
+//
+// \return void
+*/
+void runTest()
+{
+   OperationTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the Cholesky and LDLT decomposition operation test.
+*/
+#define RUN_CHOLESKY_OPERATION_TEST \
+   blazetest::mathtest::cholesky::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace cholesky
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -96,6 +96,9 @@ class OperationTest
    void testIsIdentity();
    void testMinimum();
    void testMaximum();
+   void testSum();
+   void testMap();
+   void testMatrixChain();
 
    template< typename Type >
    void checkRows( const Type& matrix, size_t expectedRows ) const;
@@ -44,8 +44,11 @@
 #include <stdexcept>
 #include <string>
 #include <blaze/math/constraints/DenseVector.h>
-#include <blaze/math/DynamicVector.h>
+#include <blaze/math/DenseRow.h>
+#include <blaze/math/DenseSubmatrix.h>
 #include <blaze/math/DenseSubvector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
 #include <blazetest/system/Types.h>
 
 
@@ -100,6 +103,7 @@ class UnalignedTest
    void testIsDefault   ();
    void testIsSame      ();
    void testSubvector   ();
+   void testNestedViews ();
 
    template< typename Type >
    void checkSize( const Type& vector, size_t expectedSize ) const;
@@ -87,6 +87,11 @@ class OperationTest
    void testNormalize();
    void testMinimum();
    void testMaximum();
+   void testSum();
+   void testNorms();
+   void testDot();
+   void testMap();
+   void testMultiAssign();
 
    template< typename Type >
    void checkSize( const Type& vector, size_t expectedSize ) const;
@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -104,6 +105,8 @@ class OperationTest : private blaze::NonCopyable
    void testStore    ();
    void testStream   ();
    void testStoreu   ( size_t offset );
+   void testMaskload ( size_t n );
+   void testMaskstore( size_t n );
    void testReduction();
    //@}
    //**********************************************************************************************
@@ -167,6 +170,11 @@ OperationTest<T>::OperationTest()
       testStoreu( offset );
    }
 
+   for( size_t n=0UL; n<IT::size; ++n ) {
+      testMaskload( n );
+      testMaskstore( n );
+   }
+
    testReduction();
 }
 //*************************************************************************************************
@@ -265,6 +273,75 @@ void OperationTest<T>::testStoreu( size_t offset )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Testing the masked load operation.
+//
+// \param n The number of values to be loaded.
+// \return void
+// \exception std::runtime_error Load/store error detected.
+//
+// This function tests the masked load operation by copying the first \a n elements of each
+// intrinsic chunk of one array to another via masked load and aligned store. All remaining
+// elements of each chunk are expected to be zero. In case any error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Data type of the intrinsic test
+void OperationTest<T>::testMaskload( size_t n )
+{
+   using blaze::maskload;
+   using blaze::store;
+
+   test_  = "maskload() operation";
+
+   initialize();
+
+   for( size_t i=0UL; i<N; i+=IT::size ) {
+      store( b_+i, maskload( a_+i, n ) );
+      for( size_t j=n; j<IT::size; ++j ) {
+         a_[i+j] = T();
+      }
+   }
+
+   compare( a_, b_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the masked store operation.
+//
+// \param n The number of values to be stored.
+// \return void
+// \exception std::runtime_error Load/store error detected.
+//
+// This function tests the masked store operation by copying the first \a n elements of each
+// intrinsic chunk of one array to another via aligned load and masked store. All remaining
+// elements of each chunk are expected to be unchanged. In case any error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Data type of the intrinsic test
+void OperationTest<T>::testMaskstore( size_t n )
+{
+   using blaze::load;
+   using blaze::maskstore;
+
+   test_  = "maskstore() operation";
+
+   initialize();
+
+   T tmp[IT::size];
+
+   for( size_t i=0UL; i<N; i+=IT::size ) {
+      std::copy( b_+i, b_+i+IT::size, tmp );
+      maskstore( b_+i, n, load( a_+i ) );
+      std::copy( tmp+n, tmp+IT::size, a_+i+n );
+   }
+
+   compare( a_, b_ );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Testing the reduction operation.
 //
@@ -0,0 +1,335 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/inversion/OperationTest.h
+//  \brief Header file for the small matrix inversion operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_INVERSION_OPERATIONTEST_H_
+#define _BLAZETEST_MATHTEST_INVERSION_OPERATIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/HybridMatrix.h>
+#include <blaze/math/Inversion.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/math/StaticVector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace inversion {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the small dense matrix inversion functions.
+//
+// This class represents a test suite for the inv(), invert(), det() and solve() functions for
+// static and hybrid matrices. It performs a series of runtime tests.
+*/
+class OperationTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit OperationTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testInv  ();
+   void testDet  ();
+   void testSolve();
+
+   template< typename Type, size_t N, bool SO >
+   void testInv();
+
+   template< typename Type, size_t N, bool SO >
+   void testSolve();
+
+   template< typename MT >
+   void checkIdentity( const MT& error, double tolerance, const std::string& error_msg ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type, size_t N, bool SO >
+   static blaze::StaticMatrix<Type,N,N,SO> createMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking whether the given matrix is the identity matrix.
+//
+// \param I The matrix to be checked (e.g. the product of a matrix and its inverse).
+// \param tolerance The maximum admissible deviation of an element.
+// \param error_msg The error message in case the deviation is too large.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT >  // Type of the matrix
+void OperationTest::checkIdentity( const MT& I, double tolerance, const std::string& error_msg ) const
+{
+   for( size_t i=0UL; i<I.rows(); ++i ) {
+      for( size_t j=0UL; j<I.columns(); ++j ) {
+         const double expected( ( i == j )?( 1.0 ):( 0.0 ) );
+         if( !( std::fabs( I(i,j) - expected ) <= tolerance ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: " << error_msg << "\n"
+                << " Details:\n"
+                << "   Matrix size: " << I.rows() << "\n"
+                << "   Element (" << i << "," << j << "): " << I(i,j) << "\n"
+                << "   Tolerance  : " << tolerance << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the inversion of a random static and hybrid matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function inverts a random, well-conditioned static matrix both via inv() and invert()
+// and the corresponding hybrid matrix via inv() and checks that the product of the matrix and
+// its inverse is the identity matrix. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N       // Number of rows and columns
+        , bool SO >      // Storage order of the matrices
+void OperationTest::testInv()
+{
+   const double tolerance( ( sizeof(Type) == sizeof(float) )?( 1E-5 ):( 1E-13 ) );
+
+   const blaze::StaticMatrix<Type,N,N,SO> A( createMatrix<Type,N,SO>() );
+
+   const blaze::StaticMatrix<Type,N,N,SO> B( blaze::inv( A ) );
+   checkIdentity( blaze::StaticMatrix<Type,N,N,SO>( A * B ), tolerance, "Invalid inverse" );
+
+   blaze::StaticMatrix<Type,N,N,SO> C( A );
+   blaze::invert( C );
+   checkIdentity( blaze::StaticMatrix<Type,N,N,SO>( A * C ), tolerance, "Invalid in-place inverse" );
+
+   const blaze::HybridMatrix<Type,6UL,6UL,SO> H( A );
+   const blaze::HybridMatrix<Type,6UL,6UL,SO> D( blaze::inv( H ) );
+   checkIdentity( blaze::HybridMatrix<Type,6UL,6UL,SO>( H * D ), tolerance, "Invalid hybrid inverse" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the solution of a linear system with a random static matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves a linear system with a random, well-conditioned static matrix for a
+// single right-hand side vector and for multiple right-hand sides. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N       // Number of rows and columns
+        , bool SO >      // Storage order of the matrices
+void OperationTest::testSolve()
+{
+   const double tolerance( ( sizeof(Type) == sizeof(float) )?( 1E-5 ):( 1E-13 ) );
+
+   const blaze::StaticMatrix<Type,N,N,SO> A( createMatrix<Type,N,SO>() );
+
+   blaze::StaticVector<Type,N,blaze::columnVector> x, b;
+   blaze::StaticMatrix<Type,N,2UL,!SO> X, B;
+
+   for( size_t i=0UL; i<N; ++i ) {
+      x[i]   = blaze::rand<Type>( Type(-1), Type(1) );
+      X(i,0) = blaze::rand<Type>( Type(-1), Type(1) );
+      X(i,1) = blaze::rand<Type>( Type(-1), Type(1) );
+   }
+
+   b = A * x;
+   B = A * X;
+
+   blaze::solve( A, b );
+   blaze::solve( A, B );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      if( !( std::fabs( b[i] - x[i] ) <= tolerance ) ||
+          !( std::fabs( B(i,0) - X(i,0) ) <= tolerance ) ||
+          !( std::fabs( B(i,1) - X(i,1) ) <= tolerance ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid solution\n"
+             << " Details:\n"
+             << "   Result:\n" << b << "\n" << B << "\n"
+             << "   Expected result:\n" << x << "\n" << X << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creation of a random, well-conditioned square matrix.
+//
+// \return The random matrix.
+//
+// The matrix is strictly diagonally dominant. In order to test the pivoting of the elimination,
+// the dominant elements of the first two rows are swapped into the off-diagonal positions.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t N       // Number of rows and columns
+        , bool SO >      // Storage order of the matrix
+blaze::StaticMatrix<Type,N,N,SO> OperationTest::createMatrix()
+{
+   blaze::StaticMatrix<Type,N,N,SO> A;
+   for( size_t i=0UL; i<N; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         A(i,j) = blaze::rand<Type>( Type(-1), Type(1) );
+      }
+      A(i,i) += Type( 2*N );
+   }
+
+   if( N > 1UL ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         const Type tmp( A(0,j) );
+         A(0,j) = A(1,j);
+         A(1,j) = tmp;
+      }
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the small dense matrix inversion functions.
+//
+// \return void
+*/
+void runTest()
+{
+   OperationTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the small matrix inversion operation test.
+*/
+#define RUN_INVERSION_OPERATION_TEST \
+   blazetest::mathtest::inversion::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace inversion
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
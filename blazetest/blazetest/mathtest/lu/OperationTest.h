@@ -0,0 +1,207 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/lu/OperationTest.h
+//  \brief Header file for the LU decomposition operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+#ifndef _BLAZETEST_MATHTEST_LU_OPERATIONTEST_H_
+#define _BLAZETEST_MATHTEST_LU_OPERATIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/solvers/LUDecomposition.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace lu {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the dense LU decomposition.
+//
+// This class represents a test suite for the LUDecomposition class. It performs a series of
+// runtime tests, all of which are checked against the dense reference matrix.
+*/
+class OperationTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit OperationTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testFactorize  ();
+   void testSolveVector();
+   void testSolveMatrix();
+   void testPivoting   ();
+   void testSingular   ();
+
+   void testFactorize( const blaze::LUDecomposition& lu, const blaze::MatMxN& A );
+
+   template< typename MT >
+   void checkError( const MT& error, size_t n, const std::string& error_msg ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static blaze::MatMxN createMatrix( size_t n );
+   static blaze::MatMxN createMatrix( size_t m, size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the size of the given error matrix.
+//
+// \param error The error matrix (e.g. the residual of a decomposition or of a solve).
+// \param n The size of the tested system.
+// \param error_msg The error message in case the error is too large.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks whether all elements of the given error matrix are below a size-dependent
+// tolerance. In case an element exceeds the tolerance, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename MT >  // Type of the error matrix
+void OperationTest::checkError( const MT& error, size_t n, const std::string& error_msg ) const
+{
+   const double tolerance( 1E-12 * double( n+1UL ) * double( n+1UL ) );
+
+   for( size_t i=0UL; i<error.rows(); ++i ) {
+      for( size_t j=0UL; j<error.columns(); ++j ) {
+         if( !( std::fabs( error(i,j) ) <= tolerance ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: " << error_msg << "\n"
+                << " Details:\n"
+                << "   Matrix size: " << n << "\n"
+                << "   Error (" << i << "," << j << "): " << error(i,j) << "\n"
+                << "   Tolerance  : " << tolerance << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the dense LU decomposition.
+//
+// \return void
+*/
+void runTest()
+{
+   OperationTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the LU decomposition operation test.
+*/
+#define RUN_LU_OPERATION_TEST \
+   blazetest::mathtest::lu::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace lu
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,419 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/pgs/OperationTest.h
+//  \brief Header file for the PGS solver operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+#ifndef _BLAZETEST_MATHTEST_PGS_OPERATIONTEST_H_
+#define _BLAZETEST_MATHTEST_PGS_OPERATIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/problems/ContactLCP.h>
+#include <blaze/math/problems/LCP.h>
+#include <blaze/math/solvers/CPG.h>
+#include <blaze/math/solvers/PGS.h>
+#include <blaze/math/SparseSubmatrix.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace pgs {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the PGS solver.
+//
+// This class represents a test suite for the projected Gauss-Seidel solver. It solves and updates
+// LCPs and contact LCPs in all sweep modes of the solver. The problems are assembled from the
+// blocks of unknowns of a two-dimensional grid, in which each block of unknowns is coupled to its
+// four neighbors.
+*/
+class OperationTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit OperationTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testLCP       ();
+   void testContactLCP();
+   void testCPG       ();
+   void testUpdate    ();
+
+   template< typename CP >
+   void testUpdate( const std::string& problem, size_t k, blaze::PGS::Mode mode, bool solved );
+
+   template< typename CP >
+   void checkSolution( bool converged, const blaze::PGS& solver, const CP& cp ) const;
+
+   template< typename CP >
+   void checkUpdate( const CP& cp, const CP& fresh, const blaze::VecN& x ) const;
+
+   void checkFriction( const blaze::LCP& cp, const blaze::LCP& fresh ) const;
+   void checkFriction( const blaze::ContactLCP& cp, const blaze::ContactLCP& fresh ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static void   assemble   ( const std::vector<size_t>& ids, size_t k, blaze::LCP& lcp );
+   static void   assemble   ( const std::vector<size_t>& ids, size_t k, blaze::ContactLCP& lcp );
+   static double coefficient( size_t p, size_t q, size_t c );
+   static std::string modeName( blaze::PGS::Mode mode );
+
+   static inline size_t blockSize( const blaze::LCP& );
+   static inline size_t blockSize( const blaze::ContactLCP& );
+   static void setAppended( blaze::LCP& cp, const blaze::LCP& fresh, size_t nrem );
+   static void setAppended( blaze::ContactLCP& cp, const blaze::ContactLCP& fresh, size_t nrem );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the update of a complementarity problem in the given sweep mode.
+//
+// \param problem The name of the complementarity problem.
+// \param k The number of blocks of unknowns per dimension of the grid.
+// \param mode The sweep mode of the PGS solver.
+// \param solved \a true in case the problem is solved before the update, \a false if not.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function removes every eleventh block of unknowns of a problem and appends blocks of
+// unknowns that have not been part of the problem before. The updated problem is compared to a
+// freshly assembled problem. Afterwards, the updated problem is solved starting from the previous
+// solution and compared to the solution of the freshly assembled problem. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename CP >  // Type of the complementarity problem
+void OperationTest::testUpdate( const std::string& problem, size_t k, blaze::PGS::Mode mode, bool solved )
+{
+   test_ = "Update of " + problem + ( solved ? " after" : " before" ) + " a solution (" + modeName( mode ) + " mode)";
+
+   // Assembling the initial problem from all blocks with the exception of every seventh block
+   std::vector<size_t> ids;
+   for( size_t p=0UL; p<k*k; ++p ) {
+      if( p % 7UL != 3UL ) ids.push_back( p );
+   }
+
+   CP cp;
+   assemble( ids, k, cp );
+
+   const size_t bs( blockSize( cp ) );
+
+   blaze::PGS solver;
+   solver.setMode( mode );
+   solver.setThreshold( 1E-10 );
+
+   if( solved ) {
+      const bool converged( solver.solve( cp ) );
+      checkSolution( converged, solver, cp );
+   }
+
+   // Removing every eleventh block and appending half of the missing blocks in reverse order
+   std::vector<size_t> removed, updated;
+   blaze::VecN x( cp.size() );
+
+   for( size_t i=0UL; i<ids.size(); ++i ) {
+      if( i % 11UL == 5UL ) {
+         removed.push_back( i );
+         continue;
+      }
+      for( size_t j=0UL; j<bs; ++j )
+         x[updated.size()*bs+j] = cp.x_[i*bs+j];
+      updated.push_back( ids[i] );
+   }
+
+   const size_t nrem( updated.size()*bs );
+
+   for( size_t p=k*k; p>0UL; --p ) {
+      if( ( p-1UL ) % 14UL == 3UL ) updated.push_back( p-1UL );
+   }
+
+   x.resize( updated.size()*bs, true );
+   for( size_t j=nrem; j<x.size(); ++j ) {
+      x[j] = 0.0;
+   }
+
+   CP fresh;
+   assemble( updated, k, fresh );
+
+   const size_t m( fresh.size() - nrem );
+   const blaze::CMatMxN rows   ( submatrix( fresh.A_, nrem, 0UL, m, nrem+m ) );
+   const blaze::CMatMxN columns( submatrix( fresh.A_, 0UL, nrem, nrem, m ) );
+
+   solver.update( cp, removed, rows, columns );
+   setAppended( cp, fresh, nrem );
+
+   checkUpdate( cp, fresh, x );
+
+   // Solving the updated and the freshly assembled problem
+   const bool converged( solver.solve( cp ) );
+   checkSolution( converged, solver, cp );
+
+   blaze::PGS reference;
+   reference.setMode( mode );
+   reference.setThreshold( 1E-10 );
+
+   const bool refConverged( reference.solve( fresh ) );
+   checkSolution( refConverged, reference, fresh );
+
+   const double error( blaze::max( blaze::abs( cp.x_ - fresh.x_ ) ) );
+
+   if( !( error <= 1E-8 ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solution differs from the solution of the assembled problem\n"
+          << " Details:\n"
+          << "   Problem size: " << cp.size() << "\n"
+          << "   Error       : " << error << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the solution of a complementarity problem.
+//
+// \param converged The result of the solution process.
+// \param solver The solver used for the solution process.
+// \param cp The solved complementarity problem.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the solver reports convergence and that the residual of the
+// complementarity problem is small. Since the precision of the PGS solver is the maximum change
+// of an unknown during a sweep, the residual is allowed to exceed the threshold of the solver
+// by a small factor. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename CP >  // Type of the complementarity problem
+void OperationTest::checkSolution( bool converged, const blaze::PGS& solver, const CP& cp ) const
+{
+   const double residual( cp.residual() );
+   const double tolerance( 100.0 * solver.getThreshold() );
+
+   if( !converged || !( residual <= tolerance ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid solution\n"
+          << " Details:\n"
+          << "   Problem size: " << cp.size() << "\n"
+          << "   Sweep mode  : " << modeName( solver.getMode() ) << "\n"
+          << "   Converged   : " << converged << "\n"
+          << "   Iterations  : " << solver.getLastIterations() << "\n"
+          << "   Precision   : " << solver.getLastPrecision() << "\n"
+          << "   Residual    : " << residual << "\n"
+          << "   Tolerance   : " << tolerance << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+//*************************************************************************************************
+/*!\brief Checking an updated complementarity problem.
+//
+// \param cp The updated complementarity problem.
+// \param fresh The freshly assembled complementarity problem.
+// \param x The expected unknowns of the updated problem.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the system matrix, the right-hand side and the coefficients of
+// friction of the updated problem are identical to the freshly assembled problem and that the
+// unknowns of the remaining blocks have kept their previous values. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename CP >  // Type of the complementarity problem
+void OperationTest::checkUpdate( const CP& cp, const CP& fresh, const blaze::VecN& x ) const
+{
+   if( cp.A_ != fresh.A_ || cp.A_.nonZeros() != fresh.A_.nonZeros() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid system matrix\n"
+          << " Details:\n"
+          << "   Size              : " << cp.A_.rows() << "x" << cp.A_.columns() << "\n"
+          << "   Expected size     : " << fresh.A_.rows() << "x" << fresh.A_.columns() << "\n"
+          << "   Non-zeros         : " << cp.A_.nonZeros() << "\n"
+          << "   Expected non-zeros: " << fresh.A_.nonZeros() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( cp.b_ != fresh.b_ ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid right-hand side\n"
+          << " Details:\n"
+          << "   Result:\n" << cp.b_ << "\n"
+          << "   Expected result:\n" << fresh.b_ << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( cp.x_ != x ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid unknowns\n"
+          << " Details:\n"
+          << "   Result:\n" << cp.x_ << "\n"
+          << "   Expected result:\n" << x << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkFriction( cp, fresh );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of unknowns per block of an LCP.
+//
+// \return The number of unknowns per block.
+*/
+inline size_t OperationTest::blockSize( const blaze::LCP& )
+{
+   return 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of unknowns per block of a contact LCP.
+//
+// \return The number of unknowns per block.
+*/
+inline size_t OperationTest::blockSize( const blaze::ContactLCP& )
+{
+   return 3UL;
+}
+//*************************************************************************************************
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the PGS solver.
+//
+// \return void
+*/
+void runTest()
+{
+   OperationTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the PGS solver operation test.
+*/
+#define RUN_PGS_OPERATION_TEST \
+   blazetest::mathtest::pgs::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace pgs
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -1039,6 +1039,49 @@ void OperationTest<MT1,MT2>::testBasicOperation()
       }
 
 
+      // Multiplication with reused sparsity pattern
+      {
+         test_  = "Multiplication with reused sparsity pattern";
+         error_ = "Failed multiplication operation";
+
+         try {
+            initResults();
+            blaze::CompressedMatrix<SET,false> tmp( lhs_.rows(), rhs_.columns() );
+            smmmSymbolic( tmp, lhs_, rhs_ );
+            smmmNumeric( tmp, lhs_, rhs_ );
+            blaze::releaseSMMMWorkspace();
+            smmmNumeric( tmp, lhs_, rhs_ );
+            dres_   = tmp;
+            odres_  = tmp;
+            sres_   = tmp;
+            osres_  = tmp;
+            refres_ = reflhs_ * refrhs_;
+         }
+         catch( std::exception& ex ) {
+            convertException<MT1,MT2>( ex );
+         }
+
+         checkResults<MT1,MT2>();
+
+         try {
+            initResults();
+            blaze::CompressedMatrix<SET,true> tmp( olhs_.rows(), orhs_.columns() );
+            smmmSymbolic( tmp, olhs_, orhs_ );
+            smmmNumeric( tmp, olhs_, orhs_ );
+            smmmNumeric( tmp, olhs_, orhs_ );
+            dres_   = tmp;
+            odres_  = tmp;
+            sres_   = tmp;
+            osres_  = tmp;
+            refres_ = reflhs_ * refrhs_;
+         }
+         catch( std::exception& ex ) {
+            convertException<OMT1,OMT2>( ex );
+         }
+
+         checkResults<OMT1,OMT2>();
+      }
+
       //=====================================================================================
       // Multiplication with addition assignment
       //=====================================================================================
@@ -0,0 +1,484 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smp/SparseTest.h
+//  \brief Header file for the sparse matrix SMP assignment test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMP_SPARSETEST_H_
+#define _BLAZETEST_MATHTEST_SMP_SPARSETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the tests of the SMP assignment to sparse matrices.
+//
+// This class represents a test suite for the parallel assignment, addition assignment and
+// subtraction assignment to row-major and column-major compressed matrices. All operands are
+// large enough to exceed the SMP thresholds of the according operations. Each result is compared
+// to the serial evaluation of the same expression and to the result of the equivalent dense
+// matrix expression. The test is compiled once for every SMP backend.
+*/
+class SparseTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SparseTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< bool SO >
+   void testAssign();
+
+   template< bool SO >
+   void testAddAssign();
+
+   template< bool SO >
+   void testSubAssign();
+
+   template< typename MT1, typename MT2, typename MT3 >
+   void checkResult( const MT1& result, const MT2& expected, const MT3& reference ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< bool SO >
+   static blaze::CompressedMatrix<double,SO> createSparse( size_t m, size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the sparse matrix SMP assignment test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+inline SparseTest::SparseTest()
+{
+   testAssign<blaze::rowMajor>();
+   testAssign<blaze::columnMajor>();
+   testAddAssign<blaze::rowMajor>();
+   testAddAssign<blaze::columnMajor>();
+   testSubAssign<blaze::rowMajor>();
+   testSubAssign<blaze::columnMajor>();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignment to a sparse matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the SMP assignment of sparse matrix additions, subtractions, multiplications
+// and scalar multiplications to a sparse matrix with storage order \a SO. The tested expressions include
+// operands with the same and with the opposite storage order as well as nested expressions.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO >  // Storage order of the target matrix
+void SparseTest::testAssign()
+{
+   typedef blaze::CompressedMatrix<double,SO>   MT;
+   typedef blaze::CompressedMatrix<double,!SO>  OMT;
+   typedef blaze::DynamicMatrix<double,SO>      DMT;
+
+   const MT  A( createSparse<SO> ( 300UL, 350UL ) );
+   const MT  B( createSparse<SO> ( 300UL, 350UL ) );
+   const MT  C( createSparse<SO> ( 300UL, 350UL ) );
+   const OMT D( createSparse<!SO>( 300UL, 350UL ) );
+   const OMT E( createSparse<!SO>( 300UL, 350UL ) );
+   const MT  F( createSparse<SO> ( 350UL, 200UL ) );
+
+   const DMT dA( A ), dB( B ), dC( C ), dD( D ), dE( E ), dF( F );
+
+   {
+      test_ = "Assignment of a sparse matrix addition";
+
+      MT result( A + B );
+      checkResult( result, MT( serial( A + B ) ), DMT( dA + dB ) );
+
+      result = C + A;
+      checkResult( result, MT( serial( C + A ) ), DMT( dC + dA ) );
+   }
+
+   {
+      test_ = "Assignment of a sparse matrix subtraction";
+
+      MT result( A - B );
+      checkResult( result, MT( serial( A - B ) ), DMT( dA - dB ) );
+
+      result = C - A;
+      checkResult( result, MT( serial( C - A ) ), DMT( dC - dA ) );
+   }
+
+   {
+      test_ = "Assignment of a sparse matrix/scalar multiplication";
+
+      MT result( A * 2.5 );
+      checkResult( result, MT( serial( A * 2.5 ) ), DMT( dA * 2.5 ) );
+
+      result = ( A + B ) * 0.5;
+      checkResult( result, MT( serial( ( A + B ) * 0.5 ) ), DMT( ( dA + dB ) * 0.5 ) );
+   }
+
+   {
+      test_ = "Assignment of a sparse matrix multiplication";
+
+      MT result( A * F );
+      checkResult( result, MT( serial( A * F ) ), DMT( dA * dF ) );
+
+      result = ( A - B ) * F;
+      checkResult( result, MT( serial( ( A - B ) * F ) ), DMT( ( dA - dB ) * dF ) );
+   }
+
+   {
+      test_ = "Assignment of nested sparse matrix expressions";
+
+      MT result( ( A + B ) - C );
+      checkResult( result, MT( serial( ( A + B ) - C ) ), DMT( ( dA + dB ) - dC ) );
+
+      result = A - ( B - 2.0 * C );
+      checkResult( result, MT( serial( A - ( B - 2.0 * C ) ) ), DMT( dA - ( dB - 2.0 * dC ) ) );
+   }
+
+   {
+      test_ = "Assignment of sparse matrix expressions with opposite storage order";
+
+      MT result( D + E );
+      checkResult( result, MT( serial( D + E ) ), DMT( dD + dE ) );
+
+      result = A - D;
+      checkResult( result, MT( serial( A - D ) ), DMT( dA - dD ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP addition assignment to a sparse matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the SMP addition assignment of sparse matrix expressions to a sparse
+// matrix with storage order \a SO. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< bool SO >  // Storage order of the target matrix
+void SparseTest::testAddAssign()
+{
+   typedef blaze::CompressedMatrix<double,SO>   MT;
+   typedef blaze::CompressedMatrix<double,!SO>  OMT;
+   typedef blaze::DynamicMatrix<double,SO>      DMT;
+
+   const MT  A( createSparse<SO> ( 300UL, 350UL ) );
+   const MT  B( createSparse<SO> ( 300UL, 350UL ) );
+   const MT  C( createSparse<SO> ( 300UL, 350UL ) );
+   const OMT D( createSparse<!SO>( 300UL, 350UL ) );
+
+   const DMT dA( A ), dB( B ), dC( C ), dD( D );
+
+   {
+      test_ = "Addition assignment of a sparse matrix addition";
+
+      MT result( A ), expected( A );
+      result += B + C;
+      expected += serial( B + C );
+      checkResult( result, expected, DMT( dA + ( dB + dC ) ) );
+   }
+
+   {
+      test_ = "Addition assignment of a sparse matrix/scalar multiplication";
+
+      MT result( A ), expected( A );
+      result += ( B - C ) * 3.0;
+      expected += serial( ( B - C ) * 3.0 );
+      checkResult( result, expected, DMT( dA + ( dB - dC ) * 3.0 ) );
+   }
+
+   {
+      test_ = "Addition assignment of a sparse matrix expression with opposite storage order";
+
+      MT result( A ), expected( A );
+      result += D + D;
+      expected += serial( D + D );
+      checkResult( result, expected, DMT( dA + ( dD + dD ) ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP subtraction assignment to a sparse matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the SMP subtraction assignment of sparse matrix expressions to a sparse
+// matrix with storage order \a SO. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< bool SO >  // Storage order of the target matrix
+void SparseTest::testSubAssign()
+{
+   typedef blaze::CompressedMatrix<double,SO>   MT;
+   typedef blaze::CompressedMatrix<double,!SO>  OMT;
+   typedef blaze::DynamicMatrix<double,SO>      DMT;
+
+   const MT  A( createSparse<SO> ( 300UL, 350UL ) );
+   const MT  B( createSparse<SO> ( 300UL, 350UL ) );
+   const MT  C( createSparse<SO> ( 300UL, 350UL ) );
+   const OMT D( createSparse<!SO>( 300UL, 350UL ) );
+
+   const DMT dA( A ), dB( B ), dC( C ), dD( D );
+
+   {
+      test_ = "Subtraction assignment of a sparse matrix subtraction";
+
+      MT result( A ), expected( A );
+      result -= B - C;
+      expected -= serial( B - C );
+      checkResult( result, expected, DMT( dA - ( dB - dC ) ) );
+   }
+
+   {
+      test_ = "Subtraction assignment of a sparse matrix/scalar multiplication";
+
+      MT result( A ), expected( A );
+      result -= ( B + C ) * 2.0;
+      expected -= serial( ( B + C ) * 2.0 );
+      checkResult( result, expected, DMT( dA - ( dB + dC ) * 2.0 ) );
+   }
+
+   {
+      test_ = "Subtraction assignment of a sparse matrix expression with opposite storage order";
+
+      MT result( A ), expected( A );
+      result -= D - A;
+      expected -= serial( D - A );
+      checkResult( result, expected, DMT( dA - ( dD - dA ) ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of an SMP assignment.
+//
+// \param result The result of the SMP assignment.
+// \param expected The result of the according serial assignment.
+// \param reference The result of the according dense matrix operation.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the result of an SMP assignment has the same sparsity structure as
+// the result of the according serial assignment and that its values match the result of the
+// according dense matrix operation. In case a mismatch is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename MT1    // Type of the SMP result
+        , typename MT2    // Type of the serial result
+        , typename MT3 >  // Type of the dense reference
+void SparseTest::checkResult( const MT1& result, const MT2& expected, const MT3& reference ) const
+{
+   if( result.rows() != reference.rows() || result.columns() != reference.columns() ||
+       result.nonZeros() != expected.nonZeros() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid sparsity structure\n"
+          << " Details:\n"
+          << "   Result size       : " << result.rows() << "x" << result.columns() << "\n"
+          << "   Expected size     : " << reference.rows() << "x" << reference.columns() << "\n"
+          << "   Result non-zeros  : " << result.nonZeros() << "\n"
+          << "   Expected non-zeros: " << expected.nonZeros() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<reference.rows(); ++i ) {
+      for( size_t j=0UL; j<reference.columns(); ++j ) {
+         if( !( std::fabs( result(i,j) - reference(i,j) ) <= 1E-12 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid result\n"
+                << " Details:\n"
+                << "   Result (" << i << "," << j << "): " << result(i,j) << "\n"
+                << "   Expected result (" << i << "," << j << "): " << reference(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creation of a random sparse matrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return The random sparse matrix.
+//
+// This function creates a random sparse matrix with an irregular structure: every fifth row
+// and column is empty, the remaining rows/columns are filled to approximately 60%. The resulting matrices exceed the SMP
+// thresholds of all tested operations.
+*/
+template< bool SO >  // Storage order of the matrix
+blaze::CompressedMatrix<double,SO> SparseTest::createSparse( size_t m, size_t n )
+{
+   blaze::CompressedMatrix<double,SO> A( m, n );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         if( i % 5UL != 0UL && j % 5UL != 0UL && blaze::rand<double>( 0.0, 1.0 ) < 0.6 )
+            A(i,j) = blaze::rand<double>( -1.0, 1.0 );
+      }
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the SMP assignment to sparse matrices.
+//
+// \return void
+*/
+inline void runTest()
+{
+   SparseTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the sparse matrix SMP assignment test.
+*/
+#define RUN_SMP_SPARSE_TEST \
+   blazetest::mathtest::smp::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
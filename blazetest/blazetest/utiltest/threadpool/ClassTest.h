@@ -0,0 +1,468 @@
+//=================================================================================================
+/*!
+//  \file blazetest/utiltest/threadpool/ClassTest.h
+//  \brief Header file for the ThreadPool class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_UTILTEST_THREADPOOL_CLASSTEST_H_
+#define _BLAZETEST_UTILTEST_THREADPOOL_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <boost/atomic.hpp>
+#include <boost/thread/condition.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+#include <blaze/system/SMP.h>
+#include <blaze/util/ThreadPool.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/UniqueArray.h>
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+#  include <condition_variable>
+#  include <mutex>
+#  include <thread>
+#endif
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the test of the ThreadPool class template.
+//
+// This class represents the collection of tests for the ThreadPool class template. The tests
+// schedule large numbers of tasks of very uneven runtime, such that the threads of the pool
+// repeatedly run dry, steal tasks from each other and go to sleep while new tasks arrive. A
+// lost task or a task executed twice is detected via a per-task execution counter, a lost
+// wake-up results in a hanging wait() and is detected by a watchdog that aborts the test.
+*/
+class ClassTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Type of the boost thread pool.
+   typedef blaze::ThreadPool< boost::thread
+                            , boost::mutex
+                            , boost::unique_lock<boost::mutex>
+                            , boost::condition_variable >  BoostThreadPool;
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+   //! Type of the C++11 thread pool.
+   typedef blaze::ThreadPool< std::thread
+                            , std::mutex
+                            , std::unique_lock<std::mutex>
+                            , std::condition_variable >  StdThreadPool;
+#endif
+
+   typedef boost::atomic<size_t>  Counter;  //!< Type of the task execution counters.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Private class Work**************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Task of a configurable runtime that records its own execution.
+   */
+   struct Work
+   {
+      Work( Counter* counters, size_t index, size_t cost )
+         : counters_( counters )
+         , index_   ( index    )
+         , cost_    ( cost     )
+      {}
+
+      void operator()() const {
+         volatile double sink( 0.0 );
+         for( size_t i=0UL; i<cost_; ++i )
+            sink = sink + 1.0 / double( i+1UL );
+         ++counters_[index_];
+      }
+
+      Counter* counters_;  //!< The execution counters of all tasks.
+      size_t   index_;     //!< The index of this task.
+      size_t   cost_;      //!< The number of busy iterations of this task.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Private class Watchdog**********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Guard that aborts the test in case a test step does not complete in time.
+   */
+   class Watchdog
+   {
+    public:
+      explicit Watchdog( const std::string& test, size_t seconds );
+      ~Watchdog();
+
+    private:
+      void run();
+
+      std::string               test_;      //!< Label of the guarded test.
+      boost::posix_time::ptime  deadline_;  //!< Point in time at which the test is aborted.
+      bool                      done_;      //!< Completion flag of the guarded test.
+      boost::mutex              mutex_;     //!< Synchronization mutex.
+      boost::condition_variable finished_;  //!< Wait condition for the completion of the test.
+      boost::thread             thread_;    //!< The watchdog thread.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename PoolType > void testUnevenTasks( const std::string& pool );
+   template< typename PoolType > void testWakeUp     ( const std::string& pool );
+   template< typename PoolType > void testResize     ( const std::string& pool );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename PoolType >
+   size_t schedule( PoolType& threadpool, Counter* counters, size_t first, size_t last ) const;
+
+   template< typename PoolType >
+   void checkPool( const PoolType& threadpool, size_t threads ) const;
+
+   void checkCounters( const Counter* counters, size_t n ) const;
+
+   static size_t cost( size_t index );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the execution of many tasks of uneven runtime.
+//
+// \param pool The name of the tested thread pool type.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function repeatedly schedules thousands of tasks, where every fourth task is two orders
+// of magnitude more expensive than the rest. Due to the round-robin distribution all expensive
+// tasks end up in the same task queue, which forces the remaining threads to steal from it. After
+// each call to wait() every task must have been executed exactly once and no task must be left
+// in the task queues. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename PoolType >
+void ClassTest::testUnevenTasks( const std::string& pool )
+{
+   test_ = pool + " uneven task test";
+
+   const size_t rounds( 20UL );
+   const size_t tasks ( 4000UL );
+
+   Watchdog watchdog( test_, 120UL );
+
+   PoolType threadpool( 4UL );
+
+   for( size_t round=0UL; round<rounds; ++round )
+   {
+      blaze::UniqueArray<Counter> counters( new Counter[tasks] );
+
+      const size_t scheduled( schedule( threadpool, counters.get(), 0UL, tasks ) );
+
+      threadpool.wait();
+
+      checkPool( threadpool, 4UL );
+      checkCounters( counters.get(), scheduled );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the wake-up of idle threads.
+//
+// \param pool The name of the tested thread pool type.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function schedules very small batches of tasks into an idle thread pool and immediately
+// waits for their completion. Since the threads of the pool are constantly about to go to sleep
+// when the next batch arrives, a missed notification of an idle thread or of the waiting thread
+// results in a hanging wait() call, which is detected by the watchdog. A wait() call returning
+// before all tasks of the batch have completed results in an unexecuted task. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename PoolType >
+void ClassTest::testWakeUp( const std::string& pool )
+{
+   test_ = pool + " wake-up test";
+
+   const size_t rounds( 5000UL );
+
+   Watchdog watchdog( test_, 120UL );
+
+   PoolType threadpool( 3UL );
+
+   blaze::UniqueArray<Counter> counters( new Counter[3UL*rounds] );
+
+   for( size_t i=0UL; i<3UL*rounds; ++i ) {
+      counters[i] = 0UL;
+   }
+
+   size_t scheduled( 0UL );
+
+   for( size_t round=0UL; round<rounds; ++round )
+   {
+      const size_t batch( 1UL + round % 3UL );
+
+      for( size_t i=0UL; i<batch; ++i, ++scheduled ) {
+         threadpool.schedule( Work( counters.get(), scheduled, ( round % 7UL ) * 50UL ) );
+      }
+
+      threadpool.wait();
+
+      checkPool( threadpool, 3UL );
+      checkCounters( counters.get(), scheduled );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of resizing the thread pool while tasks are queued.
+//
+// \param pool The name of the tested thread pool type.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function grows and shrinks the thread pool while thousands of tasks are still waiting
+// in the task queues. Shrinking the pool leaves tasks behind in the task queues of terminating
+// threads, which have to be stolen by the remaining threads. After each call to wait() every
+// task must have been executed exactly once and the thread pool must have the requested size.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename PoolType >
+void ClassTest::testResize( const std::string& pool )
+{
+   test_ = pool + " resize test";
+
+   const size_t rounds( 10UL );
+   const size_t tasks ( 2000UL );
+
+   Watchdog watchdog( test_, 120UL );
+
+   PoolType threadpool( 2UL );
+
+   for( size_t round=0UL; round<rounds; ++round )
+   {
+      blaze::UniqueArray<Counter> counters( new Counter[4UL*tasks] );
+
+      size_t scheduled( 0UL );
+
+      scheduled += schedule( threadpool, counters.get(), scheduled, scheduled+tasks );
+      threadpool.resize( 6UL );
+
+      scheduled += schedule( threadpool, counters.get(), scheduled, scheduled+tasks );
+      threadpool.resize( 1UL );
+
+      scheduled += schedule( threadpool, counters.get(), scheduled, scheduled+tasks );
+      threadpool.resize( 3UL );
+
+      scheduled += schedule( threadpool, counters.get(), scheduled, scheduled+tasks );
+      threadpool.resize( 2UL, round % 2UL == 0UL );
+
+      threadpool.wait();
+
+      checkPool( threadpool, 2UL );
+      checkCounters( counters.get(), scheduled );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scheduling the tasks in the range \f$ [first..last) \f$.
+//
+// \param threadpool The thread pool to schedule the tasks to.
+// \param counters The execution counters of the tasks.
+// \param first The index of the first task.
+// \param last The index one past the last task.
+// \return The number of scheduled tasks.
+*/
+template< typename PoolType >
+size_t ClassTest::schedule( PoolType& threadpool, Counter* counters,
+                           size_t first, size_t last ) const
+{
+   for( size_t i=first; i<last; ++i ) {
+      counters[i] = 0UL;
+   }
+
+   for( size_t i=first; i<last; ++i ) {
+      threadpool.schedule( Work( counters, i, cost( i ) ) );
+   }
+
+   return last - first;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the state of a thread pool after a call to wait().
+//
+// \param threadpool The thread pool to be checked.
+// \param threads The expected number of threads.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename PoolType >
+void ClassTest::checkPool( const PoolType& threadpool, size_t threads ) const
+{
+   if( !threadpool.isEmpty() || threadpool.size() != threads ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid thread pool state after wait()\n"
+          << " Details:\n"
+          << "   Empty         = " << threadpool.isEmpty() << "\n"
+          << "   Size          = " << threadpool.size() << "\n"
+          << "   Expected size = " << threads << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of busy iterations of the task with the given index.
+//
+// \param index The index of the task.
+// \return The number of busy iterations.
+*/
+inline size_t ClassTest::cost( size_t index )
+{
+   return ( index % 4UL == 0UL )?( 5000UL ):( ( index * 7919UL ) % 50UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the ThreadPool class template.
+//
+// \return void
+*/
+inline void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the ThreadPool class test.
+*/
+#define RUN_THREADPOOL_CLASS_TEST \
+   blazetest::utiltest::threadpool::runTest();
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+#endif
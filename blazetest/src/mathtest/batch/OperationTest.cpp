@@ -0,0 +1,361 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/batch/OperationTest.cpp
+//  \brief Source file for the batched small matrix and vector operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/MatrixBatch.h>
+#include <blaze/math/VectorBatch.h>
+#include <blazetest/mathtest/batch/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace batch {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the batch operation test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   testAccess();
+   testAddSub();
+   testMult();
+   testTrans();
+   testInvert();
+   testRotation();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the element access and the utility functions of the batches.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the element layout of the batches, the set() and get() functions and
+// the preservation of the elements during resize operations. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testAccess()
+{
+   typedef blaze::StaticMatrix<double,2UL,3UL,blaze::rowMajor>  MT;
+   typedef blaze::StaticVector<double,3UL,blaze::columnVector>  VT;
+
+   {
+      test_ = "MatrixBatch element access";
+
+      blaze::MatrixBatch<double,2UL,3UL> A( 5UL );
+
+      for( size_t k=0UL; k<5UL; ++k ) {
+         MT m;
+         for( size_t i=0UL; i<2UL; ++i )
+            for( size_t j=0UL; j<3UL; ++j )
+               m(i,j) = double( 100UL*k + 10UL*i + j );
+         A.set( k, m );
+      }
+
+      const size_t L( blaze::MatrixBatch<double,2UL,3UL>::lanes );
+
+      for( size_t k=0UL; k<5UL; ++k ) {
+         MT m;
+         for( size_t i=0UL; i<2UL; ++i ) {
+            for( size_t j=0UL; j<3UL; ++j ) {
+               m(i,j) = double( 100UL*k + 10UL*i + j );
+               if( A.data()[(k/L)*6UL*L + (i*3UL+j)*L + k%L] != m(i,j) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Invalid element layout\n"
+                      << " Details:\n"
+                      << "   Matrix index: " << k << "\n"
+                      << "   Element (" << i << "," << j << ")\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+         checkMatrix( A, k, m );
+      }
+
+      test_ = "MatrixBatch resize";
+
+      A.resize( 11UL );
+
+      if( A.size() != 11UL || A.blocks() != ( 11UL + L - 1UL ) / L ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid batch size\n"
+             << " Details:\n"
+             << "   Size  : " << A.size() << "\n"
+             << "   Blocks: " << A.blocks() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t k=0UL; k<11UL; ++k ) {
+         MT m( 0.0 );
+         if( k < 5UL ) {
+            for( size_t i=0UL; i<2UL; ++i )
+               for( size_t j=0UL; j<3UL; ++j )
+                  m(i,j) = double( 100UL*k + 10UL*i + j );
+         }
+         checkMatrix( A, k, m );
+      }
+   }
+
+   {
+      test_ = "VectorBatch resize";
+
+      blaze::VectorBatch<double,3UL> v( 3UL );
+
+      for( size_t k=0UL; k<3UL; ++k )
+         v.set( k, VT( double(k), double(k+1UL), double(k+2UL) ) );
+
+      v.resize( 1UL );
+      v.resize( 9UL );
+
+      checkVector( v, 0UL, VT( 0.0, 1.0, 2.0 ) );
+      for( size_t k=1UL; k<9UL; ++k )
+         checkVector( v, k, VT( 0.0 ) );
+   }
+
+   {
+      test_ = "Batch size mismatch";
+
+      blaze::VectorBatch<double,3UL> a( 3UL ), b( 4UL ), c;
+
+      try {
+         blaze::add( a, b, c );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition of batches of different size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched addition and subtraction.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the batched addition and subtraction for several batch sizes, including
+// sizes that only partially fill the last block. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testAddSub()
+{
+   test_ = "Batched addition/subtraction (double)";
+   for( size_t n=0UL; n<=9UL; ++n )
+      testAddSub<double>( n );
+
+   test_ = "Batched addition/subtraction (float)";
+   for( size_t n=0UL; n<=17UL; ++n )
+      testAddSub<float>( n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched multiplications.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the batched matrix/matrix and matrix/vector multiplications for several
+// batch sizes. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testMult()
+{
+   test_ = "Batched multiplication (double)";
+   for( size_t n=0UL; n<=9UL; ++n )
+      testMult<double>( n );
+
+   test_ = "Batched multiplication (float)";
+   for( size_t n=0UL; n<=17UL; ++n )
+      testMult<float>( n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched transposition.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the batched transposition of square and non-square matrices for several
+// batch sizes. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testTrans()
+{
+   test_ = "Batched transposition (double)";
+   for( size_t n=0UL; n<=9UL; ++n )
+      testTrans<double>( n );
+
+   test_ = "Batched transposition (float)";
+   for( size_t n=0UL; n<=17UL; ++n )
+      testTrans<float>( n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched 3x3 inversion.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the batched inversion for several batch sizes and checks that a batch
+// containing a singular matrix is rejected. Since the padding lanes of a partially filled block
+// are zero, this also verifies that these lanes are not mistaken for singular matrices. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testInvert()
+{
+   test_ = "Batched inversion (double)";
+   for( size_t n=0UL; n<=9UL; ++n )
+      testInvert<double>( n );
+
+   test_ = "Batched inversion (float)";
+   for( size_t n=0UL; n<=17UL; ++n )
+      testInvert<float>( n );
+
+   {
+      test_ = "Batched inversion of a singular matrix";
+
+      blaze::MatrixBatch<double,3UL,3UL> A( 5UL );
+
+      for( size_t k=0UL; k<5UL; ++k ) {
+         if( k == 3UL ) continue;
+         A.set( k, blaze::StaticMatrix<double,3UL,3UL,blaze::rowMajor>( 0.0 ) );
+         for( size_t i=0UL; i<3UL; ++i )
+            A(k,i,i) = 2.0;
+      }
+
+      try {
+         blaze::invert( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inversion of a singular matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched quaternion kernels.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the batched rotation of vectors and the batched conversion to rotation
+// matrices for several batch sizes. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void OperationTest::testRotation()
+{
+   test_ = "Batched quaternion kernels (double)";
+   for( size_t n=0UL; n<=9UL; ++n )
+      testRotation<double>( n );
+
+   test_ = "Batched quaternion kernels (float)";
+   for( size_t n=0UL; n<=17UL; ++n )
+      testRotation<float>( n );
+}
+//*************************************************************************************************
+
+} // namespace batch
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running batch operation test..." << std::endl;
+
+   try
+   {
+      RUN_BATCH_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during batch operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,434 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/blockcompressedmatrix/ClassTest.cpp
+//  \brief Source file for the BlockCompressedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/BlockCompressedMatrix.h>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/blockcompressedmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace blockcompressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the BlockCompressedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testMultiply();
+   testSwap();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the BlockCompressedMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix default constructor";
+
+      blaze::BlockCompressedMatrix<int,3UL> mat;
+
+      checkRows   ( mat, 0UL );
+      checkColumns( mat, 0UL );
+      checkBlocks ( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Conversion constructor
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix conversion constructor (row-major)";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 6UL, 9UL );
+      A(0,1) = 1.0;
+      A(2,7) = 2.0;
+      A(3,0) = 3.0;
+      A(4,4) = 4.0;
+      A(5,5) = 5.0;
+
+      blaze::BlockCompressedMatrix<double,3UL> mat( A );
+
+      checkRows   ( mat, 6UL );
+      checkColumns( mat, 9UL );
+      checkBlocks ( mat, 4UL );
+
+      if( mat.blockRows() != 2UL || mat.blockColumns() != 3UL ||
+          mat.offset(1) != 2UL || mat.index(0) != 0UL || mat.index(1) != 2UL ||
+          mat.index(2) != 0UL || mat.index(3) != 1UL ||
+          mat.diagonal(0) != 0UL || mat.diagonal(1) != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid block setup\n"
+             << " Details:\n"
+             << "   Block rows   : " << mat.blockRows() << " (expected 2)\n"
+             << "   Block columns: " << mat.blockColumns() << " (expected 3)\n"
+             << "   Block indices: " << mat.index(0) << " " << mat.index(1) << " "
+                                     << mat.index(2) << " " << mat.index(3) << " (expected 0 2 0 1)\n"
+             << "   Diagonals    : " << mat.diagonal(0) << " " << mat.diagonal(1) << " (expected 0 3)\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( block( mat, 0 )(0,1) != 1.0 || block( mat, 1 )(2,1) != 2.0 || block( mat, 2 )(0,0) != 3.0 ||
+          block( mat, 3 )(1,1) != 4.0 || block( mat, 3 )(2,2) != 5.0 || block( mat, 3 )(0,0) != 0.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid block values\n"
+             << " Details:\n"
+             << "   Block 0:\n" << block( mat, 0 ) << "\n"
+             << "   Block 1:\n" << block( mat, 1 ) << "\n"
+             << "   Block 2:\n" << block( mat, 2 ) << "\n"
+             << "   Block 3:\n" << block( mat, 3 ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BlockCompressedMatrix conversion constructor (column-major)";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> A( 4UL, 2UL );
+      A(1,0) = 1;
+      A(2,1) = 2;
+
+      blaze::BlockCompressedMatrix<int,2UL> mat( A );
+
+      checkRows   ( mat, 4UL );
+      checkColumns( mat, 2UL );
+      checkBlocks ( mat, 2UL );
+
+      if( mat.diagonal(0) != 0UL || mat.diagonal(1) != mat.offset(2) ||
+          block( mat, 0 )(1,0) != 1 || block( mat, 1 )(0,1) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid block setup\n"
+             << " Details:\n"
+             << "   Block 0:\n" << block( mat, 0 ) << "\n"
+             << "   Block 1:\n" << block( mat, 1 ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BlockCompressedMatrix conversion constructor (invalid matrix size)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> A( 3UL, 4UL );
+
+      try {
+         blaze::BlockCompressedMatrix<int,3UL> mat( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup with invalid matrix size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the BlockCompressedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   //=====================================================================================
+   // Sparse matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix sparse matrix assignment";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 6UL, 6UL );
+      A(0,0) = 1.0;
+      A(3,3) = 2.0;
+      A(5,0) = 3.0;
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> B( 3UL, 6UL );
+      B(2,4) = 4.0;
+
+      blaze::BlockCompressedMatrix<double,3UL> mat( A );
+
+      checkRows   ( mat, 6UL );
+      checkColumns( mat, 6UL );
+      checkBlocks ( mat, 3UL );
+
+      mat = B;
+
+      checkRows   ( mat, 3UL );
+      checkColumns( mat, 6UL );
+      checkBlocks ( mat, 1UL );
+
+      if( mat.index(0) != 1UL || block( mat, 0 )(2,1) != 4.0 || block( mat, 0 )(0,0) != 0.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Block index: " << mat.index(0) << " (expected 1)\n"
+             << "   Block:\n" << block( mat, 0 ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BlockCompressedMatrix sparse matrix assignment (invalid matrix size)";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 6UL, 5UL );
+      blaze::BlockCompressedMatrix<double,3UL> mat;
+
+      try {
+         mat = A;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of invalid matrix size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the block compressed matrix/dense vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiply() function for various matrix sizes, block
+// sizes and element types. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testMultiply()
+{
+   //=====================================================================================
+   // Multiplication with random matrices
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix multiplication";
+
+      const size_t sizes[] = { 0UL, 1UL, 2UL, 3UL, 7UL, 16UL, 33UL };
+
+      for( size_t i=0UL; i<sizeof(sizes)/sizeof(size_t); ++i ) {
+         for( size_t j=0UL; j<sizeof(sizes)/sizeof(size_t); j+=2UL ) {
+            testMultiply<int,3UL>   ( sizes[i], sizes[j] );
+            testMultiply<float,3UL> ( sizes[i], sizes[j] );
+            testMultiply<float,5UL> ( sizes[i], sizes[j] );
+            testMultiply<double,1UL>( sizes[i], sizes[j] );
+            testMultiply<double,3UL>( sizes[i], sizes[j] );
+            testMultiply<double,4UL>( sizes[i], sizes[j] );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Multiplication with aliasing
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix multiplication with aliasing";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 4UL, 4UL );
+      A(0,1) = 2.0;
+      A(1,0) = 1.0;
+      A(1,3) = 1.0;
+      A(3,2) = 3.0;
+
+      blaze::DynamicVector<double,blaze::columnVector> x( 4UL );
+      x[0] = 1.0;
+      x[1] = 2.0;
+      x[2] = 3.0;
+      x[3] = 4.0;
+
+      const blaze::BlockCompressedMatrix<double,2UL> B( A );
+      multiply( x, B, x );
+
+      if( x[0] != 4.0 || x[1] != 5.0 || x[2] != 0.0 || x[3] != 9.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << x << "\n"
+             << "   Expected result:\n( 4 5 0 9 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Multiplication with invalid vector sizes
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix multiplication with invalid vector sizes";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 3UL, 6UL );
+      blaze::DynamicVector<double,blaze::columnVector> x( 3UL ), y( 3UL );
+
+      const blaze::BlockCompressedMatrix<double,3UL> B( A );
+
+      try {
+         multiply( y, B, x );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication with invalid vector sizes succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the BlockCompressedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "BlockCompressedMatrix swap";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> A( 3UL, 6UL );
+   A(0,0) = 1;
+   A(1,5) = 2;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> B( 9UL, 3UL );
+   B(8,0) = 3;
+
+   blaze::BlockCompressedMatrix<int,3UL> mat1( A );
+   blaze::BlockCompressedMatrix<int,3UL> mat2( B );
+
+   swap( mat1, mat2 );
+
+   checkRows   ( mat1, 9UL );
+   checkColumns( mat1, 3UL );
+   checkBlocks ( mat1, 1UL );
+
+   checkRows   ( mat2, 3UL );
+   checkColumns( mat2, 6UL );
+   checkBlocks ( mat2, 2UL );
+}
+//*************************************************************************************************
+
+} // namespace blockcompressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running BlockCompressedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_BLOCKCOMPRESSEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during BlockCompressedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
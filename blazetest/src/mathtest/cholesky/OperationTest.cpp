@@ -0,0 +1,354 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/cholesky/OperationTest.cpp
+//  \brief Source file for the Cholesky and LDLT decomposition operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/Cholesky.h>
+#include <blaze/math/DenseColumn.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blazetest/mathtest/cholesky/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace cholesky {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the Cholesky and LDLT decomposition operation test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   testLLT();
+   testLDLT();
+   testTriangularSolve();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the llt() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the Cholesky decomposition for several matrix sizes around
+// the panel size of the blocked decomposition. Additionally, it checks that an indefinite matrix
+// is rejected. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testLLT()
+{
+   const size_t sizes[] = { 0UL, 1UL, 2UL, 7UL, 63UL, 64UL, 65UL, 150UL };
+
+   for( size_t i=0UL; i<sizeof(sizes)/sizeof(size_t); ++i ) {
+      test_ = "Cholesky decomposition (row-major)";
+      testLLT<blaze::rowMajor>( sizes[i] );
+
+      test_ = "Cholesky decomposition (column-major)";
+      testLLT<blaze::columnMajor>( sizes[i] );
+   }
+
+   {
+      test_ = "Cholesky decomposition of an indefinite matrix";
+
+      blaze::SymmetricMatrix< blaze::DynamicMatrix<double,blaze::rowMajor> > A( 3UL );
+      A(0,0) =  2.0;
+      A(1,0) =  1.0;
+      A(1,1) = -1.0;
+      A(2,2) =  3.0;
+
+      blaze::LowerMatrix< blaze::DynamicMatrix<double,blaze::rowMajor> > L;
+
+      try {
+         blaze::llt( A, L );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Decomposition of an indefinite matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << L << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the ldlt() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the LDLT decomposition for several matrix sizes and for a
+// symmetric indefinite matrix. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void OperationTest::testLDLT()
+{
+   const size_t sizes[] = { 0UL, 1UL, 2UL, 7UL, 63UL, 64UL, 65UL, 150UL };
+
+   for( size_t i=0UL; i<sizeof(sizes)/sizeof(size_t); ++i ) {
+      test_ = "LDLT decomposition (row-major)";
+      testLDLT<blaze::rowMajor>( sizes[i] );
+
+      test_ = "LDLT decomposition (column-major)";
+      testLDLT<blaze::columnMajor>( sizes[i] );
+   }
+
+   {
+      test_ = "LDLT decomposition of an indefinite matrix";
+
+      blaze::SymmetricMatrix< blaze::DynamicMatrix<double,blaze::rowMajor> > A( 3UL );
+      A(0,0) =  4.0;
+      A(1,0) =  2.0;
+      A(1,1) = -1.0;
+      A(2,1) =  4.0;
+      A(2,2) =  2.0;
+
+      blaze::UniLowerMatrix< blaze::DynamicMatrix<double,blaze::rowMajor> > L;
+      blaze::DynamicVector<double,blaze::columnVector> d;
+
+      blaze::ldlt( A, L, d );
+
+      if( L(1,0) != 0.5 || L(2,0) != 0.0 || L(2,1) != -2.0 ||
+          d[0] != 4.0 || d[1] != -2.0 || d[2] != 10.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid LDLT factors\n"
+             << " Details:\n"
+             << "   Result L:\n" << L << "\n"
+             << "   Result d:\n" << d << "\n"
+             << "   Expected result L:\n(  1    0  0 )\n(  0.5  1  0 )\n(  0   -2  1 )\n"
+             << "   Expected result d:\n( 4 -2 10 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the triangular solve functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the solve() functions for all triangular adaptors with
+// both a single right-hand side vector and multiple right-hand sides. All values are integral
+// and all diagonal elements are 1 or 2 in order to guarantee exact results. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testTriangularSolve()
+{
+   const size_t n( 9UL );
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> M( n, n, 0.0 );
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<i; ++j ) {
+         M(i,j) = double( blaze::rand<int>( -3, 3 ) );
+      }
+   }
+
+   blaze::DynamicVector<double,blaze::columnVector> x( n );
+   blaze::DynamicMatrix<double,blaze::columnMajor> X( n, 2UL );
+   for( size_t i=0UL; i<n; ++i ) {
+      x[i]   = double( blaze::rand<int>( -5, 5 ) );
+      X(i,0) = double( blaze::rand<int>( -5, 5 ) );
+      X(i,1) = double( blaze::rand<int>( -5, 5 ) );
+   }
+
+   {
+      test_ = "Solve with a unilower matrix";
+
+      blaze::UniLowerMatrix< blaze::DynamicMatrix<double,blaze::rowMajor> > L( n );
+      for( size_t i=0UL; i<n; ++i )
+         for( size_t j=0UL; j<i; ++j )
+            L(i,j) = M(i,j);
+
+      blaze::DynamicVector<double,blaze::columnVector> b( L * x );
+      blaze::DynamicMatrix<double,blaze::columnMajor> B( L * X );
+
+      blaze::solve( L, b );
+      blaze::solve( L, B );
+
+      if( b != x || B != X ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid solution\n"
+             << " Details:\n"
+             << "   Result:\n" << b << "\n" << B << "\n"
+             << "   Expected result:\n" << x << "\n" << X << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Solve with a lower matrix";
+
+      blaze::LowerMatrix< blaze::DynamicMatrix<double,blaze::columnMajor> > L( n );
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=0UL; j<i; ++j )
+            L(i,j) = M(i,j);
+         L(i,i) = ( i % 2UL == 0UL )?( 2.0 ):( 1.0 );
+      }
+
+      blaze::DynamicVector<double,blaze::columnVector> b( L * x );
+      blaze::DynamicMatrix<double,blaze::columnMajor> B( L * X );
+
+      blaze::solve( L, b );
+      blaze::solve( L, B );
+
+      if( b != x || B != X ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid solution\n"
+             << " Details:\n"
+             << "   Result:\n" << b << "\n" << B << "\n"
+             << "   Expected result:\n" << x << "\n" << X << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Solve with a uniupper matrix";
+
+      blaze::UniUpperMatrix< blaze::DynamicMatrix<double,blaze::rowMajor> > U( n );
+      for( size_t i=0UL; i<n; ++i )
+         for( size_t j=0UL; j<i; ++j )
+            U(j,i) = M(i,j);
+
+      blaze::DynamicVector<double,blaze::columnVector> b( U * x );
+      blaze::DynamicMatrix<double,blaze::columnMajor> B( U * X );
+
+      blaze::solve( U, b );
+      blaze::solve( U, B );
+
+      if( b != x || B != X ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid solution\n"
+             << " Details:\n"
+             << "   Result:\n" << b << "\n" << B << "\n"
+             << "   Expected result:\n" << x << "\n" << X << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Solve with an upper matrix";
+
+      blaze::UpperMatrix< blaze::DynamicMatrix<double,blaze::rowMajor> > U( n );
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=0UL; j<i; ++j )
+            U(j,i) = M(i,j);
+         U(i,i) = ( i % 2UL == 0UL )?( 2.0 ):( 1.0 );
+      }
+
+      blaze::DynamicVector<double,blaze::columnVector> b( U * x );
+      blaze::DynamicMatrix<double,blaze::columnMajor> B( U * X );
+
+      blaze::solve( U, b );
+      blaze::solve( U, B );
+
+      if( b != x || B != X ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid solution\n"
+             << " Details:\n"
+             << "   Result:\n" << b << "\n" << B << "\n"
+             << "   Expected result:\n" << x << "\n" << X << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace cholesky
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running Cholesky operation test..." << std::endl;
+
+   try
+   {
+      RUN_CHOLESKY_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during Cholesky operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
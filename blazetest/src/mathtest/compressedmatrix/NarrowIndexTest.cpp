@@ -0,0 +1,384 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/compressedmatrix/NarrowIndexTest.cpp
+//  \brief Source file for the compressed sparse index type test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+// All compressed types of this test store their indices as 16-bit values
+#define BLAZE_SPARSE_INDEX_TYPE unsigned short
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blazetest/mathtest/compressedmatrix/NarrowIndexTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the compressed sparse index type test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+NarrowIndexTest::NarrowIndexTest()
+{
+   testVector();
+   testMatrix();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedVector class template with a narrow sparse index type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests a compressed vector of the largest size representable by the sparse
+// index type and checks that larger sizes are rejected by the constructor and the resize()
+// function. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void NarrowIndexTest::testVector()
+{
+   const size_t N( 65536UL );
+
+   //=====================================================================================
+   // Largest representable size
+   //=====================================================================================
+
+   {
+      test_ = "CompressedVector of maximum size";
+
+      SV vec( N, 3UL );
+      vec[0UL]     = 1.0;
+      vec[1000UL]  = 2.0;
+      vec[N-1UL]   = 3.0;
+
+      DV dense( N, 1.0 );
+      dense[N-1UL] = 4.0;
+
+      if( vec.size() != N || vec.nonZeros() != 3UL ||
+          vec.find( N-1UL ) == vec.end() || vec.find( N-1UL )->index() != N-1UL ||
+          ( trans( vec ) * dense ) != 15.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid compressed vector\n"
+             << " Details:\n"
+             << "   Size: " << vec.size() << "\n"
+             << "   Number of non-zeros: " << vec.nonZeros() << "\n"
+             << "   Last non-zero element: " << ( vec.end()-1 )->index() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Exceeding sizes
+   //=====================================================================================
+
+   {
+      test_ = "CompressedVector constructor with an exceeding size";
+
+      try {
+         SV vec( N+1UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction of an exceeding compressed vector succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         SV vec( DV( N+1UL, 1.0 ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Conversion of an exceeding dense vector succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "CompressedVector::resize() with an exceeding size";
+
+      SV vec( 10UL );
+      vec[9UL] = 1.0;
+
+      try {
+         vec.resize( N+1UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing to an exceeding size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( vec.size() != 10UL || vec.nonZeros() != 1UL || vec[9UL] != 1.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed resize operation modified the vector\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedMatrix class template with a narrow sparse index type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests row-major and column-major compressed matrices with the largest number
+// of columns and rows, respectively, representable by the sparse index type. Additionally it
+// checks that larger dimensions are rejected by the constructors, the assignment and the
+// resize() function. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void NarrowIndexTest::testMatrix()
+{
+   const size_t N( 65536UL );
+
+   //=====================================================================================
+   // Largest representable dimensions
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompressedMatrix of maximum size";
+
+      SM mat( 3UL, N, 4UL );
+      mat(0,0)     = 1.0;
+      mat(0,N-1UL) = 2.0;
+      mat(2,1000)  = 3.0;
+      mat(2,N-1UL) = 4.0;
+
+      DV x( N, 1.0 );
+      x[N-1UL] = 2.0;
+
+      const OSM tmat( trans( mat ) );
+      const DV y( mat * x );
+      const DV z( trans( tmat ) * x );
+
+      if( mat.nonZeros() != 4UL || tmat.nonZeros() != 4UL || ( mat.end(2UL)-1 )->index() != N-1UL ||
+          y[0] != 5.0 || y[1] != 0.0 || y[2] != 11.0 || y != z ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid compressed matrix\n"
+             << " Details:\n"
+             << "   Number of non-zeros: " << mat.nonZeros() << "\n"
+             << "   Result of the multiplication:\n" << y << "\n"
+             << "   Result of the transpose multiplication:\n" << z << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompressedMatrix of maximum size";
+
+      OSM mat( N, 2UL );
+      mat(N-1UL,0) = 2.0;
+      mat(7,1)     = 3.0;
+
+      const SM tmat( trans( mat ) );
+
+      if( ( mat.end(0UL)-1 )->index() != N-1UL || tmat(0,N-1UL) != 2.0 || tmat(1,7) != 3.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid compressed matrix\n"
+             << " Details:\n"
+             << "   Number of non-zeros: " << mat.nonZeros() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Exceeding dimensions
+   //=====================================================================================
+
+   {
+      test_ = "CompressedMatrix constructors with exceeding dimensions";
+
+      // The number of rows of a row-major matrix is not limited by the index type
+      SM mat( N+1UL, 1UL );
+
+      try {
+         SM mat2( 1UL, N+1UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction of an exceeding row-major compressed matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         OSM mat2( N+1UL, 1UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction of an exceeding column-major compressed matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         OSM mat2( mat );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Conversion to an exceeding column-major compressed matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "CompressedMatrix assignment with exceeding dimensions";
+
+      SM mat( 2UL, 2UL );
+      mat(1,1) = 1.0;
+
+      try {
+         mat = DM( 1UL, N+1UL, 1.0 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of an exceeding dense matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "CompressedMatrix::resize() with exceeding dimensions";
+
+      SM  mat ( 2UL, 2UL );
+      OSM omat( 2UL, 2UL );
+      mat (1,1) = 1.0;
+      omat(1,1) = 1.0;
+
+      try {
+         mat.resize( 2UL, N+1UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing a row-major matrix to an exceeding size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         omat.resize( N+1UL, 2UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing a column-major matrix to an exceeding size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( mat.rows() != 2UL || mat.columns() != 2UL || mat(1,1) != 1.0 ||
+          omat.rows() != 2UL || omat.columns() != 2UL || omat(1,1) != 1.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed resize operation modified the matrix\n"
+             << " Details:\n"
+             << "   Row-major result:\n" << mat << "\n"
+             << "   Column-major result:\n" << omat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace compressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running compressed sparse index type test..." << std::endl;
+
+   try
+   {
+      RUN_COMPRESSEDMATRIX_NARROWINDEX_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during compressed sparse index type test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
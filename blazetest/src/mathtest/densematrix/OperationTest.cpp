@@ -37,9 +37,13 @@
 // Includes
 //*************************************************************************************************
 
+#include <cmath>
 #include <cstdlib>
 #include <iostream>
 #include <blaze/math/dense/DenseMatrix.h>
+#include <blaze/math/DenseColumn.h>
+#include <blaze/math/DenseRow.h>
+#include <blaze/math/DenseSubmatrix.h>
 #include <blaze/math/DiagonalMatrix.h>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/LowerMatrix.h>
@@ -83,6 +87,9 @@ OperationTest::OperationTest()
    testIsIdentity();
    testMinimum();
    testMaximum();
+   testSum();
+   testMap();
+   testMatrixChain();
 }
 //*************************************************************************************************
 
@@ -13199,6 +13206,428 @@ void OperationTest::testMaximum()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the \c sum() function for dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c sum() function for dense matrices. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testSum()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major sum()";
+
+      // Summation of an empty matrix
+      {
+         blaze::DynamicMatrix<int,blaze::rowMajor> mat( 0UL, 3UL );
+
+         const int total = sum( mat );
+
+         if( total != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Summation of empty matrix failed\n"
+                << " Details:\n"
+                << "   Result: " << total << "\n"
+                << "   Expected result: 0\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Summation of a small matrix
+      {
+         blaze::DynamicMatrix<int,blaze::rowMajor> mat( 2UL, 3UL, 0 );
+         mat(0,0) =  1;
+         mat(0,1) = -2;
+         mat(0,2) =  3;
+         mat(1,0) = -4;
+         mat(1,1) =  5;
+         mat(1,2) = -6;
+
+         const int total = sum( mat );
+
+         if( total != -3 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: First summation failed\n"
+                << " Details:\n"
+                << "   Result: " << total << "\n"
+                << "   Expected result: -3\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Summation of a large matrix with long rows
+      {
+         blaze::DynamicMatrix<double,blaze::rowMajor> mat( 7UL, 2051UL );
+         for( size_t i=0UL; i<mat.rows(); ++i ) {
+            for( size_t j=0UL; j<mat.columns(); ++j ) {
+               mat(i,j) = static_cast<double>( ( i + j ) % 4UL );
+            }
+         }
+
+         const double total = sum( mat );
+         const double total2( sum( trans( mat ) ) );
+
+         if( total != 21536.0 || total2 != 21536.0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Second summation failed\n"
+                << " Details:\n"
+                << "   Result: " << total << " " << total2 << "\n"
+                << "   Expected result: 21536 21536\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major sum()";
+
+      // Summation of an empty matrix
+      {
+         blaze::DynamicMatrix<int,blaze::columnMajor> mat( 3UL, 0UL );
+
+         const int total = sum( mat );
+
+         if( total != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Summation of empty matrix failed\n"
+                << " Details:\n"
+                << "   Result: " << total << "\n"
+                << "   Expected result: 0\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Summation of a small matrix
+      {
+         blaze::DynamicMatrix<int,blaze::columnMajor> mat( 3UL, 2UL, 0 );
+         mat(0,0) =  1;
+         mat(0,1) = -2;
+         mat(1,0) =  3;
+         mat(1,1) = -4;
+         mat(2,0) =  5;
+         mat(2,1) = -6;
+
+         const int total = sum( mat );
+
+         if( total != -3 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: First summation failed\n"
+                << " Details:\n"
+                << "   Result: " << total << "\n"
+                << "   Expected result: -3\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Summation of a large matrix with long columns
+      {
+         blaze::DynamicMatrix<float,blaze::columnMajor> mat( 2051UL, 7UL );
+         for( size_t j=0UL; j<mat.columns(); ++j ) {
+            for( size_t i=0UL; i<mat.rows(); ++i ) {
+               mat(i,j) = static_cast<float>( ( i + j ) % 4UL );
+            }
+         }
+
+         const float total = sum( mat );
+
+         if( total != 21536.0F ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Second summation failed\n"
+                << " Details:\n"
+                << "   Result: " << total << "\n"
+                << "   Expected result: 21536\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Test of the element-wise \c map() functions for dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c sqrt(), \c exp(), \c log(), \c sin(), \c cos(),
+// and \c pow() functions for dense matrices, including rows, columns, and submatrices of the
+// resulting expressions. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void OperationTest::testMap()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major map()";
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> A( 13UL, 37UL ), B;
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            A(i,j) = 0.1 + 0.05*i + 0.01*j;
+         }
+      }
+
+      B = exp( A ) + 2.0 * pow( A, 1.5 ) - log( A ) + sin( A ) - cos( A );
+
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            const double a( A(i,j) );
+            const double ref( std::exp( a ) + 2.0 * std::pow( a, 1.5 ) - std::log( a ) + std::sin( a ) - std::cos( a ) );
+            if( std::fabs( B(i,j) - ref ) > 1E-12 * std::max( 1.0, std::fabs( ref ) ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Element-wise map operation failed\n"
+                   << " Details:\n"
+                   << "   Index: (" << i << "," << j << ")\n"
+                   << "   Result: " << B(i,j) << "\n"
+                   << "   Expected result: " << ref << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> S( submatrix( sqrt( A ), 2UL, 3UL, 5UL, 7UL ) );
+      const blaze::DynamicVector<double,blaze::rowVector> r( row( sqrt( A ), 4UL ) );
+      const blaze::DynamicVector<double,blaze::columnVector> c( column( sqrt( A ), 5UL ) );
+
+      if( S(1,2) != std::sqrt( A(3,5) ) || r[5] != std::sqrt( A(4,5) ) || c[4] != std::sqrt( A(4,5) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: View on a map operation failed\n"
+             << " Details:\n"
+             << "   Result: " << S(1,2) << " " << r[5] << " " << c[4] << "\n"
+             << "   Expected result: " << std::sqrt( A(3,5) ) << " " << std::sqrt( A(4,5) ) << " " << std::sqrt( A(4,5) ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major map()";
+
+      blaze::DynamicMatrix<float,blaze::columnMajor> A( 37UL, 13UL ), B;
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         for( size_t i=0UL; i<A.rows(); ++i ) {
+            A(i,j) = 0.1F + 0.01F*i + 0.05F*j;
+         }
+      }
+
+      B = exp( A ) + sqrt( A );
+
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         for( size_t i=0UL; i<A.rows(); ++i ) {
+            const float ref( std::exp( A(i,j) ) + std::sqrt( A(i,j) ) );
+            if( std::fabs( B(i,j) - ref ) > 1E-5F * std::fabs( ref ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Element-wise map operation failed\n"
+                   << " Details:\n"
+                   << "   Index: (" << i << "," << j << ")\n"
+                   << "   Result: " << B(i,j) << "\n"
+                   << "   Expected result: " << ref << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Test of the reassociation of dense matrix multiplication chains.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the assignment, addition assignment, and subtraction
+// assignment of matrix chains of the form \f$ A*B*C \f$ and \f$ A*(B*C) \f$, whose evaluation
+// order depends on the dimensions of the operands. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testMatrixChain()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major matrix chain";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> A( 60UL, 3UL ), B( 3UL, 60UL ), C( 60UL, 2UL );
+      blaze::DynamicMatrix<int,blaze::rowMajor> D, ref( 60UL, 2UL, 0 );
+
+      for( size_t i=0UL; i<60UL; ++i ) {
+         for( size_t j=0UL; j<3UL; ++j ) {
+            A(i,j) = int( ( i + 2UL*j ) % 5UL ) - 2;
+            B(j,i) = int( ( 3UL*i + j ) % 7UL ) - 3;
+         }
+         C(i,0UL) = int( i % 3UL ) - 1;
+         C(i,1UL) = int( i % 4UL );
+      }
+
+      for( size_t i=0UL; i<60UL; ++i )
+         for( size_t j=0UL; j<2UL; ++j )
+            for( size_t k=0UL; k<60UL; ++k )
+               for( size_t l=0UL; l<3UL; ++l )
+                  ref(i,j) += A(i,l) * B(l,k) * C(k,j);
+
+      D = A * B * C;
+      if( D != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of a left-associated matrix chain failed\n"
+             << " Details:\n"
+             << "   Result:\n" << D << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      D = A * ( B * C );
+      if( D != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of a right-associated matrix chain failed\n"
+             << " Details:\n"
+             << "   Result:\n" << D << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      D += A * B * C;
+      if( D != 2*ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment of a matrix chain failed\n"
+             << " Details:\n"
+             << "   Result:\n" << D << "\n"
+             << "   Expected result:\n" << 2*ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      D -= A * B * C;
+      if( D != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment of a matrix chain failed\n"
+             << " Details:\n"
+             << "   Result:\n" << D << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> E( trans( C ) * trans( B ) * trans( A ) );
+      if( E != trans( ref ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of a transpose matrix chain failed\n"
+             << " Details:\n"
+             << "   Result:\n" << E << "\n"
+             << "   Expected result:\n" << trans( ref ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major matrix chain";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> A( 2UL, 60UL ), C( 3UL, 60UL );
+      blaze::DynamicMatrix<int,blaze::rowMajor> B( 60UL, 3UL );
+      blaze::DynamicMatrix<int,blaze::columnMajor> D, ref( 2UL, 60UL, 0 );
+
+      for( size_t i=0UL; i<60UL; ++i ) {
+         for( size_t j=0UL; j<3UL; ++j ) {
+            B(i,j) = int( ( i + 2UL*j ) % 5UL ) - 2;
+            C(j,i) = int( ( 3UL*i + j ) % 7UL ) - 3;
+         }
+         A(0UL,i) = int( i % 3UL ) - 1;
+         A(1UL,i) = int( i % 4UL );
+      }
+
+      for( size_t i=0UL; i<2UL; ++i )
+         for( size_t j=0UL; j<60UL; ++j )
+            for( size_t k=0UL; k<60UL; ++k )
+               for( size_t l=0UL; l<3UL; ++l )
+                  ref(i,j) += A(i,k) * B(k,l) * C(l,j);
+
+      D = A * ( B * C );
+      if( D != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of a right-associated matrix chain failed\n"
+             << " Details:\n"
+             << "   Result:\n" << D << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      D = A * B * C;
+      if( D != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of a left-associated matrix chain failed\n"
+             << " Details:\n"
+             << "   Result:\n" << D << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      D += A * ( B * C );
+      if( D != 2*ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment of a matrix chain failed\n"
+             << " Details:\n"
+             << "   Result:\n" << D << "\n"
+             << "   Expected result:\n" << 2*ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      D -= A * ( B * C );
+      if( D != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment of a matrix chain failed\n"
+             << " Details:\n"
+             << "   Result:\n" << D << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 } // namespace densematrix
 
 } // namespace mathtest
@@ -77,6 +77,7 @@ UnalignedTest::UnalignedTest()
    testIsDefault();
    testIsSame();
    testSubvector();
+   testNestedViews();
 }
 //*************************************************************************************************
 
@@ -2270,6 +2271,90 @@ void UnalignedTest::testSubvector()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of unaligned subvectors of nested dense views.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the vectorized loads and stores of unaligned subvectors of
+// a row of a submatrix. Since such a subvector does not refer to a raw pointer, the final,
+// partial intrinsic element has to be handled element-wise. The test is performed for all
+// subvector sizes up to 13, which covers all possible sizes of the final intrinsic element.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void UnalignedTest::testNestedViews()
+{
+   typedef blaze::DynamicMatrix<int,blaze::rowMajor>  MT;
+   typedef blaze::DenseSubmatrix<MT>                  SMT;
+   typedef blaze::DenseRow<SMT>                       RT;
+   typedef blaze::DenseSubvector<RT>                  NSVT;
+
+   test_ = "Subvector of a row of a submatrix";
+
+   MT mat( 16UL, 16UL );
+   for( size_t i=0UL; i<16UL; ++i ) {
+      for( size_t j=0UL; j<16UL; ++j ) {
+         mat(i,j) = static_cast<int>( 16UL*i + j );
+      }
+   }
+
+   const MT ref( mat );
+
+   for( size_t n=1UL; n<14UL; ++n )
+   {
+      SMT  sm = submatrix( mat, 1UL, 1UL, 15UL, 15UL );
+      RT   r  = row( sm, 2UL );
+      NSVT sv = subvector( r, 0UL, n );
+
+      const VT vec( sv );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         if( vec[k] != ref(3UL,1UL+k) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Load of nested subvector failed\n"
+                << " Details:\n"
+                << "   Size: " << n << "\n"
+                << "   Result:\n" << vec << "\n"
+                << "   Expected element " << k << ": " << ref(3UL,1UL+k) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      sv += vec;
+
+      for( size_t j=0UL; j<16UL; ++j ) {
+         const int expected( ( j >= 1UL && j < 1UL+n )?( 2*ref(3UL,j) ):( ref(3UL,j) ) );
+         if( mat(3UL,j) != expected ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Store to nested subvector failed\n"
+                << " Details:\n"
+                << "   Size: " << n << "\n"
+                << "   Result:\n" << row( mat, 3UL ) << "\n"
+                << "   Expected element " << j << ": " << expected << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      sv = vec;
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment to nested subvector failed\n"
+             << " Details:\n"
+             << "   Size: " << n << "\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
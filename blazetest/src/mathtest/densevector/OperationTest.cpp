@@ -37,10 +37,13 @@
 // Includes
 //*************************************************************************************************
 
+#include <cmath>
 #include <cstdlib>
 #include <iostream>
 #include <blaze/math/dense/DenseVector.h>
+#include <blaze/math/DenseSubvector.h>
 #include <blaze/math/DynamicVector.h>
+#include <blaze/math/Functors.h>
 #include <blazetest/mathtest/densevector/OperationTest.h>
 
 
@@ -68,6 +71,11 @@ OperationTest::OperationTest()
    testNormalize();
    testMinimum();
    testMaximum();
+   testSum();
+   testNorms();
+   testDot();
+   testMap();
+   testMultiAssign();
 }
 //*************************************************************************************************
 
@@ -490,6 +498,446 @@ void OperationTest::testMaximum()
 }
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*!\brief Test of the \c sum() function for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c sum() function for dense vectors. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testSum()
+{
+   test_ = "sum() function";
+
+   {
+      blaze::DynamicVector<int,blaze::rowVector> vec;
+
+      const int total = sum( vec );
+
+      if( total != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Summation of empty vector failed\n"
+             << " Details:\n"
+             << "   Result: " << total << "\n"
+             << "   Expected result: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::DynamicVector<int,blaze::rowVector> vec( 4UL );
+      vec[0] =  1;
+      vec[1] = -2;
+      vec[2] =  3;
+      vec[3] = -4;
+
+      const int total = sum( vec );
+
+      if( total != -2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: First summation failed\n"
+             << " Details:\n"
+             << "   Result: " << total << "\n"
+             << "   Expected result: -2\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::DynamicVector<double,blaze::columnVector> vec( 10007UL );
+      for( size_t i=0UL; i<vec.size(); ++i ) {
+         vec[i] = static_cast<double>( i % 10UL );
+      }
+
+      const double total = sum( vec );
+
+      if( total != 45021.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Second summation failed\n"
+             << " Details:\n"
+             << "   Result: " << total << "\n"
+             << "   Expected result: 45021\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const double total2 = sum( vec + vec );
+
+      if( total2 != 90042.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Summation of vector expression failed\n"
+             << " Details:\n"
+             << "   Result: " << total2 << "\n"
+             << "   Expected result: 90042\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c norm1() and \c normInf() functions for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c norm1() and \c normInf() functions for dense vectors.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testNorms()
+{
+   test_ = "norm1() and normInf() functions";
+
+   {
+      blaze::DynamicVector<double,blaze::rowVector> vec( 4UL );
+      vec[0] =  1.0;
+      vec[1] = -2.0;
+      vec[2] =  3.0;
+      vec[3] = -4.0;
+
+      const double n1  ( norm1( vec ) );
+      const double ninf( normInf( vec ) );
+
+      if( n1 != 10.0 || ninf != 4.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: First norm computation failed\n"
+             << " Details:\n"
+             << "   Result: " << n1 << " " << ninf << "\n"
+             << "   Expected result: 10 4\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::DynamicVector<float,blaze::columnVector> vec( 5003UL );
+      for( size_t i=0UL; i<vec.size(); ++i ) {
+         vec[i] = ( i % 2UL )?( -1.0F ):( 2.0F );
+      }
+      vec[4711] = -7.0F;
+
+      const float n1  ( norm1( vec ) );
+      const float ninf( normInf( vec ) );
+
+      if( n1 != 7511.0F || ninf != 7.0F ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Second norm computation failed\n"
+             << " Details:\n"
+             << "   Result: " << n1 << " " << ninf << "\n"
+             << "   Expected result: 7511 7\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c dot() function for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c dot() function and the inner product operator for
+// dense vectors. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testDot()
+{
+   test_ = "dot() function";
+
+   {
+      blaze::DynamicVector<int,blaze::columnVector> a( 4UL ), b( 4UL );
+      a[0] = 1; a[1] = 2; a[2] =  3; a[3] = 4;
+      b[0] = 2; b[1] = 1; b[2] = -1; b[3] = 3;
+
+      const int res1( dot( a, b ) );
+      const int res2( trans( a ) * b );
+
+      if( res1 != 13 || res2 != 13 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: First inner product failed\n"
+             << " Details:\n"
+             << "   Result: " << res1 << " " << res2 << "\n"
+             << "   Expected result: 13 13\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::DynamicVector<double,blaze::rowVector> a( 10000UL ), b( 10000UL, 2.0 );
+      for( size_t i=0UL; i<a.size(); ++i ) {
+         a[i] = static_cast<double>( i % 5UL );
+      }
+
+      const double res1( dot( a, b ) );
+      const double res2( a * trans( b ) );
+
+      if( res1 != 40000.0 || res2 != 40000.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Second inner product failed\n"
+             << " Details:\n"
+             << "   Result: " << res1 << " " << res2 << "\n"
+             << "   Expected result: 40000 40000\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   try {
+      blaze::DynamicVector<double,blaze::columnVector> a( 3UL ), b( 4UL );
+      dot( a, b );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Inner product of vectors with different sizes succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Test of the element-wise \c map() functions for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c map() function and of the \c sqrt(), \c exp(),
+// \c log(), \c sin(), \c cos(), \c pow(), \c min(), and \c max() functions for dense vectors.
+// The vectorized results are compared to the results of the according scalar functions. The
+// sine and cosine are additionally tested for arguments up to and beyond the limit of the
+// vectorized argument reduction, which has to hold with and without fused multiply-add
+// operations. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testMap()
+{
+   test_ = "map() function";
+
+   const size_t N( 1003UL );
+
+   blaze::DynamicVector<double,blaze::columnVector> a( N ), b( N ), c;
+   for( size_t i=0UL; i<N; ++i ) {
+      a[i] = 0.01 + 0.013*i;
+      b[i] = std::sin( static_cast<double>( i ) );
+   }
+
+   {
+      c = sqrt( a ) + exp( b ) * log( a );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         const double ref( std::sqrt( a[i] ) + std::exp( b[i] ) * std::log( a[i] ) );
+         if( std::fabs( c[i] - ref ) > 1E-12 * std::max( 1.0, std::fabs( ref ) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: sqrt(), exp() and log() failed\n"
+                << " Details:\n"
+                << "   Index: " << i << "\n"
+                << "   Result: " << c[i] << "\n"
+                << "   Expected result: " << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      c = 2.0 * sin( a ) - cos( a + b );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         const double ref( 2.0 * std::sin( a[i] ) - std::cos( a[i] + b[i] ) );
+         if( std::fabs( c[i] - ref ) > 1E-12 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: sin() and cos() failed\n"
+                << " Details:\n"
+                << "   Index: " << i << "\n"
+                << "   Result: " << c[i] << "\n"
+                << "   Expected result: " << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      // Arguments up to the limit of the vectorized argument reduction, interspersed with
+      // arguments beyond it that have to be evaluated by the scalar fallback
+      blaze::DynamicVector<double,blaze::columnVector> x( N ), y;
+      blaze::DynamicVector<float,blaze::columnVector> xf( N ), yf;
+      for( size_t i=0UL; i<N; ++i ) {
+         x[i]  = ( i % 2UL ? 1.0 : -1.0 ) * 67108864.0 * ( ( i * 389UL ) % N ) / N;
+         xf[i] = ( i % 2UL ? 1.0F : -1.0F ) * 8192.0F * ( ( i * 389UL ) % N ) / N;
+      }
+      x[500UL]  = 9.99723001E11;
+      x[501UL]  = -1.0E300;
+      xf[500UL] = 744462.7F;
+      xf[501UL] = -3.0E38F;
+
+      y  = sin( x ) - cos( x );
+      yf = sin( xf ) - cos( xf );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         const double ref( std::sin( x[i] ) - std::cos( x[i] ) );
+         const float  reff( std::sin( xf[i] ) - std::cos( xf[i] ) );
+         if( std::fabs( y[i] - ref ) > 1E-14 || std::fabs( yf[i] - reff ) > 1E-6F ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: sin() and cos() of large arguments failed\n"
+                << " Details:\n"
+                << "   Index: " << i << "\n"
+                << "   Double precision argument: " << x[i] << "\n"
+                << "   Double precision result: " << y[i] << "\n"
+                << "   Expected double precision result: " << ref << "\n"
+                << "   Single precision argument: " << xf[i] << "\n"
+                << "   Single precision result: " << yf[i] << "\n"
+                << "   Expected single precision result: " << reff << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      c = pow( a, 2.5 ) + pow( a, b );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         const double ref( std::pow( a[i], 2.5 ) + std::pow( a[i], b[i] ) );
+         if( std::fabs( c[i] - ref ) > 1E-12 * std::max( 1.0, std::fabs( ref ) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: pow() failed\n"
+                << " Details:\n"
+                << "   Index: " << i << "\n"
+                << "   Result: " << c[i] << "\n"
+                << "   Expected result: " << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      c = min( a, b ) - max( a, 2.0*b );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         const double ref( std::min( a[i], b[i] ) - std::max( a[i], 2.0*b[i] ) );
+         if( c[i] != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: min() and max() failed\n"
+                << " Details:\n"
+                << "   Index: " << i << "\n"
+                << "   Result: " << c[i] << "\n"
+                << "   Expected result: " << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      blaze::DynamicVector<double,blaze::columnVector> d( subvector( map( a, blaze::Sqrt() ), 7UL, 100UL ) );
+
+      for( size_t i=0UL; i<d.size(); ++i ) {
+         if( d[i] != std::sqrt( a[i+7UL] ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Subvector of a map operation failed\n"
+                << " Details:\n"
+                << "   Index: " << i << "\n"
+                << "   Result: " << d[i] << "\n"
+                << "   Expected result: " << std::sqrt( a[i+7UL] ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   try {
+      blaze::DynamicVector<double,blaze::columnVector> x( 3UL ), y( 4UL );
+      x = min( x, y );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Map operation on vectors with different sizes succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Test of the \c multiAssign() functions for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the fused evaluation of dense vector updates via the
+// \c multiAssign() functions. The results are compared to the results of the according
+// sequence of (compound) assignments. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void OperationTest::testMultiAssign()
+{
+   test_ = "multiAssign() function";
+
+   const size_t N( 1003UL );
+
+   blaze::DynamicVector<double,blaze::columnVector> x( N ), r( N ), d( N ), h( N );
+   for( size_t i=0UL; i<N; ++i ) {
+      x[i] = static_cast<double>( i % 7UL );
+      r[i] = static_cast<double>( i % 5UL ) - 2.0;
+      d[i] = static_cast<double>( i % 3UL ) + 1.0;
+      h[i] = static_cast<double>( i % 11UL ) * 0.5;
+   }
+
+   blaze::DynamicVector<double,blaze::columnVector> x2( x ), r2( r ), d2( d ), h2( h );
+
+   multiAssign( addAssignTo( x, 0.25 * d ), subAssignTo( r, 0.25 * h ) );
+   x2 += 0.25 * d2;
+   r2 -= 0.25 * h2;
+
+   if( x != x2 || r != r2 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Fused evaluation of two updates failed\n"
+          << " Details:\n"
+          << "   Result:\n" << x << "\n" << r << "\n"
+          << "   Expected result:\n" << x2 << "\n" << r2 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   multiAssign( assignTo( d, 2.0 * d - r ), addAssignTo( x, d ), multAssignTo( h, d ), assignTo( r, r + x ) );
+   d2 = 2.0 * d2 - r2;
+   x2 += d2;
+   h2 *= d2;
+   r2 = r2 + x2;
+
+   if( d != d2 || x != x2 || h != h2 || r != r2 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Fused evaluation of four updates failed\n"
+          << " Details:\n"
+          << "   Result:\n" << d << "\n" << x << "\n" << h << "\n" << r << "\n"
+          << "   Expected result:\n" << d2 << "\n" << x2 << "\n" << h2 << "\n" << r2 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      blaze::DynamicVector<double,blaze::columnVector> y( N+1UL );
+      multiAssign( addAssignTo( x, d ), addAssignTo( y, y ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Multi-assignment to vectors with different sizes succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
 } // namespace densevector
 
 } // namespace mathtest
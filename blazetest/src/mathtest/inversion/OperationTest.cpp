@@ -0,0 +1,299 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/inversion/OperationTest.cpp
+//  \brief Source file for the small matrix inversion operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/HybridMatrix.h>
+#include <blaze/math/Inversion.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blazetest/mathtest/inversion/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace inversion {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the small matrix inversion operation test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   testInv();
+   testDet();
+   testSolve();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the inv() and invert() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the inversion of static and hybrid matrices of all sizes
+// covered by the closed-form and the Gauss-Jordan kernels. Additionally, it checks that singular
+// and non-square matrices are rejected. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void OperationTest::testInv()
+{
+   test_ = "Inversion (row-major)";
+   testInv<double,1UL,blaze::rowMajor>();
+   testInv<double,2UL,blaze::rowMajor>();
+   testInv<double,3UL,blaze::rowMajor>();
+   testInv<double,4UL,blaze::rowMajor>();
+   testInv<double,5UL,blaze::rowMajor>();
+   testInv<double,6UL,blaze::rowMajor>();
+   testInv<float ,3UL,blaze::rowMajor>();
+   testInv<float ,6UL,blaze::rowMajor>();
+
+   test_ = "Inversion (column-major)";
+   testInv<double,1UL,blaze::columnMajor>();
+   testInv<double,2UL,blaze::columnMajor>();
+   testInv<double,3UL,blaze::columnMajor>();
+   testInv<double,4UL,blaze::columnMajor>();
+   testInv<double,5UL,blaze::columnMajor>();
+   testInv<double,6UL,blaze::columnMajor>();
+   testInv<float ,3UL,blaze::columnMajor>();
+   testInv<float ,6UL,blaze::columnMajor>();
+
+   {
+      test_ = "Inversion of a singular matrix";
+
+      blaze::StaticMatrix<double,4UL,4UL,blaze::rowMajor> A;
+      for( size_t i=0UL; i<4UL; ++i ) {
+         A(i,0) = double( i+1UL );
+         A(i,1) = 2.0 * double( i+1UL );
+         A(i,2) = 1.0;
+         A(i,3) = double( i*i );
+      }
+
+      try {
+         const blaze::StaticMatrix<double,4UL,4UL,blaze::rowMajor> B( blaze::inv( A ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inversion of a singular matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Inversion of a non-square hybrid matrix";
+
+      blaze::HybridMatrix<double,4UL,4UL,blaze::rowMajor> A( 2UL, 3UL, 1.0 );
+
+      try {
+         blaze::invert( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inversion of a non-square matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the det() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the determinant of integral matrices with known determinants,
+// including a matrix that requires row interchanges. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testDet()
+{
+   {
+      test_ = "Determinant of a 3x3 matrix";
+
+      blaze::StaticMatrix<double,3UL,3UL,blaze::rowMajor> A;
+      A(0,0) = 2.0; A(0,1) = -1.0; A(0,2) = 0.0;
+      A(1,0) = 1.0; A(1,1) =  3.0; A(1,2) = 4.0;
+      A(2,0) = 0.0; A(2,1) =  5.0; A(2,2) = 1.0;
+
+      const double d( blaze::det( A ) );
+
+      if( d != -33.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid determinant\n"
+             << " Details:\n"
+             << "   Result: " << d << "\n"
+             << "   Expected result: -33\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Determinant of a 5x5 permutation matrix";
+
+      blaze::StaticMatrix<double,5UL,5UL,blaze::columnMajor> A( 0.0 );
+      A(0,1) = 2.0;
+      A(1,0) = 3.0;
+      A(2,3) = 1.0;
+      A(3,4) = 1.0;
+      A(4,2) = 1.0;
+
+      const double d( blaze::det( A ) );
+
+      if( std::fabs( d + 6.0 ) > 1E-14 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid determinant\n"
+             << " Details:\n"
+             << "   Result: " << d << "\n"
+             << "   Expected result: -6\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Determinant of a 6x6 hybrid matrix";
+
+      blaze::HybridMatrix<double,6UL,6UL,blaze::rowMajor> A( 6UL, 6UL, 0.0 );
+      for( size_t i=0UL; i<6UL; ++i ) {
+         A(i,i) = double( i+1UL );
+         if( i > 0UL ) A(i,i-1UL) = 7.0;
+      }
+
+      const double d( blaze::det( A ) );
+
+      if( std::fabs( d - 720.0 ) > 1E-11 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid determinant\n"
+             << " Details:\n"
+             << "   Result: " << d << "\n"
+             << "   Expected result: 720\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the solve() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the solution of linear systems with static matrices of
+// several sizes. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testSolve()
+{
+   test_ = "Solve (row-major)";
+   testSolve<double,2UL,blaze::rowMajor>();
+   testSolve<double,3UL,blaze::rowMajor>();
+   testSolve<double,6UL,blaze::rowMajor>();
+   testSolve<float ,4UL,blaze::rowMajor>();
+
+   test_ = "Solve (column-major)";
+   testSolve<double,2UL,blaze::columnMajor>();
+   testSolve<double,3UL,blaze::columnMajor>();
+   testSolve<double,6UL,blaze::columnMajor>();
+   testSolve<float ,4UL,blaze::columnMajor>();
+}
+//*************************************************************************************************
+
+} // namespace inversion
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running inversion operation test..." << std::endl;
+
+   try
+   {
+      RUN_INVERSION_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during inversion operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
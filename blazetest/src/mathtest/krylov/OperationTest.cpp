@@ -0,0 +1,989 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/krylov/OperationTest.cpp
+//  \brief Source file for the Krylov subspace solver operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/solvers/BiCGSTAB.h>
+#include <blaze/math/solvers/BlockJacobiPreconditioner.h>
+#include <blaze/math/solvers/CG.h>
+#include <blaze/math/solvers/GMRES.h>
+#include <blaze/math/solvers/ICPreconditioner.h>
+#include <blaze/math/solvers/JacobiPreconditioner.h>
+#include <blaze/math/solvers/MINRES.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/krylov/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace krylov {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the Krylov subspace solver operation test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   testCG();
+   testBlockJacobi();
+   testIncompleteCholesky();
+   testBiCGSTAB();
+   testGMRES();
+   testMINRES();
+   testIterationLimit();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the CG solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves a symmetric positive definite linear system of equations without a
+// preconditioner and with the Jacobi, the block Jacobi and the IC(0) preconditioner, and checks
+// that the preconditioners reduce the number of iterations. Additionally, it tests the solver
+// with a deactivated symmetry check. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void OperationTest::testCG()
+{
+   const blaze::CMatMxN A( createNodal( 20UL ) );
+   const blaze::VecN ref( createReference( A.rows() ) );
+   const blaze::VecN b( -( A * ref ) );
+
+   blaze::VecN x;
+   size_t plain( 0UL ), blockJacobi( 0UL ), ic( 0UL );
+
+   {
+      test_ = "CG solution of a symmetric positive definite system";
+
+      blaze::CG solver;
+      solver.setMaxIterations( 10000UL );
+      solver.setThreshold( 1E-10 );
+
+      const bool converged( solver.solve( A, b, x ) );
+      checkSolution( converged, solver, A, b, x, ref );
+
+      plain = solver.getLastIterations();
+   }
+
+   {
+      test_ = "Jacobi preconditioned CG solution of a symmetric positive definite system";
+
+      blaze::CG solver;
+      blaze::JacobiPreconditioner jacobi;
+      solver.setPreconditioner( &jacobi );
+      solver.setMaxIterations( 10000UL );
+      solver.setThreshold( 1E-10 );
+
+      const bool converged( solver.solve( A, b, x ) );
+      checkSolution( converged, solver, A, b, x, ref );
+   }
+
+   {
+      test_ = "Block Jacobi preconditioned CG solution of a symmetric positive definite system";
+
+      blaze::CG solver;
+      blaze::BlockJacobiPreconditioner jacobi;
+      solver.setPreconditioner( &jacobi );
+      solver.setMaxIterations( 10000UL );
+      solver.setThreshold( 1E-10 );
+
+      const bool converged( solver.solve( A, b, x ) );
+      checkSolution( converged, solver, A, b, x, ref );
+
+      blockJacobi = solver.getLastIterations();
+   }
+
+   {
+      test_ = "IC(0) preconditioned CG solution of a symmetric positive definite system";
+
+      blaze::CG solver;
+      blaze::ICPreconditioner cholesky;
+      solver.setPreconditioner( &cholesky );
+      solver.setMaxIterations( 10000UL );
+      solver.setThreshold( 1E-10 );
+
+      const bool converged( solver.solve( A, b, x ) );
+      checkSolution( converged, solver, A, b, x, ref );
+
+      ic = solver.getLastIterations();
+
+      // Solving the system a second time with the same helper data
+      const bool reconverged( solver.solve( A, b, x ) );
+      checkSolution( reconverged, solver, A, b, x, ref );
+   }
+
+   {
+      test_ = "Effectiveness of the CG preconditioners";
+
+      if( ic >= blockJacobi || blockJacobi >= plain ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Preconditioner did not reduce the number of iterations\n"
+             << " Details:\n"
+             << "   Iterations without preconditioner          : " << plain << "\n"
+             << "   Iterations with block Jacobi preconditioner: " << blockJacobi << "\n"
+             << "   Iterations with IC(0) preconditioner       : " << ic << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CG solution without symmetry check";
+
+      blaze::CG solver;
+      solver.setSymmetryCheck( false );
+      solver.setMaxIterations( 10000UL );
+      solver.setThreshold( 1E-10 );
+
+      if( solver.getSymmetryCheck() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Deactivating the symmetry check failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const bool converged( solver.solve( A, b, x ) );
+      checkSolution( converged, solver, A, b, x, ref );
+
+      if( solver.getLastIterations() != plain ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Symmetry check changed the solution process\n"
+             << " Details:\n"
+             << "   Iterations with symmetry check   : " << plain << "\n"
+             << "   Iterations without symmetry check: " << solver.getLastIterations() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CG solution of a non-symmetric system";
+
+      const blaze::CMatMxN N( createNonSymmetric( 4UL ) );
+      const blaze::VecN c( N.rows(), 1.0 );
+
+      blaze::CG solver;
+      solver.setMaxIterations( 5UL );
+
+      try {
+         solver.solve( N, c, x );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solution of a non-symmetric system succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      // Without symmetry check the system matrix is used as it is
+      solver.setSymmetryCheck( false );
+      solver.solve( N, c, x );
+
+      if( x.size() != N.rows() || solver.getLastIterations() > solver.getMaxIterations() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid solution process without symmetry check\n"
+             << " Details:\n"
+             << "   Iterations    : " << solver.getLastIterations() << "\n"
+             << "   Max iterations: " << solver.getMaxIterations() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the block Jacobi preconditioner.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the block Jacobi preconditioner applies the exact inverses of the
+// non-symmetric 3x3 diagonal blocks and of the trailing diagonal elements of a system matrix,
+// independent of the elements outside of the diagonal blocks. Additionally, it checks that
+// singular diagonal blocks are rejected. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void OperationTest::testBlockJacobi()
+{
+   const size_t n( 14UL );
+
+   // Setting up the diagonal blocks and the trailing diagonal elements
+   blaze::CMatMxN D( n, n ), A( n, n );
+   D.reserve( 3UL*n );
+   A.reserve( 5UL*n );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const size_t first( ( i < 12UL )?( i - i%3UL ):( i ) );
+      const size_t last ( ( i < 12UL )?( first+3UL ):( i+1UL ) );
+
+      if( i >= 3UL && i == first )
+         A.append( i, i-3UL, -0.5 );
+
+      for( size_t j=first; j<last; ++j ) {
+         const double value( ( i == j )?( 4.0 + 0.25*double( i ) )
+                                       :( 0.5*double( ( 3UL*i + 2UL*j ) % 5UL ) - 1.0 ) );
+         D.append( i, j, value );
+         A.append( i, j, value );
+      }
+
+      if( i+4UL < n && i+1UL == last )
+         A.append( i, i+4UL, 0.75 );
+
+      D.finalize( i );
+      A.finalize( i );
+   }
+
+   {
+      test_ = "Block Jacobi preconditioner with non-symmetric 3x3 blocks";
+
+      blaze::BlockJacobiPreconditioner jacobi;
+      jacobi.setup( A );
+
+      const blaze::VecN r( createReference( n ) );
+      blaze::VecN z;
+      jacobi.apply( r, z );
+
+      const double error( blaze::max( blaze::abs( D * z - r ) ) );
+
+      if( error > 1E-12 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid inverse of the diagonal blocks\n"
+             << " Details:\n"
+             << "   Error: " << error << "\n"
+             << "   Diagonal blocks:\n" << D << "\n"
+             << "   Preconditioned residual:\n" << z << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Block Jacobi preconditioner with a singular 3x3 block";
+
+      blaze::CMatMxN S( D );
+      S(3,3) = 0.0; S(3,4) = 0.0; S(3,5) = 0.0;
+
+      blaze::BlockJacobiPreconditioner jacobi;
+
+      try {
+         jacobi.setup( S );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup for a singular diagonal block succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Block Jacobi preconditioner with a zero trailing diagonal element";
+
+      blaze::CMatMxN S( D );
+      S(13,13) = 0.0;
+
+      blaze::BlockJacobiPreconditioner jacobi;
+
+      try {
+         jacobi.setup( S );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup for a zero diagonal element succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the IC(0) preconditioner.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the IC(0) preconditioner is exact for a tridiagonal matrix, that a
+// breakdown of the incomplete factorization of a symmetric positive definite matrix is resolved
+// by a diagonal shift and that matrices that are not positive definite are rejected. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testIncompleteCholesky()
+{
+   {
+      test_ = "IC(0) preconditioner for a tridiagonal matrix";
+
+      const size_t n( 50UL );
+
+      blaze::CMatMxN T( n, n );
+      T.reserve( 3UL*n );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         if( i > 0UL )    T.append( i, i-1UL, -1.0 );
+         T.append( i, i, 2.0 + 0.1*double( i % 3UL ) );
+         if( i+1UL < n )  T.append( i, i+1UL, -1.0 );
+         T.finalize( i );
+      }
+
+      blaze::ICPreconditioner cholesky;
+      cholesky.setup( T );
+
+      const blaze::VecN r( createReference( n ) );
+      blaze::VecN z;
+      cholesky.apply( r, z );
+
+      const double error( blaze::max( blaze::abs( T * z - r ) ) );
+
+      if( cholesky.getShift() != 0.0 || error > 1E-12 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid incomplete Cholesky factorization\n"
+             << " Details:\n"
+             << "   Shift: " << cholesky.getShift() << "\n"
+             << "   Error: " << error << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "IC(0) preconditioner with a breakdown of the factorization";
+
+      // Symmetric positive definite matrix with a negative IC(0) pivot (Kershaw, 1978)
+      const double values[4][4] = { {  3.0, -2.0,  0.0,  2.0 },
+                                    { -2.0,  3.0, -2.0,  0.0 },
+                                    {  0.0, -2.0,  3.0, -2.0 },
+                                    {  2.0,  0.0, -2.0,  3.0 } };
+
+      blaze::CMatMxN K( 4UL, 4UL, 12UL );
+      for( size_t i=0UL; i<4UL; ++i ) {
+         for( size_t j=0UL; j<4UL; ++j ) {
+            if( values[i][j] != 0.0 )
+               K.append( i, j, values[i][j] );
+         }
+         K.finalize( i );
+      }
+
+      const blaze::VecN ref( createReference( 4UL ) );
+      const blaze::VecN b( -( K * ref ) );
+
+      blaze::CG solver;
+      blaze::ICPreconditioner cholesky;
+      solver.setPreconditioner( &cholesky );
+      solver.setThreshold( 1E-10 );
+
+      blaze::VecN x;
+
+      const bool converged( solver.solve( K, b, x ) );
+      checkSolution( converged, solver, K, b, x, ref );
+
+      if( !( cholesky.getShift() > 0.0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Breakdown of the factorization not detected\n"
+             << " Details:\n"
+             << "   Shift: " << cholesky.getShift() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Resetting the shift for a matrix without breakdown
+      cholesky.setup( createNodal( 4UL ) );
+
+      if( cholesky.getShift() != 0.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Shift of a previous factorization was not reset\n"
+             << " Details:\n"
+             << "   Shift: " << cholesky.getShift() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "IC(0) preconditioner for an indefinite matrix";
+
+      blaze::ICPreconditioner cholesky;
+
+      try {
+         cholesky.setup( createIndefinite( 10UL ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup for an indefinite matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BiCGSTAB solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves a non-symmetric linear system of equations with and without a Jacobi
+// preconditioner. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testBiCGSTAB()
+{
+   const blaze::CMatMxN A( createNonSymmetric( 12UL ) );
+   const blaze::VecN ref( createReference( A.rows() ) );
+   const blaze::VecN b( -( A * ref ) );
+
+   blaze::VecN x;
+
+   {
+      test_ = "BiCGSTAB solution of a non-symmetric system";
+
+      blaze::BiCGSTAB solver;
+      solver.setThreshold( 1E-10 );
+
+      const bool converged( solver.solve( A, b, x ) );
+      checkSolution( converged, solver, A, b, x, ref );
+   }
+
+   {
+      test_ = "Preconditioned BiCGSTAB solution of a non-symmetric system";
+
+      blaze::BiCGSTAB solver;
+      blaze::JacobiPreconditioner jacobi;
+      solver.setPreconditioner( &jacobi );
+      solver.setThreshold( 1E-10 );
+
+      const bool converged( solver.solve( A, b, x ) );
+      checkSolution( converged, solver, A, b, x, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the GMRES solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves a non-symmetric linear system of equations within a single cycle, with
+// several restarts and with a Jacobi preconditioner. Additionally, it checks that a restart
+// length of zero is rejected. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void OperationTest::testGMRES()
+{
+   const blaze::CMatMxN A( createNonSymmetric( 12UL ) );
+   const blaze::VecN ref( createReference( A.rows() ) );
+   const blaze::VecN b( -( A * ref ) );
+
+   blaze::VecN x;
+
+   {
+      test_ = "GMRES solution of a non-symmetric system within a single cycle";
+
+      blaze::GMRES solver( A.rows() );
+      solver.setThreshold( 1E-10 );
+
+      const bool converged( solver.solve( A, b, x ) );
+      checkSolution( converged, solver, A, b, x, ref );
+   }
+
+   {
+      test_ = "Restarted GMRES solution of a non-symmetric system";
+
+      blaze::GMRES solver;
+      solver.setRestart( 5UL );
+      solver.setThreshold( 1E-10 );
+
+      const bool converged( solver.solve( A, b, x ) );
+      checkSolution( converged, solver, A, b, x, ref );
+
+      if( solver.getLastIterations() <= solver.getRestart() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solution without restart\n"
+             << " Details:\n"
+             << "   Restart length: " << solver.getRestart() << "\n"
+             << "   Iterations    : " << solver.getLastIterations() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Solving the system a second time with the same helper data
+      const bool reconverged( solver.solve( A, b, x ) );
+      checkSolution( reconverged, solver, A, b, x, ref );
+   }
+
+   {
+      test_ = "Preconditioned GMRES solution of a non-symmetric system";
+
+      blaze::GMRES solver( 10UL );
+      blaze::JacobiPreconditioner jacobi;
+      solver.setPreconditioner( &jacobi );
+      solver.setThreshold( 1E-10 );
+
+      const bool converged( solver.solve( A, b, x ) );
+      checkSolution( converged, solver, A, b, x, ref );
+   }
+
+   {
+      test_ = "GMRES with an invalid restart length";
+
+      blaze::GMRES solver;
+
+      try {
+         solver.setRestart( 0UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting a restart length of zero succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the MINRES solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves a symmetric indefinite linear system of equations. Additionally, it
+// checks that a non-symmetric system matrix is rejected. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testMINRES()
+{
+   {
+      test_ = "MINRES solution of a symmetric indefinite system";
+
+      const blaze::CMatMxN A( createIndefinite( 200UL ) );
+      const blaze::VecN ref( createReference( A.rows() ) );
+      const blaze::VecN b( -( A * ref ) );
+
+      blaze::MINRES solver;
+      solver.setThreshold( 1E-10 );
+
+      blaze::VecN x;
+
+      const bool converged( solver.solve( A, b, x ) );
+      checkSolution( converged, solver, A, b, x, ref );
+   }
+
+   {
+      test_ = "MINRES solution of a non-symmetric system";
+
+      const blaze::CMatMxN A( createNonSymmetric( 4UL ) );
+      const blaze::VecN b( A.rows(), 1.0 );
+
+      blaze::MINRES solver;
+      blaze::VecN x;
+
+      try {
+         solver.solve( A, b, x );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solution of a non-symmetric system succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the iteration limit of all solvers.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that all solvers report a failure in case the maximum number of
+// iterations is too small to reach the threshold. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testIterationLimit()
+{
+   const blaze::CMatMxN A( createNonSymmetric( 12UL ) );
+   const blaze::CMatMxN S( createIndefinite( 200UL ) );
+   const blaze::VecN ref( createReference( A.rows() ) );
+   const blaze::VecN b( -( A * ref ) );
+   const blaze::VecN c( -( S * createReference( S.rows() ) ) );
+
+   blaze::VecN x;
+
+   {
+      test_ = "BiCGSTAB with an insufficient number of iterations";
+
+      blaze::BiCGSTAB solver;
+      solver.setMaxIterations( 3UL );
+      solver.setThreshold( 1E-10 );
+
+      const bool converged( solver.solve( A, b, x ) );
+      checkFailure( converged, solver );
+   }
+
+   {
+      test_ = "GMRES with an insufficient number of iterations";
+
+      blaze::GMRES solver( 5UL );
+      solver.setMaxIterations( 12UL );
+      solver.setThreshold( 1E-10 );
+
+      const bool converged( solver.solve( A, b, x ) );
+      checkFailure( converged, solver );
+   }
+
+   {
+      test_ = "MINRES with an insufficient number of iterations";
+
+      blaze::MINRES solver;
+      solver.setMaxIterations( 3UL );
+      solver.setThreshold( 1E-10 );
+
+      const bool converged( solver.solve( S, c, x ) );
+      checkFailure( converged, solver );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the solution of a linear system of equations.
+//
+// \param converged The result of the solution process.
+// \param solver The solver used for the solution process.
+// \param A The system matrix.
+// \param b The right-hand side vector.
+// \param x The computed solution.
+// \param ref The reference solution.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the solver reports convergence, that the residual \f$ A x + b \f$
+// is below the threshold of the solver and that the solution matches the reference solution.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::checkSolution( bool converged, const blaze::Solver& solver, const blaze::CMatMxN& A,
+                                   const blaze::VecN& b, const blaze::VecN& x, const blaze::VecN& ref ) const
+{
+   const double residual( blaze::max( blaze::abs( A * x + b ) ) );
+   const double error( blaze::max( blaze::abs( x - ref ) ) );
+
+   if( !converged || residual >= solver.getThreshold() || error > 1E-8 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid solution\n"
+          << " Details:\n"
+          << "   System size   : " << A.rows() << "\n"
+          << "   Converged     : " << converged << "\n"
+          << "   Iterations    : " << solver.getLastIterations() << "\n"
+          << "   Precision     : " << solver.getLastPrecision() << "\n"
+          << "   Residual      : " << residual << "\n"
+          << "   Threshold     : " << solver.getThreshold() << "\n"
+          << "   Solution error: " << error << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking an unsuccessful solution process.
+//
+// \param converged The result of the solution process.
+// \param solver The solver used for the solution process.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the solver reports a failure after spending the maximum number
+// of iterations. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::checkFailure( bool converged, const blaze::Solver& solver ) const
+{
+   if( converged || solver.getLastIterations() != solver.getMaxIterations() ||
+       solver.getLastPrecision() < solver.getThreshold() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of an unsuccessful solution process\n"
+          << " Details:\n"
+          << "   Converged     : " << converged << "\n"
+          << "   Iterations    : " << solver.getLastIterations() << "\n"
+          << "   Max iterations: " << solver.getMaxIterations() << "\n"
+          << "   Precision     : " << solver.getLastPrecision() << "\n"
+          << "   Threshold     : " << solver.getThreshold() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creation of a symmetric positive definite matrix with three unknowns per node.
+//
+// \param k The number of grid points per dimension.
+// \return The \f$ 3k^2 \times 3k^2 \f$ system matrix.
+//
+// This function creates the five-point discretization of a two-dimensional diffusion operator
+// on a \f$ k \times k \f$ grid, where each grid point carries three strongly coupled unknowns.
+// The 3x3 blocks are multiples of a fixed symmetric positive definite coupling matrix, scaled
+// by diffusion coefficients that vary by two orders of magnitude. A small mass term renders the
+// matrix positive definite.
+*/
+blaze::CMatMxN OperationTest::createNodal( size_t k )
+{
+   const double S[3][3] = { { 4.0, 1.8, 0.8 },
+                            { 1.8, 1.0, 0.3 },
+                            { 0.8, 0.3, 0.5 } };
+
+   const size_t nodes( k*k );
+
+   blaze::CMatMxN A( 3UL*nodes, 3UL*nodes );
+   A.reserve( 45UL*nodes );
+
+   for( size_t i=0UL; i<k; ++i ) {
+      for( size_t j=0UL; j<k; ++j )
+      {
+         const size_t node( i*k+j );
+
+         // Neighboring nodes in ascending order (the node itself is marked by a zero coefficient)
+         size_t neighbors[5];
+         double coefficients[5];
+         size_t count( 0UL );
+         double sum( 0.0 );
+
+         const bool exists[5] = { i > 0UL, j > 0UL, true, j+1UL < k, i+1UL < k };
+         const size_t indices[5] = { node-k, node-1UL, node, node+1UL, node+k };
+
+         for( size_t e=0UL; e<5UL; ++e ) {
+            if( !exists[e] ) continue;
+            const size_t lower( std::min( node, indices[e] ) );
+            const size_t upper( std::max( node, indices[e] ) );
+            neighbors[count] = indices[e];
+            coefficients[count] = ( e == 2UL )?( 0.0 ):( 1.0 + 9.9*double( ( 7UL*lower + 13UL*upper ) % 11UL ) );
+            sum += coefficients[count];
+            ++count;
+         }
+
+         for( size_t a=0UL; a<3UL; ++a )
+         {
+            const size_t row( 3UL*node+a );
+
+            for( size_t e=0UL; e<count; ++e ) {
+               for( size_t c=0UL; c<3UL; ++c ) {
+                  if( neighbors[e] == node )
+                     A.append( row, 3UL*node+c, sum*S[a][c] + ( ( a == c )?( 0.01 ):( 0.0 ) ) );
+                  else
+                     A.append( row, 3UL*neighbors[e]+c, -coefficients[e]*S[a][c] );
+               }
+            }
+
+            A.finalize( row );
+         }
+      }
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creation of a non-symmetric convection-diffusion matrix.
+//
+// \param k The number of grid points per dimension.
+// \return The \f$ k^2 \times k^2 \f$ system matrix.
+//
+// This function creates the five-point discretization of a two-dimensional convection-diffusion
+// operator on a \f$ k \times k \f$ grid. The convection renders the matrix non-symmetric, the
+// varying diagonal gives the Jacobi preconditioner something to do.
+*/
+blaze::CMatMxN OperationTest::createNonSymmetric( size_t k )
+{
+   const size_t n( k*k );
+
+   blaze::CMatMxN A( n, n );
+   A.reserve( 5UL*n );
+
+   for( size_t i=0UL; i<k; ++i ) {
+      for( size_t j=0UL; j<k; ++j )
+      {
+         const size_t row( i*k+j );
+
+         if( i > 0UL )    A.append( row, row-k  , -1.4 );
+         if( j > 0UL )    A.append( row, row-1UL, -1.4 );
+         A.append( row, row, 4.0 + 0.5*double( row % 5UL ) );
+         if( j+1UL < k )  A.append( row, row+1UL, -0.6 );
+         if( i+1UL < k )  A.append( row, row+k  , -0.6 );
+
+         A.finalize( row );
+      }
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creation of a symmetric indefinite matrix.
+//
+// \param n The number of rows and columns of the matrix.
+// \return The symmetric indefinite matrix.
+//
+// This function creates a symmetric pentadiagonal matrix with alternating diagonal elements
+// \f$ \pm 5 \f$. Due to the Gershgorin circle theorem the eigenvalues lie in the intervals
+// \f$ [-9,-1] \f$ and \f$ [1,9] \f$, i.e. the matrix is indefinite, but well-conditioned.
+*/
+blaze::CMatMxN OperationTest::createIndefinite( size_t n )
+{
+   blaze::CMatMxN A( n, n );
+   A.reserve( 5UL*n );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      if( i > 1UL )     A.append( i, i-2UL, 1.5 );
+      if( i > 0UL )     A.append( i, i-1UL, 0.5 );
+      A.append( i, i, ( i % 2UL == 0UL )?( 5.0 ):( -5.0 ) );
+      if( i+1UL < n )   A.append( i, i+1UL, 0.5 );
+      if( i+2UL < n )   A.append( i, i+2UL, 1.5 );
+
+      A.finalize( i );
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creation of a random reference solution.
+//
+// \param n The size of the reference solution.
+// \return The random reference solution.
+*/
+blaze::VecN OperationTest::createReference( size_t n )
+{
+   blaze::VecN x( n );
+   for( size_t i=0UL; i<n; ++i ) {
+      x[i] = blaze::rand<double>( -1.0, 1.0 );
+   }
+
+   return x;
+}
+//*************************************************************************************************
+
+} // namespace krylov
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running Krylov operation test..." << std::endl;
+
+   try
+   {
+      RUN_KRYLOV_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during Krylov operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,534 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/lu/OperationTest.cpp
+//  \brief Source file for the LU decomposition operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DenseColumn.h>
+#include <blaze/math/DenseRow.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/solvers/LUDecomposition.h>
+#include <blazetest/mathtest/lu/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace lu {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the LU decomposition operation test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   testFactorize();
+   testSolveVector();
+   testSolveMatrix();
+   testPivoting();
+   testSingular();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the factorize() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the LU decomposition of dense and sparse matrices for several
+// matrix sizes around the panel size of the blocked decomposition. Additionally, it checks that
+// a non-square matrix is rejected. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void OperationTest::testFactorize()
+{
+   const size_t sizes[] = { 0UL, 1UL, 2UL, 7UL, 63UL, 64UL, 65UL, 150UL };
+
+   for( size_t i=0UL; i<sizeof(sizes)/sizeof(size_t); ++i )
+   {
+      const blaze::MatMxN A( createMatrix( sizes[i] ) );
+      blaze::LUDecomposition lu;
+
+      test_ = "LU decomposition of a dense matrix";
+      lu.factorize( A );
+      testFactorize( lu, A );
+
+      test_ = "LU decomposition of a sparse matrix";
+      blaze::CMatMxN S( A.rows(), A.columns() );
+      for( size_t j=0UL; j<A.rows(); ++j ) {
+         S(j,A.rows()-j-1UL) = A(j,A.rows()-j-1UL);
+         if( j % 3UL != 0UL )
+            S(j,j) = A(j,j);
+      }
+      lu.factorize( S );
+      testFactorize( lu, blaze::MatMxN( S ) );
+   }
+
+   {
+      test_ = "LU decomposition of a non-square matrix";
+
+      blaze::LUDecomposition lu;
+
+      try {
+         lu.factorize( createMatrix( 3UL, 4UL ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Decomposition of a non-square dense matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << lu.getFactors() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         lu.factorize( blaze::CMatMxN( 4UL, 3UL ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Decomposition of a non-square sparse matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << lu.getFactors() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the factors of the given LU decomposition.
+//
+// \param lu The LU decomposition of the given matrix.
+// \param A The factorized matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function reassembles the unit lower factor \f$ L \f$ and the upper factor \f$ U \f$ from
+// the combined factors and checks the reconstruction \f$ L U = P A \f$. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testFactorize( const blaze::LUDecomposition& lu, const blaze::MatMxN& A )
+{
+   const size_t n( A.rows() );
+
+   if( lu.size() != n || lu.isSingular() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid decomposition state\n"
+          << " Details:\n"
+          << "   Size       : " << lu.size() << "\n"
+          << "   Singular   : " << lu.isSingular() << "\n"
+          << "   Matrix size: " << n << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   const blaze::MatMxN& LU( lu.getFactors() );
+   blaze::MatMxN L( n, n, 0.0 ), U( n, n, 0.0 ), PA( n, n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<i; ++j )
+         L(i,j) = LU(i,j);
+      L(i,i) = 1.0;
+      for( size_t j=i; j<n; ++j )
+         U(i,j) = LU(i,j);
+      row( PA, i ) = row( A, lu.getPivot( i ) );
+   }
+
+   checkError( blaze::MatMxN( L * U - PA ), n, "Invalid LU factors" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the solve() function for a single right-hand side vector.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the residual of the solution of a single system, both with distinct
+// and with aliased right-hand side and solution vectors. Additionally, it checks that a
+// right-hand side of invalid size is rejected. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testSolveVector()
+{
+   const size_t sizes[] = { 1UL, 2UL, 7UL, 63UL, 64UL, 65UL, 150UL };
+
+   for( size_t i=0UL; i<sizeof(sizes)/sizeof(size_t); ++i )
+   {
+      const size_t n( sizes[i] );
+      const blaze::MatMxN A( createMatrix( n ) );
+
+      blaze::LUDecomposition lu;
+      lu.factorize( A );
+
+      blaze::VecN b( n ), x;
+      for( size_t j=0UL; j<n; ++j ) {
+         b[j] = blaze::rand<double>( -1.0, 1.0 );
+      }
+
+      blaze::MatMxN r( n, 1UL );
+
+      test_ = "Solve with a single right-hand side";
+      lu.solve( b, x );
+      column( r, 0UL ) = A * x - b;
+      checkError( r, n, "Invalid solution" );
+
+      test_ = "Aliased solve with a single right-hand side";
+      x = b;
+      lu.solve( x, x );
+      column( r, 0UL ) = A * x - b;
+      checkError( r, n, "Invalid solution" );
+   }
+
+   {
+      test_ = "Solve with a right-hand side of invalid size";
+
+      blaze::LUDecomposition lu;
+      lu.factorize( createMatrix( 5UL ) );
+
+      blaze::VecN b( 4UL, 1.0 ), x;
+
+      try {
+         lu.solve( b, x );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solve with an invalid right-hand side succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the solve() function for multiple right-hand sides.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the residual of the solution of a system with multiple right-hand sides,
+// both with distinct and with aliased right-hand side and solution matrices. Additionally, it
+// checks that a right-hand side of invalid size is rejected. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testSolveMatrix()
+{
+   const size_t sizes[] = { 1UL, 2UL, 7UL, 63UL, 64UL, 65UL, 150UL };
+
+   for( size_t i=0UL; i<sizeof(sizes)/sizeof(size_t); ++i )
+   {
+      const size_t n( sizes[i] );
+      const blaze::MatMxN A( createMatrix( n ) );
+      const blaze::MatMxN B( createMatrix( n, 3UL ) );
+
+      blaze::LUDecomposition lu;
+      lu.factorize( A );
+
+      blaze::MatMxN X;
+
+      test_ = "Solve with multiple right-hand sides";
+      lu.solve( B, X );
+      checkError( blaze::MatMxN( A * X - B ), n, "Invalid solution" );
+
+      test_ = "Aliased solve with multiple right-hand sides";
+      X = B;
+      lu.solve( X, X );
+      checkError( blaze::MatMxN( A * X - B ), n, "Invalid solution" );
+   }
+
+   {
+      test_ = "Solve with right-hand sides of invalid size";
+
+      blaze::LUDecomposition lu;
+      lu.factorize( createMatrix( 5UL ) );
+
+      blaze::MatMxN X;
+
+      try {
+         lu.solve( createMatrix( 4UL, 2UL ), X );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solve with invalid right-hand sides succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << X << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the partial pivoting of the LU decomposition.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the row permutation for a matrix with a zero leading diagonal element
+// and for a matrix whose largest first column element lies in the last row. All values are
+// chosen such that the solutions are exact. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testPivoting()
+{
+   {
+      test_ = "LU decomposition of a matrix with a zero diagonal";
+
+      blaze::MatMxN A( 2UL, 2UL, 0.0 );
+      A(0,1) = 1.0;
+      A(1,0) = 2.0;
+
+      blaze::LUDecomposition lu;
+      lu.factorize( A );
+
+      blaze::VecN b( 2UL ), x;
+      b[0] = 3.0;
+      b[1] = 4.0;
+      lu.solve( b, x );
+
+      if( lu.isSingular() || lu.getPivot( 0UL ) != 1UL || lu.getPivot( 1UL ) != 0UL ||
+          x[0] != 2.0 || x[1] != 3.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid pivoting\n"
+             << " Details:\n"
+             << "   Singular: " << lu.isSingular() << "\n"
+             << "   Pivots  : " << lu.getPivot( 0UL ) << " " << lu.getPivot( 1UL ) << "\n"
+             << "   Result:\n" << x << "\n"
+             << "   Expected result:\n( 2 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      testFactorize( lu, A );
+   }
+
+   {
+      test_ = "LU decomposition of a matrix with a dominant last row";
+
+      blaze::MatMxN A( 3UL, 3UL );
+      A(0,0) = 1.0; A(0,1) = 2.0; A(0,2) =  3.0;
+      A(1,0) = 4.0; A(1,1) = 5.0; A(1,2) =  6.0;
+      A(2,0) = 8.0; A(2,1) = 8.0; A(2,2) = 10.0;
+
+      blaze::LUDecomposition lu;
+      lu.factorize( A );
+
+      if( lu.isSingular() || lu.getPivot( 0UL ) != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid pivoting\n"
+             << " Details:\n"
+             << "   Singular   : " << lu.isSingular() << "\n"
+             << "   First pivot: " << lu.getPivot( 0UL ) << "\n"
+             << "   Expected first pivot: 2\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      testFactorize( lu, A );
+
+      blaze::VecN x( 3UL ), b;
+      x[0] =  1.0;
+      x[1] = -2.0;
+      x[2] =  3.0;
+      b = A * x;
+      lu.solve( b, b );
+
+      blaze::MatMxN r( 3UL, 1UL );
+      column( r, 0UL ) = b - x;
+      checkError( r, 3UL, "Invalid solution" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the singularity detection of the LU decomposition.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that a rank-deficient matrix is detected as singular and that a consistent
+// system is nevertheless solved with a small residual. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testSingular()
+{
+   test_ = "LU decomposition of a singular matrix";
+
+   const size_t n( 70UL );
+
+   blaze::MatMxN A( createMatrix( n ) );
+   row( A, 5UL ) = row( A, 2UL ) * 2.0;
+   row( A, n-1UL ) = row( A, 2UL );
+
+   blaze::LUDecomposition lu;
+   lu.factorize( A );
+
+   if( !lu.isSingular() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Singular matrix not detected\n"
+          << " Details:\n"
+          << "   Matrix size: " << n << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::VecN x( n ), b;
+   for( size_t i=0UL; i<n; ++i ) {
+      x[i] = blaze::rand<double>( -1.0, 1.0 );
+   }
+   b = A * x;
+   lu.solve( b, x );
+
+   blaze::MatMxN r( n, 1UL );
+   column( r, 0UL ) = A * x - b;
+   checkError( r, n, "Invalid solution of a consistent singular system" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creation of a random, well-conditioned square matrix.
+//
+// \param n The number of rows and columns of the matrix.
+// \return The random matrix.
+//
+// The dominant elements of the matrix lie on the anti-diagonal, which guarantees that the
+// decomposition has to pivot.
+*/
+blaze::MatMxN OperationTest::createMatrix( size_t n )
+{
+   blaze::MatMxN A( createMatrix( n, n ) );
+   for( size_t i=0UL; i<n; ++i ) {
+      A(i,n-i-1UL) += double( n );
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creation of a random matrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return The random matrix.
+*/
+blaze::MatMxN OperationTest::createMatrix( size_t m, size_t n )
+{
+   blaze::MatMxN A( m, n );
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         A(i,j) = blaze::rand<double>( -1.0, 1.0 );
+      }
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+} // namespace lu
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running LU operation test..." << std::endl;
+
+   try
+   {
+      RUN_LU_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during LU operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
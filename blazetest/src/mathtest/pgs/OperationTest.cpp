@@ -0,0 +1,558 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/pgs/OperationTest.cpp
+//  \brief Source file for the PGS solver operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/problems/ContactLCP.h>
+#include <blaze/math/problems/LCP.h>
+#include <blaze/math/solvers/CPG.h>
+#include <blaze/math/solvers/PGS.h>
+#include <blaze/math/SparseSubmatrix.h>
+#include <blazetest/mathtest/pgs/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace pgs {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the PGS solver operation test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   testLCP();
+   testContactLCP();
+   testCPG();
+   testUpdate();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the solution of an LCP in all sweep modes.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves an LCP with a symmetric, strictly diagonally dominant system matrix in
+// all sweep modes. The problem is large enough to be solved in parallel in the parallel modes.
+// Since the solution of the LCP is unique, all modes are expected to compute the same solution.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testLCP()
+{
+   const blaze::PGS::Mode modes[] = { blaze::PGS::sequential, blaze::PGS::colored, blaze::PGS::blockJacobi };
+   const size_t k( 150UL );
+
+   std::vector<size_t> ids( k*k );
+   for( size_t i=0UL; i<ids.size(); ++i ) {
+      ids[i] = i;
+   }
+
+   blaze::VecN ref;
+
+   for( size_t m=0UL; m<sizeof(modes)/sizeof(blaze::PGS::Mode); ++m )
+   {
+      test_ = "Solution of an LCP (" + modeName( modes[m] ) + " mode)";
+
+      blaze::LCP lcp;
+      assemble( ids, k, lcp );
+
+      blaze::PGS solver;
+      solver.setMode( modes[m] );
+      solver.setThreshold( 1E-10 );
+
+      const bool converged( solver.solve( lcp ) );
+      checkSolution( converged, solver, lcp );
+
+      if( modes[m] == blaze::PGS::sequential ) {
+         ref = lcp.x_;
+         continue;
+      }
+
+      const double error( blaze::max( blaze::abs( lcp.x_ - ref ) ) );
+
+      if( !( error <= 1E-8 ) || ( modes[m] == blaze::PGS::colored && solver.getLastColors() < 2UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solution differs from the sequential solution\n"
+             << " Details:\n"
+             << "   Problem size: " << lcp.size() << "\n"
+             << "   Colors      : " << solver.getLastColors() << "\n"
+             << "   Error       : " << error << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the solution of a contact LCP in all sweep modes.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves a contact LCP with a symmetric, strictly block diagonally dominant system
+// matrix in all sweep modes. The problem is large enough to be solved in parallel in the parallel
+// modes. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testContactLCP()
+{
+   const blaze::PGS::Mode modes[] = { blaze::PGS::sequential, blaze::PGS::colored, blaze::PGS::blockJacobi };
+   const size_t k( 40UL );
+
+   std::vector<size_t> ids( k*k );
+   for( size_t i=0UL; i<ids.size(); ++i ) {
+      ids[i] = i;
+   }
+
+   for( size_t m=0UL; m<sizeof(modes)/sizeof(blaze::PGS::Mode); ++m )
+   {
+      test_ = "Solution of a contact LCP (" + modeName( modes[m] ) + " mode)";
+
+      blaze::ContactLCP lcp;
+      assemble( ids, k, lcp );
+
+      blaze::PGS solver;
+      solver.setMode( modes[m] );
+      solver.setThreshold( 1E-10 );
+
+      const bool converged( solver.solve( lcp ) );
+      checkSolution( converged, solver, lcp );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the solution of a contact LCP with the CPG solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves the contact LCP of the testContactLCP() test with the CPG solver, which
+// computes all products of the LCP matrix via its 3x3 block copy. The solution is compared to
+// the solution of the PGS solver. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void OperationTest::testCPG()
+{
+   test_ = "Solution of a contact LCP with the CPG solver";
+
+   const size_t k( 40UL );
+
+   std::vector<size_t> ids( k*k );
+   for( size_t i=0UL; i<ids.size(); ++i ) {
+      ids[i] = i;
+   }
+
+   blaze::ContactLCP ref;
+   assemble( ids, k, ref );
+
+   blaze::PGS pgs;
+   pgs.setThreshold( 1E-12 );
+   checkSolution( pgs.solve( ref ), pgs, ref );
+
+   blaze::ContactLCP lcp;
+   assemble( ids, k, lcp );
+
+   blaze::CPG solver;
+   solver.setThreshold( 1E-10 );
+
+   const bool converged( solver.solve( lcp ) );
+   const double residual( lcp.residual() );
+   const double error( blaze::max( blaze::abs( lcp.x_ - ref.x_ ) ) );
+
+   if( !converged || !( residual <= solver.getThreshold() ) || !( error <= 1E-8 ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid solution\n"
+          << " Details:\n"
+          << "   Problem size: " << lcp.size() << "\n"
+          << "   Converged   : " << converged << "\n"
+          << "   Iterations  : " << solver.getLastIterations() << "\n"
+          << "   Precision   : " << solver.getLastPrecision() << "\n"
+          << "   Residual    : " << residual << "\n"
+          << "   Error       : " << error << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the update() function in all sweep modes.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function updates LCPs and contact LCPs in all sweep modes, both after a solution process
+// (i.e. reusing the inverse diagonal, block matrix and coloring of the solver) and without a
+// previous solution process. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void OperationTest::testUpdate()
+{
+   const blaze::PGS::Mode modes[] = { blaze::PGS::sequential, blaze::PGS::colored, blaze::PGS::blockJacobi };
+
+   for( size_t m=0UL; m<sizeof(modes)/sizeof(blaze::PGS::Mode); ++m ) {
+      testUpdate<blaze::LCP>( "an LCP", 150UL, modes[m], true );
+      testUpdate<blaze::LCP>( "an LCP", 150UL, modes[m], false );
+      testUpdate<blaze::ContactLCP>( "a contact LCP", 40UL, modes[m], true );
+      testUpdate<blaze::ContactLCP>( "a contact LCP", 40UL, modes[m], false );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the coefficients of friction of an updated LCP.
+//
+// \param cp The updated LCP.
+// \param fresh The freshly assembled LCP.
+// \return void
+//
+// LCPs don't have coefficients of friction, i.e. there is nothing to check.
+*/
+void OperationTest::checkFriction( const blaze::LCP& /*cp*/, const blaze::LCP& /*fresh*/ ) const
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the coefficients of friction of an updated contact LCP.
+//
+// \param cp The updated contact LCP.
+// \param fresh The freshly assembled contact LCP.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void OperationTest::checkFriction( const blaze::ContactLCP& cp, const blaze::ContactLCP& fresh ) const
+{
+   if( cp.cof_ != fresh.cof_ ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid coefficients of friction\n"
+          << " Details:\n"
+          << "   Result:\n" << cp.cof_ << "\n"
+          << "   Expected result:\n" << fresh.cof_ << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Assembly of an LCP from the given unknowns of a grid.
+//
+// \param ids The grid indices of the unknowns of the LCP.
+// \param k The number of unknowns per dimension of the grid.
+// \param lcp The resulting LCP.
+// \return void
+//
+// The \a i-th unknown of the LCP corresponds to the grid index \a ids[i] and is coupled to all
+// of its neighbors that are contained in \a ids. All coefficients only depend on the grid indices,
+// i.e. a subset of the unknowns in any order results in the according part of the same problem.
+// All unknowns are initialized to zero.
+*/
+void OperationTest::assemble( const std::vector<size_t>& ids, size_t k, blaze::LCP& lcp )
+{
+   const size_t n( ids.size() );
+
+   std::vector<size_t> index( k*k, n );
+   for( size_t i=0UL; i<n; ++i ) {
+      index[ids[i]] = i;
+   }
+
+   blaze::CMatMxN A( n, n );
+   A.reserve( 5UL*n );
+
+   std::vector< std::pair<size_t,double> > elements;
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const size_t p( ids[i] );
+      const size_t neighbors[] = { p-k, p-1UL, p+1UL, p+k };
+      const bool   valid[]     = { p >= k, p%k != 0UL, (p+1UL)%k != 0UL, p+k < k*k };
+
+      elements.clear();
+      elements.push_back( std::make_pair( i, 5.0 + 0.5*coefficient( p, p, 0UL ) ) );
+
+      for( size_t l=0UL; l<4UL; ++l ) {
+         if( valid[l] && index[neighbors[l]] != n ) {
+            const size_t q( neighbors[l] );
+            elements.push_back( std::make_pair( index[q], -0.5 + 0.25*coefficient( std::min( p, q ), std::max( p, q ), 0UL ) ) );
+         }
+      }
+
+      std::sort( elements.begin(), elements.end() );
+
+      for( size_t l=0UL; l<elements.size(); ++l ) {
+         A.append( i, elements[l].first, elements[l].second );
+      }
+      A.finalize( i );
+   }
+
+   lcp.A_.swap( A );
+   lcp.b_.resize( n, false );
+   lcp.x_.resize( n, false );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      lcp.b_[i] = coefficient( ids[i], ids[i], 1UL );
+      lcp.x_[i] = 0.0;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assembly of a contact LCP from the given contacts of a grid.
+//
+// \param ids The grid indices of the contacts of the contact LCP.
+// \param k The number of contacts per dimension of the grid.
+// \param lcp The resulting contact LCP.
+// \return void
+//
+// The \a i-th contact of the contact LCP corresponds to the grid index \a ids[i] and is coupled
+// to all of its neighbors that are contained in \a ids. All coefficients only depend on the grid
+// indices, i.e. a subset of the contacts in any order results in the according part of the same
+// problem. All unknowns are initialized to zero.
+*/
+void OperationTest::assemble( const std::vector<size_t>& ids, size_t k, blaze::ContactLCP& lcp )
+{
+   const size_t n( ids.size() );
+
+   std::vector<size_t> index( k*k, n );
+   for( size_t i=0UL; i<n; ++i ) {
+      index[ids[i]] = i;
+   }
+
+   blaze::CMatMxN A( 3UL*n, 3UL*n );
+   A.reserve( 45UL*n );
+
+   std::vector< std::pair<size_t,double> > elements;
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const size_t p( ids[i] );
+      const size_t neighbors[] = { p-k, p-1UL, p+1UL, p+k };
+      const bool   valid[]     = { p >= k, p%k != 0UL, (p+1UL)%k != 0UL, p+k < k*k };
+
+      for( size_t r=0UL; r<3UL; ++r )
+      {
+         elements.clear();
+
+         for( size_t s=0UL; s<3UL; ++s ) {
+            const double value( ( r == s )?( 5.0 + 0.5*coefficient( p, p, r ) )
+                                          :( 0.25*coefficient( p, p, 3UL+r+s ) ) );
+            elements.push_back( std::make_pair( 3UL*i+s, value ) );
+         }
+
+         for( size_t l=0UL; l<4UL; ++l )
+         {
+            if( !valid[l] || index[neighbors[l]] == n ) continue;
+
+            const size_t q( neighbors[l] );
+
+            for( size_t s=0UL; s<3UL; ++s ) {
+               const double value( ( p < q )?( 0.25*coefficient( p, q, 3UL*r+s ) )
+                                            :( 0.25*coefficient( q, p, 3UL*s+r ) ) );
+               elements.push_back( std::make_pair( 3UL*index[q]+s, value ) );
+            }
+         }
+
+         std::sort( elements.begin(), elements.end() );
+
+         for( size_t l=0UL; l<elements.size(); ++l ) {
+            A.append( 3UL*i+r, elements[l].first, elements[l].second );
+         }
+         A.finalize( 3UL*i+r );
+      }
+   }
+
+   lcp.A_.swap( A );
+   lcp.b_.resize( 3UL*n, false );
+   lcp.x_.resize( 3UL*n, false );
+   lcp.cof_.resize( n, false );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t r=0UL; r<3UL; ++r ) {
+         lcp.b_[3UL*i+r] = coefficient( ids[i], ids[i], 7UL+r );
+         lcp.x_[3UL*i+r] = 0.0;
+      }
+      lcp.cof_[i] = 0.3 + 0.2*coefficient( ids[i], ids[i], 10UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the right-hand side of the appended unknowns of an updated LCP.
+//
+// \param cp The updated LCP.
+// \param fresh The freshly assembled LCP.
+// \param nrem The number of remaining unknowns.
+// \return void
+*/
+void OperationTest::setAppended( blaze::LCP& cp, const blaze::LCP& fresh, size_t nrem )
+{
+   for( size_t i=nrem; i<cp.size(); ++i ) {
+      cp.b_[i] = fresh.b_[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the right-hand side and the coefficients of friction of the appended contacts.
+//
+// \param cp The updated contact LCP.
+// \param fresh The freshly assembled contact LCP.
+// \param nrem The number of remaining unknowns.
+// \return void
+*/
+void OperationTest::setAppended( blaze::ContactLCP& cp, const blaze::ContactLCP& fresh, size_t nrem )
+{
+   for( size_t i=nrem; i<cp.size(); ++i ) {
+      cp.b_[i] = fresh.b_[i];
+   }
+
+   for( size_t i=nrem/3UL; i<cp.cof_.size(); ++i ) {
+      cp.cof_[i] = fresh.cof_[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a reproducible pseudo-random coefficient in the range \f$ [-1..1] \f$.
+//
+// \param p The first grid index.
+// \param q The second grid index.
+// \param c The index of the coefficient.
+// \return The coefficient.
+*/
+double OperationTest::coefficient( size_t p, size_t q, size_t c )
+{
+   const size_t hash( ( p * 73856093UL ) ^ ( q * 19349663UL ) ^ ( c * 83492791UL ) );
+   return double( hash % 2001UL ) / 1000.0 - 1.0;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the name of the given sweep mode.
+//
+// \param mode The sweep mode.
+// \return The name of the sweep mode.
+*/
+std::string OperationTest::modeName( blaze::PGS::Mode mode )
+{
+   switch( mode ) {
+      case blaze::PGS::sequential : return "sequential";
+      case blaze::PGS::colored    : return "colored";
+      case blaze::PGS::blockJacobi: return "block Jacobi";
+      default: return "unknown";
+   }
+}
+//*************************************************************************************************
+
+} // namespace pgs
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running PGS operation test..." << std::endl;
+
+   try
+   {
+      RUN_PGS_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during PGS operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
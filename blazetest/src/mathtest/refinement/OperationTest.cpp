@@ -0,0 +1,358 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/refinement/OperationTest.cpp
+//  \brief Source file for the mixed precision refinement operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DenseRow.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/solvers/MixedPrecisionRefinement.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/refinement/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace refinement {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the mixed precision refinement operation test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   testWellConditioned();
+   testIllConditioned();
+   testInvalidSystem();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the refinement of a well-conditioned system.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves well-conditioned dense and sparse systems of several sizes around the
+// panel size of the blocked factorization. The refinement is expected to reach full precision
+// with the single precision factors only. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void OperationTest::testWellConditioned()
+{
+   const size_t sizes[] = { 1UL, 7UL, 64UL, 65UL, 150UL };
+
+   for( size_t i=0UL; i<sizeof(sizes)/sizeof(size_t); ++i )
+   {
+      const size_t n( sizes[i] );
+      const blaze::MatMxN A( createMatrix( n ) );
+      const blaze::VecN ref( createReference( n ) );
+      const blaze::VecN b( -( A * ref ) );
+
+      blaze::MixedPrecisionRefinement solver;
+      solver.setThreshold( 1E-10 );
+
+      blaze::VecN x;
+
+      test_ = "Refinement of a well-conditioned dense system";
+      const bool converged( solver.solve( A, b, x ) );
+      checkSolution( converged, solver, false, A, b, x, ref, 1E-10 );
+
+      test_ = "Refinement of a well-conditioned sparse system";
+      const bool sconverged( solver.solve( blaze::CMatMxN( A ), b, x ) );
+      checkSolution( sconverged, solver, false, A, b, x, ref, 1E-10 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the refinement of an ill-conditioned system.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves a system whose first and last row differ by less than the single
+// precision rounding error. Therefore the single precision factorization is singular and the
+// solver has to fall back to the full precision factorization. Afterwards, the same solver is
+// checked to use the single precision factors again for a well-conditioned system. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testIllConditioned()
+{
+   const size_t n( 50UL );
+
+   blaze::MatMxN A( createMatrix( n ) );
+   row( A, n-1UL ) = row( A, 0UL );
+   A(n-1UL,0UL) += 1E-8;
+
+   const blaze::VecN ref( createReference( n ) );
+   const blaze::VecN b( -( A * ref ) );
+
+   blaze::MixedPrecisionRefinement solver;
+   solver.setThreshold( 1E-10 );
+
+   blaze::VecN x;
+
+   test_ = "Refinement of an ill-conditioned system";
+   const bool converged( solver.solve( A, b, x ) );
+   checkSolution( converged, solver, true, A, b, x, ref, 1E-4 );
+
+   test_ = "Refinement of a well-conditioned system after a fallback";
+   const blaze::MatMxN B( createMatrix( n ) );
+   const blaze::VecN c( -( B * ref ) );
+   const bool reconverged( solver.solve( B, c, x ) );
+   checkSolution( reconverged, solver, false, B, c, x, ref, 1E-10 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the size checks of the refinement solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that a non-square system matrix, a right-hand side of invalid size and
+// an invalid stagnation factor are rejected. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testInvalidSystem()
+{
+   blaze::MixedPrecisionRefinement solver;
+   blaze::VecN x;
+
+   {
+      test_ = "Refinement of a non-square system";
+
+      try {
+         solver.solve( blaze::MatMxN( 3UL, 4UL, 1.0 ), blaze::VecN( 3UL, 1.0 ), x );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solution of a non-square system succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Refinement with a right-hand side of invalid size";
+
+      try {
+         solver.solve( createMatrix( 4UL ), blaze::VecN( 3UL, 1.0 ), x );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solution with an invalid right-hand side succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Refinement with an invalid stagnation factor";
+
+      try {
+         solver.setStagnationFactor( 1.0 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting a stagnation factor of 1 succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the solution of a linear system of equations.
+//
+// \param converged The result of the solution process.
+// \param solver The solver used for the solution process.
+// \param fallback The expected state of the fallback flag.
+// \param A The system matrix.
+// \param b The right-hand side vector.
+// \param x The computed solution.
+// \param ref The reference solution.
+// \param tolerance The admissible error of the computed solution.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the solver reports convergence, that the residual \f$ A x + b \f$
+// is below the threshold of the solver, that the fallback flag has the expected state and that
+// the solution matches the reference solution. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::checkSolution( bool converged, const blaze::MixedPrecisionRefinement& solver, bool fallback,
+                                   const blaze::MatMxN& A, const blaze::VecN& b, const blaze::VecN& x,
+                                   const blaze::VecN& ref, double tolerance ) const
+{
+   const double residual( blaze::max( blaze::abs( A * x + b ) ) );
+   const double error( blaze::max( blaze::abs( x - ref ) ) );
+
+   if( !converged || residual >= solver.getThreshold() || solver.getFallback() != fallback || error > tolerance ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid solution\n"
+          << " Details:\n"
+          << "   System size      : " << A.rows() << "\n"
+          << "   Converged        : " << converged << "\n"
+          << "   Iterations       : " << solver.getLastIterations() << "\n"
+          << "   Residual         : " << residual << "\n"
+          << "   Threshold        : " << solver.getThreshold() << "\n"
+          << "   Fallback         : " << solver.getFallback() << "\n"
+          << "   Expected fallback: " << fallback << "\n"
+          << "   Solution error   : " << error << "\n"
+          << "   Tolerance        : " << tolerance << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creation of a random, well-conditioned matrix.
+//
+// \param n The number of rows and columns of the matrix.
+// \return The random matrix.
+//
+// All elements of the matrix are integral and therefore exactly representable in single
+// precision. The dominant elements lie on the anti-diagonal.
+*/
+blaze::MatMxN OperationTest::createMatrix( size_t n )
+{
+   blaze::MatMxN A( n, n );
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         A(i,j) = double( blaze::rand<int>( -9, 9 ) );
+      }
+      A(i,n-i-1UL) += double( 10UL*n );
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creation of a random reference solution.
+//
+// \param n The size of the reference solution.
+// \return The random reference solution.
+*/
+blaze::VecN OperationTest::createReference( size_t n )
+{
+   blaze::VecN x( n );
+   for( size_t i=0UL; i<n; ++i ) {
+      x[i] = blaze::rand<double>( -1.0, 1.0 );
+   }
+
+   return x;
+}
+//*************************************************************************************************
+
+} // namespace refinement
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running refinement operation test..." << std::endl;
+
+   try
+   {
+      RUN_REFINEMENT_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during refinement operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
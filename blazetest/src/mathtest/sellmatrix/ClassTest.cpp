@@ -0,0 +1,369 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/sellmatrix/ClassTest.cpp
+//  \brief Source file for the SellMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SellMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/sellmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace sellmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SellMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testMultiply();
+   testSwap();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SellMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the SellMatrix class template. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix default constructor";
+
+      blaze::SellMatrix<int> mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+
+      if( mat.chunks() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of chunks\n"
+             << " Details:\n"
+             << "   Number of chunks         : " << mat.chunks() << "\n"
+             << "   Expected number of chunks: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Conversion constructor
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix conversion constructor (row-major)";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 5UL, 4UL );
+      A(0,1) = 1.0;
+      A(2,0) = 2.0;
+      A(2,2) = 3.0;
+      A(2,3) = 4.0;
+      A(4,3) = 5.0;
+
+      blaze::SellMatrix<double> mat( A );
+      const size_t C( blaze::SellMatrix<double>::chunkSize );
+
+      checkRows    ( mat, 5UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 5UL );
+
+      if( mat.chunks() != ( 5UL + C - 1UL ) / C || mat.row(0) != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid chunk setup\n"
+             << " Details:\n"
+             << "   Number of chunks         : " << mat.chunks() << "\n"
+             << "   Expected number of chunks: " << ( 5UL + C - 1UL ) / C << "\n"
+             << "   First stored row         : " << mat.row(0) << "\n"
+             << "   Expected first stored row: 2\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( mat.capacity() < mat.nonZeros() || mat.offset( mat.chunks() ) != mat.capacity() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid capacity\n"
+             << " Details:\n"
+             << "   Capacity      : " << mat.capacity() << "\n"
+             << "   Last offset   : " << mat.offset( mat.chunks() ) << "\n"
+             << "   Number of non-zeros: " << mat.nonZeros() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SellMatrix conversion constructor (column-major)";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> A( 3UL, 6UL );
+      A(0,5) = 1;
+      A(1,0) = 2;
+      A(2,4) = 3;
+
+      blaze::SellMatrix<int> mat( A, 1UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 6UL );
+      checkNonZeros( mat, 3UL );
+
+      if( mat.sigma() != 1UL || mat.row(0) != 0UL || mat.row(1) != 1UL || mat.row(2) != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid row order\n"
+             << " Details:\n"
+             << "   Sigma     : " << mat.sigma() << "\n"
+             << "   Row order : " << mat.row(0) << " " << mat.row(1) << " " << mat.row(2) << "\n"
+             << "   Expected row order: 0 1 2\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SellMatrix conversion constructor (invalid sorting window)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> A( 3UL, 3UL );
+
+      try {
+         blaze::SellMatrix<int> mat( A, 0UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup with invalid sorting window succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SELL-C-sigma matrix/dense vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiply() function for various matrix sizes, sorting
+// windows and element types. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testMultiply()
+{
+   //=====================================================================================
+   // Multiplication with random matrices
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix multiplication";
+
+      const size_t sizes[] = { 0UL, 1UL, 3UL, 7UL, 8UL, 9UL, 16UL, 17UL, 33UL, 67UL };
+
+      for( size_t i=0UL; i<sizeof(sizes)/sizeof(size_t); ++i ) {
+         for( size_t j=0UL; j<sizeof(sizes)/sizeof(size_t); j+=3UL ) {
+            testMultiply<int>   ( sizes[i], sizes[j],   1UL );
+            testMultiply<int>   ( sizes[i], sizes[j],   4UL );
+            testMultiply<float> ( sizes[i], sizes[j],   1UL );
+            testMultiply<float> ( sizes[i], sizes[j], 100UL );
+            testMultiply<double>( sizes[i], sizes[j],   1UL );
+            testMultiply<double>( sizes[i], sizes[j],  16UL );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Multiplication with aliasing
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix multiplication with aliasing";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 3UL, 3UL );
+      A(0,1) = 2.0;
+      A(1,0) = 1.0;
+      A(1,2) = 1.0;
+      A(2,2) = 3.0;
+
+      blaze::DynamicVector<double,blaze::columnVector> x( 3UL );
+      x[0] = 1.0;
+      x[1] = 2.0;
+      x[2] = 3.0;
+
+      const blaze::SellMatrix<double> S( A );
+      multiply( x, S, x );
+
+      if( x[0] != 4.0 || x[1] != 4.0 || x[2] != 9.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << x << "\n"
+             << "   Expected result:\n( 4 4 9 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Multiplication with invalid vector sizes
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix multiplication with invalid vector sizes";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 3UL, 4UL );
+      blaze::DynamicVector<double,blaze::columnVector> x( 3UL ), y( 3UL );
+
+      const blaze::SellMatrix<double> S( A );
+
+      try {
+         multiply( y, S, x );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication with invalid vector sizes succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the SellMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the SellMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "SellMatrix swap";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> A( 2UL, 3UL );
+   A(0,0) = 1;
+   A(1,2) = 2;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> B( 4UL, 1UL );
+   B(3,0) = 3;
+
+   blaze::SellMatrix<int> mat1( A );
+   blaze::SellMatrix<int> mat2( B );
+
+   swap( mat1, mat2 );
+
+   checkRows    ( mat1, 4UL );
+   checkColumns ( mat1, 1UL );
+   checkNonZeros( mat1, 1UL );
+
+   checkRows    ( mat2, 2UL );
+   checkColumns ( mat2, 3UL );
+   checkNonZeros( mat2, 2UL );
+}
+//*************************************************************************************************
+
+} // namespace sellmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SellMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_SELLMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SellMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
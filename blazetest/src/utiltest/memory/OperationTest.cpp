@@ -41,7 +41,12 @@
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
 #include <blaze/math/StaticVector.h>
+#include <blaze/util/Arena.h>
+#include <blaze/util/ArenaAllocator.h>
 #include <blaze/util/Memory.h>
 #include <blaze/util/Null.h>
 #include <blaze/util/typetraits/AlignmentOf.h>
@@ -72,6 +77,8 @@ OperationTest::OperationTest()
    testBuiltinTypes();
    testClassTypes();
    testNullPointer();
+   testArena();
+   testArenaTemporaries();
 }
 //*************************************************************************************************
 
@@ -287,6 +294,205 @@ void OperationTest::testNullPointer()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the allocation from the thread-local arena.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the allocation and deallocation of built-in data types via
+// the ArenaAllocator within (nested) arena scopes, including the statistics of the arena. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testArena()
+{
+   test_ = "Arena allocation";
+
+   blaze::releaseArena();
+
+   blaze::ArenaAllocator<double> doubleAllocator;
+   blaze::ArenaAllocator<float>  floatAllocator;
+   blaze::ArenaAllocator<int>    intAllocator;
+
+   size_t peak( 0UL );
+
+   for( size_t i=0UL; i<3UL; ++i )
+   {
+      blaze::ArenaScope scope;
+
+      double* array1 = doubleAllocator.allocate( number );
+      float*  array2 = floatAllocator.allocate( 1000UL*number );
+
+      const size_t usage( blaze::getArenaUsage() );
+
+      if( !blaze::isArenaActive() || usage < number*sizeof(double) + 1000UL*number*sizeof(float) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid arena usage detected\n"
+             << " Details:\n"
+             << "   Usage: " << usage << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const size_t alignment( blaze::AlignmentOf<float>::value );
+      const size_t deviation( reinterpret_cast<size_t>( array2 ) % alignment );
+
+      if( deviation != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid alignment detected\n"
+             << " Details:\n"
+             << "   Expected alignment: " << alignment << "\n"
+             << "   Deviation         : " << deviation << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      {
+         blaze::ArenaScope inner;
+         int* array3 = intAllocator.allocate( 100000UL );
+         intAllocator.deallocate( array3, 100000UL );
+      }
+
+      if( blaze::getArenaUsage() != usage ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid arena usage after nested scope detected\n"
+             << " Details:\n"
+             << "   Usage         : " << blaze::getArenaUsage() << "\n"
+             << "   Expected usage: " << usage << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      doubleAllocator.deallocate( array1, number );
+      floatAllocator.deallocate( array2, 1000UL*number );
+
+      peak = blaze::getArenaPeak();
+   }
+
+   const size_t capacity( blaze::getArenaCapacity() );
+
+   if( blaze::isArenaActive() || blaze::getArenaUsage() != 0UL ||
+       peak < 100000UL*sizeof(int) || capacity < peak ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid arena statistics detected\n"
+          << " Details:\n"
+          << "   Usage   : " << blaze::getArenaUsage() << "\n"
+          << "   Peak    : " << peak << "\n"
+          << "   Capacity: " << capacity << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   {
+      blaze::ArenaScope scope;
+      double* array = doubleAllocator.allocate( number );
+      doubleAllocator.deallocate( array, number );
+   }
+
+   if( blaze::getArenaCapacity() != capacity ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Unexpected arena growth detected\n"
+          << " Details:\n"
+          << "   Capacity         : " << blaze::getArenaCapacity() << "\n"
+          << "   Expected capacity: " << capacity << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::releaseArena();
+
+   if( blaze::getArenaCapacity() != 0UL || blaze::getArenaPeak() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Releasing the arena failed\n"
+          << " Details:\n"
+          << "   Capacity: " << blaze::getArenaCapacity() << "\n"
+          << "   Peak    : " << blaze::getArenaPeak() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the evaluation of expression temporaries from the thread-local arena.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that within an arena scope only the temporaries of expressions and the
+// allocations via the ArenaAllocator are served from the arena, whereas vectors and matrices
+// that are resized within the scope keep their memory after the end of the scope. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testArenaTemporaries()
+{
+   test_ = "Arena allocation of expression temporaries";
+
+   blaze::releaseArena();
+
+   const size_t n( 64UL );
+
+   blaze::DynamicMatrix<double> A( n, n ), B( n, n );
+   blaze::DynamicVector<double> x( n ), y, z;
+
+   for( size_t i=0UL; i<n; ++i ) {
+      x[i] = double( i % 7UL ) - 3.0;
+      for( size_t j=0UL; j<n; ++j ) {
+         A(i,j) = double( ( i + 2UL*j ) % 5UL ) - 2.0;
+         B(i,j) = double( ( 3UL*i + j ) % 4UL ) - 1.5;
+      }
+   }
+
+   const blaze::DynamicVector<double> reference( A*x + B*x );
+
+   {
+      blaze::ArenaScope scope;
+
+      y.resize( n, false );
+      z.resize( n, false );
+
+      if( blaze::getArenaUsage() != 0UL || blaze::arenaOwns( y.data() ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resized vector allocated from the arena\n"
+             << " Details:\n"
+             << "   Usage: " << blaze::getArenaUsage() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      y = ( A + B ) * x;
+      z = serial( eval( A + B ) * x );
+
+      std::vector< unsigned char, blaze::ArenaAllocator<unsigned char> > flags( n, 0 );
+
+      if( blaze::getArenaPeak() < n*n*sizeof(double) || !blaze::arenaOwns( &flags[0] ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Expression temporaries not allocated from the arena\n"
+             << " Details:\n"
+             << "   Peak: " << blaze::getArenaPeak() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( y[i] != reference[i] || z[i] != reference[i] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid result after the end of the arena scope\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n" << reference << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   blaze::releaseArena();
+}
+//*************************************************************************************************
+
 } // namespace memory
 
 } // namespace utiltest
@@ -0,0 +1,214 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/threadpool/ClassTest.cpp
+//  \brief Source file for the ThreadPool class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/utiltest/threadpool/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ThreadPool class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_()  // Label of the currently performed test
+{
+   testUnevenTasks<BoostThreadPool>( "Boost thread pool" );
+   testWakeUp     <BoostThreadPool>( "Boost thread pool" );
+   testResize     <BoostThreadPool>( "Boost thread pool" );
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+   testUnevenTasks<StdThreadPool>( "C++11 thread pool" );
+   testWakeUp     <StdThreadPool>( "C++11 thread pool" );
+   testResize     <StdThreadPool>( "C++11 thread pool" );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking that each of the given tasks has been executed exactly once.
+//
+// \param counters The execution counters of the tasks.
+// \param n The number of tasks.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::checkCounters( const Counter* counters, size_t n ) const
+{
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const size_t executed( counters[i] );
+
+      if( executed != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Task " << ( executed == 0UL ? "lost" : "executed repeatedly" ) << "\n"
+             << " Details:\n"
+             << "   Task index      = " << i << "\n"
+             << "   Number of tasks = " << n << "\n"
+             << "   Executions      = " << executed << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  WATCHDOG
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Starting a watchdog for the given test.
+//
+// \param test Label of the guarded test.
+// \param seconds Time limit for the guarded test.
+*/
+ClassTest::Watchdog::Watchdog( const std::string& test, size_t seconds )
+   : test_    ( test )  // Label of the guarded test
+   , deadline_( boost::get_system_time() + boost::posix_time::seconds( long( seconds ) ) )
+   , done_    ( false ) // Completion flag of the guarded test
+   , mutex_   ()        // Synchronization mutex
+   , finished_()        // Wait condition for the completion of the test
+   , thread_  ()        // The watchdog thread
+{
+   boost::thread( boost::bind( &Watchdog::run, this ) ).swap( thread_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Stopping the watchdog after the guarded test has completed.
+*/
+ClassTest::Watchdog::~Watchdog()
+{
+   {
+      boost::unique_lock<boost::mutex> lock( mutex_ );
+      done_ = true;
+      finished_.notify_all();
+   }
+
+   thread_.join();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Aborting the test in case it does not complete before the deadline.
+//
+// \return void
+//
+// A test that exceeds its time limit is blocked in a call to wait() that will never return.
+// Since the blocked thread cannot be interrupted, the entire test is terminated.
+*/
+void ClassTest::Watchdog::run()
+{
+   boost::unique_lock<boost::mutex> lock( mutex_ );
+
+   while( !done_ ) {
+      if( !finished_.timed_wait( lock, deadline_ ) && !done_ ) {
+         std::cerr << "\n\n ERROR DETECTED during ThreadPool class test:\n"
+                   << " Test: " << test_ << "\n"
+                   << " Error: Time limit exceeded (lost wake-up)\n";
+         std::abort();
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running ThreadPool class test..." << std::endl;
+
+   try
+   {
+      RUN_THREADPOOL_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during ThreadPool class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,222 @@
+//*************************************************************************************************
+/*!
+//  \file src/math/solvers/BiCGSTAB.cpp
+//  \brief Source file for the BiCGSTAB solver
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/math/solvers/BiCGSTAB.h>
+#include <blaze/util/ColorMacros.h>
+#include <blaze/util/logging/DebugSection.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for the BiCGSTAB solver.
+*/
+BiCGSTAB::BiCGSTAB()
+   : r_             ()        // The residual vector
+   , r0_            ()        // The initial (shadow) residual vector
+   , p_             ()        // The search direction
+   , v_             ()        // The product of the system matrix and the search direction
+   , s_             ()        // The intermediate residual vector
+   , t_             ()        // The product of the system matrix and the intermediate residual
+   , ph_            ()        // The preconditioned search direction
+   , sh_            ()        // The preconditioned intermediate residual
+   , preconditioner_( NULL )  // The (optional) preconditioner of the system matrix
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solves the linear system \f$ A \cdot x + b = 0 \f$.
+//
+// \param A The square system matrix.
+// \param b The right-hand side vector.
+// \param x The resulting vector of unknowns.
+// \return \a true if the system was solved within accuracy, \a false if not.
+// \exception std::invalid_argument System matrix is not square.
+// \exception std::invalid_argument Invalid right-hand side vector size.
+//
+// The solution process starts from \f$ x = 0 \f$. In this formulation the residual is defined
+// as \f$ r = A \cdot x + b \f$, which is the negative of the residual of the usual formulation
+// \f$ A \cdot x = -b \f$; therefore all updates of \a x carry the opposite sign. An iteration
+// consists of two half steps, each of which is followed by a convergence test. The iterations
+// are stopped early in case of a breakdown of the underlying Lanczos process, in which case the
+// system is reported as not solved.
+*/
+bool BiCGSTAB::solve( const CMatMxN& A, const VecN& b, VecN& x )
+{
+   const size_t n( b.size() );
+   bool converged( false );
+   real rho( 1 ), alpha( 1 ), omega( 1 );
+
+   if( A.rows() != A.columns() )
+      throw std::invalid_argument( "System matrix is not square" );
+
+   if( A.rows() != b.size() )
+      throw std::invalid_argument( "Invalid right-hand side vector size" );
+
+   // Allocating helper data
+   r_.resize ( n, false );
+   r0_.resize( n, false );
+   p_.resize ( n, false );
+   v_.resize ( n, false );
+   s_.resize ( n, false );
+   t_.resize ( n, false );
+
+   // Preparing the vector of unknowns
+   x.resize( n, false );
+   x.reset();
+
+   // Setting up the preconditioner
+   if( preconditioner_ != NULL ) {
+      ph_.resize( n, false );
+      sh_.resize( n, false );
+      preconditioner_->setup( A );
+   }
+
+   const VecN& ph( ( preconditioner_ != NULL )?( ph_ ):( p_ ) );
+   const VecN& sh( ( preconditioner_ != NULL )?( sh_ ):( s_ ) );
+
+   // Computing the initial residual
+   r_ = A * x + b;
+   r0_ = r_;
+   p_.reset();
+   v_.reset();
+
+   // Initial convergence test
+   lastPrecision_ = max( abs( r_ ) );
+
+   if( lastPrecision_ < threshold_ )
+      converged = true;
+
+   // Performing the BiCGSTAB iterations
+   size_t it( 0 );
+
+   for( ; !converged && it<maxIterations_; ++it )
+   {
+      const real rhoNew( trans(r0_) * r_ );
+
+      if( rhoNew == real(0) )
+         break;
+
+      const real beta( ( rhoNew / rho ) * ( alpha / omega ) );
+      rho = rhoNew;
+
+      p_ = r_ + beta * ( p_ - omega * v_ );
+
+      if( preconditioner_ != NULL )
+         preconditioner_->apply( p_, ph_ );
+
+      v_ = A * ph;
+
+      const real r0v( trans(r0_) * v_ );
+
+      if( r0v == real(0) )
+         break;
+
+      alpha = rho / r0v;
+
+      s_ = r_ - alpha * v_;
+
+      lastPrecision_ = max( abs( s_ ) );
+
+      if( lastPrecision_ < threshold_ ) {
+         x -= alpha * ph;
+         converged = true;
+         ++it;
+         break;
+      }
+
+      if( preconditioner_ != NULL )
+         preconditioner_->apply( s_, sh_ );
+
+      t_ = A * sh;
+
+      const real tt( trans(t_) * t_ );
+
+      if( tt == real(0) )
+         break;
+
+      omega = ( trans(t_) * s_ ) / tt;
+
+      multiAssign( subAssignTo( x, alpha * ph + omega * sh ), assignTo( r_, s_ - omega * t_ ) );
+
+      lastPrecision_ = max( abs( r_ ) );
+
+      if( lastPrecision_ < threshold_ ) {
+         converged = true;
+         ++it;
+         break;
+      }
+
+      if( omega == real(0) ) {
+         ++it;
+         break;
+      }
+   }
+
+   BLAZE_LOG_DEBUG_SECTION( log ) {
+      if( converged )
+         log << "      Solved the linear system in " << it << " BiCGSTAB iterations.";
+      else
+         log << BLAZE_YELLOW << "      WARNING: Did not solve the linear system within accuracy. (" << lastPrecision_ << ")" << BLAZE_OLDCOLOR;
+   }
+
+   lastIterations_ = it;
+
+   return converged;
+}
+//*************************************************************************************************
+
+} // namespace blaze
@@ -0,0 +1,176 @@
+//=================================================================================================
+/*!
+//  \file src/math/solvers/BlockJacobiPreconditioner.cpp
+//  \brief Source file for the block Jacobi preconditioner
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/math/solvers/BlockJacobiPreconditioner.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for the block Jacobi preconditioner.
+*/
+BlockJacobiPreconditioner::BlockJacobiPreconditioner()
+   : blocks_()  // The inverted 3x3 diagonal blocks of the system matrix
+   , inv_   ()  // The inverse diagonal elements of the trailing unknowns
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PRECONDITIONER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the block Jacobi preconditioner for the given system matrix.
+//
+// \param A The square system matrix.
+// \return void
+// \exception std::invalid_argument Singular diagonal block.
+//
+// The 3x3 diagonal blocks are extracted from the rows of the system matrix and inverted via
+// their adjugate matrices.
+*/
+void BlockJacobiPreconditioner::setup( const CMatMxN& A )
+{
+   typedef CMatMxN::ConstIterator  ConstIterator;
+
+   BLAZE_USER_ASSERT( A.rows() == A.columns(), "Non-square system matrix detected" );
+
+   const size_t n    ( A.rows() );
+   const size_t nb   ( n / 3UL );
+   const size_t rest ( n - 3UL*nb );
+
+   blocks_.resize( nb );
+   inv_.resize( rest, false );
+
+   Block B;
+
+   for( size_t b=0UL; b<nb; ++b )
+   {
+      const size_t first( 3UL*b );
+
+      reset( B );
+
+      for( size_t k=0UL; k<3UL; ++k ) {
+         const ConstIterator end( A.end( first+k ) );
+         for( ConstIterator element=A.lowerBound( first+k, first ); element!=end && element->index()<first+3UL; ++element )
+            B(k,element->index()-first) = element->value();
+      }
+
+      const real c00( B(1,1)*B(2,2) - B(1,2)*B(2,1) );
+      const real c01( B(1,2)*B(2,0) - B(1,0)*B(2,2) );
+      const real c02( B(1,0)*B(2,1) - B(1,1)*B(2,0) );
+      const real det( B(0,0)*c00 + B(0,1)*c01 + B(0,2)*c02 );
+
+      if( det == real(0) )
+         throw std::invalid_argument( "Singular diagonal block" );
+
+      const real idet( real(1) / det );
+      Block& I( blocks_[b] );
+
+      I(0,0) = c00 * idet;
+      I(1,0) = c01 * idet;
+      I(2,0) = c02 * idet;
+      I(0,1) = ( B(0,2)*B(2,1) - B(0,1)*B(2,2) ) * idet;
+      I(1,1) = ( B(0,0)*B(2,2) - B(0,2)*B(2,0) ) * idet;
+      I(2,1) = ( B(0,1)*B(2,0) - B(0,0)*B(2,1) ) * idet;
+      I(0,2) = ( B(0,1)*B(1,2) - B(0,2)*B(1,1) ) * idet;
+      I(1,2) = ( B(0,2)*B(1,0) - B(0,0)*B(1,2) ) * idet;
+      I(2,2) = ( B(0,0)*B(1,1) - B(0,1)*B(1,0) ) * idet;
+   }
+
+   for( size_t i=0UL; i<rest; ++i )
+   {
+      const ConstIterator element( A.find( 3UL*nb+i, 3UL*nb+i ) );
+
+      if( element == A.end( 3UL*nb+i ) || element->value() == real(0) )
+         throw std::invalid_argument( "Singular diagonal block" );
+
+      inv_[i] = real(1) / element->value();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Applies the block Jacobi preconditioner to the given residual (\f$ z = M^{-1} r \f$).
+//
+// \param r The residual vector.
+// \param z The resulting preconditioned residual.
+// \return void
+*/
+void BlockJacobiPreconditioner::apply( const VecN& r, VecN& z ) const
+{
+   const size_t nb( blocks_.size() );
+
+   BLAZE_USER_ASSERT( r.size() == 3UL*nb+inv_.size(), "Invalid residual vector size" );
+
+   z.resize( r.size(), false );
+
+   for( size_t b=0UL; b<nb; ++b )
+   {
+      const Block& I( blocks_[b] );
+      const size_t i( 3UL*b );
+      const real r0( r[i] ), r1( r[i+1UL] ), r2( r[i+2UL] );
+
+      z[i    ] = I(0,0)*r0 + I(0,1)*r1 + I(0,2)*r2;
+      z[i+1UL] = I(1,0)*r0 + I(1,1)*r1 + I(1,2)*r2;
+      z[i+2UL] = I(2,0)*r0 + I(2,1)*r1 + I(2,2)*r2;
+   }
+
+   for( size_t i=0UL; i<inv_.size(); ++i ) {
+      z[3UL*nb+i] = inv_[i] * r[3UL*nb+i];
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
@@ -40,15 +40,215 @@
 #include <cmath>
 #include <stdexcept>
 #include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
 #include <blaze/math/solvers/CG.h>
+#include <blaze/system/Vectorization.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/ColorMacros.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/DebugSection.h>
 #include <blaze/util/Types.h>
 
 
 namespace blaze {
 
+//=================================================================================================
+//
+//  CG KERNELS
+//
+//=================================================================================================
+
+namespace {
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Helper structure for the selection of the vectorized CG kernels.
+// \ingroup lse_solvers
+*/
+template< typename T >  // Type of the vector elements
+struct UseVectorizedCGKernel
+{
+   enum { value = !BLAZE_MIC_MODE && IntrinsicTrait<T>::addition && IntrinsicTrait<T>::multiplication };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default computation of the maximum norm of a residual vector.
+// \ingroup lse_solvers
+//
+// \param r The residual vector.
+// \return The maximum norm of the residual vector.
+*/
+template< typename T >  // Type of the vector elements
+inline typename DisableIf< UseVectorizedCGKernel<T>, T >::Type
+   cgMaxNorm( const DynamicVector<T,false>& r )
+{
+   T norm( 0 );
+   for( size_t i=0UL; i<r.size(); ++i ) {
+      norm = max( norm, std::fabs( r[i] ) );
+   }
+   return norm;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized computation of the maximum norm of a residual vector.
+// \ingroup lse_solvers
+//
+// \param r The residual vector.
+// \return The maximum norm of the residual vector.
+*/
+template< typename T >  // Type of the vector elements
+inline typename EnableIf< UseVectorizedCGKernel<T>, T >::Type
+   cgMaxNorm( const DynamicVector<T,false>& r )
+{
+   typedef IntrinsicTrait<T>  IT;
+   typedef typename IT::Type  IntrinsicType;
+
+   const size_t n   ( r.size() );
+   const size_t ipos( n & size_t(-IT::size) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % IT::size ) ) == ipos, "Invalid end calculation" );
+
+   const T* rp( r.data() );
+   IntrinsicType xmm( set( T(0) ) );
+
+   for( size_t i=0UL; i<ipos; i+=IT::size ) {
+      xmm = max( xmm, abs( load( rp+i ) ) );
+   }
+
+   T tmp[IT::size];
+   storeu( tmp, xmm );
+
+   T norm( 0 );
+   for( size_t k=0UL; k<IT::size; ++k ) {
+      norm = max( norm, tmp[k] );
+   }
+   for( size_t i=ipos; i<n; ++i ) {
+      norm = max( norm, std::fabs( rp[i] ) );
+   }
+
+   return norm;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default fused update of the solution and the residual of a CG iteration.
+// \ingroup lse_solvers
+//
+// \param x The vector of unknowns.
+// \param r The residual vector.
+// \param d The search direction.
+// \param h The product of the system matrix and the search direction.
+// \param alpha The step length.
+// \param rr The resulting squared Euclidean norm of the updated residual.
+// \return The maximum norm of the updated residual.
+//
+// This function computes \f$ x += \alpha d \f$ and \f$ r += \alpha h \f$ and the maximum and the
+// squared Euclidean norm of the updated residual in a single pass over the vectors.
+*/
+template< typename T >  // Type of the vector elements
+inline typename DisableIf< UseVectorizedCGKernel<T>, T >::Type
+   cgUpdate( DynamicVector<T,false>& x, DynamicVector<T,false>& r, const DynamicVector<T,false>& d,
+             const DynamicVector<T,false>& h, T alpha, T& rr )
+{
+   T norm( 0 );
+   rr = T(0);
+
+   for( size_t i=0UL; i<x.size(); ++i ) {
+      x[i] += alpha * d[i];
+      r[i] += alpha * h[i];
+      norm  = max( norm, std::fabs( r[i] ) );
+      rr   += r[i] * r[i];
+   }
+
+   return norm;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized fused update of the solution and the residual of a CG iteration.
+// \ingroup lse_solvers
+//
+// \param x The vector of unknowns.
+// \param r The residual vector.
+// \param d The search direction.
+// \param h The product of the system matrix and the search direction.
+// \param alpha The step length.
+// \param rr The resulting squared Euclidean norm of the updated residual.
+// \return The maximum norm of the updated residual.
+//
+// This function computes \f$ x += \alpha d \f$ and \f$ r += \alpha h \f$ and the maximum and the
+// squared Euclidean norm of the updated residual in a single pass over the vectors.
+*/
+template< typename T >  // Type of the vector elements
+inline typename EnableIf< UseVectorizedCGKernel<T>, T >::Type
+   cgUpdate( DynamicVector<T,false>& x, DynamicVector<T,false>& r, const DynamicVector<T,false>& d,
+             const DynamicVector<T,false>& h, T alpha, T& rr )
+{
+   typedef IntrinsicTrait<T>  IT;
+   typedef typename IT::Type  IntrinsicType;
+
+   const size_t n   ( x.size() );
+   const size_t ipos( n & size_t(-IT::size) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % IT::size ) ) == ipos, "Invalid end calculation" );
+
+   T* BLAZE_RESTRICT xp( x.data() );
+   T* BLAZE_RESTRICT rp( r.data() );
+   const T* BLAZE_RESTRICT dp( d.data() );
+   const T* BLAZE_RESTRICT hp( h.data() );
+
+   const IntrinsicType factor( set( alpha ) );
+   IntrinsicType xmm1( set( T(0) ) );
+   IntrinsicType xmm2( xmm1 );
+
+   for( size_t i=0UL; i<ipos; i+=IT::size ) {
+      const IntrinsicType ri( fmadd( factor, load( hp+i ), load( rp+i ) ) );
+      store( xp+i, fmadd( factor, load( dp+i ), load( xp+i ) ) );
+      store( rp+i, ri );
+      xmm1 = max( xmm1, abs( ri ) );
+      xmm2 = fmadd( ri, ri, xmm2 );
+   }
+
+   T tmp[IT::size];
+   storeu( tmp, xmm1 );
+
+   T norm( 0 );
+   for( size_t k=0UL; k<IT::size; ++k ) {
+      norm = max( norm, tmp[k] );
+   }
+
+   rr = sum( xmm2 );
+
+   for( size_t i=ipos; i<n; ++i ) {
+      xp[i] += alpha * dp[i];
+      rp[i] += alpha * hp[i];
+      norm   = max( norm, std::fabs( rp[i] ) );
+      rr    += rp[i] * rp[i];
+   }
+
+   return norm;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace
+
+
+
+
 //=================================================================================================
 //
 //  CONSTRUCTOR
@@ -59,9 +259,12 @@ namespace blaze {
 /*!\brief The default constructor for the conjugate gradient solver.
 */
 CG::CG()
-   : r_()  // TODO
-   , d_()  // TODO
-   , h_()  // TODO
+   : r_             ()        // The residual vector
+   , d_             ()        // The search direction
+   , h_             ()        // The product of the system matrix and the search direction
+   , z_             ()        // The preconditioned residual vector
+   , preconditioner_( NULL )  // The (optional) preconditioner of the system matrix
+   , symmetryCheck_ ( true )  // Flag for the symmetry check of the system matrix
 {}
 //*************************************************************************************************
 
@@ -87,6 +290,9 @@ CG::CG()
 //
 // TODO: description
 // TODO: Problem formulation: \f$ A \cdot x + b = 0 \f$ !!
+//
+// In case a preconditioner has been set via setPreconditioner(), the preconditioned CG method
+// is used. The symmetry check of the system matrix can be deactivated via setSymmetryCheck().
 */
 bool CG::solve( const CMatMxN& A, const VecN& b, VecN& x )
 {
@@ -97,7 +303,7 @@ bool CG::solve( const CMatMxN& A, const VecN& b, VecN& x )
    if( A.rows() != A.columns() )
       throw std::invalid_argument( "System matrix is not square" );
 
-   if( !isSymmetric( A ) )
+   if( symmetryCheck_ && !isSymmetric( A ) )
       throw std::invalid_argument( "System matrix is not symmetric" );
 
    if( A.rows() != b.size() )
@@ -112,21 +318,30 @@ bool CG::solve( const CMatMxN& A, const VecN& b, VecN& x )
    x.resize( n, false );
    x.reset();
 
+   // Setting up the preconditioner
+   if( preconditioner_ != NULL ) {
+      z_.resize( n, false );
+      preconditioner_->setup( A );
+   }
+
    // Computing the initial residual
    r_ = A * x + b;
 
    // Initial convergence test
-   lastPrecision_ = 0;
-   for( size_t i=0; i<n; ++i ) {
-      lastPrecision_ = max( lastPrecision_, std::fabs( r_[i] ) );
-   }
+   lastPrecision_ = cgMaxNorm( r_ );
 
    if( lastPrecision_ < threshold_ )
       converged = true;
 
-   delta = trans(r_) * r_;
-
-   d_ = -r_;
+   if( preconditioner_ != NULL ) {
+      preconditioner_->apply( r_, z_ );
+      delta = trans(r_) * z_;
+      d_ = -z_;
+   }
+   else {
+      delta = trans(r_) * r_;
+      d_ = -r_;
+   }
 
    // Performing the CG iterations
    size_t it( 0 );
@@ -137,22 +352,21 @@ bool CG::solve( const CMatMxN& A, const VecN& b, VecN& x )
 
       alpha = delta / ( trans(d_) * h_ );
 
-      x  += alpha * d_;
-      r_ += alpha * h_;
-
-      lastPrecision_ = 0;
-      for( size_t i=0; i<n; ++i ) {
-         lastPrecision_ = max( lastPrecision_, std::fabs( r_[i] ) );
-      }
+      lastPrecision_ = cgUpdate( x, r_, d_, h_, alpha, beta );
 
       if( lastPrecision_ < threshold_ ) {
          converged = true;
          break;
       }
 
-      beta = trans(r_) * r_;
-
-      d_ = ( beta / delta ) * d_ - r_;
+      if( preconditioner_ != NULL ) {
+         preconditioner_->apply( r_, z_ );
+         beta = trans(r_) * z_;
+         d_ = ( beta / delta ) * d_ - z_;
+      }
+      else {
+         d_ = ( beta / delta ) * d_ - r_;
+      }
 
       delta = beta;
    }
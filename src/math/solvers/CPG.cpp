@@ -55,7 +55,9 @@ CPG::CPG()
    : r_()         // TODO
    , w_()         // TODO
    , p_()         // TODO
+   , q_()         // The product of the LCP matrix and the descent direction
    , activity_()  // TODO
+   , blockA_()    // The 3x3 block copy of the LCP matrix
 {}
 //*************************************************************************************************
 
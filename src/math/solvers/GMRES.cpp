@@ -0,0 +1,285 @@
+//*************************************************************************************************
+/*!
+//  \file src/math/solvers/GMRES.cpp
+//  \brief Source file for the restarted GMRES solver
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <stdexcept>
+#include <blaze/math/solvers/GMRES.h>
+#include <blaze/util/ColorMacros.h>
+#include <blaze/util/logging/DebugSection.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor for the GMRES solver.
+//
+// \param restart The maximum dimension of the Krylov subspace of a single cycle.
+// \exception std::invalid_argument Invalid restart length.
+*/
+GMRES::GMRES( size_t restart )
+   : restart_       ( restart )  // The maximum dimension of the Krylov subspace of a cycle
+   , V_             ()           // The orthonormal basis of the Krylov subspace
+   , H_             ()           // The Hessenberg matrix of the Arnoldi process
+   , cs_            ()           // The cosines of the Givens rotations
+   , sn_            ()           // The sines of the Givens rotations
+   , g_             ()           // The rotated right-hand side of the least squares problem
+   , y_             ()           // The solution of the least squares problem
+   , r_             ()           // The residual vector
+   , w_             ()           // The new basis vector of the Arnoldi process
+   , z_             ()           // The preconditioned basis vector
+   , preconditioner_( NULL )     // The (optional) preconditioner of the system matrix
+{
+   if( restart == 0UL )
+      throw std::invalid_argument( "Invalid restart length" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Sets the maximum dimension of the Krylov subspace of a single cycle.
+//
+// \param restart The number of iterations after which the GMRES solver is restarted.
+// \return void
+// \exception std::invalid_argument Invalid restart length.
+//
+// Larger restart lengths usually reduce the total number of iterations at the price of more
+// memory and more work per iteration for the orthogonalization.
+*/
+void GMRES::setRestart( size_t restart )
+{
+   if( restart == 0UL )
+      throw std::invalid_argument( "Invalid restart length" );
+
+   restart_ = restart;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solves the linear system \f$ A \cdot x + b = 0 \f$.
+//
+// \param A The square system matrix.
+// \param b The right-hand side vector.
+// \param x The resulting vector of unknowns.
+// \return \a true if the system was solved within accuracy, \a false if not.
+// \exception std::invalid_argument System matrix is not square.
+// \exception std::invalid_argument Invalid right-hand side vector size.
+//
+// The solution process starts from \f$ x = 0 \f$. In this formulation the residual is defined
+// as \f$ r = A \cdot x + b \f$, which is the negative of the residual of the usual formulation
+// \f$ A \cdot x = -b \f$; therefore the first basis vector of each cycle is \f$ -r/|r| \f$.
+*/
+bool GMRES::solve( const CMatMxN& A, const VecN& b, VecN& x )
+{
+   const size_t n( b.size() );
+   const size_t m( restart_ );
+   bool converged( false );
+
+   if( A.rows() != A.columns() )
+      throw std::invalid_argument( "System matrix is not square" );
+
+   if( A.rows() != b.size() )
+      throw std::invalid_argument( "Invalid right-hand side vector size" );
+
+   // Allocating helper data
+   if( V_.size() < m+1UL )
+      V_.resize( m+1UL );
+   for( size_t i=0UL; i<=m; ++i )
+      V_[i].resize( n, false );
+
+   H_.resize ( m+1UL, m, false );
+   cs_.resize( m, false );
+   sn_.resize( m, false );
+   g_.resize ( m+1UL, false );
+   y_.resize ( m, false );
+   r_.resize ( n, false );
+   w_.resize ( n, false );
+
+   // Preparing the vector of unknowns
+   x.resize( n, false );
+   x.reset();
+
+   // Setting up the preconditioner
+   if( preconditioner_ != NULL ) {
+      z_.resize( n, false );
+      preconditioner_->setup( A );
+   }
+
+   // Performing the GMRES cycles
+   size_t it( 0 );
+
+   while( true )
+   {
+      // Computing the residual and convergence test
+      r_ = A * x + b;
+
+      lastPrecision_ = max( abs( r_ ) );
+
+      if( lastPrecision_ < threshold_ ) {
+         converged = true;
+         break;
+      }
+
+      if( it >= maxIterations_ )
+         break;
+
+      const real beta( length( r_ ) );
+
+      V_[0] = ( real(-1) / beta ) * r_;
+      g_.reset();
+      g_[0] = beta;
+
+      // Performing the Arnoldi iterations of the current cycle
+      size_t k( 0 );
+
+      while( k < m && it < maxIterations_ )
+      {
+         const size_t j( k );
+
+         if( preconditioner_ != NULL ) {
+            preconditioner_->apply( V_[j], z_ );
+            w_ = A * z_;
+         }
+         else {
+            w_ = A * V_[j];
+         }
+
+         // Modified Gram-Schmidt orthogonalization
+         for( size_t i=0UL; i<=j; ++i ) {
+            H_(i,j) = trans(w_) * V_[i];
+            w_ -= H_(i,j) * V_[i];
+         }
+
+         const real h( length( w_ ) );
+         H_(j+1UL,j) = h;
+
+         if( h != real(0) )
+            V_[j+1UL] = ( real(1) / h ) * w_;
+
+         // Applying the previous Givens rotations to the new column
+         for( size_t i=0UL; i<j; ++i ) {
+            const real tmp( cs_[i]*H_(i,j) + sn_[i]*H_(i+1UL,j) );
+            H_(i+1UL,j) = cs_[i]*H_(i+1UL,j) - sn_[i]*H_(i,j);
+            H_(i,j) = tmp;
+         }
+
+         // Computing and applying the new Givens rotation
+         const real denom( std::sqrt( H_(j,j)*H_(j,j) + h*h ) );
+
+         if( denom == real(0) ) {
+            cs_[j] = real(1);
+            sn_[j] = real(0);
+         }
+         else {
+            cs_[j] = H_(j,j) / denom;
+            sn_[j] = h / denom;
+         }
+
+         H_(j,j) = denom;
+         H_(j+1UL,j) = real(0);
+         g_[j+1UL] = -sn_[j] * g_[j];
+         g_[j] = cs_[j] * g_[j];
+
+         ++k;
+         ++it;
+
+         // Early end of the cycle (the Euclidean norm bounds the maximum norm)
+         if( std::fabs( g_[k] ) < threshold_ || h == real(0) )
+            break;
+      }
+
+      // Solving the upper triangular least squares system
+      for( size_t i=k; i>0UL; --i ) {
+         real tmp( g_[i-1UL] );
+         for( size_t l=i; l<k; ++l )
+            tmp -= H_(i-1UL,l) * y_[l];
+         y_[i-1UL] = ( H_(i-1UL,i-1UL) != real(0) )?( tmp / H_(i-1UL,i-1UL) ):( real(0) );
+      }
+
+      // Updating the vector of unknowns
+      w_ = y_[0] * V_[0];
+      for( size_t i=1UL; i<k; ++i )
+         w_ += y_[i] * V_[i];
+
+      if( preconditioner_ != NULL ) {
+         preconditioner_->apply( w_, z_ );
+         x += z_;
+      }
+      else {
+         x += w_;
+      }
+   }
+
+   BLAZE_LOG_DEBUG_SECTION( log ) {
+      if( converged )
+         log << "      Solved the linear system in " << it << " GMRES iterations.";
+      else
+         log << BLAZE_YELLOW << "      WARNING: Did not solve the linear system within accuracy. (" << lastPrecision_ << ")" << BLAZE_OLDCOLOR;
+   }
+
+   lastIterations_ = it;
+
+   return converged;
+}
+//*************************************************************************************************
+
+} // namespace blaze
@@ -37,12 +37,9 @@
 // Includes
 //*************************************************************************************************
 
-#include <algorithm>
 #include <cmath>
 #include <stdexcept>
-#include <blaze/math/Accuracy.h>
-#include <blaze/math/shims/IsDefault.h>
-#include <blaze/math/shims/Reset.h>
+#include <blaze/math/Functions.h>
 #include <blaze/math/solvers/GaussianElimination.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/ColorMacros.h>
@@ -62,8 +59,8 @@ namespace blaze {
 /*!\brief The default constructor for the GaussianElimination class.
 */
 GaussianElimination::GaussianElimination()
-   : A_()  // TODO
-   , b_()  // TODO
+   : lu_()  // The LU decomposition of the system matrix
+   , b_ ()  // The negative right-hand side vector
 {}
 //*************************************************************************************************
 
@@ -100,80 +97,18 @@ bool GaussianElimination::solve( const CMatMxN& A, const VecN& b, VecN& x )
 
    const size_t n( b.size() );
 
-   // Allocating helper data
-   A_ =  A;
+   // Factorizing the system matrix and solving A x = -b
    b_ = -b;
-   x.resize( n, false );
+   lu_.factorize( A );
+   lu_.solve( b_, x );
 
-   size_t pi, pj;
+   // Computing the maximum residual in case of a singular system matrix
    lastPrecision_ = real(0);
 
-   // Initializing the pivot vector
-   DynamicVector<size_t> p( n );
-   for( size_t j=0; j<n; ++j ) {
-      p[j] = j;
-   }
-
-   // Performing the Gaussian elimination
-   for( size_t j=0; j<n; ++j )
-   {
-      size_t max( j );
-      real max_val( std::fabs( A_(p[max],j) ) );
-
-      // Partial search for pivot
-      for( size_t i=j+1; i<n; ++i ) {
-         if( std::fabs( A_(p[i],j) ) > max_val ) {
-            max = i;
-            max_val = std::fabs( A_(p[max],j) );
-         }
-      }
-
-      // Swapping rows such the pivot lies on the diagonal
-      std::swap( p[max], p[j] );
-      pj = p[j];
-
-      if( !isDefault( A_(pj,j) ) )
-      {
-         // Eliminating the column below the diagonal
-         for( size_t i=j+1; i<n; ++i )
-         {
-            pi = p[i];
-            const real f = A_(pi,j) / A_(pj,j);
-
-            reset( A_(pi,j) );
-
-            for( size_t k=j+1; k<n; ++k ) {
-               A_(pi,k) -= A_(pj,k) * f;
-            }
-
-            b_[pi] -= b_[pj] * f;
-         }
-      }
-      else {
-         // Asserting that the column is zero below the diagonal
-         for( size_t i=j+1; i<n; ++i ) {
-            BLAZE_INTERNAL_ASSERT( isDefault( A_(p[i],j) ), "Fatal error in Gaussian elimination" );
-         }
-      }
-   }
-
-   // Performing the backward substitution
-   for( size_t i=n-1; i<n; --i )
-   {
-      pi = p[i];
-      real rhs = b_[pi];
-
-      for( size_t j=i+1; j<n; ++j ) {
-         rhs -= x[j] * A_(pi,j);
-      }
-
-      if( std::fabs( A_(pi,i) ) > accuracy ) {
-         x[i] = rhs / A_(pi,i);
-      }
-      else {
-         // This will introduce errors in the solution
-         reset( x[i] );
-         lastPrecision_ = max( lastPrecision_, std::fabs( rhs ) );
+   if( lu_.isSingular() ) {
+      b_ = A * x + b;
+      for( size_t i=0UL; i<n; ++i ) {
+         lastPrecision_ = max( lastPrecision_, std::fabs( b_[i] ) );
       }
    }
 
@@ -0,0 +1,249 @@
+//=================================================================================================
+/*!
+//  \file src/math/solvers/ICPreconditioner.cpp
+//  \brief Source file for the incomplete Cholesky preconditioner
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <stdexcept>
+#include <blaze/math/solvers/ICPreconditioner.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for the incomplete Cholesky preconditioner.
+*/
+ICPreconditioner::ICPreconditioner()
+   : L_    ()     // The incomplete Cholesky factor of the system matrix
+   , diag_ ()     // The inverse diagonal elements of the incomplete Cholesky factor
+   , shift_( 0 )  // The relative diagonal shift used for the last factorization
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PRECONDITIONER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the incomplete Cholesky factorization of the given system matrix.
+//
+// \param A The symmetric positive definite system matrix.
+// \return void
+// \exception std::invalid_argument System matrix is not positive definite.
+//
+// This function computes the IC(0) factorization of the given symmetric system matrix. Only
+// the lower part of \a A is accessed. In case the factorization breaks down due to a non-positive
+// pivot, the diagonal of \a A is scaled by \f$ (1+\alpha) \f$ with an increasing shift
+// \f$ \alpha \f$ and the factorization is restarted.
+*/
+void ICPreconditioner::setup( const CMatMxN& A )
+{
+   BLAZE_USER_ASSERT( A.rows() == A.columns(), "Non-square system matrix detected" );
+
+   shift_ = real(0);
+
+   if( factorize( A, shift_ ) )
+      return;
+
+   for( shift_=real(1E-3); shift_<=real(1E3); shift_*=real(10) ) {
+      if( factorize( A, shift_ ) )
+         return;
+   }
+
+   throw std::invalid_argument( "System matrix is not positive definite" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Applies the incomplete Cholesky preconditioner to the given residual.
+//
+// \param r The residual vector.
+// \param z The resulting preconditioned residual.
+// \return void
+//
+// This function computes \f$ z = (L L^T)^{-1} r \f$ by a forward substitution with \f$ L \f$
+// and a backward substitution with \f$ L^T \f$. Both substitutions traverse the rows of the
+// row-major factor \f$ L \f$, the backward substitution in a column-oriented fashion.
+*/
+void ICPreconditioner::apply( const VecN& r, VecN& z ) const
+{
+   typedef CMatMxN::ConstIterator  ConstIterator;
+
+   const size_t n( L_.rows() );
+
+   BLAZE_USER_ASSERT( r.size() == n, "Invalid residual vector size" );
+
+   z.resize( n, false );
+
+   // Forward substitution (L y = r)
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const ConstIterator last( L_.end(i) - 1 );
+      real tmp( r[i] );
+
+      for( ConstIterator element=L_.begin(i); element!=last; ++element )
+         tmp -= element->value() * z[element->index()];
+
+      z[i] = tmp * diag_[i];
+   }
+
+   // Backward substitution (L^T z = y)
+   for( size_t i=n; i>0UL; --i )
+   {
+      const ConstIterator last( L_.end(i-1UL) - 1 );
+      const real tmp( z[i-1UL] * diag_[i-1UL] );
+
+      z[i-1UL] = tmp;
+
+      for( ConstIterator element=L_.begin(i-1UL); element!=last; ++element )
+         z[element->index()] -= element->value() * tmp;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the IC(0) factor of the given system matrix with a diagonal shift.
+//
+// \param A The symmetric system matrix.
+// \param shift The relative diagonal shift.
+// \return \a true if the factorization succeeded, \a false in case of a breakdown.
+//
+// The factor \f$ L \f$ is stored in row-major order with the sparsity pattern of the lower part
+// of \a A. Each row contains its diagonal element as last element, even if the corresponding
+// element of \a A is not explicitly stored. The off-diagonal elements are computed by sparse
+// dot products of the previously computed rows.
+*/
+bool ICPreconditioner::factorize( const CMatMxN& A, real shift )
+{
+   typedef CMatMxN::ConstIterator  ConstIterator;
+   typedef CMatMxN::Iterator       Iterator;
+
+   const size_t n( A.rows() );
+
+   // Setting up the sparsity pattern of the lower part of A
+   size_t nonzeros( 0UL );
+   for( size_t i=0UL; i<n; ++i ) {
+      nonzeros += A.lowerBound( i, i ) - A.begin( i ) + 1UL;
+   }
+
+   L_.reset();
+   L_.resize( n, n, false );
+   L_.reserve( nonzeros );
+   diag_.resize( n, false );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const ConstIterator end( A.end(i) );
+      ConstIterator element( A.begin(i) );
+
+      for( ; element!=end && element->index()<i; ++element )
+         L_.append( i, element->index(), element->value() );
+
+      if( element != end && element->index() == i )
+         L_.append( i, i, element->value() * ( real(1) + shift ) );
+      else L_.append( i, i, real(0) );
+
+      L_.finalize( i );
+   }
+
+   // Computing the incomplete factorization
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const Iterator last( L_.end(i) - 1 );
+
+      real sum( 0 );
+
+      for( Iterator lij=L_.begin(i); lij!=last; ++lij )
+      {
+         const size_t j( lij->index() );
+
+         const ConstIterator jend( L_.end(j) - 1 );
+         ConstIterator ljk( L_.begin(j) );
+         Iterator lik( L_.begin(i) );
+         real tmp( lij->value() );
+
+         while( lik != lij && ljk != jend ) {
+            if( lik->index() < ljk->index() ) ++lik;
+            else if( ljk->index() < lik->index() ) ++ljk;
+            else {
+               tmp -= lik->value() * ljk->value();
+               ++lik;
+               ++ljk;
+            }
+         }
+
+         lij->value() = tmp * diag_[j];
+         sum += lij->value() * lij->value();
+      }
+
+      const real pivot( last->value() - sum );
+
+      if( !( pivot > real(0) ) )
+         return false;
+
+      last->value() = std::sqrt( pivot );
+      diag_[i] = real(1) / last->value();
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+} // namespace blaze
@@ -0,0 +1,114 @@
+//=================================================================================================
+/*!
+//  \file src/math/solvers/JacobiPreconditioner.cpp
+//  \brief Source file for the Jacobi preconditioner
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/math/solvers/JacobiPreconditioner.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for the Jacobi preconditioner.
+*/
+JacobiPreconditioner::JacobiPreconditioner()
+   : inv_()  // The inverse diagonal elements of the system matrix
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PRECONDITIONER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the Jacobi preconditioner for the given system matrix.
+//
+// \param A The square system matrix.
+// \return void
+// \exception std::invalid_argument Zero diagonal element.
+*/
+void JacobiPreconditioner::setup( const CMatMxN& A )
+{
+   BLAZE_USER_ASSERT( A.rows() == A.columns(), "Non-square system matrix detected" );
+
+   const size_t n( A.rows() );
+
+   inv_.resize( n, false );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const CMatMxN::ConstIterator element( A.find( i, i ) );
+
+      if( element == A.end( i ) || element->value() == real(0) )
+         throw std::invalid_argument( "Zero diagonal element" );
+
+      inv_[i] = real(1) / element->value();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Applies the Jacobi preconditioner to the given residual (\f$ z = M^{-1} r \f$).
+//
+// \param r The residual vector.
+// \param z The resulting preconditioned residual.
+// \return void
+*/
+void JacobiPreconditioner::apply( const VecN& r, VecN& z ) const
+{
+   BLAZE_USER_ASSERT( r.size() == inv_.size(), "Invalid residual vector size" );
+
+   z = inv_ * r;
+}
+//*************************************************************************************************
+
+} // namespace blaze
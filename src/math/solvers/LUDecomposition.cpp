@@ -0,0 +1,230 @@
+//=================================================================================================
+/*!
+//  \file src/math/solvers/LUDecomposition.cpp
+//  \brief Source file for the LU decomposition
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <blaze/math/Accuracy.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/solvers/LUDecomposition.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for the LUDecomposition class.
+*/
+LUDecomposition::LUDecomposition()
+   : LU_      ()         // The combined factors L and U
+   , p_       ()         // The row permutation
+   , L21_     ()         // Copy of the current panel of L below the diagonal block
+   , U12_     ()         // Copy of the current block row of U right of the diagonal block
+   , singular_( false )  // Flag for a singular matrix
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FACTORIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the LU decomposition of the given dense matrix.
+//
+// \param A The square matrix to be factorized.
+// \return void
+// \exception std::invalid_argument Invalid matrix size.
+//
+// The memory of previous factorizations is reused, i.e. repeatedly factorizing matrices of the
+// same size does not allocate.
+*/
+void LUDecomposition::factorize( const MatMxN& A )
+{
+   if( A.rows() != A.columns() )
+      throw std::invalid_argument( "Invalid matrix size" );
+
+   LU_ = A;
+   singular_ = luDecompose( LU_, p_, L21_, U12_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the LU decomposition of the given sparse matrix.
+//
+// \param A The square matrix to be factorized.
+// \return void
+// \exception std::invalid_argument Invalid matrix size.
+//
+// The sparse matrix is converted into a dense matrix, i.e. the factorization does not exploit
+// the sparsity of \a A. The memory of previous factorizations is reused, i.e. repeatedly
+// factorizing matrices of the same size does not allocate.
+*/
+void LUDecomposition::factorize( const CMatMxN& A )
+{
+   if( A.rows() != A.columns() )
+      throw std::invalid_argument( "Invalid matrix size" );
+
+   LU_ = A;
+   singular_ = luDecompose( LU_, p_, L21_, U12_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solves the linear system \f$ A x = b \f$ with the factorized matrix.
+//
+// \param b The right-hand side vector.
+// \param x The resulting solution vector.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side vector size.
+//
+// The system is solved by a forward substitution with \f$ L \f$ and a backward substitution
+// with \f$ U \f$. Unknowns of singular rows, i.e. rows with a diagonal element of \f$ U \f$
+// below the accuracy, are set to zero. \a b and \a x may refer to the same vector.
+*/
+void LUDecomposition::solve( const VecN& b, VecN& x ) const
+{
+   const size_t n( LU_.rows() );
+
+   if( b.size() != n )
+      throw std::invalid_argument( "Invalid right-hand side vector size" );
+
+   if( &b == &x ) {
+      const VecN tmp( b );
+      solve( tmp, x );
+      return;
+   }
+
+   luSolve( LU_, p_, b, x );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the linear system \f$ A X = B \f$ with the factorized matrix.
+//
+// \param B The matrix of right-hand sides (one per column).
+// \param X The resulting matrix of solutions (one per column).
+// \return void
+// \exception std::invalid_argument Invalid right-hand side matrix size.
+//
+// All right-hand sides are processed at once: Each step of the substitutions subtracts a
+// multiple of a complete row of \a X, which is stored contiguously. Unknowns of singular
+// rows are set to zero. \a B and \a X may refer to the same matrix.
+*/
+void LUDecomposition::solve( const MatMxN& B, MatMxN& X ) const
+{
+   const size_t n( LU_.rows() );
+   const size_t m( B.columns() );
+
+   if( B.rows() != n )
+      throw std::invalid_argument( "Invalid right-hand side matrix size" );
+
+   if( &B == &X ) {
+      const MatMxN tmp( B );
+      solve( tmp, X );
+      return;
+   }
+
+   X.resize( n, m, false );
+
+   // Performing the forward substitution (L Y = P B)
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const real* const lu( LU_.data(i) );
+      const real* const b ( B.data(p_[i]) );
+      real* const x( X.data(i) );
+
+      std::copy( b, b+m, x );
+
+      for( size_t j=0UL; j<i; ++j ) {
+         if( isDefault( lu[j] ) ) continue;
+         const real* const y( X.data(j) );
+         for( size_t k=0UL; k<m; ++k )
+            x[k] -= lu[j] * y[k];
+      }
+   }
+
+   // Performing the backward substitution (U X = Y)
+   for( size_t i=n-1UL; i<n; --i )
+   {
+      const real* const lu( LU_.data(i) );
+      real* const x( X.data(i) );
+
+      for( size_t j=i+1UL; j<n; ++j ) {
+         if( isDefault( lu[j] ) ) continue;
+         const real* const y( X.data(j) );
+         for( size_t k=0UL; k<m; ++k )
+            x[k] -= lu[j] * y[k];
+      }
+
+      if( std::fabs( lu[i] ) > accuracy ) {
+         const real inv( real(1) / lu[i] );
+         for( size_t k=0UL; k<m; ++k )
+            x[k] *= inv;
+      }
+      else {
+         std::fill( x, x+m, real(0) );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
@@ -0,0 +1,217 @@
+//*************************************************************************************************
+/*!
+//  \file src/math/solvers/MINRES.cpp
+//  \brief Source file for the MINRES solver
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <stdexcept>
+#include <blaze/math/Functions.h>
+#include <blaze/math/solvers/MINRES.h>
+#include <blaze/util/ColorMacros.h>
+#include <blaze/util/logging/DebugSection.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for the MINRES solver.
+*/
+MINRES::MINRES()
+   : r1_           ()        // The second to last Lanczos vector
+   , r2_           ()        // The last Lanczos vector
+   , y_            ()        // The product of the system matrix and the current Lanczos vector
+   , v_            ()        // The current Lanczos vector
+   , w_            ()        // The current search direction
+   , w1_           ()        // The second to last search direction
+   , w2_           ()        // The last search direction
+   , symmetryCheck_( true )  // Flag for the symmetry check of the system matrix
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solves the linear system \f$ A \cdot x + b = 0 \f$.
+//
+// \param A The symmetric system matrix.
+// \param b The right-hand side vector.
+// \param x The resulting vector of unknowns.
+// \return \a true if the system was solved within accuracy, \a false if not.
+// \exception std::invalid_argument System matrix is not square.
+// \exception std::invalid_argument System matrix is not symmetric.
+// \exception std::invalid_argument Invalid right-hand side vector size.
+//
+// The solution process starts from \f$ x = 0 \f$ and follows the MINRES algorithm of Paige and
+// Saunders for the system \f$ A \cdot x = -b \f$. The symmetry check of the system matrix can
+// be deactivated via setSymmetryCheck().
+*/
+bool MINRES::solve( const CMatMxN& A, const VecN& b, VecN& x )
+{
+   const size_t n( b.size() );
+
+   if( A.rows() != A.columns() )
+      throw std::invalid_argument( "System matrix is not square" );
+
+   if( symmetryCheck_ && !isSymmetric( A ) )
+      throw std::invalid_argument( "System matrix is not symmetric" );
+
+   if( A.rows() != b.size() )
+      throw std::invalid_argument( "Invalid right-hand side vector size" );
+
+   // Allocating helper data
+   r1_.resize( n, false );
+   r2_.resize( n, false );
+   y_.resize ( n, false );
+   v_.resize ( n, false );
+   w_.resize ( n, false );
+   w1_.resize( n, false );
+   w2_.resize( n, false );
+
+   // Preparing the vector of unknowns
+   x.resize( n, false );
+   x.reset();
+
+   // Computing the initial residual
+   r1_ = A * x + b;
+   r1_ = -r1_;
+
+   // Initial convergence test
+   lastPrecision_ = max( abs( r1_ ) );
+
+   size_t it( 0 );
+
+   if( lastPrecision_ >= threshold_ )
+   {
+      real beta  ( length( r1_ ) );
+      real oldb  ( 0 );
+      real dbar  ( 0 );
+      real epsln ( 0 );
+      real phibar( beta );
+      real cs    ( -1 );
+      real sn    ( 0 );
+
+      r2_ = r1_;
+      w_.reset();
+      w2_.reset();
+
+      // Performing the MINRES iterations
+      for( ; it<maxIterations_; ++it )
+      {
+         // Lanczos step
+         v_ = ( real(1) / beta ) * r2_;
+         y_ = A * v_;
+
+         if( it > 0UL )
+            y_ -= ( beta / oldb ) * r1_;
+
+         const real alpha( trans(v_) * y_ );
+         y_ -= ( alpha / beta ) * r2_;
+
+         swap( r1_, r2_ );
+         swap( r2_, y_ );
+
+         oldb = beta;
+         beta = length( r2_ );
+
+         // Applying the previous and computing the new Givens rotation
+         const real oldeps( epsln );
+         const real delta ( cs*dbar + sn*alpha );
+         const real gbar  ( sn*dbar - cs*alpha );
+
+         epsln = sn * beta;
+         dbar  = -cs * beta;
+
+         const real gamma( std::sqrt( gbar*gbar + beta*beta ) );
+
+         if( gamma == real(0) )
+            break;
+
+         cs = gbar / gamma;
+         sn = beta / gamma;
+
+         const real phi( cs * phibar );
+         phibar *= sn;
+
+         // Updating the search directions and the vector of unknowns
+         swap( w1_, w2_ );
+         swap( w2_, w_ );
+
+         multiAssign( assignTo( w_, ( real(1) / gamma ) * ( v_ - oldeps * w1_ - delta * w2_ ) ),
+                      addAssignTo( x, phi * w_ ) );
+
+         // Convergence test (the Euclidean norm bounds the maximum norm)
+         if( phibar < threshold_ || beta == real(0) ) {
+            ++it;
+            break;
+         }
+      }
+
+      // Computing the final residual
+      r1_ = A * x + b;
+      lastPrecision_ = max( abs( r1_ ) );
+   }
+
+   const bool converged( lastPrecision_ < threshold_ );
+
+   BLAZE_LOG_DEBUG_SECTION( log ) {
+      if( converged )
+         log << "      Solved the linear system in " << it << " MINRES iterations.";
+      else
+         log << BLAZE_YELLOW << "      WARNING: Did not solve the linear system within accuracy. (" << lastPrecision_ << ")" << BLAZE_OLDCOLOR;
+   }
+
+   lastIterations_ = it;
+
+   return converged;
+}
+//*************************************************************************************************
+
+} // namespace blaze
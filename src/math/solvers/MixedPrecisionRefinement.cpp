@@ -0,0 +1,254 @@
+//*************************************************************************************************
+/*!
+//  \file src/math/solvers/MixedPrecisionRefinement.cpp
+//  \brief Source file for the mixed precision iterative refinement solver
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/math/Functions.h>
+#include <blaze/math/solvers/MixedPrecisionRefinement.h>
+#include <blaze/util/ColorMacros.h>
+#include <blaze/util/logging/DebugSection.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for the MixedPrecisionRefinement class.
+*/
+MixedPrecisionRefinement::MixedPrecisionRefinement()
+   : LU_        ()               // The single precision LU factors of the system matrix
+   , p_         ()               // The row permutation of the single precision factorization
+   , L21_       ()               // Workspace for the panels of the single precision factorization
+   , U12_       ()               // Workspace for the block rows of the single precision factorization
+   , rf_        ()               // The single precision residual vector
+   , df_        ()               // The single precision correction vector
+   , lu_        ()               // The fallback factorization of the system matrix
+   , r_         ()               // The residual vector
+   , d_         ()               // The correction vector
+   , stagnation_( real(0.5) )    // The minimum relative reduction of the residual per iteration
+   , fallback_  ( false )        // Flag for the fallback in the last solution process
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Sets the stagnation factor of the refinement.
+//
+// \param factor The maximum admissible ratio of the residuals of two consecutive iterations.
+// \return void
+// \exception std::invalid_argument Invalid stagnation factor.
+//
+// In case an iteration does not reduce the maximum norm of the residual at least by the given
+// factor, the single precision factorization is considered insufficient for the system matrix
+// and the solver falls back to a factorization in full precision. The factor has to be in the
+// range \f$ (0..1) \f$. The default is 0.5.
+*/
+void MixedPrecisionRefinement::setStagnationFactor( real factor )
+{
+   if( !( factor > real(0) && factor < real(1) ) )
+      throw std::invalid_argument( "Invalid stagnation factor" );
+
+   stagnation_ = factor;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solves the linear system \f$ A \cdot x + b = 0 \f$ with a sparse system matrix.
+//
+// \param A The square system matrix.
+// \param b The right-hand side vector.
+// \param x The resulting vector of unknowns.
+// \return \a true if the system was solved within accuracy, \a false if not.
+// \exception std::invalid_argument Invalid matrix size.
+// \exception std::invalid_argument Invalid right-hand side vector size.
+//
+// The system matrix is converted into a dense single precision matrix for the factorization,
+// i.e. the factorization does not exploit the sparsity of \a A. The residuals are computed with
+// the sparse system matrix.
+*/
+bool MixedPrecisionRefinement::solve( const CMatMxN& A, const VecN& b, VecN& x )
+{
+   return refine( A, b, x );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the linear system \f$ A \cdot x + b = 0 \f$ with a dense system matrix.
+//
+// \param A The square system matrix.
+// \param b The right-hand side vector.
+// \param x The resulting vector of unknowns.
+// \return \a true if the system was solved within accuracy, \a false if not.
+// \exception std::invalid_argument Invalid matrix size.
+// \exception std::invalid_argument Invalid right-hand side vector size.
+*/
+bool MixedPrecisionRefinement::solve( const MatMxN& A, const VecN& b, VecN& x )
+{
+   return refine( A, b, x );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solves the linear system \f$ A \cdot x + b = 0 \f$ via mixed precision refinement.
+//
+// \param A The square system matrix.
+// \param b The right-hand side vector.
+// \param x The resulting vector of unknowns.
+// \return \a true if the system was solved within accuracy, \a false if not.
+// \exception std::invalid_argument Invalid matrix size.
+// \exception std::invalid_argument Invalid right-hand side vector size.
+//
+// The refinement starts from \f$ x = 0 \f$. In case an iteration with the single precision
+// factors increases the residual (e.g. due to an overflow in the single precision factors),
+// the iteration is undone before the solver falls back to the full precision factorization.
+// In case the refinement stagnates with the full precision factors, the solution process is
+// terminated.
+*/
+template< typename MT >  // Type of the system matrix
+bool MixedPrecisionRefinement::refine( const MT& A, const VecN& b, VecN& x )
+{
+   const size_t n( b.size() );
+
+   if( A.rows() != A.columns() )
+      throw std::invalid_argument( "Invalid matrix size" );
+
+   if( A.rows() != b.size() )
+      throw std::invalid_argument( "Invalid right-hand side vector size" );
+
+   // Factorizing a single precision copy of the system matrix
+   LU_ = A;
+   fallback_ = luDecompose( LU_, p_, L21_, U12_ );
+
+   if( fallback_ )
+      lu_.factorize( A );
+
+   // Preparing the vector of unknowns
+   x.resize( n, false );
+   x.reset();
+
+   // Computing the initial residual
+   r_ = A * x + b;
+   lastPrecision_ = max( abs( r_ ) );
+
+   // Performing the refinement iterations
+   size_t it( 0 );
+
+   while( !( lastPrecision_ < threshold_ ) && it < maxIterations_ )
+   {
+      // Solving the correction equation (A d = r)
+      if( fallback_ ) {
+         lu_.solve( r_, d_ );
+      }
+      else {
+         rf_ = r_;
+         luSolve( LU_, p_, rf_, df_ );
+         d_ = df_;
+      }
+
+      x -= d_;
+      ++it;
+
+      const real previous( lastPrecision_ );
+
+      r_ = A * x + b;
+      lastPrecision_ = max( abs( r_ ) );
+
+      // Stagnation test and fallback to the full precision factorization
+      if( !( lastPrecision_ <= stagnation_ * previous ) )
+      {
+         if( fallback_ )
+            break;
+
+         if( !( lastPrecision_ < previous ) ) {
+            x += d_;
+            r_ = A * x + b;
+            lastPrecision_ = previous;
+         }
+
+         fallback_ = true;
+         lu_.factorize( A );
+      }
+   }
+
+   BLAZE_LOG_DEBUG_SECTION( log ) {
+      if( lastPrecision_ < threshold_ )
+         log << "      Solved the linear system in " << it << " refinement iterations" << ( fallback_ ? " (full precision fallback)." : "." );
+      else
+         log << BLAZE_YELLOW << "      WARNING: Did not solve the linear system within accuracy. (" << lastPrecision_ << ")" << BLAZE_OLDCOLOR;
+   }
+
+   lastIterations_ = it;
+
+   return lastPrecision_ < threshold_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
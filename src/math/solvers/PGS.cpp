@@ -37,6 +37,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <cmath>
+#include <vector>
 #include <blaze/math/solvers/PGS.h>
 
 
@@ -52,12 +54,243 @@ namespace blaze {
 /*!\brief The default constructor for the PGS class.
 */
 PGS::PGS()
-   : diagonal_()  // Vector for the diagonal entries of the LCP matrix
+   : diagonal_  ()              // Vector for the diagonal entries of the LCP matrix
+   , mode_      ( sequential )  // The sweep mode of the PGS solver
+   , xold_      ()              // The unknowns of the previous sweep
+   , pattern_   ()              // The column-major copy of the LCP matrix
+   , colors_    ()              // The color of each block of unknowns
+   , colorStart_()              // The index of the first block of each color
+   , order_     ()              // The blocks of unknowns sorted by color
+   , rmax_      ()              // The maximum change of an unknown per parallel task
+   , blockA_    ()              // The 3x3 block copy of the LCP matrix
+   , updated_   ( false )       // Flag for an incremental update of the cached data
 {}
 //*************************************************************************************************
 
 
 
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Sorts the blocks of unknowns by color.
+//
+// \return void
+//
+// This function removes all colors without blocks, renumbers the remaining colors consecutively
+// and sorts the blocks by color. The blocks of a single color are kept in ascending order.
+*/
+void PGS::sortColors()
+{
+   const size_t nb( colors_.size() );
+
+   // Counting the blocks of each color
+   colorStart_.clear();
+   for( size_t k=0UL; k<nb; ++k ) {
+      if( colors_[k] >= colorStart_.size() )
+         colorStart_.resize( colors_[k]+1UL, 0UL );
+      ++colorStart_[colors_[k]];
+   }
+
+   // Removing the empty colors
+   std::vector<size_t> marker( colorStart_.size() );
+   size_t colors( 0UL );
+
+   for( size_t c=0UL; c<colorStart_.size(); ++c ) {
+      marker[c] = colors;
+      if( colorStart_[c] != 0UL )
+         colorStart_[colors++] = colorStart_[c];
+   }
+   colorStart_.resize( colors );
+
+   for( size_t k=0UL; k<nb; ++k ) {
+      colors_[k] = marker[colors_[k]];
+   }
+
+   // Sorting the blocks by color
+   size_t start( 0UL );
+   for( size_t c=0UL; c<colorStart_.size(); ++c ) {
+      const size_t count( colorStart_[c] );
+      colorStart_[c] = start;
+      start += count;
+   }
+   colorStart_.push_back( nb );
+
+   order_.resize( nb );
+   marker.assign( colorStart_.begin(), colorStart_.end()-1 );
+
+   for( size_t k=0UL; k<nb; ++k ) {
+      order_[marker[colors_[k]]++] = k;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Exact solution of the local problem of a single contact.
+//
+// \param D The padded, column-major 3x3 diagonal block of the contact.
+// \param r The local right-hand side of the contact.
+// \param mu The coefficient of friction of the contact.
+// \param x The resulting three unknowns of the contact.
+// \return \a true if a solution was found, \a false if not.
+//
+// This function computes the unknowns \f$ x \f$ of a contact such that \f$ w = D x - r \f$ and
+// \f$ x \f$ satisfy the complementarity conditions of the contact LCP, i.e. the normal unknown
+// \f$ x_0 \f$ is non-negative and complementary to \f$ w_0 \f$ and each frictional unknown is
+// either inside of the friction box \f$ [-\mu x_0..\mu x_0] \f$ with a zero \f$ w_i \f$ or on
+// one of its bounds with a \f$ w_i \f$ of appropriate sign. The possible cases are tested one
+// after another: sticking contact, separating contact and the eight sliding directions. Each
+// case results in a linear system of size 1 to 3, whose solution is accepted in case it
+// satisfies all conditions of the case.
+*/
+bool PGS::solveContact( const real* D, const real* r, real mu, real* x )
+{
+   const size_t S( BlockMatrix::spacing );
+
+   const real unit[3][3] = { { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } };
+   const size_t all[3] = { 0UL, 1UL, 2UL };
+
+   real z[3];
+
+   // Sticking contact
+   if( solveSystem( D, r, unit, all, 3UL, z ) &&
+       z[0] >= real(0) && std::fabs( z[1] ) <= mu*z[0] && std::fabs( z[2] ) <= mu*z[0] ) {
+      x[0] = z[0];
+      x[1] = z[1];
+      x[2] = z[2];
+      return true;
+   }
+
+   // Separating contact
+   if( r[0] <= real(0) ) {
+      x[0] = x[1] = x[2] = real(0);
+      return true;
+   }
+
+   // Sliding contact
+   for( int s1=-1; s1<=1; ++s1 ) {
+      for( int s2=-1; s2<=1; ++s2 )
+      {
+         if( s1 == 0 && s2 == 0 ) continue;
+
+         const int s[3] = { 0, s1, s2 };
+
+         real V[3][3] = { { 1, s1*mu, s2*mu }, { 0, 0, 0 }, { 0, 0, 0 } };
+         size_t rows[3] = { 0UL, 0UL, 0UL };
+         size_t k( 1UL );
+
+         for( size_t i=1UL; i<3UL; ++i ) {
+            if( s[i] == 0 ) {
+               V[k][i] = real(1);
+               rows[k] = i;
+               ++k;
+            }
+         }
+
+         if( !solveSystem( D, r, V, rows, k, z ) || z[0] < real(0) )
+            continue;
+
+         for( size_t i=0UL; i<3UL; ++i ) {
+            x[i] = real(0);
+            for( size_t c=0UL; c<k; ++c )
+               x[i] += z[c] * V[c][i];
+         }
+
+         bool feasible( true );
+
+         for( size_t i=1UL; i<3UL; ++i ) {
+            const real w( D[i]*x[0] + D[i+S]*x[1] + D[i+2UL*S]*x[2] - r[i] );
+            if( ( s[i] ==  0 && std::fabs( x[i] ) > mu*x[0] ) ||
+                ( s[i] ==  1 && w > real(0) ) ||
+                ( s[i] == -1 && w < real(0) ) )
+               feasible = false;
+         }
+
+         if( feasible )
+            return true;
+      }
+   }
+
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves a reduced local system of a single contact.
+//
+// \param D The padded, column-major 3x3 diagonal block of the contact.
+// \param r The local right-hand side of the contact.
+// \param V The \a k basis vectors of the unknowns of the contact.
+// \param rows The \a k rows of the local system that are required to vanish.
+// \param k The size of the reduced system \f$[1..3]\f$.
+// \param z The resulting \a k coefficients of the basis vectors.
+// \return \a true if the reduced system is regular, \a false if it is singular.
+//
+// This function solves the \a k x \a k system \f$ (D V)_{rows} z = r_{rows} \f$ via Cramer's rule.
+*/
+bool PGS::solveSystem( const real* D, const real* r, const real (*V)[3],
+                       const size_t* rows, size_t k, real* z )
+{
+   BLAZE_INTERNAL_ASSERT( k >= 1UL && k <= 3UL, "Invalid size of the reduced system" );
+
+   const size_t S( BlockMatrix::spacing );
+
+   real M[3][3];
+
+   for( size_t a=0UL; a<k; ++a ) {
+      for( size_t c=0UL; c<k; ++c ) {
+         M[a][c] = D[rows[a]]*V[c][0] + D[rows[a]+S]*V[c][1] + D[rows[a]+2UL*S]*V[c][2];
+      }
+   }
+
+   if( k == 1UL )
+   {
+      if( M[0][0] == real(0) )
+         return false;
+      z[0] = r[rows[0]] / M[0][0];
+   }
+   else if( k == 2UL )
+   {
+      const real det( M[0][0]*M[1][1] - M[0][1]*M[1][0] );
+      if( det == real(0) )
+         return false;
+
+      const real idet( real(1) / det );
+      const real r0( r[rows[0]] ), r1( r[rows[1]] );
+
+      z[0] = ( M[1][1]*r0 - M[0][1]*r1 ) * idet;
+      z[1] = ( M[0][0]*r1 - M[1][0]*r0 ) * idet;
+   }
+   else
+   {
+      const real c00( M[1][1]*M[2][2] - M[1][2]*M[2][1] );
+      const real c01( M[1][2]*M[2][0] - M[1][0]*M[2][2] );
+      const real c02( M[1][0]*M[2][1] - M[1][1]*M[2][0] );
+      const real det( M[0][0]*c00 + M[0][1]*c01 + M[0][2]*c02 );
+
+      if( det == real(0) )
+         return false;
+
+      const real idet( real(1) / det );
+      const real r0( r[rows[0]] ), r1( r[rows[1]] ), r2( r[rows[2]] );
+
+      z[0] = ( c00*r0 + ( M[0][2]*M[2][1] - M[0][1]*M[2][2] )*r1 + ( M[0][1]*M[1][2] - M[0][2]*M[1][1] )*r2 ) * idet;
+      z[1] = ( c01*r0 + ( M[0][0]*M[2][2] - M[0][2]*M[2][0] )*r1 + ( M[0][2]*M[1][0] - M[0][0]*M[1][2] )*r2 ) * idet;
+      z[2] = ( c02*r0 + ( M[0][1]*M[2][0] - M[0][0]*M[2][1] )*r1 + ( M[0][0]*M[1][1] - M[0][1]*M[1][0] )*r2 ) * idet;
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
 
 //=================================================================================================
 //
@@ -71,6 +304,9 @@ PGS::PGS()
 template bool PGS::solve<LCP>( LCP& );
 template bool PGS::solve<BoxLCP>( BoxLCP& );
 template bool PGS::solve<ContactLCP>( ContactLCP& );
+template void PGS::update<LCP>( LCP&, const std::vector<size_t>&, const CMatMxN&, const CMatMxN& );
+template void PGS::update<BoxLCP>( BoxLCP&, const std::vector<size_t>&, const CMatMxN&, const CMatMxN& );
+template void PGS::update<ContactLCP>( ContactLCP&, const std::vector<size_t>&, const CMatMxN&, const CMatMxN& );
 #endif
 /*! \endcond */
 //*************************************************************************************************